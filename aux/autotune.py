@@ -0,0 +1,222 @@
+#!/usr/bin/env python
+# Copyright (c) 2018 the libgoldilocks contributors.
+# Released under the MIT License.  See LICENSE.txt for license information.
+"""
+Choose the scalar multiplication parameters of tuning.h for this host.
+
+Each group of parameters is tuned on its own, with the others at their
+defaults: every candidate is built in build/tune, its test program is run,
+and, if it passes, the benchmarks that the group affects are timed.  A
+candidate which fails its tests is never chosen.  The fastest candidates
+are written to a header which Makefile.custom uses for later builds, and
+a report compares them with the defaults.
+
+Timings on a busy host are noisy, so each candidate is timed in turn with
+the defaults, run by run, and replaces them only if it is faster by more
+than the margin in every run.  The chosen parameters are then checked
+together in the same way, and any group which no longer beats the defaults
+is dropped before the header is written.
+
+Usage: autotune.py [--output FILE] [--runs N] [--margin F] [--group NAME]... [--make CMD]
+"""
+
+import argparse
+import math
+import os
+import re
+import shlex
+import subprocess
+import sys
+
+TUNING_H = os.path.join(os.path.dirname(os.path.abspath(__file__)),
+                        "..", "src", "include", "tuning.h")
+
+def read_defaults(path):
+    """The numeric defaults of tuning.h, by name."""
+    with open(path) as f:
+        text = f.read()
+    return dict((k, int(v)) for k, v in
+                re.findall(r'^#ifndef (\w+)\n#define \1 (\d+)$', text, re.M))
+
+def one(name, values):
+    return [{name: v} for v in values]
+
+# (group, candidates, benchmarks which depend on it)
+GROUPS = [
+    ("window", one("GOLDILOCKS_WINDOW_BITS", [3, 4, 5, 6]),
+        ["Point scalarmul", "Point double scalarmul", "Point dual scalarmul"]),
+    # Only the geometries which goldilocks_gen_tables emits base tables for.
+    ("combs", [
+        {"GOLDILOCKS_COMBS_N": n, "GOLDILOCKS_COMBS_T": t, "GOLDILOCKS_COMBS_S": s}
+        for (n, t, s) in [(5, 5, 18), (10, 5, 9), (15, 5, 6)]],
+        ["Point precmp scalarmul", "EdDSA sign"]),
+    ("wnaf_fixed", one("GOLDILOCKS_WNAF_FIXED_TABLE_BITS", [5, 6, 7, 8]),
+        ["Point double scalarmul_v", "EdDSA verify"]),
+    ("wnaf_split", one("GOLDILOCKS_WNAF_FIXED_SPLIT", [0, 1]),
+        ["Point double scalarmul_v", "EdDSA verify"]),
+    ("wnaf_var", one("GOLDILOCKS_WNAF_VAR_TABLE_BITS", [2, 3, 4, 5]),
+        ["Point double scalarmul_v", "EdDSA verify"]),
+    ("wnaf_scalarmul", one("GOLDILOCKS_WNAF_SCALARMUL_TABLE_BITS", [3, 4, 5, 6]),
+        ["Point scalarmul_v"]),
+    ("multiscalarmul", one("GOLDILOCKS_MULTISCALARMUL_WINDOW_BITS", [3, 4, 5]),
+        ["Point multiscalarmul x16"]),
+]
+
+# The defaults of the parameters tuned above
+DEFAULTS = dict((k, v) for k, v in read_defaults(TUNING_H).items()
+                if any(k in c for g in GROUPS for c in g[1]))
+
+RESULT = re.compile(r'^(.+?):\s+([0-9.]+)\s*([ mµn])s\s')
+SCALE = {" ": 1.0, "m": 1e-3, "µ": 1e-6, "n": 1e-9}
+
+def tag(config):
+    return "_".join("%s%d" % (k.replace("GOLDILOCKS_", "").lower(), v)
+                    for k, v in sorted(config.items()) if DEFAULTS.get(k) != v) or "default"
+
+class TestFailure(RuntimeError):
+    pass
+
+def build(make, config):
+    """Build the benchmark and tests for config, run the tests, and return the benchmark's path."""
+    top = os.path.join("build", "tune", tag(config))
+    obj = os.path.join(top, "obj")
+    xcflags = " ".join("-D%s=%d" % kv for kv in sorted(config.items()))
+    cmd = shlex.split(make) + [
+        "-j%d" % (os.cpu_count() or 1),
+        "BUILD_OBJ=" + obj, "BUILD_IBIN=" + os.path.join(obj, "bin"),
+        "BUILD_LIB=" + os.path.join(top, "lib"), "BUILD_BIN=" + os.path.join(top, "bin"),
+        "BUILD_C=" + os.path.join(top, "gen"), "BUILD_PY=" + obj,
+        "TUNED_H=", "XCFLAGS=" + xcflags,
+        os.path.join(obj, "bin", "bench"), os.path.join(obj, "bin", "test")]
+    sys.stderr.write("building %s\n" % tag(config))
+    if not os.path.isdir(top):
+        os.makedirs(top)
+    log = os.path.join(top, "build.log")
+    with open(log, "w") as f:
+        if subprocess.call(cmd, stdout=f, stderr=subprocess.STDOUT):
+            raise RuntimeError("build of %s failed; see %s" % (tag(config), log))
+    log = os.path.join(top, "test.log")
+    with open(log, "w") as f:
+        if subprocess.call([os.path.join(obj, "bin", "test")], stdout=f, stderr=subprocess.STDOUT):
+            raise TestFailure("tests of %s failed; see %s" % (tag(config), log))
+    return os.path.join(obj, "bin", "bench")
+
+def measure(bench, names):
+    """Return the time in seconds of each named benchmark, from one run."""
+    cmd = [bench, "--micro"]
+    for name in names:
+        cmd += ["--only", name]
+    times = {}
+    out = subprocess.check_output(cmd).decode("utf-8")
+    for line in out.splitlines():
+        m = RESULT.match(line)
+        if m and m.group(1) in names:
+            times[m.group(1)] = float(m.group(2)) * SCALE[m.group(3)]
+    missing = [n for n in names if n not in times]
+    if missing:
+        raise RuntimeError("%s did not report %s" % (bench, ", ".join(missing)))
+    return times
+
+def score(times, base):
+    """Geometric mean of the ratios to the default times."""
+    return math.exp(sum(math.log(times[n] / base[n]) for n in base) / len(base))
+
+def compare(default_bench, bench, names, runs):
+    """
+    Time bench against default_bench, alternating between them so that both
+    see the same load.  Return the (default, bench) times of each run.
+    """
+    return [(measure(default_bench, names), measure(bench, names)) for _ in range(runs)]
+
+def worst(pairs, names):
+    """The worst score over the runs, which must beat the margin for a change to count."""
+    return max(score(dict((n, t[n]) for n in names), dict((n, d[n]) for n in names))
+               for d, t in pairs)
+
+def best(pairs, which):
+    """The best time of each benchmark over the runs, of the defaults (0) or the candidate (1)."""
+    times = {}
+    for pair in pairs:
+        for n, t in pair[which].items():
+            times[n] = min(times.get(n, t), t)
+    return times
+
+def write_header(path, config):
+    with open(path, "w") as f:
+        f.write("/* Generated by aux/autotune.py for this host; delete to use the defaults. */\n")
+        for k, v in sorted(config.items()):
+            f.write("#ifndef %s\n#define %s %d\n#endif\n" % (k, k, v))
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.strip().split("\n")[0])
+    parser.add_argument("--output", default="src/GEN/tuning_host.h")
+    parser.add_argument("--runs", type=int, default=3)
+    parser.add_argument("--margin", type=float, default=0.02)
+    parser.add_argument("--group", action="append", choices=[g[0] for g in GROUPS])
+    parser.add_argument("--make", default="make -f Makefile.custom")
+    args = parser.parse_args()
+
+    groups = [g for g in GROUPS if not args.group or g[0] in args.group]
+    names = sorted(set(n for g in groups for n in g[2]))
+    default_bench = build(args.make, DEFAULTS)
+
+    chosen, lines = {}, []
+    for group, candidates, benches in groups:
+        choice, choice_score = None, 1.0 - args.margin
+        for change in candidates:
+            config = dict(DEFAULTS, **change)
+            if config == DEFAULTS:
+                continue
+            try:
+                bench = build(args.make, config)
+            except TestFailure as e:
+                sys.stderr.write("%s\n" % e)
+                lines.append("  %-16s %-40s %s" % (group, tag(config), "failed tests"))
+                continue
+            s = worst(compare(default_bench, bench, benches, args.runs), benches)
+            lines.append("  %-16s %-40s %6.3f" % (group, tag(config), s))
+            if s < choice_score:
+                choice, choice_score = change, s
+        if choice:
+            chosen[group] = choice
+
+    # Check the choices together, since groups share benchmarks, and drop
+    # the worst group which doesn't keep its gain until they all do.
+    dropped = []
+    while True:
+        tuned = dict(DEFAULTS)
+        for change in chosen.values():
+            tuned.update(change)
+        pairs = compare(default_bench, build(args.make, tuned), names, args.runs)
+        losing = sorted((worst(pairs, benches), group)
+                        for group, _, benches in groups if group in chosen)
+        losing = [l for l in losing if l[0] >= 1.0 - args.margin]
+        if not losing:
+            break
+        s, group = losing[-1]
+        dropped.append("  %-16s %-40s %6.3f" % (group, tag(dict(DEFAULTS, **chosen[group])), s))
+        del chosen[group]
+
+    default_times, tuned_times = best(pairs, 0), best(pairs, 1)
+    write_header(args.output, dict((k, v) for k, v in tuned.items() if v != DEFAULTS[k]))
+
+    report = ["Candidates (worst time relative to the defaults, lower is better):"] + lines
+    if dropped:
+        report += ["", "Dropped, since they were no faster with the others:"] + dropped
+    report += ["", "Chosen parameters:"]
+    for k in sorted(DEFAULTS):
+        report.append("  %-40s %4d%s" % (k, tuned[k],
+                      "" if tuned[k] == DEFAULTS[k] else "  (default %d)" % DEFAULTS[k]))
+    report += ["", "%-28s %12s %12s %8s" % ("Benchmark", "default", "tuned", "speedup")]
+    for n in names:
+        report.append("%-28s %10.1fus %10.1fus %7.3fx" % (
+            n, default_times[n] * 1e6, tuned_times[n] * 1e6, default_times[n] / tuned_times[n]))
+    report += ["", "Wrote %s" % args.output]
+
+    text = "\n".join(report) + "\n"
+    with open(os.path.join("build", "tune", "report.txt"), "w") as f:
+        f.write(text)
+    sys.stdout.write(text)
+
+if __name__ == '__main__':
+    main()
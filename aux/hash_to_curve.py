@@ -0,0 +1,153 @@
+#!/usr/bin/env python
+# Copyright (c) 2018 the libgoldilocks contributors.
+# Released under the MIT License.  See LICENSE.txt for license information.
+"""
+Reference implementation of the RFC 9380 suites edwards448_XOF:SHAKE256_ELL2_RO_
+and _NU_, written from the RFC's generic algorithms (the straight-line
+Elligator 2 of section 6.7.1 and the 4-isogeny of RFC 7748 section 4.2)
+rather than the optimized ones which src/hash_to_curve.c follows.
+
+Usage: hash_to_curve.py [--check] [DST MSG...]
+
+Prints the EdDSA encoding of hash_to_curve and encode_to_curve of each
+message.  --check runs some consistency checks of the curve maps first.
+"""
+
+import hashlib
+import sys
+
+p = 2**448 - 2**224 - 1
+d = -39081 % p
+J = 156326
+Z = -1 % p
+K_BITS = 224
+L = 84 # ceil((448 + k) / 8)
+IDENTITY = (0, 1)
+
+def inv0(x):
+    return pow(x, p-2, p)
+
+def is_square(x):
+    return x == 0 or pow(x, (p-1)//2, p) == 1
+
+def sqrt(x):
+    r = pow(x, (p+1)//4, p)
+    assert r*r % p == x % p
+    return r
+
+def sgn0(x):
+    return x % p % 2
+
+def expand_message_xof(msg, dst, n):
+    assert n <= 65535
+    if len(dst) > 255:
+        dst = hashlib.shake_256(b"H2C-OVERSIZE-DST-" + dst).digest(2*K_BITS//8)
+    dst_prime = dst + bytes([len(dst)])
+    return hashlib.shake_256(msg + n.to_bytes(2, "big") + dst_prime).digest(n)
+
+def hash_to_field(msg, count, dst):
+    u = expand_message_xof(msg, dst, count*L)
+    return [int.from_bytes(u[i*L:(i+1)*L], "big") % p for i in range(count)]
+
+def elligator2(u):
+    """map_to_curve_elligator2 for curve448: K = 1, J = 156326."""
+    x1 = -J * inv0(1 + Z*u*u) % p
+    if x1 == 0:
+        x1 = -J % p
+    gx1 = (x1**3 + J*x1**2 + x1) % p
+    x2 = (-x1 - J) % p
+    gx2 = (x2**3 + J*x2**2 + x2) % p
+    if is_square(gx1):
+        x, y = x1, sqrt(gx1)
+        if sgn0(y) != 1: y = -y % p
+    else:
+        x, y = x2, sqrt(gx2)
+        if sgn0(y) != 0: y = -y % p
+    return x, y
+
+def on_montgomery(pt):
+    u, v = pt
+    return (v*v - (u**3 + J*u*u + u)) % p == 0
+
+def montgomery_to_edwards(pt):
+    """The 4-isogeny from curve448 to edwards448, RFC 7748 section 4.2."""
+    u, v = pt
+    xn = 4*v*(u*u - 1)
+    xd = u**4 - 2*u*u + 4*v*v + 1
+    yn = -(u**5 - 2*u**3 - 4*u*v*v + u)
+    yd = u**5 - 2*u*u*v*v - 2*u**3 - 2*v*v + u
+    if xd % p == 0 or yd % p == 0:
+        return IDENTITY
+    return (xn * inv0(xd) % p, yn * inv0(yd) % p)
+
+def edwards_to_montgomery(pt):
+    """The dual 4-isogeny, RFC 7748 section 4.2."""
+    x, y = pt
+    return (y*y * inv0(x*x) % p, (2 - x*x - y*y) * y * inv0(x**3) % p)
+
+def montgomery_add(a, b):
+    (u1, v1), (u2, v2) = a, b
+    if u1 == u2:
+        lam = (3*u1*u1 + 2*J*u1 + 1) * inv0(2*v1) % p
+    else:
+        lam = (v2 - v1) * inv0(u2 - u1) % p
+    u3 = (lam*lam - J - u1 - u2) % p
+    return (u3, (lam*(u1 - u3) - v1) % p)
+
+def on_edwards(pt):
+    x, y = pt
+    return (x*x + y*y - 1 - d*x*x*y*y) % p == 0
+
+def edwards_add(a, b):
+    (x1, y1), (x2, y2) = a, b
+    t = d*x1*x2*y1*y2
+    return ((x1*y2 + y1*x2) * inv0(1 + t) % p, (y1*y2 - x1*x2) * inv0(1 - t) % p)
+
+def clear_cofactor(pt):
+    pt = edwards_add(pt, pt)
+    return edwards_add(pt, pt)
+
+def map_to_curve(u):
+    return montgomery_to_edwards(elligator2(u))
+
+def hash_to_curve(msg, dst):
+    u = hash_to_field(msg, 2, dst)
+    return clear_cofactor(edwards_add(map_to_curve(u[0]), map_to_curve(u[1])))
+
+def encode_to_curve(msg, dst):
+    return clear_cofactor(map_to_curve(hash_to_field(msg, 1, dst)[0]))
+
+def encode_eddsa(pt):
+    x, y = pt
+    return y.to_bytes(57, "little")[:56] + bytes([0x80 * (x & 1)])
+
+def check():
+    dst = b"check"
+    pts = [elligator2(u) for u in hash_to_field(b"points", 8, dst)] + [elligator2(0), elligator2(1)]
+    for pt in pts:
+        assert on_montgomery(pt)
+        assert on_edwards(montgomery_to_edwards(pt))
+    # The maps are dual isogenies, so going there and back multiplies by 4
+    for pt in pts[:8]:
+        e = montgomery_to_edwards(pt)
+        assert montgomery_to_edwards(edwards_to_montgomery(e)) == clear_cofactor(e)
+    # ... and homomorphisms
+    for a, b in zip(pts[:4], pts[4:8]):
+        assert montgomery_to_edwards(montgomery_add(a, b)) == \
+            edwards_add(montgomery_to_edwards(a), montgomery_to_edwards(b))
+    sys.stderr.write("checks passed\n")
+
+def main(args):
+    if args and args[0] == "--check":
+        check()
+        args = args[1:]
+    if not args:
+        return
+    dst = args[0].encode()
+    for msg in args[1:]:
+        msg = msg.encode()
+        print("hash_to_curve(%r)   = %s" % (msg, encode_eddsa(hash_to_curve(msg, dst)).hex()))
+        print("encode_to_curve(%r) = %s" % (msg, encode_eddsa(encode_to_curve(msg, dst)).hex()))
+
+if __name__ == '__main__':
+    main(sys.argv[1:])
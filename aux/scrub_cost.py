@@ -0,0 +1,61 @@
+#!/usr/bin/env python
+# Copyright (c) 2018 the libgoldilocks contributors.
+# Released under the MIT License.  See LICENSE.txt for license information.
+"""
+Report what each scrubbing policy of word.h costs per operation.
+
+The benchmarks are built in build/tune with the default scrubbing, which
+skips temporaries holding only public data, and with
+GOLDILOCKS_SCRUB_PUBLIC=1, and each operation is timed under both.
+
+Usage: scrub_cost.py [--runs N] [--make CMD]
+"""
+
+import argparse
+import sys
+
+import autotune
+
+POLICIES = [
+    ("default", {}),
+    ("scrub public", {"GOLDILOCKS_SCRUB_PUBLIC": 1}),
+]
+
+BENCHMARKS = [
+    "Point encode like EdDSA",
+    "Point decode like EdDSA",
+    "EdDSA keygen",
+    "EdDSA sign",
+    "EdDSA verify",
+    "Point double scalarmul_v",
+]
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.strip().split("\n")[0])
+    parser.add_argument("--runs", type=int, default=7)
+    parser.add_argument("--make", default="make -f Makefile.custom")
+    args = parser.parse_args()
+
+    benches = [autotune.build(args.make, dict(autotune.DEFAULTS, **config))
+               for _, config in POLICIES]
+
+    # Interleave the runs, starting each round with a different policy, so
+    # that changes in the load of the host hit every policy alike.
+    times = [{} for _ in POLICIES]
+    for r in range(args.runs):
+        for i in range(len(POLICIES)):
+            k = (i + r) % len(POLICIES)
+            for n, t in autotune.measure(benches[k], BENCHMARKS).items():
+                times[k][n] = min(times[k].get(n, t), t)
+
+    out = ["%-28s" % "Benchmark" + "".join("%16s" % p[0] for p in POLICIES)]
+    for n in BENCHMARKS:
+        base = times[0][n]
+        cells = ["%14.2fus" % (base * 1e6)]
+        cells += ["%+14.2fus" % ((t[n] - base) * 1e6) for t in times[1:]]
+        out.append("%-28s" % n + "".join("%16s" % c for c in cells))
+    out.append("(other policies are shown as the change from the default)")
+    sys.stdout.write("\n".join(out) + "\n")
+
+if __name__ == '__main__':
+    main()
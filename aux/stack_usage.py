@@ -0,0 +1,54 @@
+#!/usr/bin/env python
+# Copyright (c) 2018 the libgoldilocks contributors.
+# Released under the MIT License.  See LICENSE.txt for license information.
+"""
+Report the worst-case stack depth of each public function, from the
+call graphs that gcc writes with -fcallgraph-info=su.
+
+Usage: stack_usage.py file.ci [file.ci ...]
+
+Calls into other libraries (libc, for instance) are not counted.
+"""
+
+import re
+import sys
+
+NODE = re.compile(r'node: \{ title: "([^"]*)" label: "[^"]*\\n(\d+) bytes \(([^)]*)\)"')
+EDGE = re.compile(r'edge: \{ sourcename: "([^"]*)" targetname: "([^"]*)"')
+
+def read_graphs(paths):
+    frames, calls, kinds = {}, {}, {}
+    for path in paths:
+        with open(path) as f:
+            for line in f:
+                m = NODE.match(line)
+                if m:
+                    frames[m.group(1)] = int(m.group(2))
+                    kinds[m.group(1)] = m.group(3)
+                    continue
+                m = EDGE.match(line)
+                if m:
+                    calls.setdefault(m.group(1), set()).add(m.group(2))
+    return frames, calls, kinds
+
+def depth(name, frames, calls, memo, active=()):
+    if name in memo:
+        return memo[name]
+    if name in active:
+        raise ValueError("recursion through %s" % name)
+    deepest = 0
+    for callee in calls.get(name, ()):
+        deepest = max(deepest, depth(callee, frames, calls, memo, active + (name,)))
+    memo[name] = frames.get(name, 0) + deepest
+    return memo[name]
+
+def main(paths):
+    frames, calls, kinds = read_graphs(paths)
+    memo = {}
+    public = [name for name in frames if ':' not in name and name.startswith("goldilocks_")]
+    for name in sorted(public, key=lambda n: (-depth(n, frames, calls, memo), n)):
+        bounded = "" if kinds[name] != "dynamic" else "  (unbounded)"
+        print("%8d  %s%s" % (depth(name, frames, calls, memo), name, bounded))
+
+if __name__ == '__main__':
+    main(sys.argv[1:])
@@ -0,0 +1,456 @@
+/**
+ * @file _edgold.c
+ * @copyright
+ *   Copyright (c) 2018 the libgoldilocks contributors.  \n
+ *   Released under the MIT License.  See LICENSE.txt for license information.
+ *
+ * @brief Native bindings for edgold: Ed448 signatures and X448, one at a
+ * time or in batches over sequences.
+ *
+ * Arguments may be any objects which support the buffer protocol (bytes,
+ * bytearray, memoryview, ctypes arrays ...), and are used in place rather
+ * than copied.  The GIL is released while the library works, so threads can
+ * sign in parallel.  The buffers stay exported until the call returns, so
+ * a bytearray can't be resized under it, but their contents may change if
+ * another thread writes to them meanwhile.
+ */
+#define PY_SSIZE_T_CLEAN
+#include <Python.h>
+
+#include <goldilocks/ed448.h>
+#include <goldilocks/point_448.h>
+
+/** No length requirement for get_buffer. */
+#define ANY_LENGTH (-1)
+
+/** Export obj's buffer into view, which must be zeroed, and check its length. */
+static int get_buffer (
+    Py_buffer *view,
+    PyObject *obj,
+    Py_ssize_t exact,
+    Py_ssize_t max,
+    const char *what
+) {
+    if (PyObject_GetBuffer(obj, view, PyBUF_SIMPLE) < 0) return -1;
+    if (exact != ANY_LENGTH && view->len != exact) {
+        PyErr_Format(PyExc_ValueError, "%s must be %zd bytes, not %zd", what, exact, view->len);
+    } else if (max != ANY_LENGTH && view->len > max) {
+        PyErr_Format(PyExc_ValueError, "%s must be at most %zd bytes, not %zd", what, max, view->len);
+    } else {
+        return 0;
+    }
+    PyBuffer_Release(view);
+    view->obj = NULL;
+    return -1;
+}
+
+static void release (Py_buffer *view) {
+    if (view->obj) PyBuffer_Release(view);
+    view->obj = NULL;
+}
+
+/** A context, which None leaves empty. */
+static int get_context (Py_buffer *view, PyObject *obj) {
+    if (obj == Py_None) return 0;
+    return get_buffer(view, obj, ANY_LENGTH, 255, "ctx");
+}
+
+/** The buffers of each item of a sequence, or of one object standing in for all of them. */
+struct many {
+    Py_buffer *views;
+    Py_ssize_t count;   /**< Number of items */
+    Py_ssize_t held;    /**< Number of views exported */
+    int repeated;       /**< One view for every item */
+};
+
+/**
+ * Export the buffers of obj's items into m.  If count is not ANY_LENGTH,
+ * there must be that many.  If allow_one, obj may instead be a single
+ * buffer to use for every item.
+ */
+static int get_many (
+    struct many *m,
+    PyObject *obj,
+    Py_ssize_t count,
+    int allow_one,
+    Py_ssize_t exact,
+    const char *what
+) {
+    PyObject *seq;
+    Py_ssize_t i;
+
+    memset(m, 0, sizeof(*m));
+    if (allow_one && PyObject_CheckBuffer(obj)) {
+        m->views = PyMem_Calloc(1, sizeof(Py_buffer));
+        if (!m->views) { PyErr_NoMemory(); return -1; }
+        if (get_buffer(&m->views[0], obj, exact, ANY_LENGTH, what) < 0) return -1;
+        m->held = 1;
+        m->count = count;
+        m->repeated = 1;
+        return 0;
+    }
+
+    seq = PySequence_Fast(obj, "expected a sequence of buffers");
+    if (!seq) return -1;
+    m->count = PySequence_Fast_GET_SIZE(seq);
+    if (count != ANY_LENGTH && m->count != count) {
+        PyErr_Format(PyExc_ValueError, "expected %zd %s, not %zd", count, what, m->count);
+        Py_DECREF(seq);
+        return -1;
+    }
+    m->views = PyMem_Calloc(m->count ? m->count : 1, sizeof(Py_buffer));
+    if (!m->views) { Py_DECREF(seq); PyErr_NoMemory(); return -1; }
+    for (i=0; i<m->count; i++) {
+        if (get_buffer(&m->views[i], PySequence_Fast_GET_ITEM(seq, i), exact, ANY_LENGTH, what) < 0) {
+            Py_DECREF(seq);
+            return -1;
+        }
+        m->held++;
+    }
+    /* The views hold their own references to the items */
+    Py_DECREF(seq);
+    return 0;
+}
+
+static void release_many (struct many *m) {
+    Py_ssize_t i;
+    for (i=0; i<m->held; i++) release(&m->views[i]);
+    PyMem_Free(m->views);
+    memset(m, 0, sizeof(*m));
+}
+
+static const uint8_t *many_data (const struct many *m, Py_ssize_t i) {
+    return (const uint8_t *)m->views[m->repeated ? 0 : i].buf;
+}
+
+static size_t many_len (const struct many *m, Py_ssize_t i) {
+    return (size_t)m->views[m->repeated ? 0 : i].len;
+}
+
+/** A list of count new bytes objects of size bytes each, and pointers to their contents. */
+static PyObject *new_outputs (Py_ssize_t count, Py_ssize_t size, uint8_t ***outs) {
+    Py_ssize_t i;
+    PyObject *list = PyList_New(count);
+    if (!list) return NULL;
+    *outs = PyMem_Calloc(count ? count : 1, sizeof(uint8_t *));
+    if (!*outs) { Py_DECREF(list); return PyErr_NoMemory(); }
+    for (i=0; i<count; i++) {
+        PyObject *b = PyBytes_FromStringAndSize(NULL, size);
+        if (!b) {
+            PyMem_Free(*outs);
+            *outs = NULL;
+            Py_DECREF(list);
+            return NULL;
+        }
+        (*outs)[i] = (uint8_t *)PyBytes_AS_STRING(b);
+        PyList_SET_ITEM(list, i, b);
+    }
+    return list;
+}
+
+PyDoc_STRVAR(derive_public_key_doc,
+"derive_public_key(priv) -> bytes\n\n"
+"The Ed448 public key for the private key priv.");
+
+static PyObject *edgold_derive_public_key (PyObject *self, PyObject *arg) {
+    Py_buffer priv = {0};
+    PyObject *pub;
+    (void)self;
+
+    if (get_buffer(&priv, arg, GOLDILOCKS_EDDSA_448_PRIVATE_BYTES, ANY_LENGTH, "priv") < 0) return NULL;
+    pub = PyBytes_FromStringAndSize(NULL, GOLDILOCKS_EDDSA_448_PUBLIC_BYTES);
+    if (pub) {
+        Py_BEGIN_ALLOW_THREADS
+        goldilocks_ed448_derive_public_key((uint8_t *)PyBytes_AS_STRING(pub), priv.buf);
+        Py_END_ALLOW_THREADS
+    }
+    release(&priv);
+    return pub;
+}
+
+PyDoc_STRVAR(sign_doc,
+"sign(priv, pub, msg, ctx=None) -> bytes\n\n"
+"Sign msg with the Ed448 key pair priv, pub, under the context ctx.");
+
+static PyObject *edgold_sign (PyObject *self, PyObject *args, PyObject *kwds) {
+    static char *kwlist[] = {"priv", "pub", "msg", "ctx", NULL};
+    PyObject *priv_o, *pub_o, *msg_o, *ctx_o = Py_None, *sig = NULL;
+    Py_buffer priv = {0}, pub = {0}, msg = {0}, ctx = {0};
+    (void)self;
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwds, "OOO|O:sign", kwlist, &priv_o, &pub_o, &msg_o, &ctx_o))
+        return NULL;
+    if (get_buffer(&priv, priv_o, GOLDILOCKS_EDDSA_448_PRIVATE_BYTES, ANY_LENGTH, "priv") < 0
+        || get_buffer(&pub, pub_o, GOLDILOCKS_EDDSA_448_PUBLIC_BYTES, ANY_LENGTH, "pub") < 0
+        || get_buffer(&msg, msg_o, ANY_LENGTH, ANY_LENGTH, "msg") < 0
+        || get_context(&ctx, ctx_o) < 0
+        || !(sig = PyBytes_FromStringAndSize(NULL, GOLDILOCKS_EDDSA_448_SIGNATURE_BYTES))) {
+        goto done;
+    }
+
+    Py_BEGIN_ALLOW_THREADS
+    goldilocks_ed448_sign((uint8_t *)PyBytes_AS_STRING(sig), priv.buf, pub.buf,
+        msg.buf, (size_t)msg.len, 0, ctx.buf, (uint8_t)ctx.len);
+    Py_END_ALLOW_THREADS
+
+done:
+    release(&priv);
+    release(&pub);
+    release(&msg);
+    release(&ctx);
+    return sig;
+}
+
+PyDoc_STRVAR(verify_doc,
+"verify(sig, pub, msg, ctx=None) -> bool\n\n"
+"Whether sig is a valid Ed448 signature of msg by pub, under the context ctx.");
+
+static PyObject *edgold_verify (PyObject *self, PyObject *args, PyObject *kwds) {
+    static char *kwlist[] = {"sig", "pub", "msg", "ctx", NULL};
+    PyObject *sig_o, *pub_o, *msg_o, *ctx_o = Py_None, *ret = NULL;
+    Py_buffer sig = {0}, pub = {0}, msg = {0}, ctx = {0};
+    goldilocks_error_t ok;
+    (void)self;
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwds, "OOO|O:verify", kwlist, &sig_o, &pub_o, &msg_o, &ctx_o))
+        return NULL;
+    if (get_buffer(&sig, sig_o, GOLDILOCKS_EDDSA_448_SIGNATURE_BYTES, ANY_LENGTH, "sig") < 0
+        || get_buffer(&pub, pub_o, GOLDILOCKS_EDDSA_448_PUBLIC_BYTES, ANY_LENGTH, "pub") < 0
+        || get_buffer(&msg, msg_o, ANY_LENGTH, ANY_LENGTH, "msg") < 0
+        || get_context(&ctx, ctx_o) < 0) {
+        goto done;
+    }
+
+    Py_BEGIN_ALLOW_THREADS
+    ok = goldilocks_ed448_verify(sig.buf, pub.buf, msg.buf, (size_t)msg.len, 0, ctx.buf, (uint8_t)ctx.len);
+    Py_END_ALLOW_THREADS
+    ret = PyBool_FromLong(ok == GOLDILOCKS_SUCCESS);
+
+done:
+    release(&sig);
+    release(&pub);
+    release(&msg);
+    release(&ctx);
+    return ret;
+}
+
+PyDoc_STRVAR(sign_batch_doc,
+"sign_batch(priv, pub, msgs, ctx=None) -> list of bytes\n\n"
+"Sign each of the sequence msgs with the Ed448 key pair priv, pub, under\n"
+"the context ctx.");
+
+static PyObject *edgold_sign_batch (PyObject *self, PyObject *args, PyObject *kwds) {
+    static char *kwlist[] = {"priv", "pub", "msgs", "ctx", NULL};
+    PyObject *priv_o, *pub_o, *msgs_o, *ctx_o = Py_None, *sigs = NULL;
+    Py_buffer priv = {0}, pub = {0}, ctx = {0};
+    struct many msgs = {0};
+    uint8_t **outs = NULL;
+    Py_ssize_t i;
+    (void)self;
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwds, "OOO|O:sign_batch", kwlist, &priv_o, &pub_o, &msgs_o, &ctx_o))
+        return NULL;
+    if (get_buffer(&priv, priv_o, GOLDILOCKS_EDDSA_448_PRIVATE_BYTES, ANY_LENGTH, "priv") < 0
+        || get_buffer(&pub, pub_o, GOLDILOCKS_EDDSA_448_PUBLIC_BYTES, ANY_LENGTH, "pub") < 0
+        || get_many(&msgs, msgs_o, ANY_LENGTH, 0, ANY_LENGTH, "msgs") < 0
+        || get_context(&ctx, ctx_o) < 0
+        || !(sigs = new_outputs(msgs.count, GOLDILOCKS_EDDSA_448_SIGNATURE_BYTES, &outs))) {
+        goto done;
+    }
+
+    Py_BEGIN_ALLOW_THREADS
+    for (i=0; i<msgs.count; i++) {
+        goldilocks_ed448_sign(outs[i], priv.buf, pub.buf,
+            many_data(&msgs, i), many_len(&msgs, i), 0, ctx.buf, (uint8_t)ctx.len);
+    }
+    Py_END_ALLOW_THREADS
+
+done:
+    PyMem_Free(outs);
+    release(&priv);
+    release(&pub);
+    release_many(&msgs);
+    release(&ctx);
+    return sigs;
+}
+
+PyDoc_STRVAR(verify_batch_doc,
+"verify_batch(sigs, pubs, msgs, ctx=None) -> list of bool\n\n"
+"Whether each of the sequence sigs is a valid Ed448 signature of the\n"
+"matching item of msgs, by the matching item of pubs, under the context\n"
+"ctx.  pubs may also be one public key for all of them.");
+
+static PyObject *edgold_verify_batch (PyObject *self, PyObject *args, PyObject *kwds) {
+    static char *kwlist[] = {"sigs", "pubs", "msgs", "ctx", NULL};
+    PyObject *sigs_o, *pubs_o, *msgs_o, *ctx_o = Py_None, *ret = NULL;
+    struct many sigs = {0}, pubs = {0}, msgs = {0};
+    Py_buffer ctx = {0};
+    uint8_t *ok = NULL;
+    Py_ssize_t i;
+    (void)self;
+
+    if (!PyArg_ParseTupleAndKeywords(args, kwds, "OOO|O:verify_batch", kwlist, &sigs_o, &pubs_o, &msgs_o, &ctx_o))
+        return NULL;
+    if (get_many(&sigs, sigs_o, ANY_LENGTH, 0, GOLDILOCKS_EDDSA_448_SIGNATURE_BYTES, "sigs") < 0
+        || get_many(&pubs, pubs_o, sigs.count, 1, GOLDILOCKS_EDDSA_448_PUBLIC_BYTES, "pubs") < 0
+        || get_many(&msgs, msgs_o, sigs.count, 0, ANY_LENGTH, "msgs") < 0
+        || get_context(&ctx, ctx_o) < 0) {
+        goto done;
+    }
+    if (!(ok = PyMem_Malloc(sigs.count ? sigs.count : 1))) {
+        PyErr_NoMemory();
+        goto done;
+    }
+
+    Py_BEGIN_ALLOW_THREADS
+    for (i=0; i<sigs.count; i++) {
+        ok[i] = GOLDILOCKS_SUCCESS == goldilocks_ed448_verify(many_data(&sigs, i), many_data(&pubs, i),
+            many_data(&msgs, i), many_len(&msgs, i), 0, ctx.buf, (uint8_t)ctx.len);
+    }
+    Py_END_ALLOW_THREADS
+
+    if (!(ret = PyList_New(sigs.count))) goto done;
+    for (i=0; i<sigs.count; i++) {
+        PyList_SET_ITEM(ret, i, PyBool_FromLong(ok[i]));
+    }
+
+done:
+    PyMem_Free(ok);
+    release_many(&sigs);
+    release_many(&pubs);
+    release_many(&msgs);
+    release(&ctx);
+    return ret;
+}
+
+PyDoc_STRVAR(x448_derive_public_key_doc,
+"x448_derive_public_key(priv) -> bytes\n\n"
+"The X448 public key for the private key priv.");
+
+static PyObject *edgold_x448_derive_public_key (PyObject *self, PyObject *arg) {
+    Py_buffer priv = {0};
+    PyObject *pub;
+    (void)self;
+
+    if (get_buffer(&priv, arg, GOLDILOCKS_X448_PRIVATE_BYTES, ANY_LENGTH, "priv") < 0) return NULL;
+    pub = PyBytes_FromStringAndSize(NULL, GOLDILOCKS_X448_PUBLIC_BYTES);
+    if (pub) {
+        Py_BEGIN_ALLOW_THREADS
+        goldilocks_x448_derive_public_key((uint8_t *)PyBytes_AS_STRING(pub), priv.buf);
+        Py_END_ALLOW_THREADS
+    }
+    release(&priv);
+    return pub;
+}
+
+PyDoc_STRVAR(x448_doc,
+"x448(peer, priv) -> bytes\n\n"
+"The X448 shared secret of the private key priv and the public key peer.\n"
+"Raises ValueError if peer is in a small subgroup.");
+
+static PyObject *edgold_x448 (PyObject *self, PyObject *args) {
+    PyObject *peer_o, *priv_o, *shared = NULL;
+    Py_buffer peer = {0}, priv = {0};
+    goldilocks_error_t ok;
+    (void)self;
+
+    if (!PyArg_ParseTuple(args, "OO:x448", &peer_o, &priv_o)) return NULL;
+    if (get_buffer(&peer, peer_o, GOLDILOCKS_X448_PUBLIC_BYTES, ANY_LENGTH, "peer") < 0
+        || get_buffer(&priv, priv_o, GOLDILOCKS_X448_PRIVATE_BYTES, ANY_LENGTH, "priv") < 0
+        || !(shared = PyBytes_FromStringAndSize(NULL, GOLDILOCKS_X448_PUBLIC_BYTES))) {
+        goto done;
+    }
+
+    Py_BEGIN_ALLOW_THREADS
+    ok = goldilocks_x448((uint8_t *)PyBytes_AS_STRING(shared), peer.buf, priv.buf);
+    Py_END_ALLOW_THREADS
+    if (ok != GOLDILOCKS_SUCCESS) {
+        Py_CLEAR(shared);
+        PyErr_SetString(PyExc_ValueError, "peer is in a small subgroup");
+    }
+
+done:
+    release(&peer);
+    release(&priv);
+    return shared;
+}
+
+PyDoc_STRVAR(x448_batch_doc,
+"x448_batch(peers, priv) -> list\n\n"
+"The X448 shared secret of the private key priv with each of the sequence\n"
+"of public keys peers, or None for those in a small subgroup.");
+
+static PyObject *edgold_x448_batch (PyObject *self, PyObject *args) {
+    PyObject *peers_o, *priv_o, *shared = NULL;
+    struct many peers = {0};
+    Py_buffer priv = {0};
+    uint8_t **outs = NULL, *ok = NULL;
+    Py_ssize_t i;
+    (void)self;
+
+    if (!PyArg_ParseTuple(args, "OO:x448_batch", &peers_o, &priv_o)) return NULL;
+    if (get_many(&peers, peers_o, ANY_LENGTH, 0, GOLDILOCKS_X448_PUBLIC_BYTES, "peers") < 0
+        || get_buffer(&priv, priv_o, GOLDILOCKS_X448_PRIVATE_BYTES, ANY_LENGTH, "priv") < 0
+        || !(shared = new_outputs(peers.count, GOLDILOCKS_X448_PUBLIC_BYTES, &outs))) {
+        goto done;
+    }
+    if (!(ok = PyMem_Malloc(peers.count ? peers.count : 1))) {
+        Py_CLEAR(shared);
+        PyErr_NoMemory();
+        goto done;
+    }
+
+    Py_BEGIN_ALLOW_THREADS
+    for (i=0; i<peers.count; i++) {
+        ok[i] = GOLDILOCKS_SUCCESS == goldilocks_x448(outs[i], many_data(&peers, i), priv.buf);
+    }
+    Py_END_ALLOW_THREADS
+
+    for (i=0; i<peers.count; i++) {
+        if (!ok[i]) {
+            Py_INCREF(Py_None);
+            PyList_SetItem(shared, i, Py_None);
+        }
+    }
+
+done:
+    PyMem_Free(ok);
+    PyMem_Free(outs);
+    release_many(&peers);
+    release(&priv);
+    return shared;
+}
+
+static PyMethodDef edgold_methods[] = {
+    {"derive_public_key", edgold_derive_public_key, METH_O, derive_public_key_doc},
+    {"sign", (PyCFunction)(void (*)(void))edgold_sign, METH_VARARGS | METH_KEYWORDS, sign_doc},
+    {"verify", (PyCFunction)(void (*)(void))edgold_verify, METH_VARARGS | METH_KEYWORDS, verify_doc},
+    {"sign_batch", (PyCFunction)(void (*)(void))edgold_sign_batch, METH_VARARGS | METH_KEYWORDS, sign_batch_doc},
+    {"verify_batch", (PyCFunction)(void (*)(void))edgold_verify_batch, METH_VARARGS | METH_KEYWORDS, verify_batch_doc},
+    {"x448_derive_public_key", edgold_x448_derive_public_key, METH_O, x448_derive_public_key_doc},
+    {"x448", edgold_x448, METH_VARARGS, x448_doc},
+    {"x448_batch", edgold_x448_batch, METH_VARARGS, x448_batch_doc},
+    {NULL, NULL, 0, NULL}
+};
+
+static struct PyModuleDef edgold_module = {
+    PyModuleDef_HEAD_INIT,
+    "_edgold",
+    "Native Ed448 and X448 functions, which release the GIL.",
+    -1,
+    edgold_methods,
+    NULL, NULL, NULL, NULL
+};
+
+PyMODINIT_FUNC PyInit__edgold (void) {
+    PyObject *m = PyModule_Create(&edgold_module);
+    if (!m) return NULL;
+    if (PyModule_AddIntConstant(m, "PUBLIC_BYTES", GOLDILOCKS_EDDSA_448_PUBLIC_BYTES) < 0
+        || PyModule_AddIntConstant(m, "PRIVATE_BYTES", GOLDILOCKS_EDDSA_448_PRIVATE_BYTES) < 0
+        || PyModule_AddIntConstant(m, "SIGNATURE_BYTES", GOLDILOCKS_EDDSA_448_SIGNATURE_BYTES) < 0
+        || PyModule_AddIntConstant(m, "X448_BYTES", GOLDILOCKS_X448_PUBLIC_BYTES) < 0) {
+        Py_DECREF(m);
+        return NULL;
+    }
+    return m;
+}
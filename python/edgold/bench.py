@@ -0,0 +1,77 @@
+#!/usr/bin/env python
+# Copyright (c) 2018 the libgoldilocks contributors.
+# Released under the MIT License.  See LICENSE.txt for license information.
+"""
+Compare the _edgold extension with the ctypes path of edgold.ed448.
+
+Usage: python -m edgold.bench [--threads N] [--batch N]
+
+Run it from the build directory of setup.py (build/lib.*), where both the
+extension and libgoldilocks.so are.
+"""
+
+import argparse
+import os
+import threading
+import time
+
+from . import ed448
+
+def timed(name, fn, ops, min_time=0.5):
+	"""Print the time per operation of fn, which does ops operations per call."""
+	n, start = 0, time.perf_counter()
+	while True:
+		fn()
+		n += 1
+		elapsed = time.perf_counter() - start
+		if elapsed >= min_time:
+			break
+	print("%-36s %10.2f us" % (name, elapsed / (n * ops) * 1e6))
+
+def in_threads(fn, nthreads):
+	def run():
+		threads = [ threading.Thread(target=fn) for i in range(nthreads) ]
+		for t in threads:
+			t.start()
+		for t in threads:
+			t.join()
+	return run
+
+def main():
+	parser = argparse.ArgumentParser(description=__doc__.strip().split("\n")[0])
+	parser.add_argument("--threads", type=int, default=4)
+	parser.add_argument("--batch", type=int, default=64)
+	args = parser.parse_args()
+
+	if ed448._edgold is None:
+		raise SystemExit("the _edgold extension is not built")
+	native = ed448._edgold
+
+	key = ed448.generate()
+	msg = os.urandom(64)
+	msgs = [ os.urandom(64) for i in range(args.batch) ]
+	sig = key.sign(msg)
+	sigs = key.sign_batch(msgs)
+	priv, pub = key.export_key('raw'), key.public_key().export_key('raw')
+	x_priv = os.urandom(56)
+	peers = [ native.x448_derive_public_key(os.urandom(56)) for i in range(args.batch) ]
+
+	print("Per operation, %d-byte messages:" % len(msg))
+	timed("sign (ctypes)", lambda: key._sign_ctypes(msg), 1)
+	timed("sign (native)", lambda: native.sign(priv, pub, msg), 1)
+	timed("sign_batch x%d (native)" % args.batch, lambda: native.sign_batch(priv, pub, msgs), args.batch)
+	timed("verify (ctypes)", lambda: key._verify_ctypes(sig, msg), 1)
+	timed("verify (native)", lambda: native.verify(sig, pub, msg), 1)
+	timed("verify_batch x%d (native)" % args.batch, lambda: native.verify_batch(sigs, pub, msgs), args.batch)
+	timed("x448 (native)", lambda: native.x448(peers[0], x_priv), 1)
+	timed("x448_batch x%d (native)" % args.batch, lambda: native.x448_batch(peers, x_priv), args.batch)
+
+	# Throughput of threads which sign concurrently
+	ops = args.threads * args.batch
+	print("\n%d threads, %d signatures each (%d cores):" % (args.threads, args.batch, os.cpu_count() or 1))
+	timed("sign (ctypes)", in_threads(lambda: [ key._sign_ctypes(m) for m in msgs ], args.threads), ops)
+	timed("sign (native)", in_threads(lambda: [ native.sign(priv, pub, m) for m in msgs ], args.threads), ops)
+	timed("sign_batch (native)", in_threads(lambda: native.sign_batch(priv, pub, msgs), args.threads), ops)
+
+if __name__ == '__main__':
+	main()
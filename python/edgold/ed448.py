@@ -42,6 +42,7 @@ import array
 import os
 import os.path
 import sys
+import threading
 import unittest
 import warnings
 
@@ -58,6 +59,13 @@ except OSError as e: # pragma: no cover
 	warnings.warn('libgoldilocks.so not installed.')
 	raise ImportError(str(e))
 
+# The native extension takes buffers without copying them, and releases
+# the GIL.  Without it, everything goes through ctypes.
+try:
+	from . import _edgold
+except ImportError: # pragma: no cover
+	_edgold = None
+
 GOLDILOCKS_EDDSA_448_PUBLIC_BYTES = 57
 GOLDILOCKS_EDDSA_448_PRIVATE_BYTES = GOLDILOCKS_EDDSA_448_PUBLIC_BYTES
 GOLDILOCKS_EDDSA_448_SIGNATURE_BYTES = GOLDILOCKS_EDDSA_448_PUBLIC_BYTES + GOLDILOCKS_EDDSA_448_PRIVATE_BYTES
@@ -94,12 +102,7 @@ def _makeba(s):
 	return r
 
 def _makestr(a):
-	# XXX - because python3 sucks, and unittest doesn't offer
-	# ability to silence stupid warnings, hide the tostring
-	# DeprecationWarning.
-	with warnings.catch_warnings():
-		warnings.simplefilter('ignore')
-		return array.array('B', a).tostring()
+	return bytes(bytearray(a))
 
 
 def _ed448_privkey():
@@ -185,6 +188,21 @@ class EDDSA448(object):
 	def sign(self, msg, ctx=None):
 		'''Returns a signature over the message.  Requires that has_private returns True.'''
 
+		if _edgold is not None:
+			return _edgold.sign(self._priv, self._pub, msg, ctx)
+
+		return self._sign_ctypes(msg, ctx)
+
+	def sign_batch(self, msgs, ctx=None):
+		'''Returns a list of signatures, one over each of the
+		messages.  Requires that has_private returns True.'''
+
+		if _edgold is not None:
+			return _edgold.sign_batch(self._priv, self._pub, msgs, ctx)
+
+		return [ self._sign_ctypes(msg, ctx) for msg in msgs ]
+
+	def _sign_ctypes(self, msg, ctx=None):
 		sig = ed448_sig_t()
 		ctxargs = self._makectxargs(ctx)
 		goldilocks.goldilocks_ed448_sign(sig, self._priv, self._pub, _makeba(msg), len(msg), 0, *ctxargs)
@@ -194,6 +212,34 @@ class EDDSA448(object):
 	def verify(self, sig, msg, ctx=None):
 		'''Raises an error if sig is not valid for msg.'''
 
+		if _edgold is not None:
+			if not _edgold.verify(sig, self._pub, msg, ctx):
+				raise ValueError('signature is not valid')
+			return
+
+		self._verify_ctypes(sig, msg, ctx)
+
+	def verify_batch(self, sigs, msgs, ctx=None):
+		'''Returns a list of whether each of sigs is valid for the
+		matching message of msgs.'''
+
+		if _edgold is not None:
+			return _edgold.verify_batch(sigs, self._pub, msgs, ctx)
+
+		if len(sigs) != len(msgs):
+			raise ValueError('expected as many messages as signatures')
+
+		ret = []
+		for sig, msg in zip(sigs, msgs):
+			try:
+				self._verify_ctypes(sig, msg, ctx)
+				ret.append(True)
+			except ValueError:
+				ret.append(False)
+
+		return ret
+
+	def _verify_ctypes(self, sig, msg, ctx=None):
 		_sig = ed448_sig_t()
 		_sig[:] = array.array('B', sig)
 		ctxargs = self._makectxargs(ctx)
@@ -286,6 +332,73 @@ class TestEd448(unittest.TestCase):
 		# Make sure it fails w/ invalid/different context
 		self.assertRaises(ValueError, key.verify, sig, message, ctx + b'a')
 
+	def test_batch(self):
+		key = generate()
+
+		messages = [ b'', b'one', bytearray(b'two'), memoryview(b'three') ]
+		sigs = key.sign_batch(messages)
+		self.assertEqual(sigs, [ key.sign(m) for m in messages ])
+		self.assertEqual(key.verify_batch(sigs, messages), [ True ] * 4)
+
+		sigs[1] = sigs[2]
+		self.assertEqual(key.public_key().verify_batch(sigs, messages), [ True, False, True, True ])
+
+		self.assertRaises(ValueError, key.verify_batch, sigs, messages[1:])
+
+@unittest.skipIf(_edgold is None, 'the _edgold extension is not built')
+class TestNative(unittest.TestCase):
+	def test_matches_ctypes(self):
+		key = generate()
+
+		for message, ctx in ((b'', None), (b'message', b'ctx'), (b'x' * 1000, b'')):
+			sig = _edgold.sign(key._priv, key._pub, message, ctx)
+			self.assertEqual(sig, key._sign_ctypes(message, ctx))
+			self.assertTrue(_edgold.verify(sig, key._pub, message, ctx))
+			key._verify_ctypes(sig, message, ctx)
+
+		self.assertEqual(_edgold.derive_public_key(key._priv), _makestr(key._pub))
+
+	def test_arguments(self):
+		key = generate()
+		priv = key.export_key('raw')
+
+		self.assertRaises(ValueError, _edgold.sign, priv[1:], key._pub, b'')
+		self.assertRaises(ValueError, _edgold.sign, priv, key._pub, b'', b'c' * 256)
+		self.assertRaises(TypeError, _edgold.sign, priv, key._pub, u'text')
+		self.assertRaises(ValueError, _edgold.verify_batch, [ b'1' * 114 ] * 2, [ key._pub ], [ b'' ] * 2)
+		self.assertRaises(TypeError, _edgold.sign_batch, priv, key._pub, 5)
+		self.assertEqual(_edgold.sign_batch(priv, key._pub, []), [])
+
+	def test_x448(self):
+		a, b = os.urandom(56), os.urandom(56)
+		pub_a = _edgold.x448_derive_public_key(a)
+		pub_b = _edgold.x448_derive_public_key(b)
+
+		shared = _edgold.x448(pub_b, a)
+		self.assertEqual(shared, _edgold.x448(pub_a, b))
+
+		# The identity is in a small subgroup
+		identity = b'\0' * 56
+		self.assertRaises(ValueError, _edgold.x448, identity, a)
+		self.assertEqual(_edgold.x448_batch([ pub_b, identity, bytearray(pub_b) ], a), [ shared, None, shared ])
+
+	def test_threads(self):
+		key = generate()
+		messages = [ os.urandom(32) for i in range(8) ]
+		expected = [ key.sign(m) for m in messages ]
+		results = [ None ] * 4
+
+		def work(i):
+			results[i] = key.sign_batch(messages)
+
+		threads = [ threading.Thread(target=work, args=(i,)) for i in range(4) ]
+		for t in threads:
+			t.start()
+		for t in threads:
+			t.join()
+
+		self.assertEqual(results, [ expected ] * 4)
+
 class TestBasicLib(unittest.TestCase):
 	def test_basic(self):
 		priv = _ed448_privkey()
@@ -27,16 +27,30 @@
 #
 
 from distutils.command.build import build
-from distutils.core import setup
+from distutils.core import setup, Extension
 
 import os
 
 class my_build(build):
     def run(self):
-        build.run(self)
+        # The extension links against the library, so build it first.
         if not self.dry_run:
             os.spawnlp(os.P_WAIT, 'sh', 'sh', '-c', 'cd .. && gmake lib')
-            self.copy_file(os.path.join('..', 'build', 'lib', 'libgoldilocks.so'), os.path.join(self.build_lib, 'edgold'))
+        build.run(self)
+        if not self.dry_run:
+            # ctypes loads libgoldilocks.so; the extension, its soname.
+            for name in ('libgoldilocks.so', 'libgoldilocks.so.1'):
+                self.copy_file(os.path.join('..', 'build', 'lib', 'libgoldilocks.so.1'), os.path.join(self.build_lib, 'edgold', name))
+
+# Optional: ed448 falls back to ctypes without it.
+edgold_ext = Extension('edgold._edgold',
+    sources=[os.path.join('edgold', '_edgold.c')],
+    include_dirs=[os.path.join('..', 'src', 'public_include')],
+    library_dirs=[os.path.join('..', 'build', 'lib')],
+    libraries=['goldilocks'],
+    runtime_library_dirs=['$ORIGIN'],
+    optional=True,
+    )
 
 cmdclass = {}
 cmdclass['build'] = my_build
@@ -49,4 +63,5 @@ setup(name='edgold',
       #url='',
       cmdclass=cmdclass,
       packages=['edgold', ],
+      ext_modules=[edgold_ext, ],
      )
@@ -1,5 +1,6 @@
 /** @warning: this file was automatically generated. */
 #include "field.h"
+#include "tuning.h"
 
 #include <goldilocks.h>
 
@@ -10,8 +11,10 @@ const API_NS(point_p) API_NS(point_base) = {{
   {FIELD_LITERAL(0x0000000000000001,0x0000000000000000,0x0000000000000000,0x0000000000000000,0x0000000000000000,0x0000000000000000,0x0000000000000000,0x0000000000000000)},
   {FIELD_LITERAL(0x00e3c816dc198105,0x0062071833f4e093,0x004dde98e3421403,0x00a319b57519c985,0x00794be956382384,0x00e1ddc2b86da60f,0x0050e23d5682a9ff,0x006d3669e173c6a4)}
 }};
+
+#if GOLDILOCKS_COMBS_N == 5 && GOLDILOCKS_COMBS_T == 5 && GOLDILOCKS_COMBS_S == 18
 const gf API_NS(precomputed_base_as_fe)[240]
-VECTOR_ALIGNED __attribute__((visibility("hidden"))) = {
+CACHE_ALIGNED __attribute__((visibility("hidden"))) = {
   {FIELD_LITERAL(0x00cc3b062366f4cc,0x003d6e34e314aa3c,0x00d51c0a7521774d,0x0094e060eec6ab8b,0x00d21291b4d80082,0x00befed12b55ef1e,0x00c3dd2df5c94518,0x00e0a7b112b8d4e6)},
   {FIELD_LITERAL(0x0019eb5608d8723a,0x00d1bab52fb3aedb,0x00270a7311ebc90c,0x0037c12b91be7f13,0x005be16cd8b5c704,0x003e181acda888e1,0x00bc1f00fc3fc6d0,0x00d3839bfa319e20)},
   {FIELD_LITERAL(0x003caeb88611909f,0x00ea8b378c4df3d4,0x00b3295b95a5a19a,0x00a65f97514bdfb5,0x00b39efba743cab1,0x0016ba98b862fd2d,0x0001508812ee71d7,0x000a75740eea114a)},
@@ -253,8 +256,1224 @@ VECTOR_ALIGNED __attribute__((visibility("hidden"))) = {
   {FIELD_LITERAL(0x004a2902926f8d3f,0x00ad79b42637ab75,0x0088f60b90f2d4e8,0x0030f54ef0e398c4,0x00021dc9bf99681e,0x007ebf66fde74ee3,0x004ade654386e9a4,0x00e7485066be4c27)},
   {FIELD_LITERAL(0x00445f1263983be0,0x004cf371dda45e6a,0x00744a89d5a310e7,0x001f20ce4f904833,0x00e746edebe66e29,0x000912ab1f6c153d,0x00f61d77d9b2444c,0x0001499cd6647610)}
 };
+
+#elif GOLDILOCKS_COMBS_N == 10 && GOLDILOCKS_COMBS_T == 5 && GOLDILOCKS_COMBS_S == 9
+const gf API_NS(precomputed_base_as_fe)[480]
+CACHE_ALIGNED __attribute__((visibility("hidden"))) = {
+  {FIELD_LITERAL(0x0028a1f4d8095717,0x005805a041a5638a,0x00f0d89bdd29cf83,0x000c2e9c82bb9ada,0x00bb4929dd00c156,0x002f5a51e10de109,0x009fe72dbb2b6a9d,0x00314033c0eb0f38)},
+  {FIELD_LITERAL(0x0050eb68c26d8868,0x00bf1b9a104ac024,0x005e7af4624368d5,0x00aa7fc560201b7e,0x00dd921cd4bb9b06,0x0091be4ef0583171,0x00d330128147f487,0x00d224a918d5b478)},
+  {FIELD_LITERAL(0x003bf2344397ab6e,0x0083e3f886b82002,0x004023d553a79d22,0x0078d5d4ee38b5b1,0x0002a6719854f362,0x00e0c8f6a53072fd,0x0084cbe69d800737,0x0056d8d76eda8d13)},
+  {FIELD_LITERAL(0x00ebd33906a2216c,0x00164153d8795bd2,0x00415c4d767de927,0x00a30eadad002436,0x008541ca5d6867f8,0x00d0b3c6b145c174,0x0080213d1c92c9cf,0x00bb50a6bb6a7f4c)},
+  {FIELD_LITERAL(0x00b89e18748c905b,0x00019317b64f41a8,0x00c20ca65c53489e,0x00800ff474f480f8,0x0008369a5511da95,0x00a8764c4c88b1dc,0x00a3710c25b60e66,0x0015a056fd7519a6)},
+  {FIELD_LITERAL(0x005c90ff6d7125a5,0x0087abda47ad3383,0x009c9f372e67d659,0x00753f9202665c4a,0x00cacfc267198690,0x0064e06e188c4c84,0x0024a1fe7afa7780,0x0003c2cb97f14cdf)},
+  {FIELD_LITERAL(0x00f655f07f8aa3ad,0x004f72902822fdbd,0x00bfbbcaae0d443f,0x0082c5456c8188d2,0x00406c246afbcb24,0x000fec8763a3e107,0x00073201a8bb4cba,0x00077dc2c146fa2b)},
+  {FIELD_LITERAL(0x00ac08f6c38bf58b,0x00e78f2f2f368e4c,0x0039faa8f4859760,0x0026ad3a416508ad,0x00f99da6cd5b7ebd,0x00c7c899ab2acf3c,0x00ed91afe7f5c6d2,0x004ec2a5e0848cda)},
+  {FIELD_LITERAL(0x00c7b8d5b392f127,0x00d8eac9be5e7f45,0x00bb5cfe756f005a,0x006bf1b58f5d66a7,0x004e7bd03bb348e0,0x00bdbb553ac140f8,0x0034271e965f82f8,0x00849f94841108a6)},
+  {FIELD_LITERAL(0x00f659c21f10a2b4,0x0064a04b10c6bcde,0x0026aee925130340,0x007e01478671af4d,0x00e3c44d06892b8b,0x0030ebe7d1fa20b8,0x00ce8e2c2c972324,0x00bea3ef1badbc36)},
+  {FIELD_LITERAL(0x000372c25f831726,0x0060fd6094ab255a,0x00fc00a47da29656,0x00bb2c8a20eac04d,0x00e3161ec4261388,0x00c9dbf5ed035d01,0x0070a7f5cc36a55d,0x00ff3eab03579cf4)},
+  {FIELD_LITERAL(0x00c1f829250f34a7,0x009aa2c4980bcc71,0x000440102e979821,0x0086675f549c1daa,0x00e5f36742d15467,0x00505c3eae69c82b,0x005dd0636821be0d,0x008cd8f224c05b1f)},
+  {FIELD_LITERAL(0x00f6995b8b1f8abd,0x00bb99cbe0d07ade,0x00e4ae5bcc0e251b,0x007eff0f50db73a8,0x00ecca5253290a8c,0x005bc2358c0a85ec,0x004309c032f1d0cd,0x00f01c83960ecc48)},
+  {FIELD_LITERAL(0x004ed35303f1af9c,0x00331c6f9ce98fef,0x00e0c625558987e4,0x004c250355c6daa8,0x005df2104775076b,0x009f62e0db7c1218,0x00cbf0b40f49f6d8,0x009be0c3cd1fbea3)},
+  {FIELD_LITERAL(0x009219cddf74afee,0x0015e9c9b7aecc05,0x00e3c138ea8bdbae,0x00e0fc10faf3d5e9,0x007d1944c4e6e22c,0x00f737d3b2269846,0x0044f3c23e04278b,0x00436168a2a5b9eb)},
+  {FIELD_LITERAL(0x00ae46e2de4ab2ed,0x006ca5d873d74372,0x0085f9e140d5f700,0x00a367affc738017,0x0083aa39df3c2980,0x0011578a88969172,0x00d86a2abd78e7ab,0x00154a5e1d5c6c30)},
+  {FIELD_LITERAL(0x00cd74a57bc4c0cf,0x00aba0987a7f1c30,0x00fd8721601892cb,0x009ba93cbe8dfcb9,0x0071b4f8c36c8f4f,0x0063041cc9bfe455,0x00f6d24a9bcfbdf9,0x0020fe37607dddc5)},
+  {FIELD_LITERAL(0x00f49f413938d125,0x004d19d992bcca6c,0x00f1aa07c364ecb7,0x00b7078b58659502,0x007a634bb63e256f,0x007794067c5bc710,0x00fa81a5faebd2ff,0x00b2018a185e6dc9)},
+  {FIELD_LITERAL(0x00617b75bbb5bca2,0x005d04ec890d1627,0x00525d61957f22bb,0x00a381882b360b14,0x00d8373f032175fa,0x0051170e8f6d32a8,0x0087b7dc93ba6563,0x00687dc400ee4413)},
+  {FIELD_LITERAL(0x0019c44340fe958e,0x00f13b5e04970a36,0x0046031c02297ac8,0x0062e2403fbf8701,0x005a6cc79037c232,0x0075cd7b33c318f9,0x00f44c331179ef05,0x004b6881cd6574cb)},
+  {FIELD_LITERAL(0x00b089afc0dbaa43,0x000bdd210ce1a7a7,0x006db554e93c2152,0x008cbb5edfe9d0a5,0x00a4768616088fc0,0x004d701ffbc9d1bc,0x002105ed98faf1ed,0x0031f1d0e3cc8dba)},
+  {FIELD_LITERAL(0x00930266fabe6b7a,0x008b7bd61eb54ade,0x00fbaaa8c3af5749,0x00d37b026b215d00,0x009051d90cd25d1a,0x0027cdfc0a6f08a1,0x003f2dd7c5072ebd,0x0046b1d50f51eeff)},
+  {FIELD_LITERAL(0x007dc8b1bf1292d3,0x008adeca2d11422e,0x00c131f623240fdb,0x00beda03140f848c,0x002446c1d5aee481,0x0002262134254633,0x005099dae6c25f4f,0x0075c5c480be54dd)},
+  {FIELD_LITERAL(0x00358e1f7a8db85b,0x00e9a6938b3d670b,0x005cb74eb3b076a3,0x00ef2b494c2352a4,0x00834e6984ea2161,0x00fc4082d1a0d01b,0x00fe32db0197dea4,0x003e3b2cbfbe0d17)},
+  {FIELD_LITERAL(0x001880af938cf87a,0x005340cc01d711f4,0x009dad60ef984846,0x00d5e16db1825ebb,0x003062a6aa99dee3,0x00a2b125306d9037,0x0007a03fc864e6c1,0x00da44410c40c971)},
+  {FIELD_LITERAL(0x00252481a1dcac0d,0x00d67bdd805897d6,0x00a95f761697a2e5,0x003d6e5b7b223069,0x00ebadab09c430f2,0x007eb9434551b73c,0x00817c5de96228b2,0x00163d36072c0522)},
+  {FIELD_LITERAL(0x0018bda4d15ca725,0x0003657aaabaa524,0x00dcb80c625160b4,0x0036b620073826af,0x00d6fe984307ade7,0x006453117ebfd435,0x001654b63c063944,0x0041e8fb69fe31c6)},
+  {FIELD_LITERAL(0x00eb5c4898adc790,0x002c36cf4081d0e6,0x009a904429d00e0f,0x00d2b2e38b15a6bf,0x00ccb78a20b869ef,0x00ce4c00c9595c60,0x0049b7e9e81d0f57,0x00283f3904a40791)},
+  {FIELD_LITERAL(0x00f0e0f6b70d25cc,0x00d9307d86943957,0x006dde5a526ac36f,0x0056f830d78f7681,0x0076fd96bb3538fc,0x004fac83b10885be,0x000cbe5a6dd9ec03,0x004290bd85f25342)},
+  {FIELD_LITERAL(0x0016d32061b7be2b,0x0091d58065270fb8,0x003c6bf53c6e56da,0x002e91a0c31444a5,0x008f9361dd6663dd,0x002e007440ee9700,0x009d0c0b0cdf6e53,0x00343a25ec98df85)},
+  {FIELD_LITERAL(0x00b082ee9ff9b20a,0x007abf3ca21c1ad3,0x00feccf53b82e044,0x00709074c73afd35,0x003c8befe016e27d,0x00e8d2649e3a149c,0x00f3430d025c02f8,0x007426157dbacd85)},
+  {FIELD_LITERAL(0x00afc0f2c1ff6219,0x0003eeca389bf0ca,0x000a9dfccdd4a0b4,0x000461f5afd868e3,0x00c258fcc2884d1d,0x005ed963ef698d52,0x004cf09074d51afa,0x00aa4a484a58e23e)},
+  {FIELD_LITERAL(0x00b09c45c22f5644,0x00b8888911b0df0e,0x00853b11582d255f,0x00511f374437bb46,0x00fff4faf6c5d56c,0x0087ac979158a159,0x00360442fb895b2e,0x00573b50a5d4c108)},
+  {FIELD_LITERAL(0x00074b699d7c2b29,0x00e7d8c2b5d7321a,0x005f5a464c43e2a5,0x006336ee7803ce58,0x00b4c21e3fa1543d,0x00980bcca4198cbf,0x000e2caef21c4886,0x006aeecf50f3b802)},
+  {FIELD_LITERAL(0x001c025d6bbe82fb,0x0087c9e4046e7abc,0x0054c6e27509a4bb,0x0045cda06afcd96d,0x008f2c540d1d49cc,0x00ec652b1ae065e3,0x0025b5ab9f15cfc8,0x00dd5a1c3c133c18)},
+  {FIELD_LITERAL(0x0083023ae730dd62,0x00d9614fa2ce441b,0x00cae402ad2793f3,0x0040e8ab40ca21a8,0x00d1950d49f3f376,0x00c04fa4bb82f80e,0x00b510b0aa3ab8b8,0x0058993f2a84d2bd)},
+  {FIELD_LITERAL(0x00247ed0ddb59b31,0x00bfba823b9cc7e9,0x00b67d7444ded9bc,0x0085021a4b367923,0x007f6e4541960c40,0x00fcf2a600bafb4d,0x007958bce89debdd,0x00d17fb3c3f6d8c0)},
+  {FIELD_LITERAL(0x00e7290d90271af6,0x003285edf170c2e9,0x00fc99e518e01c0b,0x00bdd068a25cabe9,0x007ff1458f2b4ed7,0x005c7b79ce40288f,0x00426603c702905c,0x00555b7eebff6b2d)},
+  {FIELD_LITERAL(0x003ad122b10c4759,0x00d7322426e5a8be,0x00624a2e853a5c79,0x005e15b85da6f8e6,0x00d797126ef13022,0x007de069fc80058f,0x003994f9dde7e728,0x00417dbbdc4d3fcf)},
+  {FIELD_LITERAL(0x00f511bf40a13347,0x0059e1671fbf675d,0x00cd774de9d3e140,0x00d83e70fc0925c0,0x0095ce3a6cf483d7,0x007e89278382cf46,0x00932db06241a412,0x0044deaacda14a5e)},
+  {FIELD_LITERAL(0x00dbec0459b766b7,0x00af75be8084134e,0x0033d2d23de2afbb,0x00c9738eba2e1006,0x0049a90336826de6,0x00d623a417c1bf17,0x008ffb59d3456abc,0x0004b5ee5c0444d1)},
+  {FIELD_LITERAL(0x006e571741493d35,0x00cb402d0192da36,0x00320a56b0b46a33,0x006b0c4ca0053704,0x00c54080e6a29635,0x009d2b2f9de6b75e,0x00415e1bfb598111,0x00330743c417b529)},
+  {FIELD_LITERAL(0x0013352e42b66af9,0x00fec3d2e6be51fb,0x007f1cbb3039483a,0x00e6a5deda09b443,0x008bbdcdf744da42,0x001c7dca0553fb01,0x0000f5962e3f8fa7,0x0021d8e95888502c)},
+  {FIELD_LITERAL(0x00dbb444ab1d981d,0x0083f293c40c6cf8,0x00432a62eb782c8d,0x000a2dfada40c2a2,0x00e6e08303ca4aad,0x0050a43182a38a5a,0x0053ed8e386b83a2,0x0089f1c0e3e819bc)},
+  {FIELD_LITERAL(0x003557549b3f6a7f,0x00a20a274bd7bda8,0x00ebee63f5b7774e,0x00706776c11f96e9,0x004ee8cb358818b4,0x006866e091d0e727,0x001b8ca410484c03,0x0027a849a3613b08)},
+  {FIELD_LITERAL(0x008651d82ac42048,0x00a81131226fb102,0x00a758ca09d0ee6a,0x00730246336dc504,0x00e292727d15e217,0x00079f21210f46c2,0x004a21df6029b447,0x00f411b9c1bdd21e)},
+  {FIELD_LITERAL(0x00e59d734a58d18b,0x001b9c3de6a00342,0x000611691fea0191,0x008f009e04165121,0x0087523412a1c96f,0x009e61d353dd8092,0x00acb1f5fbc16f38,0x006d0444601b5d01)},
+  {FIELD_LITERAL(0x00aec2c891cfe4e2,0x00b43b2d2a7d48bb,0x0020521bb96c86c1,0x00d9e2d4618de599,0x00db754a65bbb84a,0x0029a083565cbf45,0x00cc40d4d35b28f4,0x005ee6eecb7721f1)},
+  {FIELD_LITERAL(0x00848659c609bbcf,0x0080c8d699cd9c50,0x006b36ff5cd26db5,0x00ffbc83c0200249,0x0057a6b1dbd94aab,0x0019d259b196b613,0x00fc2540fce5639e,0x00251def5a43aba3)},
+  {FIELD_LITERAL(0x005de87ed607edf7,0x00f7c3da730ff3d1,0x000cd9fc76c5935a,0x00566f8f84246609,0x00ae5fab48c5e804,0x00b42ad9179e6f38,0x00a0f7c6e09820aa,0x00488c02f6f482df)},
+  {FIELD_LITERAL(0x00500ae7db1e4858,0x00dd65057044d8da,0x00b7dcd415e3f0db,0x00d0a3a3861bead6,0x006d161379d6eddb,0x00ba3905fd634fbe,0x004dd414b30d9e27,0x00a9674b0d86182f)},
+  {FIELD_LITERAL(0x00e81995e8f55c11,0x0084ea4dc9319a41,0x00afc9da3c5192a4,0x00743b0e97bfef62,0x00ead33e09407b27,0x00a4b46619e3d111,0x00647c5444ae1271,0x003152b83a065d73)},
+  {FIELD_LITERAL(0x00cfdb271d7fb164,0x004405c180abce02,0x00792f7e3a0b3ce2,0x00e46d9378656a81,0x0050901cb6b22f33,0x0057d7fd74413cb0,0x0030f8dc22c08d0b,0x007738d24c7a28e8)},
+  {FIELD_LITERAL(0x00ee96664ab871a4,0x00aa1d055f997a7b,0x003c9d0f43075744,0x0049ee651b6cfeca,0x00386ee91c0dbc07,0x00726f77956383fd,0x0016b51eb94e676a,0x005619b796708fd9)},
+  {FIELD_LITERAL(0x003c2c694ddbe945,0x0086f13f2d5d245d,0x0024aa3f870eec72,0x00ac5fb9d64760a8,0x007a1e287adca697,0x002582d850b73d5b,0x004f7f9ca9669fe4,0x00baffaa86e6b5ce)},
+  {FIELD_LITERAL(0x00e8a7ec39c0d26a,0x00d6327cd359b38a,0x00f645975cde4f28,0x007033135e4c0c2a,0x00e8a07273d57c79,0x00ac92aee599d7d3,0x0064d99095f30e28,0x005df9cfe04c2263)},
+  {FIELD_LITERAL(0x00e05219a66770b4,0x008c8bb746b90ab7,0x00216573b5a0443b,0x00af0fc3aac6ef49,0x00804d31da145376,0x0090714cc6b8b668,0x006d178f375e3d46,0x009afc9cae4a9a6b)},
+  {FIELD_LITERAL(0x0082e678087f4e7f,0x00d718ed386d02ef,0x00a7988c0e461769,0x004c21769a12c51a,0x00792897eb24b635,0x00b201871e434e0a,0x0039cab8dd52be26,0x00470eadc72745ac)},
+  {FIELD_LITERAL(0x003c63ec2d461d47,0x00b80cc4e5fbd655,0x000a6a88c82c5909,0x00b71ae36ce48b0d,0x00263b10ffd7a9ff,0x0081d647737e5e06,0x00b0b2b6b2fa1954,0x002f3a4baffcdeaf)},
+  {FIELD_LITERAL(0x00639f3f2e9a0f7f,0x009e2503befb5a82,0x0004c76ddec30db9,0x00604039f3329600,0x00391718c224837b,0x00792f52c6dfd9d0,0x00e882d77ca4930e,0x00be838d508cf12e)},
+  {FIELD_LITERAL(0x00282cdce56356a0,0x00da26d61158f68c,0x00ec089dadce1f08,0x0068d0e531e4a426,0x00946ab174fd54c8,0x001c37d646174b01,0x00d4c0818c978bc1,0x0080200fe1913a72)},
+  {FIELD_LITERAL(0x00d54e1fe2401089,0x007c4b191e86a95a,0x008b2eae846824db,0x00068d09e68845eb,0x004b43c346319ca0,0x00fec0106b4e6dc1,0x0072611f6be359fe,0x00c06fc9b1ed126f)},
+  {FIELD_LITERAL(0x009585fa33d51d61,0x00714f7482b5fda1,0x00e6b4f45fa41a96,0x0076c5c96cb14d8e,0x006d30f2d91f3d58,0x00d94dd4caf5fd6f,0x00d4bae0bb7cd4d6,0x00010f8d91a8dc40)},
+  {FIELD_LITERAL(0x00c5a15a01eb8f10,0x009a6dea5a7e29c8,0x00c110868ffc704d,0x000d9d08ae3bada5,0x008a008071bee1d4,0x00e2c89c2daeeacf,0x007321861af93593,0x00f5bcda55c46e6b)},
+  {FIELD_LITERAL(0x00e640f13ce4de7b,0x00b96d4dfe5e92f7,0x00d8895eecb200b2,0x00c2648e3b4f8d05,0x00b32a2bc0b5405a,0x00edac312bff3ce7,0x007665b0e0fdf1a6,0x009d885f12f47b1a)},
+  {FIELD_LITERAL(0x004801913bfe15a4,0x00015d60c905ede2,0x00e8cbf684f69ecd,0x0096ebce936b7e9e,0x00ee1d40aa158681,0x006a6ea9acef7ad3,0x009703618c20cba3,0x006af4cfa2889628)},
+  {FIELD_LITERAL(0x00d0503c29f205f0,0x00ee912b048186e4,0x004c29efc9906559,0x004b2b0de5858a54,0x00111bff2bf1ac2a,0x00f911fa9fb51e92,0x009dbdb99ccd4e38,0x0017a1acf42496f3)},
+  {FIELD_LITERAL(0x00eee8997ce5c7ed,0x00c1aaf7591a822e,0x00ba1f355670beec,0x00e757f420b787e1,0x0005fae19545e24e,0x00b66a2eda8a7dc9,0x005da219ece73cf8,0x00808a476cdf9420)},
+  {FIELD_LITERAL(0x001249496cfaf4c6,0x008d4c10c6a79a49,0x00a3cf273ccc6bd4,0x00b0481807c067e7,0x00cd4fcd561d37d1,0x00a196f146a52425,0x00e51e8435ab0b7b,0x00c3cd4b6913ec54)},
+  {FIELD_LITERAL(0x0090b72725a53958,0x008c46124e0dd828,0x0071d711071c1108,0x007cf58505408e98,0x00c34e88a8c7b0e9,0x00c4963069388c05,0x00eb0b20d1d6a943,0x00dc24a3dd00478d)},
+  {FIELD_LITERAL(0x008aa822a634f50f,0x00243c862b94f029,0x004db806a71017f5,0x009fdab51a12f20d,0x00997fe671828565,0x004a3dbf399d3801,0x0005aa1738a189c3,0x0008dd6e86423215)},
+  {FIELD_LITERAL(0x005dbb1f507415dd,0x004c7e4b7ffcaee7,0x00f777a81fd32b63,0x00e06754c331f411,0x00b16a9e6a667eaa,0x007dc812cd150378,0x00430d81fee24f47,0x008c10694ef6d181)},
+  {FIELD_LITERAL(0x009cbb0eebf9ef5f,0x008322a3e256d66b,0x008d0ab8a7571ff5,0x00e419da37d82495,0x003cf8c70fd841d2,0x009d569d59e5e435,0x00810cfbb3bc99e0,0x00a549f043090f08)},
+  {FIELD_LITERAL(0x0026e522fb2b1195,0x009373310c57d5fe,0x00d1cbd5ea4601e5,0x0071d97accdacac7,0x0053773bcae98aad,0x00fd6c792e49d081,0x004663acf2935fb8,0x0072386d08c25112)},
+  {FIELD_LITERAL(0x00bf7ac0dfa644f4,0x00cc57e6509aef60,0x001b142266b445ad,0x003f84bc64be1c9e,0x00e9da98f9062858,0x00c8182ad123a6d5,0x0005a904d0721f4b,0x00001acbf58653a0)},
+  {FIELD_LITERAL(0x00eeafee22a722d1,0x0077577b130fa69f,0x001bc80acddd7281,0x00b915a116b624d1,0x00a9a6c63e82c862,0x00dc01dfb7acfd21,0x00c81526f4e0c09a,0x00247b5b3bd549d9)},
+  {FIELD_LITERAL(0x00baa0765b3ce981,0x0048c037f2633427,0x000f8f37d3b69c98,0x00756e3e306c3f40,0x009319ba527510b3,0x00d3093137c563ab,0x00924b51869b8a22,0x0040f923226763a3)},
+  {FIELD_LITERAL(0x00c59ff189ac0cc9,0x00cb313023857363,0x00e379722644c2c0,0x00c64bf18ac485ea,0x00a4b3f4b76de6d6,0x00773790af48a583,0x00e00abce0368406,0x00179f5d337ec059)},
+  {FIELD_LITERAL(0x00c424801d927887,0x00c2f1599f6c8d05,0x003a92ff660cb681,0x007e4ee893fb0972,0x0004a0b7f916e09f,0x00c9b2c14a9fd2f2,0x00497f2b344f86a7,0x008a2d83b56e4048)},
+  {FIELD_LITERAL(0x0090bd470e6bc889,0x005370b0cd7a1e2c,0x00b7b84e9bed4b19,0x003769840594da68,0x00b8372fdf6781ea,0x0000196360212316,0x0059730fde892fdc,0x00ab41dfa2bc5985)},
+  {FIELD_LITERAL(0x00bb5355dbdbb7ab,0x001e00fb0cc7a89e,0x0025ecdc1d1582a7,0x005003d67db98747,0x00b7f2371ff1b2bd,0x0065cf89f7ecd6e5,0x007fca8814aecbdc,0x00a2c336bad45915)},
+  {FIELD_LITERAL(0x00ebb8beb296b566,0x005399c2967ab0e5,0x00993c5fe186aded,0x007a7a4564e93199,0x00216e02ea2b8b8c,0x0006eab86bfa1c88,0x00eeb8832ccd6b5c,0x0005c448cdf37fef)},
+  {FIELD_LITERAL(0x00c7c24eba9fc58e,0x00ae73787548743b,0x0093d6d6e68d1582,0x00ca90f8dd6eefc5,0x0065c3f9b1ba41d0,0x0098be19d459e0dc,0x0084e3fe2282aceb,0x005a8afb2e21fbf8)},
+  {FIELD_LITERAL(0x00807ac4a24671dd,0x00778006c10117c7,0x00765cb2b07d73f5,0x00bf70d31996cda0,0x003a42fcafb3f2ee,0x0069a3fd4952de23,0x002f5f4ec7bd5fae,0x00d2a7bd02d56494)},
+  {FIELD_LITERAL(0x004ce3d1db04f375,0x008ab8d6a2bec505,0x005f24717170883a,0x00f9a856dbe49f27,0x0055514148f054d2,0x00ca55edce10dbba,0x007b200e1a55d33b,0x0009236c7f957213)},
+  {FIELD_LITERAL(0x008a2374b9ead623,0x0090dde41343b71e,0x003805542f00c7e0,0x007fb7e7811e8409,0x009600947c9e362a,0x00feac811a81d277,0x00bec240c52f51b6,0x0034e33bff921760)},
+  {FIELD_LITERAL(0x00149b4af750950b,0x0052e8e33c689d12,0x00d316074e6aadc9,0x008fb6e0b7349c42,0x00699b6a386fe096,0x0099fa4e2904cfd4,0x007ce995ef204b75,0x004cecf6423cf285)},
+  {FIELD_LITERAL(0x00000284c72108e5,0x004da8fcb672fd2e,0x00ad6059125fd1e7,0x0078c49fd37d64b4,0x00bf55097fad0c11,0x0091899625a7febc,0x0049b6f63a5c6393,0x0013a522162cf5e1)},
+  {FIELD_LITERAL(0x007c16a1a6c7d392,0x007459d2c2b63b94,0x0013b52d9526086a,0x0092e739204a2bad,0x00c46189e205a352,0x00cfdb928f26f2f7,0x006088fa3a3453a4,0x007ea0a9c8b01020)},
+  {FIELD_LITERAL(0x00f0e6da38dc8a9d,0x000b313c1ad2216b,0x0051415eeed2d01c,0x0001cf98053cb95f,0x0047d9249028b213,0x007cd5fee66b2385,0x004f691ad571cf48,0x007d2e2ddcf4cbc2)},
+  {FIELD_LITERAL(0x008652beb958e932,0x00d8dc098d5e920e,0x00c1a68f3cf7fded,0x00d863409db23638,0x00f85c81af2086cc,0x00463e281d494578,0x001a0df4d88512c1,0x007285a795e636c6)},
+  {FIELD_LITERAL(0x00f40b53562efad1,0x000f02c3269747d9,0x007dc6939af0355b,0x00c68b00ab42e61b,0x0065a629e5c5aa75,0x005f2b4f42181880,0x009deecf0e41932e,0x007f44c65dfb6617)},
+  {FIELD_LITERAL(0x00d70fe78604b2e5,0x00c81b3aa28e3502,0x006605698780c1f2,0x00294812a7f25a43,0x005492e38b989080,0x00a8b91794f7490f,0x0024a2c97a396976,0x002152b7adc355ab)},
+  {FIELD_LITERAL(0x00f154f3e97c348b,0x008eb4035ab063f2,0x003271bcd36ce6eb,0x009c7429120491aa,0x005690ea4e964496,0x0014f5bbf05dc1bb,0x00344ed8e1a86301,0x0031fdf1521d02cc)},
+  {FIELD_LITERAL(0x00e8e80df1886064,0x006573c762651c96,0x000ff4656a70cb44,0x0024cde0aeb0bf4d,0x00de5630223c491f,0x004c9a6d19102d12,0x0003be642d426398,0x007c61c4cfeff369)},
+  {FIELD_LITERAL(0x0083a7382df25731,0x00773c9615dbcb62,0x00101c84db398229,0x004d1f67f2e62229,0x00e378a1da68e943,0x00c3094d80c84b39,0x006bfa1a3c244331,0x00950cc2700f1b8d)},
+  {FIELD_LITERAL(0x008d70720a9ea1a2,0x0039efe45775c99d,0x0011627ce20c9e5a,0x00694fbd4cd00e66,0x009961f29d709cc4,0x0085cb8e6f086fa9,0x008589a9e5b63bea,0x00dff9ca36fd9b05)},
+  {FIELD_LITERAL(0x00b4dfa414dc76f0,0x00bc6018f902dbbb,0x0090c354fe66e99c,0x006848476c23bf55,0x00c21681b4bf35ba,0x002613c00e9705ab,0x00c6336aa3e67baa,0x00502c50355c75ba)},
+  {FIELD_LITERAL(0x00b7651c83213f07,0x004015484ad1087e,0x00fa6bd6e895ea93,0x0091a7e2d8c5c593,0x0041586975fe5f6d,0x00a82220d33434a3,0x00985057cd37d8fd,0x002fa616096603ce)},
+  {FIELD_LITERAL(0x00d01a2e9911038f,0x00fe6fd86f953171,0x00a1ba410e39111b,0x00a35a9654425ab7,0x00cefe251bbca513,0x00641f0994b86812,0x00b5aa34353f600c,0x00623f2f3b39b174)},
+  {FIELD_LITERAL(0x00982f67c457549f,0x007f48d3c9e506ec,0x00a4825be5d7ef15,0x003a8456690ae8fc,0x00b6259f64f2dc79,0x00ea3ebcd0f48315,0x000712cf99c49db2,0x00dee79d2d6b7f76)},
+  {FIELD_LITERAL(0x00c2749370303e6e,0x00c238b4dfd49c7c,0x0096866d3387c7ea,0x0036a14ff64e176a,0x0010f44bb7f80032,0x0053e842d82c19b8,0x0069a61d69a8d5f8,0x00f54a662a4feed7)},
+  {FIELD_LITERAL(0x0009e1da7dfd033b,0x00382d5ad51342c0,0x0057af7110ad51d6,0x00c5af254b3ddff4,0x001667867808e8dc,0x00cf0c79da7b22af,0x00081166f789e6b0,0x00def71bdaad4fee)},
+  {FIELD_LITERAL(0x00f883cd8f385730,0x003f0d28348c5455,0x00ad5488aadf3863,0x0053095a2643be24,0x00683ee67811e91b,0x001a0aefc9bc28a4,0x00c42066808d31ff,0x00632fe0eb41c8be)},
+  {FIELD_LITERAL(0x00b7f54d53ad8c98,0x003badc2d8ddc061,0x00e7a43620a2a50e,0x0095c25f15f31284,0x005cd9d1eef6043e,0x0034797e1aa3e30b,0x00bf9c5d20f5cc20,0x00efc0bd4eabb79a)},
+  {FIELD_LITERAL(0x00e24e6b763b1777,0x00f96746b2352e32,0x00558eb1b7939843,0x000ef0a02c7ca231,0x00188d9f84c3f213,0x00b08a7a4ea606f8,0x003373de18a8fb18,0x00c172d71b43796b)},
+  {FIELD_LITERAL(0x0093e475bbaf1fdc,0x007a045f75a9efea,0x00642524ffd2cb7b,0x001b236e67efa9d2,0x0077694fac51a6f4,0x00eef16bfc454e1f,0x00b3e261946ba220,0x0058690655158ba0)},
+  {FIELD_LITERAL(0x003f1d1d7e191725,0x001162fa1823ff3e,0x0099ad38c7a77f57,0x00dd3e0a804dc6b6,0x00d683e347d7fc6c,0x006bfa3a4ec8ca66,0x00e613b0caa1aa5d,0x0027d2b32b9bcc72)},
+  {FIELD_LITERAL(0x00fb3dcffd01d775,0x0046d08ed29044ca,0x00e8543ad43c5da8,0x00674c7a5f7a1fea,0x0023a3e410c9aa27,0x00260e5c4e1c6d1c,0x0054c162dd3106f4,0x0019e6994684ab0d)},
+  {FIELD_LITERAL(0x00502a8cdd8eca0f,0x00dcf86b9a9e1177,0x002bc27f2bed5781,0x009b29a6c8f31189,0x001b323f0f409c99,0x00df4806cc6da86b,0x003d2bfa3d690052,0x004532d9c93ad4f8)},
+  {FIELD_LITERAL(0x00c61cc719f7098c,0x00fb9eeac02ec28b,0x003cb523ba81c208,0x001b343b73198efb,0x00b20300da2fe3b2,0x002baecc01b66d51,0x0013bf80a192b4aa,0x0079051fb0576de4)},
+  {FIELD_LITERAL(0x00308d987e83bb74,0x0011ad21bb7bfc11,0x00f005e9dc7078a8,0x008eec25d7aa84af,0x00534e126ab778f4,0x0074dbb7232dd11d,0x00de47b38461f474,0x000d00108d18e62d)},
+  {FIELD_LITERAL(0x00517585d275df0c,0x00f274f0b33098e4,0x0094f66a20d39539,0x00ef244a68897744,0x00825f7501fd5a2b,0x00a2f4a094033e2f,0x008f5a7391578518,0x00c75d9ad9503d5f)},
+  {FIELD_LITERAL(0x00ded87289eade48,0x00a4e678a4c964c9,0x001af9b3141a68f5,0x004b84f7d87ff90f,0x004e7cfaba738c09,0x0072a8cfc891785d,0x00f328f9d87ea2c2,0x00287941e3723dfe)},
+  {FIELD_LITERAL(0x00055fd714c0607c,0x001ba25f3198457f,0x00d6bdbb40adcb6d,0x00b8c11ee11687a4,0x00a83a77c6ac022b,0x00e8bced41666d80,0x00a08ad21fa4074f,0x004fcda2f7cd8111)},
+  {FIELD_LITERAL(0x001928174658c99b,0x00ff7e0e94ef4178,0x00a138df2f500148,0x00901a12e0cf2cd1,0x00d5d2fe2c868718,0x003f1161b9f9658c,0x00fc4aec50970390,0x004bba1ac13f6462)},
+  {FIELD_LITERAL(0x009cfe4d425feada,0x002100f02cbb0a74,0x0079da7d1e26b5e2,0x00f91c7026146fde,0x00c63bf32ac909e9,0x00c6f8a9af071c33,0x00593e1bde1417be,0x00e2c58288447783)},
+  {FIELD_LITERAL(0x00f18b6782141436,0x006e3a5aa8dd01b3,0x00f6683b9c383cb6,0x0091265cc58d792d,0x00335069936a9f4a,0x00439d5835c699de,0x00fe159a90cedd54,0x00341d02026fe2cd)},
+  {FIELD_LITERAL(0x00c4d5d6068c1dd7,0x00bb77f919a42508,0x009d0a348c9a235c,0x0052cc2ef671a5ac,0x00a3b3e637b341ab,0x00d233f87be0630d,0x001ce0d8bccc0c9b,0x009336d782728b3f)},
+  {FIELD_LITERAL(0x0049325718668666,0x00932f94d41ec64d,0x006a332b4d811995,0x00201737eb6d4f1c,0x008cf18b6318339a,0x003eb860c75eea52,0x00ebc3aa6961f4dd,0x00a48456786f21eb)},
+  {FIELD_LITERAL(0x0095ff3ae0b6365f,0x004b3fdc91b5ff55,0x003646497ef79b7d,0x00ce057f995035f1,0x00f0b148d26af98c,0x00455c7487844491,0x00b024501a292dfa,0x009c077bafaba58b)},
+  {FIELD_LITERAL(0x0015a2219f536019,0x00a7488251e038c1,0x00bb7429f9ae9d32,0x007faaba53c9e9df,0x006abdbaaed21e74,0x00894a40c0fc44ef,0x00da891b1d06092d,0x001f3444ed8fb220)},
+  {FIELD_LITERAL(0x00b46ec081280495,0x00d1345b362856e3,0x00fc687a5cafc0fb,0x000497446d4e97b8,0x002ae4bfc91cc9cf,0x00a9ec1edb391c17,0x00e37fa64f2de9c7,0x00f8c1c60940f433)},
+  {FIELD_LITERAL(0x0000ee4ef2cd772f,0x0088953c994e606e,0x00b8469a6ba5a877,0x00c64c36444cc919,0x002e67e4654f8ef2,0x002fa0290b108ea1,0x00923226ca33fb5c,0x00c4896795395ec2)},
+  {FIELD_LITERAL(0x0078edb30ef4673b,0x00675828fa833979,0x00437f98d8d008de,0x006b2d4e536c3b12,0x0097be16514f1f23,0x00d49a8ac9919a10,0x0020b742c5337414,0x00d8ec6fe7302469)},
+  {FIELD_LITERAL(0x00ef4ba8071f205b,0x00bf22eb5bc3cd6a,0x00ec22d08eb82921,0x006b3ec79285ee82,0x006ad87d9de7fbb8,0x00499cf11623261f,0x004b901839944551,0x0088eff2bc9c208f)},
+  {FIELD_LITERAL(0x002ef0d27222fb3f,0x0074d5b0eaaf798d,0x007aa93db3cae6e1,0x00d0ef396174215e,0x00f2f93ec68ec183,0x006e3d3f87c33e88,0x003d299a90fd31bc,0x00ab187aab208f63)},
+  {FIELD_LITERAL(0x0073dd91823d50b1,0x00aaf9ab944e2cbc,0x002cd8d0f4da325f,0x00b1c0b7a7c374b6,0x005e6aaea590cf25,0x006b165ad09aca7e,0x00d228fcd9a4cf2f,0x0064e427f74769f4)},
+  {FIELD_LITERAL(0x00ae8fe11c2aff62,0x00d4963b8d3754be,0x00de033da1beb06b,0x006e913edaccf5f8,0x005e8c48fd150720,0x0073ce71346c0310,0x00ce9dcfb87661e9,0x004a0619910c070a)},
+  {FIELD_LITERAL(0x009699d3e2ff0c56,0x00033625080ac0ab,0x00c45e156651d09e,0x003fa7ca5683738b,0x00dfaedae48c6b32,0x002e67b406735c2a,0x00c0c1c3d67b9d5c,0x00f52f85b877db40)},
+  {FIELD_LITERAL(0x00a7022656638780,0x007e6ea242215a20,0x002eb53434e7265c,0x0047f81ea4790c34,0x00406e6f117740fc,0x0026d42d0101cf7c,0x00c24313cc4a3fb4,0x005956c1b9a65bfe)},
+  {FIELD_LITERAL(0x008c697af79b7294,0x00a1cd164e688b6a,0x00e6b55d7d061279,0x00761d83fb30fc37,0x0016501055e9ab8a,0x00790903dcd152a4,0x00f35b52d3e84b1a,0x007ceb9914070a71)},
+  {FIELD_LITERAL(0x00a7afe47b99282d,0x009aaa1670da74d1,0x00c1bdd50cf66d67,0x00254f3c6c28cd39,0x00e2e33f90dfc7e9,0x004ea2bb9072c60a,0x008c72aead4834cf,0x00ae2e6907283cc0)},
+  {FIELD_LITERAL(0x00d13207c9834555,0x00a30c44f2cb37ed,0x00e05e854698f479,0x00bad1a3e5748d73,0x002196ac832557ef,0x007b90d49a893d7d,0x005cf51f0d5d8ffb,0x006ad91d85771537)},
+  {FIELD_LITERAL(0x00d2d285cca3c8e8,0x00c1c1c1af05987b,0x00d3e0a2bd8a3775,0x00c7c575315433f6,0x0045fea5148d23ea,0x0031fa5a09443222,0x00cd48dd16b5bf96,0x003a297e4e79877d)},
+  {FIELD_LITERAL(0x0057d0a83ad51ae6,0x0042d63f7cf6c81a,0x0010c96c2bff5ae4,0x00efc84af6e53f58,0x00ea16f7e4bac8f3,0x007a381951e0b0cf,0x0068ff31fa254428,0x00f135d23d9e854f)},
+  {FIELD_LITERAL(0x003f7e9e29e06a14,0x00b3742227c899a3,0x00d331907313a287,0x00c50bd816f96ac7,0x0077f0c51d18010a,0x0064c9c6aec6c51a,0x00b500aa977e0138,0x000daa9c193a476a)},
+  {FIELD_LITERAL(0x00ff68af530ed04f,0x0023908bba1aa97b,0x00556135ec3c6d67,0x00894c878d25134a,0x00a2a20eabfa6993,0x00301e8672ee3316,0x002a8dac21d13df7,0x001b45bee83a5481)},
+  {FIELD_LITERAL(0x00b097a5de7f6335,0x00dd2c0e18dc29cf,0x009b3bcea634b699,0x00c36267c941d194,0x0062630009f7f469,0x00715ee300e26faf,0x0041e883a19a54a0,0x0011af65224d7364)},
+  {FIELD_LITERAL(0x00bd39cb5eaaad5c,0x00064e3d0bb4015a,0x00575c1a7d85a274,0x00a2532e6fc03117,0x004085a979fc9ec5,0x0009b844a386a32f,0x00014798ae68c079,0x00aa67ed14ed7585)},
+  {FIELD_LITERAL(0x00fd6a1a1d1f79ef,0x0031f3bbf766257f,0x005f12cb0b36ae5d,0x00cf273821b1f14c,0x00d303d3b919c1cc,0x00bf9153f8771e52,0x005dce6b4d63181b,0x00b6379c69ecccc0)},
+  {FIELD_LITERAL(0x0062a0ff296d9099,0x00fb1e6610420339,0x00889181c0358c90,0x002508db82f049ae,0x0027431b34e2f79f,0x00412a6389eff77c,0x007c828ed675cb10,0x00d83e63c270ed21)},
+  {FIELD_LITERAL(0x000be47f4a4073c5,0x00bd8a42104f492e,0x0097af7b908d578e,0x0037988b6a0f9ca9,0x00159c319a94dbdb,0x0000b1e140d23f72,0x00bf88932ca02728,0x00676873b7747527)},
+  {FIELD_LITERAL(0x007a2770a066980c,0x00b819e0ac581335,0x001bbbb5e6ff73ae,0x00b585368af46cb1,0x000bd3121ca35237,0x002cd1e90d9d3178,0x006f843d23417e5e,0x00db4ea14e2df34d)},
+  {FIELD_LITERAL(0x00cba3d31d939a35,0x005479f05628d32a,0x00faaace7d33a1bd,0x00a201f551d6bf1a,0x001c07919f0332e7,0x0060a40b98d077f4,0x00ff2b67e6fbe3ba,0x00d2c891191b21dc)},
+  {FIELD_LITERAL(0x004486e1ec84a53a,0x00a740ee122a8c47,0x00d9b97857b8a848,0x00adfa71fcbcccc8,0x0040e8fdeba453ad,0x0052776ce79c7eaf,0x005daa96ef86e126,0x007a08b121b299e8)},
+  {FIELD_LITERAL(0x00fe224e12604db3,0x002ba10d23c8aef6,0x0051e78258237a9f,0x000d40e52850c1e2,0x00db74093718b033,0x0022ba1fa8708ab2,0x00057c4b4d54ff6e,0x009bffba9a6ea560)},
+  {FIELD_LITERAL(0x0047d98c68c69e88,0x00bd5d53da47d73d,0x00944d51dbac4285,0x00f436ea951635f0,0x0056a5f9c67aa0fa,0x00aad99fc3562119,0x005b460618a94be7,0x002af19a37c7a1d8)},
+  {FIELD_LITERAL(0x00b694576a608547,0x00f0f9764497108d,0x00cab08188139ecd,0x0066fa6b6afcf24e,0x003714ec0beca76f,0x00c54f0a45dafc0b,0x0064d9d042f897c9,0x0008f8fc98abc066)},
+  {FIELD_LITERAL(0x00ec7c4aca7d0e9e,0x00f3c7a7f36789e5,0x00ca7cccc20c8149,0x00239e5d7238ab8f,0x00cf91e17ed1cd01,0x00118673e72018fe,0x000e4bbbbcd0fded,0x002cd2ca1ed000d8)},
+  {FIELD_LITERAL(0x004e175b4e08a761,0x00b13449f03385e3,0x0039e6b7b7f22824,0x00f1e0f762da1406,0x003259dad44629b2,0x005b0cc74e6e71d1,0x00d07daf7f5c1919,0x00c654033d4dd23e)},
+  {FIELD_LITERAL(0x002caed53c172d87,0x00d31f297bacb250,0x006cb0139870fd06,0x00863772a1aae17b,0x005b3d0ba5b554cc,0x00f0151bb4cce28c,0x00bb3b33cf01c7b9,0x00bbe5eeeba38daa)},
+  {FIELD_LITERAL(0x009b7fda13fa5e34,0x00e5b7f8b1493326,0x004a3a80b3d00c56,0x003c397811c316b1,0x007af61758e475ed,0x00fe4a4106472f60,0x00f5777bbff3d2d4,0x00bceffa4897b467)},
+  {FIELD_LITERAL(0x00bbd95dd183ebdf,0x00c9bed3bb11afc8,0x00aa06f78bd4d52c,0x00def6d8d64047c1,0x0033f3b8d43e77c9,0x0099392d2c680fee,0x00ac082a796e32c9,0x005025355d10ecaa)},
+  {FIELD_LITERAL(0x004aacd6a492b977,0x0016aec5263da67b,0x00372d1600eede32,0x007a755869cccdaa,0x00bab17f25245ab3,0x007678a4ad448785,0x00329c6cc05bfeaf,0x009842204669fc77)},
+  {FIELD_LITERAL(0x005d064bfdc7b90d,0x00f3a761cf94a1a7,0x0059258a9c520a8d,0x00e269ff9aae37c5,0x0058a02f6ddbe468,0x003c019010c0cdea,0x00aba3aaa8ee3b97,0x00c8c42f21969b72)},
+  {FIELD_LITERAL(0x00b9ba11728e10f7,0x00304c2f2765d78b,0x001672fb594cf226,0x005f4ef70656fbf4,0x00067ea2e4ff2c26,0x00455de5dedf7473,0x00504e19a2354d89,0x0098a726744d97f7)},
+  {FIELD_LITERAL(0x00e3cbf3ea5ca7c5,0x0074b677ba392d23,0x004456651e464d93,0x000b3ebd18cafb65,0x001119cd62cc5ae5,0x00b0a2693aebca7e,0x000b30901588a709,0x00f8b7ba06d93cdb)},
+  {FIELD_LITERAL(0x007179640d8bccb2,0x00d5fe9cc706bbe4,0x00f7c48b5a7a7463,0x00e024e62513ddc6,0x004bacbfce3a8119,0x00bf709cb03ba812,0x006bbbed002e2c8e,0x0060d59ec421d1f6)},
+  {FIELD_LITERAL(0x001240adabd52fff,0x008682e947287192,0x000b747c35557854,0x007671d26b0b318e,0x00bf872ed086596c,0x0002dcfd036375de,0x00fde154265e116c,0x00bd8e232b69c2f3)},
+  {FIELD_LITERAL(0x00c8d0503d7180bb,0x00ab0b1e62ab9e1c,0x0033d84daf6b52f9,0x00c15e8f8c42c946,0x00f864dcddaec48e,0x0061fb5db1d5b1d1,0x00c1211f81bcd2fe,0x0067dc272837996b)},
+  {FIELD_LITERAL(0x00930fd52dc89259,0x00e150ca57feaed0,0x007e863bcb667c14,0x000b75c25397594d,0x00a4a58c40de01f4,0x00057b140bdbe9f3,0x00c88ed650dab319,0x002e51db0610b08f)},
+  {FIELD_LITERAL(0x00e17e8ce634e53c,0x0015ad6d2fac2bc5,0x00e4fbe07b84a9ab,0x00f3548954bf4933,0x008b9b1578d851b1,0x00aa6ae12c65c03b,0x0004d5e5f9a1ad88,0x003482e89197a056)},
+  {FIELD_LITERAL(0x0025d965dea545cc,0x00941ee2b43469ff,0x00b5678c1e7f171f,0x00380a41112ad8b0,0x002ea06e12612f90,0x00163828caae04a0,0x000a45eff511349f,0x00e42a308242ae8b)},
+  {FIELD_LITERAL(0x0031f2901788813a,0x0015932adf361c03,0x00ab8b8ef4adf02f,0x00c44917e636a9bc,0x0063731af18564fe,0x00f33a7a5b88e566,0x00f787bc072bcf8c,0x00184e898ed15355)},
+  {FIELD_LITERAL(0x0031e7e7539fb677,0x0088cec72533ed59,0x006bece15927cbd3,0x00a88cba29bfd533,0x0043004c15d1161a,0x000bce22ea584b27,0x00da6e516d5a9bd1,0x00a4cbf0330ba39c)},
+  {FIELD_LITERAL(0x0088f6ff70c8f371,0x0092d81169b9c54b,0x00a24ea812682534,0x00d2f7d98e2c96e6,0x0084924a7d69cc1e,0x003940cffd8333c1,0x0009f02cd72ababb,0x003d71c215abae31)},
+  {FIELD_LITERAL(0x0068d02e61ba48bc,0x00212663f1689bac,0x00c71f14118ba1ef,0x00f44805a15bb978,0x000437af1ffad7b4,0x00641b53652f3171,0x001e44502b6a0e1e,0x00e45ed1852d2aee)},
+  {FIELD_LITERAL(0x008fb85f0938fd64,0x0019b18b8c388df1,0x0053d47ccc8cce3d,0x00c7958971d2cf14,0x0080e7b77e502c12,0x005472615f908ec8,0x004f4cf1b27799f9,0x00df2eb3eb093db3)},
+  {FIELD_LITERAL(0x00bb8ab75101c34f,0x00d38a31caa965ae,0x00da671f63898e33,0x00aba356c7c9f71d,0x004c1c51b4a232c3,0x009b4619f757ec88,0x00df671c77c80455,0x00b08027973eeea4)},
+  {FIELD_LITERAL(0x0007c539151f3817,0x00ddd44eadfa2c0b,0x009f76a200ae7d2e,0x00ca1953b05924fd,0x009cd753ffa716b9,0x00bc49bd5e7dc824,0x008307bdd20d256c,0x0036e66546753460)},
+  {FIELD_LITERAL(0x00fde3a841176245,0x0052d5cf807f6ebe,0x00f6508713101e2a,0x002ab324238404c7,0x00ddcd1a4557c869,0x00985658fe80f076,0x00e57e50f28852e2,0x007e3b9e9f864343)},
+  {FIELD_LITERAL(0x0036853fb9d2e716,0x00cf2a677eefafe2,0x00cc691a1610763c,0x00c0ceb62d2edca5,0x007b5b62fd07159d,0x00348ff46dc3a249,0x00c38b15868c1ab6,0x0091221c1636f6a7)},
+  {FIELD_LITERAL(0x0052d67b92a77528,0x0040ffbbaf95d1e7,0x007367b859940fcf,0x00ba9c3edc9180c2,0x001cf0560cc14ccb,0x00e03b7ff2942f33,0x001a766c2be5f75d,0x002fc05027908fd4)},
+  {FIELD_LITERAL(0x0081074a9a3d70a8,0x0017f79ccb835d3e,0x006186aa9e381ecf,0x00a226b476c93264,0x00aafc132fda883a,0x0058e945379e0a75,0x000525401fe2c249,0x002287fa615a8112)},
+  {FIELD_LITERAL(0x0080a27b5f9959e7,0x003510b108250aee,0x00af2c3f1a052ba9,0x003fa4a718c423dc,0x00bdb902d0a9a950,0x0057ca5db8c825e6,0x00e9a20226396968,0x00ae185247728d43)},
+  {FIELD_LITERAL(0x00c2959a3ce53e39,0x00b4b9fa6f02cb38,0x00b3f05cb7e6a997,0x005b865ed28c1141,0x0056fdb03d2dec0e,0x00e633c29311ff7f,0x00c46dac907ff56e,0x00d1f5236b09a40e)},
+  {FIELD_LITERAL(0x0014dc2a771b63cf,0x009652694fd2d713,0x007a1f1b983299ed,0x00d36c0964f7c35c,0x0087244542b1712e,0x00be4995a1ff08ef,0x002f75f1cc6bca31,0x00a23deb67546c4e)},
+  {FIELD_LITERAL(0x00a6fdf4a99e80f0,0x009f6cc3d1c11ff8,0x0000d86e279cdb06,0x003dd154efdd042f,0x00a803f1467b1ada,0x00bbcdc4973f60f8,0x00d13e529ee93024,0x00222ef766acc1dd)},
+  {FIELD_LITERAL(0x007be394334846e9,0x00cb672f1b815df1,0x00826ada59de3797,0x00c91e390d86bf5c,0x004471865fc4a6a0,0x00d1d992910c7b60,0x009cfdd5d5063150,0x00e8c024d0db2611)},
+  {FIELD_LITERAL(0x007ca2d3e0616d1e,0x00326bd57b87aaa7,0x009afa01927048b8,0x003af75f5513d7c0,0x00e39a0f621a323a,0x008360caddde414c,0x0010713ac2eea881,0x00227b9a75d33055)},
+  {FIELD_LITERAL(0x00d28317629751a4,0x00ce2a5c98baf4ce,0x00377f883cb6d54a,0x00e486f65ca393a3,0x00fba6ade2a971dc,0x00823910a2ea5eff,0x00c6623dd7964e17,0x00568dea29f959e9)},
+  {FIELD_LITERAL(0x0065b8fab2ab334a,0x00b6733dc547003b,0x006a29961634d943,0x008e2ef9dfadbd3a,0x00096fe1df7f6f0e,0x005c2420389c8cc0,0x00bd64b83cda723e,0x000cc963f9b9abd6)},
+  {FIELD_LITERAL(0x00e5b4707493db91,0x0008b77abf83ed90,0x005f13153653c83e,0x004ad1887171e760,0x00afc089266f4a14,0x00fb94708662fb4a,0x00e8947a7455e9ba,0x0096ad5c6175b50d)},
+  {FIELD_LITERAL(0x00382a3094ff653b,0x00e914450f8f681c,0x007e259ba63628ca,0x001ad84cd07be3ea,0x003346687943f24d,0x001a108e64ac55ae,0x001513aec88c6224,0x003791a5b11501c6)},
+  {FIELD_LITERAL(0x00bd682e99ddfe11,0x00a7c0a0d0836c72,0x00acb42664cc67c2,0x00125afdd5091e8d,0x000a8235ff206781,0x00005cf9b322a229,0x0094aa677a21788a,0x0060f2cbfd005082)},
+  {FIELD_LITERAL(0x00848ca0aee68690,0x007d4824ab739c75,0x000e58d4eacf6274,0x00ae729f44f3c960,0x003f46c5d4c24ce5,0x000967fa6e9473e9,0x0053234c6c9d381f,0x003dfcc33c1ef9bd)},
+  {FIELD_LITERAL(0x00aa4e7b952cebaa,0x00fd278a8ab13714,0x00481fa7873dde98,0x00b767958746ab99,0x0025b0e00831e23e,0x00ef2ca3e0753ea3,0x0028b41c2ef98667,0x00575a77344f8da4)},
+  {FIELD_LITERAL(0x00b749b6642895b0,0x00a79f3e196f2ef1,0x001e1c3830b3342b,0x002dd7eafaa53af2,0x00b938f74c87d664,0x008d25ca8f79c26d,0x00e8ff52fe254eaf,0x00323054f934b519)},
+  {FIELD_LITERAL(0x00919e81698f2648,0x0054bb6774f748b4,0x0094b0e0cbaa44c7,0x0023093914bbf80c,0x00d5aca2a011b65e,0x000c8f028063a608,0x00003b12f58a7e5b,0x001ec2a1bcc76d28)},
+  {FIELD_LITERAL(0x00849d2d76548c7f,0x0049681e1cc4b604,0x0008bd4de28d0188,0x0076321d4a3612e1,0x0069257b4eb9b443,0x003e6618ff6b29fe,0x00dbb1bc1282f4ba,0x00444e7bd89f5f91)},
+  {FIELD_LITERAL(0x003de8eeb396d3d1,0x0044ddbaed9e66f6,0x007fe30801437102,0x008e01be45ca38fb,0x009b683bf3461fd0,0x0058878088af7e8d,0x0016f4546f6171a9,0x0060c125c631cd7a)},
+  {FIELD_LITERAL(0x00e1d4bde4cada58,0x00b664909f570a56,0x00a789afaca6be7c,0x001dacbd20068717,0x004a41f6790f0477,0x00393931897a09af,0x00f7d0cc5220fd94,0x008b3f97c06176a4)},
+  {FIELD_LITERAL(0x00658bc684263678,0x001a91b5876d19e7,0x00da35beb002c337,0x0014c4dd492ebd82,0x0010932766579728,0x0001e136346d696b,0x009df0f06fc55734,0x002964b499fcc9a9)},
+  {FIELD_LITERAL(0x00fa87996413d9fc,0x009d4a10a90c97e6,0x004af8d89070985f,0x0048f0962efba40f,0x002ce60d04b77900,0x00fefceb836f4d79,0x00105ae4150d2f06,0x00d15f602bc904a0)},
+  {FIELD_LITERAL(0x0021e30e878afc63,0x000aaf2ce9134b5c,0x0085ec7ef312224d,0x00849e692b60a9cc,0x000c955424b86b11,0x00986d3fe9d169c5,0x0088e4ea535bae29,0x0011e241d776010a)},
+  {FIELD_LITERAL(0x00a42289b662dbaf,0x00faf4a9a8d5c7fb,0x0047e7a1f1e43f85,0x001b5ee34c331ff7,0x006bc99748c96a95,0x0022b75e251cc801,0x001a977464488e13,0x0091011cbc9f62a6)},
+  {FIELD_LITERAL(0x00e3938f4353b12f,0x004b4cf8e9e23582,0x00a6f3a3e30fe2b5,0x00ee51830be758f9,0x006281799aaf2a70,0x0068c2570ff40e84,0x006ee1a3c3186efb,0x000aaedc1e078728)},
+  {FIELD_LITERAL(0x0073f787a267bfde,0x00ec899e92df2fdf,0x00b5e0b6ab48b840,0x000cce3f803a9172,0x0078fc5569a99b33,0x004d45bfad413da1,0x00724eca37f6a4c6,0x001cccc7d654bfa6)},
+  {FIELD_LITERAL(0x008db4ab800f651b,0x00fcbc54082d7e75,0x006275e588d904e9,0x002ccf2c259ea1fb,0x00bd1745183a02e6,0x0054c717b9185456,0x0012449cef611f59,0x0005ac141b0e5637)},
+  {FIELD_LITERAL(0x000a746b03dfa6b4,0x008561a64347cb22,0x0078841fdcb7b6f9,0x004b0a55b103da0c,0x00741a6ad49d202f,0x0065289a9a221814,0x006c792d365bd319,0x0045157fdcb1e6b6)},
+  {FIELD_LITERAL(0x008b1e385c0ddfab,0x00919bf047fbc891,0x00883284619c601a,0x00424778b2a9c0f8,0x008a13f8a59430fb,0x0020c38dcf750632,0x001b8121a4a2e1f6,0x007727c702e00f7a)},
+  {FIELD_LITERAL(0x00d8cf96a2dadc01,0x003cec0c4663c171,0x0064e837bf39b6c2,0x00201bd3b54a78b4,0x00fe16dab2631775,0x00439efbc481a1f4,0x00a485a26a1fe3f9,0x002951a504a220fc)},
+  {FIELD_LITERAL(0x0044eebbadbc4e6a,0x0020de595ff073e2,0x009f5ff329fe09a9,0x0076d03c08d44605,0x0055bb706793c203,0x00da3d32cfb11aa2,0x00d44f7114473c3c,0x00c558387318ea80)},
+  {FIELD_LITERAL(0x001603cf92f970e6,0x00554b4214d165e8,0x00caaf5bce6f42ce,0x00155e3904d9aea7,0x009ed54b04e737a8,0x0083b2cc3cc099ed,0x003239686f013204,0x00ac3787b8137680)},
+  {FIELD_LITERAL(0x0075ed4bed80ffe0,0x0053c6a7399c6c80,0x00d94e2e4c2e2d8d,0x002bba8a4aa6267b,0x00738e0ad7b6c476,0x00dc633f3eb05b66,0x007739783d2f5fd2,0x0045ef38d1423fef)},
+  {FIELD_LITERAL(0x0041bcfa382ab8f1,0x0080115aeb090643,0x00c5a1b5bab8d7ee,0x004b32f3f681a8a4,0x00db1514230b9196,0x00ad7459154c44a1,0x0057626d6a53c453,0x007c617378263e2c)},
+  {FIELD_LITERAL(0x0037fc1f920622d1,0x002008159168e759,0x0091c05d5da1ae77,0x0057baf05e608a68,0x00efaa69a9d4de63,0x00a493058dd07f9d,0x00f19fd589560687,0x00d5d4083d83be8a)},
+  {FIELD_LITERAL(0x0040033deaee6736,0x0029b20e9e514a74,0x00fc4352521e490f,0x0001c109d2088ab7,0x007853b6f557b5a8,0x0098aa46ba8743c9,0x003296de1b2fd75c,0x003c983eae1ba738)},
+  {FIELD_LITERAL(0x00b93df93b25c6f1,0x005c319930f73f49,0x004e10c19462e359,0x001759b890a46942,0x0048e11557402443,0x0054c7462d7982a9,0x00bcc27df7d2a53f,0x00a28e654155e740)},
+  {FIELD_LITERAL(0x002dd812f3e27f9a,0x004420df5a2dbbbc,0x00057c351eb6bba2,0x00c5089a921a128f,0x00e8dc5f17317147,0x0032380494076817,0x0030a08c83d05996,0x00641365186184c8)},
+  {FIELD_LITERAL(0x000332ad86a21831,0x00f63ca87888fa04,0x00316f42faafe1c0,0x005c141482f88c18,0x0010ca2f16c41eec,0x0048872c87bf5163,0x008f9a5c49de5583,0x003e015f540708f3)},
+  {FIELD_LITERAL(0x00f5f7b53bc04454,0x004431224c5758ac,0x007349af2ceaeec0,0x001fc1c0ea1f1d3f,0x00af21096ed89d01,0x00701ad7a2f1b925,0x00f17dd8b8cbd185,0x00f7a23143c54bda)},
+  {FIELD_LITERAL(0x00feae961649e7ab,0x00226db0b1d2786b,0x00c33886f606f6e0,0x002e9693fcdab62e,0x00d6f73a18f9f832,0x00751ac45de07466,0x004eab7f3234f125,0x00bb4238753e5be2)},
+  {FIELD_LITERAL(0x0025426b6c9161e8,0x00f171eff5bb01c1,0x0055e7861d0294f8,0x00c362e941f76e74,0x00f606a974068d0c,0x00e818cc0ec993ab,0x00b9c5adb787114f,0x00e5405c02ccd500)},
+  {FIELD_LITERAL(0x0011db33e12827fb,0x005c2ca64a1cfa26,0x004f8225ca42c06d,0x0075f52698d4921e,0x00648285e1c59010,0x00d417266799f91d,0x0063a893715bf6f3,0x00108903b2c368fd)},
+  {FIELD_LITERAL(0x00ddc43336fd84da,0x00959b3c0c0a7031,0x005fcf448bb49c17,0x00f8a79317bbf451,0x0058287926e30af0,0x00b26fae02b77870,0x003d326ae7fa9ce2,0x007c735175638e8a)},
+  {FIELD_LITERAL(0x00c21b099f0cf5d5,0x003e9d26ebb0d367,0x004e0b8324776639,0x008f4a5782277b0c,0x00e970a164732f51,0x002dfd08ecdf2775,0x0027fe810f64f635,0x00e40a46bfc78d90)},
+  {FIELD_LITERAL(0x00e891ba8d5fc555,0x00c06381a1b458ee,0x0014d7be23b5a369,0x00e31fb0b1f06d62,0x00b736221ac1be62,0x002e09e298a409db,0x0041e271871bd33b,0x001ddcfac9a56d4a)},
+  {FIELD_LITERAL(0x002d21432db54566,0x000244b7853836b9,0x00fe453f3b4fc003,0x000de604248bbb3c,0x00bdeb7a1d8e0bf8,0x00a7aeb215040cc7,0x00c8a4d1bb937150,0x00e92ac4f28fda85)},
+  {FIELD_LITERAL(0x00b85edc16bd10d7,0x00b0d2eed49df8d1,0x0081de6713c16b8e,0x002295dc9282768e,0x00098c0763a84058,0x000063b626a1286f,0x001ccdc275bb012b,0x00bbaba08e40d872)},
+  {FIELD_LITERAL(0x00825cf5130ca535,0x00fc2eb436cb9a98,0x00e5512596f75ed3,0x00d17bd3f5c2ae7f,0x00b77d86293b3eaa,0x00d03c3fddcfbfb0,0x00fab73ba7ceb7aa,0x00ccbdeb773f9c30)},
+  {FIELD_LITERAL(0x009ad0d793669876,0x0068368b9a9919f5,0x00c02f026d7b9c14,0x00ae01f392789260,0x0038de4546db96a6,0x0014e794495da343,0x003a1ba344c6f184,0x0037d3546e81113e)},
+  {FIELD_LITERAL(0x00e10af63f6c0e34,0x0073450675ea51fd,0x00f1b303b3db5d8c,0x000297b8b0e9de9e,0x0021b458cfd1b5df,0x002bd09d73bfe559,0x009fc309673b7bfa,0x005de10287d26c71)},
+  {FIELD_LITERAL(0x0041a96f8ac7572e,0x00ccf3edc20fdf1a,0x001583656b09863b,0x004ccba99396aa36,0x00aa9d209a2e23f9,0x00be9ac192c952d3,0x00d50dd816387bd3,0x008fdc7da6281fa4)},
+  {FIELD_LITERAL(0x00a012a7034e9492,0x002aab5e6f3e04fe,0x009e88af2bae5686,0x0072d9c1c17dba89,0x00fe969d9d25a03a,0x006731aa528e3bba,0x006a21e45e4ed84e,0x008c1b60d6f80b76)},
+  {FIELD_LITERAL(0x00b1c2a25b209d39,0x00b3e64dbf8e3280,0x000c837b5be23351,0x0097602108a15ea8,0x00e91c8aab12fb89,0x00c2b86e3c67fbf1,0x005c229abe35249d,0x006d6705609f89c3)},
+  {FIELD_LITERAL(0x002784aba2f30089,0x00c2afc5d30ea54e,0x00da131434d85e7e,0x00c7290924a0fc7b,0x000eb162d17fc473,0x00d9b7407f8aaf1e,0x008e4502c54550b7,0x0010c7ebbaef22bd)},
+  {FIELD_LITERAL(0x00e88bb3ec3fb723,0x00f065de4f4eb1d1,0x001e50428e81385e,0x00459c24db507085,0x00e3ec78384a5da7,0x00a9693d3039581c,0x0020f31c2c42fe12,0x00b483610aab35e3)},
+  {FIELD_LITERAL(0x00446ed3596119ce,0x00edbfa6b1f923c1,0x00b2f42a3911c841,0x00d7b23a868376d6,0x0091e5f62ba880f9,0x00fc388b8ae6240a,0x0019bae9e54e334a,0x00b72d02bd81a7fd)},
+  {FIELD_LITERAL(0x0010cd2858822e5a,0x0061a241e9260dda,0x00739d3f43918ba6,0x005c61c83866d16e,0x008950364d236879,0x004a486d690a03ec,0x00d3f43afa1d58e6,0x006e681e46b4d899)},
+  {FIELD_LITERAL(0x00b6ad8ae82e92c9,0x00ff2e17ae183dc3,0x0035d11211c3cc19,0x003de3d9edb6cc3d,0x00c36f7b5b272a58,0x00b5a030adcc3b40,0x004aa04670fee718,0x005f1a0047c29ec8)},
+  {FIELD_LITERAL(0x006bf42daa132c2d,0x00f4dbee7d95a7e2,0x00bf2b6243c1b057,0x0053c0df5da8af2f,0x00cfc0cbf5580f45,0x00acbe1983b60a0c,0x006d7ec73bd17ae9,0x00429374d90f7276)},
+  {FIELD_LITERAL(0x005f816ecc89a7d4,0x00d48f7353419b8a,0x0075f8841abe06f8,0x00e378ecd4697101,0x00b60d5e6673fcca,0x0077f0f667bdfd6d,0x0088e31fbc483127,0x000feb83f44c9f70)},
+  {FIELD_LITERAL(0x00587d4f28ed650e,0x003376d446090ac8,0x00c02145fcb16c46,0x008c9bbaf773b5fc,0x004e014d9938fbda,0x0038613a77d8f6fd,0x00dc25639c3427e6,0x00c9f97c234a2f0a)},
+  {FIELD_LITERAL(0x009a3c792c238bb6,0x00b28fb30d3b7609,0x002e6396f32b2a72,0x0097bbe235fe8f96,0x003fc0d7f350ce1b,0x0085eaaa8b0d0de8,0x00ab9fd93800a3f2,0x00d34448cd5d5bc0)},
+  {FIELD_LITERAL(0x0048a134a753f8d7,0x002a7833ccc4b00e,0x00b764e5d2515187,0x00375f4a4a4905fc,0x00663ae835857735,0x0092781fa96a2eff,0x00df217e6794f15d,0x00c8e1697437d81d)},
+  {FIELD_LITERAL(0x0074a6276199adaf,0x0056ff1091596b45,0x0070e81a3050f97d,0x00763b0df7a5d9e1,0x00f54c0384841a93,0x008c7215fc391227,0x0052df8cee04c2d9,0x0009f9b1878e05b1)},
+  {FIELD_LITERAL(0x007af45f690ec55d,0x00f36eaff0e649cc,0x006cd7ef12fb0591,0x006776b7eb2dd98e,0x005296a7b47357a3,0x004706214da133c0,0x009ee7bfe15612e1,0x00e18047040ea275)},
+  {FIELD_LITERAL(0x005d95a1a3da90d9,0x0019cae93da95d58,0x001907ad2c6c36c0,0x0019d7d799ef9d66,0x00fef101bc3e62a0,0x00c15354d67e58df,0x007641212fe1d8a4,0x003b47f6721771ce)},
+  {FIELD_LITERAL(0x004c2de06fc33198,0x00aba41c03c04726,0x00fce120e57df7d2,0x006cd894b3d2ba1e,0x008d8cd90f0bd71f,0x0024edf6a4ceb79c,0x00fc4de86baf13c4,0x005d06a441956d1d)},
+  {FIELD_LITERAL(0x00f6a5f6b25f2d41,0x00ba2d5552e34029,0x005b4b1f467cbd7e,0x007d3a82c0e36f0d,0x001f45658fffea2b,0x00f21bf6c5cc1b28,0x000c6c182200db64,0x00cea5e389ff447a)},
+  {FIELD_LITERAL(0x00f5cd5c3a990953,0x001708f1ed94f959,0x00807a3217049080,0x00c9a97e551d50cc,0x00736fe2f0b6ddaa,0x0035056962f629ed,0x0081917aa979e0b1,0x00170c5d5bceaf37)},
+  {FIELD_LITERAL(0x00ee62718c012c3a,0x006e3aaffd8cd1e1,0x00d4585107f72087,0x0020fff32ed361da,0x002fa9ba60c0ce37,0x00d7c116082f4574,0x0071b2e23854f976,0x002e7d07d7e73bcd)},
+  {FIELD_LITERAL(0x00107bf61944026c,0x0063f3bb6a4a4167,0x0080e59bc42703c6,0x001cc5f8e2db8f66,0x00a2032c9a2e91d5,0x004bac13267c2c42,0x00d4e013ec2886dd,0x00c9e054cfd91d27)},
+  {FIELD_LITERAL(0x00a9f29b8783477c,0x009598644a5db536,0x00c488a7bbb634a7,0x001604d421a615c8,0x0010cbf24bbae704,0x00ca7974828ceb73,0x0027b1cd92e167d8,0x002c1746df55921b)},
+  {FIELD_LITERAL(0x0072ffe16e5d0bb4,0x00b08a013a240bcb,0x0043759a903c88df,0x00b19a75ef3c87d5,0x0056513205da30ca,0x000c6a2d9c3a0c47,0x00def6f542a9107b,0x00a7d0fb86db39bc)},
+  {FIELD_LITERAL(0x00ab7074892825fb,0x00496f7250d04832,0x00b87dd3af3491cc,0x00bf7b18e9ba4d04,0x00d4268d0f7eba76,0x00999d2afcb84648,0x005c257c9ed14651,0x00c7560b7e86de72)},
+  {FIELD_LITERAL(0x003d6ce74bf11088,0x009109d1930fa6ea,0x00d29315f08d69f8,0x009cbca066841da6,0x00829cfad1d6f7d4,0x0078d5e118a78323,0x008f8d265e9bbe8b,0x00aa46607ba758d5)},
+  {FIELD_LITERAL(0x00f2e28df7c46295,0x0046819ed26a4d3e,0x00e1a443b8c2b947,0x000e9fdd2f52b91b,0x000cefc0c8773768,0x00c3a2e55a3fbb33,0x00da97bc3d6fbddf,0x0034ff0241693ada)},
+  {FIELD_LITERAL(0x005da4cfb55540e8,0x00059473c231a256,0x0041eda39056f1f5,0x006333bb0a545515,0x00c2f6351910144b,0x0041fcce1b775d12,0x0093eadaf97fb91e,0x001a4741283f94ba)},
+  {FIELD_LITERAL(0x0013e1f7bdea6bc7,0x0028e7d10460d924,0x00de260c769089c1,0x0032fb50b642ea12,0x00cfe3a5e3344c10,0x00117ef29f69e842,0x0059f756a87e5b25,0x0081a7afb5e4b359)},
+  {FIELD_LITERAL(0x006ce5a38b1f0c7a,0x00ed8b1c0bd140c7,0x000fffee067752c3,0x00016053fdd9ace2,0x00952954261e4f56,0x00f5ca2e278d6868,0x0090a592538b5c73,0x00c662941335e486)},
+  {FIELD_LITERAL(0x008510f54444e040,0x002a7af3574766bb,0x0003187f178db4f4,0x00d460a0034562ed,0x00d82c83d3dae825,0x00dd9e8af336737f,0x002c32f64eb38596,0x004fa9979940b26a)},
+  {FIELD_LITERAL(0x00685d888a183279,0x00640ccf3c826f8e,0x007c30d9402edc3c,0x0067f3411bd98a9f,0x003897254a865cdb,0x00eb3d9aee498a78,0x00d654230abf42aa,0x008ffb945002e802)},
+  {FIELD_LITERAL(0x004ec96014de1384,0x00683eae724f9678,0x008655c9a5d0539c,0x00c0e195c40b4575,0x0031bfb9dc52545f,0x00fdb2cf813ac63f,0x0008a14c53a41e2e,0x0081605eb572d277)},
+  {FIELD_LITERAL(0x001e83faf597b253,0x00dbd6ece281fd89,0x0010e8d1ede1c2ec,0x0027b1c9987ad309,0x00eb8bb62a9b8088,0x0007baea82391ee6,0x00b4f9b93d268857,0x00736a8202ee8db9)},
+  {FIELD_LITERAL(0x00ad1eb39ea82409,0x008018837dc346ef,0x0042e66dd0fdcf03,0x00d6dadc3d0873a3,0x00578f5b439b0533,0x00991eef73a3269e,0x00b25a7eb21998a9,0x0081928c564ab69c)},
+  {FIELD_LITERAL(0x00a5a7788ce88ae8,0x004869596d9ca61b,0x004deb3dc756e80c,0x00fb7d2c3d96b064,0x001aea8d6cdb471d,0x0056809e29b8bb04,0x007747c74695768f,0x00320b13fc55837f)},
+  {FIELD_LITERAL(0x0015500642781040,0x00a5f1c6391f15f0,0x0085f1f9b978619e,0x0060fb1ca5a87c03,0x00ba0ff54fd512ee,0x006e34c7e0ecf83e,0x007ec55f0884f711,0x003c40cb0bc40d17)},
+  {FIELD_LITERAL(0x009db116ea9550b9,0x002cd163cd8fe38f,0x00b05f050b2bfd61,0x0019028218260522,0x007de7023d0e9f7b,0x00718ae604e766a8,0x0080cb3654bb70e2,0x00df59a2a4e86903)},
+  {FIELD_LITERAL(0x00aa8096f110f1ce,0x00d15c274a209b15,0x00c4d2d3f03dd352,0x0033526ac0b7e30b,0x00c1c7ed5fb65d67,0x008e7e1245a41734,0x00d488434cc2c541,0x000165e7ff576b57)},
+  {FIELD_LITERAL(0x00ae441703ef72fa,0x007fa93d55a75b50,0x0093ae42423e84da,0x009fbd16c4294282,0x001b2f667fb4ad3f,0x003039ce9ae586f8,0x0054dba7bead40a3,0x0098fa0ef8e38b75)},
+  {FIELD_LITERAL(0x004ee8945f246280,0x00f4a0c52c2afcec,0x00dde68ea048622d,0x0089483b75f559b6,0x00bdc73cd47e1b3c,0x00a6868e90bd0d36,0x00e59df58e49277d,0x0014682680db6f05)},
+  {FIELD_LITERAL(0x00209e24c11d2f03,0x006027d55592dc00,0x00cb7bbdec263133,0x009770374d46844b,0x00eddefe7325e7cd,0x004cf165f0dc2403,0x004d55c4a51c6fa2,0x0094dfa15646dea5)},
+  {FIELD_LITERAL(0x00ff24831c8a8f3e,0x005fb4c4cccddcd2,0x00aed7f3eb268296,0x00184731b7b6a64c,0x005e11724be27dde,0x000f8c2aeda28b4d,0x0003a1bd691c3778,0x00f57c69370b1647)},
+  {FIELD_LITERAL(0x0092cf31b8384898,0x00ad8c5baae269b8,0x0042fd167d124914,0x001449a136036cc1,0x000575b1bf4bb5af,0x00e1030e675def94,0x00b3e63f8aca53f6,0x0021714a2d110dab)},
+  {FIELD_LITERAL(0x000a76ffcbb6fa94,0x00f962b16da5190a,0x009c437590405e2e,0x0076179a45eef06d,0x0061584b86bbf73e,0x00fc2790bb57be79,0x008ccbb62673fdf6,0x00a70daadf6a463d)},
+  {FIELD_LITERAL(0x00ac2cc623b6131d,0x00bed0d82a409e25,0x00a0f439feffc26c,0x000036264870992c,0x0061fd1cb120ad7d,0x00375a61b8f89dbd,0x00f2899e00d3c23b,0x007cc499e1c6946a)},
+  {FIELD_LITERAL(0x00e76d8f927198fa,0x00a88f17abff276c,0x0004cb4a5792c4e3,0x00a1c032955baf93,0x00a09eca2d4f6d82,0x00c305cc203bc3d5,0x00eae53b55a692ea,0x007cc1d0ac0e6b7b)},
+  {FIELD_LITERAL(0x00fc7c624bf55de1,0x0058b2eff8730269,0x00f76e6b1c3252f4,0x0045593d3c91d33d,0x00e3f5dd3a418caf,0x00de30b535aa4b20,0x006fd648508db8dc,0x00854a730d25f80d)},
+  {FIELD_LITERAL(0x006f6f952aa4d128,0x000e4ed58696bb67,0x00da5f8d407a6a74,0x005e82783d539322,0x000b011962b3fcf5,0x00639164483135b9,0x002ace3be3fc137c,0x00a619db4529f4c0)},
+  {FIELD_LITERAL(0x00041027865073b9,0x009812afafa09488,0x00aeaa6ecccabd3e,0x00329ea623b12162,0x00d50bfa7ae0f8be,0x00085b62daa0d835,0x00d5865bd0117961,0x00cf7e76fc66d603)},
+  {FIELD_LITERAL(0x00ec04cb3b0b703d,0x0057ea500415afcb,0x0099ad5729eefb0a,0x004eab65b5eefd70,0x00457a76e82365a1,0x004fd18562ceed08,0x00d2c5b8755946c3,0x00de00871adfffcd)},
+  {FIELD_LITERAL(0x00b329be7400b15b,0x007281c0f6d2b0cd,0x00c6777328668e24,0x00cd7b32b87f2387,0x006e2c11965a7666,0x00acc73807381385,0x008aa492da591f40,0x00ccb6faa3a48f26)},
+  {FIELD_LITERAL(0x00fe21372091a621,0x00b1cb7b95218f60,0x00d751db9f579607,0x00ddf386328a1665,0x000ee55fecb7e6e9,0x0046268a64f5b39a,0x0013d157fffd0b2d,0x0070b36b9dfecfc6)},
+  {FIELD_LITERAL(0x00b738c70282ed9d,0x004d7811f4adc298,0x000424e24365ae05,0x0056dd4f88404050,0x001de9ff2783c7cf,0x00b262167f10ffd9,0x006e7cf533bcdd0b,0x00581a6e0bcd2aee)},
+  {FIELD_LITERAL(0x00dcfae5b3a3203e,0x00d2b6e4a4843b5c,0x003f7bb986e07a7a,0x002d5f5f24d1475b,0x0085b1050fa9277e,0x00a2f3e27b18a542,0x005fda6e9f06a022,0x0072b417a0f38e1d)},
+  {FIELD_LITERAL(0x0080e150795f9438,0x00be7844ca8a0be5,0x0097a04f7cf02cc6,0x0036aba155219ded,0x00c368b9752528ce,0x002be69642cae417,0x00ce698ef4226a3f,0x00116708f30af5f9)},
+  {FIELD_LITERAL(0x00fb3f70f68e0540,0x002f56177402bb2f,0x004e4dae56866b0a,0x003a2bfbeee98b74,0x0026f02798b00797,0x00e0ab9562e36a4c,0x001d857d1913727d,0x00eb84ca2791ac52)},
+  {FIELD_LITERAL(0x00bf945760a6b95e,0x00c4fc282ef81afc,0x008a42cade57cd5b,0x00b6ece9acdaec9e,0x00c0c268a503c7b3,0x00e525b4eb547a72,0x004a52dfa4d1f3f5,0x005936ccca2fd52e)},
+  {FIELD_LITERAL(0x00ba79d6bc87424c,0x005d5f91a483fda2,0x003ad0c1a9a915bb,0x00bbcf6e14d4acd3,0x0002061aa45667f5,0x00b80502b37c8d16,0x0087a95a391e6e66,0x006c195f2278a163)},
+  {FIELD_LITERAL(0x00523d4a4972524e,0x00471bf9c6b92697,0x00889a01b5c374ba,0x003bcd190578b049,0x005f3417ecc9fb9b,0x001bfb6861e2501b,0x00875c94f3e820aa,0x00112f0a32a2a554)},
+  {FIELD_LITERAL(0x00999f96797f0e53,0x007aa4266ff969bb,0x00a21a2f098fb9b8,0x0020c309c7d4b784,0x00b555d7fc43ab2c,0x008057912ddb398a,0x009cd065f2d62401,0x00158f46decf3d52)},
+  {FIELD_LITERAL(0x0044f0bddc5e5544,0x009b661a137b6a62,0x006907e4f773cdf8,0x00c4c2bd976d318b,0x00691f353753f2f0,0x00640a49fb97c5a4,0x00de6384056f5216,0x00f675974a0dc15f)},
+  {FIELD_LITERAL(0x003a3d910237404f,0x00a54a0949363a79,0x00cbfbe14be5e3d5,0x0049a43162a415a6,0x00fecea525dbf0d2,0x00fa52ac682fd905,0x00b5da9bb5a7b05f,0x007ce8fdf7fda64c)},
+  {FIELD_LITERAL(0x0014bc8da0171aa6,0x00e77f60e8c52a20,0x00b051c3b680bb33,0x00a15506294a0ca5,0x000cccaa96d20352,0x008b517729e2e673,0x0003da333cd6366e,0x00c8748dc0edbb24)},
+  {FIELD_LITERAL(0x00f6f1004bfa6340,0x001b3122fd29f501,0x00ddf5ca0321a9d6,0x009df101c7845595,0x00af38f6259cae71,0x002d59b8ddbe8a9c,0x0024ea3130d14e92,0x00180da80ed1edba)},
+  {FIELD_LITERAL(0x004c3fd2443d2d55,0x00d8cfadb61cdbec,0x001e44d312ad45cc,0x00a98ba21fd19fb7,0x00a33af3ce6ddcbf,0x0049cf330704b6c6,0x0098f18a8526260f,0x00a42c027607fb16)},
+  {FIELD_LITERAL(0x003249c62e0327e1,0x004af8e8e1c38b27,0x00f51647232de6fd,0x0072b8588b09a012,0x006c3d0248d89ae3,0x0094c77b8b9838b0,0x006a73bc282fd9a1,0x00bc73779b868f16)},
+  {FIELD_LITERAL(0x0009f79965d6afe1,0x00766911f9ac1417,0x0043e8d1b00db40d,0x006151239e5d25b9,0x003a5a0599be3156,0x009fc7356a8e466a,0x00e81a670825f611,0x0012eb2bcda94db8)},
+  {FIELD_LITERAL(0x0094befad62c76c2,0x0033e9f2523853d2,0x0045e30be95a4ea2,0x009de607fca1a5b8,0x0084c3fca492b115,0x0073cbfa9a9aed0b,0x00570124915fd085,0x00922c3ef3ba2e48)},
+  {FIELD_LITERAL(0x008eaa2faea551cc,0x008425fba597777b,0x0079d7d811bf49d5,0x00ac41c6d834911e,0x002f310f661522e9,0x00770797633339fd,0x00933eca559b69ae,0x000db2ad912cbaf0)},
+  {FIELD_LITERAL(0x00794731e2bfb46d,0x0088c763407aa1d5,0x009055add7bdd427,0x00f5bb58ab40eb65,0x00b10fe9c0817b58,0x006373cfc22849f3,0x00975bb08c6a19bf,0x009eb2499a3db9bc)},
+  {FIELD_LITERAL(0x0069284ac128849b,0x007447d51c395d32,0x0066be58025f9f14,0x000ed443d4f1447e,0x006b5af61873329d,0x005dc8234e0e33f9,0x005bf1e859289a3a,0x00ccebd6605a7906)},
+  {FIELD_LITERAL(0x0000ac37c2783cde,0x002ae269f924b779,0x00c0a4402945e9e8,0x00bf6ed4a422c2e1,0x000fea157089f553,0x00024dab356bb7c1,0x00236c48203ed3a4,0x004e8c371eb62268)},
+  {FIELD_LITERAL(0x006958f5f0593396,0x00fe7eefe6c3ffbc,0x009e0a833e6e600b,0x004f5168dee8e4e9,0x002ee85493f3b257,0x00e0412aae1c7182,0x000fef2d30ed0397,0x00e7146f4fb59148)},
+  {FIELD_LITERAL(0x00fbed7dc63ca660,0x00913addfe0af53e,0x005ca565eb20b96d,0x00e4f913738313bf,0x002a30bf2f77c838,0x00d6a967f21b5fee,0x000c64a63e59cd4c,0x001ae1a012150239)},
+  {FIELD_LITERAL(0x00fa82b0c65196d2,0x00a894b98bcf0ba7,0x0058bed23cf2645d,0x0063d08931997f1d,0x00c567eab08742b2,0x00affcb12045c9c3,0x0085f0a6670e2845,0x00d7ce04486726e8)},
+  {FIELD_LITERAL(0x002e90a195b63f77,0x0025b1f838bf582a,0x002e7a0ebc1eea25,0x00d0857d8be1df1a,0x0052d688c70d765a,0x0030e7d6a72260dc,0x009d4688c5cfeb5e,0x002111b7fe2d56f0)},
+  {FIELD_LITERAL(0x00a60b3b4add4075,0x00aac3f23d30e5be,0x00add6f4950c0323,0x006896a24c38f72b,0x0079f7115d90af35,0x00be3a47e7ab058a,0x00b59f5f1e2eae2f,0x00e6750611e71937)},
+  {FIELD_LITERAL(0x00b3a1c20f4c170a,0x00fbe112c8cebf3d,0x001628ee9102b1d8,0x00ebc8bb32b5d0fe,0x001f276e7f18661d,0x00707bde701395cb,0x00e7bf090cc6dded,0x00b8031bf1fea918)},
+  {FIELD_LITERAL(0x007ae2ac4ba8f7cc,0x0018fbdc749f2587,0x0028fe34d21ce8d8,0x00cd1419b0d594d0,0x00589bda550bfe22,0x005795a473c6ce12,0x00700af8802c824b,0x0015e453838175a9)},
+  {FIELD_LITERAL(0x00c2c275d2a51abd,0x0073405588a2fca6,0x000a968fdc11e10b,0x00030cf6b0fee3ab,0x00fb978b677e54fd,0x00bcc9ccc0e28789,0x009c2ec4a8b9c20b,0x00debf06ded68166)},
+  {FIELD_LITERAL(0x0087019d411a1fd2,0x000da215c9fff7a4,0x009dba2fb370a8a5,0x00f2a58e2c4880f2,0x00cb4017d4520208,0x005e9fddf4e10896,0x00d9ca38b732d2da,0x0036418325f92530)},
+  {FIELD_LITERAL(0x0067ba150bc393a6,0x00f152b0c1dfff56,0x0026792b4c90a564,0x003e1af0cbe59c3d,0x00648d1329f700d1,0x002ba87fd74c8395,0x00fdae220e3bf4f8,0x0077b66ca682e6c3)},
+  {FIELD_LITERAL(0x006a34f364dd198d,0x0014fb348280b8a9,0x00f5eeccf6dc9e71,0x00ceee7fbdfe41b1,0x00e6dfdd0e8a4cee,0x00801565f6e1bfa5,0x00aad84d5d807776,0x00f049b94ab48f13)},
+  {FIELD_LITERAL(0x00016ec7541bdfb9,0x00b547dc7719f6dc,0x00550309378cd940,0x004f06bb905d43be,0x0093a009cfaa0a33,0x00f3cd86161cc0e7,0x00df8f37951b1ec5,0x00d8ed85cac4a070)},
+  {FIELD_LITERAL(0x003171864b8fa5ce,0x0027bb66960abb85,0x0039b35e91d1a0d0,0x002623ab614924c6,0x00db43b3d1436360,0x002a56e471bea360,0x00285de5a48d9c38,0x00d1fc89e169c175)},
+  {FIELD_LITERAL(0x00490670651ceb6d,0x004afe3b3521efca,0x002ee42135526473,0x00aa159434250536,0x00d1357b0ffa83d5,0x0075dcb7d7939655,0x0022623c74ccfa85,0x004ca58f6d3ca07a)},
+  {FIELD_LITERAL(0x001434583f594ef2,0x00386ec02866ecc2,0x0048597795f78d16,0x00c3f6b9103f4dff,0x0006e838f19366cb,0x00a1dbcee588a88d,0x0041359afcd03e55,0x0095f93e816a6679)},
+  {FIELD_LITERAL(0x006dd8d996ab7784,0x0020ea5b2f18304b,0x00075323751d3524,0x002b9e01b6cdf2db,0x0021248c9ce03b2a,0x004d119c5263055b,0x00b7877bd84f7994,0x002f7ff8004e0833)},
+  {FIELD_LITERAL(0x004b8b5ecf9dc74f,0x0015d598bb6161a1,0x00e7e43a9d2741b3,0x0006543bc454b9e0,0x008e64dd13063c32,0x00538e6809f30136,0x00382ed3ec5c5867,0x0075093402970cbe)},
+  {FIELD_LITERAL(0x00d853c21f6799db,0x00b1a2e446927a9b,0x00c04aebe972726a,0x00b9870357687e9c,0x00104fc94c7d8718,0x0031516910451ee0,0x00f75a4c0e3b876c,0x00f7daab76260ea8)},
+  {FIELD_LITERAL(0x0053c66ee3f7bac3,0x002d5993677e3328,0x0002f4a5652d3651,0x001e1cd8ad714768,0x0068a2571d06632f,0x00e35de48ed32a0f,0x006756b660965f10,0x0006bad39503da48)},
+  {FIELD_LITERAL(0x007dfac417064d20,0x0063f9dab6d3ade2,0x005a917e70f5e572,0x00f0fa206ef475a8,0x003047e03ac2b555,0x000f14480a16d54d,0x00e50b1d3ec27ee6,0x008c05eda027def7)},
+  {FIELD_LITERAL(0x0018f8b587d6435a,0x009d4d3771fbed7d,0x0067813f76c55c62,0x007542508767e4bf,0x00cf4661a315f35b,0x00d3f45f32977475,0x00496a9b51b1c3b7,0x00e6b3ea80474edb)},
+  {FIELD_LITERAL(0x00c0573e00a70dc7,0x008ec2c9171231dd,0x00ac2f9a10fcb83f,0x005fc8965ea5e95d,0x00c9df795db1d75c,0x008b9684439a04c4,0x008b61aa0eb89978,0x007ed01116cfbd68)},
+  {FIELD_LITERAL(0x00aa87944d12cfbf,0x00b9d65389aa842c,0x004fcc119a5d6520,0x00db531f2e64d4c0,0x009f752f8c03d23b,0x00f13fb784c0a172,0x00472e2cab5bda66,0x008baf95cf5fd279)},
+  {FIELD_LITERAL(0x0079020749b60563,0x00ef38b0e883dba1,0x00b9ae4f131fbac1,0x00528e7042ad2d78,0x00c90833b25ee57b,0x0031000f9e534599,0x00c05403a9143234,0x00f5229884ff94de)},
+  {FIELD_LITERAL(0x00a6cc069be49dcf,0x007fd2efd28ec203,0x005b0b2608a8e568,0x00f61a770cae424f,0x00767c74a5a17e07,0x005f76c9d6cb98f1,0x00da72fd22cc9c65,0x0025e01f637fd994)},
+  {FIELD_LITERAL(0x0042b63e85572692,0x0033efc58ac4563c,0x003f1d27b4d68360,0x001c85f5c5641bed,0x001c7d16202fcb4f,0x0030d524dbc30462,0x009747bbb4c64b01,0x009d15d986742560)},
+  {FIELD_LITERAL(0x00dad519545561ef,0x0089985d01fe63c3,0x00e5ec4bdf6fc9d5,0x00eba9aa3e682919,0x00bbc7f1ab117c1f,0x007052d952b58212,0x003b82d052c14cd5,0x001a8cc09a9adf06)},
+  {FIELD_LITERAL(0x00859a81e4016b2f,0x00ae69134db4a3d2,0x00774abfbc4da973,0x004f8c15597fb8a6,0x008c58c8ab4ec79d,0x00e9de6338e53f1a,0x00dcf7b06b3c9ea3,0x00b889f6fadf8c92)},
+  {FIELD_LITERAL(0x00b3d77c05a67470,0x006e42b361775501,0x00a1f7c734d1747a,0x00655051053e6743,0x006735600f4d1a61,0x00e6ee64665751d1,0x00c3174b30e12055,0x00cb94a68f718b25)},
+  {FIELD_LITERAL(0x00fad4e7ebba5fc9,0x00bacb99d7b66278,0x00730d5dd77128e0,0x00d7ae828e77cdc3,0x00d482a66306ee11,0x003178a0278de8a0,0x00dd8bde817ca0e9,0x00384eda5b821d96)},
+  {FIELD_LITERAL(0x00eea442613a1830,0x0063f5a5cb9946b9,0x005d7085c0289efc,0x00e3211c543cb43f,0x00958686d18c3c41,0x00cde7785bc9ac7a,0x00f98f7f9d35b4fd,0x002a38a5bd79e435)},
+  {FIELD_LITERAL(0x00761ce285e95fd1,0x00332188e823268d,0x00960ec40c1af039,0x009e6406b5a78ca2,0x0071b80e6552f6fe,0x00cb2a60e4fce83a,0x00fb5e9d0db7829d,0x003833d5afef622d)},
+  {FIELD_LITERAL(0x00c8fd8461192b06,0x003414db1c100f4c,0x000a29fb22511d3e,0x0013202aa3e4ccb3,0x0056c4ec25ae83c7,0x00656bde5497bfcc,0x0083d42306e8b10e,0x00e298d6ade1960e)},
+  {FIELD_LITERAL(0x00c62cb45bed10e1,0x00320583a17fbc48,0x00b09abedbe93fc5,0x004ead8e88d55daf,0x002b673ef8164dd4,0x001c64612f5e4fc1,0x008620ec9a89d72e,0x0077ac5ec3f6af3c)},
+  {FIELD_LITERAL(0x00bb1bd41532f18e,0x0034b26cea4d2ba5,0x00bb591bfd4d82b7,0x0013012c4a440155,0x000a81dd31c38678,0x0053d8a9c3a0d20b,0x0057d710ff79bfcb,0x000792904b3137f1)},
+  {FIELD_LITERAL(0x00a174cee9654425,0x00fe85a673c5669d,0x00fa811985ec884d,0x00772f7931da8ab5,0x000209a2f7c7691e,0x002922426bc1704a,0x00b9beb735f73044,0x00610c6c40db6068)},
+  {FIELD_LITERAL(0x007ea848ede06142,0x0081340a2a512488,0x0026b8c7563f4216,0x008b9705013b3026,0x0064d8609a8e5155,0x00ec7133f8816db9,0x001242a63e6de12f,0x0091d6ac0e9b1566)},
+  {FIELD_LITERAL(0x00167183e8ead914,0x0038ccdfe68f308b,0x000f86be8ed140c9,0x00c0a75fa9fc7dea,0x00b1cb32c4eaa320,0x001fd03fbdab9051,0x0026497bb12e066b,0x0055266afe48297d)},
+  {FIELD_LITERAL(0x0032e39638f4d60f,0x003ff09b140052be,0x008d797c9dbae751,0x005f6cdfcc34a8ec,0x003b8389913c8edd,0x0019dfc85d06a323,0x00f763cf261a1a3d,0x00f873f138196370)},
+  {FIELD_LITERAL(0x009bedc8ffd5d956,0x0014e79500f71d89,0x00706ed13762fc1e,0x00c652455085e637,0x001a08b8d54eb247,0x00f6aa9751bad52b,0x00aa586192962254,0x001aaa59dd4f4e49)},
+  {FIELD_LITERAL(0x008dea90836079b7,0x0054a004a92f0ccb,0x003bbeef8aaa3cad,0x003b3f2bdee4d22d,0x00f1458a89b9e81b,0x00b7a04bdf8f70e0,0x00bc6bcdae8dc7db,0x0030b7e9910a56dd)},
+  {FIELD_LITERAL(0x00a66434f2d365c8,0x0063de347497ca5d,0x00159de55b633275,0x0033986494513b06,0x00867e1c56d1422e,0x00d069adbdbc9d5d,0x00266b24a8644d4d,0x00a71a1016d5da95)},
+  {FIELD_LITERAL(0x003b2ea1d144c214,0x00c293fe779f1c5a,0x002d2d98bddb2377,0x00f338793299f94b,0x00f975bd28dbb4db,0x00d4483f0053342d,0x004fd0b1d61dcd06,0x0063349b46fc0c28)},
+  {FIELD_LITERAL(0x0085293d52bcd1f4,0x0086fe9e3ee2005f,0x00ac17f096574afd,0x00447601beabb068,0x00287b45b68b671e,0x004c55edc78dbf7f,0x00950bb288cec767,0x002521a4584cf9f3)},
+  {FIELD_LITERAL(0x00fb43660e94c1e4,0x00448d24eda5b18f,0x006e01fbeef28f84,0x004d21bd64954f00,0x001b0ccecfa59e80,0x006eb15d29f11957,0x00a8162f6ad01f9f,0x0015ef494ca42c83)},
+  {FIELD_LITERAL(0x00e102c30ba75300,0x00e3a20952d4c70d,0x00a3b1adb7a16ab9,0x003d2b09d4e4f1fe,0x005572430ed79ff5,0x006808128f2ce194,0x0055cf49b3952219,0x009fdae1301ffe26)},
+  {FIELD_LITERAL(0x00b57654cb99f0c4,0x003729ce986f8e6a,0x00c86fadc7713a1d,0x001731952013e80d,0x0039a01146a3e4c5,0x00cc812e1795afb4,0x008fbbd14aa7a971,0x00d0bc542eb02dc2)},
+  {FIELD_LITERAL(0x001ae0b47e2d7503,0x0020d4ba7ee86f11,0x002572619a9f99e4,0x0046d0275be16746,0x00fbd37a83475215,0x008f00ccea2a9a8e,0x0019cc488513e730,0x0050daf8a6392098)},
+  {FIELD_LITERAL(0x00bd73b016b2c338,0x002a6f70f15d1759,0x00789c27a5111e66,0x00249ea68e2ed2ef,0x00b50070123d3c23,0x00cf7db725de6782,0x00dfd4bf75d5118e,0x0084c29eb4a775cf)},
+  {FIELD_LITERAL(0x00e67d26f00b39d9,0x00307aa5c18ed6d9,0x00cf79cd30022359,0x001671c3a91b82bd,0x00b221633f60ddfb,0x0053452907a3818a,0x0070c81c8f8510a5,0x001acb15daa1618e)},
+  {FIELD_LITERAL(0x0013754ca260c99e,0x00a16a0951c79ef8,0x007187f6e8efcacd,0x00c156be5f70ed8d,0x00ddc224263aeeec,0x008e70c4f4f69410,0x000219dc66998417,0x0099cd45d0b35c62)},
+  {FIELD_LITERAL(0x00834ca84828bf14,0x003b36ed297670ea,0x00565f2a18c779f3,0x007e40a13539d6f1,0x004a1b1b0fdca143,0x0039cc09548ebc53,0x001470d14a66051a,0x00681b7732479943)},
+  {FIELD_LITERAL(0x00bae1411f0dc52e,0x0066963fb315b852,0x008e567e0035d474,0x0040d0cbb006a00e,0x001784418f611e6f,0x006c65d83d0ed41f,0x003e80e19c1da5c5,0x00cde801ca8111fb)},
+  {FIELD_LITERAL(0x008639d4bbdda1eb,0x006f607a885533ab,0x00d500b43481f8fe,0x0084b88db10ae91f,0x0046065029625dbe,0x00672ff7ebcab8d9,0x0001deab5d84dd46,0x00ce85cc20a0b69e)},
+  {FIELD_LITERAL(0x002b4faf7673d2eb,0x004f2cd44fd7ef90,0x00cddadb877a23cf,0x0024a6ba0f7f4e9f,0x00b2d759d9b1e74b,0x000832c03694f7dd,0x00e5d16a044e5ceb,0x0098bf056247ad96)},
+  {FIELD_LITERAL(0x00f3d3a02e9acf8a,0x0083dbe25ea66499,0x00f63897949de917,0x00d8a6f39cbd6673,0x000136040753c5e0,0x006e7d8c2162b190,0x00b93c1b7b4caa94,0x0030fbb9c04008fc)},
+  {FIELD_LITERAL(0x00a1d5d933f3ab8d,0x00be2e7da28a34ee,0x00a4daa479902206,0x005206f027bb39ca,0x00a186c18179bfd1,0x003c85ff9ccba424,0x007ee210936a0cc4,0x001e74b0aed859b9)},
+  {FIELD_LITERAL(0x003e208c45382610,0x005866357c9178b4,0x0050041f2286befb,0x002a7d3b6a054ce0,0x0007b8cd9d1dc5bc,0x008782808ece7d59,0x0004d15ba4f3eebb,0x00d02b552d3c3d42)},
+  {FIELD_LITERAL(0x000e555db8c1a71e,0x003b1b0ff638f2b4,0x00179b1dfebe03e8,0x00d1a39e9e8a19c6,0x00182e0658dbb517,0x008b00616c3fc696,0x00d96650c19fc6c3,0x009e1c8bfc36d944)},
+  {FIELD_LITERAL(0x003ae9ba4240aafe,0x0010aecf9a8007ba,0x00e3c335c7353044,0x009cd0a6429a3fdd,0x00949178e5ce73d8,0x009b44e6d282f8e0,0x00fd14cfa75ac8cf,0x006e31b506f34323)},
+  {FIELD_LITERAL(0x00a70083d2392d81,0x003839c0cb335e7e,0x00dbb8c71b7b4984,0x003988625b6f5902,0x00641d03f1d61f35,0x0050b57807b23b09,0x000a8b769d2294cc,0x005f4c58cbe232b7)},
+  {FIELD_LITERAL(0x009eb566d6acb8ba,0x0034cddc3fd757bd,0x00f3b9e35f459780,0x00f53c999ecd8b7f,0x00efec5bcfd9c6a3,0x00aaff8fcab2b4ea,0x0023c923882e7f8a,0x0056c38ac2df9c35)},
+  {FIELD_LITERAL(0x001c7744eddf9eb9,0x00a06fb2fe34c4c8,0x002817d8b45809cf,0x00f34c357b859297,0x0067b62e973f299c,0x00840123fd5a4483,0x00fe2168fa8c542f,0x0064b752038ca235)},
+  {FIELD_LITERAL(0x00f598818e67a981,0x00da04d665dce2ab,0x0066283dbc4d5a8f,0x002361eec12d0095,0x000e9e01c7732925,0x0037d202ff86ff7f,0x00c78792d5b4de8b,0x00ec87d516880244)},
+  {FIELD_LITERAL(0x006ea0bc4998dc86,0x00777682a945a310,0x00950df5aeb63269,0x009713a696c4e2d9,0x0094b47a47bc7413,0x005f2b6eaf2b4fb7,0x00a4bf4e9823eaa1,0x006a6e2a5a0771e2)},
+  {FIELD_LITERAL(0x0085339ec1f09e43,0x007463d635437682,0x00f9116fc6e39c37,0x00b4868646b90bfc,0x00e01ece94f1ed12,0x007b2cf2c4a4eb15,0x007be4a90dec7bd4,0x00bb832f0863484b)},
+  {FIELD_LITERAL(0x0099b315296cd3f5,0x00c3eda2aa5b3cae,0x00528192f58e193d,0x00def780f13335a3,0x00153b48be33d496,0x0006e02e52a832ff,0x0019aff7eeb612a5,0x00a0e74df58d9abc)},
+  {FIELD_LITERAL(0x006172e2afae3632,0x002f092e956b5119,0x00ace394ccc36a19,0x00be1abdde302322,0x0094e6f5ca960e68,0x000370757ee06580,0x0049b50cd63bff39,0x00a990017efc52b5)},
+  {FIELD_LITERAL(0x00d33b849012a10e,0x00cde2864daed284,0x00cb559d969f64bf,0x00873d2e0fc0cbc7,0x00db4e883f0b050d,0x0052c9b102383390,0x007f0770900911e7,0x00a77bec27c1c0a8)},
+  {FIELD_LITERAL(0x005b11d373cee3a9,0x0087f835e00c97e1,0x00ef36a15ede8d37,0x001512461ca0c8f3,0x0006442fe81c219f,0x00d1adbdda539bc2,0x0052c54109b09bb8,0x005189214253345c)},
+  {FIELD_LITERAL(0x008139a3be29bf68,0x00e108506b532c75,0x00d2e968b42e2362,0x00886e66b4dca975,0x00cb4469003b339d,0x005e86ec46eb1c4f,0x008ad7bd8cf441c2,0x00c47c5d86f2e7d7)},
+  {FIELD_LITERAL(0x00d6017f187c63fb,0x00d5a8cd762d03d5,0x001343ff31559c10,0x0003d1004e0c08c4,0x00405373a2a40829,0x002441be7f0e2b25,0x0024c74ee2657252,0x00856c41f92a3da1)},
+  {FIELD_LITERAL(0x003d73cb757d3ced,0x0024bc4f4275066b,0x00c59b2a068e516a,0x00088fc2a19a64c9,0x00dac2547830d53a,0x0011ea24046c0d3c,0x002391aaa00cc55a,0x00f43eceb97ba3f3)},
+  {FIELD_LITERAL(0x007dde7285a54e53,0x0056857ab8b593b1,0x0094fff084943c19,0x00cf7b1b61448478,0x00b5b41cd5697742,0x00ef00ed5ff28de3,0x00d276874ae0fa9f,0x00253597bd7fc052)},
+  {FIELD_LITERAL(0x001bf02e4877507d,0x00f8eeac6f0c7324,0x00ce2c67c7e7d2fa,0x004ee58a77e68030,0x007845df29d5a074,0x0016acbda5f11f63,0x00f26e49af0237bf,0x00abd136a5783ce5)},
+  {FIELD_LITERAL(0x00527a959671893d,0x00bf8021ab6a2aaa,0x0030e897c38617dc,0x008c61a0858c642d,0x0006c8e82c8d83be,0x00590967c6634157,0x00a3812d306f985e,0x00fe7a63b3c9028e)},
+  {FIELD_LITERAL(0x00d023722156006e,0x00470e1726f8ba75,0x00c686caffa7a5b5,0x0011c382a772517a,0x0086f3fbfb32e3a5,0x00332cd9154c8090,0x00efd92e3f06207b,0x002977a1ae419d14)},
+  {FIELD_LITERAL(0x002d2f3018edb43e,0x008be963cf3987cc,0x007ee574aebef714,0x00efc5de197dacab,0x005ba8a6b0d3a1f0,0x0068630de3fabe7d,0x00713699dc950cb3,0x0064c47726660b8f)},
+  {FIELD_LITERAL(0x0048b530544225f3,0x00707390c93e1dd7,0x009738e9de7e7296,0x0035cf714ae99757,0x00f355e44035b665,0x00f3e6c7da34df85,0x00179b3d7130e9e2,0x00088d1d257dcf18)},
+  {FIELD_LITERAL(0x002dbbdb7bb84b19,0x001da44beb10d2c9,0x00e81bc546b0d8ec,0x0033794e8208dd6a,0x005bac64ef766aa8,0x00546cd4ae91d044,0x007273b06d8f3b12,0x0023825a55bb07e8)},
+  {FIELD_LITERAL(0x00d597863dc3ccfb,0x003914f25028b3a0,0x006a47493731d100,0x00837ee2e1b5c211,0x00105daa4ff3ab6a,0x0032cf1b5b1c92bb,0x00948322405c35c3,0x00241940d9ad6cdc)},
+  {FIELD_LITERAL(0x00533cd1d5d1ea03,0x0085ea47db16395a,0x00c238e838fbdb7c,0x003a87a57ca9ff2a,0x00e5b3c2c62b150e,0x00f4f14958a3ba05,0x0072d1e5e1a670d5,0x008003a19d8e01c0)},
+  {FIELD_LITERAL(0x0089679d8b798faf,0x00ca533690f0907a,0x0023819ebb7fe94d,0x0087d2c327a26c20,0x00399afc075f4d05,0x00a6fb89f7c7c15d,0x00418bcb5dc99b33,0x0080dcf9385d05c2)},
+  {FIELD_LITERAL(0x00ad3cb8435406f7,0x00c41669c44d95e7,0x007ae691a4468479,0x00981f8c3d674b24,0x00063fe24a2407b9,0x000525b3429a0d66,0x0020788482fa72d6,0x004a72740e186064)},
+  {FIELD_LITERAL(0x002f74b3ec4f514d,0x007a3c3fc3caacec,0x0014560d662ccdae,0x00f2e7f33d91b84c,0x008dd5ccf3663a71,0x006b39370b1cd34e,0x00a8e52a4c46d737,0x00dcfc57d00ee4db)},
+  {FIELD_LITERAL(0x002cc02ceb9792bb,0x0020a6e0aa8157a7,0x004e08538699c79d,0x00aabdd2ce8fe7f0,0x00054187b79d99f6,0x00f5a4ba6eb84828,0x00b44c7d47afaf0b,0x0050c6b08d7c37db)},
+  {FIELD_LITERAL(0x0073dd8da3b74844,0x0004a5af56b349b0,0x00a8528b8a92abc1,0x00da68739185d044,0x00c11b975f6049f7,0x009d061071a20a79,0x00bc82f65f077869,0x00591b168adc36cb)},
+  {FIELD_LITERAL(0x0052f1a304eef80d,0x000b98f0f6e24aa2,0x0018be1e692e020c,0x0079b7c4134b954a,0x00a7b10fcd9aaf2a,0x005e062ddb4e72e4,0x00b5f7024a07376c,0x00329a8ad6a4cc76)},
+  {FIELD_LITERAL(0x000d65e7a744788d,0x00a6baf38a29d0ff,0x008bb2a2af56e501,0x00fbb4049109d99e,0x009645dd228b7e4b,0x001bee7e41931e35,0x007f6dd4ccaff4d7,0x00c954e00801d8ea)},
+  {FIELD_LITERAL(0x00a9b8105a04ad94,0x00cdd30a68cbd55a,0x00580a6a3c19ebd2,0x00f08a78c65434d3,0x00fa3bdcbe0779bf,0x0002565e90255445,0x00af8f45a7bd5149,0x007e9d1e61602fb9)},
+  {FIELD_LITERAL(0x00796751d827f76f,0x00940d8bf8128cd7,0x00aae9174e8ebdb5,0x006f9c2ebbce9b5e,0x008d4ae53114a39b,0x00c9b234445260da,0x0057a2a8588b5406,0x00d3b44f1cb5536b)},
+  {FIELD_LITERAL(0x0056ac0a63f97b05,0x0070a2909b793d2e,0x006045ca8a4f9c49,0x0080d4a8d0e7d5a8,0x0068cf8fdce21057,0x0055569233c1f6a3,0x00dc072536edc718,0x00faff48c1e6c517)},
+  {FIELD_LITERAL(0x004d1eeacd311218,0x003e50ae279d7bd5,0x007020561963763b,0x007a84e65dcc1d42,0x00cb6027b9b44739,0x00d7a696c7efd7e5,0x003e6d8a4d2e4d47,0x00cae01baa34d850)},
+  {FIELD_LITERAL(0x00f2136ce066cbdf,0x0055d84a49cc2b70,0x00909620db5682d3,0x0083ac1ee93e2a70,0x004e758bdf842e6d,0x00ba896900cee671,0x00f0606280235d10,0x002be9f2957ac468)},
+  {FIELD_LITERAL(0x0066f449971dbd75,0x000f6213012ec08e,0x003f085fed9555e9,0x00cbd9e7849dc3de,0x00d46c051a581695,0x00fc40819666e8e1,0x002d0c4f2d2937fc,0x00e1fdca9d520ae4)},
+  {FIELD_LITERAL(0x0099f89276dd12b6,0x00ccb5d7757a5ee1,0x001712d89f2e6098,0x00746d0e28d9932d,0x005babcd03df7cff,0x00b4e373d91e8a39,0x0005302979ce99d2,0x007b16cfd94c13e5)},
+  {FIELD_LITERAL(0x0082a6d6652df014,0x00a2419f61465985,0x007311469fcfd019,0x0000de8f9ba17254,0x00f2bb017162b072,0x007f4e6c4dff9d39,0x0007dfe5429129a5,0x008b163c0d7fb11d)},
+  {FIELD_LITERAL(0x00d75caeb2c520a4,0x00122c6dddef472b,0x00dbe011f07c6112,0x001c5579aaf1363d,0x00631e32798ee50b,0x00aa32846b16affc,0x00942ba0a75fba47,0x009aeb1a105bb0e7)},
+  {FIELD_LITERAL(0x00914424255aa409,0x009854ade54f1b1e,0x00b778c7f76834d7,0x00041e2f2973b512,0x00faca34ceed5ccc,0x00ca9ed154ecfcb7,0x007b7474abbb17b7,0x00871904b5d56b97)},
+  {FIELD_LITERAL(0x0090e66e87758a86,0x006b9fd83e7b7f94,0x008bde7ddb757b9d,0x00b9b532600fc25e,0x009d3f954c4849de,0x00e30fdd99d76153,0x00bb1b5058ed9680,0x00a095c6cad3615c)},
+  {FIELD_LITERAL(0x00da84db9049bc8c,0x00487fa28d5d010b,0x007a471baca4d930,0x00cf3c3985cd2345,0x008a05bc3d83cb82,0x00a503ed70770842,0x003467e2a9c14396,0x009424abf4e2390f)},
+  {FIELD_LITERAL(0x008c0b3c4892e9fb,0x00f37c33848bdb66,0x006f590a6de21938,0x002172c745a15b35,0x000f721af2860801,0x0045ab732d5e9b3c,0x00391fd6cc0d09fa,0x00c13045ea76a313)},
+  {FIELD_LITERAL(0x00fe4b10026a9052,0x0088e33491333ae0,0x00688a117b43961f,0x0029042c890c1054,0x0015ebeb7a330b2f,0x00cbed3231ddf66f,0x001a0f4a60fc7e09,0x00ef05964b4577eb)},
+  {FIELD_LITERAL(0x00edbbccf406dcad,0x00bc3299b53aaddf,0x0034c8ef82a72687,0x00d3f312bddcbd24,0x0070ac6021b3649e,0x0042540f523aea92,0x00a2caf77e58cdf0,0x008d965528d4df88)},
+  {FIELD_LITERAL(0x0008aa70d79151a1,0x0006414f17b975eb,0x00b7caf4f0d78700,0x0056c0bd763d3019,0x0043955f8c2ee640,0x0017248c446b1028,0x00ae591c9e6ab487,0x0008b6372c3d3b91)},
+  {FIELD_LITERAL(0x008238f1a1a81af7,0x00bb6cd0543df68e,0x0076955bf44f530d,0x0076b225ececf204,0x00f72f7376dd7593,0x0083c4b0c3b062e6,0x004a6c623aaef4ab,0x0076f4da6a1aaf3c)},
+  {FIELD_LITERAL(0x00e964763e9cf8e8,0x009f1dd69236c83f,0x002245a14c5e23ee,0x005a26fe1f3fd5e7,0x006e4a5d952d5676,0x00c27292edabc89f,0x00d583354235f649,0x007534348f76e4fb)},
+  {FIELD_LITERAL(0x00d244656b7efb5b,0x00b6fcca21e97e7f,0x008c4ff59427a56a,0x00acf38265efc4b5,0x005d74b5134e28b1,0x00b1492e5fd80638,0x00c1661df09d7e54,0x003273102e4f1871)},
+  {FIELD_LITERAL(0x003b34e2c393a7bb,0x005f6a5e389f38cf,0x00fec77c1a37bdfb,0x0065428fcc3f5750,0x00b531e126f86cbb,0x00c3d1dda221a0ef,0x00afe96df69d67b6,0x00ad307b787fe32e)},
+  {FIELD_LITERAL(0x00cf339d6d2b590f,0x0009a49abb5f7b1a,0x00bf8ec3978e3685,0x009b6184c8a662f9,0x00acf88f5ebfe20d,0x001d4b655344249e,0x000e6e018bfb8208,0x0051abce70569030)},
+  {FIELD_LITERAL(0x008e0faf66fcb800,0x00f98ffd00949c69,0x0024d4d129a568f2,0x00f884690d09edfa,0x0054081e5a79b2a2,0x00e3b7913442f371,0x00c7fea95dfc6e7a,0x0037fdaa476990cb)},
+  {FIELD_LITERAL(0x00f18b964711ffff,0x00218f02503be779,0x0086510ba6d8a822,0x00f468795ef4ed4f,0x00d139f7cdea4c61,0x005de1e48ae80676,0x00010a70393ece24,0x00c3290f2412a6de)},
+  {FIELD_LITERAL(0x00ad75f3d0504612,0x005600b4ab031ac9,0x00d94f0d37f59ba4,0x00e29765285f5a30,0x001aa23b85c99f10,0x00edcc27cd2c86b1,0x00562444924509a6,0x00ca78330deed465)},
+  {FIELD_LITERAL(0x00e912e12309016d,0x002bb52c6bc451aa,0x00c9859b09fda2c4,0x002283589534a761,0x007dcf78bb6ce254,0x00bf7bb1dbf4b9a0,0x001b782796bb9468,0x00828dc82a040936)},
+  {FIELD_LITERAL(0x0039c67d5f93d2f1,0x00e9c73f1f7fcb18,0x00aa034b9109980f,0x0002d17fd7a0c91b,0x007b3bfe304189db,0x00732ec1129e8bcf,0x00cc709fec9d22be,0x001be4034857748a)},
+  {FIELD_LITERAL(0x001d68da631a758c,0x0010a8c5b498db36,0x00d083363876d34f,0x005cf1aa8ac50b21,0x00d2405658ff7bf1,0x00b41b5662029e72,0x00e79d73e0ea1488,0x00d2c38846149a43)},
+  {FIELD_LITERAL(0x00b6b1a03cba324f,0x00d8a9f2c80e7604,0x003b52cab3a883d7,0x0010d4db84289d0e,0x005c0c8f80db6fe5,0x003d69d7690b8062,0x00160c9b93208fb3,0x00ee080ea6911491)},
+  {FIELD_LITERAL(0x00f8f531c596e2cc,0x00bdc5612a37b635,0x00f03db973a47186,0x004e2694caca68c7,0x001d5d0acc2099f1,0x00b3c747c1546307,0x00177b9b0a381702,0x00fb9dd5d569322d)},
+  {FIELD_LITERAL(0x00c86a76cad7fab5,0x00910c2e5ec939d4,0x00b61ce64e5bc863,0x0047b52b0fc9a32b,0x00f01566868251a8,0x0011a8c63b20a436,0x002f65a7aabc3857,0x00f5c1a980ae8260)},
+  {FIELD_LITERAL(0x0085ae8eacb5486c,0x0036f367684c3942,0x0061747e8414082f,0x00202dd755d27c6e,0x00f446603eb1493b,0x00975c0cf9ec1c5e,0x00dab51808911dc3,0x00b1170a5a42398c)},
+  {FIELD_LITERAL(0x00b1dd90ac6ca316,0x0016d8a5ef344c45,0x00343fc514ed3a03,0x00d24584bd61f033,0x0018d136a53ea990,0x00f6aae4a96ed1df,0x00aee074cd0ab3ec,0x003ab9b44d2f0044)},
+  {FIELD_LITERAL(0x00250493ae6e9d4c,0x0072eebba30976df,0x0093ada9316d6370,0x008d13a3177fb58a,0x00079ba21764531e,0x0022ebbae4cc066b,0x006050d815f9fd76,0x001a01247f4a5c63)},
+  {FIELD_LITERAL(0x00220f2829dbcfb7,0x000a5a692451af03,0x00d44f35251833b4,0x004a3500dd148048,0x005e8caeecc34e2f,0x00c8fb244db8820d,0x00497463e899d499,0x00d213c2cfd34b44)},
+  {FIELD_LITERAL(0x00e5847ed12296f4,0x00699e4382071545,0x000f43b8a1e10688,0x001e0c3978d01840,0x005ac27e290a608a,0x00876a9c3dbeca99,0x00e519f8cb185408,0x000592882fad9fb8)},
+  {FIELD_LITERAL(0x0041cf7ffa8c55fd,0x00cdbab8c9d3e3f4,0x00f1bd1fcaa9a138,0x005d3f487cd1331d,0x00f912c0935c6287,0x00d228a7014a6e0c,0x00a5b509b1820850,0x00528ded69a4c7b6)},
+  {FIELD_LITERAL(0x00ac219b9b5ca76b,0x0018c0a0436eb73a,0x006fd813ab38e6a3,0x003d3c3de62694bb,0x007a71db7e6e8b9b,0x005522ea10f2f286,0x00d3fd08bc8b9658,0x009a74b23dce3492)},
+  {FIELD_LITERAL(0x00ec18b44f4479ea,0x00edf83478054722,0x00c7f7ebcbfa21b9,0x00c4d6140da4d77c,0x00b89a85c3abc314,0x00a413579bd0beb6,0x003df5bfb24e944c,0x00cc9f7ff28f860c)},
+  {FIELD_LITERAL(0x00edfe404a1a4177,0x001a3eb7246d0b7d,0x009a355bec4b666f,0x0006429dc9450874,0x002e2f7c5780a184,0x00848979491d24db,0x006e5f1adae2fb60,0x0026016ebfb8d8cc)},
+  {FIELD_LITERAL(0x003c33905a52595f,0x006491e709492fdf,0x001abf1db44b581b,0x000120d8e4fd0a13,0x0081d45e32711a74,0x003aef70d842045c,0x00b96ec7d6ad4aff,0x0022f270af70b7bc)},
+  {FIELD_LITERAL(0x00fb8bd67bd18eea,0x00f6b88c7c83d042,0x005a3be6541a5461,0x00e25d26a16d4d1f,0x009463978cef1862,0x00353c8b65fed6e4,0x000e4062e69cec96,0x00c503a7f154a028)},
+  {FIELD_LITERAL(0x00422f9dd96f0e51,0x0027dad83e8f2065,0x00f81f69bd5da144,0x007593df23afcca5,0x004f7bc9431baf20,0x0014bbf776c29dba,0x00be42395e0629ca,0x008134c71e40f7f1)},
+  {FIELD_LITERAL(0x00f00a5202037b13,0x005da0ef6571f16c,0x00eaa20f0b81d998,0x000f60b67aab7534,0x00d2fd1aa9e9b8fc,0x00df1ae1c679a540,0x0089d5aef3ca49e7,0x00f25ac64796b0d4)},
+  {FIELD_LITERAL(0x00de6bff47aa053a,0x00486871c25ced7e,0x003c48fc07e6b8f6,0x00ac7b332e1b421f,0x00af2e902b934551,0x009f34d9704ae62e,0x00ada05d8a251116,0x00f9c0d3764d6081)},
+  {FIELD_LITERAL(0x00ced8b6a9b00168,0x00603679e4a43851,0x00a1392871e6f582,0x00b46c003454eb81,0x008eb6fbec31c01e,0x003905aaae8706db,0x0067cdeab95832de,0x004e39df279282b1)},
+  {FIELD_LITERAL(0x0017ce475e81173e,0x00970baff7d3b54b,0x0000b4851700f624,0x00a9f886e74c94c2,0x007d0cbadcde2f2d,0x00c1aacc6903d3fe,0x00ffbf5d2b0d9da2,0x006725b582947697)},
+  {FIELD_LITERAL(0x007105fa3acb7870,0x00a587df8fb54b55,0x0066f40504e4265f,0x008f2c21f221c036,0x001673bf0cba26e2,0x004721dd790ff594,0x005c322d3799a1a6,0x00040d59214b1085)},
+  {FIELD_LITERAL(0x00943d7913902729,0x002625cdea1162a6,0x008a44d4d8072f88,0x00549a6338908cbf,0x008dff38fcb7012e,0x00d24f756d7051b9,0x00554b18bcba852c,0x008027901c1ce7fe)},
+  {FIELD_LITERAL(0x004a81b420ed3bad,0x00caa4146a171590,0x0099276e0141054a,0x0052f8f9eeac1c6d,0x00485b3d213e3268,0x00f364bd1e90a480,0x00cc77923b5444f8,0x0062879643c1da0a)},
+  {FIELD_LITERAL(0x00f590366829dacb,0x00aa04e65b379d4b,0x00f8a992cce61999,0x0027927b9609b189,0x006e523644a8dfef,0x00a855871f933bdb,0x00396fa2c8db24ac,0x003f03574e576852)},
+  {FIELD_LITERAL(0x0043559bfa2535a4,0x009c1ce8dd797e36,0x0079aa4d2461994f,0x003e1d2013b52889,0x00ecd704a4e51259,0x0081572f0caf0685,0x00fffbf14e86229f,0x0026271051c05559)},
+  {FIELD_LITERAL(0x00275f00c6e4b41f,0x00be4dbb7d7fbc8a,0x00b900d1b15c73f3,0x0033cf6a009d95cb,0x001a39a25628f212,0x0083091ffc9e430f,0x00b88120234d3952,0x00a3d01196b73b0a)},
+  {FIELD_LITERAL(0x00895ba9af4a6cd9,0x00bd94e2aed9afb8,0x0003ddc8107b6cc7,0x00d39c10f4e48026,0x00622dfc98c8b59f,0x008f4e27379bc4ae,0x007742bd6b1270cf,0x004e09664432eea6)},
+  {FIELD_LITERAL(0x00c6a4ca11e2a8cc,0x0096f6e184dcb4e0,0x00bf3bfed8fa2452,0x003fbb766421e8f7,0x0026dab999b9c9c3,0x00472eec7284e4ce,0x0065e6145e3a2b73,0x003705193e8b2900)},
+  {FIELD_LITERAL(0x002221987c3c929d,0x0060a70504f0281e,0x003b83984ede73aa,0x0071d530d8113a31,0x002af65ffb2f513b,0x00e1ad2ac5f08e14,0x00b0f39055ad6c5d,0x00a360a64b9052e1)},
+  {FIELD_LITERAL(0x0090c62bbe7c97e1,0x0066aa5e911850dd,0x007b5dd75b06afc7,0x00194f5a67b502a3,0x00b0ed49249e4d6c,0x00bc3c26c4d4550e,0x00b04db9d28308ed,0x00ff2031ca275b13)},
+  {FIELD_LITERAL(0x0064ecc8892a1a8d,0x00a6ae41940dabdd,0x002490f4309ac1c3,0x00b9945ef29be373,0x0035b97882c1953a,0x0031bcda53a720ff,0x004336d285d1d72b,0x00f51f1b5d5ed801)},
+  {FIELD_LITERAL(0x00f5d7ca234c774d,0x00201abac2d3541d,0x0071f9ee016b960e,0x0052e2d58415ea20,0x00ccd9f3513f9752,0x0017218d7c81addb,0x0039feefa4111bc1,0x009a01fee659cae1)},
+  {FIELD_LITERAL(0x00baaff8d410f859,0x0058952585894040,0x00501155e1b2e1c5,0x00d1b67277c3734c,0x00701868141beb62,0x0066c8346996de58,0x00f3601acb0adc10,0x00f79a8175f4a531)},
+  {FIELD_LITERAL(0x001c63298e1e8f75,0x00c6940e957450a4,0x00a34061899e875b,0x00e84929f61f88a6,0x003eac0b1614e0b4,0x00cc3c6a0a55fc02,0x00da9e89b0a09ca0,0x00247c2815fceab0)},
+  {FIELD_LITERAL(0x008e42b1aa6c1a71,0x001574fcdbab7859,0x00faaede61e0a438,0x007ada173b07d9de,0x00e15507ee114d04,0x00eceab1e3ea3b55,0x0073db3d806f7fee,0x0029e38af7e8bf77)},
+  {FIELD_LITERAL(0x0015b67236a9758d,0x009ffb5bfd9f81f3,0x006650d999a648fa,0x007270c7c1984a7b,0x008fae66c0fb6065,0x0000444bd0dad9ba,0x00de0532f94f8ff8,0x009a56eb8bd6a015)},
+  {FIELD_LITERAL(0x00df28bdcdd3ec4d,0x00d9a58c305af8bd,0x00cdab4f086f40a4,0x00268ca51192249d,0x007785adec3be859,0x00fa0429cdfc909a,0x008bb1eab7b2717c,0x005c8dd7e79fc908)},
+  {FIELD_LITERAL(0x00c703e6648d2af2,0x0047c01dace5eb99,0x009abb4098222189,0x009e0179de8e20b8,0x00b9bf061ae45c97,0x00a4cf2cc4227c11,0x002206d8bc4f3e42,0x0098b89e987bf429)},
+  {FIELD_LITERAL(0x00f672d322ba7d38,0x004c3c296115722d,0x000fe651c01b1be0,0x003c6ccbe8049e73,0x00c495b8a9f2bf8c,0x0007fa8fd82afd98,0x00f42a3cb53d0a96,0x0028f843c7ac6052)},
+  {FIELD_LITERAL(0x00ea762d73bf8177,0x007e059039069897,0x001b2e1c3a764491,0x001bb3a5f167e17c,0x00160c98478cf462,0x00727fafc2983a74,0x005daf738cde2260,0x00748bf6e1803849)},
+  {FIELD_LITERAL(0x00dc03bfdf8a4c3a,0x001ea955ef13b86f,0x00f29e952081270e,0x001281a9c3ac0845,0x003cd47e6245791f,0x003573c47eaedbbf,0x00846cbb5c9cf2a5,0x00bde898469fa9b0)},
+  {FIELD_LITERAL(0x0055ad2fb56859a9,0x00311de39b687a89,0x00b1d23ab298b78b,0x00b3e0b63a96c582,0x0041d03c62072035,0x00bf13b8b4a8c261,0x0051893efc11772b,0x009fe09f5ec52d6d)},
+  {FIELD_LITERAL(0x00abf4e5247435b8,0x00e04f51675d6c75,0x000aa7d9f1f6c5c8,0x00d9c6e91d6a119d,0x00a267ae227e169a,0x008800b6ba25ffba,0x0042cabbd80a7464,0x0048337c37665589)},
+  {FIELD_LITERAL(0x00459cf0da1f6788,0x00c9f9a770795e6e,0x005eb573ca6876d2,0x0030f47c59f50c26,0x00930be1e5bdd3f8,0x0022296e1de17b8d,0x0024e5ee6a6279db,0x00465b76a2c3150b)},
+  {FIELD_LITERAL(0x009a3cc31ebac9fe,0x006a9993c726fdc3,0x00c1ed9e693b6243,0x00af0e6255009243,0x004002f86efa67cf,0x008212ef66b5ea59,0x006da0d36e61004f,0x00b7c5cd860d1a42)},
+  {FIELD_LITERAL(0x00a6f443d2942bd7,0x00f9b06fbf93a2eb,0x00c0d7c127aa5ebb,0x00e505794f728ea7,0x00ea30439546ea88,0x0006f379b980457b,0x00db743807b3f1c7,0x002a96202fa0f5a6)},
+  {FIELD_LITERAL(0x00ce96bbd1d07af1,0x00a10730115d13be,0x004a5ca1edeef4a7,0x00028fcdc973b0b6,0x0071fcee71930070,0x0075b99489e378cd,0x00cbef0a7727e6f4,0x0074bfdc35fd3652)},
+  {FIELD_LITERAL(0x008eca6fa9d1ea3b,0x00f53c0ea3763db0,0x001556640effbcd4,0x00d3bc0d380cd00f,0x00fb19948314e49b,0x00018e75927d3f25,0x00b51c9c515193af,0x00a3bd5a79b43a8b)},
+  {FIELD_LITERAL(0x002e387bc376f2b8,0x000a872daf3d027c,0x00169996387bcb63,0x004e7e9cba2fa243,0x007257b85a9f3d40,0x00b3ba9904098c2b,0x000ff7a3af3195f1,0x004726cdf73678e3)},
+  {FIELD_LITERAL(0x00ee33d11fa3ee1c,0x00f88f5b5d436cc9,0x00d7ea6013f5b0fa,0x00fdca36a5d381de,0x00d85598482a3416,0x001de323bcb6b6b9,0x0033707ee69e0511,0x006ed29772dbe89e)},
+  {FIELD_LITERAL(0x00299a12112a0d2f,0x008896b76f9754c9,0x005d1acd153bb7f9,0x00383c86f0647d2f,0x000f5f7ae2791831,0x00d9989f3627e4f9,0x00652ce3fa44735c,0x007413f2da698f81)},
+  {FIELD_LITERAL(0x00605d2cdfa7332d,0x003d7cadf4267eb8,0x003d9dd7b7e7e36a,0x00cdd87462b6b9f9,0x00885d9d59459d15,0x00fce1d5893a584e,0x00de35c1f715c315,0x00b029a6f948bdb0)},
+  {FIELD_LITERAL(0x0092bf1cc16976f6,0x00745d13cd60b701,0x00107280eb8793ce,0x001439761d752d93,0x008b616ebfac82e1,0x00166db32b8cc77f,0x000ea73680c21118,0x00f3dad034208c70)},
+  {FIELD_LITERAL(0x00d204665cb4e297,0x009e6a3b1db4780c,0x005286a82a775a78,0x00277b535f3ca6e0,0x00ae350689090f00,0x00d5e5fa2044a18b,0x0090e8c9bb66fa50,0x005612a10464b019)},
+  {FIELD_LITERAL(0x00ff825763dcc5e9,0x00aa1f696c77bb17,0x003f33a94dff9345,0x00663071db7e4a1c,0x00771813df525f30,0x00038595a3820950,0x00ea3d94f4fb3c9e,0x00461c52d1fb7777)},
+  {FIELD_LITERAL(0x0025138aa552c6cf,0x00a98a3a2dfc1874,0x0080665d5d1f4968,0x00861164335a552b,0x005ba4212551ae9a,0x009c01bd68a2caa9,0x0005af2c9de0348a,0x00945af607ea9eb8)},
+  {FIELD_LITERAL(0x001d664ff2b5d240,0x006510fafe98174f,0x00cc67650e1737ab,0x0081c7480e9b3810,0x000dd6c6e4ebb6be,0x000c62ca5d828731,0x003d0b09043afa1b,0x000d554576130c35)},
+  {FIELD_LITERAL(0x00be3b988e3aef62,0x00f89fbd1b2413ed,0x0024f1af3ccaf8f9,0x0048024aee9cc37c,0x00be8c6e1cc98408,0x008dcd0aab2ecff7,0x00f30c19fd1c0737,0x00ff213c493c4907)},
+  {FIELD_LITERAL(0x003a300034a8f5d6,0x0098ac03c97da326,0x003944253c380c1f,0x00a76b74d33b6e1e,0x00847c34403b3727,0x003e5a474382ab08,0x0094eef4992d21ae,0x00421f5a53026093)},
+  {FIELD_LITERAL(0x002b5590b10a4e90,0x00c636904e3fdd17,0x00995fc306aa3406,0x009896e047e891ed,0x00e3e98c8c945e0e,0x00e6aea3f5162c76,0x00ffcdf1c34b40ec,0x0065f458a6d694b7)},
+  {FIELD_LITERAL(0x00d4d0b7796e192d,0x004f46c5f6b5b9b9,0x004fd205776f1316,0x00dbd77d13e2d9e1,0x00887f4108e511e2,0x005cb657baf723b8,0x00b44df9b503b447,0x00c8953726f16f1f)},
+  {FIELD_LITERAL(0x00277446bec3c0f8,0x00c646637a227852,0x00e11713fd02eb7f,0x00bee1ee0258226d,0x0004f9f649a7602f,0x00162909d52be0ad,0x0020b4fd1483c8f7,0x00787fa816d9ba0a)},
+  {FIELD_LITERAL(0x00230f32737f91e7,0x00ca4380ef67b04a,0x00221cc4152a5d66,0x00af0f26c8b90022,0x00eef049eb2f48d4,0x00f3ff8a88f54afb,0x00a409a03d309fc4,0x00ad72bd3b72f894)},
+  {FIELD_LITERAL(0x003009249c99c179,0x000137620f42e59b,0x00c08541d63b2a1b,0x00cf578e1aa16eac,0x00b44e1c7347d0f8,0x0057b60004d0c695,0x001fb222b225c3f3,0x00aad5b69a61b959)},
+  {FIELD_LITERAL(0x00942773907bf063,0x009489594b4d2a23,0x0007744eabf2282a,0x0011888d6c86855c,0x00139f893b01a410,0x0005ee7a0abf4c0c,0x009228f328183ed2,0x00ab0b62b491e5b3)},
+  {FIELD_LITERAL(0x008333ac0ba9f798,0x00b0bda79179b456,0x00aa2ee77365235b,0x008f3a9402e2011e,0x00dea813f5ef8587,0x00408ab844f33979,0x009c15161dffee13,0x00d98ab778b36110)},
+  {FIELD_LITERAL(0x00765db1fd0df7fa,0x008fae92c8607e0f,0x00975ee259d15744,0x00e990e6d15e4f62,0x00554639b31b7f81,0x000eef48a412f1c9,0x0099b724bc20a68c,0x002bcd17b28c0063)},
+  {FIELD_LITERAL(0x0041fc4efa106b11,0x003a50cde544727b,0x003b52a91f2ffb74,0x00b96fd47b204ce1,0x00fbeb0452a1f19a,0x007b8c32bc5a92ae,0x00ccfff5b0970818,0x0061c411e28e92a3)},
+  {FIELD_LITERAL(0x00750b604eaa4d94,0x00ff67c1faef4cc0,0x009f3fb42cd4b54a,0x004cefc1c855c225,0x003b86ec4e2b73ab,0x000ae7ba02015b67,0x008eaa8b556916b6,0x006949b8a18acae3)}
+};
+
+#elif GOLDILOCKS_COMBS_N == 15 && GOLDILOCKS_COMBS_T == 5 && GOLDILOCKS_COMBS_S == 6
+const gf API_NS(precomputed_base_as_fe)[720]
+CACHE_ALIGNED __attribute__((visibility("hidden"))) = {
+  {FIELD_LITERAL(0x00299a80f52d93a0,0x000a444e37a8c55b,0x008e6e9ce6e8fb3e,0x0078cbe5d8c2a821,0x00d7a30e29ee3683,0x0037dd444d0cb052,0x008e280a7316460c,0x00f8347b75db07f2)},
+  {FIELD_LITERAL(0x00d319f8c0f07eb2,0x00a75bc2b071120b,0x00181e2bc607f850,0x00ce3726848e5d98,0x00f411d0f0d3feab,0x00d995555a317489,0x00ced26f002987d9,0x00cae2914a6d6eb9)},
+  {FIELD_LITERAL(0x00674ddb81ff405f,0x00b2122e942dc339,0x00b0bd3659a439b5,0x00b98f4a29322975,0x006de819fb33d542,0x00de1d23d4820a25,0x0046613d342e357d,0x000d7a93e8e9380f)},
+  {FIELD_LITERAL(0x00cd1a9c4a255143,0x00f37350733ca606,0x00eb59b770a46859,0x009a22e61783f9eb,0x00b2a35c0b9731b6,0x0081b2f0af064fe5,0x003019c6ab666c9f,0x00a65e5f0331f97b)},
+  {FIELD_LITERAL(0x007d72bd36e79a8d,0x00f450fd34ae6759,0x00a723ccbc7a4a7b,0x0040ff39f8a63c00,0x00ede1eb7d627aad,0x00eb9166d4b0b7f2,0x00e26f0a96d5dc5d,0x002eb70c5b6e2e7c)},
+  {FIELD_LITERAL(0x003419337e9b8b8a,0x0006a9f9076cd4e5,0x00036f50e3a2b7df,0x003531c7df5a1983,0x0010e0cffdb6dbd0,0x001f3b21f162dc39,0x00c357cf3c345525,0x008b80f194cda0b7)},
+  {FIELD_LITERAL(0x009e2d30da94a697,0x003e256e6c1f2322,0x00da69056afec2a9,0x008d0a46e0fa46f3,0x005cfba6b28c8ab3,0x00807161060f5c18,0x003f2302673260e2,0x00b1855797d965b6)},
+  {FIELD_LITERAL(0x00a05797ec569c3a,0x006296986084b3b6,0x00e947429b749eb9,0x000fbcb86683ce13,0x002985d56a1f53ee,0x00f6ae72c4016722,0x00313aebad76b59b,0x0080310cdb6a0d2d)},
+  {FIELD_LITERAL(0x0047c070b740f824,0x00c15ac55f7d8ba9,0x003e08426ff92d31,0x001a54a69d84a7e8,0x00eed0a6d94efe04,0x00a16979e20f9fdd,0x0093034dc47eb497,0x00efbd2e85874978)},
+  {FIELD_LITERAL(0x00509ed8679f35b7,0x00c3e26de44d08ec,0x008fb8dbb507a34c,0x003ba71c383cadd9,0x0045cec9e093ee25,0x0061226af02e2236,0x00c18769ffc1d23a,0x003691b51baae794)},
+  {FIELD_LITERAL(0x0098859550793712,0x00a748e1cbaeea0b,0x00a048c74608eeae,0x004ec99def80c15a,0x00fa8a3fa324d3c8,0x001ad4e5000ff58f,0x00cfa6998c68b0b2,0x000e1c3653c3d85e)},
+  {FIELD_LITERAL(0x00255525c2197dc5,0x003c7ff7d3dc2ed4,0x002321522743220e,0x009b89e7020c3063,0x00f9e74fe3ab901f,0x0040bf9553aaf4dd,0x0038a6e2010898b1,0x005ddceb6e6fde01)},
+  {FIELD_LITERAL(0x007339c948e37f19,0x005426bda469b682,0x00f05e350fb91ac1,0x00390f417a8338f7,0x0042560cab12d5a3,0x006553d68e5540b8,0x00eb53a7c9cc0363,0x007a7d2384a6a6bc)},
+  {FIELD_LITERAL(0x003b01f339b60bb9,0x003473aaa7786aee,0x00c9bb81ca1ec74d,0x005dd1c08802e2a8,0x00c3fa46ebab4826,0x000eb6ac3167e1f4,0x00c27e4245295699,0x0008aa3be2d7a2d9)},
+  {FIELD_LITERAL(0x00afeaee8e20b426,0x00043201b524c2f2,0x00c8e9d7802fa0e8,0x00ef9831aafa2c65,0x0031311968506759,0x0073b3afa9f63658,0x00cb006ecfd7b7a0,0x0058b5646e4493a9)},
+  {FIELD_LITERAL(0x00fbe52fe9c43220,0x00a7cffe33a7ada4,0x0030fc27e8279d5c,0x00d6cd467cbe727c,0x001a5c54f2babdb5,0x0098141abd221a24,0x00e139eb6d460aa7,0x007a51cab8ad70dc)},
+  {FIELD_LITERAL(0x00fd68d3e3032a8b,0x00f5bb88c1d746b9,0x0034208ed4b6d6e8,0x00c95a8d6305ce3e,0x003f1badfe93b7da,0x00f424aa87763c03,0x001d6a48e27be0cc,0x00abd5730022006e)},
+  {FIELD_LITERAL(0x00d0afa1ba10cc1b,0x005e8c7317b719ef,0x00ba407fee1e219f,0x003f7a5262b9a31b,0x00ae0e5782f1c9b6,0x002d09c81ccb6284,0x003f4148b60e7836,0x00d1e2e135ade8e4)},
+  {FIELD_LITERAL(0x0012a67e6c6fc9e3,0x007983ed8092fc30,0x00e41c448392f6fa,0x00e56086e2d7960a,0x00790acc492d6db2,0x0046e897e0a2f36c,0x00074b959ce49bc9,0x00adc0672f969e1b)},
+  {FIELD_LITERAL(0x00b449043fb7d4be,0x006d8c418d9bb821,0x001431a994416f2f,0x00f6415517e4e50c,0x002f4f3a7ddef1f0,0x007c3038682dfb8f,0x008486a439ab3cfe,0x009de56f0b20124f)},
+  {FIELD_LITERAL(0x00503b9a2530392d,0x004e9506e91d4810,0x00d3c2995fc17012,0x00a18879da52df1b,0x0006a0b0ca60ab56,0x0082b8f6088ae066,0x0074895ea33dd1f9,0x0034f62bc3cd4d3f)},
+  {FIELD_LITERAL(0x009f96a9fe628b05,0x00eed69efc70c258,0x00d79e9e8883784a,0x003d2c9e6c3d95f8,0x00aae2a6cb446206,0x009a16631267ac9b,0x0024fdc55da3db9f,0x009cb3264be39a58)},
+  {FIELD_LITERAL(0x0063f0e652b9b460,0x0057fc2bac74bde3,0x0043176312d053f1,0x0086c966b6f8a6d1,0x0087867d51b0f19d,0x003b3ee1e4e9655d,0x00ae3f98d2834624,0x004dbb45f5166a78)},
+  {FIELD_LITERAL(0x00c7f313019a7315,0x00c74113c5a5a108,0x00acf1468f8b5fe3,0x009fb76f62a374fb,0x00af025d87cfaf2f,0x0046743b5678597e,0x000d2e8669c5b234,0x00af7ece940a61ec)},
+  {FIELD_LITERAL(0x0002689a1ec9671a,0x00adabfaf3a5b231,0x0063ef5b00b206ee,0x006ba2133e15d339,0x006d928f8239fd99,0x009258d95a770441,0x001cb09203cb16f0,0x00b704261642ff85)},
+  {FIELD_LITERAL(0x00bfe22ef247a57c,0x005792284da24441,0x000abbb66ad187c3,0x00d07124f9745f24,0x00af7667faa8ab93,0x0001297c74373cf2,0x009dd4a7356ebf6f,0x00b9ddcc5739c0cc)},
+  {FIELD_LITERAL(0x00b831e15c2621c3,0x00e18ca87e38838e,0x0080918ce73fe31a,0x0080ba79b19e9c2f,0x00efb066b7f61b2d,0x00eb0c963cdaf1f3,0x004ca3476a2982b5,0x008ea54c82068b8f)},
+  {FIELD_LITERAL(0x009c0bb7483b759b,0x00d3d64d6e0dd61b,0x00b70f6d6d00ee49,0x00d62d2f2f07086a,0x00a6884c2d94ffde,0x009f2f4495811ae8,0x00114dcebfa6374d,0x00363969f1cb8ed8)},
+  {FIELD_LITERAL(0x00e5b52462017334,0x00b92a732f522d48,0x006b1e969a95dffe,0x00715b3be4c5aded,0x00c5b23cdcde1072,0x006390e04f29fcab,0x00730b454f1c8fd5,0x00c4a31f5aa7494b)},
+  {FIELD_LITERAL(0x007476384f7d2eb1,0x005450183aec6d01,0x00bd6539985afe92,0x002d3d999b25d6c3,0x00ffbb0c4891248f,0x00ebe002ec11d0be,0x005ec9e0035be333,0x00a74a0727fa8eef)},
+  {FIELD_LITERAL(0x00ed5c1b43152a51,0x00b2294059656205,0x006b5bf995a3f027,0x005257a1d97df5dc,0x00d0df1190db7b8d,0x005714b42f8ac26f,0x00f22499d4ef19ff,0x009c4769d642d482)},
+  {FIELD_LITERAL(0x002b61c2c28bddb7,0x001a0c441b552c03,0x00fcd346ccc14d1e,0x00397d3aab2375e0,0x00554a9f2d5d98e6,0x006e01cdbf38e976,0x0047d1e324a2a3c5,0x00d99a6210374eef)},
+  {FIELD_LITERAL(0x00f6d11ba28b179c,0x009351f82da5b139,0x00929154888f939e,0x00c9fd99f47b35ca,0x0015ecdff9252119,0x00d655e4c66818d3,0x00c3715ea3e6fc16,0x007801020091dcb8)},
+  {FIELD_LITERAL(0x00e6ab544eb0f79a,0x00f3de410b89022d,0x00690945e2080ac1,0x0002091e6bc98891,0x0001d8e193167a67,0x0071a9e29b91d536,0x00b449985f61dd70,0x00c4a0ea976dcc63)},
+  {FIELD_LITERAL(0x00735535bffbd02c,0x0033354b3992a068,0x0034bb3512325a02,0x00f7c669a35736a4,0x00ab61c58ac70d60,0x008323f84c396e01,0x00348eae389695e0,0x009e9991e23844ad)},
+  {FIELD_LITERAL(0x00a988b3caa9a3e5,0x004a381ec28e17c2,0x003a754b40cb1a03,0x00517cf59305f124,0x000af5831a8b85e0,0x00cac05f9b314302,0x006a93dff54ee83c,0x00b60d875ff6dea2)},
+  {FIELD_LITERAL(0x000779b2f4e5148b,0x0021df87d5d29ff0,0x0025726a8f29ca78,0x007fb3ea34a4f381,0x008a30d28f6cff6c,0x007842e3e27c0160,0x00b58d882e4b57be,0x009265144cf3d7bf)},
+  {FIELD_LITERAL(0x00c1e0f3fa1152fe,0x0014be052878d3bf,0x00899ccab445af14,0x0043949c5272887b,0x007337326ac450db,0x00ac78493a247955,0x00ce1241f400abfb,0x000c188be52865a4)},
+  {FIELD_LITERAL(0x00fbadf587b9015b,0x004a1c2f975d79a4,0x008b9f451760bf4c,0x001c0f4c52434e6e,0x008b7f75dee35275,0x000b221b300882ba,0x00ad5171bebbd7d2,0x00c2572164e58f1d)},
+  {FIELD_LITERAL(0x00baacf742618525,0x006dc812519d9555,0x00c4930e201e794f,0x0005554c022e9328,0x005a8cc7ee558163,0x008f25b2ead95deb,0x00fc2a42b6b8b8f4,0x00a900fe05ac3372)},
+  {FIELD_LITERAL(0x0043e8fd7e30af66,0x0006046a2a4911ed,0x008ea2101cd8180a,0x00b31961fd150c93,0x007c59bd4b193171,0x0027283919962210,0x0010b99804ef6093,0x0035333fa6bf7939)},
+  {FIELD_LITERAL(0x00a9cea50f36caac,0x0098cd68dc2cecdc,0x00d0da834a718821,0x00f30a0d499f91e6,0x00c3ad10193d0337,0x005db28d2825e46d,0x0093220d976a4505,0x00cd359bd9745f32)},
+  {FIELD_LITERAL(0x00dffcfe3f4c663f,0x0079e1121335ed0e,0x0050276c3c5ae040,0x0074e52ef4b2059b,0x00cf3dfdb6d32f3c,0x000ba6c7ed6a4505,0x0005d34b84ed0766,0x0052f5ff098ba42a)},
+  {FIELD_LITERAL(0x00f0b4fa66911f6b,0x002302ba2a84535c,0x003bb872a34375c0,0x005d317fb951af8e,0x0040189accef0829,0x004dbb89b01d8747,0x0028b8c0866a9b7b,0x00a69d5c6c7a24f6)},
+  {FIELD_LITERAL(0x007f34f8a7d2782c,0x006409658e54e5f6,0x00181bb15789ce05,0x00ff1e651784dd13,0x003ba5aca4c1a760,0x003fa844e60c04da,0x00311887ee8fd677,0x003320ece5064f38)},
+  {FIELD_LITERAL(0x0009ee9fe195f193,0x007d5b05b776b5ea,0x00103180dc85942f,0x00d6e1bf96b7744d,0x009a1f7712a0dc81,0x00e4faa12ce16a0a,0x00923308cbeb22d6,0x008eeafac0ffb174)},
+  {FIELD_LITERAL(0x00b163ced930fafe,0x00894b81653a002b,0x00bdbfc89daaafbf,0x00a024a8d19e042a,0x0006ea9169c2d57e,0x00891c18fd2be870,0x0001602b13c593a1,0x0047a603a553ff47)},
+  {FIELD_LITERAL(0x0079dd2bb54e66de,0x001d7587c09b1ecf,0x0076b7248c65ffa9,0x008de33b54c0ca46,0x0013fa29dd818506,0x00198af3c5aa0bbb,0x0024bcf51363839c,0x00173d4297f21e7a)},
+  {FIELD_LITERAL(0x00345b323c3c64f6,0x005a508a2218df52,0x00fce756f6bee6e2,0x0069c83904efe436,0x00d2439624352dc5,0x00cb83c68f74925b,0x00a4f1960b61c1e8,0x00be508365ed2234)},
+  {FIELD_LITERAL(0x0081bef7b0c49079,0x00a710d3b8f44dba,0x00817fb307cb45a0,0x00264514dff066a6,0x00fa798ba95403b7,0x003155ecaae70aa7,0x0015809a2fbf3ff7,0x005e64fbc103aebe)},
+  {FIELD_LITERAL(0x00e76baf44531a2f,0x005758c6fc0aa2e0,0x00c5f39508d86e37,0x0044c698aa9aba26,0x00a5de6404c9595b,0x00054af882139c33,0x005db64da4b5d37a,0x00799172e2fb0c02)},
+  {FIELD_LITERAL(0x0061e4218da17851,0x00eb30a2080259a7,0x0005016bf5750135,0x0023055e56b1d324,0x009d9e468346c599,0x00585169d1685592,0x006c45b61bdecf75,0x00e6d209eea7423f)},
+  {FIELD_LITERAL(0x003ae07c144542d6,0x00bdd08b9c0689aa,0x007b096c9cd05189,0x00165e1e581fe47c,0x00bbdf26ec82aebf,0x00658634137d8a1e,0x00de6f5eb34f27a4,0x0029cb492a28c418)},
+  {FIELD_LITERAL(0x0073295682e280c4,0x0056d3074570e92f,0x00976e044d1936c2,0x003421c03031ae6e,0x006e35f6afd30f61,0x009c66b38fc0dc85,0x00128a8a688611e4,0x004b36d379b13dc8)},
+  {FIELD_LITERAL(0x00972c6b9099af04,0x0017c7b5b8183fd2,0x0076c50ae0dd51ab,0x003fc5e3b10e73ba,0x00478ec4b0d51693,0x004ae9a6584434d3,0x0060d134488a7b17,0x0042f573ba1ee1dd)},
+  {FIELD_LITERAL(0x005cdc67af8d6af8,0x005265810cc92e46,0x0015d8fd4b9fb841,0x004853eed4e3f1a6,0x0047837ef2a8aa7e,0x00c0aa749de963da,0x002aa139d919fdde,0x0094097f08174222)},
+  {FIELD_LITERAL(0x00d8efce81f51570,0x0076efa1c57fb216,0x007c34b7de0b0c94,0x004b2db53b20c822,0x002ae3281fe8a525,0x00c8c917b61ebc6b,0x00b116073fb18fbe,0x00d625b12bbcd7db)},
+  {FIELD_LITERAL(0x00cae4964c792049,0x009e84deee72692c,0x001ca51a6e4938a0,0x0094e170631d9f26,0x006f9578d9a08b68,0x0075ec16e3fce437,0x004675c652705b6a,0x0051476c61c8a76c)},
+  {FIELD_LITERAL(0x00195dc11402585e,0x007c624f9cfece36,0x0092c1bee1a07f3e,0x0058e3fed56ccf07,0x00ae00e06139474e,0x00fc9fc9efae30d7,0x00336705ba9c0eae,0x00d28904de332d43)},
+  {FIELD_LITERAL(0x006ee1deabbd34dd,0x00199469f4fbd342,0x006ee2bb5d604769,0x007fbb596572645f,0x00126480fe6f5757,0x009df89192aaa742,0x009ca850dff0331c,0x0061c8b242ca8979)},
+  {FIELD_LITERAL(0x0034fb8828cf124b,0x00e126315db528c0,0x00f87ce62b4c5a15,0x00576b7083d10233,0x006e74806fbab317,0x000a3fe2ffe99ca4,0x00c7b2dccb2f96b2,0x008fe649fab5ac3b)},
+  {FIELD_LITERAL(0x006ee1ee02150f17,0x0046c4bbc5bdd746,0x00a5c25229a254c0,0x001f5ffdf5a2fe12,0x009af44c410d7048,0x00d2bdd84860a29d,0x002edfb757191b84,0x00316ee552665258)},
+  {FIELD_LITERAL(0x00c7a143242733a3,0x00220abacf9f26cc,0x00dcd0cf768e8efe,0x009ba93ddea2b2d2,0x008554ee1eb0b41f,0x004ba43f6b857622,0x00a86db4b64615b0,0x00b29c26fa03a2db)},
+  {FIELD_LITERAL(0x00265356b29d4c4c,0x004470b4a0703ef3,0x006bfd49cc1c8e9f,0x00fac11b86cc3642,0x00ab789f0197603c,0x00a9a4b082722aa4,0x00178d80debd93a8,0x00b5eca742b42baa)},
+  {FIELD_LITERAL(0x0075a558892a3a4d,0x0055e76fd8926f9c,0x00cf4adeb51562d8,0x00728eba5ddf3ee9,0x00c3abf228495593,0x00a59c64e1c35bcf,0x00adb0abdab827e7,0x003fab5f6d3a6110)},
+  {FIELD_LITERAL(0x00b9306ae3d3c819,0x008dd5ef78344fc5,0x0041c6cd50b88214,0x0076d4c34e9fde47,0x005b236e42b87d2b,0x004ae3846141bca9,0x006ef9bd6b642e29,0x001ebe6e58a5b9dc)},
+  {FIELD_LITERAL(0x00f217c35a4aca1a,0x0015ce1c3e69abf4,0x002afa8ba501ce1c,0x00d7fa5da08997ab,0x0085088daf7f0563,0x003c6b8d4815cc02,0x002e9c46f7e48722,0x00c1b603b7ddf1d4)},
+  {FIELD_LITERAL(0x0065696e6fa8455d,0x00fcc2d4f219c4d7,0x00bc1c2c43b750c6,0x007f3bac7a1d9e6b,0x008c5cdb9de7d9a8,0x0025365f8dc6df98,0x00d126aad03fb5ed,0x00db9b6b2ba28e45)},
+  {FIELD_LITERAL(0x002fff46f3a769c9,0x0021fa940213fa16,0x00e5592bddff6772,0x0030bf190aee9000,0x00f83831bcf07ae1,0x00f48622dda6e42f,0x005ac8d0bfde4f5d,0x000c5813cf84d84f)},
+  {FIELD_LITERAL(0x0013409d96e5d248,0x001fa0f455c61a82,0x000ccaa38a26f32b,0x00071ef71ebf9027,0x009bafc77516f86c,0x006a907721e10359,0x004de468ab13ad83,0x00126c6b99e68801)},
+  {FIELD_LITERAL(0x00d1edc54183f5c1,0x0008addbc1ed7af2,0x004e863ed2c322bf,0x001ba330ebf5eaed,0x0008bb6f31a7fe23,0x00a991b13283fd6a,0x00cc4ac6a172169e,0x00c0c0d426a7a3c9)},
+  {FIELD_LITERAL(0x00f2059c9f6cce00,0x005393a3c880d8f1,0x007dddd4ea5a0dc8,0x00e8dcca7fbd33bc,0x0099e2bbafef71a3,0x00e345ed428110e4,0x00dce40cc7beffd0,0x00058d6dcf5d9444)},
+  {FIELD_LITERAL(0x00d83b75e2fb2c7e,0x009b723b841ea410,0x008fb0563568fe1d,0x00c23274b59686c0,0x00c44a30386f0efc,0x00e1b0d1254ec89a,0x009a26165adefca8,0x00637e329e8206e1)},
+  {FIELD_LITERAL(0x00d1ef24f0494a03,0x009fcb0d04eeff2a,0x00395c1e53bac16e,0x002b11898a41fd2e,0x00eaeb6aabe9ef61,0x0028ee47253b9bb3,0x006fd4bb04f5de18,0x002e4d9b4c48f982)},
+  {FIELD_LITERAL(0x0088a392194f2696,0x00452ab3879b7f84,0x0071f57a65e5af16,0x00d6f4e44dbb4c6c,0x00f6ce24f5c11f7e,0x000e18ac2ac24a12,0x00f96390e417e172,0x00380e9239411c5f)},
+  {FIELD_LITERAL(0x00519ad4e29fa7dd,0x0070361dd7a19af3,0x002cfaa589d0c79d,0x001b99afb648fd7a,0x0083b649a94757a7,0x004ff303b315bfd1,0x007c3eee591843db,0x005825923afcc1ed)},
+  {FIELD_LITERAL(0x00e4d47251d6ca23,0x00770d92a351e972,0x009320de25a27715,0x008431ca7c885851,0x00178596d9be515c,0x0043f9ee556f4c0d,0x00c97882fbfc4bcb,0x007fe587b70fddd5)},
+  {FIELD_LITERAL(0x00073fb070e005c8,0x00893b61879e0a9b,0x00cf61fe5c846994,0x006cd4d172caaefe,0x000913198f8d1080,0x0088cc2221c04b70,0x009d80643ab73209,0x007ef9104bf57ee4)},
+  {FIELD_LITERAL(0x00e2957e4cc9161d,0x00dbc78304bc0759,0x00d3fdf7d58956a7,0x00a4b65c29151d93,0x0027d24af2a2cd9c,0x001fe9b1148fa7bf,0x00cff299d68085fb,0x004b3095cd11d3f8)},
+  {FIELD_LITERAL(0x0032db1bad43a5d7,0x005167fbdf795d4d,0x00461b821cd33fc8,0x00767215a6717c20,0x008a823fdbc74efc,0x00b5a2001b3580bc,0x00038fb9eeefa158,0x000a9caa67a2e238)},
+  {FIELD_LITERAL(0x00a6a6c48b9430f5,0x005a5626e9ce24df,0x00f25df3097117f1,0x00cd1610a1d988c2,0x002ba779e1adae4c,0x000ac640b5c28faf,0x00c1c8cbf42d19f3,0x00b31bcdf862d079)},
+  {FIELD_LITERAL(0x007853db1128757a,0x001dfa67380f0e30,0x00257d6c03cd9194,0x002ac14b733288ce,0x000d4b25c11751b8,0x00a0f25c18f0ff1b,0x00d183b4872c31a9,0x004574a6e73a10d0)},
+  {FIELD_LITERAL(0x00fba303d5df1c3a,0x00df492b58bb3568,0x00900a623b95a041,0x0080a83cdd4ef275,0x008ae6a7ba2d4ac5,0x007169630dce7060,0x00325943b4ef0af5,0x00da7e3dbe2c869e)},
+  {FIELD_LITERAL(0x007939ba0f8e1b26,0x00100795eeb69f3b,0x00fc86694c6418f7,0x00923363a2a5ca90,0x0060fc70eca115f9,0x00186f00853a34ed,0x00e0144fdd67d2fc,0x0060d230efdad1f3)},
+  {FIELD_LITERAL(0x00b8a92e2740503d,0x00f840089538c32a,0x00cc7ea605728100,0x0012ba6fcfda85d7,0x0078a53945d46bc6,0x0036c4b050a34bc5,0x0020a2eccded96e3,0x0084bf8e5258024a)},
+  {FIELD_LITERAL(0x009c31bf92926457,0x00d6c3595dda2488,0x0030d8fc6bd566d9,0x0033052a1d3b8cb8,0x0067568bfe63f00c,0x003b831283b89825,0x00339ba0a4464ad6,0x00f99491f8fe15d4)},
+  {FIELD_LITERAL(0x0068dcaf2e184752,0x00096664746474d3,0x00a5e3ec98ffdab0,0x00a675c26cccccda,0x00e364284cbf455c,0x00f468f48b5fd290,0x00f1dc6e9459757e,0x008c56429f67602a)},
+  {FIELD_LITERAL(0x00a08b0f8a6cac68,0x00c61f05946684ca,0x009ffc0f530137bc,0x0084859ad43ecb20,0x00f34ff8a8315fe6,0x0081c9cccfce171c,0x006b7c94541b3a75,0x007999cb4ebcc5fa)},
+  {FIELD_LITERAL(0x0008350b7f57247f,0x004813c771843907,0x00fe4b3e207412b7,0x006c52208dad24c5,0x007e917f2c814ca1,0x00318579f3a4c915,0x000a1043bd13cec6,0x008b0bd3cc18682b)},
+  {FIELD_LITERAL(0x007cc9a000f84470,0x00ae900fd39f48f1,0x00a6a6cfb91f6917,0x0050bb08810b8f92,0x00507e4286f0f949,0x00117c47ca43c996,0x006af94c8570e746,0x009a23e70c1f0b85)},
+  {FIELD_LITERAL(0x00939ce765e25e09,0x00151f921be28569,0x002634825c4cb6f7,0x00014cad76acb124,0x002086dff9d3b635,0x000d7f6ce3559881,0x0008114edafab080,0x009b47ee22d00691)},
+  {FIELD_LITERAL(0x0077e625704e24d7,0x000c4d8355d7b179,0x007b153223500291,0x0022068e85f441d3,0x00c4121213416dd7,0x00fca0c558295072,0x00d3bd1b8135c4ed,0x0005eeb36144c96a)},
+  {FIELD_LITERAL(0x00b2a14260293e95,0x00afb68ed3589de2,0x00492343065f78fa,0x0033e793f0e4248f,0x0046fb154ad8d5a5,0x00d1eb1d718aa1cc,0x008ce298530dfd34,0x00d1a96e93eae4ba)},
+  {FIELD_LITERAL(0x00ad46349ce96a4a,0x00aaa92de0d28bdf,0x00be7fa3636da64c,0x0068ea49d0e554c6,0x00f39d779653d241,0x00eb0dda6492047e,0x0011b2a641a940eb,0x00cb8195892aa32b)},
+  {FIELD_LITERAL(0x0008c7cdf27a8bd9,0x00b996131c9234b2,0x006600eb5724f53d,0x00a63f01ad5eb9b7,0x00530c9000a50bf0,0x008c65efea7b1980,0x000039be0f8ee7ba,0x00f659512225e478)},
+  {FIELD_LITERAL(0x00760fbc3658d198,0x00511e118b9a6392,0x0049b83237583f1a,0x006c7a364474329e,0x00490f4f37cfdbc3,0x000cc9e52129813c,0x00004d1cf402b833,0x00f2dd5c2da6b6e8)},
+  {FIELD_LITERAL(0x00f9cdcc8d60586c,0x00360b13e82656f1,0x007dd26e6e779a02,0x00421fcbe1e442d1,0x00c49d8fcf03e642,0x008d4d2ceab2e62d,0x00196790f74aa576,0x002f4055337dac75)},
+  {FIELD_LITERAL(0x00266fefe2393ba0,0x00844482b85a7246,0x0019a2a6dfc1ce80,0x00304b4a602fbadd,0x00d9e41c838f56d6,0x00eb2cb4ca51ae5f,0x000caae2c46a6353,0x00ae4b69759986f5)},
+  {FIELD_LITERAL(0x00d65bb5a5bde024,0x0021c07232f96608,0x00e950d479778beb,0x0077161cf00e07cb,0x006452eafd30e93c,0x008f1b97c49ff53f,0x00664a08093f0f3c,0x0098f1f5940c296f)},
+  {FIELD_LITERAL(0x00f8824e3086b5f7,0x00bc9151a71afb87,0x006b5e75d031a0da,0x006e6ce9cf41d967,0x0081f3004cb94b00,0x003c9ba2973e3e03,0x00c80bf00afac7d9,0x003b644564ddd7e7)},
+  {FIELD_LITERAL(0x006cbabd353f84c5,0x0017c96e0731edff,0x00e03211b7352e33,0x00e4d2006d270d07,0x00aab023008807c7,0x00cfac3954d84771,0x000a36e0f722f349,0x0095e982db987528)},
+  {FIELD_LITERAL(0x000b46bad80e9e4f,0x00b04eab78328a0a,0x00b623661a9dcea7,0x0070ad20832c3a0d,0x00fa372249b9bac4,0x00f77e71216c982f,0x000e95ac978aa8e3,0x005c3776f5d66c87)},
+  {FIELD_LITERAL(0x003a50e7a0f86c49,0x00bdf85b5ee0b8d6,0x009dabb713b60993,0x0089b521c52d0238,0x005e6987221414f4,0x001bb79b282898a5,0x00c910ec3cbdc82f,0x00544654abf202fe)},
+  {FIELD_LITERAL(0x00cd53d59ba6eab7,0x0007230f5a95e21a,0x00bc4729e5e22973,0x00aa9adda1b017e5,0x00af5f988b52b06a,0x00893ff7e3c90fba,0x00b5a31f66a88474,0x0029d7ae34f9ff50)},
+  {FIELD_LITERAL(0x00d28cee74be7720,0x000c1b3c37718b86,0x00913b41721ffc4c,0x000a7e9281f34f15,0x007e252fbe106c8c,0x00977a32b3f134be,0x005a4a588c7fcc03,0x00870578f8804f62)},
+  {FIELD_LITERAL(0x0021b47b8e6554f3,0x00200203f37f0ae2,0x00a5e0833b987a89,0x003d8ebd4fdda9e3,0x00da62965d44b038,0x000d11dfa8f9e0fa,0x00ee7bc660995a14,0x00adb59d7cb3633c)},
+  {FIELD_LITERAL(0x0050f9441dfe6912,0x000d882615e04e57,0x009c64f8a6beeaf1,0x000150f7362785e2,0x00c4bcfb9c5ce116,0x005c89af84c5a4d3,0x00b5699dd11185b9,0x0036592da67c6a1c)},
+  {FIELD_LITERAL(0x004ef0c38ee08c92,0x002c7a9f1d17c9e2,0x0033ac2732dcad4d,0x00886b5999fd6bbf,0x0005215f11fdfa3d,0x009f5d621a9cd766,0x003c92454251f23f,0x0044a4d6e1393983)},
+  {FIELD_LITERAL(0x00617688ea792adb,0x006bacad8e90e442,0x004c981f4f909d18,0x004bfae99536598b,0x00e5360effdc8f19,0x00b6326f128c25cb,0x001ad698c73d8488,0x00932a53ba764bcd)},
+  {FIELD_LITERAL(0x00b3264a4ac43b1e,0x0085532575782850,0x00ebfc4fb4f840ef,0x001466dbf4d21e38,0x00dcdb8332328426,0x00af8977e1f9af82,0x00aabf05d9721a94,0x007a128ca4990f54)},
+  {FIELD_LITERAL(0x0066d7367f6be374,0x000839e17eedccca,0x00c25abcf9bc77b0,0x00ca3827398fca93,0x0026599926f1b2b0,0x00740be031581d8f,0x00fbe72567e66996,0x00ddb3dc40efa85f)},
+  {FIELD_LITERAL(0x00858b7b53357573,0x009896f9b464fa51,0x00b47439b4016fcb,0x00c893d80fa0cfa4,0x00569c60c8d4388b,0x000c8f1d294ad2a8,0x0083b3022c9ca807,0x00d9d03138daa292)},
+  {FIELD_LITERAL(0x00043561df38143f,0x00d8bda9ce1cdf4f,0x00f906e53db84977,0x0077ddde5f5362b1,0x003c511926aaed5a,0x00023e3f604c4175,0x007059a0e1a77855,0x006c27c87171fe2e)},
+  {FIELD_LITERAL(0x009c935024fa931c,0x00fd675d61f9ef90,0x007106f8fdb54bb4,0x009ffd75e9e27a01,0x00988f287e12afc5,0x006fe64e55594a17,0x0087e429b290c2ff,0x0067a85d30ffa15c)},
+  {FIELD_LITERAL(0x000dfe6916e80a4e,0x001038d7d83c348c,0x00dc30a7637001e1,0x0030e826db6a9d35,0x007e05241ba74305,0x002191b471afe865,0x00753045cef204df,0x00c90d65269860e6)},
+  {FIELD_LITERAL(0x0082ce541ae1b42f,0x00ee09903a9a5783,0x00fdd43d64a3d75c,0x00aa6820a54044c7,0x00b724806f352652,0x005a56f6dc2c1fdb,0x00fc2af91585adfd,0x00e1003c63bb7790)},
+  {FIELD_LITERAL(0x00e4c9cb8c462d12,0x001d94e1432019e2,0x001232e36f4a2ad1,0x000bb2348c831e06,0x009aca755a2b67a2,0x0099de5cca4d4d3e,0x00dec7099274962c,0x00913bd07af1d213)},
+  {FIELD_LITERAL(0x007313e43a70bd12,0x00aeda0908433b4d,0x00590e39cb8782ce,0x00c0a9aaef43629d,0x001b86e9f126d90e,0x00f83f462396eb32,0x00b74fedf36c8d99,0x00cb38c31f7d3b74)},
+  {FIELD_LITERAL(0x00d0d55d15255af5,0x00e284d3da18ab0f,0x000e68f87d7078f1,0x008f57d5dc70c414,0x0078daf94ca1a574,0x00cf0399c4ff2fd9,0x000eeeab0c527c26,0x003f6ea037dc5a2c)},
+  {FIELD_LITERAL(0x00aefb4a0d6ea7bd,0x0021520f91ac8093,0x0008b7f58ee2c49d,0x006ce3e165c4664e,0x0021ee6cf35f3f7b,0x00d24b19a1382e60,0x00b39e553cd67318,0x00ad8f03f3d30180)},
+  {FIELD_LITERAL(0x008c72e37a53ce2d,0x00962857bd4d55c1,0x00336576e4eb536b,0x007c97637177a0be,0x007402f24718f598,0x006e7da6878cedec,0x00decae45cfa7f57,0x00545f89927aea7b)},
+  {FIELD_LITERAL(0x00b77bb8737d3765,0x0033c382d79e7c9a,0x00432bb8b11bbe0a,0x00a19b9e7d26a012,0x007928f1b94a48ae,0x00cce7f47ba97f03,0x00f7207ddbab107a,0x00e79fd119909631)},
+  {FIELD_LITERAL(0x00ced980cc5e11fa,0x00afb1b527ee62bb,0x00a50522b0d92c5c,0x00a96cecf7a66d39,0x003f316a0113f3aa,0x00188d2db74a69e8,0x00239c6a983d3ab7,0x0011d99c6b088fa6)},
+  {FIELD_LITERAL(0x007a1bd7d68e927a,0x0052b5ac5c1b2fc8,0x004eba48b40e1718,0x00131b5d3db6b0dd,0x00c90e0d9bf1ffb3,0x006ebde2d43b8583,0x00ad09cf2471f7f2,0x00d07738575cd5c4)},
+  {FIELD_LITERAL(0x0079381086ce783a,0x00b4bd5392525cb2,0x00b3c340ef52517b,0x00de3e4da6d47112,0x007645f209de4a63,0x0087ac48ef732cf4,0x00fca493c78e07fc,0x001f12717fd8e951)},
+  {FIELD_LITERAL(0x00466b7cea97a643,0x00cde9d65ac5ebd3,0x0065a7a74e396dab,0x007a8933d3c622ee,0x0061b83f496979c5,0x007e5acd0cf0c735,0x00d5083c8e42b939,0x00b45e442a73773b)},
+  {FIELD_LITERAL(0x0053d652c9160224,0x004fac3d006b96d8,0x00a4d349cc0a44fe,0x0069675813df28fc,0x0064a747c8e70af8,0x00414ad36761de4b,0x00ecc3fe2799dec7,0x00c753137749f01c)},
+  {FIELD_LITERAL(0x00d80617fac4588e,0x00c6336b13d5cfdb,0x00c4cfec794c49a3,0x00d808be5c06a204,0x00a9201db05e68d1,0x00c458fe7b0640ad,0x007749ca2e2f743e,0x0097486b696b2e11)},
+  {FIELD_LITERAL(0x006d23d41744f8a0,0x00b060d01dcb780e,0x006098d67465d62d,0x002b374a5b242a76,0x00dc243e1b2ffddf,0x0084d84ddf4e927a,0x004c5f08697d629c,0x00ab50357e9743c0)},
+  {FIELD_LITERAL(0x00139a3e6538b47f,0x00956f84b45fbee4,0x0028de7022e0438a,0x0000cb422b0558c3,0x00b59fd14d228fac,0x00f76cee9982d805,0x00af0cf88b9a2ac2,0x0043cd0f8d519bdb)},
+  {FIELD_LITERAL(0x0023d589fa8a4fea,0x0046c76345e236cd,0x004510f803f212dd,0x007aa5f351dbff4a,0x005be63a60b394b6,0x0059db91ae971080,0x0002c52cfc133ee6,0x004e7d3ccc546c3d)},
+  {FIELD_LITERAL(0x0003e94e58d72e5e,0x00923f22309cafda,0x00b904b6915bd9a4,0x00cbabf37ae9780c,0x007b52700f6e242d,0x00d490088e45ff0b,0x00f198fad9324642,0x00af4e8a782f4a0a)},
+  {FIELD_LITERAL(0x0011256dab3a78f4,0x007f22855a28d49c,0x0058f881b4b86998,0x005b1e9b01ab7151,0x00089e7b330f1493,0x00a11639056ce202,0x00dcfd0698d30346,0x00c3523c374ad0c9)},
+  {FIELD_LITERAL(0x00c1d5f253eaa8e0,0x0000a7308a0cd196,0x00d3dcd909dc06cc,0x0003a14595841259,0x003e6cd45f993237,0x007f2bd94af2fef3,0x003d6dde3a9b386f,0x00397d2945a298da)},
+  {FIELD_LITERAL(0x000e7b4ecbb24da0,0x00eb44b274e12040,0x00e34af1ce171143,0x0002bd60350a81bb,0x0051f9b113c17ec9,0x00e1be337f04e66c,0x0078f7cd5afef328,0x00961b14cb7a5cca)},
+  {FIELD_LITERAL(0x00a9e8c2899c7703,0x0090d3404169e14f,0x003649c950565c58,0x007fea6454196339,0x000e07f8c0c06214,0x005a41bdfe6b8ecc,0x00f6626eac29fcb0,0x009b3f961c8c34e9)},
+  {FIELD_LITERAL(0x00679957b2e2cf96,0x00a602f3d07e7822,0x00e7087cf6e9a1af,0x00bd5c18c82a3d93,0x00337b2f3349cb5a,0x00437e3582a50dd8,0x00ec76a78f977374,0x00a215f145a712a2)},
+  {FIELD_LITERAL(0x00d37ea5f618cfed,0x00e9eee46b3dfb38,0x00013bd613709ae8,0x00bc263636fd5893,0x00b51022eda63d38,0x00fcf3d6f6fd2536,0x003e71131807ea29,0x00db83341ab291d3)},
+  {FIELD_LITERAL(0x00c810dbd3eb1209,0x007907305cacf292,0x00e289765fda416c,0x0091c869990353fb,0x008dbcc076d4ad8a,0x00467a10ea692c1b,0x00fbf01ad40f9b17,0x005702e805e2eedb)},
+  {FIELD_LITERAL(0x00e7ded4b493b8bb,0x0030e382acba1e5d,0x00ede764328f9b7f,0x001d60a5abf7fbb1,0x006503bcd5b845bf,0x00e6de0fd35fefba,0x009c0e0a5222f6f1,0x00b9288931d41670)},
+  {FIELD_LITERAL(0x00acb0631962dc88,0x00e4990ac75ff6bc,0x004fc95ee310936d,0x00b93343fa7371d0,0x000b615d4f570a5a,0x00ae711017abcd17,0x00a0a82986bdbd19,0x00fa7663c7289d2f)},
+  {FIELD_LITERAL(0x0054ae1d7206fc56,0x00e28d7692e3cd3f,0x009f607af8fa9bdc,0x00a25dc2cb57e060,0x009e1e9b896aa96d,0x00217e5d51fceed7,0x007f7451562381dc,0x00437d5e3ea63949)},
+  {FIELD_LITERAL(0x00518c87aa485910,0x00586c6a6c2494b1,0x00a9461ad16f78db,0x00d9a575e3aa2658,0x00ee46c1a25953c4,0x002dc705a56ddefe,0x009fc0f67ddea1a0,0x0071a7b5f7cc3ede)},
+  {FIELD_LITERAL(0x00cf67ede8636ab1,0x000edaffe34b90bd,0x00e5427f15234b62,0x007d001e859224ee,0x00db7f6bbcb5f5d1,0x00a92d031f2686df,0x0059d0edc5a608ea,0x00f50b57ca68162d)},
+  {FIELD_LITERAL(0x00897a51a5a6be64,0x00b0c16bc306ced9,0x00fe35bda240502f,0x00b911ff5858a703,0x002c73b56e928918,0x001c20596df32c5d,0x0029d5412ada6745,0x0085d80b7f40807f)},
+  {FIELD_LITERAL(0x0096dee673c935fe,0x00a6d8bfabafae00,0x000f614a457ae56a,0x00c260ba84bb5ac0,0x009e4925143502e6,0x008d73488ead261c,0x00a08818b6f87a01,0x00eeecdd0dfa1bce)},
+  {FIELD_LITERAL(0x001aa7dbfed14edb,0x007ba03b6047da3f,0x00bde65cf1ce0f6a,0x001232a9107eac0e,0x005cc541f3a99c98,0x00d480f238b0ba22,0x00ac03b472194c44,0x006b646fc7ccbab2)},
+  {FIELD_LITERAL(0x00daf0764cdc0d4e,0x0045e1533d32a333,0x0042b2519edc3057,0x003c8876b9e90003,0x004da1e9585dfc86,0x00ecf922876cda51,0x00693fd660c3de89,0x00439da78d1dcff0)},
+  {FIELD_LITERAL(0x00a7033c84a9bb33,0x00144ebccc1e0ff1,0x009d5eddb2aa618f,0x00fe506f5c1f3a51,0x003d712fd78ef874,0x00152993f13dad89,0x002740e1bc43ea4b,0x009ccf4c5a7e1fa5)},
+  {FIELD_LITERAL(0x00104aeea7e4c9a1,0x00cb9838d6091794,0x0076d1410d773973,0x00f7ca5b62467827,0x005206b8e91875ee,0x0099db003513f23a,0x001b745488c9877a,0x00e78188741eaced)},
+  {FIELD_LITERAL(0x00dd22630cd65cd7,0x00406050d2fa42fd,0x00f909068482982f,0x00dfc338f93cbbc7,0x004b70b44049ec63,0x00ae3c0d4f79c285,0x0072e80b94504e47,0x00e67e540ce3a857)},
+  {FIELD_LITERAL(0x0012a0ed57187311,0x006152f7fc245ce5,0x00d26b2acacd7975,0x005e71326bf6c2bc,0x00c5b24a23589e01,0x008b475e8c14aa86,0x00229116ade59405,0x003eaef78914c67e)},
+  {FIELD_LITERAL(0x002b783ab55b4cc8,0x000e3760bfb0ecc0,0x004e3add860653a4,0x002f385fe88447ef,0x00ab63d1947e1fdc,0x00a2e163a5b0997c,0x006ca7d4dcc0482a,0x006c93a67617b8b7)},
+  {FIELD_LITERAL(0x004917fc46b6cfce,0x0054dc935c8d56a5,0x00c4d110bd24cc16,0x008d5fb532bfccdf,0x0067bc32d4d59a80,0x00b9857c9782cafd,0x009c7016de878146,0x0072093b6a51aa8f)},
+  {FIELD_LITERAL(0x00f0d4561f83a717,0x00ea3d4df900432a,0x002386fc9f0e9f3a,0x0033989d0b793af9,0x00bf0b8af3b4a557,0x006f51f18165e5c3,0x00a48d3a362988e6,0x0017b76550d85988)},
+  {FIELD_LITERAL(0x00ba6294c93749ca,0x00310f9c80c24b6e,0x0013ab7ac1607be1,0x003f48a23f42accb,0x00660979f1c02389,0x0013bae682f46300,0x00505a9852f27f84,0x00ad3982d692dafc)},
+  {FIELD_LITERAL(0x002baa615d0241b6,0x00302b1adb80225b,0x00af388fc8dbe87c,0x003d2d04c1dc3f95,0x002f43bfb35db621,0x003cb77d3ee68f60,0x00e90b9c43eb2e75,0x0017e7f71ebafc91)},
+  {FIELD_LITERAL(0x0092481afc03278b,0x00eeefaa4620e9c9,0x009052a9b9fc02c4,0x00d74b63eab431c3,0x00f4564de6794d0c,0x00a8da9dbef5a89b,0x0003b5205866921a,0x001a472e88cacb5e)},
+  {FIELD_LITERAL(0x00d9c0c783110a08,0x00682af0ca4dda71,0x0031317c80ed948b,0x00eedf9674a8d079,0x000d7004c764a45d,0x00b7c6f70075b8ad,0x00866d958a6644c3,0x00d1116efb46347d)},
+  {FIELD_LITERAL(0x00e3377601a595ed,0x00c444eeec7b231d,0x00d5bac8f3797aac,0x00e8c934c15a5e58,0x00728ba4c378cc47,0x00c7ce1d3366d3a6,0x00b5ca394cb108a8,0x00c7bf33d2dfeddc)},
+  {FIELD_LITERAL(0x00e5f84f64fa6e80,0x0028f56d958b49d2,0x00e818d1406b6854,0x00811c7f66793a1c,0x009159f54e4d1f80,0x008e650c4be9055f,0x005c962ce192ba71,0x009ce422b407cd12)},
+  {FIELD_LITERAL(0x00a09677966feb28,0x004a6fcf064b452d,0x009cde2e50d4a5ef,0x00aa1f7d1113a3eb,0x007d3da2af516dae,0x00a3b6fdbba55f81,0x00c52fde794dd7c0,0x007f03946c22ad37)},
+  {FIELD_LITERAL(0x009c3b6f3eeacd28,0x00fd367dff0da739,0x006774a55ae5f78b,0x0080deb893fdefaa,0x00efba58127fef61,0x00ecadc22da35388,0x008c59c3d953dfe8,0x00a3ec66f0e8f28a)},
+  {FIELD_LITERAL(0x0066bca947f0c808,0x00f02e6325d101e8,0x00ee2bba78239106,0x0008e7902825b8f7,0x001ce4be17ce98e6,0x00c54e5246fe96e6,0x0058a68e1eac6524,0x009d9d2e8a2a6a74)},
+  {FIELD_LITERAL(0x003ff0290133f7a2,0x0033d164e638e58a,0x00a4f1a46fdfaaf7,0x00627476c47da112,0x007f426dd74a4522,0x00fd1c73032dabf8,0x00f051189cf04f15,0x000724eac23b1e41)},
+  {FIELD_LITERAL(0x0085fc210157fa1b,0x00de9cfb20db8784,0x00aab5e10051d75f,0x00d440414199c714,0x000a83a8d2ee885f,0x001138c4ad81d54f,0x00397bf7c3b15da3,0x0063e83387881e2e)},
+  {FIELD_LITERAL(0x0037a9079f60b2a4,0x000209c1a6ac74b6,0x00c8b9b771978433,0x00165e3553bbefd0,0x00aaf7089e6cb8c0,0x00db58335a9ee113,0x00353cd721481b04,0x005066d7d33df6d2)},
+  {FIELD_LITERAL(0x0068b159f281aa25,0x00f5dea5c3f92955,0x009f1defcfdae8f5,0x00529d703bbbb237,0x007bff6e889d4d7c,0x00c94fb0afa0a8eb,0x0051c1c898bb4496,0x0090e515fe8d88df)},
+  {FIELD_LITERAL(0x00ec762a9aebae6c,0x00944a52ddbc37e8,0x003211a0057bcc3a,0x001aff297f296b8e,0x005beafcf2f29577,0x002506bb9e066678,0x003cb45794106513,0x00c081883fa033ec)},
+  {FIELD_LITERAL(0x00c4ceeb316c3855,0x0086f422be0e3b76,0x00f1eca47d97efae,0x005316c72db1ded3,0x00ecf82d3dd8d1df,0x00abad273eefd104,0x00cda4137ce4be70,0x00322b35593cd5be)},
+  {FIELD_LITERAL(0x00047fb4eaf273f6,0x002c5e9fc5639d51,0x009fa24f7b500b2f,0x00542055ae8385d2,0x005d76663ba92f85,0x0091ae12a219edad,0x00c5ed6fa12dc714,0x00de749762c4befe)},
+  {FIELD_LITERAL(0x00e32e8dfe28a563,0x008d1e5b0324c557,0x0066ce1f4bff5ca9,0x00291be70cec4fe7,0x003c40765c9c6c73,0x0022a031f1275651,0x005eb866eabdedff,0x00fb646d2c825f29)},
+  {FIELD_LITERAL(0x00b9de2bde38f272,0x00f7a3cd3825885f,0x001da948925f5b1f,0x0076aced9ea448cb,0x00fe40596d6e3dda,0x00faa71baa77712e,0x0036f51e4e77bd53,0x00a5d5140fc95049)},
+  {FIELD_LITERAL(0x008027b03c2e7eb3,0x00a1bc154c26c8e1,0x0036740f277c5701,0x00592fe74ba3b46f,0x0076483fc3359aa6,0x005bb794e93b3ce8,0x00cec669ddb8201e,0x003701601e70db15)},
+  {FIELD_LITERAL(0x0094ca229f8c10ac,0x0079e281e10fc149,0x00b4585c66fe2b62,0x00eaf8d91b499a2e,0x00a01851c9cb0bec,0x00fd36af6b3678d0,0x002700dd909d5d9b,0x0067d454eb614b46)},
+  {FIELD_LITERAL(0x0046290ed6d2d339,0x009b1a90f6fac045,0x004b58aa3b55c026,0x005239d6c4413d60,0x00bf9b6c66aa17cc,0x007c6d8f4fc90795,0x00007980bfa0df48,0x002e87c16896ff6a)},
+  {FIELD_LITERAL(0x0077657b02607236,0x0077f569157227f1,0x00c4e15a878e0f40,0x003fbbe304ff6440,0x0003221fe292c35a,0x00c11a6c8c8ece9d,0x0051b716186b1d8d,0x00c011b7c1c12a90)},
+  {FIELD_LITERAL(0x000db2a213f43ca5,0x000d85b6ab2cbf9c,0x006d7ddf85ff51b0,0x00f1c1a9df68a42e,0x00ee5df9425e9bb2,0x00d732169b9eab1d,0x0097ffc2a7168a44,0x00a3f8b07c9a1b80)},
+  {FIELD_LITERAL(0x0024ff7f5b23635d,0x00856b96958de106,0x00b4486fd745fb6a,0x00d1827967c090aa,0x00fcb2653234e1a9,0x006c37a0c290ff3c,0x002e50a822a238b5,0x00d67084251a96be)},
+  {FIELD_LITERAL(0x000377c1920a4282,0x004915a3db4767e0,0x0046e73f9b0b9afb,0x0065eb9eca72f3e4,0x003da065935de0c8,0x0012409274297fb6,0x0050b086df96044e,0x009560ae65f1aa86)},
+  {FIELD_LITERAL(0x00ca2dfad83b8731,0x001cd4a96c70653f,0x00db372104c204f9,0x007969a72ae683d8,0x00be9aa838290728,0x0039f968de88b102,0x005123198d60c855,0x005813455e8ace7f)},
+  {FIELD_LITERAL(0x0098a52274a3f2bf,0x00cfef6ffba50eae,0x00c3c80897d80f7e,0x0077918f53f7256d,0x00b3760d16f5419d,0x001a4cc4ea0ee293,0x007b820f7a8cb0a9,0x00ae196b3107d8c0)},
+  {FIELD_LITERAL(0x00bc85c966a4fb7b,0x006bc744e912d862,0x0092cb87ae66a9eb,0x0080c518bd418b14,0x006cd02f79e2e2a2,0x007723fac0ce9ace,0x0081e7a8386bce3f,0x006714d09dca97d0)},
+  {FIELD_LITERAL(0x008bfd941de05bfc,0x00505490397a0a10,0x00c58b51d86e9d5d,0x00dbb4259c8e6367,0x009c8926c8914957,0x0081d18109edabae,0x00ee795b6c140e2c,0x00914b29b1157b23)},
+  {FIELD_LITERAL(0x000ae4aca1a49a45,0x00cb217b25318683,0x0084ce3427a58a17,0x004a6f10d15aa8f5,0x00500cac24017903,0x009ad2dcc9cd2608,0x00598fae0f447602,0x002fb93728d765ad)},
+  {FIELD_LITERAL(0x003f230dc469ba1c,0x00433e3d322be5e1,0x00a68d4c4b554cec,0x00e4d339d6aa519c,0x00ac77c4fe8940c8,0x00009004215bf3ff,0x006b1e365df6906b,0x009946ee47ce8f4d)},
+  {FIELD_LITERAL(0x00dd66177d765963,0x00dbb06742512816,0x00251060534c6ba5,0x00d0d1d9c9315b1e,0x004aad289458c501,0x005f2c077c85f61c,0x00d75166fcf6391f,0x00742db1c348bdeb)},
+  {FIELD_LITERAL(0x00e4c92441efe81d,0x006b90107b88d8f4,0x005dd2ea41a6c7d7,0x00f4d13586ea62d2,0x005cf948a32abdd9,0x00799b95d01ef183,0x00950a46f087c105,0x00abc88919e3b903)},
+  {FIELD_LITERAL(0x005f4df426c9ac0b,0x00b3226aed7d01ad,0x003abf208e064a89,0x00e0d32f35727344,0x00956ec445734dd9,0x009cefcb57bab1da,0x00d2af063b1a9540,0x007f573d283d7d0a)},
+  {FIELD_LITERAL(0x0004fe396629287b,0x004039471051fb61,0x00959d8a052cdcec,0x00f08cc83011f06f,0x005c5428b5a7053a,0x0009a6940c65b2fb,0x00cb11189b76eca6,0x0005a14001f110e3)},
+  {FIELD_LITERAL(0x004225db835a5ed9,0x009d422fbe0446a5,0x00c2ba701500b014,0x0073115d03f406ed,0x00ac3cdc6dd87592,0x0023c5546611de30,0x009cef618a5cf01e,0x005bed8ce61b7771)},
+  {FIELD_LITERAL(0x00e9979ea65b65b1,0x009c32efbcb533b4,0x0040b0d9274f531f,0x00deee7405b1f9c0,0x009106616a255978,0x00562dfe8ca93bb2,0x00e804a74fa3bd08,0x00744a1d18435a4a)},
+  {FIELD_LITERAL(0x006a395fef395487,0x00a5f954d17d0305,0x0081895d265495cc,0x00f413c092176ff1,0x002368f0088b9360,0x00c998dc867bec30,0x00674dfcb623d302,0x009dc2204b4ec469)},
+  {FIELD_LITERAL(0x003a4c97cd0d2c69,0x00a73aed7fcd8d89,0x00603086a09ebc14,0x002ee754a7a64e2f,0x007105244b46ebdf,0x002c3bcb875fb58d,0x007997e43555a387,0x0068653a74c53b9e)},
+  {FIELD_LITERAL(0x00dabcc1aa0db6dc,0x000cfa3cfbac5f82,0x00de8dc196cdec63,0x0051674168cd1198,0x0027a636b1af2259,0x0033561f152736fe,0x00bd2defbd7c003e,0x00c196351e0f9e23)},
+  {FIELD_LITERAL(0x00f21eaf05ec3b1a,0x00b794a17a793900,0x00710e25836f30d4,0x007c9a615b4b2581,0x003284033bd3d774,0x004127a9eb5c944b,0x0014781dedcd7ae9,0x00c3e6c60582b83f)},
+  {FIELD_LITERAL(0x002ffa00076b23e7,0x00f27eb05f991758,0x00d211c4271931bd,0x00f6abcdb8472c0f,0x003d14839c006340,0x006a6e5201a58dae,0x0017831b3b1c4558,0x006dc8dfd2bfbd16)},
+  {FIELD_LITERAL(0x00c31ec99e5c6f86,0x00e7753189a7b9fd,0x00e3b88a004ba93c,0x008625241b948400,0x00312e2fa1596d7a,0x00134b01dc1c5f01,0x008f6ed7c9bb4fc8,0x0028682dd25d55d6)},
+  {FIELD_LITERAL(0x009e22bedea6fe93,0x00c5f975f40ae722,0x002ac25da688f3d9,0x004bb80d5bd5bad0,0x000e6b09792ccccc,0x00f2e2485a0c241a,0x0060d9413b5591d9,0x007c69c87fd4754b)},
+  {FIELD_LITERAL(0x00d7d8de840dfab0,0x00d4554aa2fa5d91,0x00aea49b5902ff98,0x002afab6ad6ba38c,0x009008c5c1e02d0f,0x001f9272641c6f51,0x00135c74601801da,0x00cd5cd57191727c)},
+  {FIELD_LITERAL(0x00fa322198872c6e,0x003d2f4a110f0246,0x00f8c521240dafc5,0x00a946c75b9128b5,0x00cca76ed1a3cb05,0x00bd5d0f969f1c30,0x007cc864f28c306e,0x001a928ac19e5096)},
+  {FIELD_LITERAL(0x004845798290842d,0x00d34f4bc9a86054,0x0006e11e533c5fbc,0x007f6bc118ec56de,0x00b25b2ba6da5667,0x00b3cc196a25de53,0x00b9816742ea95c3,0x001b214ca4b0a095)},
+  {FIELD_LITERAL(0x0006444d60e2bedd,0x0088779740d3b04a,0x00e69b27b5c3f891,0x00c56811738f5d73,0x008acb384d7c31c9,0x0087c7265445c060,0x00291bddc41b26d2,0x004beb1b80dabba3)},
+  {FIELD_LITERAL(0x00766f4c10e63867,0x00d46a59c73d8887,0x0029114f7aaa6067,0x00610f655ef22b45,0x003d449a33a42319,0x000a4f863e7e77f1,0x00a03067c7283916,0x00709bb66f8adb08)},
+  {FIELD_LITERAL(0x009e361869563d96,0x004f150a2922fadc,0x00ad535fc84c6900,0x00da508626a54a0b,0x00a94b10ff3e9152,0x0050cb1d38e0a3fb,0x004ea94a986146dc,0x006ffa29abc53f64)},
+  {FIELD_LITERAL(0x00d123ae7e3af653,0x00a0957cb9dbea30,0x007e3da43f43b702,0x0068b191ed7a695d,0x0043d320b75e3d33,0x002061c32caecdb8,0x00f876c45e7b6b32,0x000af9db43920399)},
+  {FIELD_LITERAL(0x00fc79d49ca903c3,0x000a9449aaf56474,0x003bd709e2f39a4a,0x002fcee80b8a8733,0x00b90fb3b737b015,0x00827ab1df467da6,0x000c45fa1ea53b80,0x00715decfb14a338)},
+  {FIELD_LITERAL(0x008432f1aa65c400,0x0066af8401cf123c,0x00380199e72e3fae,0x000f848122c86468,0x0041d90c1d203d59,0x00e3813f3e9dbd23,0x007e6b553751bbfa,0x009857b06b46d8fc)},
+  {FIELD_LITERAL(0x00abbdb352c9e79c,0x00beb4f609e19036,0x00f1623caac96dca,0x00ab2e0ea612ee4c,0x00f7afc0c90cce79,0x003f1b5254a6f248,0x0080bf4a9448270a,0x0056382e6fd2e670)},
+  {FIELD_LITERAL(0x007a60cbc88cd30a,0x00e33b56631d7394,0x008979984de3472a,0x005782feef9ec8b8,0x0001a1fb97f5f209,0x00bfab37f96ea9db,0x00d4d1831dc6fb1e,0x00a84a1e9b13f42c)},
+  {FIELD_LITERAL(0x00532685a930f072,0x00e9851cea7b395a,0x00938d6066df60f9,0x002d286ec5873683,0x00fbde6105ba7190,0x0010700ff773391d,0x00205d9c5dd60c0f,0x001006975990ae37)},
+  {FIELD_LITERAL(0x0007721fc416f824,0x0082526320d9a4ea,0x00734eb34e4856cd,0x0070e25321f46ef6,0x00af0ad68b873ce8,0x00e18325ccde2442,0x008ef573f5bed360,0x000659e148091754)},
+  {FIELD_LITERAL(0x00c1ef8173043a1f,0x006685f66400a56e,0x00d3677c2fe803fc,0x008d85bc34cd092e,0x003bfffd83af4b0d,0x005b2555b0679572,0x00b4b556a779682d,0x0089dce00c80081b)},
+  {FIELD_LITERAL(0x0027aef714ca1d9a,0x0038ea3f889b14fc,0x0085b0e27599ae32,0x006d18b3193ecd32,0x00e93076bdc64430,0x0005fc2de91320ef,0x005abf0ede2dfbd6,0x00de96bcf3a995ba)},
+  {FIELD_LITERAL(0x0079742802fbfb1e,0x00777e30cdcbe975,0x007b6a4382f9aede,0x00dda207eb0ac0c1,0x002b1426d2f22152,0x008a8b1a3fb86433,0x00f114cc3716dc46,0x00fee7199579e737)},
+  {FIELD_LITERAL(0x00dfcbfa187e9c79,0x0048343af584935d,0x008a722ac55ca742,0x00b0ca2d776a36d9,0x002bdac65fc47e66,0x00a77e0b725230b0,0x00bf2244c0b5bd87,0x005aa917358493eb)},
+  {FIELD_LITERAL(0x000a528c8507fc44,0x00a720d4ec77a8ca,0x00f1821ac32177e9,0x0007c1ee5d767bd5,0x00310503634afcbb,0x0071ecd998a47d76,0x004563a564780d2c,0x00538177331cd7a7)},
+  {FIELD_LITERAL(0x0070f4586f5c8111,0x00bafe3efbab2a5d,0x0080ed90ed5b87d0,0x008777fe7230d29a,0x006a66cd717ac7a0,0x00991967c091974c,0x00a0c71155e0a14c,0x0094d0c52eaba618)},
+  {FIELD_LITERAL(0x006138125976a082,0x001b19deeaa5e9fe,0x002460997d3b36e1,0x00a92ae6e2d79f4e,0x00deeeca4c2de9db,0x009c218216dc46b4,0x00e664cf74d19255,0x004fcc771ce49ea9)},
+  {FIELD_LITERAL(0x0053f9a7db0626c1,0x00bd99ccdef67c6c,0x00e425f455073fc8,0x00e078da6aae1248,0x00bf439b34b8b709,0x00e050941c80a638,0x00b6a20277211715,0x00f638aa23a16a3a)},
+  {FIELD_LITERAL(0x0005b538b46c6c95,0x002426e32e32b65b,0x00a64419e0578128,0x00c5aae0b967dbe9,0x002e74d288f1824c,0x001a68fda10e807a,0x00aedab7b9e20a68,0x00842c980107aa82)},
+  {FIELD_LITERAL(0x0037bf8cb6ae60d6,0x007767eec0e2c836,0x006cc95ae416f83b,0x001d3799e0964a3c,0x00ac086e968d1f1d,0x00980e17a9549183,0x00a9507d548c71f6,0x0054d21b6fbc03f5)},
+  {FIELD_LITERAL(0x0003451a4b43388a,0x001a8b5712a43a66,0x00a7b2db33694003,0x005be8a800314663,0x00c6ffb09042029c,0x00d40d6a589dd672,0x00ba4781b78d29cb,0x00ad75488c3a3ee9)},
+  {FIELD_LITERAL(0x00f8211c3e1d2991,0x00a49de39830ac16,0x00426ccc872c2d45,0x007606042a90a83a,0x00bf5edd7bb9d11d,0x0033a4c7c1ae9c5d,0x00ebd48137d9453c,0x004d9c0f3654329e)},
+  {FIELD_LITERAL(0x0097c8003ec8aa95,0x006bfa27900afa8a,0x00ccc82ff435b478,0x0056b4436b805bc5,0x002e26762f58f8ec,0x00d53b27a506f4f9,0x00c2d90617b10a4c,0x00d406348f09d082)},
+  {FIELD_LITERAL(0x00973180d5e1c070,0x00a851d49f78f3d3,0x00214e597771289d,0x0080e930d030335a,0x0001ac41ab3fd5cc,0x00a831b897113f46,0x003aa950aa169fe5,0x007ee05d54b7f5b5)},
+  {FIELD_LITERAL(0x009090b2a2cc9ba0,0x009bef65fb44aef5,0x0025278842fb4ffd,0x00b76d924b206597,0x00d97144291b540e,0x00bc903c60722ef3,0x00384fe8c3ba1b58,0x0026b102827d51f9)},
+  {FIELD_LITERAL(0x000b908ac6dd7305,0x00b927f416510049,0x00ecce8fd9798f1b,0x00db2dd5f522f661,0x005a8c384e84dc7a,0x00e2af38cef0dad8,0x00883674cc0e01d5,0x00dcf556364b9a61)},
+  {FIELD_LITERAL(0x00de90caf1fd2ea9,0x001d5e4fc216b1df,0x00b4843ca51d6610,0x0033a70e0878eb03,0x00d0b17c17dc650f,0x008dba7ea2d13f66,0x00dd9b1ec09027ee,0x006fb66da82d0d6a)},
+  {FIELD_LITERAL(0x000e488c54dd9e3e,0x00f57cf050e74117,0x0095083a261b5005,0x001d0a30cbaf228a,0x00ffa6875d005e4f,0x003a9cf541a460f7,0x00ac22ce9585cdb6,0x00da167388f4e8fa)},
+  {FIELD_LITERAL(0x00c938b394ac59cf,0x00c184c2f03c5eef,0x0028cd6df928d3d0,0x00c0d3d20c481b4e,0x00ff22c70c9d7db3,0x00ce0da837afd484,0x00335b5a2bbd54a6,0x007ba945ff486a3d)},
+  {FIELD_LITERAL(0x00e754309c95198a,0x0026a7308f512ace,0x008e3d37e8ca8dbe,0x00288532cc950082,0x00daf1ac33c70d6c,0x002566180d5f9cf7,0x00b6c309269462c4,0x005eba17818a144d)},
+  {FIELD_LITERAL(0x00d033459c248b7c,0x0083cf004d0e6316,0x00a22930861f1a42,0x00a951eca82fb546,0x006719424e86ed90,0x00038b94fa72a6d8,0x00d9daffa22626b3,0x00d2df519298a455)},
+  {FIELD_LITERAL(0x0012393a5c9e6382,0x00b55d47dd43c5ad,0x00890490270a8f3e,0x0085155e81064ff7,0x00c38d248b417d04,0x00787a9520ec46b1,0x00f0014498473383,0x00b3a369573e7835)},
+  {FIELD_LITERAL(0x001d21644f71029e,0x002f6d59f6d836f3,0x0066595b8fe9b886,0x00bcc90bbb47ba3b,0x0098ead5b3e5aaca,0x006ae0ef781a8579,0x00f762fbacb1e267,0x00f88983593058f7)},
+  {FIELD_LITERAL(0x00818cd339256a75,0x00f683a967d57297,0x0084f8cf9b65125b,0x00a49c7340719b28,0x004a0ae3358fd736,0x0098f03b7897095a,0x004d6b41002cb7ed,0x002cda749762e610)},
+  {FIELD_LITERAL(0x0065422b5eecbd34,0x00002f59cf8867c9,0x006b10033f1a3f50,0x00cb0580dba7e3a6,0x009300336febcf76,0x00d0ea97738b4442,0x00f46899112ef30a,0x008096140b1efc8e)},
+  {FIELD_LITERAL(0x00b9371be358f1c1,0x002b7a91fbd6db44,0x007f1b60f88f938f,0x00357cc3b8a4d4f5,0x00491b366ff07961,0x00ab3fd0ee8a1fa0,0x00ba14f7266e2678,0x00bd43eff7e7b989)},
+  {FIELD_LITERAL(0x00b481d655e912af,0x00061322822bae5a,0x00689f0b6e7e992e,0x00f08e97e0de5d90,0x0014986361e89c1a,0x008d9edf2e68281e,0x0090514f2956e95d,0x00768ab931eea60a)},
+  {FIELD_LITERAL(0x008c51caf4dd303a,0x002caa479e9ec591,0x0042a243bd38158d,0x00de580b52857e18,0x00528501112d3c88,0x00f5005d3c91fb49,0x001fce6c74d9d322,0x00f9f454cbf15cd9)},
+  {FIELD_LITERAL(0x00f0d6a97a43c684,0x00f0b96d352e714b,0x000a4400a1f86c05,0x00ea785b3480795a,0x00772efb6a5d9560,0x00596c3fe8cf5801,0x0047f59b58b979cd,0x00e098242c194d40)},
+  {FIELD_LITERAL(0x00270f9b76ff48f4,0x0071c8d9ff31e045,0x0015886d725ef693,0x00b16f092127e171,0x0023193766fc7374,0x00796a014f9d0f0d,0x00cdf958c459665c,0x00524299f8fcb4b9)},
+  {FIELD_LITERAL(0x00db4038378e5c8e,0x002c8746c249dc23,0x00149c6e569596ad,0x00f13596e5445f54,0x0006e54cbd714019,0x007db2a1e3328648,0x0088a9e288901c18,0x00d8913f79954d58)},
+  {FIELD_LITERAL(0x007b474ac858fbd0,0x005892a49e43419f,0x00c4d11897a35de8,0x0060c09ac48c17dd,0x003dd9bc36e16893,0x005ce05816c48b3e,0x00c975e6e1e9a591,0x00c2a35c5d728e25)},
+  {FIELD_LITERAL(0x001d62f3e2e42939,0x00aaa235b18b3c3d,0x0030a4daf71d49f2,0x0094436ffd146248,0x0037fab30e554797,0x00e623f654c3eec1,0x002bc6166fbe7e21,0x00113ce765280734)},
+  {FIELD_LITERAL(0x00733328294eca66,0x0019251ea746944f,0x004c6d1eeed2bf0f,0x008ed074101315e9,0x0024e81efe6feb50,0x000e4e25226c83a4,0x00ab99284bb15ea3,0x00437a573acee951)},
+  {FIELD_LITERAL(0x00c10f96bfbf0efb,0x006b32720ee53df0,0x00025379ae469fb3,0x003fdd6b49e1c347,0x00f47e1f0b07f5ed,0x0079753f3cce5839,0x006a42b8b6232301,0x003205a8078bcea4)},
+  {FIELD_LITERAL(0x00b4578b254b4285,0x00e2ec803bba2aae,0x00c1f3513a77fd9c,0x0025ef2e97c0550f,0x002d50756671e494,0x00ad72d63d315364,0x00cde4868e2c568b,0x009f92f8d8ccb1a9)},
+  {FIELD_LITERAL(0x0040a6236f8214f0,0x00c13fa4fc1b40a3,0x00a62de2e0042e71,0x00d1900b58184dd9,0x008c7d78b7507e8b,0x00e5f649c6700f0e,0x008f4de9dfa8409a,0x00ac98a819606d85)},
+  {FIELD_LITERAL(0x00f11f85e96dd3d6,0x00c03196815ce848,0x00dc61647cceb52c,0x0014e3f9accf27ce,0x004706f8ca54e83b,0x0025d3a6f0872d72,0x00f93bb882df354f,0x00fcd2041b415cf2)},
+  {FIELD_LITERAL(0x00fe82d67b623aca,0x00edf606022a12de,0x003383d801bfab9f,0x00122f45effdb31c,0x0066f422a012da93,0x00b2722b4e277f2a,0x0026f7dc163748c3,0x00f2861d066b936d)},
+  {FIELD_LITERAL(0x0046efa47e386e40,0x0024e3adbdef4092,0x00c0392512684482,0x0061ea4b25f0db06,0x00bfd358e8d9f2a1,0x00108becfa3fe2d1,0x0074851e44a643b4,0x00878ff86c4a6e5d)},
+  {FIELD_LITERAL(0x003135530fa5ba46,0x0021077016223c0a,0x0079dc7572a9da04,0x00e4b1f07bfb9939,0x0030c5d0b14ade90,0x0032bfa35352e2dd,0x00e7a61843c37777,0x00b83576ff54ee19)},
+  {FIELD_LITERAL(0x00e6ef26c1f2b91a,0x000212df8f0b614d,0x00aac5a4580489c1,0x001ca83c4a721c71,0x0078f19a9802a97f,0x0082faf545a8cd9a,0x00ca6d08e8dd7298,0x002e208acec35ef3)},
+  {FIELD_LITERAL(0x002bab2ee6d8b65d,0x00c6f80c87e98f52,0x005b327e7d4364bb,0x009eb3842513e55e,0x00096bd57cfd7796,0x004114d6518e3e2f,0x00bcfb37db2794ea,0x0009619bfbb5de58)},
+  {FIELD_LITERAL(0x002be99dd8562d9e,0x00e4f084ba019b35,0x003a687a471580da,0x002170c5ffb9edc5,0x00c4f9ed322acfd1,0x007a0686aad65e34,0x00f639398160accc,0x00645026d84b2c1d)},
+  {FIELD_LITERAL(0x007f32ba1ac998cd,0x00171912fada070b,0x0085bc5e59e89394,0x0041d6d8eec9ecc3,0x00b4afff41b64111,0x0039e233b74c5a4d,0x00b471aec6863913,0x00b8bd492f5cca26)},
+  {FIELD_LITERAL(0x00fcd2e97bbd8e9e,0x00dd6c56ac78e087,0x00e4bd5d161a6e5a,0x00846fde8b20b98f,0x004f7ea865f362a7,0x00c48872e2dfe0af,0x009ed489b97cd2ca,0x003edbc6fc30a663)},
+  {FIELD_LITERAL(0x001c5120e76c37b3,0x00dd35c7fa3b87ae,0x00ef99f465202927,0x002708256dc195ec,0x004db1aa44bea045,0x00a956bd511c682b,0x00bdbb01caa76388,0x009dd929979a0862)},
+  {FIELD_LITERAL(0x00b400cb00f6ad18,0x00e863d81a2622ab,0x003fd072702dd6de,0x008a1225995caaeb,0x0092a70bca298294,0x0041cc7a129d2a2a,0x0030fcf51de8e61a,0x00b72fd5f42c31ca)},
+  {FIELD_LITERAL(0x0069f7a03c13f6db,0x0008346297c0a37c,0x00543659ba6a1f1c,0x00ff23d4805494a6,0x001fb0060b2dbd0e,0x008315cb8b01bf67,0x0036fea886e9adb5,0x00c16eb0e60087e0)},
+  {FIELD_LITERAL(0x00281fd08d188612,0x00a08d82fb45a3bd,0x00fb016bc5064bcb,0x000eb9a757911d84,0x001ac234e1946ae4,0x008fbb3d68cadc32,0x00688db6cb5350b4,0x00d975eebc0a995f)},
+  {FIELD_LITERAL(0x0015cf2a49e33c65,0x00247547e66b21c4,0x001aa172aefe7a74,0x00dce421e0a721c6,0x00d4e0daade5ba99,0x000dffb85a0da8fd,0x00e81b6bc1220136,0x00385b4c6609eabb)},
+  {FIELD_LITERAL(0x0042ff8ca4fad2c5,0x00c4de63f426154a,0x00cbdd4489fa5549,0x003719f3245e77a8,0x007bd91ae0d06c14,0x008ee8bc955df24b,0x00fa2f35680b97eb,0x00be6aeebaa4641f)},
+  {FIELD_LITERAL(0x003d19e015ea7f0b,0x00c2121b3733b7d3,0x008fa48412baf42b,0x00fbe251f6e634cb,0x00fa7d4782a8549f,0x001e39896dbfc450,0x004eace62a75f10a,0x005dee73ed6d9dd7)},
+  {FIELD_LITERAL(0x00bf1ec6925cd9c0,0x0086cdbbfeb8f292,0x00fb44ce6bfe801b,0x007019d87a39cee0,0x007073d1c1070ab0,0x006a193305a4572a,0x00e2a0ff658641c0,0x00175dc94a9a8874)},
+  {FIELD_LITERAL(0x00459f03d208cec3,0x00fc0a9cab11e103,0x00a923732e57f18c,0x00544aadaba7aa36,0x00efadcdc32b89b0,0x005fa3fee12c7c6b,0x00ab38fec4e5f497,0x005e1bd22f1a35be)},
+  {FIELD_LITERAL(0x00efdbd694b78cc3,0x001d5cf68977bc22,0x009d5d9a6c408259,0x00851a5a4044bc7a,0x00239d8e0a4ba52b,0x000c08aed4959c2c,0x003bce6b3ff5f5de,0x002b6a1a35ef58a7)},
+  {FIELD_LITERAL(0x0059e29893e478f9,0x00f3fd4e7db90e1c,0x00edd25a08c368ea,0x0036cf719dbb3dd3,0x00b516d32dc09be7,0x00620f5d5434dd63,0x0009b0346e549737,0x004a37044e0f34e6)},
+  {FIELD_LITERAL(0x00c98c24bcd3de4a,0x008081d729b00b6d,0x00c1607d421168d1,0x0091b549a57442a1,0x00ee286138a7d589,0x00b69b993fee96da,0x0004432d96009772,0x00ed3b6cfefdce31)},
+  {FIELD_LITERAL(0x00d268ed28f71380,0x009d851740d7852e,0x00c51f53665543da,0x0058c5efb85cad65,0x0006c7c26abace0a,0x005cc60829589122,0x00e8f00cc9411059,0x00867c1c8f11ab5d)},
+  {FIELD_LITERAL(0x0006298c239352e8,0x0007bc23f1496316,0x004cce0d8e6ced8c,0x00c796b6dee7c59b,0x00fbe6049c6ef8dc,0x008445cb99450d58,0x008fb628882b704f,0x006826a745869f92)},
+  {FIELD_LITERAL(0x008980e86ef85457,0x002fa79b4177cf5d,0x00a46807055ebf17,0x00f0530be52098f9,0x0038744e97d21974,0x009d27814255f79e,0x0053b155f5443e79,0x0027e22bd0de8548)},
+  {FIELD_LITERAL(0x0013999958544cb9,0x0040fc15fe65b75b,0x003ddc3de129a7b7,0x000c0a7d811dab49,0x00e8395ab277171c,0x00efcb0d863605a4,0x0014ad09099e2c2f,0x001fad67d2570296)},
+  {FIELD_LITERAL(0x00b6363f087e3032,0x00cd400648f241a9,0x00c079c4431608c3,0x009bef600b03a7c5,0x00d84a42a374f922,0x003c965e2a7bda6b,0x0060677605fd766e,0x005b3840f77f17dc)},
+  {FIELD_LITERAL(0x0064c8e42bb2ac71,0x0054b182ed6f6690,0x005f1df3c0051721,0x002c6a60a4e6fa1f,0x009724c48a3e8adf,0x009d59c6d6fa0fc3,0x002f6ccbbe1e301e,0x005fc2b4c2ba05fa)},
+  {FIELD_LITERAL(0x00837dab8c7a1ea9,0x00c656fd8a5351ad,0x00d666a2ad040b8a,0x0006f1119bfceadc,0x0018acfb92fe0a02,0x0047a553e1f9e203,0x00d804b104861154,0x00a9e7902f88d1c7)},
+  {FIELD_LITERAL(0x0006b8e06f3885e7,0x002a6e17b9f5941f,0x00caff7d6587bb4d,0x001b7de31cd0cc2d,0x00c3b9c3c4ce663f,0x00ddc6bd647c5a76,0x00d3f4f51a66037f,0x002d04b16126a9fd)},
+  {FIELD_LITERAL(0x00edf0d9fba06929,0x00dce37da6c8d386,0x003d6c93c4b769ec,0x0020cf52cb262dcf,0x003ac48e5ea73400,0x00fd276611b0581d,0x00d3a199a9fd80bc,0x0041a750b96c9bad)},
+  {FIELD_LITERAL(0x00f0980600dc7628,0x003246d5f7bf2fb5,0x00db5c57f3525efb,0x006ef656bdf6a8cd,0x0069da18fab821ac,0x00fb2a712fe5c117,0x00f7f6d016c65de5,0x00b3b0b849182a5b)},
+  {FIELD_LITERAL(0x00e32c4af9350efb,0x0038c43a607b42cf,0x006621a5c095a323,0x00a7ac037be8dd50,0x00a26e7d6e299f7a,0x0058888e05bb1d7c,0x0045df569d37cc6c,0x005e3964309b1352)},
+  {FIELD_LITERAL(0x00a5fa1e6f7f3520,0x00ca31bae1986747,0x005a49561c171041,0x00bac006bcd7304a,0x00a348df03ae179f,0x00248cfbe2805de4,0x00fc1513bc26d206,0x002aa3bfc7b4de8c)},
+  {FIELD_LITERAL(0x00e9b5a693c3532d,0x008208b0279de7df,0x00c462dc465610b2,0x001ec036f18d315d,0x00fc3f49b4019f3b,0x00a3561dbcec647e,0x000b9cc598386d60,0x004196e5455acf75)},
+  {FIELD_LITERAL(0x001b5c55a6898c06,0x008682d4248a3835,0x0078313deab24248,0x00e45f03cc11c312,0x0047dd1671284239,0x003f5446055c2cfd,0x004a057262b90f7c,0x0001a1fc8996d797)},
+  {FIELD_LITERAL(0x00a070f267d7510d,0x0044e2156af66002,0x00be891d84bc70d6,0x00c87c18ebe36acc,0x007878dc62bfc095,0x00f580fd575a3bad,0x00834cc60bed26e9,0x0052e47bbcff3ba2)},
+  {FIELD_LITERAL(0x00418db3704c5250,0x002d93ecfd5c4fdf,0x0031c3483f19c1c8,0x00d94b3866dccf9a,0x003a0746979fabe3,0x00b3498c58039575,0x00fbb71a195e049a,0x00d797aea9a7e598)},
+  {FIELD_LITERAL(0x00e6f82107f4bf1b,0x0095a02659d81853,0x00faf4dfb610f3e0,0x009296145ae35397,0x00edebf49ae0d057,0x007b7fa0928d7eb5,0x0085adbcdff0f13b,0x00e355791fadf4b6)},
+  {FIELD_LITERAL(0x00a922e7cdf058b0,0x0009dd241f27fab8,0x00aa96b354aeeed7,0x00367c3e6f2927ac,0x00f9f33509110222,0x00e43958325b86b4,0x0065477c37e905fd,0x008efa7e50d31c98)},
+  {FIELD_LITERAL(0x00ecb7525f78f3e1,0x0000b201cacfe369,0x00b08439ec419e2f,0x00fe448c8659a283,0x00f22b6da5e93aa6,0x0068997e29c31bc3,0x00c3ef5812fb0a13,0x00c4f78c0c2929b3)},
+  {FIELD_LITERAL(0x00590c10ef40fd61,0x0043c1fcbd6f7d0c,0x007fa8c8b62554d1,0x009c5adb890a8390,0x0009558152bf92e6,0x009f5cffbcb76826,0x00bd6f5261ff49c0,0x00acd69157ed6987)},
+  {FIELD_LITERAL(0x00c3494e39179d2c,0x008e5f6a68a4270a,0x008600e541a7bc00,0x00d01106170bbd49,0x0099e42f48150f48,0x00b65548a973d627,0x00d816d6b7c4247d,0x003805ae902ad7b7)},
+  {FIELD_LITERAL(0x00366dfee007e656,0x00541df9d26d188f,0x00eaa96ea3f117fc,0x00117da937e5acfe,0x008842c17ddb0169,0x00dda156244a29e7,0x00ef129e64d98ade,0x001f69df58cdd772)},
+  {FIELD_LITERAL(0x008d24cde36b22ce,0x005b53747f35bb4f,0x001b6cb937069c0d,0x005088dbe2569768,0x002c8b86db571bab,0x006c00327d80ef34,0x00a7b9750aeb0497,0x009678bde3a33312)},
+  {FIELD_LITERAL(0x007185dd4ffd6044,0x0072ec328c4f780b,0x007af12e3fadf0d1,0x00d67bdc0b2e75a1,0x00cef40e81a588ed,0x008e6cd831ce9871,0x00125c9fea116d73,0x00dfa0aa325ce50d)},
+  {FIELD_LITERAL(0x00d47e6ce60f7e4f,0x00b7b438a54efa13,0x00c23ef25f244d08,0x009f41f937434128,0x008981b559effa62,0x006b79d40825e717,0x00f48edab18ffb41,0x006bef8feab5cfa8)},
+  {FIELD_LITERAL(0x0011b15f336739b4,0x006f3f15d8043c9c,0x000b25166b265e9f,0x00e6707726aeb282,0x00462723cc6db30f,0x007e80147f1f9ddf,0x0018e021798de151,0x00a061a7674a1ddb)},
+  {FIELD_LITERAL(0x00d8d4e76b1aceeb,0x00acd1fcf8f50cce,0x009a5329b8b97b18,0x00b94546c8b1da5b,0x0085e62670d6f875,0x007771323ded20a3,0x0010952bba8ae026,0x004672011366de1a)},
+  {FIELD_LITERAL(0x00175e28ef237779,0x00e8744ca95d06d7,0x00856869a447e541,0x00a7df5ff638890d,0x00f4caa38020ac01,0x00ce2ef19cef1509,0x00279905f9b4880c,0x002ddc146ca19728)},
+  {FIELD_LITERAL(0x002d34b93420bc95,0x005fd556bf2cb5d4,0x008b50e1b86146ec,0x00b826a793f359fc,0x000a896edc6f6c88,0x00492f19a3e97cc6,0x00217ce243616ccd,0x0017b70100166589)},
+  {FIELD_LITERAL(0x00ce56e7207380ad,0x006946426b1b9d6a,0x008bb9438b51c1f2,0x00803c681d68c9c3,0x0021710cb983d4f4,0x0078ded0881553d7,0x00dba2cd00a10ab6,0x007d9b173c72adba)},
+  {FIELD_LITERAL(0x002bccd7da4af2dc,0x00adfdb3739ab965,0x0067fb0dbb8d43a9,0x00c7274cfba1c44c,0x007d2ac13d20e983,0x00d59e1ab2e93f61,0x00a30c9ca08fba97,0x000d74bc222526b2)},
+  {FIELD_LITERAL(0x00445e6abbc3d869,0x003a2bf0e277cb95,0x00b117bc7d87a548,0x002244f990e647d5,0x002808130a485f76,0x00cb93d796d8a903,0x00af71a6d8892106,0x00410c08f429b9f2)},
+  {FIELD_LITERAL(0x00674157564b12e1,0x0027f8475df0975c,0x00d6458353bbd021,0x000045d9e699b6c5,0x009c572ddb7c2e5c,0x0078f80b5a128834,0x00d5df4bcdd7bc0c,0x00bc39d57ffbe4d1)},
+  {FIELD_LITERAL(0x00a5c5133d346bb0,0x009e066ad20fe5b0,0x00afb1eb62b0e682,0x00f079eb4f3a6e89,0x000cf5138a255824,0x00a4a1cebb80ff94,0x00b34e916ab3995c,0x0024b282090a41d9)},
+  {FIELD_LITERAL(0x0028338d594ecbcf,0x00c18f384d6a94d9,0x00d18dc0aeec0ce9,0x00bcf06b8d7492f2,0x001ecc3942b0e29a,0x00f19ba66c3f5f5c,0x007d8024dbe1abd3,0x00653f9e6a177782)},
+  {FIELD_LITERAL(0x00a788f3d146d17c,0x0011739adf272edf,0x00ca9ec9153479da,0x00eae89fc1af9721,0x00ccdd65457070b2,0x00b9bcc2e789b6e0,0x00635096985def8f,0x0052da6a8005519e)},
+  {FIELD_LITERAL(0x00c795ef65d7f1d4,0x00bb1cc54ac2b3a4,0x00b9c24ef9c57f55,0x002e76e1361a2aa9,0x005ee2059d4be0e9,0x00a2ad1c709721ed,0x0049beca59f4c8a3,0x00582d680018042a)},
+  {FIELD_LITERAL(0x0078b9c5df573aee,0x002ca4ad158f6d81,0x0089337d14bb7f6c,0x0008e0428f37bd47,0x00c5ee54bcc8f8dd,0x004c8c25a5ea0808,0x00a49502bce3b37f,0x007cb5fa04d3bfdb)},
+  {FIELD_LITERAL(0x00d49b8736aef632,0x003588711d658718,0x005cd7fdfd671063,0x00415ea50a7e423e,0x00b52ad7f0b945fc,0x00e1025f4a9c7efe,0x00e05e7f03fa6c95,0x0037f1c90144efc3)},
+  {FIELD_LITERAL(0x0069c83b84d7adff,0x00b80399ae843f1e,0x009f288b9ca4ba68,0x00c0e22ea1180bd9,0x009bbed5b5ebd261,0x008c4f04ee45f384,0x00d2decbb93cc8b8,0x00b44f788efa5d26)},
+  {FIELD_LITERAL(0x001b1a51779428b0,0x002cd3dbb34f0f93,0x001cea047394f690,0x00271fe822e2cb5f,0x00563ce92031741b,0x0032b310b878ca95,0x00c9165035bf1d2e,0x00c5f08eac90c2c5)},
+  {FIELD_LITERAL(0x008c7658d10f60af,0x005f5aed1ebf45ef,0x00d1caa9e3ceab34,0x00a164a9a23fac0f,0x008ac683d078b934,0x0020c28ba58b5983,0x0008e7f8af052b73,0x008f6bed48bc0cff)},
+  {FIELD_LITERAL(0x005a4113ebe7c640,0x00f36a4e0b81e8ea,0x0062adad0cc167fc,0x0018e39e06478442,0x00b6a3524bcbc520,0x00798ff5a91f9802,0x00a2cc6a3cd5085d,0x000ee119e8e8681e)},
+  {FIELD_LITERAL(0x00501387783e4a56,0x00b08c0466c9132e,0x00ef58edaf9d9d85,0x0063670a7364d697,0x0043def350aec4d3,0x00c58e1efb66b17f,0x007fc2b8b142192e,0x00ec2eeb1e7fab8a)},
+  {FIELD_LITERAL(0x005091b6e03987cf,0x009001be6a186ad0,0x00aa9fd46c3850d9,0x0067360a91a799b2,0x00452857f585b211,0x0042175f1c97fbbf,0x00b87a09dafc2315,0x0013b33ec654c4f9)},
+  {FIELD_LITERAL(0x0035186cf59b6fa8,0x0074da04e9ed51cc,0x00655403fffbfd9c,0x009cdba0e708e9d3,0x00329fc72778c31f,0x00291d5cd0ccc3e6,0x00049340f64484f8,0x006f9f8e33901f0e)},
+  {FIELD_LITERAL(0x00f8f6f44a1ee1cd,0x0071635e6e0e9cc5,0x009e979d0260fd45,0x00a8371848d2e342,0x00d3e3e84fdaa86e,0x00a8787bd051f4ca,0x007ed209520f3c79,0x00083e42067a5f06)},
+  {FIELD_LITERAL(0x00364f58823f8b9f,0x00753011ba40bc28,0x00aee017d85f1b30,0x0086d35cd670c505,0x000d6ec3f0527781,0x0004bc27a0a2e537,0x00710d500fa7ddac,0x00363311b1c18ed8)},
+  {FIELD_LITERAL(0x0017fa90d4bca1c1,0x00aaf62578551c03,0x00b63d78d70868b9,0x0085f66918b9bb98,0x00cac2377551cb5c,0x00fafa73645c9e1e,0x0016b05f1e8a8b56,0x00788708d88b1bb9)},
+  {FIELD_LITERAL(0x0076601d7be0383b,0x00f3c448a5a84d75,0x00c95b706f20b19b,0x00152d1e0b0169f4,0x0089ed3c2a691ee2,0x00c391058253e795,0x007b8bbd5704cacb,0x00b40b7a253d2abc)},
+  {FIELD_LITERAL(0x007a376fc200c652,0x00419585854eac03,0x00fa13d298a73f14,0x00ebf1519d3614c0,0x00170f362a7fb29a,0x003bacae6bceca9e,0x00c2cce40f7cad75,0x0072304326483891)},
+  {FIELD_LITERAL(0x00e4d0bcb1602e20,0x00f92e019aa24621,0x00152cd0e0f7c48a,0x0084298f2e09eee6,0x004f8c6022ebacd8,0x0029e46db11e87f4,0x00b64843edad34c6,0x006757bd7bf5dcc3)},
+  {FIELD_LITERAL(0x00177010049e9fda,0x00d7f07494615403,0x00dad501efa5d132,0x000c5433abe2e842,0x00cc0d394556307e,0x00e4a0ce16863653,0x006983c3c086ff8b,0x00c1b7881b0903bf)},
+  {FIELD_LITERAL(0x000dc4311ee9a44d,0x00084f67596934e3,0x00f4f09929f540d4,0x00348916ebbe170b,0x0092a3bc0803faef,0x009368e51c4211f6,0x005b63108738bb2f,0x0030e40fd3abb4c8)},
+  {FIELD_LITERAL(0x0016e61ed97b8c18,0x00ac8a2403aaf5ad,0x006ac26059317c2d,0x00977c3c72ba4983,0x004ce20f17c2a8c6,0x00ca7b672255efb2,0x0086a118bba870c5,0x00936889dcb744aa)},
+  {FIELD_LITERAL(0x006d632f593b02c3,0x002e5448ddea0c94,0x0055fee834e501fa,0x00030d3e2ea4e09a,0x00beed50fcb67bdd,0x00691e9c84667687,0x001646604cc2cd11,0x002920f18035e447)},
+  {FIELD_LITERAL(0x00eb5a083188ec1d,0x00f4a85af35d5a10,0x00c228ee733b7e39,0x007a4764da59c8c7,0x00d75fa4a3d4709d,0x001bcb02b2f057ce,0x00e0aba28d5d2256,0x0092b0096ced76dd)},
+  {FIELD_LITERAL(0x00ca0c1f50eba30a,0x00ab536c7ac53d48,0x00f4c7768f9d5fe1,0x00d11a214d46517b,0x00cc5553db3f44f7,0x00768e388952f70b,0x00916ee98c8215a6,0x0061867acdfff610)},
+  {FIELD_LITERAL(0x009ff557d3736f02,0x000a53079ec34579,0x00adf4bcdca6746c,0x007055bd8432a32f,0x00053d262e3b42de,0x00c34a5b7843f412,0x006ce6fc3faf0a56,0x00c7724d2ce9ba2b)},
+  {FIELD_LITERAL(0x00442efa3e2b913e,0x0026c9393e341dd8,0x00a978c2aa087482,0x00b9f7c6f580f3e8,0x00e9d54e608482cc,0x00bad366566f81d9,0x001ff905105be79a,0x00efa876b9de8f80)},
+  {FIELD_LITERAL(0x00532d28f2207aca,0x00b25f51232cd392,0x00c9d3d32a5c1893,0x008c5ff39efd0c33,0x008bc6265b5236e8,0x0072b142438da59d,0x0046df03a6ca333e,0x00eada1dbe651e78)},
+  {FIELD_LITERAL(0x0034a890520460a0,0x0018ceee93db1612,0x00afbbdfe4a7e7fc,0x001ab20561c70d1f,0x0055959f2fa82c58,0x00e25eb3b4dda4c1,0x00ab6d2f78958965,0x007f5adcc984c218)},
+  {FIELD_LITERAL(0x009403777b4954a6,0x00a65de76b049360,0x0072ae04130a23ea,0x00653e9ebfea9a56,0x00a1a4b3763b2b90,0x00faf7a52074abc2,0x000ea4d5e581614c,0x00de0f64c64275a2)},
+  {FIELD_LITERAL(0x00af75c028f095a8,0x001d1e76ddcb73df,0x000af0ba7776e6b1,0x00a4899b37c4f116,0x00643929733ede49,0x002fbe9b71a7da60,0x00e2eb51f83ccc67,0x0011a462e6e1dbde)},
+  {FIELD_LITERAL(0x00b427bb4b81f7d7,0x00cd237cdd055c60,0x0029779ec6456315,0x000f095855a40abf,0x00660cc16aa751f3,0x00e7c3767ac22ec9,0x00c01ac9044058c9,0x00ca05eaed9ccf83)},
+  {FIELD_LITERAL(0x00e317334ecaf42b,0x00f2b0939d2f2aff,0x005fa2fa6a18a186,0x00779e8be5902edf,0x00f7e4e8c42fc731,0x00106f5c2bba7748,0x00be906567675568,0x00ab23bff772b6d8)},
+  {FIELD_LITERAL(0x00d316bbb1d24804,0x00eac8d1022356ae,0x00acd7bebf53e574,0x00780765a570798c,0x0005ffca5d72f262,0x003a8c87d214e124,0x0053b4409707e7d5,0x0001d0b6aacb7e69)},
+  {FIELD_LITERAL(0x007517050ddb2e05,0x0048ee6e861cbbb6,0x006df10caee0d520,0x0057ca7e3385675f,0x0052232a4b26a207,0x00b8fbcecd5e69be,0x00585830d5223c3b,0x00450489afe3c009)},
+  {FIELD_LITERAL(0x00a3d61ea845edc9,0x00068b67a7e2c2ce,0x00f7a951ea0598fb,0x001ee702c35f9035,0x00be8e995fa51744,0x006993c9cef265f9,0x005a5aa45d535bc5,0x003713045fa96c8a)},
+  {FIELD_LITERAL(0x00b18daeb7cf6717,0x004201c27ab6ec23,0x00523f9162245abb,0x002b76149c5bff3d,0x00657a1e7eef23ac,0x0067968fa39c613c,0x00f0061b7599916c,0x005a61de4e3bae74)},
+  {FIELD_LITERAL(0x0060ddd8d5d6bc60,0x0066d5a018015032,0x0096045c6e8990ec,0x00c9bfc3b81f7803,0x000305b4defeff1a,0x00a0024f97ddf108,0x00a0bb2cf26e927b,0x00e2834e85c25849)},
+  {FIELD_LITERAL(0x004798214223ef10,0x00263811805599d8,0x00a46d5f3e16e1dc,0x0078f0defc4e2ea5,0x00c6f7f15c7872bf,0x0000e4f92e04352f,0x00cc634262ede505,0x000150d6ee9fee8c)},
+  {FIELD_LITERAL(0x0076374d3c2de27f,0x001e13d22bfe6e54,0x00a62712dbf6f919,0x0069e8272a3a66f3,0x00df5057e85ac59e,0x0011ca7d40480308,0x00ad76944715ea3e,0x0086bba0ba46f1e6)},
+  {FIELD_LITERAL(0x000cbd386893b814,0x00cdf744b5e63624,0x00823aa1556d35e3,0x00f87aeac0a35fbd,0x00b1862a1fceca6b,0x002902bc27e3276e,0x003c26c62a8574f9,0x009e02425999a5f4)},
+  {FIELD_LITERAL(0x004ad13c7116b457,0x00db945b8b2e5619,0x0024404f8e1e1d80,0x004ace07918bce7d,0x00bc5a552ce11ba4,0x001b1f93c7f3f88b,0x00e5ba16b0eb1e2f,0x0088a1ef833b0240)},
+  {FIELD_LITERAL(0x009d20a5d683b6d4,0x0015eac73ef00e4c,0x00bf64abc9ec7ebb,0x0085fce9978a94e1,0x00809f888ee2de36,0x0005ad12c7c86341,0x0065ab4aacb176a2,0x00ff9576fd350f2a)},
+  {FIELD_LITERAL(0x004a48f06abaf914,0x00f65f1193e65e39,0x0082bcf69f3d644d,0x00def5b7e3be6e14,0x00691fb4002d2fa5,0x00942883a1a48743,0x0060b4b7ac522b4e,0x003480a8ea7441a8)},
+  {FIELD_LITERAL(0x00510cec0c5fe588,0x009c1333dec36cb1,0x00e58e1761297a5c,0x00250b5a7b1e8861,0x00e53f4cccf6a308,0x009f6b4dcb4c1fe6,0x00074b67b06a368f,0x00392a74e569676f)},
+  {FIELD_LITERAL(0x00f9a04322e660ec,0x0071630a5b11c085,0x00c206d6a9a11fe8,0x0087d8621c3526bd,0x0062cb25c8ea2253,0x00899cab959af092,0x0022a2ca67dc0e61,0x00f446e6198fcd0f)},
+  {FIELD_LITERAL(0x00dcdca47924dc26,0x00f9168ae7127ce8,0x0021ba5172a4bdf9,0x00786d2076a831be,0x0075c4e642e99436,0x00a66410c8e5171c,0x00e90ca7686c0956,0x003899386f1f9f94)},
+  {FIELD_LITERAL(0x005893842f1e313f,0x000f5a57167854f1,0x0003524b38dc6491,0x00524a4be99965e8,0x005a7d53521a6281,0x00e104c9940313ad,0x00535339249789c0,0x00fbfad9703d7064)},
+  {FIELD_LITERAL(0x00487417268bd9fe,0x0021f7292ef357e4,0x00f177fdc9d528dc,0x002aebf6367f5b1d,0x00f7f58b90d43b17,0x0062361313b82e58,0x00d6d98145f680f7,0x0046f7b8ea5d4f0e)},
+  {FIELD_LITERAL(0x00b20c940919cc22,0x008079026f08cd1a,0x0063830670104da2,0x006c73fc34d08b3a,0x004c8c7ef05bf514,0x0070db38a21fa89c,0x00f56d3834ebec7d,0x00d48b916f8f6ac4)},
+  {FIELD_LITERAL(0x0088a7c8b16baef4,0x003b9e784398991d,0x00bbec42b45011ea,0x0060008691fc2601,0x00f064de130856c7,0x00e7249703baa556,0x00792f97ff903d7a,0x006581c226297ec2)},
+  {FIELD_LITERAL(0x001509b3d638b744,0x004539cdf304dec4,0x00d5bf48baff377a,0x00be9af69f1e32af,0x00c479ee4c83781a,0x000d687b6ef3a664,0x00b8d317de248442,0x00333da7678400bc)},
+  {FIELD_LITERAL(0x001d8e2ad6a44a18,0x006fda1ba6e82a4f,0x006f887c2970f2ae,0x00f5ca4624b0a391,0x0033211d902b48e9,0x002b5fb800dcacee,0x00bd602ba7c5cf02,0x008a5a4063eb7b20)},
+  {FIELD_LITERAL(0x00f0fc880c6861fb,0x001689e0a88a72f0,0x00a2ed6cd21d9358,0x009eb9ecf64e07fa,0x007369d12c9d7abc,0x00024379530dc795,0x002b8bb47be3e527,0x00663ecd7d0bd22b)},
+  {FIELD_LITERAL(0x001ee5f30bc86f06,0x00d5bf090bbcc7cd,0x00992ed29a052f88,0x0098569900a1c3c2,0x00875e9c3fd2ea69,0x0010ba1a537eff93,0x0053091334aff2cd,0x00c030752428c130)},
+  {FIELD_LITERAL(0x00085d18829f9d48,0x004c2d69659400cd,0x006a91b00d0ba0ac,0x00e43554738a1754,0x0011ada2822dac66,0x0049cd325d4d14d9,0x000bf8029dd98242,0x00611147e3e891e2)},
+  {FIELD_LITERAL(0x00cf08359acb35e7,0x00eb86ac83422f1f,0x001c0f6fa296ee2e,0x0026b6ac8a49aaa4,0x00f22bee650c09b1,0x00f576b26d3d9e46,0x00f0b1c491c7c868,0x00c09cacbf8eda28)},
+  {FIELD_LITERAL(0x0054d7398aadc2d3,0x0032876b7e26066c,0x0021e83b3af73e26,0x00935425f2a1ce37,0x008bfd96bf4c1ce9,0x0008c20177561ceb,0x0049d90068933d34,0x0061ef0d5f08a770)},
+  {FIELD_LITERAL(0x0046a656ca92a9bb,0x0040cc32fd3808be,0x00bad011e1e80944,0x003da8e27798ff05,0x00568914abb2c279,0x00a559c61cc15d36,0x00d8e7ccf2fc6a13,0x007c8eec18add787)},
+  {FIELD_LITERAL(0x008f817b538d2d5b,0x00f1b9e7526d8042,0x00d3d1112b757c3d,0x001238bd7bc4650a,0x00c2384ba86f203c,0x00d5f2fd46d7cf63,0x003e1cbf3517ebae,0x00e612d7891d4403)},
+  {FIELD_LITERAL(0x00ad8fdbe66cd86c,0x004cb1aa669bfc40,0x006b35eb94e716ce,0x0000975ed6561b7c,0x001e28c663fcfeee,0x00405c467c4eb6c3,0x00ed24cdbaa481ef,0x0067c4f7d516a211)},
+  {FIELD_LITERAL(0x00a247d2809c00bf,0x0094963e90c36d6b,0x00b96cde53f4d776,0x009fc5612dc802ef,0x0004de7a1a758db7,0x00e5e1061bb72ca4,0x00db8e0cb86e1500,0x0058e981815824e3)},
+  {FIELD_LITERAL(0x003c055aa31d638d,0x00f03ccec555df20,0x00dc867f5cca7956,0x007cc78f43b0cda4,0x00ace62350406ddf,0x000f3d9a3ace1d3a,0x009d098410d7e190,0x00a231f7f13edf4f)},
+  {FIELD_LITERAL(0x00e627aa0e2292a0,0x0013902e3154405e,0x00a85f436e52f112,0x006e18bfb2277e22,0x00e5d37aa4f0263e,0x00d8f13fc205d273,0x0099a2f6fb2027b6,0x00a2aae17b0c47e2)},
+  {FIELD_LITERAL(0x001ffcb86780e035,0x001fd01813e3cae2,0x00fad90c32e4b010,0x00746b145bac009e,0x0006810bb0dac7ef,0x001f829bedb95e11,0x00c6a2f8ed006ddb,0x006f29fd87d562b5)},
+  {FIELD_LITERAL(0x00167fda681f6497,0x00c4124c37fa2fd4,0x002a29ca76d4e11b,0x00287557e4da8a83,0x006faaa65c800388,0x00fb15f8dd7b8f8f,0x00eca0a4f6bb81af,0x00eabaeaafd194e8)},
+  {FIELD_LITERAL(0x001894778bfb451d,0x005617d722076027,0x0064ab6cc837e04d,0x001dd57e8b3a9a8b,0x0096d65b77b3d1a8,0x00055e38b63908e9,0x00a8aabdcd3fd792,0x00754288814e0af2)},
+  {FIELD_LITERAL(0x004c52d84408d29b,0x00b200dd9eb9bf98,0x004e2dd61616c592,0x0058dab1b09edada,0x00c5a3ac8494f4b8,0x00c8901f158d00ca,0x00313bdd427dc596,0x00247c7fa7c3995c)},
+  {FIELD_LITERAL(0x0060982624b3a9be,0x000a35e483382780,0x006b2de455ad3a3c,0x00f3a5ac1264eef0,0x00d161d8a5290590,0x008d46029801b31d,0x004c2cb2d6234c49,0x002ac305578be9f0)},
+  {FIELD_LITERAL(0x00b684dbb17b004c,0x000f95cb92084b0c,0x0029347dcc60fd75,0x002c4d84e0c56c38,0x005a4cca69526617,0x00ca5c9697ccc86b,0x00bc724b8e8e62ab,0x00d6521b6637dc7c)},
+  {FIELD_LITERAL(0x00aa89d4f4b54612,0x00a7b24d5bfaddfa,0x006ac5d72681a7b3,0x00dc944563a86eb8,0x008d23041b56e889,0x00b058a66313a38c,0x0050985640474475,0x003e1baa5fc9bd07)},
+  {FIELD_LITERAL(0x006767234a634490,0x00fda10d5d159b1d,0x0091ecfb66175b51,0x00439d002ae40b20,0x00a44c1bac37049a,0x0080982673c8816c,0x00f7d105fcfc23a5,0x003d14a7ab862c09)},
+  {FIELD_LITERAL(0x00470b120d6802ef,0x00e6b969e7fa5fe9,0x00f45d1cf04df30d,0x006b9163d6dcdafc,0x00d4e941c0f2cf02,0x00321d7aa8c2a7a2,0x00751664837796b2,0x0049428953a1446b)},
+  {FIELD_LITERAL(0x00bb57d84b7120f4,0x006bc3650605f0c0,0x000d55a62c4a8538,0x009dfd071e0fd8f6,0x00e387a382fee7cb,0x00cd54004c39be0d,0x00e129c52d3c443e,0x00018826cb39e410)},
+  {FIELD_LITERAL(0x00e99e58d1a1f2b5,0x000b3ec52565baff,0x0031a39a5275d376,0x007c538e456a4f7b,0x00cc88730ccfb39b,0x000fb16300a75d2d,0x003797aae10f53fe,0x00e3320d2519ce6c)},
+  {FIELD_LITERAL(0x002ad475c7c032a0,0x00fd4e1d61a35d6f,0x00d7e2ffe9e2930e,0x007ef3bccf990981,0x0084986c1b6bf23c,0x0004ed9295be9a51,0x008d0db5db5d88c4,0x003df57d9a9a510a)},
+  {FIELD_LITERAL(0x006092d8cb060e0e,0x0002c2238a59335c,0x00dc53c738c34f6d,0x00a5b546d1a6ca9e,0x0069a803ed13db7e,0x00071152ffcd12f9,0x0072c8b3549cad0c,0x009ee227780f5e90)},
+  {FIELD_LITERAL(0x00d45c18e83735d4,0x002c9e6c72b0feb9,0x0057e34077261576,0x008e5b3792890192,0x00628cf5a9b56879,0x00230a8ac17c12a4,0x009de3051c5b7cca,0x006a0ff4e089ff50)},
+  {FIELD_LITERAL(0x008a7773507895d1,0x00dcc24ba76e63ec,0x00a7e97b8ba5989d,0x002513ef86c40107,0x0032881cf38efe62,0x007b5176ac676ab5,0x00951a7296716d19,0x0034bf44e41fbb69)},
+  {FIELD_LITERAL(0x00cc88f42030f63d,0x0015da22251bd59a,0x000c20c182af0438,0x00641e2252700296,0x0037b4d04e5e1de9,0x00a88d126758360a,0x0029d5d3213680fd,0x00a1e6b61b59580f)},
+  {FIELD_LITERAL(0x00cc6f75635dceb7,0x00479ffddfdb4abd,0x00a7712396d87f45,0x0056b515894ae6be,0x00d0fd148b042114,0x0035ed36faa066a4,0x0048d1f2b3cbc49e,0x00df751d7b10df4e)},
+  {FIELD_LITERAL(0x0072712102717445,0x00beab3555ef3be4,0x0084ab125fe78629,0x00bff6a8a039c5db,0x0056bf38e1525fca,0x003c718f31a50661,0x00489a59e552254f,0x00645edb55fa859c)},
+  {FIELD_LITERAL(0x00714add1ee3c7f1,0x00ff349b4c3c7f7d,0x0088129216df1834,0x00545cd8e33b7cf6,0x004ce360733c3ebe,0x00380d8cb5094ce6,0x002bf1b2ef7c8a35,0x003ea02fe0168a5d)},
+  {FIELD_LITERAL(0x00deec7b5ac856d7,0x0001fff1a03e4d5d,0x006b28b79151a915,0x004db76f6393c2e6,0x0017fbc05aa6de0e,0x0036d09dd9e32569,0x00988e66d220b9e6,0x0050b37337da7f34)},
+  {FIELD_LITERAL(0x0017bbc26cd4dc96,0x009298d060362997,0x00977eb3fecda519,0x008e74e8fa104168,0x00660e9980f87d41,0x00f539ad006510e2,0x0062dd5c016fff7a,0x0092c7ad484c4931)},
+  {FIELD_LITERAL(0x00f2ab75c05130c9,0x00e3595ada645014,0x00b3f500170203c4,0x00d25e618a030ed6,0x00055f9934e331c6,0x004933f1b45b8049,0x00391278bddb16a8,0x006f56d71672f1de)},
+  {FIELD_LITERAL(0x00c247369919224c,0x004151b1791ed11c,0x00719e2241309942,0x0042f2323a2e3f88,0x00a5264fda8e47f4,0x00956596ea1638c9,0x006e81dbbfaeca68,0x00d2a4f76aec38f2)},
+  {FIELD_LITERAL(0x007f0b687486be4d,0x00856d76fd7e4eb9,0x00d6b1299823fcaf,0x000959b686a7037a,0x0019bf25c1a6eb52,0x00ec9dd9eb9456ee,0x00d8719d836d52cd,0x00bfbbba7b60707a)},
+  {FIELD_LITERAL(0x00c84cdbdaa71b2c,0x0037228a37bb02eb,0x00f3ffaeb8246530,0x00724977597262b5,0x0004d5fb0fa0aab8,0x0071db5a8ab297e0,0x00fdfe91d5ef85d3,0x0074c16e4b09a795)},
+  {FIELD_LITERAL(0x00e6337ed936c619,0x00cec3d83b05620c,0x004ede63563a3b10,0x005fd2dc4571563b,0x00991c12169b848d,0x00513bf10dc802c6,0x00bb6498b44f7770,0x00ccd5a141f08d33)},
+  {FIELD_LITERAL(0x008af61e3ab3036b,0x00fe0c66da4bea3a,0x00a948631c28f385,0x002453885a5a1423,0x0005534b6da59a72,0x00219df1a9095011,0x0093d0148b4b8403,0x005c9995980b3ff5)},
+  {FIELD_LITERAL(0x0006a1f10850a319,0x00320fa1112caedc,0x001e4a78d0e84016,0x002e4b0eb4a7346c,0x003e0522cbf1fd1b,0x00e566baed1de0bc,0x00f178241b482609,0x0060b141f21ef0f4)},
+  {FIELD_LITERAL(0x00776694a8c0df2b,0x00a0927be19bf6e4,0x00514f14ae1b6240,0x0042115dcd702c6e,0x0076c4f64fc1d0de,0x004610642b4c3f89,0x00ea48b29cbc7a20,0x00bbb73439426143)},
+  {FIELD_LITERAL(0x007a134a3aa6d530,0x009ad499fd53e011,0x0086c7c286a66cbf,0x009526f52cf78b51,0x00224d3db6a25122,0x00f4f1248a098f67,0x002cfec50efba029,0x000c80db480b74d8)},
+  {FIELD_LITERAL(0x00fa4bad676daf7e,0x004c203d53b64447,0x009918be220446f2,0x00ec9e076dfa92ba,0x006f20b55875d09f,0x00e256c125e3011e,0x003534022d8ee354,0x005ff6cea690f73c)},
+  {FIELD_LITERAL(0x00b8071958f07aca,0x00732e62e0bf2694,0x00d5b4ad63ce16bb,0x008f03e101f306b5,0x00bc99a2dc44a86b,0x00fc3da624e64854,0x00fd7162d5f2c3d0,0x00eeb48658afb095)},
+  {FIELD_LITERAL(0x00c1af5972011d4e,0x003d67047bf9065d,0x00d163058a77c4d0,0x00a737acc01d0cbb,0x007e066aa2d9175d,0x00770fd1fc6836ca,0x0072d9f0e4f6363c,0x000a296bc9d0093c)},
+  {FIELD_LITERAL(0x001c6724273e1c79,0x007d67a6d5fd8624,0x007e4cd0aad59c11,0x0045b70e1ef933cd,0x003506f701d9b5ea,0x005ad0804357f7f0,0x001faf42debce773,0x0005d3afadfa8f2a)},
+  {FIELD_LITERAL(0x0021273350012fad,0x00d01ea6f29325bd,0x00a0a4a968215c93,0x00f461d60705710b,0x0002083569577237,0x00941f2674421519,0x0053c22e2d0c6db4,0x00a5fd383904fa5d)},
+  {FIELD_LITERAL(0x000f7c6b7426ce5f,0x00ffe65996a7a72b,0x00cf9c19a5a37a75,0x00f67e18c2879a8d,0x0006f922a67d6183,0x001b96f5196d4bef,0x00a6f57ce6f13a34,0x008719ab3d3f86ff)},
+  {FIELD_LITERAL(0x0052facf36041dbc,0x00a018f1223fcfc6,0x0064f012b683ca3b,0x004b27aaaaf07a89,0x00b2d41d5604a7b0,0x006b2a3cd03152ad,0x009c07ef46ac36dd,0x00a476385dba319e)},
+  {FIELD_LITERAL(0x00246178e527a1d3,0x0014b686a2e2ce9a,0x00da627f59d33c1d,0x00f8b0e1b7a770f9,0x00a511f6aa333328,0x00b59f40bd01e744,0x00c7ccd2532d4072,0x00ba61be0332b9a9)},
+  {FIELD_LITERAL(0x00dede724b05b4de,0x00eb65dbf36ce341,0x0036fdf3ab82c652,0x002e730ea2a804bf,0x0011cdf284739fac,0x009666d377ebdbc7,0x0099285234d00e86,0x0004964cd0f9b976)},
+  {FIELD_LITERAL(0x006325a9d89fb8d1,0x0076ae6bfe4d1a60,0x0031e76a0030027b,0x001bef42f0ef14fc,0x0057729c3d0aa6d3,0x00af578007d4bc45,0x0088ecc9a81fbb54,0x00268570fc036fa6)},
+  {FIELD_LITERAL(0x0011a266f6c84219,0x0035adb9541abcfe,0x00e5f8fa51a5bd72,0x00649e8eebaaad77,0x00598b53b17683d9,0x0089d1f81ce52511,0x00cfa11a73e05cd3,0x0020cbb73c14aceb)},
+  {FIELD_LITERAL(0x007d6288a46bf8c1,0x009de9f806b0860b,0x00a56aae8f498848,0x009c8c9989de1351,0x00092b28d42a5619,0x00a7a50351837ab8,0x0010ec3fc5f850e6,0x00b80f58e32f4041)},
+  {FIELD_LITERAL(0x002acbb53352a6d6,0x0066825ad04b2504,0x0062a712c3125611,0x00eda7dd468b38ef,0x000229c06193dd3f,0x006e2e96226ea133,0x00cb8af9fba59842,0x0019c85d70aaffca)},
+  {FIELD_LITERAL(0x00afeef260facaec,0x00cc0021f95082bb,0x005d4529e49ff94b,0x00352056378440b1,0x00d35f3ae467fd4d,0x00fcb28566d054a5,0x00ff9c23371b90ef,0x003ecf689514497e)},
+  {FIELD_LITERAL(0x00c0ee67a9dfb084,0x00ca65302b4654a5,0x0018993b1dabf89b,0x00c5b03828110a86,0x0039cd56729d6a62,0x005e82e20a479466,0x000ae16234a908b1,0x00ff28efe27b2cc2)},
+  {FIELD_LITERAL(0x00b5c1e926c48b0b,0x00b9a002c522ed7c,0x00a6f2378f1b15a7,0x00a3ac589506abf7,0x0064b510c9b5a61c,0x007d60a4f40eb39b,0x00c54956a6e153c4,0x00d1672c2fc63cac)},
+  {FIELD_LITERAL(0x0069160201e49929,0x00b1566af07e746d,0x00d88a4acee47ea7,0x003435acc8baf835,0x004c7639d0920c18,0x00f25a0f79ef17f4,0x00adaa079f9c9ba7,0x0044f135bbae1fab)},
+  {FIELD_LITERAL(0x008c1f0c8e92fa89,0x0031c4abb883648a,0x000d084afbe51b32,0x0076d69ee7b484cc,0x008d133be6347486,0x00979b020e6bea5e,0x00952629886edebf,0x0040e991959f4626)},
+  {FIELD_LITERAL(0x0084f6a9a2832476,0x0062e45f04660006,0x00fd060609c44e4a,0x00396bea63deb65e,0x006c4cad12f71f8f,0x006e00fb7c34628a,0x00b0be81f7269b4d,0x00278a87a1c94c52)},
+  {FIELD_LITERAL(0x00d5bce75c068f08,0x00c66043fdc27b99,0x002e1b209f6c50cf,0x0003c691dca7bc43,0x00d107d54e398a8c,0x006ca648c6730b20,0x00fabbac8c0a0ae2,0x0015090283678815)},
+  {FIELD_LITERAL(0x00112af042b2b047,0x00f4aa252ca1ab0b,0x00ac6cdda4f78f24,0x00cccea719fb15f5,0x00d83965c748ac9b,0x0034cc124c235bc3,0x0073e9b372d9394c,0x0046c440ed721809)},
+  {FIELD_LITERAL(0x0006c0ca330d5752,0x0015ba051cfd4209,0x000a527e44e8cace,0x00258079408c6005,0x001119736167cf8e,0x004de79ca184585f,0x00ba47cfd5cc540d,0x0006b5c081c21e96)},
+  {FIELD_LITERAL(0x00843c66f367c235,0x005fe7127956d613,0x004ea4c97678d4e2,0x0060500542f8da02,0x002ccad8d6d5452d,0x006936c7f5152192,0x00c839d3d1b1a3b5,0x0086f549189a7f8a)},
+  {FIELD_LITERAL(0x0011df44d3cba9bb,0x00484cac5feccc3b,0x006cce74cea38ccd,0x00524ca000abf1bf,0x000296fb833d4157,0x00f5f272a03cbae8,0x0037da8953e67f0f,0x003c198ffb48795a)},
+  {FIELD_LITERAL(0x0086717196a1903f,0x0002d26ffaf19cf0,0x00edd82426dcde1a,0x00bab76899b1f731,0x004212346e03b6cf,0x0088b530b6ee98e1,0x003086b7d1457c2c,0x00a7f81d2753d15b)},
+  {FIELD_LITERAL(0x0077b7746b2aa8d5,0x0087210ded69187f,0x00d7ca09b530d65a,0x0009de81f94329cd,0x00c796c8cbfede36,0x006f690c479d6627,0x0067f2fe5eb2a86e,0x002077a07a6c07ae)},
+  {FIELD_LITERAL(0x003d2406e09b27e1,0x0007eda891df2cc8,0x00e3a2573f30d9d9,0x006b35f1ba5c4a86,0x001f40cf8cf14db7,0x008904e7b232f04f,0x00817ebb12b0807f,0x00fd040d8848d8a7)},
+  {FIELD_LITERAL(0x003bb0403a5a540d,0x00959d2b15e2edf1,0x00924d13b9f052e3,0x005c32af73aea529,0x002b63805a2f17fc,0x008f2263c7041df4,0x0005a12d632182b9,0x007f3246bd328890)},
+  {FIELD_LITERAL(0x009f2c9a06fdf427,0x000f59fc2fbd79fb,0x0058d2f7f4046074,0x009fc4ecd7ac0aa4,0x0060ee017ffc5e55,0x00cef10d3dc6d589,0x007e0b4ef1b1ee10,0x0068666bcfe23cb0)},
+  {FIELD_LITERAL(0x0058c6519a667435,0x00c5eafd425a3109,0x00c1916d49864f44,0x006fe380b57bedfa,0x00459ca7e49ce1c0,0x00b7b55632a23ffc,0x001f5834584d4420,0x00fcad8e3563f575)},
+  {FIELD_LITERAL(0x00790a69df77545e,0x0068a3e8a5b5252a,0x00b445e928b8072c,0x00f666a68f9846db,0x007c76cca302d92e,0x00d0986eb5851715,0x0007ed3029ea4d3d,0x0093bba8c7ed22b5)},
+  {FIELD_LITERAL(0x0092887a6acdb20f,0x002ce75da8842224,0x00bd93a599c89a36,0x00356e8e42eb3c16,0x009a6ab21f1d7496,0x0095048fb5af5e75,0x00f6f6ceac7e65f2,0x00d2cc617e6de788)},
+  {FIELD_LITERAL(0x00ec85548d103fc4,0x000c848b9565dd80,0x009e0e0ebbe1931d,0x0029909b6501fcc4,0x00bbcf577518a0c7,0x008b21d08ba1b916,0x004a5154ff118aa7,0x006f6790e398a18b)},
+  {FIELD_LITERAL(0x000a2112d4ddefaa,0x00b930aedab8f87e,0x003d3212f62e3e1a,0x00f93eccc45cd8cd,0x009d114da8b19d45,0x00159a4701248e19,0x006b83b6abf5f67d,0x0075e3c0a2f949f8)},
+  {FIELD_LITERAL(0x00ca3eff04aa07c8,0x00f10d8c98bb14c9,0x00e5443d1e72042d,0x007ae3b072f22e60,0x00a464bf4d8e371d,0x00adc20225ffaa65,0x00f55afa7a27471a,0x00e79a40a5c8b103)},
+  {FIELD_LITERAL(0x00fcf34c1ad3176d,0x00bce314d0f94055,0x0014ec5b84ecd890,0x00b7942c395ec299,0x005d4d82677930f3,0x00690c4bfb78a99a,0x00729aa9d2b59ddf,0x0081a38088b5f599)},
+  {FIELD_LITERAL(0x00ddbc1e8bb4d1f9,0x0063f802d20301bf,0x00fad21e2f6ca741,0x00684ab87d1cc980,0x0087223590c1012b,0x0083e869b449e666,0x0038dca257064af1,0x00c05aabeae3d7cb)},
+  {FIELD_LITERAL(0x00552b70996baa02,0x00eab8f0c4aefd2d,0x001eb556523ce53c,0x0070912e8cda6acb,0x009aef7bfea6717f,0x0058a3e24678432f,0x003ad98d89b0bcce,0x00c25024a66a76e0)},
+  {FIELD_LITERAL(0x00da9f1777689ead,0x004c672cd4ffa6f5,0x00cd163ab6b3cfe7,0x00b6292a5e7b28c9,0x00cd4555608dc8cd,0x00d96ee2210b0a51,0x00c0957d566c06be,0x0010971ba2c09afe)},
+  {FIELD_LITERAL(0x00c0d8bdc1d6531b,0x00c0bd6e47a3b4b4,0x007ee5a6356dbf9a,0x00ce10b4e3348acd,0x00c1d178f0ccaf36,0x00e712c23b16eb33,0x007d5cbc10683c14,0x00e6a15bf54c3cfd)},
+  {FIELD_LITERAL(0x005d514238369940,0x0086d6db75a3ad72,0x0052d5b63ad6341d,0x00b5608267ed8a33,0x009c334cab6b28a5,0x00e5dce9ecbc4763,0x00c228dc4480b1a1,0x001866063dfefad0)},
+  {FIELD_LITERAL(0x00ab03fff62d75a5,0x008f6f4ee59c0e73,0x006b0b8db8b5251c,0x006072dafb306cc3,0x00ed3c48087d1b68,0x004863067e5c3a9a,0x00958d33654c940c,0x00fe520bab4ec622)},
+  {FIELD_LITERAL(0x006d9cf5b5f7895a,0x001284ee74fd1719,0x00b94fdf5dbcb26b,0x00675bcf67755543,0x007b960e08e1d068,0x007f37b7248e183d,0x0026686f93607edc,0x0038a82c17322fca)},
+  {FIELD_LITERAL(0x00e69e5ee73fbc78,0x00e1cc916effe007,0x006a9d96facc1513,0x007fb547f080d40c,0x00b2615f9aef06e0,0x00b031baaa059d16,0x00068ac19378576f,0x0008d09001f766f6)},
+  {FIELD_LITERAL(0x008c65ce418f6566,0x009ac9dd5b40c8d6,0x00cd739b51557d7a,0x003900fcf456290f,0x005af4fbf57dca4e,0x0061ced4066bb7d4,0x00d13d964b9150a5,0x0052ae1a54d8ebc0)},
+  {FIELD_LITERAL(0x0042e1f5838123da,0x00d051477928e982,0x002790b47490b39e,0x0020b60e8a51d388,0x00399d0755ea3286,0x00d1d26b3829f970,0x0087d92879c19cfa,0x0080b712b0ecac03)},
+  {FIELD_LITERAL(0x002f7e67f6359166,0x001cd978320e4028,0x00650c77be980564,0x00036d03b72173b4,0x00b7d1d006cfe99a,0x00db4e97b70897e9,0x00b63d9e2ddb8dcd,0x0054af137efae516)},
+  {FIELD_LITERAL(0x003cd55ce7f5fe2c,0x003bc1578b543b13,0x00b7276a7b5aa22d,0x007106a5ae9bd98e,0x00f188122636b8de,0x004ff443c7ee9f03,0x006293a8daadffaa,0x00ffa2f4bc92f1ed)},
+  {FIELD_LITERAL(0x00097dd81d22da0d,0x00097372b8b4dee5,0x00172dbe7cfdd1e2,0x004514759f05507c,0x00bb8d9b9868b2d9,0x003afe6fccc6d0c5,0x008b6b7cea607b3f,0x000ba20300a69613)},
+  {FIELD_LITERAL(0x005175c2871e6c27,0x00a45e66ff6a9a15,0x00f8df30d69f6581,0x005cb67b2db1226f,0x00bfbe43f33f752c,0x000fb1a8add919b9,0x0034a5095d4b6bb5,0x003505037fd73093)},
+  {FIELD_LITERAL(0x00ddd8969756aa71,0x00c4cc372a646879,0x00db65e0358d7827,0x007687903ed41145,0x0004cacd12ad1278,0x00d538df1ef14f4c,0x0037b166bf64b878,0x001feaed66670ddd)},
+  {FIELD_LITERAL(0x00dc1a2c34978477,0x004a67ddb1bde155,0x005ffdb76ed4a624,0x005fecafaa5c03f9,0x00376d33b92f1d79,0x002f417cddcfda70,0x0017ea363713f3f0,0x00939142f037c9ef)},
+  {FIELD_LITERAL(0x00fc160ea82ede4a,0x000273ba61ed3bc3,0x00f4c0c7bb4e85d4,0x0074d0eb61513f78,0x009135078e916b10,0x00cd3d021df76364,0x007d14519b17f28d,0x0046805d5e6b5fa7)},
+  {FIELD_LITERAL(0x00e36147e54f437b,0x00672d8550359ccf,0x002d715fbcf02b5d,0x00a02c507c4fd2ca,0x0024df2d37bc97d0,0x00cad4ad41d1fdea,0x00f8b972fab619c2,0x009db82c3f9fe3b6)},
+  {FIELD_LITERAL(0x00fee37c36f7cacd,0x00da1f361b2b5ca0,0x00836b9252173b91,0x0056217d325dd4c1,0x006ddb68023b1e36,0x00f725e184823507,0x00c895af7bdc4fc8,0x0033668b6ed50882)},
+  {FIELD_LITERAL(0x00b5da48784206dd,0x00453da6a5c4a093,0x0041269b059b0b40,0x0043faa3bb0157ab,0x005b95bfe1f3fb41,0x00e3213049fb81fb,0x0036155dcca51b53,0x003d34930b3ff151)},
+  {FIELD_LITERAL(0x007e9cb84932a3e9,0x00987cc151cae047,0x00c547e356707909,0x009da3d851cb438d,0x0044d0e0d2e1ca38,0x00df4087f2538a1a,0x00d94870a2a77d22,0x00192784d98d1d1c)},
+  {FIELD_LITERAL(0x00e90dbb55ef0476,0x0020c973172c094b,0x0004fff2a0e58212,0x004bdea82fb9071a,0x00ea859728be3df2,0x0040b9085dc4d099,0x0070ef58df67be06,0x0084b3ecd2457d20)},
+  {FIELD_LITERAL(0x00d2efb39f749f01,0x005aafe3cfabd282,0x005522e1a9761569,0x00d9098f54218c4f,0x007946d03141c5e9,0x00ce9bc409bcc064,0x00e0466c78f6ad78,0x0013723fd29781eb)},
+  {FIELD_LITERAL(0x0047b7d5171c6839,0x00b2a44c60d92bf5,0x008a878c41be966e,0x0006e679ba03a02c,0x00bf53dabc4fadf2,0x002c5a3dfb0202fd,0x00aff0a478f1702b,0x001783c4b497fd48)},
+  {FIELD_LITERAL(0x00154f0155843c22,0x001492d8eae46142,0x00d90af183e3aff1,0x00d10de0dd6cf66b,0x009012bdf90b53cc,0x003ac0b7ae0dd722,0x00912da848a14cbf,0x00e2e9b182dbf265)},
+  {FIELD_LITERAL(0x008f5b27610a7b80,0x00be2edb71e770ca,0x00c184c0b5c1583c,0x00ac4ffa24e38438,0x00d00f268cf6b3bf,0x001dbf32ad4f9948,0x00858975ee9c548e,0x00503da069d6b537)},
+  {FIELD_LITERAL(0x0033850f80b7fe7d,0x00d80882966e856a,0x007aca5463715203,0x006b0f71bf6e4170,0x0053602e1b11b791,0x00fb376f78e9b80a,0x0012bbaebb93dd35,0x00eb15d0e1fab88d)},
+  {FIELD_LITERAL(0x005c59c23c4ed75e,0x009fd6ec9f26bece,0x00a547153efadfdc,0x00bc7504cf3f857a,0x00912e1bc7619f22,0x006a32e0b1458328,0x00a85f31cabad1db,0x00a26a3b4e47da55)},
+  {FIELD_LITERAL(0x00b532e07f896895,0x002aad74c4f01644,0x003b5f9323367e9b,0x009058e7ef6d0e06,0x00d79f388a696ca1,0x00996a883405262e,0x0054faddbcbd0456,0x00ec319abd52cbb5)},
+  {FIELD_LITERAL(0x000819d3a10b1b84,0x0012c3591234fba0,0x002a34e8b3f15d80,0x0077fc3840db3cb9,0x00ce92e77d409e74,0x00fdd85e27773ed5,0x00a5c41e983212f3,0x000c29aba9d9f2aa)},
+  {FIELD_LITERAL(0x00f26c10c18276fe,0x002d21700988fa24,0x00994db9c14479b6,0x00926d9e64d8a6b7,0x0032eae70c2f2a98,0x00e2b88fb1a73600,0x009504f66c698543,0x0086c9b54cf6c332)},
+  {FIELD_LITERAL(0x00d148e25c362ed7,0x0049e233a011f475,0x006df488b27194a9,0x009ddf4b6cde1f81,0x0038e4691817b0d1,0x0000804990eae947,0x007fc590603d193c,0x00e94aab337e5d47)},
+  {FIELD_LITERAL(0x0092102b4d4546be,0x000b4babefa64067,0x003af0ed141c05d6,0x00d3ede71f05fa14,0x0050c5af715bd4ae,0x004b14e0bd740d24,0x00585b3a8762d626,0x00fcc01b55398dd9)},
+  {FIELD_LITERAL(0x00b509507f2e806a,0x00a3646d60104e40,0x00b2b15c1fef57f5,0x00c061ee739740b7,0x00d11d9a068b7bf0,0x00d726e2b990dd94,0x006879cbcb14ea4e,0x001c721ab40726d1)},
+  {FIELD_LITERAL(0x00f900767c151bd8,0x00d3a8aaaef90f07,0x00588dd0c3395f48,0x001ea456fdb96f49,0x00ae52fdf85685ba,0x00c6f2f2e3cccb07,0x00610c9efa0cd099,0x00ff6ce828205bf4)},
+  {FIELD_LITERAL(0x002e9a99665f65d2,0x00f4985156f41828,0x0080b3a5d0d09265,0x00f410f79687042a,0x002efcb6f3768e66,0x00a2aad71375ce52,0x00ad7b8bb9598450,0x00606326202348b9)},
+  {FIELD_LITERAL(0x0040514ae695b573,0x005d703d66a015f3,0x00c46f96a33e5f6c,0x008e014827db57a5,0x00c7d63e320be628,0x00929894d099a08a,0x0022ff81ecc556d2,0x000c90f9bfb05a91)},
+  {FIELD_LITERAL(0x001bca8733031e58,0x00377836b4aff11f,0x00ed16591f1217a7,0x0029e414f8b7f7b6,0x001f8d361ea53b64,0x004dc1585dc237d8,0x007b27595af0fd16,0x00b516c6c2dd69aa)},
+  {FIELD_LITERAL(0x00e870fa7c51cfc7,0x00383e9a35246abb,0x007f9d609fb317f0,0x004b819353168718,0x00f924bae0387ef5,0x00c8f9ef0de61346,0x00ba6f3d5708f0ff,0x00069b0165186fd1)},
+  {FIELD_LITERAL(0x00ff72527c5378ac,0x00c942f97f8fa748,0x00448069bc616389,0x00eed4c60b9de327,0x003a431b7dda2492,0x00f06b77a5e77a62,0x0092dc3bb4cea0b7,0x00e65a67564d01aa)},
+  {FIELD_LITERAL(0x00b0d591d26ac843,0x002fc8ef67e70c45,0x001a1ceb6cd918fb,0x0035f28ab5489a01,0x00e87b0439a2ad23,0x00f00340fb3cdfc6,0x00aabe584da4ea1c,0x004064fb6998acdf)},
+  {FIELD_LITERAL(0x00ed6b9ef2a76096,0x0011d4b0d68c79f7,0x00c89ff8bcfd848b,0x00d4f832894a52a6,0x0038573f47cfb8ba,0x000f10a355ef929a,0x007517331eb9ee86,0x00034040f1b0fb4d)},
+  {FIELD_LITERAL(0x00aa39bc17777afb,0x00f5a54cbb18f9ed,0x00d4d628236caf9d,0x000526a61b774461,0x0013fb32a9d4f60d,0x00e26cec3d152cc4,0x00e7ddc6e9cc259f,0x00b5079a6a1ba95f)},
+  {FIELD_LITERAL(0x00ae0a5078d115c5,0x00c27d994c3e7f00,0x001246797d81bd96,0x00d6ccde2f576fc4,0x00b37bc639df34ca,0x0075b7c9ef589fcf,0x00f427ef07054fea,0x00f200febf035206)},
+  {FIELD_LITERAL(0x00e0db3b88ab4450,0x00b194609179bab0,0x006bea9caf4ba610,0x0069d934dad8488b,0x00fb197b6929a7a9,0x0089fdbe5005ca8c,0x000e5c5982879e6a,0x008595b7a54711e5)},
+  {FIELD_LITERAL(0x0011e74a5ed9ad16,0x0046a203a0e018d1,0x00d096768e2d63b8,0x00cacd0f0b254184,0x00527bb18e8a0723,0x00509d19ba993a1d,0x00e90342df21f3b2,0x006ad86f4a64343e)},
+  {FIELD_LITERAL(0x00e8f0d3f4f178d9,0x007913adbf1e3929,0x00f4104a361cb08b,0x00da7cd5c1276b8e,0x00a5500ba7527862,0x0004890ff81fe0e2,0x00cc775d0a38631b,0x0087e7c67117664a)},
+  {FIELD_LITERAL(0x009dcb3f41f01f88,0x004b6f46e42dfcf9,0x003983a83e8de09b,0x00a02d0b0eb8da5d,0x00463ed6cbbaf577,0x00d6b4310d9dc55d,0x005e64d1ee1f0e71,0x000c2057c68fbaea)},
+  {FIELD_LITERAL(0x006084323cc8637f,0x00e370f76946addf,0x001f2e3b9227e322,0x0061787a74c11cad,0x00fd90a816fe546e,0x00b394da83ca35e6,0x00f8a76ce6751c59,0x00a7bb55ec9027ee)},
+  {FIELD_LITERAL(0x00aad260b9e4cff6,0x00392180bd8422b7,0x001f7de479f24bbe,0x008c11d468008448,0x008f24c46bae7083,0x002779a330262f4e,0x00c4783f373f42b4,0x00b095277ad07718)},
+  {FIELD_LITERAL(0x0017fc370fb35f4e,0x006b8577a6e87659,0x005608762ba977be,0x00e33c14b0216564,0x00b03e8e103f4f35,0x00111d2814f428e4,0x0047c7993153ab00,0x00dbc9994eeba0d1)},
+  {FIELD_LITERAL(0x00e852432ce643d2,0x00d1e5ccb34e75cc,0x0014302328e31b66,0x0027e6e7192b4350,0x0067808127ef42d6,0x00cbfdda58e06e1c,0x004f8236670069f2,0x00cd0226fd1af054)},
+  {FIELD_LITERAL(0x006b041a8010f63b,0x007501286fe8b370,0x0064e886b64bfc6a,0x004195d060cef742,0x00d1427ea26dc512,0x00e5577ea1dcc0ac,0x00264de94f39e201,0x00b10b44e543e538)},
+  {FIELD_LITERAL(0x00fdb488bb7a6784,0x00d3338b6cceaeb7,0x00de1f90e4b40dce,0x0005c5c23dd28f09,0x00eca794c3bdb4bd,0x00a959405e6a0ec3,0x00e4fff46a1c8b87,0x00c50923674c0269)},
+  {FIELD_LITERAL(0x00be527c15ae0210,0x009a0d6d0cbaad60,0x002e52f761c3dc41,0x00aa0591a09e2ac5,0x00270beb01984f1a,0x0009630f019dd064,0x00c4f7532c21e3df,0x0029da47b9b623d6)},
+  {FIELD_LITERAL(0x00962a919bc5393a,0x000b56eaf7753355,0x00ba4b10d9e68a55,0x0012ada86a043585,0x008e6c7d4f11cbe0,0x00f8d8b8fdae8b20,0x00205e85ce29b908,0x0098261b9d5b7b96)},
+  {FIELD_LITERAL(0x00aa9ffd37d3ba9f,0x0061c293313240d1,0x00f6eaff6a21fee8,0x00408ed2306f9a70,0x008b7addc92df405,0x0008359c568932be,0x000cae7e3ab8e6ec,0x00d29b5857a4a8ad)},
+  {FIELD_LITERAL(0x00c6013c157a4c30,0x0080fb7d8dcc9dc3,0x003307e7b4e70c1e,0x00973a38f949203e,0x00f087742cd99d38,0x00c072b5e5ca8c81,0x0052abd59ed15f48,0x00bdf01d5079b2c1)},
+  {FIELD_LITERAL(0x00c6f75c3e27cabd,0x00549a233be09c13,0x00626e21a22c74f8,0x00e3fd75ae12c79f,0x0031612d21bc7c93,0x009ab8bb69884357,0x00472ddef1bacb71,0x00018565bd8071ce)},
+  {FIELD_LITERAL(0x009936160f82d14e,0x006d5c1fee40d20e,0x008933ff218367bd,0x00e25872d7ecb850,0x00e642d6cc8bbf2f,0x00367fb4e056b758,0x008b42dbe45b240b,0x00be3f418c178a2a)},
+  {FIELD_LITERAL(0x0090b430cfb26607,0x00e657743ac765e8,0x00b154cb3a6a1aaf,0x0039a582c478577c,0x0020ce41a69aef19,0x00002947c26cdaa1,0x0052a191d5e79386,0x009f8a9250fffe5f)},
+  {FIELD_LITERAL(0x003caf7b2ac0e6b4,0x0042ccabbba20b04,0x00857d725a8e5ea8,0x00b7f9baeb8c5fde,0x00cd39f79a0baaca,0x001cd9dda8c8ba17,0x00bf273950d1307a,0x00f04ae3bbd7f933)},
+  {FIELD_LITERAL(0x00478238485f9f76,0x004ec575bc52983a,0x00891c827a465510,0x008926f8631d6edb,0x0058b86149a8ff59,0x003ead8166132ba4,0x008949d07570f819,0x001c05da7723c5c0)},
+  {FIELD_LITERAL(0x00f9566f668e298b,0x0027b764fb5a2e3e,0x00386addcbf258a3,0x004040f88c3f25b8,0x00bfd5a68c05c1eb,0x0082d1a72754ed1c,0x00a66d7dcc6a6603,0x00deb568a3dd5745)},
+  {FIELD_LITERAL(0x0067520f8ed7ba11,0x004c3a3c888ccacf,0x008ccbe7435ec820,0x009e92c075ceab41,0x00da99ed1943adb0,0x00a37add28322b8c,0x0080d33ba9f49a8c,0x00b91503370d0763)},
+  {FIELD_LITERAL(0x007eff6368f4bb7f,0x009054c4b4a105e8,0x005d2ebd2b1c29ec,0x00df7c88c2f0943f,0x0083b253f5631bbf,0x00525ee0cd8350c7,0x003d32b2805cef15,0x00e03c8231244e83)},
+  {FIELD_LITERAL(0x005cb443b6ffc87c,0x00c67b0cc7689f3a,0x00a1b5dd4a91605b,0x007ad449850875e0,0x00118350eedc2d67,0x00cd1c475c258f71,0x005b1e7dc9b66586,0x00f22fc1ef95f680)},
+  {FIELD_LITERAL(0x0060c3d282ab49cb,0x00b9e577ef8e9bde,0x0057d2ed8241f0b1,0x000c7cb309045654,0x003c5dc10c4fe4e0,0x00ed20621749997c,0x0048a2c9d9d02724,0x00b29483896990a2)},
+  {FIELD_LITERAL(0x00ad9e997c0e86a8,0x007928bbf35377ab,0x009a521daef3b111,0x00e7156937c695d1,0x00a86c79fe858e8e,0x00cb976653a3cc5d,0x001ad8c72fd8d45b,0x00122d6f7a4f747c)},
+  {FIELD_LITERAL(0x006b6872cf0b246e,0x00d4b9cf2bf53df7,0x00624bdd29986253,0x00006e20b4781ed4,0x0017d3a47e6f0489,0x00d689ab67230ff9,0x001d976976239812,0x0014c5994a791b57)},
+  {FIELD_LITERAL(0x00bece71a89eda34,0x003fbd63d7ec9afd,0x003d9cd9e6d8685d,0x004899ffe43de5a6,0x003ffa8674b6dcfd,0x00c4c214f3b03690,0x00deaf27c04d35da,0x0003dcaeb68e56f2)},
+  {FIELD_LITERAL(0x008e5b38954d4df2,0x001b2e5cf8b68060,0x008c8c9a91c26733,0x004bb2aee10f013b,0x009be90e4961bc3d,0x00d58082fcce5b67,0x00c874057e7bc927,0x00d7a55f644de8a7)},
+  {FIELD_LITERAL(0x009b94a1ce6051fc,0x008884edac517bc5,0x00fb9a87830cda3c,0x00bf2b83fcdd202e,0x00c2039a84df356a,0x00c18f798792f5f6,0x008fd68280313ddb,0x00f119e766da21fd)},
+  {FIELD_LITERAL(0x008090136dc7a887,0x00db20c7571588b2,0x00191ba0656499bb,0x00588af95a2e7284,0x00442f77a15536cc,0x006ed064071cabf5,0x003ab0f4b40dfe48,0x00f4cb01c118ed0b)},
+  {FIELD_LITERAL(0x007d928f59d42aae,0x00fe7b3795f41b48,0x009e18b727cb0cd1,0x0061e96d6c710f8e,0x004ce69ff330efd7,0x00458b63d5af5135,0x005209199d3eb3bf,0x00f0375f71a5b1ff)},
+  {FIELD_LITERAL(0x00c01bc726fa777e,0x00323e700398fab5,0x00c28b96cd86d306,0x00e91db105c2de83,0x0024115441e3368d,0x0028c5318e548509,0x00d5acd9101d1093,0x00e2e02a7f8a216f)},
+  {FIELD_LITERAL(0x009613125c2ca88b,0x00645959366ad94f,0x006a6638c9c0292e,0x0092127e073a7c04,0x0012553192735251,0x001510906ad5dcb8,0x0090956634f3a1bc,0x0017009f55ad0fe7)},
+  {FIELD_LITERAL(0x00f5774ccaf5700d,0x00f1d3eda61116b2,0x004d68865be407e8,0x0003ff00466ddb0a,0x00fe43ca43651a5b,0x00d2708a008247e1,0x00080d7a5f95a0d1,0x00b400c5eec67ff8)},
+  {FIELD_LITERAL(0x00d62a583e3c0a8e,0x008ed31bd7ca0038,0x0076978471628d75,0x0022442fd08fe0d5,0x00943d8c2af9759d,0x00a080c9cfb33e41,0x004d4dcad4bd0e35,0x007a8865f5a222f2)},
+  {FIELD_LITERAL(0x00f1ad53cee5d221,0x005c8d611d618d63,0x0000a626b8bc7375,0x0041e9c2f7923f9b,0x007d62f33391fd45,0x0011ae3c417951e4,0x0013b43486d98380,0x0034924978129c6a)},
+  {FIELD_LITERAL(0x0098bbf62f99f039,0x004100f547cd54e6,0x00eb8817773a629e,0x00080e9fc932bfe7,0x00636e95b93c4d60,0x006546144c39f59e,0x0074ef1bc0c4be04,0x00df709661f25185)},
+  {FIELD_LITERAL(0x002f4a619fd90f50,0x00ebcf1fab2b5681,0x007a10cc07717cc3,0x002fb3e1abbb074f,0x007ce9eae098bf8b,0x0010a7bc7e073208,0x007a245a6a80ce2f,0x0093c60c206cf9a6)},
+  {FIELD_LITERAL(0x0009147a5563823d,0x00ee7d6c09959411,0x002ce52d02d1058e,0x00afea9f41770363,0x00ab4968be7dd24d,0x00e416172d81b142,0x008b4a9fdb0e75b5,0x00b7dec0d5fde49b)},
+  {FIELD_LITERAL(0x004906482116781e,0x00e9275b66f46bdc,0x005706ebaf9f5385,0x008d6a1b630015ef,0x008c2ff71115af27,0x0044aaf1c4a3124c,0x00e25cf517d31a47,0x00429bf08613f4e9)},
+  {FIELD_LITERAL(0x00e6972377ff8976,0x0093d9cf80622d04,0x0095a96af382db0b,0x00991b08883abb5f,0x0086672b76d23282,0x0059c8696d719670,0x0058a73697ac43ab,0x009a28b7af0b1412)},
+  {FIELD_LITERAL(0x004952f37510aad2,0x00dc07d257394710,0x00bb85732c8fd670,0x00b6508ea0cb113d,0x00637ad5593a7ebc,0x00ff5c424bc4cfcd,0x00c8d7a1c6dc3407,0x00f34f7d03494167)},
+  {FIELD_LITERAL(0x00bcdd090640e0aa,0x0027f4665ea011e6,0x00ddfa65c8db7055,0x009c8c93dfaf296d,0x008dce34a2c12693,0x00fe53bc7314d7d7,0x00c50b4f2a0ec084,0x0077af5225722188)},
+  {FIELD_LITERAL(0x00aeb8afe61bb394,0x00d05469aecadfcb,0x00f383a6592cdc42,0x005494d7aa9d57b7,0x00092acf7f48302f,0x00e2cf23c66b668c,0x00cca20f7a6dc9e4,0x00ea2e549872389b)},
+  {FIELD_LITERAL(0x00b0e79e5114542b,0x00dce23be52bfc34,0x00d48a2d090fda27,0x00586bbf42cd9ab0,0x004c853ff1613570,0x00ef29f8e9925f4a,0x009820b4516ee528,0x00c5e3c32cd8eb4c)},
+  {FIELD_LITERAL(0x0031bb6d7014beb7,0x00f5770047cfd60c,0x00509a4b9db90311,0x00db25a48aa10c2b,0x001f8aed83bab210,0x003d2ae1a9e8ccbd,0x005de572b2cb61f9,0x0032c19e2ef775ff)},
+  {FIELD_LITERAL(0x0003367522116c8a,0x00975f4878e8f19b,0x0037b62037223681,0x00d741594171f275,0x0079a94498437942,0x0028997929a7194f,0x00e654ae541b3057,0x00c16faed26d565e)},
+  {FIELD_LITERAL(0x009009cb75e45c74,0x00f44f6e0ca80d4e,0x00b96a854f1068af,0x00a0ca04d4e5baf6,0x0011eb7080cce32d,0x0038211c2638df4a,0x008450365f0ab520,0x005362097d1520a9)},
+  {FIELD_LITERAL(0x006eb43974f93b0a,0x00c2befd8f3c764d,0x007025bcd04459b8,0x00937ca3f632687b,0x00848bfd106254ff,0x002312195aed5ccf,0x00b426a7b87d42f3,0x009a83fd4e689abf)},
+  {FIELD_LITERAL(0x0072b800c79a6be8,0x001e35d7a3ba9e1a,0x00d5b377fce6fd69,0x000d502970c75b2f,0x008616b28ee0a20c,0x00fc6947f7a18ef0,0x00c35c9502dea09b,0x000fc900bd8155d7)},
+  {FIELD_LITERAL(0x001a32386488dd3e,0x00e314d7cb7b97bc,0x00c20fa48f697a33,0x004e10870cafc882,0x000503f408efd9ba,0x003e81c5d1917e25,0x005bf5854c03000c,0x0096ba563e3aa0e7)},
+  {FIELD_LITERAL(0x0074764e5ce41ba4,0x004644387d1c5501,0x00ed86b4317eb442,0x00c77c606a737f4b,0x00f3d58eafa2ae34,0x005607f1573e69a4,0x0088322c245eda2b,0x0064f6dcebd9bcd2)},
+  {FIELD_LITERAL(0x00bf98c34f7b5f52,0x009737fe8ae68a81,0x0041e2256ee47a87,0x00c1b6ce880b1cdb,0x00f47c5443a88ef8,0x002e72d1226892a6,0x00694e8252b4dbb9,0x0032af5c0104a192)},
+  {FIELD_LITERAL(0x008f1919dd8af26e,0x00b5d5aab0fd7eae,0x001865e31fccca8f,0x00c31445cb312634,0x002ad2f143beed8b,0x009846e8073c4ef7,0x00ac3bcd85dde01e,0x001d47dc2a3954d3)},
+  {FIELD_LITERAL(0x00ec7e0fa6ec670d,0x0065db832a8ce09c,0x007360621eafb881,0x0066ac5d9b6597f6,0x00e420b1ffcb452d,0x003d3c37320902a9,0x0056c070e3279569,0x00feaa4c9f67564d)},
+  {FIELD_LITERAL(0x00a2f6e6e69babbd,0x00bc2ab6f7f61178,0x00f2cae24325b9ac,0x001895b6f0e817bb,0x00e83402ddb286de,0x006a4b2eeb92b154,0x00f62d6520da8b43,0x007d838256628826)},
+  {FIELD_LITERAL(0x00007d72fd494a8c,0x00feec3e302cfe75,0x00be11a4dbb11de9,0x004e9e126175e3f8,0x00e8ef8b7b3e38c1,0x00eef63e72c93714,0x0025fe0939f3503b,0x0047b3a4d6d792ed)},
+  {FIELD_LITERAL(0x00484244d2f894f4,0x002f2020947aeae2,0x005ce407539f10e7,0x003ad4902a0cee2e,0x00b04c7e1c7bf897,0x009327806ebe3673,0x008c4df25dae2fa1,0x00d51a52a2d72b85)},
+  {FIELD_LITERAL(0x008ba6db080f86c5,0x003fbe63c1a49f2c,0x0043a5df077ecb13,0x0049e4980014c572,0x0027e463da877c63,0x000029e8cffc6a39,0x007bde7a55b33292,0x00128848bfbfef2c)},
+  {FIELD_LITERAL(0x00c1aaab0fc9b09f,0x007de09b2113f40e,0x0077e50b261ba47c,0x00f793597e39a506,0x00328ea1c2e8b0c2,0x0012f332a9237b9f,0x0091849b86be5c4e,0x003a8288fbb283d8)},
+  {FIELD_LITERAL(0x002171a61bdc221e,0x00a666c34c7a4552,0x00adacbca06b667e,0x006203190454db82,0x0004d8a7bb1ebf74,0x007b171223b96ef2,0x00e7cdd53ddf7047,0x00895cf36ec7c866)},
+  {FIELD_LITERAL(0x0017be3bd87e88a5,0x001f686687640691,0x00cc3719b88fb7d4,0x00c241b0cbe769e7,0x001e3b0f8096c911,0x007f9c6a550617ab,0x00776c105dcd3455,0x0088be2d92253689)},
+  {FIELD_LITERAL(0x005d80e15d290bd9,0x0083fddbd842f140,0x00098b2729f152b2,0x009fcf00274f5706,0x008d9ad617dbea5b,0x00d16db74286bc25,0x0037adbfe14bb4e9,0x00da6996497e93ba)},
+  {FIELD_LITERAL(0x009ea038512922cd,0x004507dbaf719ea1,0x00b7c73970ae05fa,0x0094ba88a9d01d1f,0x009fbfe51761de3c,0x009d165ee15b4ede,0x00df01e0e70bc1ee,0x005c053eb5b0efd8)},
+  {FIELD_LITERAL(0x00151d08bd6798f8,0x00e61e32b4212904,0x00d989cfb13ae20d,0x005ed153b84fd7de,0x002b29035d1c034f,0x00ba2a85c9305588,0x00496c0eb25cc03c,0x00feac0bcdde62d8)},
+  {FIELD_LITERAL(0x006290aa7e7c7dd4,0x00153d38f6b136f7,0x003ac4c1371a5187,0x004383a0bd73d37d,0x00fbf5e20dd24eca,0x002e110e00f22469,0x00ee5ee9feac0a02,0x00b6ae91c54dc88c)},
+  {FIELD_LITERAL(0x009ba7bc5adc2415,0x00bd676ffdff4ee3,0x0058850be8912952,0x005a996a06c7dbe6,0x0069fc1933482d03,0x00dc8d9bf65d293b,0x00d5c95aee601a8f,0x00d7e0cef7c19033)},
+  {FIELD_LITERAL(0x007180a95494cfb8,0x00aa77909bf49552,0x008f35390e58f98f,0x006f94f6fdccb0df,0x00780e820e4e1ecc,0x007923e288b0b658,0x00c9c8bd0b1750d9,0x00ad5c5ab755ec84)},
+  {FIELD_LITERAL(0x00d833d21c1745b5,0x00e8a44d6665f7ff,0x00aac6fbec602e26,0x00420e4885ac6f38,0x00cdc733468a1503,0x005183ebad5207fa,0x00d0b6252c526921,0x0061b914166bfc53)},
+  {FIELD_LITERAL(0x00ca46100378571e,0x0035c909be35df4b,0x00441c6a6e37ef0c,0x00307aa3c7af98c0,0x0035c8fde555f7a9,0x00ce9b1fc68def94,0x004764bdf9069e0a,0x00d36bb766f2f901)},
+  {FIELD_LITERAL(0x00f0c300d267a108,0x00a2155f3f14c2aa,0x0097fad2061d19fe,0x00e2904b5499efea,0x00fd2d4915620d6b,0x00ad8e1dcfe76853,0x00c91aa38b4a6c1b,0x0050799d719aea25)},
+  {FIELD_LITERAL(0x00ec53d4577d3a31,0x0013ae134c714ddf,0x00a782703a499fdf,0x00a744888855ec48,0x00590d6b10cf7701,0x0076a9bbc73201aa,0x005fe8f69b3950aa,0x00f42e264e60864b)},
+  {FIELD_LITERAL(0x00dd16d652cef998,0x00306dd5aab1ab8c,0x007e6780a1bd7e7a,0x00b902349e611ef1,0x00857c5ffaaacf4c,0x0041c38990ee71c2,0x00834e2894611f23,0x008eeddc4881d249)},
+  {FIELD_LITERAL(0x0062a4416a227e5c,0x000952e4c4d740b2,0x004517e57eb79045,0x0094055afa160e7b,0x00e818e68931ec7a,0x00a1efb67d009a58,0x00d205e556b058e7,0x00d4889b891d650b)},
+  {FIELD_LITERAL(0x001536bbf5839262,0x008237e3192d9cce,0x0088ead9ecfc0fde,0x00ebf6587b5f565a,0x00d1e8e4efddead6,0x004826732a8c7f82,0x00ca665ebc09e689,0x00d8c895dab5251a)},
+  {FIELD_LITERAL(0x005f9fde56979fa3,0x00c645ebb85458e7,0x00fb8fa1622a78d6,0x00a54a13083aced6,0x009893125135d348,0x0010f1a382a8f177,0x005d8e7a769f9fe6,0x005fab565c3253fc)},
+  {FIELD_LITERAL(0x008414c4f96881f2,0x00dacca0113267ce,0x001aa4d32e6eb440,0x0060aa13138e6c65,0x00e00bae4c8acb2d,0x006e7a94934834ed,0x00f7d3ea40321eaf,0x0049a185b14ad963)},
+  {FIELD_LITERAL(0x006121b473a674ad,0x00f7f1a5dfd57d99,0x000da8b7c8271f57,0x0067b8b96923d4f9,0x00547b61729151ae,0x00691e5ee33683c1,0x00bbe7d80c43f6a5,0x009e8a89c8d06023)},
+  {FIELD_LITERAL(0x008ec34a87b99f36,0x0017f77bd17b3e0f,0x001f3ed48b4d62ba,0x00d83f16512a39c7,0x00190d2bb5a115b1,0x000d20d120b70945,0x00d5c65ce618e101,0x0006433fb5acd4bf)},
+  {FIELD_LITERAL(0x0056706af697c0a1,0x000de7ae11e7a817,0x00116e56e99e9e6f,0x001d902d01110e4f,0x0055456f51cf3df0,0x0035c2de9b13efd3,0x00f889a33857f18b,0x002c51822c3be5de)},
+  {FIELD_LITERAL(0x009f14de81b85cb2,0x00655514846b3b56,0x002dbd4883c6ec65,0x00e42c1346d8e3c2,0x00bd647b482c040d,0x0073a0c90fa9fe60,0x00a56d35e94dad86,0x001bb554006fdd7d)},
+  {FIELD_LITERAL(0x004b5802764093ed,0x004685f0eea05455,0x0010b43a82733a3e,0x00e1363dbce4cd81,0x00c68b7c3089196e,0x00a0c9f1478cd8da,0x00b6dd840afb7e25,0x000464bfb99bc669)},
+  {FIELD_LITERAL(0x006ff08397510b8f,0x00607dfa76f393ba,0x00d20ffe62c90e6f,0x007d4e4c95eaa167,0x00227b6a34d85942,0x00c16eb22a3ce7f5,0x00dd86b82ee2a38d,0x001d4368012b0118)},
+  {FIELD_LITERAL(0x0010fd3f61ed0e53,0x00350e94673b00f9,0x007e90b966db7cd4,0x0004aa4a34040178,0x00fa274fca793698,0x0093bde6108b9320,0x007ea91f5681379c,0x00d2e8160ad2e987)},
+  {FIELD_LITERAL(0x0061a485ad15fda4,0x00601061df96d76b,0x00404ef60f5a65f2,0x00e0faa0cb0357f7,0x001f764691551f83,0x00b292f9ffa35a86,0x002a506c3fc4e1ab,0x0037574750a0db34)},
+  {FIELD_LITERAL(0x0057b504c9643cd3,0x00f436829a725abe,0x0070c3a8dab819c0,0x00b82e697d076266,0x005f9139f0635922,0x005ce28440eb6322,0x005205a3220dc3f6,0x0092e0c692a827ee)},
+  {FIELD_LITERAL(0x00bc3ed6d67ed094,0x005e57bd8889a654,0x00ac3ae4b882bc79,0x006a8ff9afc4a360,0x00b4c79928dcd7d9,0x009271c2e420d77a,0x0058c78af8d55349,0x001f0559020cb381)},
+  {FIELD_LITERAL(0x00137c9a013ec089,0x003837b7c5237ce3,0x00ea041a78a12c62,0x00afb0f5629c0da7,0x00fe223b48bcc602,0x00e083a453d88f3c,0x00bf846de9c7e459,0x0044bcb187db64ee)},
+  {FIELD_LITERAL(0x008f56c550e24e1d,0x0031a5e73ad568ee,0x00a6e75b8ebc5c62,0x0084ebb0f80e8b00,0x006a553c5d6f1a04,0x000d48f1b0b289fd,0x0077833a0147831a,0x00c7b1912c75142d)},
+  {FIELD_LITERAL(0x00d4fe186632e085,0x00855c53995962ba,0x00e8399a7b23e087,0x00fdaea6a0af2159,0x00f2497ecbd37c05,0x000498062ae08b25,0x0015449c3062885f,0x007f190e5114826c)},
+  {FIELD_LITERAL(0x008907d35774f7fa,0x00ee81a4f940e559,0x004b224ec2f17f9d,0x00588568b65ccbac,0x001e296208a59522,0x003c6e6315f7b9cf,0x008e30e0b76da7bf,0x00e4f6cefa729e0f)},
+  {FIELD_LITERAL(0x0042a25f377192d4,0x0008c4d3afaaf5a0,0x0055a3e08a2dfe28,0x003330cd961ca83d,0x00ef7fac95cc1c51,0x0081e0654a9668ad,0x009a7d107d7a21c2,0x0036d89dfb6983a4)},
+  {FIELD_LITERAL(0x00fc7d5902a4b9e0,0x0073b6674d27fb17,0x003dfdae0c13575f,0x0072d8d782876f21,0x0058e0d7c03b902a,0x00857af4d5e82824,0x004d9aedda938ac9,0x007e197ec5da427c)},
+  {FIELD_LITERAL(0x007910f73e697cec,0x001ed92cf100bc91,0x008c05f99a21a413,0x00de1039596bba00,0x00bc6e3841174d07,0x00f78345ff4753b9,0x00ac04546a73ba57,0x00be2cd4ad30f4f4)},
+  {FIELD_LITERAL(0x00e9e39af2ac7c8b,0x0054f08f0d9db7da,0x0062ddc558142baf,0x00029bd224b9e585,0x006cf73c47c2b261,0x009e0f2487b1541b,0x00540efa65189971,0x00f531f52322da34)},
+  {FIELD_LITERAL(0x00801717ea60b500,0x00e02fe2715830a7,0x00a3fd7a14c9e40b,0x0061fcde72901af3,0x008b2016cf56a544,0x00bcc13d5aba8e77,0x00c44cd87c60b119,0x005dd3fd6f5eacf6)},
+  {FIELD_LITERAL(0x00af8fb51ce45b57,0x00a546ad66585551,0x00bb072a8c752261,0x00b158d28b8f3887,0x001338106adce2a4,0x009d385f986eb2e1,0x0009fd2fbd621656,0x00e069ed1af5ddf8)},
+  {FIELD_LITERAL(0x00472acbeccec246,0x00cbc937c56075dc,0x00d4f16f4ec3964d,0x00d28cfb0cacfae3,0x006982d209c4328a,0x00bff300f064cce9,0x00e1e178814310b2,0x00d7ff88293b2dbe)},
+  {FIELD_LITERAL(0x00cddcbb3fa0cdb9,0x0045a828fab6b045,0x00945ea850dfc52a,0x0073c3056afb9938,0x009f1407b50fd67e,0x0037abf2a2cfad8d,0x002adef947c525e8,0x001f9a019c111157)},
+  {FIELD_LITERAL(0x0037e2e38ad63f96,0x0040681307dfa5b4,0x00b0eeaa0ead14b8,0x00cfd2547c92d410,0x00e147e94621d137,0x00ea5550683b233a,0x006d4fdfbbfdae0a,0x00ff09e94cc5dc91)},
+  {FIELD_LITERAL(0x00fd9171a2f16c42,0x0006723d2d9f2284,0x000692ed4197b996,0x0056fb7fac47a9e3,0x0070e3a0917e6345,0x00d25ebfe0c2dfd1,0x000867266e7bf26a,0x0008db70bd212b4b)},
+  {FIELD_LITERAL(0x00da41ab1e6ab638,0x0052a81cdcdbd654,0x000e6f201169fd5d,0x001d8295d501db3c,0x003edb6ef95906bc,0x007804ed14fead16,0x00cb2f6371d3fa9c,0x00af9d36e825c977)},
+  {FIELD_LITERAL(0x005aea14d5234d80,0x00c90a9648dc54f5,0x00edf2095f10d6f2,0x004f4b512b3e1d1d,0x00fa4f763910b1b5,0x00aa6552fe0d88ce,0x0044a33f97979784,0x001c333ca7bc6a2a)},
+  {FIELD_LITERAL(0x005b2b65635ad917,0x0090972dccbafbf5,0x006655a5cb150c87,0x00988d89a330525d,0x0014d6097a95ee9f,0x001d15f971244e23,0x00e9d3c27614f86e,0x00e6b788dec1ab3c)},
+  {FIELD_LITERAL(0x00c897f5494896e5,0x003aed5be0f4ee29,0x00a06488dc6ee00e,0x00ec231fcd2fd9e6,0x003ab43703ab9ccd,0x0029c6071473800d,0x002decbc71d107cc,0x0066b73a72cc2b42)},
+  {FIELD_LITERAL(0x00b8dbd0a29b71c7,0x00aee73f530b2e62,0x0061a06dc6019c42,0x0049f0234a0928ce,0x00f6fdc6cb72538d,0x004f54bea1a28eca,0x003a3d4b1b89e1e5,0x00394b59edd5964d)},
+  {FIELD_LITERAL(0x00bf8cd6ee1dc7ae,0x00b6b32882926532,0x00eb6c152aeff13c,0x00127ed4ff0b626f,0x000cddd4f65ae5a5,0x00ddd97dc5e30c22,0x00ecd4cbab2468d1,0x006e8d2134e2c5c3)},
+  {FIELD_LITERAL(0x00dfd60442f5a5b2,0x00c06bcb8e54367f,0x009f9a36d4945cf3,0x007ce6bdc3ee422a,0x00d6041854c20acb,0x00ce4618869517c7,0x00e38f08cbd5cbc5,0x00df9569458377f1)},
+  {FIELD_LITERAL(0x00a7e7325d64840d,0x00ab09d9007a5bf9,0x0060c007b2534e56,0x009ac918d80494a9,0x0003c8090b667727,0x009986ea1ccc5e1a,0x004947924c629686,0x00c51f8b0f30ed9f)},
+  {FIELD_LITERAL(0x0064d28ca9a36256,0x00e344cfeec5aef3,0x0053fdf4d2474680,0x003064a94c9c7d98,0x00a21917be130535,0x007c14f1c21b7a56,0x0013403270f48a40,0x0060141004ace4c2)},
+  {FIELD_LITERAL(0x00a95834978c8486,0x00f9c93537aa271c,0x00ac9b24e4f4f3f5,0x0058bfac0877a239,0x007571b3c8b9bffc,0x0086c744dd3884d2,0x0042fc3b870c30c8,0x00e514591c9d11a7)},
+  {FIELD_LITERAL(0x00167e221fb2b505,0x00d51c0c56f48bc3,0x002767cc24028973,0x0045b869b17accff,0x00b504326861236d,0x007cc6382755944a,0x009bd05b2612e128,0x005d96221e6209dc)},
+  {FIELD_LITERAL(0x007627810be48251,0x0074d1fe49ee3e39,0x0023c23595153d00,0x00be6ac78ac94396,0x0044dc71549fde17,0x00a87a615aea8898,0x00f5df2888c9d73e,0x008fecf507a1e3d6)},
+  {FIELD_LITERAL(0x00496e51933970c7,0x009026476f6362bc,0x0040e1bf807bdf11,0x0079856a9afc5ab6,0x00ac4324101cd98e,0x005a4038a1705043,0x006af2d43d176d3e,0x005b06084f4bb23e)},
+  {FIELD_LITERAL(0x00d46ae266df749b,0x00f66217667f6ee6,0x003843448e7aeca2,0x006062dc97ef72f1,0x005dd1d4d9a2877e,0x00f7a2f09ffee830,0x002a60ccaa7f75d9,0x00f0657c38be5e5a)},
+  {FIELD_LITERAL(0x00bd5995a3ae58a9,0x000213cebc372f78,0x009b47da991973ba,0x00e8c0a417dabdde,0x008f0dd0c35044f2,0x00422438ae909709,0x00de7011aece321a,0x007f7738566a7e56)},
+  {FIELD_LITERAL(0x0060575d94c8e87d,0x00bd179ad7db2b00,0x007cec84c849ec94,0x0061e771fb59c02e,0x00b0bac77185d8a7,0x009c7946269a6b6c,0x0079c8088601fa6f,0x0031478d8fb71fa7)},
+  {FIELD_LITERAL(0x00f8ab6726210bba,0x00ebc885f9ba9e9f,0x00c80c510cc73040,0x00eb22f003857c25,0x009d1d170fa82738,0x005540d8ca11acb4,0x00001efea3a64c60,0x00ebd1f7132ee408)},
+  {FIELD_LITERAL(0x00c98f727f4ef7d5,0x00fb110b72f95b31,0x00edcca780b18e8f,0x007643c42251908f,0x00f50ae64b6189a1,0x004faa1d3ac99782,0x00d88a671b75d4b3,0x00d3e81240151797)},
+  {FIELD_LITERAL(0x0008302460b73385,0x00c3a65f58482ccd,0x002f2c11bd738863,0x000a64eae613a92d,0x00f3409cfafa137c,0x007ecff34070ae12,0x006c172b74f6e6f9,0x00063c61901a26ea)},
+  {FIELD_LITERAL(0x00537ce23da50e85,0x0060f5110c8df5ca,0x00a2fcb0728aad6e,0x001412b0f0f084e1,0x00b14d871602592f,0x00aa380e1e7bff13,0x0062cac4df51988f,0x00f354f930bdcd5e)},
+  {FIELD_LITERAL(0x001012f3bdcdb675,0x00452652895f7dc8,0x00bb5a39f562ee8a,0x00170bd24378e0fb,0x00b6b0f84d4e8cad,0x00ff3279341d7e6e,0x00dde0cfe6a46d67,0x005b7ad41cf702f2)},
+  {FIELD_LITERAL(0x00214b4363e3b0b7,0x00e23c6c3c24115d,0x00f3dca7ed432f05,0x0052384b33a60e60,0x008ac9acd266d70f,0x004a0da18147498b,0x0082bf7caaba155e,0x001fe3faf962ed68)},
+  {FIELD_LITERAL(0x0017ca7775f9f176,0x00c47cd52a07eb44,0x00d01c669a8e6553,0x00365484d91341a3,0x0023596fb9b7e468,0x0000ca9bb7dd64b6,0x00825214f19caf65,0x00b50fcdca043b53)},
+  {FIELD_LITERAL(0x001f15aff9c82781,0x005f176bd1f6d090,0x00143d9d3ed428d9,0x000770c9934dfee1,0x00d215dab7e10fc6,0x00367da54e08fb28,0x0059e53056447334,0x00819a14b539d701)},
+  {FIELD_LITERAL(0x00c6119614f7418e,0x00d3820a36d9b214,0x00ac75b9dfe85708,0x0094e18c5b66c217,0x00371c42436d36a4,0x00cb2eb9af4aa35f,0x00db5da4f8e2157d,0x00e6f6fa27b420c1)},
+  {FIELD_LITERAL(0x00dff317efde5795,0x00e9459156582e75,0x0043f6b04f05e5a1,0x00ed0aa411f2dbf5,0x00d14139998c546b,0x008022980b25bf4e,0x00844ed7177a7cfe,0x009def8720b0c2df)},
+  {FIELD_LITERAL(0x006fed733eeab3e1,0x0086e7e9ffa1dcd2,0x0076c7fb2effe3cc,0x006e09ce429779cc,0x0007b575ae12e535,0x001fa1bfb0a8963a,0x00929db6e80c6b45,0x0065267b5a2bb298)},
+  {FIELD_LITERAL(0x00deaa09bcc877d3,0x00a0684af9d1f713,0x00fe776b425d1b2d,0x008cc52759aa0576,0x005dc70a3d857b45,0x0059ef0e47d086a0,0x00ed7cc25f1adcad,0x0089398d3476a9c1)},
+  {FIELD_LITERAL(0x00e124cefbd8e118,0x004ce6811a877bda,0x00073e3152dc5109,0x00e019378b9863ee,0x00eab41872051680,0x00c3c0d002c0b960,0x002faf2607ff6daa,0x00d7efbbcd55d153)},
+  {FIELD_LITERAL(0x0017d15d4ac4f103,0x00fce6dbcd3c8078,0x00cc4990d54db62c,0x001b53164be5d4ab,0x0065f0f6e9797b26,0x00c66cebb7b07d40,0x0022b6e0bb13f6d4,0x00ec9df0e2391858)},
+  {FIELD_LITERAL(0x001ab85729d8ee86,0x00e8ea60d4117442,0x003bae858853bb9c,0x0000146d56eee349,0x007e3ee96f2c798e,0x003689c263cc44c8,0x00581ed4739cef62,0x0001511ce67e67c9)},
+  {FIELD_LITERAL(0x00985613d4bf61ce,0x000fcf581a597f17,0x008921ed3a64f9b0,0x00516f5cebbd066a,0x009fd7ffb7872167,0x00ed3e5de0944554,0x004bc6b5e1b809a2,0x005ee5862812f860)},
+  {FIELD_LITERAL(0x003f0b9c1437e35f,0x00119da4f6eb7da2,0x009bea46edd85f4a,0x005d9e6939e8fabc,0x0097b626eeb6372e,0x0096d4f60b46f633,0x00aefb7e810dcee1,0x00e9067731cae8c5)},
+  {FIELD_LITERAL(0x0044b4da3e9a3ef0,0x00185807466afa05,0x00c790da3b382f49,0x00b2880bf88a56e9,0x00afb18b18213485,0x00fb35805f329083,0x0089fd5b88373d5c,0x00b2c69c1e678f82)},
+  {FIELD_LITERAL(0x0068f1605df63ec7,0x00a7f8473058b7bd,0x0058e277ac0b0863,0x0019f99bb8d1ad5d,0x008ea9cb3fd44f0b,0x007f8a8075b4413f,0x00aacc55f5de8ce7,0x00627163e72215b7)},
+  {FIELD_LITERAL(0x0084323a0ebe776e,0x0085a6f6c7f936c5,0x00436eda075a41bd,0x00c22d843babdf93,0x0052d6a77264b21b,0x00c5c0530f4144af,0x00c6d98d3bc17442,0x0070b99ebb2d5494)},
+  {FIELD_LITERAL(0x0095e68bb254ec07,0x0003189710bb56e1,0x00b8f21ba323f347,0x0095b625fea415d0,0x004f71f76ca9b0e3,0x00df06a1737c97bc,0x009e1b256b165370,0x00e27f65c4231b70)},
+  {FIELD_LITERAL(0x001196381afe5ea4,0x00f4500716306df1,0x00b03ce42a58a15f,0x009c7fe72d1dfe55,0x000533d15be36072,0x00ae59b7ef08a42c,0x009e9b2536fc1dca,0x003dac66f9bfed91)},
+  {FIELD_LITERAL(0x00d70f658c907979,0x00f405b48eecae53,0x00726c108f7f9b8d,0x00b2afb6abd80ce6,0x008ab0769cf13956,0x008ed26ed18a0627,0x00cd00e10b710b21,0x003a2063715d84fd)},
+  {FIELD_LITERAL(0x00da62bc546b3bec,0x0086a57e5e1b5729,0x0065880d0595ec81,0x00a731909fb640e0,0x00dcce28896b0134,0x00aa0f48c136b575,0x0072c1673473fefb,0x003ea70b54387149)},
+  {FIELD_LITERAL(0x00248ae324f684f1,0x00caac7558e646ae,0x0053db2733485057,0x0088794f81d8fb62,0x0081b9b0c34b0bb4,0x003be716eade5da5,0x00c2881456e98ed7,0x00391b044b22b2b1)},
+  {FIELD_LITERAL(0x00a1f9d2a8940b5f,0x00b7c7d9b6a2dfa3,0x003c1e6754ac3223,0x00a0302b99ad3b36,0x00de9cca0be2fb04,0x002f11e208a0664c,0x0004895abc01941c,0x003c190500511be3)},
+  {FIELD_LITERAL(0x00113a154ec0f84c,0x004770cb29f2c39e,0x00d122436ab4cf36,0x000e755832f804c7,0x00c6101416fe631b,0x001a353f12cf082a,0x000347ef76904809,0x0096d0af686bfc90)},
+  {FIELD_LITERAL(0x00be6c98e7e0967d,0x006c197882c50106,0x00bfa31b57b99ef2,0x00e2794df2d24a3d,0x0009ab31166572d5,0x00b41394a7302615,0x00c23128decba95f,0x00d5b81f8ac22647)},
+  {FIELD_LITERAL(0x0092e1948e7333de,0x004ff39f4a864da2,0x003f50d8a626cf55,0x00df8a00ce633a8c,0x0088523939641430,0x00f69dc1a8556de7,0x0032dbc0196359e6,0x000473e86b62f6ee)},
+  {FIELD_LITERAL(0x003e4bc9934b9713,0x000bf7a94c363d47,0x00685c47c48f2a38,0x00fbe836ddeab389,0x005c9866c0d82678,0x004d08907dbbde10,0x006d84c09aa3ae64,0x007a07e68269d76a)},
+  {FIELD_LITERAL(0x00d220c987d6ac7e,0x009fa702c3fb7664,0x00755a952750a296,0x00e9db013957b609,0x00438cda352c5b5b,0x0094f3b74c9fb920,0x00c23da00847997b,0x006e4a8de248f099)},
+  {FIELD_LITERAL(0x0041075cfaa3afef,0x005318e62f1a89c3,0x0078b2fc92ba65b6,0x00c7bf47d0b6e6fe,0x00021f0df2534f8d,0x0019d55454e9af00,0x00758d6a9a2aa8f8,0x004144806f811eca)},
+  {FIELD_LITERAL(0x005cd148ce30e9a3,0x000fb7dcc107a0f5,0x005a1dfb35c38435,0x00cb66c9b9ed97a1,0x0058ca095a995b8f,0x00eff4397c3e9788,0x00faf3269db96857,0x00ec4e3f0ffb5d1f)},
+  {FIELD_LITERAL(0x0023a0887c7e2703,0x009aa6400bf8aa36,0x00dad10629f3a38c,0x00a8a6fdbea545ee,0x006321a8074d1ca4,0x00ca7c763fa59220,0x002c92361d39b441,0x00ae64821506e5d7)},
+  {FIELD_LITERAL(0x00106cab2b0f080c,0x00183f9f08ed0641,0x0040824b74ef4ceb,0x0091096708ef163b,0x00f5b21b5783a3e5,0x002b7a8ce29985b1,0x00a1b3491a45101f,0x00f7369ba28bc3b4)},
+  {FIELD_LITERAL(0x00dd439798861127,0x00c428368ef409fb,0x004674268b454b11,0x005aba84919f2bc7,0x00cda7b2a4e09ed1,0x008b169d7e6d8894,0x0040c775412fd37f,0x00c3a7b91f5d1cb3)},
+  {FIELD_LITERAL(0x00c1d07682afbfa0,0x0021a9cf2f7c4723,0x004d318b3265bedf,0x00ff5e20ce9a30c7,0x0039d047a473d45e,0x0008cc34016d2ffa,0x00db48cbeb33945b,0x00992784f51c894a)},
+  {FIELD_LITERAL(0x008a0033a97ae0a8,0x00fbcf41879303b0,0x00371c053b02afca,0x006fbba7e1f3868a,0x0094cc30bf276f9c,0x0071b925e9c07115,0x001de80c7f466b52,0x00e4dd2e7824e03a)},
+  {FIELD_LITERAL(0x00bc340df4599c9d,0x0030362ab21541d2,0x006df0bb56ad13be,0x007fd536ac6c2587,0x002d6a6419609f4f,0x00d01ee44eb85640,0x00791d3afed00f71,0x00ea8991caffaec4)},
+  {FIELD_LITERAL(0x00f0786a82d32086,0x008d1e484d7a83ec,0x005dee66f32558be,0x00230e7bbf89ca84,0x0076f2d183de8854,0x00aa809e8e18be26,0x000d1befa89debd1,0x0062070ee47d4856)},
+  {FIELD_LITERAL(0x002dbf40d6ece711,0x0004c37ad0333214,0x007d1cdd4e98ddb7,0x001fd18090988dc6,0x007139a716d3b388,0x0029d40e86ea21da,0x004c97907162532f,0x008de8251e2bb79a)},
+  {FIELD_LITERAL(0x0017fff6b56ae1a1,0x00c806640b759c24,0x00d8cf9391b42be5,0x0032f80c58dacbf1,0x009e396084b67eab,0x00d894302ec2ab6c,0x00ce9fd4935687cc,0x009cb1087459712b)},
+  {FIELD_LITERAL(0x00a45dfb14cf92ff,0x00bfd241a57ade97,0x001021113d326612,0x00c0f78b15fdc8e9,0x0091a6ea20c79775,0x00365579ea4881fa,0x007028975cfe9bf1,0x008f5b53420b1765)},
+  {FIELD_LITERAL(0x00ea41f7c2ee79bc,0x0020f6ff1751a5b4,0x00d275aa993ce1f1,0x003ec0de39f5aa4c,0x005481134dc059e0,0x00c8cb2c48487f4e,0x00466b1f8cfcc4d1,0x0090cbd4b10bb109)},
+  {FIELD_LITERAL(0x00b25b3b69bda92c,0x0007c47c00965f59,0x004d67be1f7ab0df,0x00529cb07f79a888,0x00ef9fd4853f723a,0x00b99f7fb605fb2b,0x006e262b1c2c648d,0x002794aef7638b6c)},
+  {FIELD_LITERAL(0x002f2ec86d8a7211,0x007b79bec7bd393f,0x003ab7fe2030c0b3,0x0078d2639bae8625,0x005307220db500c9,0x00716a0da679a54f,0x0079c0ec9d977936,0x001b7a199f336e0d)},
+  {FIELD_LITERAL(0x0020338acb3a4b99,0x00757d1e0093be44,0x0096e87e05d35b85,0x0046c0cf9dbe0e17,0x00eb5f429e4cc357,0x00aadb8b630d3c77,0x000c597588d47632,0x00775786957295c3)},
+  {FIELD_LITERAL(0x001ab674a9afaf49,0x00ab8607b0805a9d,0x00ddc08b96a99fc4,0x00ef59914abf49c6,0x004ebf849ab89367,0x008da617f1b29b3c,0x00a8d2ff3c1d1a0f,0x003fbdea2b1441b3)},
+  {FIELD_LITERAL(0x00f94e686e3cb9b2,0x008f71782436b566,0x00c77f2d00c436dd,0x0017a68e73286bf5,0x00bc148415dc6eb8,0x00d7338696d216bc,0x00efb969d192b9b6,0x0074cae12a4eb3f7)},
+  {FIELD_LITERAL(0x00c5ad53de2da2bd,0x00faf0ebf8c405e6,0x00c00bc056d75a70,0x00a25a1a1042db07,0x005bd590cbce2375,0x003bec8a2fcff1d5,0x00a0d0fed5e17346,0x0060f80b341ce818)},
+  {FIELD_LITERAL(0x000149fba7df5fb2,0x00a49ae20679db19,0x0091b7b8188f70f0,0x00e634b7213d2159,0x00ba805788b764bb,0x00e2d1c529749878,0x000264c1c7042871,0x004acf1284f15c71)},
+  {FIELD_LITERAL(0x00e6fd75e0b865e0,0x00cbe1d5e9c9fb75,0x00673ab08f166c4d,0x008390cf1b45d132,0x006e4d81dee9c923,0x007632e9c936f1e2,0x00774c1e323a304c,0x00b4ad1a913a0eb5)},
+  {FIELD_LITERAL(0x00194e06c409062c,0x00742e459722083c,0x0009e64f34613f50,0x00e099b07b52c6cf,0x00772240c9fd40f2,0x00317ef6e6ccfa4e,0x00aca197bfad5123,0x00714586cb71e646)},
+  {FIELD_LITERAL(0x002de63c1ca80cf4,0x00b83ab6565d49a9,0x0096be669d4bcf6d,0x000e98e4dc7fc937,0x0000ac923bef1459,0x0061bc683195b1e8,0x00c9fa20b89382ba,0x007de22a01d28824)},
+  {FIELD_LITERAL(0x009b4afd24fa0700,0x00c196ed6ac862e8,0x00eef925e0177435,0x007f43e8fe5759ab,0x00377bf567b02b4f,0x000f443bb1a0b04f,0x00e651ca3455c981,0x00d3cbc9c0f1ed36)},
+  {FIELD_LITERAL(0x009dcee99c308603,0x00ca71c55efa9b2e,0x004a5f885291150e,0x004e91e4be1c0a96,0x00cff0ad0a613d10,0x00101e8281ed974e,0x00e4ad84a23f800e,0x00dfa13d693b9711)},
+  {FIELD_LITERAL(0x009ab0b27a9339f9,0x00955c74046ffebc,0x001702c167913114,0x004bb0534ddc6748,0x00aeb501e73caadc,0x00a4681085f91e9e,0x002a5ddafba8e6d2,0x009a92732c0b39cc)},
+  {FIELD_LITERAL(0x00e38ef4e0404d2b,0x001e75be081c0d41,0x00968b7303381ea6,0x00fa5a47abfaa816,0x00913d468b60be3e,0x00cff1cfa16bc005,0x006c82115dc695ba,0x006729ebec1aaa61)},
+  {FIELD_LITERAL(0x005b5bf2280edeb7,0x00772218fe686d4d,0x00d7c04b4c0fc739,0x00b208feca406cf3,0x00686ed579f2bc38,0x00b6e0e52c1d8d90,0x0085b4bc6e97f824,0x0000a4b46a110862)},
+  {FIELD_LITERAL(0x003fe2095c7b3127,0x0059e4845ebafc3a,0x009d146bfb964521,0x00b3d59a4be92c28,0x007ae9540ea12be2,0x00e2127b5bb42cb6,0x00d109164b45daf1,0x00b3a318db4bba50)},
+  {FIELD_LITERAL(0x0055368eede8003e,0x00ae27a7183c8ede,0x0000529bd1bee8fd,0x00273aef8da14b09,0x00ba1f08c422193d,0x00268c3bc423ac07,0x00ec0fb750d825c1,0x00d9ce4fe9f60599)},
+  {FIELD_LITERAL(0x00c691a8794a66e6,0x0075bb1d594280b5,0x009c02301dcc63ca,0x009f988fe46123e0,0x007929548ecda54a,0x00ec479cc7b73e06,0x0044cf6393c1a450,0x00afa4da82816ce5)},
+  {FIELD_LITERAL(0x00501ed410528d0d,0x00c0e2d9bd26989e,0x004290f86cfd817a,0x00ec11f37b40006e,0x0018e3f0a17ef260,0x0065c8ed4f3f1424,0x00335fbf80710a07,0x0053e5e5344b8c78)},
+  {FIELD_LITERAL(0x000b700e5a0a69d6,0x00ae859bc0593a80,0x006cac43414ca2db,0x0007798867e7da73,0x00c6f1eeb26bf862,0x00802f27a9ab4283,0x00c56534d481d382,0x007fdb1826694214)},
+  {FIELD_LITERAL(0x0046ccd89ea03011,0x002763a0bf652df8,0x008157b393f5f8da,0x00845944f4377886,0x0048a443ad483a09,0x00ba7576c7a7f7f9,0x00b45b1afe9e9512,0x00e5afc52aac08d9)},
+  {FIELD_LITERAL(0x00c81f7d88b2683a,0x0098a5c9539f73fb,0x005aeb0100cfcb94,0x00daab8b203a34f4,0x0047920a09ce74ca,0x004e70bc0b71c353,0x00b0244e281f9df6,0x00915baf044819ff)},
+  {FIELD_LITERAL(0x0086626c13600e44,0x0023e144ede18ca8,0x0080ef2705bcc6cc,0x008e12130ddee4a3,0x00a1986067b1ba21,0x00f790cb9ef11cbe,0x00b41041fae685b8,0x0066fe3bf07af848)},
+  {FIELD_LITERAL(0x009af9d1343605da,0x009e931f7a839488,0x00666989fdcc752e,0x00901959ad2292ca,0x0096e46c1252464b,0x003b36f27d221763,0x00e307402535952b,0x00531e73ca4daadb)},
+  {FIELD_LITERAL(0x0061520ee500d80e,0x00c7848bf7d49553,0x00a56522c5b62bd7,0x0039569d608aaf7d,0x00396c62d38461fc,0x00df8efb52dffe8c,0x003814027ee3c758,0x001b1f8ab9e86f98)},
+  {FIELD_LITERAL(0x007d7d5ef96d070c,0x00f37b73aecc7b74,0x001b6be1d143d3f1,0x00314c518182915f,0x0016609da7ec707d,0x002d6ab372f98b2d,0x008db88a7a86179e,0x00db9dd8a424248f)},
+  {FIELD_LITERAL(0x009caedaec047a7e,0x006a228c6b822015,0x009c08d9542df455,0x00e6e3fbd4c04883,0x00f077d7cee62216,0x002e41da4d485b1c,0x001955e109f9db04,0x007c7bd978997a3b)},
+  {FIELD_LITERAL(0x005d88d65b47ef34,0x0037343838e87fbd,0x00593faa7aeea054,0x00f5758552c7c4ed,0x00993f71865a32d4,0x001326e5741d7a72,0x00122a322d987f13,0x0052a98e7058d047)},
+  {FIELD_LITERAL(0x00008e4cfec826a1,0x00ba05c906958fae,0x00e45457b50c4e5e,0x0079dbc946474d31,0x002c6d0b276b1c32,0x00b90e6a301ac656,0x008a46664038046f,0x0098dd9999537cd1)},
+  {FIELD_LITERAL(0x0069d0fb8361fc4c,0x00fee4113d63b9ac,0x00b033e0095eb557,0x0048d5e0ad20e6c5,0x002f6736bb50693a,0x00f1919796737511,0x008a1a01802eef86,0x00e2915064b51fad)},
+  {FIELD_LITERAL(0x007aec99b2579146,0x00cb191a748547bb,0x007dcc4505e87113,0x005c54c26a2bba8d,0x0007984db2674cd5,0x00ddaa77a12c66e8,0x00114223a508e98f,0x00fbf0a8dab1b940)},
+  {FIELD_LITERAL(0x007eae1dce80ca43,0x00efacd8a2004a5c,0x004ca017bfb763f1,0x0050736f70b940bf,0x005d7e42730db9d9,0x00cf0991dbce839d,0x00663c1db79f4233,0x00bce37844c4e7cf)},
+  {FIELD_LITERAL(0x0042969fdf60bf73,0x00badf9649df1569,0x00e025a03ad0a8b0,0x008f51387aabd922,0x0056cc214a1fb6f0,0x007c7b5d63817533,0x0039d0f5edf20c15,0x003a5a787fa7d024)},
+  {FIELD_LITERAL(0x00348eb0e97e5235,0x006101f5a953892e,0x00961f835cfa3c87,0x00649226b7ecccaa,0x00d83084b9d5ab31,0x00504d07c8ee2d4e,0x003227507f28d734,0x005409f278076c1a)},
+  {FIELD_LITERAL(0x0039bd5b0ce2b1a5,0x00d5a0eae59c6f5f,0x00dc8a0685259e66,0x00db2aa7d72e50e5,0x00427c3df0a9cc77,0x004db710420476c9,0x001710b33811bf82,0x00d6fd851a5104d9)},
+  {FIELD_LITERAL(0x00cbebe277c2914c,0x00362e5c5478cdba,0x00b1d622caec2aba,0x001f23e8abd36352,0x00396c5d3130b910,0x000c43078f00ac50,0x001ff35ee960297e,0x00d3d8b3c9cd130a)},
+  {FIELD_LITERAL(0x00853f1170339ce8,0x004ab1cd3fc494c4,0x00f0f3aee5f9ea32,0x00435ac174e19337,0x00440f7245f9f528,0x00c0d0edafcf9f2a,0x00f5de94021d2772,0x008e3590ec85fd17)},
+  {FIELD_LITERAL(0x001a6b2f02bb5e4c,0x0033a5c4f80b3aa2,0x004e7a26c2960b84,0x006c0c9c9e0ea2c0,0x00d8c8f59230b214,0x000c4c8ed0555c0d,0x0089e3710a3c1c05,0x00513473e47987b6)},
+  {FIELD_LITERAL(0x00a22e8eda60ce0a,0x001107c3e72056bc,0x00f93e763a3ef8e5,0x00484b64f0f4aab1,0x00c68077fa9c1aa0,0x00f33d31486bf7fe,0x002129828cfde39a,0x00d4e444ccab7246)},
+  {FIELD_LITERAL(0x00ca87f1b70f6e11,0x00231f15a3c307fe,0x00d264724a1532e1,0x00a8f2c7b2ffa3d4,0x004839527d013a91,0x0092db8b7b5e58b2,0x00578279ebfd451a,0x00663adbad8ae553)},
+  {FIELD_LITERAL(0x008cee051109875f,0x008f5af5c87841cc,0x007da29278b041e2,0x001dd28012a89915,0x00ff900d3df8bcea,0x005b817dcd19e742,0x00021a28f699302c,0x009ac93a3b9649c1)},
+  {FIELD_LITERAL(0x00a0c3bfb17319f8,0x0068473fe6f25df4,0x00071314c0b34b2d,0x00027c2709547a97,0x00a35b021486e1e4,0x00c6da01f986389d,0x00b73111bc5b4f76,0x006e717920433618)},
+  {FIELD_LITERAL(0x00e25caff4120724,0x00b8fe861da1434d,0x006d0fb873f9b04f,0x00e28703b62ad091,0x00e1bb1ffe2e0b25,0x007e48d666fbcb94,0x00262615da8813e5,0x00a11d7dff24812b)},
+  {FIELD_LITERAL(0x00f4ea4d9cab4a2a,0x0026e6f84ba77638,0x00ce846037dae280,0x002d38995886b956,0x0009824713b1808b,0x008cc6d8a0db6920,0x00b996f36bae7438,0x00687f12fa3e6154)},
+  {FIELD_LITERAL(0x0073b296a951eecf,0x005e25ad13879e0c,0x000e7475516417ad,0x00c42351b4fb093b,0x007ae8689bb3963b,0x007732673f74fee9,0x00b5b76a932cfc31,0x002c491dfdef0348)},
+  {FIELD_LITERAL(0x00be200c0dde8912,0x00e87ac6466bd2a4,0x0041913d7940bbd9,0x004e944ba66452a9,0x00637cce75564571,0x00dd7be0d544608b,0x007fea6bfef7ca1f,0x0073ee49bc47bcb7)},
+  {FIELD_LITERAL(0x00769e38194ee37b,0x0013f0e52f9f51ce,0x000a610c1fd60ca9,0x0041c13a0b86f930,0x0007a31b2a5790b2,0x0052bedd853a7a2a,0x006205b4229abab0,0x003e483a1b5e45a7)},
+  {FIELD_LITERAL(0x0078eec372d7af29,0x00ec21eca8a68eaa,0x0016b992b1e78bc5,0x00836a1352fb4e87,0x0090d0779a890f1a,0x00ff0784a3397bbe,0x0082e0bc40d8b443,0x00c398814d8ab4ea)},
+  {FIELD_LITERAL(0x00580e5b5aaf75be,0x0008476f93011213,0x007169fa01411d47,0x00cbaf2bc8c7bb76,0x00b3c2d66769ecd2,0x00a44b9c81e7777c,0x009cd32f13a850ed,0x005bcc5531e08c21)},
+  {FIELD_LITERAL(0x00f7a19c3012bc81,0x00542002377b446d,0x00479030c8a125ac,0x00f1afa21c19a4fe,0x00bfb1ddb2eedc17,0x006941a3e12f2add,0x007866ba5f98cbf6,0x000dbc0b16897f62)},
+  {FIELD_LITERAL(0x00629b0cc563be76,0x000cdff272ba06e4,0x00365165ee329758,0x0093efe4fa7ba004,0x004be93f1d645bf6,0x005a20238e0ea3b3,0x00deebe97be6393f,0x00cafbad28ed8e1e)},
+  {FIELD_LITERAL(0x00fb1a7584240ef2,0x0075841d5b88989c,0x00bb273cd4300631,0x00bd5bf51240dd02,0x006f447fae0c5a33,0x005dcfd55c9b5af8,0x003faa7f698c515c,0x000ace6338cd9adb)},
+  {FIELD_LITERAL(0x000e23e9ac5014b7,0x000b707c7f23cb67,0x0044da1e92f3f544,0x008635774922105d,0x0087c9c169443dcc,0x00bef1d6549112d9,0x0098643dc0ef3b97,0x0006d22ebabd4e38)},
+  {FIELD_LITERAL(0x003d8866c60ad343,0x007d01588affaffd,0x000de10ae2d6764f,0x00331090676eecda,0x00156e1babd7e177,0x00c334f91b995ddc,0x0075373f13c19dd6,0x00343ee66efa2809)},
+  {FIELD_LITERAL(0x00bcd40c5b42f0b1,0x007b692da3a76969,0x001480c9c0bfa2cc,0x0067afd91a602fed,0x006fd66d20f6f793,0x0098b3e9e9fe69f1,0x00901c09cc022659,0x0047796bfd6a6c8c)},
+  {FIELD_LITERAL(0x00c000b0cf00fabc,0x00322745a56a8666,0x00fb0fd7cd28a1c6,0x00b8e333b8cd5ac0,0x00af4f69119fb242,0x00355dabdd809304,0x004a28169d881573,0x00a8849b952889a0)},
+  {FIELD_LITERAL(0x0028a9a9df4c869c,0x00729da598ff6cc2,0x00be88527aa0c814,0x0062ade4c69580f5,0x0019ec3842b83f9b,0x00e30117ddb4816f,0x00dfc0f655513a1d,0x00943707ebdc5639)},
+  {FIELD_LITERAL(0x00f165f311587a45,0x00b8234aaa6ec394,0x000e4045b01ad57e,0x001fb9b61cb6ac29,0x000a0c790028f610,0x00d4628163873544,0x000f548237514742,0x0055ecd34a8fc0a8)},
+  {FIELD_LITERAL(0x008dafe85414812b,0x00efc42cd9e6fdfa,0x00544bdb8b84a798,0x007f9b379801444f,0x00a987e0653f2abe,0x00d45dd54766769b,0x007b9799b3c1f5b6,0x00c0017cb57b0930)},
+  {FIELD_LITERAL(0x001afc6be9d981a0,0x00d0f06f5a9a04d6,0x006efc90928b5438,0x00ff4ddb7d5b1f98,0x009dbfcb357e6e32,0x00ebb9e333a1830f,0x0033b2ca4458ddf0,0x000ffcd41536609f)},
+  {FIELD_LITERAL(0x00baeb4a002f935d,0x0017cb79ee9ded79,0x00674f903bcf9ac4,0x00470e2224da73bb,0x001dbc4709acdcc7,0x00ec018e1ce6eb70,0x0079eefb138f07a2,0x002efd0150f35534)},
+  {FIELD_LITERAL(0x00962b461b7a0df6,0x008639878c4c296b,0x00185529f14bbfe1,0x0030926259b0a5bd,0x00eeb14f38b746b5,0x00efab57a8915ed0,0x00c56baf2af8f3b4,0x00464a5d9d3a2d22)},
+  {FIELD_LITERAL(0x00d322584fd8908e,0x002f48fad85ae527,0x00d8901793099137,0x005b6d6096fe0ef8,0x00b74c51d213a939,0x004becd10cbaae6d,0x00dd544e9d54ccd5,0x0072414f6ae7d6c0)},
+  {FIELD_LITERAL(0x004bbb82fb542268,0x00337534d91dcc45,0x0002d140bd7c6b37,0x003e9804e7a823cc,0x00f9bb2f3dfc3753,0x001507b62fa2324b,0x000a11d05bcc7797,0x003c1e374aa954df)},
+  {FIELD_LITERAL(0x009afe6c57a24195,0x00033fee0c1fa85c,0x0046d49b138cf1a1,0x0072a4426715183d,0x00e8f4c76b1143ae,0x0081bf3b939e35ed,0x00f1b7da70fc4ae5,0x00fe389f21941200)},
+  {FIELD_LITERAL(0x00314cd9b57f166e,0x00f9a4440b10e7e9,0x001bd62bd3205a4e,0x00ae735282dc5d45,0x00d45cef29934866,0x00798f63aaaec1d2,0x00ba7ff23b6f2af4,0x0085f091ac2bb244)},
+  {FIELD_LITERAL(0x000a4da4bb9efad0,0x00dfe18b4f9887ba,0x00891ecc743736af,0x000708c40b8c0600,0x0002d7f039d6c1c6,0x00660c95f95ec3b6,0x00f0398937b04187,0x00387e5f4743fa0a)},
+  {FIELD_LITERAL(0x00660ae58dc7a646,0x0090e58c01518a7f,0x00314a61feb3f111,0x0065bef997f90bdd,0x0098706b64aa4768,0x00c56eb14d67d164,0x0058c631e6ac577d,0x00d366abf97964ad)},
+  {FIELD_LITERAL(0x0013924320effb45,0x004f2dec9be04595,0x003f08d91683141b,0x00f0df4076a6a44e,0x00582ac7e5e550ea,0x00f71607a45b54f7,0x00b7365304d2d406,0x00dcd810ec7526f1)},
+  {FIELD_LITERAL(0x008ed552d1724bc1,0x00e9c6c402c3ba29,0x00d1ab606f9e007d,0x00b460845cb762e8,0x00d0e14fec5b026d,0x00448da87beebbdb,0x00a15c3a0773d36e,0x005a0af6ff96a710)},
+  {FIELD_LITERAL(0x0052daf49d7c44f8,0x00342f0374468f18,0x00dd68ac3341ae40,0x009911d0415b1147,0x00b435c117b7ba07,0x0062147d99339317,0x00d86682e2bb43fe,0x00a8f12931e6e5d2)},
+  {FIELD_LITERAL(0x0062a281841e1b77,0x00e0f5989a2bb2cb,0x007a1922d2443f70,0x00dadf5cb5e906c3,0x00da122c7af60eb3,0x0030fa301523c7f8,0x005f52ea1b4b5ce5,0x000f669d1129a364)},
+  {FIELD_LITERAL(0x00c0ac467ee34e7a,0x006a83f1cffdc5f9,0x004be2e4588841df,0x00e29e5492995505,0x00accaf48a9ef6c2,0x0084bbcd23432162,0x00cce24977b51323,0x0075d1eaf52386dd)},
+  {FIELD_LITERAL(0x0001b16a822d5c45,0x00e3068ce8bf6c2c,0x0074c1b2ed9ac803,0x00572268a8bcd027,0x006a211d64be57f5,0x000f0c95d5108cae,0x0065b1d0ccbba414,0x00349fdc23095994)},
+  {FIELD_LITERAL(0x003e73e229e0599c,0x0076b894b8c0c28c,0x0071ac3f43e9b6ea,0x00be81556c74c54e,0x00a4b90cfd42d5dd,0x00f9b7cc25d9ec5c,0x009d1ee947d35fbd,0x00e6c0b54b60db5c)},
+  {FIELD_LITERAL(0x00abd86880279aef,0x00f5b26e0a9fc98a,0x003dbea4419d737d,0x001f0f64816f10ed,0x003ac354f6a283d4,0x00cdcf4b4ca5b659,0x00aa23aa7d6eb1c3,0x00aaee0db4619109)},
+  {FIELD_LITERAL(0x0065647c91cade74,0x0001fc69704af525,0x00042496467a0586,0x002190f33ce57189,0x00cd3b4eee9777d3,0x0070163e699a022b,0x00f044634c94b0e6,0x00ace80dbfaeb2ed)},
+  {FIELD_LITERAL(0x00572743e4d58814,0x005f23985e6510de,0x00349b9872eb6b80,0x00c728b77bfa5921,0x000dc9b0004aff24,0x005afbc8a376fbb3,0x00fea6c214ff1d97,0x006d33e139599887)},
+  {FIELD_LITERAL(0x001ea5c45608854f,0x00d47364faf7951b,0x00f1c400d5c12e4e,0x001b730f7f9ca5be,0x008ac8b9f0600097,0x0093226f58902c3a,0x0037c10e782df520,0x00be7a3f76a97be8)},
+  {FIELD_LITERAL(0x00eeff357a277105,0x00c4c5890586c4a0,0x000fbb317cbb927c,0x006e95548eae9fa9,0x0052fae54d2e17fa,0x00c48e486ab6fa7e,0x0061c1a3a358754c,0x001099aba1a625e7)},
+  {FIELD_LITERAL(0x00ea1c62c3b52f45,0x007519f731803379,0x00a48e7f47c38d66,0x00a299e7f1db0e1f,0x0034a3d37bee0024,0x00f85c50d95aacd0,0x00847025d7561e9f,0x00c14bef31cd243a)},
+  {FIELD_LITERAL(0x008df8dc26223d90,0x0002fb0c065855e7,0x005557f0306e1199,0x00a28fc2deef63c1,0x00368cc5e8fb20e7,0x005fadbb1904467c,0x003d2a8c10c9e3b3,0x00e77c89640eaf87)}
+};
+#else
+#error "No generated base table for this GOLDILOCKS_COMBS_N/T/S"
+#endif
+
+
+#if GOLDILOCKS_WNAF_FIXED_TABLE_BITS == 5
 const gf API_NS(precomputed_wnaf_as_fe)[96]
-VECTOR_ALIGNED __attribute__((visibility("hidden"))) = {
+CACHE_ALIGNED __attribute__((visibility("hidden"))) = {
   {FIELD_LITERAL(0x00303cda6feea532,0x00860f1d5a3850e4,0x00226b9fa4728ccd,0x00e822938a0a0c0c,0x00263a61c9ea9216,0x001204029321b828,0x006a468360983c65,0x0002846f0a782143)},
   {FIELD_LITERAL(0x00303cda6feea532,0x00860f1d5a3850e4,0x00226b9fa4728ccd,0x006822938a0a0c0c,0x00263a61c9ea9215,0x001204029321b828,0x006a468360983c65,0x0082846f0a782143)},
   {FIELD_LITERAL(0x00ef8e22b275198d,0x00b0eb141a0b0e8b,0x001f6789da3cb38c,0x006d2ff8ed39073e,0x00610bdb69a167f3,0x00571f306c9689b4,0x00f557e6f84b2df8,0x002affd38b2c86db)},
@@ -352,3 +1571,2825 @@ VECTOR_ALIGNED __attribute__((visibility("hidden"))) = {
   {FIELD_LITERAL(0x00a53edc023ba69b,0x00c6afa83ddde2e8,0x00c3f638b307b14e,0x004a357a64414062,0x00e4d94d8b582dc9,0x001739caf71695b7,0x0012431b2ae28de1,0x003b6bc98682907c)},
   {FIELD_LITERAL(0x008a9a93be1f99d6,0x0079fa627cc699c8,0x00b0cfb134ba84c8,0x001c4b778249419a,0x00df4ab3d9c44f40,0x009f596e6c1a9e3c,0x001979c0df237316,0x00501e953a919b87)}
 };
+#if GOLDILOCKS_WNAF_FIXED_SPLIT
+const gf API_NS(precomputed_wnaf_split_as_fe)[96]
+CACHE_ALIGNED __attribute__((visibility("hidden"))) = {
+  {FIELD_LITERAL(0x0075fd1241fb006b,0x003a09275d3644a2,0x007a1744ccf42983,0x00c72633b39f66f8,0x001fc99f55438cc6,0x00c71cd00ea2eb65,0x00f7f724ed5950b5,0x000839316ab3c704)},
+  {FIELD_LITERAL(0x008de4ac4c9a9854,0x000ecd24e9652c12,0x0077cb2bdff18870,0x00ec6cef30f79c7a,0x00831e4f6113ba82,0x0098dba3c4eda655,0x004dcc5899b361cf,0x006375c1c82bece1)},
+  {FIELD_LITERAL(0x004c9af0653b190b,0x00ad7d06f87edec6,0x007483e2a337ae8c,0x009cbac9ef29f28c,0x00fd779e4d8f7383,0x00a14430d5558a3a,0x004b9d0c187d2bf0,0x00b2ab442c9752eb)},
+  {FIELD_LITERAL(0x008e982b953dd8b9,0x002a255bd122f13c,0x00dbe8aaaf121bbf,0x000cb11c52dc1627,0x003150b12f174244,0x004ef98e9aed547b,0x001260a4b3cf2f9c,0x00e13bc302453154)},
+  {FIELD_LITERAL(0x0080a1945056586d,0x002e36e76b4086bc,0x009f6a413eab4223,0x00ce3116586ebdd8,0x00127df02b6d1266,0x00c30a32d4033c63,0x00528d28cddd6739,0x00fee79efca6fc67)},
+  {FIELD_LITERAL(0x001ca88e72a17f4f,0x005b282378abfb8e,0x00b08832180cc686,0x0040d526ec25e535,0x00a173eac15961eb,0x0048c632ad5206b4,0x00e6ccef65ef8e8b,0x004b3a1a8f33390d)},
+  {FIELD_LITERAL(0x0046ebfc18490cf8,0x001dc5838d8f075b,0x003841d56dd0d83b,0x0088f6daa20dc032,0x005b2f5d37c35050,0x004034e61448bd7e,0x008d8c4af1565118,0x00a4a87918cdcfd3)},
+  {FIELD_LITERAL(0x00e0cc33b7f9fdd2,0x0057739c80ce7ab6,0x00de90bea754ec6b,0x00294b75bd7f1ea2,0x0029a5f907663b13,0x001bc0c084f5c348,0x001cf7cfebac8855,0x003a79d244fafea1)},
+  {FIELD_LITERAL(0x0041c1d7fb47b3db,0x00a1c9fcd4da560a,0x00a1ac68df356c69,0x00d6a2e1a7670754,0x0099b759e1600760,0x006201df49c03e2c,0x008e19aa126eb9ce,0x00e35cd9e64fd7c6)},
+  {FIELD_LITERAL(0x00b71e4cbfbeb090,0x00df4bfd3d4505ce,0x0055588254b8045c,0x00c39a9ab10542b5,0x00e1b65c8629e70a,0x00f83a50f9cae820,0x006488f236798ea4,0x0065894646a4c840)},
+  {FIELD_LITERAL(0x002a75151726dfbb,0x00544204599697b4,0x00e05e149a84045f,0x0025a656d4b60f79,0x00ca9bae001e24ea,0x00601cc07ffe46a6,0x00e7d1a8c5c46e6f,0x007e94ee17dff170)},
+  {FIELD_LITERAL(0x00482f2895f6a14d,0x0000dc2f794bdc9e,0x0059098b1dc34c01,0x00ef0c6c5cd21a34,0x00da41c9c24c2c97,0x009a2ed1485f6123,0x00bdf7557e8b7b01,0x0045dde397e8bcb9)},
+  {FIELD_LITERAL(0x003cb3efd51c0b45,0x0045cf76e8f98286,0x00dfcbf214d8cb4e,0x00111e569a91b59d,0x0030289fe49394ec,0x00a63191d5aca5f6,0x007388c8b0d16b13,0x0012712eeb33712f)},
+  {FIELD_LITERAL(0x00c08c4f0eddb3ed,0x00a69cb406bbc4cd,0x00466b5c14b6a5c9,0x008e2b6b568d58c4,0x0091f242ab58a92e,0x005b983c449357db,0x0040131296fbbddf,0x00afd385ac412ecc)},
+  {FIELD_LITERAL(0x003f6f9ddaa11a49,0x00e2aa10c1e04a83,0x002aa34097c174df,0x0056bc91a2cfc298,0x00dd145138ad8643,0x009b502e5fbf2273,0x004daef8dadf16de,0x00e0d58533945ca6)},
+  {FIELD_LITERAL(0x00667cbbed8610aa,0x00178dcfc08cdc1b,0x00143e1c5029fab1,0x0025090ba50d0eb5,0x00afef138ae199f2,0x003f143bea5973c0,0x004f0595d97a2f06,0x00317823b2f54f1a)},
+  {FIELD_LITERAL(0x009d138105b87c6a,0x008cf0b180aedef9,0x0001982f8c9acaf2,0x009b615e6d889105,0x00a5a4f54707c6ee,0x00d8a76f839935e8,0x00e56e9b92d1393d,0x00f56be8bb23407f)},
+  {FIELD_LITERAL(0x0049c83a92170c76,0x00179f01515f623b,0x00aa76c57f998717,0x007f4dbb2ecba20a,0x007339b98b275693,0x00f99b1dfd314e0a,0x0090d38aecf21c5e,0x00e9317e8712f592)},
+  {FIELD_LITERAL(0x005464c86ee0e242,0x00b232cbdda78d20,0x009aabd33ca9c284,0x00c38b6a73071963,0x00b983c870c1a2bd,0x007792f93c8289f5,0x00aaa5fd64c42553,0x00ba99d2595045d8)},
+  {FIELD_LITERAL(0x00d0b1296dce7fd0,0x00b5b550cac92797,0x006b692b7843c59f,0x00701d3e5162c3c0,0x0079bd73ba5b14bc,0x009d148d26b87ad9,0x00d41b1b5f8ce7a5,0x00648ea39bd13e13)},
+  {FIELD_LITERAL(0x001683bf57fb049e,0x0037176b75c054c1,0x00386482d2b20213,0x000ad4b193f5c38d,0x00433efb60a1f163,0x00202b5e325402d4,0x00408524495b89d3,0x007d5b123aff637b)},
+  {FIELD_LITERAL(0x00d67e6725beba3d,0x006f173a828e2d5d,0x00e3cb13a5dd95ab,0x0058b79a72974501,0x00f45066bd65e32c,0x00852267d8ed6444,0x0077fdf70b81517b,0x0059d2429800c77f)},
+  {FIELD_LITERAL(0x00430f0ac3d142e0,0x0026a623565bf1bf,0x00b7bf63df20cd37,0x008035abed4a5eae,0x00d3dbb0df825adc,0x009d31a0e1633300,0x00c98906d65384aa,0x00b626aabeba2ed7)},
+  {FIELD_LITERAL(0x007f4cfae81f1423,0x009cbef98c3fe8df,0x00e98863c956964d,0x00fb5713f4179e13,0x0013863d36d10c95,0x00d2f1e4c555cac0,0x00eda9baa50fac33,0x00155692c4a7176e)},
+  {FIELD_LITERAL(0x002cf4d8374137e0,0x0011bcd01cfc8b65,0x00d819428459350e,0x00c2636e55507d46,0x0043bfe72bf49f44,0x00e232e73e600c93,0x00f4cd7ea6144b4a,0x00c8117c7c63707a)},
+  {FIELD_LITERAL(0x002bc6bdaffe2cca,0x0088cd41ca85d89c,0x0080f8199e0742d1,0x00c0d806414e6e86,0x000b13ead9dc050e,0x00c0db5268db156b,0x000aacb76c4120ec,0x0075a902879d2720)},
+  {FIELD_LITERAL(0x007c8f764c23f360,0x0031e6e513a6024f,0x008e4e840ad92c73,0x004325092a3b9a6d,0x00f63712a826406a,0x00409096924a78e0,0x008d28ebdd651f48,0x002331c8cd805b7e)},
+  {FIELD_LITERAL(0x00eb7c2e84be8f9e,0x00225da3976722bb,0x0092175b84abfc77,0x0045ae12de030531,0x0065c57427d6bddb,0x008a30ec7e277ba8,0x0012442a0185745b,0x00620b4b99019d9d)},
+  {FIELD_LITERAL(0x002303cf587ec4d8,0x00a960baaa467b02,0x00bde9a108ad0446,0x001d17fb0182279e,0x004b9bacc68a8c06,0x00a03b2994097255,0x004e79c82db8c972,0x00a0afb289adb754)},
+  {FIELD_LITERAL(0x007670df487c8c6c,0x006e5ac06f3aa617,0x0013351c0ce48529,0x00ac8802da82aec4,0x005cf2967d3eda36,0x00b802b7c48e5ef4,0x00b7b0907570c503,0x00262a7d37014b92)},
+  {FIELD_LITERAL(0x00bc57af5ad474d1,0x00b83c9890b6d477,0x00da60f2b3932ccc,0x00f4f00e085f0325,0x000f84bd8401e0d5,0x0041688cf93ac811,0x00aeeafb64b994dc,0x0024454a653176ff)},
+  {FIELD_LITERAL(0x005c4ee607871eb7,0x00ecdc9963259be2,0x00454d5df525f1c8,0x000445027269ce84,0x0000380605c50a44,0x002b08602d94c271,0x00b17741d712107e,0x00655ccbe939a512)},
+  {FIELD_LITERAL(0x00732b1f632a66bd,0x00095551f51c4fdd,0x0013c4a3ff0d84f7,0x00cb39e019e6ab00,0x0007e028d50e353d,0x00137d931bed8523,0x00c88098a0d1eac4,0x003d80c40a5e3aaa)},
+  {FIELD_LITERAL(0x008bc95eb84a7783,0x00f7f46c87c1799c,0x00106f4d4ca08e46,0x00817644acd1e69e,0x00d1f791490c9d13,0x00563569b20c1dd2,0x00ed734d8b2e8d96,0x005665d2b59081ca)},
+  {FIELD_LITERAL(0x000a4ea98d69c0e3,0x00e94a486bd436fb,0x000f03ac2e7e68e9,0x001e6bb6b7f2c6b9,0x00b3dc1b432f0d0e,0x0061a00270f7d0bf,0x001eef60a46f6add,0x0059972a6fbe7045)},
+  {FIELD_LITERAL(0x00d47e3dfa08980d,0x00daedc2b3371a12,0x002b10fc0289df19,0x00849f3a6397f41d,0x00d4dea1feef9f56,0x00ea283d35305391,0x002d85af4fb121f7,0x008af6602a08e230)},
+  {FIELD_LITERAL(0x00d6abe5147c27fc,0x0016539dc6f9d47c,0x006a1f048b8c4de8,0x001b784bb4759b4e,0x00459ad33a147ffe,0x00ad3338d344b0d8,0x009a5ae24da065af,0x00c40772e389a7bb)},
+  {FIELD_LITERAL(0x0027f8e18fbc0ede,0x005e60e350f44abe,0x00d087b556d58a33,0x00dab6b6a64f2d3a,0x00284a304115b0cf,0x009d50c3c0e08060,0x00e5b20b08ef8ef9,0x00c92a4e72a43f35)},
+  {FIELD_LITERAL(0x0046eacfbe75e7c5,0x00519615deab19ce,0x003983bc3b3746e2,0x00f78498b9d6d8ba,0x0040f00fa4cd47ae,0x00c52ae8d838e070,0x0047987e94135150,0x00716c580ee7b69e)},
+  {FIELD_LITERAL(0x0019f6afa9ab06aa,0x00d3f3cb7105147f,0x00cc0f1a90344702,0x005a0a09725ea7b9,0x002aac19525b7ab4,0x00210b3f88f54db3,0x00077437c1e7456b,0x001042dae2ab4b5d)},
+  {FIELD_LITERAL(0x00f8d6551a584758,0x00b4b0f31db2b924,0x0035a04f6aad608b,0x000aae0e4e20c8cd,0x00cb975a2377c544,0x009647e5200e869a,0x008a8aa5f1d90d1b,0x00ec3ed1ecb17361)},
+  {FIELD_LITERAL(0x00ac64f13f138b16,0x00c4a613e8e7d424,0x00efd959c8aaaa06,0x00d3e34bf8022c95,0x00cba20adb9e908d,0x0036c7d56af7db19,0x00289e56ce23ccbe,0x0095fd864a2fd927)},
+  {FIELD_LITERAL(0x005bdf4385561592,0x00ff6b3266bbdaf5,0x006e9b8f8611b5eb,0x005ec95212047585,0x005b075257f5c198,0x0064143dd1846c1e,0x00458316590e2557,0x00a12186cf4aaf8d)},
+  {FIELD_LITERAL(0x000766f371186363,0x0025f819f24dd710,0x002d943707999c75,0x00a0e7b6b1c37fa2,0x0034a951bfe480a7,0x00ba4a982266b057,0x00fa852da57e97b6,0x00d6c2fc7ca21c87)},
+  {FIELD_LITERAL(0x007d4fbd68a22900,0x00d3b58f75a93153,0x00327f2d475d9600,0x00afa719750d9374,0x0037025d4b127c26,0x001ce32af5847375,0x002df5fd324f1a40,0x00659b9c594422ff)},
+  {FIELD_LITERAL(0x00fc06447aa672a8,0x004fdd061aa5d573,0x0002607f643d5283,0x0081f61f7385bae2,0x00dd28c8cc3b85db,0x008315d0fdb1f516,0x008065ac741db014,0x00621bff59c0bd4f)},
+  {FIELD_LITERAL(0x00037a18ff6d4815,0x0056e16431d5a61e,0x00159e1bb0e7c2d2,0x00ceacc829f29fc2,0x00e5a7b6851b5114,0x0028836384f66075,0x00fdd1a2c83c93fe,0x00d89285784db9ca)},
+  {FIELD_LITERAL(0x0064d41ebb3eebaf,0x00473491cc37c819,0x00b6b61626345d7b,0x001a8202b37a3790,0x0096a1bbe33aea00,0x00d4bb7b93a974dc,0x003057b1acd7e55a,0x0074bfa6b3837755)},
+  {FIELD_LITERAL(0x00f4d623760fc21a,0x00ccbcb94477b749,0x0090948b74c67569,0x0098edc343c15191,0x0088bc71e9f97402,0x0040dc4b367f7692,0x006e532439747a9b,0x008675b9c4d8601d)},
+  {FIELD_LITERAL(0x00a99fc2702e3cbf,0x000cdd4ea1abbbd0,0x0039dd1f6ec8807a,0x004fccde36d625ba,0x002c00d50a1ab661,0x001a58c771b906b8,0x003a58d8bc1ee7ec,0x001cb3b83d1d3afe)},
+  {FIELD_LITERAL(0x0080689a7a7af6df,0x0023f703b961ec26,0x0092ec1290f763a9,0x0093f5eeac6663d8,0x008b67df16d150ea,0x00e338dac65f8378,0x00cb4d02a5399332,0x000b32ac52011866)},
+  {FIELD_LITERAL(0x003e4fe889a6c8f0,0x002486114467fcc5,0x008bc09141018ce8,0x002eddfccb5151ac,0x0064533f4725723a,0x001de20f48cdfa99,0x00f04ca997240cef,0x0063c57607519c88)},
+  {FIELD_LITERAL(0x00f60e12adf6040c,0x00b36cb184c72847,0x00df6d8b890c3c9c,0x00afe158c4c668c1,0x002a4b9b2eb150df,0x00bda387c99630a7,0x002070cd953d67c1,0x003411500b3b20b7)},
+  {FIELD_LITERAL(0x00d9e9da075534ea,0x00a8df1a0c0d64fe,0x0079999ce6afdf5d,0x001d267227508222,0x0087d7f5a2195206,0x00013bd8623bdb81,0x00161770e850445d,0x00e909bf592e27e8)},
+  {FIELD_LITERAL(0x001a401cae18a39f,0x0031674387ef870e,0x008cac9360a1f176,0x0090ab2a5a010a36,0x009f191751d9e926,0x00f914b4e33682c8,0x002123c0e6869b11,0x009c2518360a7228)},
+  {FIELD_LITERAL(0x0017bed74f952bfb,0x00af8688d094df71,0x004d05eb80df783f,0x0051488ab6f9bceb,0x00653e04d9030fbd,0x00f7ecdbe864ecee,0x00948d66506a8bdb,0x00a31a0c3c95a3ce)},
+  {FIELD_LITERAL(0x004325a1e71edb4c,0x006b0e65086b0d39,0x00d6807f539b5d11,0x000fe10afe2fe18c,0x00ca512637538c68,0x00fdd644e6279612,0x00ce2ef0c69543e1,0x00cb3d2eb9fe6816)},
+  {FIELD_LITERAL(0x00568d09b9f22a6b,0x00e00a8e18d5e1a5,0x00cddcf90108fa8a,0x0003742222d3e229,0x00c62aae6d10937b,0x00c40b17c935458e,0x00155f9096050332,0x007675e2a6e10754)},
+  {FIELD_LITERAL(0x00b699c07f426656,0x004b0a8084fa04c6,0x00f28837aec5a5d2,0x00713d34765ea025,0x00de649575970a80,0x0019f1f107ef21bb,0x007e164282446b30,0x0049345c8271a885)},
+  {FIELD_LITERAL(0x0073a354264de9e9,0x00193c84964c68f5,0x00c53fc234ff743d,0x00b3c96c3dcb53e2,0x002cf74c90b4f1d4,0x00602ddcc3422081,0x000fa04b1ccc6861,0x000b1efca5908940)},
+  {FIELD_LITERAL(0x005333c4725c15af,0x008ff3216fa735f6,0x00a0006cb9319b28,0x00ade7b084481272,0x00a65487b67024c4,0x00a4408dcd861601,0x00d7034c679c027c,0x00b515108f96aab0)},
+  {FIELD_LITERAL(0x001b1f3ba8c94ddb,0x008ef8468ed210b5,0x00996f0ad7b0c9fe,0x00579819662dbafb,0x00f7c8d41daed60b,0x0006e06628afa4fa,0x0012cc153702b9c2,0x00a95903ad0fbe76)},
+  {FIELD_LITERAL(0x0093dc0cda7ff166,0x00a5afed59f9663f,0x00eb6c15e8efee26,0x00254ba619186d76,0x00983e49bd636ccb,0x002c5a134ae58df8,0x0014ea91c430b790,0x00c5e9ca28ab0e91)},
+  {FIELD_LITERAL(0x00f5b1d99d59aae1,0x00ff6948770b9720,0x00e718e9daa2a4ec,0x00ffeb43370eb9ce,0x003da15c2af28f49,0x000d1ec8900395fa,0x00e556c861203ad9,0x000463e67016341e)},
+  {FIELD_LITERAL(0x00cb85694d089fc3,0x0083bb9368861bcf,0x000cf3502ecd4275,0x002bcddda43a2628,0x000236479229032a,0x00e9c8a63843075c,0x0003db99715466ed,0x0068cf9526159cd2)},
+  {FIELD_LITERAL(0x00031e2c6698d433,0x00fc6b7ada3383df,0x00229d1e166ff7d6,0x00e329a83ec41302,0x00a4ea7a56c0db18,0x00095798bbf27657,0x00a6d3f05d306882,0x00e769ce4e51d279)},
+  {FIELD_LITERAL(0x00a09a51c956986f,0x00287b2e66077010,0x0000358a62d07632,0x006b10ecc7db309f,0x004679a9c8284487,0x00c582288840a456,0x00c6a7e16bf78569,0x0030a852f4e9d139)},
+  {FIELD_LITERAL(0x000c635747485463,0x00c4056e0fdd0f69,0x004ed02af667c9ce,0x00272805b0d1520d,0x00e02e0437dfb0e4,0x00cfd18963ceddab,0x00624fa2480e9d6b,0x008dcaff54779dba)},
+  {FIELD_LITERAL(0x006d59954c433cd6,0x00302dec1a134957,0x008131e3d9cd5573,0x003646644f8d6769,0x0086a28be5f65ee5,0x007588860bd65db9,0x006684abd0cd1248,0x0004628660586996)},
+  {FIELD_LITERAL(0x009c6716f0850ee4,0x003d9fa6e87030ed,0x00e985d9bc6b9dc4,0x00f15f6b0ee1c3fd,0x00017c3e5d12e4c6,0x00612d6f9d9fdf6a,0x00c411c75569ffc1,0x00c2d6c46f82dc20)},
+  {FIELD_LITERAL(0x0061068b3581aba6,0x00fe9189cdf90003,0x00d5ed0e681cf004,0x00151ff68bd5ea3b,0x00c11698cad6aa9f,0x001b5859410fa611,0x002ef3493e9e2af9,0x00e71c74254749b8)},
+  {FIELD_LITERAL(0x009dd23da3e3ab5e,0x001aefbaf2529935,0x00eefcb4703bb6cd,0x0079d39953a79d4e,0x004fde6ff67c1f0a,0x007276b4ec4c99b1,0x002124e6bcdf01b2,0x00611c400fa01e19)},
+  {FIELD_LITERAL(0x00d023f8e4da8ec7,0x00ecbb1f40e635ef,0x00a9f46dbc56f3ee,0x00640ac1f825f79e,0x006669cb2ef95f66,0x00b47d23968d2a78,0x00ce71866a0fb89c,0x008fee90ac64bed5)},
+  {FIELD_LITERAL(0x00a29f6b2359a2da,0x00b2ac5a3e5f3f18,0x00b3a66db3533f07,0x0028c94ec1e69157,0x00540ebc7ab9f09e,0x009f88cf4951a9b7,0x000f72a4b987ca47,0x0078e5752e9ab12a)},
+  {FIELD_LITERAL(0x008149df0d6f178e,0x00ff5b76b50d6983,0x005cc60f47e5f1cf,0x0085957c5ce5c00b,0x00643a3b80c01474,0x00dbd52e80ea7b7c,0x00e0ceb72639723b,0x0045994932da789b)},
+  {FIELD_LITERAL(0x0009b7c035c9f361,0x0005234d09f7942e,0x003d7797e0b11c5d,0x0056dff81c3bb430,0x00e190657c94bd35,0x0047ab208fde0fae,0x006035e872e1f474,0x0016eb83f161e165)},
+  {FIELD_LITERAL(0x00dbffadfbb07717,0x0068d482af386f53,0x009c87494dabf009,0x00a7fc31c7d6071b,0x0086f8cea871a141,0x00544eb9f48420d5,0x000a8204e17b319f,0x005f73bd6f3bead8)},
+  {FIELD_LITERAL(0x00895ad60baa7959,0x005356314cb5a5a9,0x0015c86c1d547150,0x00009ac276829cb2,0x0012365c8eeba1d1,0x00b477db550ab24e,0x00c895225100d72c,0x007195657296a0f2)},
+  {FIELD_LITERAL(0x00572f9be18c5625,0x00fd878af5029ac8,0x000efe7b99ed6e7d,0x0057a75e5a5ffc13,0x00372b415a6dcfb7,0x00b7837f6fb6681b,0x00f004ac7109872e,0x00e8b76abd7169e4)},
+  {FIELD_LITERAL(0x0005cde3da41f6c0,0x0073976e2a61eed9,0x00c66fa0ed917559,0x00f0702f66f2b917,0x00663a3afee43b60,0x003311dc62e096c1,0x00c4ce38dcf87c00,0x009f42239d0efd38)},
+  {FIELD_LITERAL(0x007fa90dfefdc27e,0x00dabe701288a79e,0x00e54b83242b9b92,0x00ea64bd5a411971,0x0099da7e287d5d92,0x005b76d077db9c21,0x00fbff138a1b84de,0x0010451b90791c04)},
+  {FIELD_LITERAL(0x009f490560071811,0x00d121eeed6815fa,0x003c26806894d24b,0x0052214f8e4f1680,0x00cadb905968a815,0x00f986ecc79552b6,0x0077373bd44f5a0b,0x00c6aeb53d3b5ab9)},
+  {FIELD_LITERAL(0x0034770414fe3fab,0x00d53cfd361e841d,0x002c949cf1c70ea1,0x0010c58407f5ecb6,0x007fd3ecba9b285f,0x00ff7ec3e10a4fe6,0x00628c0f15484db4,0x0069888c725464d9)},
+  {FIELD_LITERAL(0x00b9c37cc33dd7da,0x00a2dc91059b20f1,0x0020f304354553f7,0x0051909b1edac8c9,0x0074aec4d0bf927e,0x0094e514e0d35018,0x002bab18f1d8eb35,0x00b9bdbe87fc1d0c)},
+  {FIELD_LITERAL(0x0001a4f786d79e4e,0x00bc9a0d100aff75,0x0027a5957d9668b6,0x006bda303fd2f1c4,0x00a3a831680b169c,0x003d8d8ce35322ef,0x008e7794e0050c5e,0x0079b95fee2982ba)},
+  {FIELD_LITERAL(0x00250bce01f405ea,0x004eddb1c2751be9,0x009bb7754924a659,0x00a8976028ed7958,0x00def8d54f629f06,0x00982ea3f2b7c7da,0x001e5bb0314f5875,0x00da45996c1cdcb7)},
+  {FIELD_LITERAL(0x007c5b4ef7b86e9a,0x0054bf46c4da0cf6,0x00f3723c94f63a70,0x0006a81bef6bdab4,0x008f2ebbdd144bc2,0x00db5a7a8538db1b,0x005516527b729b80,0x0062c014b1eb1c29)},
+  {FIELD_LITERAL(0x00a9d835541fed60,0x0005dbe44d1abe58,0x004887f92c74e674,0x00ecbeee5ca06733,0x003e61c422075a0e,0x00e237ac6d11aef7,0x007ff7ad810fd62f,0x00f553b08aeb9261)},
+  {FIELD_LITERAL(0x0048a6ef0f597158,0x00d2bd08f42bf48e,0x0092e8543aa411de,0x00725ea7f497cbc1,0x00679bd1ea42b57c,0x003839564b6f8459,0x0075b7bb846062d0,0x002f506fd9eb4d7e)},
+  {FIELD_LITERAL(0x00b3111798fd854c,0x000e54d8bd080776,0x0005a6a239ecdbd6,0x007d89903d490d86,0x0061fac971bc23cb,0x00388f1334f71c5d,0x001a1069bce98c7f,0x00523181cdb9d211)},
+  {FIELD_LITERAL(0x00f8cc23799bebda,0x00cfe313d601c370,0x0012bda860bea571,0x002f8aeaad211d51,0x00d67259ce0ac53d,0x006b2c74a328248f,0x001be3bf6ee7dfde,0x00f0946f3cfb7b8d)},
+  {FIELD_LITERAL(0x00662051261c069d,0x007a58f6e85b360f,0x00a27489e812dbae,0x002f9cfb72efb6be,0x00ba360587190a87,0x008636e93549bacf,0x008a067de56a03b7,0x00feb0ef6d6f3421)},
+  {FIELD_LITERAL(0x00b5f54007aaee08,0x000ccef57e4be275,0x0089cf8aa67af3a7,0x00502762f91090e4,0x0024acc48fbc2237,0x00bd5b96a03bffb8,0x000375dba1e00b9a,0x0068222e9c471040)},
+  {FIELD_LITERAL(0x0058c951bca098ea,0x00c8fbfb21be48b9,0x00be1fec2fd486ce,0x00d25a1768937aa3,0x0039bfef358d0261,0x00501bb1e6d46166,0x0072045214d40ecd,0x00f84a70c9729d72)},
+  {FIELD_LITERAL(0x001784a954018b4e,0x008f345fab0e7e0d,0x0092620d39beafe4,0x0004d54bd9dfac53,0x006550d489a14b90,0x003063c8a3a039a6,0x0040d695fa78cb62,0x0088521b6badcd72)},
+  {FIELD_LITERAL(0x0061a426dfdf5030,0x004610d4954516ec,0x00f0bc965685c5fd,0x0049009791061d97,0x001ebd73a3720de6,0x007346c0c41ad203,0x009a2e25dcb166e0,0x00d82d931131c4b1)}
+};
+#endif
+
+#elif GOLDILOCKS_WNAF_FIXED_TABLE_BITS == 6
+const gf API_NS(precomputed_wnaf_as_fe)[192]
+CACHE_ALIGNED __attribute__((visibility("hidden"))) = {
+  {FIELD_LITERAL(0x00303cda6feea532,0x00860f1d5a3850e4,0x00226b9fa4728ccd,0x00e822938a0a0c0c,0x00263a61c9ea9216,0x001204029321b828,0x006a468360983c65,0x0002846f0a782143)},
+  {FIELD_LITERAL(0x00303cda6feea532,0x00860f1d5a3850e4,0x00226b9fa4728ccd,0x006822938a0a0c0c,0x00263a61c9ea9215,0x001204029321b828,0x006a468360983c65,0x0082846f0a782143)},
+  {FIELD_LITERAL(0x00ef8e22b275198d,0x00b0eb141a0b0e8b,0x001f6789da3cb38c,0x006d2ff8ed39073e,0x00610bdb69a167f3,0x00571f306c9689b4,0x00f557e6f84b2df8,0x002affd38b2c86db)},
+  {FIELD_LITERAL(0x00cea0fc8d2e88b5,0x00821612d69f1862,0x0074c283b3e67522,0x005a195ba05a876d,0x000cddfe557feea4,0x008046c795bcc5e5,0x00540969f4d6e119,0x00d27f96d6b143d5)},
+  {FIELD_LITERAL(0x000c3b1019d474e8,0x00e19533e4952284,0x00cc9810ba7c920a,0x00f103d2785945ac,0x00bfa5696cc69b34,0x00a8d3d51e9ca839,0x005623cb459586b9,0x00eae7ce1cd52e9e)},
+  {FIELD_LITERAL(0x0005a178751dd7d8,0x002cc3844c69c42f,0x00acbfe5efe10539,0x009c20f43431a65a,0x008435d96374a7b3,0x009ee57566877bd3,0x0044691725ed4757,0x001e87bb2fe2c6b2)},
+  {FIELD_LITERAL(0x000cedc4debf7a04,0x002ffa45000470ac,0x002e9f9678201915,0x0017da1208c4fe72,0x007d558cc7d656cb,0x0037a827287cf289,0x00142472d3441819,0x009c21f166cf8dd1)},
+  {FIELD_LITERAL(0x003ef83af164b2f2,0x000949a5a0525d0d,0x00f4498186cac051,0x00e77ac09ef126d2,0x0073ae0b2c9296e9,0x001c163f6922e3ed,0x0062946159321bea,0x00cfb79b22990b39)},
+  {FIELD_LITERAL(0x00b001431ca9e654,0x002d7e5eabcc9a3a,0x0052e8114c2f6747,0x0079ac4f94487f92,0x00bffd919b5d749c,0x00261f92ad15e620,0x00718397b7a97895,0x00c1443e6ebbc0c4)},
+  {FIELD_LITERAL(0x00eacd90c1e0a049,0x008977935b149fbe,0x0004cb9ba11c93dc,0x009fbd5b3470844d,0x004bc18c9bfc22cf,0x0057679a991839f3,0x00ef15b76fb4092e,0x0074a5173a225041)},
+  {FIELD_LITERAL(0x003f5f9d7ec4777b,0x00ab2e733c919c94,0x001bb6c035245ae5,0x00a325a49a883630,0x0033e9a9ea3cea2f,0x00e442a1eaa0e844,0x00b2116d5b0e71b8,0x00c16abed6d64047)},
+  {FIELD_LITERAL(0x00c560b5ed051165,0x001945adc5d65094,0x00e221865710f910,0x00cc12bc9e9b8ceb,0x004faa9518914e35,0x0017476d89d42f6d,0x00b8f637c8fa1c8b,0x0088c7d2790864b8)},
+  {FIELD_LITERAL(0x00ef7eafc1c69be6,0x0085d3855778fbea,0x002c8d5b450cb6f5,0x004e77de5e1e7fec,0x0047c057893abded,0x001b430b85d51e16,0x00965c7b45640c3c,0x00487b2bb1162b97)},
+  {FIELD_LITERAL(0x0099c73a311beec2,0x00a3eff38d8912ad,0x002efa9d1d7e8972,0x00f717ae1e14d126,0x002833f795850c8b,0x0066c12ad71486bd,0x00ae9889da4820eb,0x00d6044309555c08)},
+  {FIELD_LITERAL(0x004b1c5283d15e41,0x00669d8ea308ff75,0x0004390233f762a1,0x00e1d67b83cb6cec,0x003eebaa964c78b1,0x006b0aff965eb664,0x00b313d4470bdc37,0x008814ffcb3cb9d8)},
+  {FIELD_LITERAL(0x009724b8ce68db70,0x007678b5ed006f3d,0x00bdf4b89c0abd73,0x00299748e04c7c6d,0x00ddd86492c3c977,0x00c5a7febfa30a99,0x00ed84715b4b02bb,0x00319568adf70486)},
+  {FIELD_LITERAL(0x0070ff2d864de5bb,0x005a37eeb637ee95,0x0033741c258de160,0x00e6ca5cb1988f46,0x001ceabd92a24661,0x0030957bd500fe40,0x001c3362afe912c5,0x005187889f678bd2)},
+  {FIELD_LITERAL(0x0086835fc62bbdc7,0x009c3516ca4910a1,0x00956c71f8d00783,0x0095c78fcf63235f,0x00fc7ff6ba05c222,0x00cdd8b3f8d74a52,0x00ac5ae16de8256e,0x00e9d4be8ed48624)},
+  {FIELD_LITERAL(0x00c0ce11405df2d8,0x004e3f37b293d7b6,0x002410172e1ac6db,0x00b8dbff4bf8143d,0x003a7b409d56eb66,0x003e0f6a0dfef9af,0x0081c4e4d3645be1,0x00ce76076b127623)},
+  {FIELD_LITERAL(0x00f6ee0f98974239,0x0042d89af07d3a4f,0x00846b7fe84346b5,0x006a21fc6a8d39a1,0x00ac8bc2541ff2d9,0x006d4e2a77732732,0x009a39b694cc3f2f,0x0085c0aa2a404c8f)},
+  {FIELD_LITERAL(0x00b261101a218548,0x00c1cae96424277b,0x00869da0a77dd268,0x00bc0b09f8ec83ea,0x00d61027f8e82ba9,0x00aa4c85999dce67,0x00eac3132b9f3fe1,0x00fb9b0cf1c695d2)},
+  {FIELD_LITERAL(0x0043079295512f0d,0x0046a009861758e0,0x003ee2842a807378,0x0034cc9d1298e4fa,0x009744eb4d31b3ee,0x00afacec96650cd0,0x00ac891b313761ae,0x00e864d6d26e708a)},
+  {FIELD_LITERAL(0x00a84d7c8a23b491,0x0088e19aa868b27f,0x0005986d43e78ce9,0x00f28012f0606d28,0x0017ded7e10249b3,0x005ed4084b23af9b,0x00b9b0a940564472,0x00ad9056cceeb1f4)},
+  {FIELD_LITERAL(0x00db91b357fe755e,0x00a1aa544b15359c,0x00af4931a0195574,0x007686124fe11aef,0x00d1ead3c7b9ef7e,0x00aaf5fc580f8c15,0x00e727be147ee1ec,0x003c61c1e1577b86)},
+  {FIELD_LITERAL(0x009d3fca983220cf,0x00cd11acbc853dc4,0x0017590409d27f1d,0x00d2176698082802,0x00fa01251b2838c8,0x00dd297a0d9b51c6,0x00d76c92c045820a,0x00534bc7c46c9033)},
+  {FIELD_LITERAL(0x0080ed9bc9b07338,0x00fceac7745d2652,0x008a9d55f5f2cc69,0x0096ce72df301ac5,0x00f53232e7974d87,0x0071728c7ae73947,0x0090507602570778,0x00cb81cfd883b1b2)},
+  {FIELD_LITERAL(0x005011aadea373da,0x003a8578ec896034,0x00f20a6535fa6d71,0x005152d31e5a87cf,0x002bac1c8e68ca31,0x00b0e323db4c1381,0x00f1d596b7d5ae25,0x00eae458097cb4e0)},
+  {FIELD_LITERAL(0x00920ac80f9b0d21,0x00f80f7f73401246,0x0086d37849b557d6,0x0002bd4b317b752e,0x00b26463993a42bb,0x002070422a73b129,0x00341acaa0380cb3,0x00541914dd66a1b2)},
+  {FIELD_LITERAL(0x00c1513cd66abe8c,0x000139e01118944d,0x0064abbcb8080bbb,0x00b3b08202473142,0x00c629ef25da2403,0x00f0aec3310d9b7f,0x0050b2227472d8cd,0x00f6c8a922d41fb4)},
+  {FIELD_LITERAL(0x001075ccf26b7b1f,0x00bb6bb213170433,0x00e9491ad262da79,0x009ef4f48d2d384c,0x008992770766f09d,0x001584396b6b1101,0x00af3f8676c9feef,0x0024603c40269118)},
+  {FIELD_LITERAL(0x009dd7b31319527c,0x001e7ac948d873a9,0x00fa54b46ef9673a,0x0066efb8d5b02fe6,0x00754b1d3928aeae,0x0004262ac72a6f6b,0x0079b7d49a6eb026,0x003126a753540102)},
+  {FIELD_LITERAL(0x009666e24f693947,0x00f714311269d45f,0x0010ffac1d0c851c,0x0066e80c37363497,0x00f1f4ad010c60b0,0x0015c87408470ff7,0x00651d5e9c7766a4,0x008138819d7116de)},
+  {FIELD_LITERAL(0x003934b11c57253b,0x00ef308edf21f46e,0x00e54e99c7a16198,0x0080d57135764e63,0x00751c27b946bc24,0x00dd389ce4e9e129,0x00a1a2bfd1cd84dc,0x002fae73e5149b32)},
+  {FIELD_LITERAL(0x00911657dffb4cdd,0x00c100b7cc553d06,0x00449d075ec467cc,0x007062100bc64e70,0x0043cf86f7bd21e7,0x00f401dc4b797dea,0x005224afb2f62e65,0x00d1ede3fb5a42be)},
+  {FIELD_LITERAL(0x00f2ba36a41aa144,0x00a0c22d946ee18f,0x008aae8ef9a14f99,0x00eef4d79b19bb36,0x008e75ce3d27b1fc,0x00a65daa03b29a27,0x00d9cc83684eb145,0x009e1ed80cc2ed74)},
+  {FIELD_LITERAL(0x00bed953d1997988,0x00b93ed175a24128,0x00871c5963fb6365,0x00ca2df20014a787,0x00f5d9c1d0b34322,0x00f6f5942818db0a,0x004cc091f49c9906,0x00e8a188a60bff9f)},
+  {FIELD_LITERAL(0x0032c7762032fae8,0x00e4087232e0bc21,0x00f767344b6e8d85,0x00bbf369b76c2aa2,0x008a1f46c6e1570c,0x001368cd9780369f,0x007359a39d079430,0x0003646512921434)},
+  {FIELD_LITERAL(0x007c4b47ca7c73e7,0x005396221039734b,0x008b64ddf0e45d7e,0x00bfad5af285e6c2,0x008ec711c5b1a1a8,0x00cf663301237f98,0x00917ee3f1655126,0x004152f337efedd8)},
+  {FIELD_LITERAL(0x0007c7edc9305daa,0x000a6664f273701c,0x00f6e78795e200b1,0x005d05b9ecd2473e,0x0014f5f17c865786,0x00c7fd2d166fa995,0x004939a2d8eb80e0,0x002244ba0942c199)},
+  {FIELD_LITERAL(0x00321e767f0262cf,0x002e57d776caf68e,0x00bf2c94814f0437,0x00c339196acd622f,0x001db4cce71e2770,0x001ded5ddba6eee2,0x0078608ab1554c8d,0x00067fe0ab76365b)},
+  {FIELD_LITERAL(0x00f09758e11e3985,0x00169efdbd64fad3,0x00e8889b7d6dacd6,0x0035cdd58ea88209,0x00bcda47586d7f49,0x003cdddcb2879088,0x0016da70187e954b,0x009556ea2e92aacd)},
+  {FIELD_LITERAL(0x008cab16bd1ff897,0x00b389972cdf753f,0x00ea8ed1e46dfdc0,0x004fe7ef94c589f4,0x002b8ae9b805ecf3,0x0025c08d892874a5,0x0023938e98d44c4c,0x00f759134cabf69c)},
+  {FIELD_LITERAL(0x006c2a84678e4b3b,0x007a194aacd1868f,0x00ed0225af424761,0x00da0a6f293c64b8,0x001062ac5c6a7a18,0x0030f5775a8aeef4,0x0002acaad76b7af0,0x00410b8fd63a579f)},
+  {FIELD_LITERAL(0x001ec59db3d9590e,0x001e9e3f1c3f182d,0x0045a9c3ec2cab14,0x0008198572aeb673,0x00773b74068bd167,0x0012535eaa395434,0x0044dba9e3bbb74a,0x002fba4d3c74bd0e)},
+  {FIELD_LITERAL(0x0042bf08fe66922c,0x003318b8fbb49e8c,0x00d75946004aa14c,0x00f601586b42bf1c,0x00c74cf1d912fe66,0x00abcb36974b30ad,0x007eb78720c9d2b8,0x009f54ab7bd4df85)},
+  {FIELD_LITERAL(0x00db9fc948f73826,0x00fa8b3746ed8ee9,0x00132cb65aafbeb2,0x00c36ff3fe7925b8,0x00837daed353d2fe,0x00ec661be0667cf4,0x005beb8ed2e90204,0x00d77dd69e564967)},
+  {FIELD_LITERAL(0x0042e6268b861751,0x0008dd0469500c16,0x00b51b57c338a3fd,0x00cc4497d85cff6b,0x002f13d6b57c34a4,0x0083652eaf301105,0x00cc344294cc93a8,0x0060f4d02810e270)},
+  {FIELD_LITERAL(0x00a8954363cd518b,0x00ad171124bccb7b,0x0065f46a4adaae00,0x001b1a5b2a96e500,0x0043fe24f8233285,0x0066996d8ae1f2c3,0x00c530f3264169f9,0x00c0f92d07cf6a57)},
+  {FIELD_LITERAL(0x0036a55c6815d943,0x008c8d1def993db3,0x002e0e1e8ff7318f,0x00d883a4b92db00a,0x002f5e781ae33906,0x001a72adb235c06d,0x00f2e59e736e9caa,0x001a4b58e3031914)},
+  {FIELD_LITERAL(0x00d73bfae5e00844,0x00bf459766fb5f52,0x0061b4f5a5313cde,0x004392d4c3b95514,0x000d3551b1077523,0x0000998840ee5d71,0x006de6e340448b7b,0x00251aa504875d6e)},
+  {FIELD_LITERAL(0x003bf343427ac342,0x00adc0a78642b8c5,0x0003b893175a8314,0x0061a34ade5703bc,0x00ea3ea8bb71d632,0x00be0df9a1f198c2,0x0046dd8e7c1635fb,0x00f1523fdd25d5e5)},
+  {FIELD_LITERAL(0x00633f63fc9dd406,0x00e713ff80e04a43,0x0060c6e970f2d621,0x00a57cd7f0df1891,0x00f2406a550650bb,0x00b064290efdc684,0x001eab0144d17916,0x00cd15f863c293ab)},
+  {FIELD_LITERAL(0x0029cec55273f70d,0x007044ee275c6340,0x0040f637a93015e2,0x00338bb78db5aae9,0x001491b2a6132147,0x00a125d6cfe6bde3,0x005f7ac561ba8669,0x001d5eaea3fbaacf)},
+  {FIELD_LITERAL(0x00054e9635e3be31,0x000e43f31e2872be,0x00d05b1c9e339841,0x006fac50bd81fd98,0x00cdc7852eaebb09,0x004ff519b061991b,0x009099e8107d4c85,0x00273e24c36a4a61)},
+  {FIELD_LITERAL(0x00070b4441ef2c46,0x00efa5b02801a109,0x00bf0b8c3ee64adf,0x008a67e0b3452e98,0x001916b1f2fa7a74,0x00d781a78ff6cdc3,0x008682ce57e5c919,0x00cc1109dd210da3)},
+  {FIELD_LITERAL(0x00cae8aaff388663,0x005e983a35dda1c7,0x007ab1030d8e37f4,0x00e48940f5d032fe,0x006a36f9ef30b331,0x009be6f03958c757,0x0086231ceba91400,0x008bd0f7b823e7aa)},
+  {FIELD_LITERAL(0x00cf881ebef5a45a,0x004ebea78e7c6f2c,0x0090da9209cf26a0,0x00de2b2e4c775b84,0x0071d6031c3c15ae,0x00d9e927ef177d70,0x00894ee8c23896fd,0x00e3b3b401e41aad)},
+  {FIELD_LITERAL(0x00204fef26864170,0x00819269c5dee0f8,0x00bfb4713ec97966,0x0026339a6f34df78,0x001f26e64c761dc2,0x00effe3af313cb60,0x00e17b70138f601b,0x00f16e1ccd9ede5e)},
+  {FIELD_LITERAL(0x005d9a8353fdb2db,0x0055cc2048c698f0,0x00f6c4ac89657218,0x00525034d73faeb2,0x00435776fbda3c7d,0x0070ea5312323cbc,0x007a105d44d069fb,0x006dbc8d6dc786aa)},
+  {FIELD_LITERAL(0x0017cff19cd394ec,0x00fef7b810922587,0x00e6483970dff548,0x00ddf36ad6874264,0x00e61778523fcce2,0x0093a66c0c93b24a,0x00fd367114db7f86,0x007652d7ddce26dd)},
+  {FIELD_LITERAL(0x00d92ced7ba12843,0x00aea9c7771e86e7,0x0046639693354f7b,0x00a628dbb6a80c47,0x003a0b0507372953,0x00421113ab45c0d9,0x00e545f08362ab7a,0x0028ce087b4d6d96)},
+  {FIELD_LITERAL(0x00a67ee7cf9f99eb,0x005713b275f2ff68,0x00f1d536a841513d,0x00823b59b024712e,0x009c46b9d0d38cec,0x00cdb1595aa2d7d4,0x008375b3423d9af8,0x000ab0b516d978f7)},
+  {FIELD_LITERAL(0x00428dcb3c510b0f,0x00585607ea24bb4e,0x003736bf1603687a,0x00c47e568c4fe3c7,0x003cd00282848605,0x0043a487c3b91939,0x004ffc04e1095a06,0x00a4c989a3d4b918)},
+  {FIELD_LITERAL(0x00a8778d0e429f7a,0x004c02b059105a68,0x0016653b609da3ff,0x00d5107bd1a12d27,0x00b4708f9a771cab,0x00bb63b662033f69,0x0072f322240e7215,0x0019445b59c69222)},
+  {FIELD_LITERAL(0x00cf4f6069a658e6,0x0053ca52859436a6,0x0064b994d7e3e117,0x00cb469b9a07f534,0x00cfb68f399e9d47,0x00f0dcb8dac1c6e7,0x00f2ab67f538b3a5,0x0055544f178ab975)},
+  {FIELD_LITERAL(0x0099b7a2685d538c,0x00e2f1897b7c0018,0x003adac8ce48dae3,0x00089276d5c50c0c,0x00172fca07ad6717,0x00cb1a72f54069e5,0x004ee42f133545b3,0x00785f8651362f16)},
+  {FIELD_LITERAL(0x0049cbac38509e11,0x0015234505d42cdf,0x00794fb0b5840f1c,0x00496437344045a5,0x0031b6d944e4f9b0,0x00b207318ac1f5d8,0x0000c840da7f5c5d,0x00526f373a5c8814)},
+  {FIELD_LITERAL(0x002c7b7742d1dfd9,0x002cabeb18623c01,0x00055f5e3e044446,0x006c20f3b4ef54ba,0x00c600141ec6b35f,0x00354f437f1a32a3,0x00bac4624a3520f9,0x00c483f734a90691)},
+  {FIELD_LITERAL(0x0053a737d422918d,0x00f7fca1d8758625,0x00c360336dadb04c,0x00f38e3d9158a1b8,0x0069ce3b418e84c6,0x005d1697eca16ead,0x00f8bd6a35ece13d,0x007885dfc2b5afea)},
+  {FIELD_LITERAL(0x00c3617ae260776c,0x00b20dc3e96922d7,0x00a1a7802246706a,0x00ca6505a5240244,0x002246b62d919782,0x001439102d7aa9b3,0x00e8af1139e6422c,0x00c888d1b52f2b05)},
+  {FIELD_LITERAL(0x005b67690ffd41d9,0x005294f28df516f9,0x00a879272412fcb9,0x00098b629a6d1c8d,0x00fabd3c8050865a,0x00cd7e5b0a3879c5,0x00153238210f3423,0x00357cac101e9f42)},
+  {FIELD_LITERAL(0x008917b454444fb7,0x00f59247c97e441b,0x00a6200a6815152d,0x0009a4228601d254,0x001c0360559bd374,0x007563362039cb36,0x00bd75b48d74e32b,0x0017f515ac3499e8)},
+  {FIELD_LITERAL(0x001532a7ffe41c5a,0x00eb1edce358d6bf,0x00ddbacc7b678a7b,0x008a7b70f3c841a3,0x00f1923bf27d3f4c,0x000b2713ed8f7873,0x00aaf67e29047902,0x0044994a70b3976d)},
+  {FIELD_LITERAL(0x00d54e802082d42c,0x00a55aa0dce7cc6c,0x006477b96073f146,0x0082efe4ceb43594,0x00a922bcba026845,0x0077f19d1ab75182,0x00c2bb2737846e59,0x0004d7eec791dd33)},
+  {FIELD_LITERAL(0x0044588d1a81d680,0x00b0a9097208e4f8,0x00212605350dc57e,0x0028717cd2871123,0x00fb083c100fd979,0x0045a056ce063fdf,0x00a5d604b4dd6a41,0x001dabc08ba4e236)},
+  {FIELD_LITERAL(0x00c4887198d7a7fa,0x00244f98fb45784a,0x0045911e15a15d01,0x001d323d374c0966,0x00967c3915196562,0x0039373abd2f3c67,0x000d2c5614312423,0x0041cf2215442ce3)},
+  {FIELD_LITERAL(0x008ede889ada7f06,0x001611e91de2e135,0x00fdb9a458a471b9,0x00563484e03710d1,0x0031cc81925e3070,0x0062c97b3af80005,0x00fa733eea28edeb,0x00e82457e1ebbc88)},
+  {FIELD_LITERAL(0x006a0df5fe9b6f59,0x00a0d4ff46040d92,0x004a7cedb6f93250,0x00d1df8855b8c357,0x00e73a46086fd058,0x0048fb0add6dfe59,0x001e03a28f1b4e3d,0x00a871c993308d76)},
+  {FIELD_LITERAL(0x0030dbb2d1766ec8,0x00586c0ad138555e,0x00d1a34f9e91c77c,0x0063408ad0e89014,0x00d61231b05f6f5b,0x0009abf569f5fd8a,0x00aec67a110f1c43,0x0031d1a790938dd7)},
+  {FIELD_LITERAL(0x006cded841e2a862,0x00198d60af0ab6fb,0x0018f09db809e750,0x004e6ac676016263,0x00eafcd1620969cb,0x002c9784ca34917d,0x0054f00079796de7,0x00d9fab5c5972204)},
+  {FIELD_LITERAL(0x004bd0fee2438a83,0x00b571e62b0f83bd,0x0059287d7ce74800,0x00fb3631b645c3f0,0x00a018e977f78494,0x0091e27065c27b12,0x007696c1817165e0,0x008c40be7c45ba3a)},
+  {FIELD_LITERAL(0x00a0f326327cb684,0x001c7d0f672680ff,0x008c1c81ffb112d1,0x00f8f801674eddc8,0x00e926d5d48c2a9d,0x005bd6d954c6fe9a,0x004c6b24b4e33703,0x00d05eb5c09105cc)},
+  {FIELD_LITERAL(0x00d61731caacf2cf,0x002df0c7609e01c5,0x00306172208b1e2b,0x00b413fe4fb2b686,0x00826d360902a221,0x003f8d056e67e7f7,0x0065025b0175e989,0x00369add117865eb)},
+  {FIELD_LITERAL(0x00aaf895aec2fa11,0x000f892bc313eb52,0x005b1c794dad050b,0x003f8ec4864cec14,0x00af81058d0b90e5,0x00ebe43e183997bb,0x00a9d610f9f3e615,0x007acd8eec2e88d3)},
+  {FIELD_LITERAL(0x0049b2fab13812a3,0x00846db32cd60431,0x000177fa578c8d6c,0x00047d0e2ad4bc51,0x00b158ba38d1e588,0x006a45daad79e3f3,0x000997b93cab887b,0x00c47ea42fa23dc3)},
+  {FIELD_LITERAL(0x0012b6fef7aeb1ca,0x009412768194b6a7,0x00ff0d351f23ab93,0x007e8a14c1aff71b,0x006c1c0170c512bc,0x0016243ea02ab2e5,0x007bb6865b303f3e,0x0015ce6b29b159f4)},
+  {FIELD_LITERAL(0x009961cd02e68108,0x00e2035d3a1d0836,0x005d51f69b5e1a1d,0x004bccb4ea36edcd,0x0069be6a7aeef268,0x0063f4dd9de8d5a7,0x006283783092ca35,0x0075a31af2c35409)},
+  {FIELD_LITERAL(0x00c412365162e8cf,0x00012283fb34388a,0x003e6543babf39e2,0x00eead6b3a804978,0x0099c0314e8b326f,0x00e98e0a8d477a4f,0x00d2eb96b127a687,0x00ed8d7df87571bb)},
+  {FIELD_LITERAL(0x00777463e308cacf,0x00c8acb93950132d,0x00ebddbf4ca48b2c,0x0026ad7ca0795a0a,0x00f99a3d9a715064,0x000d60bcf9d4dfcc,0x005e65a73a437a06,0x0019d536a8db56c8)},
+  {FIELD_LITERAL(0x00192d7dd558d135,0x0027cd6a8323ffa7,0x00239f1a412dc1e7,0x0046b4b3be74fc5c,0x0020c47a2bef5bce,0x00aa17e48f43862b,0x00f7e26c96342e5f,0x0008011c530f39a9)},
+  {FIELD_LITERAL(0x00aad4ac569bf0f1,0x00a67adc90b27740,0x0048551369a5751a,0x0031252584a3306a,0x0084e15df770e6fc,0x00d7bba1c74b5805,0x00a80ef223af1012,0x0089c85ceb843a34)},
+  {FIELD_LITERAL(0x00c4545be4a54004,0x0099e11f60357e6c,0x001f3936d19515a6,0x007793df84341a6e,0x0051061886717ffa,0x00e9b0a660b28f85,0x0044ea685892de0d,0x000257d2a1fda9d9)},
+  {FIELD_LITERAL(0x007e8b01b24ac8a8,0x006cf3b0b5ca1337,0x00f1607d3e36a570,0x0039b7fab82991a1,0x00231777065840c5,0x00998e5afdd346f9,0x00b7dc3e64acc85f,0x00baacc748013ad6)},
+  {FIELD_LITERAL(0x008ea6a4177580bf,0x005fa1953e3f0378,0x005fe409ac74d614,0x00452327f477e047,0x00a4018507fb6073,0x007b6e71951caac8,0x0012b42ab8a6ce91,0x0080eca677294ab7)},
+  {FIELD_LITERAL(0x00a53edc023ba69b,0x00c6afa83ddde2e8,0x00c3f638b307b14e,0x004a357a64414062,0x00e4d94d8b582dc9,0x001739caf71695b7,0x0012431b2ae28de1,0x003b6bc98682907c)},
+  {FIELD_LITERAL(0x008a9a93be1f99d6,0x0079fa627cc699c8,0x00b0cfb134ba84c8,0x001c4b778249419a,0x00df4ab3d9c44f40,0x009f596e6c1a9e3c,0x001979c0df237316,0x00501e953a919b87)},
+  {FIELD_LITERAL(0x00e413c68a4586a7,0x003ec446403679fc,0x00f284b604b3b436,0x007ef8125018d243,0x00d6b0a86cf18f1d,0x0065ebb4c2b505f4,0x00c110eb9f40e656,0x00975d950b1f2c9f)},
+  {FIELD_LITERAL(0x00654c303402a961,0x003b5af7bdfac6ba,0x0094319060ac107d,0x00f73a4c063a4883,0x0033dadc9890dadb,0x002c07abe51c36cb,0x00b2272ccc731daa,0x009517368ca0d233)},
+  {FIELD_LITERAL(0x00aafc64264023c5,0x00a0151496ac455c,0x00bd04d8ecf7c4aa,0x00f6d624e7fe6427,0x00bb996d47b4c1fa,0x00bb51a741e57275,0x00839b2ffa3f4538,0x00e6c3e0f2a040aa)},
+  {FIELD_LITERAL(0x00ff75c7d049cebd,0x0017e65d4bd11ccf,0x009ef224bb69e583,0x009641b8b0f11daa,0x001ab94fffe77a63,0x007e1a45ec1f6b42,0x00b987d512f48ac7,0x00fa79db26c1f27d)},
+  {FIELD_LITERAL(0x002b782e91680258,0x0025e14bc23faf00,0x00d2ec57ba084762,0x0013c1770bd8aa0d,0x00c63661bc49cdb2,0x004c2c5897f4ca57,0x00bc87c04beffd43,0x00e7151a232827a6)},
+  {FIELD_LITERAL(0x00039d8c4841ca2a,0x00b8f2b3a783eb8a,0x00f2e8ad568add8a,0x00f0b5e8b6a55f0f,0x0060d03a05425fc2,0x006a51713b6066e8,0x00a2eeb07cc0aee8,0x00b4eb3b309a2dd9)},
+  {FIELD_LITERAL(0x00b226f5656b4f7b,0x00511d68c15fd4a9,0x0021c4294fc0c017,0x00df9f211c01a867,0x00439bb6b23feca0,0x00e044575faa9c2c,0x00cd0195a56a0200,0x000ee94dbe6a9d0c)},
+  {FIELD_LITERAL(0x00afb55844c3d2c6,0x00b1021b66f98b8f,0x00ba83c1adeebfbf,0x00b17f3a323da58c,0x0030f78155052d86,0x00263c308b87d727,0x00d34a72cd61dd97,0x0090e5485a703e9e)},
+  {FIELD_LITERAL(0x0007c4d9669edc69,0x00269af0d7a6f939,0x00ebcb584f53bfb4,0x0097370c38067764,0x00ce2be5cc469219,0x0018a04bf4bdb92d,0x00cd6db2e56a2b50,0x00464c0d3ca529de)},
+  {FIELD_LITERAL(0x007c8e212000ba8a,0x004113d692744385,0x005c28338e5d8128,0x0060fc0892949283,0x00ab21f56e6ede53,0x00012f6814165978,0x007d16f89d900fa4,0x00c808421a2e4017)},
+  {FIELD_LITERAL(0x00d32fdff5184da0,0x001df652e5eef576,0x003d157ebfe13641,0x0006a5c4e5cd4cf4,0x0089342a483bb1c6,0x0098681dcf12192d,0x00f3faa9d56985be,0x003fef63a26f7cd1)},
+  {FIELD_LITERAL(0x00147150439d4884,0x00ab520fa3c80453,0x00d2cb5fa43311cc,0x00a52844786a78a2,0x0032ea6bedd88c35,0x00d05a8d1f80320f,0x00dd2e0ba752f476,0x00d7f5c52580304f)},
+  {FIELD_LITERAL(0x00b2f04df59255a1,0x00fe2ac8e5989b8f,0x00e7dcdda0b21a7c,0x002d422458057222,0x0035d2af379e319f,0x00946eebf1d5ae41,0x00c7d5538161e1fb,0x00216c4722e7deda)},
+  {FIELD_LITERAL(0x00a5d64f3361d64f,0x0032f6475a462003,0x00cbdcc0d10a9d84,0x007efc3ed6c9e0f9,0x006eaa7bd38dfa16,0x00fe868d9102eff2,0x002e83620dc43155,0x002f1c5a6a4efcc4)},
+  {FIELD_LITERAL(0x00b88e94d17813b5,0x00b4002ba77bb154,0x00adeb1f700db5bd,0x0038e166ada0c890,0x00123247320cab97,0x00365452450306d7,0x00877506e59bf26c,0x0027681df7a2e221)},
+  {FIELD_LITERAL(0x0062b9acbc033fa8,0x00ead872f2c82cb5,0x00a46fd2ecda2929,0x00a517fb77431e5e,0x008a1324edb49892,0x00a9c5ececff29e4,0x00bd7ff96701fc36,0x007153a19202ef5d)},
+  {FIELD_LITERAL(0x000a0c82ddc1fbb6,0x008d350364957178,0x00bf1383cfe6d8e8,0x00afb34794b5d6a5,0x0073bd5491bf0b8c,0x00de2a7f451b81af,0x00ad23c46ad5d792,0x00090af6548b2e66)},
+  {FIELD_LITERAL(0x0007cf5670ceabe0,0x00c983ad67faad83,0x00bda8e74e4db53a,0x007f36e2de81eace,0x00252afd593613a7,0x00513bdedb2037c2,0x00cc04cac5e18f98,0x00ba7f8e0c3cb628)},
+  {FIELD_LITERAL(0x0047bcecdb9b6d68,0x00e7c8c16ba4cc5a,0x00ba517259fed111,0x0096aa8f0df64475,0x0032a48f6f63bb66,0x00af2ea6e8c83c71,0x00f9f9d9dd71cafa,0x006dc8868b09a2cc)},
+  {FIELD_LITERAL(0x0043e68a3a85180e,0x002530be422af47f,0x002da968ac01658b,0x006d78eb0f53030f,0x00108e04987ba712,0x00034e6f9d1b547f,0x00e4f6499b2dbd01,0x00727a8f4a084993)},
+  {FIELD_LITERAL(0x0047e6ea5faa14e0,0x00cd456ba9358578,0x00b1a9e3bee6a947,0x005ec2fac9b5d47c,0x00ddeaf5df121013,0x00a5e91a877e5aec,0x003e3d4cbd2f2e06,0x0045f060182bd44f)},
+  {FIELD_LITERAL(0x0094e56962712778,0x00f59beb7144bbf8,0x00f7c61fe70e2eca,0x00e19120474b0109,0x002e85a29382ec81,0x00f4deecd963d5aa,0x0017850eaccf2a57,0x0061d34af8de987b)},
+  {FIELD_LITERAL(0x005149c050637392,0x003effee1eb53636,0x00df69828b6d49a4,0x0003d1c2be4dc31c,0x002c0fc41fb25bf6,0x0096daf8a477703c,0x00982f4243db6630,0x000c5999ac9b93a1)},
+  {FIELD_LITERAL(0x005ed781e94a0565,0x004728fd8fb2291d,0x00dfd625fa0b9e8e,0x00cbd08540ad01d4,0x0016ec7470e591e4,0x005c16878c369c17,0x0090159c97a96d33,0x009dd7b6e0518785)},
+  {FIELD_LITERAL(0x0044931b5c5b5041,0x009c0409a1f15e0e,0x0007a06ca71c63cd,0x005202629723b6e2,0x0028404350ad721c,0x00c80c29ace3f7e1,0x00ee5d6b512761f6,0x0019e46855d2c1eb)},
+  {FIELD_LITERAL(0x00de62235c6ab9f6,0x0073e0be96b8b40c,0x00399331b50cba2c,0x00174728fcd125b5,0x0082e7c9f1fc33c5,0x00344cc7c5eb91fb,0x005eeb2603e3c440,0x00b160f08a7ef705)},
+  {FIELD_LITERAL(0x0085b642a0f1f14b,0x00356f6b3ea5943f,0x006b84e0bf4bb2d1,0x00c4d267d9d91638,0x00256f3c4022a6b3,0x00743433abf100bc,0x002f1638fd7f2105,0x001f5c4d40dbdb3e)},
+  {FIELD_LITERAL(0x00be95b07f00ecc6,0x00aa8c5941b985ad,0x00dd0fc7e158eff6,0x009b0a9b5f807a8f,0x00b1bbb041403f13,0x008fedb18ac01220,0x0007cafd0cd4b638,0x00494a5e5a5be833)},
+  {FIELD_LITERAL(0x002b108946e14b76,0x00f29485d541f43b,0x003957b0b77fc57d,0x0010b3507d4316f1,0x001e24ce7b695f82,0x009199e62ee390d1,0x00b47efeb2e0d9a8,0x00b3a6d3f94dbf25)},
+  {FIELD_LITERAL(0x002c4e6b1705e778,0x0095cbff716069d3,0x009ddd7ca73fa96c,0x00f822553b7c8ea3,0x0070f657917dc4a3,0x0098f0a93b12ec8d,0x003f38bea563f500,0x007bb05c8e5060c7)},
+  {FIELD_LITERAL(0x00155ec7bd28cbee,0x008d3086ac6e2add,0x0003cad477b18f43,0x004d12e59dcc1d81,0x00c308bbdb5cd1ca,0x005a4a8f54791ca2,0x0038ab8b2e3d033f,0x00a1cd18f059cfe6)},
+  {FIELD_LITERAL(0x004d7bcc0035b9a3,0x00a4f1b80f0e6931,0x006e4742bb2aaa16,0x00f5e3ec8448e6d0,0x0096dbcd44c19e51,0x0094a6cd2fba6789,0x0000db365bff3e85,0x001a83b4ddade56e)},
+  {FIELD_LITERAL(0x00f28b9dee3f3a02,0x0042c4e8a1081011,0x0048f75168434e55,0x0024c62dd8eb7933,0x007cc5c3762505f8,0x005e68695bd113e3,0x000c02152ee95e9f,0x005b8ea15d5e0dcd)},
+  {FIELD_LITERAL(0x003a2f88163d8944,0x0071cc5952b80224,0x00beb00d5298b6ee,0x0040d326f1e1c3b9,0x00424255474e8d3e,0x008905181870f841,0x007844165f6add23,0x00a6968394d665e7)},
+  {FIELD_LITERAL(0x00d59359eaf0f1cd,0x00680239585cd7ec,0x00d763e37c894435,0x001c3d9af863c48a,0x002e2c0117fb0ccf,0x001c25c191c5a953,0x0025a4509ac53351,0x00e75eb6dba99638)},
+  {FIELD_LITERAL(0x00e6d46ad132ee44,0x007db85463fbd884,0x00b243fc7fd9b7e9,0x009c7344d5d78e50,0x0068edfd21bbe8c4,0x00aec4f969e4f794,0x001cdc6922e4a7e7,0x00aeb7e809725fd8)},
+  {FIELD_LITERAL(0x003a71e384b38cff,0x00c8000b916e809a,0x00367c3a34265eb1,0x00e1e7a835f4cf98,0x00a24252bb23185a,0x00d052bb202ae958,0x0060fd728bd1a610,0x0070dae251540916)},
+  {FIELD_LITERAL(0x007aed4375b3abd4,0x005d526c0a705012,0x00108b10daf36b56,0x006f9ee64a5e4120,0x004ba43f0329dad8,0x00791c7c4f89e347,0x003b98ecbb8b92f0,0x00ad624347adcdec)},
+  {FIELD_LITERAL(0x005bd1d62f6526e6,0x0017444e96fe2aa1,0x00fd8757e56ee709,0x005d335f77e40727,0x00c187f28c6e4d5c,0x006d4eadb0ef0a3d,0x00d84aaf7ba3760a,0x0084a16d0a5de921)},
+  {FIELD_LITERAL(0x0019f05b71d75738,0x00ff1a33aa4af262,0x0089c4da07b68282,0x00890814bfc9ae08,0x003262e4526d5c44,0x0028ad3974abed50,0x00c7368bc336370f,0x00b1f6abda4324bb)},
+  {FIELD_LITERAL(0x0078828fae951616,0x00ff3b1aa2cd8698,0x000fce2f5f06fbd1,0x00327e568b7ddbba,0x0022ac2bf74bb595,0x00f7b85ae51e2ffd,0x001c156fc5f93eed,0x00396d2b07502fc7)},
+  {FIELD_LITERAL(0x0044c203e3b01d6f,0x0096624c7965f587,0x000f37c4aa44e4bf,0x009a606643fe0ab7,0x00e339bf1ffd8836,0x00933e3694f51cf2,0x005f8b6b8c14a32a,0x0058edcc7c4e5641)},
+  {FIELD_LITERAL(0x0096e0fed8cab38c,0x003dd5972f9c0da1,0x0096830b70acfa59,0x005cf00d85205cb2,0x00f697684856be43,0x00dbb7d61092adf1,0x00f5667c43a72ed6,0x00c88cc090f21b99)},
+  {FIELD_LITERAL(0x0058ce78e4a12941,0x0063f94afce07abb,0x00e8d9068a6258bd,0x00f037373c97892d,0x00be3efee0a7c9ae,0x00d72ead32bcc50d,0x008212a5d5a773bd,0x001d8432c369de28)},
+  {FIELD_LITERAL(0x00438df92cbe8a90,0x00fea66c19e57e0d,0x0096df0a20a3bd06,0x002286db9c685348,0x003635a73e0b9c97,0x00d1ec3f8469102c,0x003229e8e0385ef0,0x00fc8192af89e90c)},
+  {FIELD_LITERAL(0x00abd1aee4589249,0x000ad4d4bdcfd483,0x00d25708826b621a,0x0075a3b1017f3105,0x001da686e6925827,0x00968dd442baca4b,0x004a9dfe45d06bef,0x00424f55830132f9)},
+  {FIELD_LITERAL(0x00a5b6ebff72b4f7,0x00f92709fa31be4a,0x004e567bccda707d,0x0098c9b0ff897f2a,0x00707507e7de7a25,0x00c443854830ec81,0x0048ac60973c8908,0x000094095446b1e4)},
+  {FIELD_LITERAL(0x00b7f4692e1dc87f,0x0033d1f6fb888fc5,0x00ca54acf4711e37,0x007eb769ad2e3a7f,0x009b5e6809d499dc,0x00a9b215c139f0ff,0x0082f83e606c5e34,0x00d7bed1ed7cdc04)},
+  {FIELD_LITERAL(0x0094fb1bd7f8715b,0x0098c893819c96f3,0x00128f0cde47a915,0x0080a160e9e87009,0x00871bf39a9d737f,0x0086bfbef16f6a3f,0x00fce080af5e4996,0x0075263831021c3b)},
+  {FIELD_LITERAL(0x00190acce9243e96,0x00df3d862131f966,0x00b6864c89804337,0x00ed02cf9bf5995d,0x00f6c779c88cc2ca,0x003f1faf5f18e3f4,0x004d12d37d06dacc,0x00fc6d7b8d35d91f)},
+  {FIELD_LITERAL(0x00337c5ffc7b33fc,0x00e661d4be0ea953,0x00f13bc397532e5c,0x00dfc67179dcf16b,0x00a4b7a3a82dc211,0x00c75356a05fa563,0x007cd5d30af0329c,0x00e31e3e8080350f)},
+  {FIELD_LITERAL(0x002430f4b394a5fd,0x002c94dd347577ec,0x00a27058f2385c43,0x00038de48b3886bd,0x00b836eb90925c55,0x00ffa6afd8e09d63,0x00d20715d4200af8,0x00abec58c011c451)},
+  {FIELD_LITERAL(0x00772d9747bba1f7,0x00ac9854600b69ff,0x0045c1642dcdcfd2,0x00684fb2fc8d3c34,0x001a59baf781a0b0,0x00c6658b19f46812,0x00ed40f78be13d5a,0x0027f47fd40df0ed)},
+  {FIELD_LITERAL(0x002bd1f6ad105160,0x00ff4967b72ee2df,0x00ab35f1bd4955a4,0x00dbca5aef876a2e,0x008ffccb6c9ee0ba,0x0040a1470d2293c8,0x00459d02e2fd345f,0x0056c3f938804b92)},
+  {FIELD_LITERAL(0x0098c7d75eef9bfa,0x0066561b76a530cb,0x006f1da7063148ce,0x00c01733f969c2af,0x0095c019cacfded2,0x005a794d38bc776c,0x00754705936d5527,0x001c0df00ca72048)},
+  {FIELD_LITERAL(0x006c395f64f042d0,0x001ddd88bfbae06e,0x00dc67f2423e4f06,0x0083aabd983e7159,0x009cd642d96d8d26,0x00c1cabd008f6771,0x0048a01b02fe595b,0x000e378160eb7b93)},
+  {FIELD_LITERAL(0x00f27612f6ece95b,0x001dc6fec10c16c4,0x008815cb47705cd8,0x00be7f902ca1a77f,0x006740e60401d0cd,0x00a75694183bc516,0x006a88f3059b3538,0x00ceeddd2b8c3421)},
+  {FIELD_LITERAL(0x00efba96c47d81ab,0x00dccd08d752fabd,0x001762dde9468fbc,0x0083d3f2426cb82d,0x00d0e6ff84f5b6c2,0x00766afd18439471,0x00b5b23b46ea30c4,0x00d459fba5961be7)},
+  {FIELD_LITERAL(0x00fd510d0e6958f1,0x0004af90d417c6ec,0x0038861784e95676,0x0052d64e188b4fd7,0x001145af44a06d53,0x008c1a8f048f27bf,0x000876bc4f04e71f,0x00f0edf124d825f1)},
+  {FIELD_LITERAL(0x00d4d776d2a07c2a,0x0005aa01c7fa84ec,0x00377775b1a8c823,0x007c1d680182d08c,0x0011623f3f3d4d2b,0x003f521b7438f2b9,0x0095fe70fcfec80f,0x009c52a1d52676c2)},
+  {FIELD_LITERAL(0x001dae91b3e451de,0x006c7d22c5ab8290,0x0070c41471d7d1a9,0x00d47998a10f0555,0x00c0b6615ec75ce0,0x00cc2f775ed2db90,0x0095551189a3d6cb,0x000cc4ec55ba92d4)},
+  {FIELD_LITERAL(0x00c1bce233c99768,0x00ae4dc3397a8416,0x00b7687d0c892215,0x00880403a7137802,0x00a2c55d54773e94,0x0087d2cee9407ff0,0x006ddc423463219c,0x0087686efaeb8395)},
+  {FIELD_LITERAL(0x00a69b9c77db0b99,0x00b5b29503b76f6c,0x00565233779b3fb1,0x00979f023a40700a,0x006eadeef123380e,0x000875f5b93b9595,0x00504196f0e7325b,0x00b471e929c19a67)},
+  {FIELD_LITERAL(0x002040a6cecb4737,0x00e4809d8dc21e54,0x005600d8b37df1ca,0x00f411004914feac,0x009e6640522c2987,0x00c2037a319f0483,0x008e830c5488d41f,0x00b0e22bc9146bdc)},
+  {FIELD_LITERAL(0x00d575aed321e12f,0x004c7c474620bed6,0x00b0b552bb6351bd,0x004bffae3995c317,0x00a3f47f383b524f,0x0002571b28f04734,0x00406cdc308fa532,0x008c784ea92e41b4)},
+  {FIELD_LITERAL(0x0065f84aa06799d6,0x00e3538cef848272,0x00acd2c5a786393f,0x001999854fb55bde,0x00c9915af0ed6a6c,0x00825d48c7b35a8d,0x00a1b2e8154cd00c,0x00c3f1830625615d)},
+  {FIELD_LITERAL(0x00337475459c17bb,0x00b34e6035440974,0x00a3d69bb57e49d7,0x00adad2d5503a0f3,0x004626a6e76ec54a,0x008518950bed9884,0x00effab448dd343e,0x004c5e545ec88c8a)},
+  {FIELD_LITERAL(0x00ae8a76c3edd8ab,0x003dbc2edec0d68a,0x003cd85daa1b6592,0x00f2ec7f48419a5a,0x00270420f2275e7c,0x0098b40e4feb1c7e,0x0056820c73e6a909,0x0058b2e224bb7514)},
+  {FIELD_LITERAL(0x0060c9d65b245e41,0x00d5fe4832490bca,0x00b9d3b1c42e31ae,0x0066a274a3daa441,0x00991094a7bdde43,0x00703fce348b9134,0x008e054a5a6e875f,0x004d0bde075185a4)},
+  {FIELD_LITERAL(0x0024582656910b7c,0x00f301372d8240e3,0x00b50094162c2b28,0x00a2da26cc1d3a96,0x00b2e3c8dd4aa356,0x005c487c23eaba59,0x00454fc5d9bd2ff3,0x006ebb92ee1e3172)},
+  {FIELD_LITERAL(0x0063ccbf8dd5e635,0x006910622644fdc2,0x00ae7bc4ee866346,0x00b8b5e5ee9f3549,0x00269f749557cb27,0x003d27ceed19d102,0x000fc8dcd186629a,0x00e6d9dc84290c00)},
+  {FIELD_LITERAL(0x00a0d5c185126b85,0x0072835459a05f2c,0x0091dda454e2e1ac,0x00d1cd6fd668aa7a,0x005dd6cba70dc22c,0x007895819f297278,0x00dc259bffdd0531,0x009f68a508ae7759)},
+  {FIELD_LITERAL(0x006c0276b0565e6e,0x007f2a9fc3f1d186,0x0050750c26804453,0x00226ec4f36ce2df,0x00b7ecab414432c0,0x008e073e2b38c775,0x003a047b55d11df8,0x00e144683d185730)},
+  {FIELD_LITERAL(0x000bac4bed91c54a,0x00da7d56ebc7105a,0x00cf075bdfda22c1,0x00aaa356d93e9468,0x0044de217586c689,0x000f377b0d93dad8,0x0018e1cdfef0fa83,0x00a89abfbabb0482)},
+  {FIELD_LITERAL(0x002af05096b91b83,0x00e3ba22b83dc44a,0x00910ac70bed60ec,0x00b30f6307f56337,0x004af6d920477f04,0x00a0449743efe536,0x0078e53b5f7b12c0,0x000ff56b057102d2)},
+  {FIELD_LITERAL(0x00f888a49d1d5974,0x0027d34cfdabf437,0x006115ce266e39dc,0x00f65084a523906c,0x00a2530b4334a121,0x00a3b8ed24d8d900,0x0030db214b1e2975,0x004c224a94cba8c6)},
+  {FIELD_LITERAL(0x00c2c9c3787867af,0x00f23b5da23a0bd9,0x00293fb05750383c,0x00f5284b8dbcedfc,0x004a9ee136eb51b4,0x009670e9325914cd,0x00ca270007fcb414,0x00f21a56ffdad921)},
+  {FIELD_LITERAL(0x00e44023e593730d,0x00e1d642e5254e9c,0x003943432230b74a,0x0043ad1e213034e6,0x00ac50dc4cfba6cf,0x00abedf93d1633a4,0x007efe6fbaaf27f4,0x003b59a54b91d645)},
+  {FIELD_LITERAL(0x00703d0b90b0e031,0x00fe4a291a103857,0x008316df8469d7d9,0x009115e88b6690ae,0x00a4d1c29648cc33,0x00f0c74316c45056,0x0037f4c8029cf158,0x00dd30eb788049b0)},
+  {FIELD_LITERAL(0x00663971208c2a52,0x00bd4beb50c77557,0x00ef2383739b1817,0x00f476b20550b079,0x00fcc580724604af,0x003d5eafa4cfed14,0x00792e7484bc471b,0x00bb3224fccf839d)},
+  {FIELD_LITERAL(0x006a6a6b11582bf2,0x00241753f96ebe7a,0x0017ebf41723b02d,0x005c7299d91d597c,0x00cbeae8fa834cb7,0x00e047cd0c59c228,0x00e77fa5ab52dfd8,0x00282f59460bcf32)},
+  {FIELD_LITERAL(0x00411a58479b2254,0x00e7af7054c33e19,0x004527c8df9408ca,0x00c6dea4106f5c20,0x006ba16a46a69cda,0x006cf63c0e9dfe3b,0x00f4e47e0d34b53b,0x00d6769d1dd689d5)},
+  {FIELD_LITERAL(0x0090f846b8e44a2d,0x000febc6d1760040,0x00198559e76668c8,0x001fdb14701fed04,0x00a3a7bf92ea2b36,0x00445dc761bc03ae,0x0098baf24c192ada,0x00bb1495e6aa214f)},
+  {FIELD_LITERAL(0x005193aa5acb6919,0x00f7c82f3be9e6fe,0x000676f8d1c32365,0x00b7a673d170dc1b,0x001bbac91dd03347,0x00dea168de46e0bb,0x002a6b2de6fa63e9,0x00676183c255cdfc)},
+  {FIELD_LITERAL(0x00a6f25ea7ad5842,0x000a48a1fc231c21,0x001deead68e68d00,0x00ced568e79967d3,0x000683ea8aa10f15,0x00044742b79b5043,0x00b9a6a309a4f8fd,0x002cf92e1bbfe25a)},
+  {FIELD_LITERAL(0x0031561c7b2b532c,0x00c95ed23cbaafb3,0x009e91af12b78d9c,0x00a040d006e7647d,0x001ee1d5e7fc39aa,0x00980183a398c8f1,0x0037d82af144c94b,0x0019f71c959bae3b)},
+  {FIELD_LITERAL(0x005e552f9702cf02,0x006657e60ee02932,0x00e86f5d5da91f03,0x0064f50212df845c,0x000859ef00aef8d8,0x00e96ae6faa7bf33,0x0024047a721a43f2,0x0090bb2bb962edde)},
+  {FIELD_LITERAL(0x003ef7032f196cd0,0x00a07c587a81a6b4,0x00879e5bfbf8e41f,0x00ac9cf6431810d3,0x00fe1e02d4da9908,0x003055dfdaaa5f20,0x00377d1596d673c0,0x00966ad51fc22ace)},
+  {FIELD_LITERAL(0x0001bf645f644528,0x00e58a0381eb7cdd,0x0014eb550b33d370,0x0001412a4835017a,0x00c74cd0e88d70b2,0x00e6d70421530139,0x00154dc396bf07c7,0x00d2c3ed25504aaf)},
+  {FIELD_LITERAL(0x00d7dc22c67da06b,0x0013b6a923c22d73,0x000ded79b6f49405,0x00a3d933fe655108,0x009b066cd146111d,0x007035b84bd58d01,0x0089e49889571351,0x00eaebd558266ffa)},
+  {FIELD_LITERAL(0x00a316611a09c0e6,0x0007b5fd5afb801b,0x009b3f617c4a864d,0x003fbb5be10eece6,0x00c3f319ddbf937b,0x0063d9f2d19eaad1,0x008fbfb7e0566531,0x008bea72cec73b6b)},
+  {FIELD_LITERAL(0x00ae03c31ffbb51d,0x00d199a32332c2a5,0x00f436948e7a2341,0x00e2177398f92e7b,0x0010a223524900ac,0x00678b1cc022c8a6,0x000cbf223b4393c2,0x00c1839506920e6d)},
+  {FIELD_LITERAL(0x005e093892995237,0x00bd29f6573b3464,0x00ef256f2bfc9f72,0x00bf349f5a40060e,0x006f5a68ff0fba43,0x00434c3e9bfef612,0x00e40e5d691ed21a,0x00f81ae7781544f9)},
+  {FIELD_LITERAL(0x00e4007117649995,0x00fa424a4361633d,0x00bfbd2f99c5fa15,0x00210b16fcc7ad0b,0x004e2cc48f28406a,0x0063e166afae7dbd,0x00c8140897dd2261,0x0046587de8ef8a38)},
+  {FIELD_LITERAL(0x00f223bbd96cc532,0x0077df24aafe2789,0x007b021a2c130a86,0x000c431599191b43,0x0093cd8cf3baaf34,0x00776cc1a5130e67,0x00187a0fdd3efec3,0x002b746fe5c3cd89)},
+  {FIELD_LITERAL(0x00bec3f5173410bb,0x00691f9151b0568a,0x00d0254b1a2f41ac,0x00886508882d1aa2,0x00be6c29afa2e6e9,0x00711dc9d3ce1639,0x00f1d1f0cdef233f,0x0052a7daad00605d)}
+};
+#if GOLDILOCKS_WNAF_FIXED_SPLIT
+const gf API_NS(precomputed_wnaf_split_as_fe)[192]
+CACHE_ALIGNED __attribute__((visibility("hidden"))) = {
+  {FIELD_LITERAL(0x0075fd1241fb006b,0x003a09275d3644a2,0x007a1744ccf42983,0x00c72633b39f66f8,0x001fc99f55438cc6,0x00c71cd00ea2eb65,0x00f7f724ed5950b5,0x000839316ab3c704)},
+  {FIELD_LITERAL(0x008de4ac4c9a9854,0x000ecd24e9652c12,0x0077cb2bdff18870,0x00ec6cef30f79c7a,0x00831e4f6113ba82,0x0098dba3c4eda655,0x004dcc5899b361cf,0x006375c1c82bece1)},
+  {FIELD_LITERAL(0x004c9af0653b190b,0x00ad7d06f87edec6,0x007483e2a337ae8c,0x009cbac9ef29f28c,0x00fd779e4d8f7383,0x00a14430d5558a3a,0x004b9d0c187d2bf0,0x00b2ab442c9752eb)},
+  {FIELD_LITERAL(0x008e982b953dd8b9,0x002a255bd122f13c,0x00dbe8aaaf121bbf,0x000cb11c52dc1627,0x003150b12f174244,0x004ef98e9aed547b,0x001260a4b3cf2f9c,0x00e13bc302453154)},
+  {FIELD_LITERAL(0x0080a1945056586d,0x002e36e76b4086bc,0x009f6a413eab4223,0x00ce3116586ebdd8,0x00127df02b6d1266,0x00c30a32d4033c63,0x00528d28cddd6739,0x00fee79efca6fc67)},
+  {FIELD_LITERAL(0x001ca88e72a17f4f,0x005b282378abfb8e,0x00b08832180cc686,0x0040d526ec25e535,0x00a173eac15961eb,0x0048c632ad5206b4,0x00e6ccef65ef8e8b,0x004b3a1a8f33390d)},
+  {FIELD_LITERAL(0x0046ebfc18490cf8,0x001dc5838d8f075b,0x003841d56dd0d83b,0x0088f6daa20dc032,0x005b2f5d37c35050,0x004034e61448bd7e,0x008d8c4af1565118,0x00a4a87918cdcfd3)},
+  {FIELD_LITERAL(0x00e0cc33b7f9fdd2,0x0057739c80ce7ab6,0x00de90bea754ec6b,0x00294b75bd7f1ea2,0x0029a5f907663b13,0x001bc0c084f5c348,0x001cf7cfebac8855,0x003a79d244fafea1)},
+  {FIELD_LITERAL(0x0041c1d7fb47b3db,0x00a1c9fcd4da560a,0x00a1ac68df356c69,0x00d6a2e1a7670754,0x0099b759e1600760,0x006201df49c03e2c,0x008e19aa126eb9ce,0x00e35cd9e64fd7c6)},
+  {FIELD_LITERAL(0x00b71e4cbfbeb090,0x00df4bfd3d4505ce,0x0055588254b8045c,0x00c39a9ab10542b5,0x00e1b65c8629e70a,0x00f83a50f9cae820,0x006488f236798ea4,0x0065894646a4c840)},
+  {FIELD_LITERAL(0x002a75151726dfbb,0x00544204599697b4,0x00e05e149a84045f,0x0025a656d4b60f79,0x00ca9bae001e24ea,0x00601cc07ffe46a6,0x00e7d1a8c5c46e6f,0x007e94ee17dff170)},
+  {FIELD_LITERAL(0x00482f2895f6a14d,0x0000dc2f794bdc9e,0x0059098b1dc34c01,0x00ef0c6c5cd21a34,0x00da41c9c24c2c97,0x009a2ed1485f6123,0x00bdf7557e8b7b01,0x0045dde397e8bcb9)},
+  {FIELD_LITERAL(0x003cb3efd51c0b45,0x0045cf76e8f98286,0x00dfcbf214d8cb4e,0x00111e569a91b59d,0x0030289fe49394ec,0x00a63191d5aca5f6,0x007388c8b0d16b13,0x0012712eeb33712f)},
+  {FIELD_LITERAL(0x00c08c4f0eddb3ed,0x00a69cb406bbc4cd,0x00466b5c14b6a5c9,0x008e2b6b568d58c4,0x0091f242ab58a92e,0x005b983c449357db,0x0040131296fbbddf,0x00afd385ac412ecc)},
+  {FIELD_LITERAL(0x003f6f9ddaa11a49,0x00e2aa10c1e04a83,0x002aa34097c174df,0x0056bc91a2cfc298,0x00dd145138ad8643,0x009b502e5fbf2273,0x004daef8dadf16de,0x00e0d58533945ca6)},
+  {FIELD_LITERAL(0x00667cbbed8610aa,0x00178dcfc08cdc1b,0x00143e1c5029fab1,0x0025090ba50d0eb5,0x00afef138ae199f2,0x003f143bea5973c0,0x004f0595d97a2f06,0x00317823b2f54f1a)},
+  {FIELD_LITERAL(0x009d138105b87c6a,0x008cf0b180aedef9,0x0001982f8c9acaf2,0x009b615e6d889105,0x00a5a4f54707c6ee,0x00d8a76f839935e8,0x00e56e9b92d1393d,0x00f56be8bb23407f)},
+  {FIELD_LITERAL(0x0049c83a92170c76,0x00179f01515f623b,0x00aa76c57f998717,0x007f4dbb2ecba20a,0x007339b98b275693,0x00f99b1dfd314e0a,0x0090d38aecf21c5e,0x00e9317e8712f592)},
+  {FIELD_LITERAL(0x005464c86ee0e242,0x00b232cbdda78d20,0x009aabd33ca9c284,0x00c38b6a73071963,0x00b983c870c1a2bd,0x007792f93c8289f5,0x00aaa5fd64c42553,0x00ba99d2595045d8)},
+  {FIELD_LITERAL(0x00d0b1296dce7fd0,0x00b5b550cac92797,0x006b692b7843c59f,0x00701d3e5162c3c0,0x0079bd73ba5b14bc,0x009d148d26b87ad9,0x00d41b1b5f8ce7a5,0x00648ea39bd13e13)},
+  {FIELD_LITERAL(0x001683bf57fb049e,0x0037176b75c054c1,0x00386482d2b20213,0x000ad4b193f5c38d,0x00433efb60a1f163,0x00202b5e325402d4,0x00408524495b89d3,0x007d5b123aff637b)},
+  {FIELD_LITERAL(0x00d67e6725beba3d,0x006f173a828e2d5d,0x00e3cb13a5dd95ab,0x0058b79a72974501,0x00f45066bd65e32c,0x00852267d8ed6444,0x0077fdf70b81517b,0x0059d2429800c77f)},
+  {FIELD_LITERAL(0x00430f0ac3d142e0,0x0026a623565bf1bf,0x00b7bf63df20cd37,0x008035abed4a5eae,0x00d3dbb0df825adc,0x009d31a0e1633300,0x00c98906d65384aa,0x00b626aabeba2ed7)},
+  {FIELD_LITERAL(0x007f4cfae81f1423,0x009cbef98c3fe8df,0x00e98863c956964d,0x00fb5713f4179e13,0x0013863d36d10c95,0x00d2f1e4c555cac0,0x00eda9baa50fac33,0x00155692c4a7176e)},
+  {FIELD_LITERAL(0x002cf4d8374137e0,0x0011bcd01cfc8b65,0x00d819428459350e,0x00c2636e55507d46,0x0043bfe72bf49f44,0x00e232e73e600c93,0x00f4cd7ea6144b4a,0x00c8117c7c63707a)},
+  {FIELD_LITERAL(0x002bc6bdaffe2cca,0x0088cd41ca85d89c,0x0080f8199e0742d1,0x00c0d806414e6e86,0x000b13ead9dc050e,0x00c0db5268db156b,0x000aacb76c4120ec,0x0075a902879d2720)},
+  {FIELD_LITERAL(0x007c8f764c23f360,0x0031e6e513a6024f,0x008e4e840ad92c73,0x004325092a3b9a6d,0x00f63712a826406a,0x00409096924a78e0,0x008d28ebdd651f48,0x002331c8cd805b7e)},
+  {FIELD_LITERAL(0x00eb7c2e84be8f9e,0x00225da3976722bb,0x0092175b84abfc77,0x0045ae12de030531,0x0065c57427d6bddb,0x008a30ec7e277ba8,0x0012442a0185745b,0x00620b4b99019d9d)},
+  {FIELD_LITERAL(0x002303cf587ec4d8,0x00a960baaa467b02,0x00bde9a108ad0446,0x001d17fb0182279e,0x004b9bacc68a8c06,0x00a03b2994097255,0x004e79c82db8c972,0x00a0afb289adb754)},
+  {FIELD_LITERAL(0x007670df487c8c6c,0x006e5ac06f3aa617,0x0013351c0ce48529,0x00ac8802da82aec4,0x005cf2967d3eda36,0x00b802b7c48e5ef4,0x00b7b0907570c503,0x00262a7d37014b92)},
+  {FIELD_LITERAL(0x00bc57af5ad474d1,0x00b83c9890b6d477,0x00da60f2b3932ccc,0x00f4f00e085f0325,0x000f84bd8401e0d5,0x0041688cf93ac811,0x00aeeafb64b994dc,0x0024454a653176ff)},
+  {FIELD_LITERAL(0x005c4ee607871eb7,0x00ecdc9963259be2,0x00454d5df525f1c8,0x000445027269ce84,0x0000380605c50a44,0x002b08602d94c271,0x00b17741d712107e,0x00655ccbe939a512)},
+  {FIELD_LITERAL(0x00732b1f632a66bd,0x00095551f51c4fdd,0x0013c4a3ff0d84f7,0x00cb39e019e6ab00,0x0007e028d50e353d,0x00137d931bed8523,0x00c88098a0d1eac4,0x003d80c40a5e3aaa)},
+  {FIELD_LITERAL(0x008bc95eb84a7783,0x00f7f46c87c1799c,0x00106f4d4ca08e46,0x00817644acd1e69e,0x00d1f791490c9d13,0x00563569b20c1dd2,0x00ed734d8b2e8d96,0x005665d2b59081ca)},
+  {FIELD_LITERAL(0x000a4ea98d69c0e3,0x00e94a486bd436fb,0x000f03ac2e7e68e9,0x001e6bb6b7f2c6b9,0x00b3dc1b432f0d0e,0x0061a00270f7d0bf,0x001eef60a46f6add,0x0059972a6fbe7045)},
+  {FIELD_LITERAL(0x00d47e3dfa08980d,0x00daedc2b3371a12,0x002b10fc0289df19,0x00849f3a6397f41d,0x00d4dea1feef9f56,0x00ea283d35305391,0x002d85af4fb121f7,0x008af6602a08e230)},
+  {FIELD_LITERAL(0x00d6abe5147c27fc,0x0016539dc6f9d47c,0x006a1f048b8c4de8,0x001b784bb4759b4e,0x00459ad33a147ffe,0x00ad3338d344b0d8,0x009a5ae24da065af,0x00c40772e389a7bb)},
+  {FIELD_LITERAL(0x0027f8e18fbc0ede,0x005e60e350f44abe,0x00d087b556d58a33,0x00dab6b6a64f2d3a,0x00284a304115b0cf,0x009d50c3c0e08060,0x00e5b20b08ef8ef9,0x00c92a4e72a43f35)},
+  {FIELD_LITERAL(0x0046eacfbe75e7c5,0x00519615deab19ce,0x003983bc3b3746e2,0x00f78498b9d6d8ba,0x0040f00fa4cd47ae,0x00c52ae8d838e070,0x0047987e94135150,0x00716c580ee7b69e)},
+  {FIELD_LITERAL(0x0019f6afa9ab06aa,0x00d3f3cb7105147f,0x00cc0f1a90344702,0x005a0a09725ea7b9,0x002aac19525b7ab4,0x00210b3f88f54db3,0x00077437c1e7456b,0x001042dae2ab4b5d)},
+  {FIELD_LITERAL(0x00f8d6551a584758,0x00b4b0f31db2b924,0x0035a04f6aad608b,0x000aae0e4e20c8cd,0x00cb975a2377c544,0x009647e5200e869a,0x008a8aa5f1d90d1b,0x00ec3ed1ecb17361)},
+  {FIELD_LITERAL(0x00ac64f13f138b16,0x00c4a613e8e7d424,0x00efd959c8aaaa06,0x00d3e34bf8022c95,0x00cba20adb9e908d,0x0036c7d56af7db19,0x00289e56ce23ccbe,0x0095fd864a2fd927)},
+  {FIELD_LITERAL(0x005bdf4385561592,0x00ff6b3266bbdaf5,0x006e9b8f8611b5eb,0x005ec95212047585,0x005b075257f5c198,0x0064143dd1846c1e,0x00458316590e2557,0x00a12186cf4aaf8d)},
+  {FIELD_LITERAL(0x000766f371186363,0x0025f819f24dd710,0x002d943707999c75,0x00a0e7b6b1c37fa2,0x0034a951bfe480a7,0x00ba4a982266b057,0x00fa852da57e97b6,0x00d6c2fc7ca21c87)},
+  {FIELD_LITERAL(0x007d4fbd68a22900,0x00d3b58f75a93153,0x00327f2d475d9600,0x00afa719750d9374,0x0037025d4b127c26,0x001ce32af5847375,0x002df5fd324f1a40,0x00659b9c594422ff)},
+  {FIELD_LITERAL(0x00fc06447aa672a8,0x004fdd061aa5d573,0x0002607f643d5283,0x0081f61f7385bae2,0x00dd28c8cc3b85db,0x008315d0fdb1f516,0x008065ac741db014,0x00621bff59c0bd4f)},
+  {FIELD_LITERAL(0x00037a18ff6d4815,0x0056e16431d5a61e,0x00159e1bb0e7c2d2,0x00ceacc829f29fc2,0x00e5a7b6851b5114,0x0028836384f66075,0x00fdd1a2c83c93fe,0x00d89285784db9ca)},
+  {FIELD_LITERAL(0x0064d41ebb3eebaf,0x00473491cc37c819,0x00b6b61626345d7b,0x001a8202b37a3790,0x0096a1bbe33aea00,0x00d4bb7b93a974dc,0x003057b1acd7e55a,0x0074bfa6b3837755)},
+  {FIELD_LITERAL(0x00f4d623760fc21a,0x00ccbcb94477b749,0x0090948b74c67569,0x0098edc343c15191,0x0088bc71e9f97402,0x0040dc4b367f7692,0x006e532439747a9b,0x008675b9c4d8601d)},
+  {FIELD_LITERAL(0x00a99fc2702e3cbf,0x000cdd4ea1abbbd0,0x0039dd1f6ec8807a,0x004fccde36d625ba,0x002c00d50a1ab661,0x001a58c771b906b8,0x003a58d8bc1ee7ec,0x001cb3b83d1d3afe)},
+  {FIELD_LITERAL(0x0080689a7a7af6df,0x0023f703b961ec26,0x0092ec1290f763a9,0x0093f5eeac6663d8,0x008b67df16d150ea,0x00e338dac65f8378,0x00cb4d02a5399332,0x000b32ac52011866)},
+  {FIELD_LITERAL(0x003e4fe889a6c8f0,0x002486114467fcc5,0x008bc09141018ce8,0x002eddfccb5151ac,0x0064533f4725723a,0x001de20f48cdfa99,0x00f04ca997240cef,0x0063c57607519c88)},
+  {FIELD_LITERAL(0x00f60e12adf6040c,0x00b36cb184c72847,0x00df6d8b890c3c9c,0x00afe158c4c668c1,0x002a4b9b2eb150df,0x00bda387c99630a7,0x002070cd953d67c1,0x003411500b3b20b7)},
+  {FIELD_LITERAL(0x00d9e9da075534ea,0x00a8df1a0c0d64fe,0x0079999ce6afdf5d,0x001d267227508222,0x0087d7f5a2195206,0x00013bd8623bdb81,0x00161770e850445d,0x00e909bf592e27e8)},
+  {FIELD_LITERAL(0x001a401cae18a39f,0x0031674387ef870e,0x008cac9360a1f176,0x0090ab2a5a010a36,0x009f191751d9e926,0x00f914b4e33682c8,0x002123c0e6869b11,0x009c2518360a7228)},
+  {FIELD_LITERAL(0x0017bed74f952bfb,0x00af8688d094df71,0x004d05eb80df783f,0x0051488ab6f9bceb,0x00653e04d9030fbd,0x00f7ecdbe864ecee,0x00948d66506a8bdb,0x00a31a0c3c95a3ce)},
+  {FIELD_LITERAL(0x004325a1e71edb4c,0x006b0e65086b0d39,0x00d6807f539b5d11,0x000fe10afe2fe18c,0x00ca512637538c68,0x00fdd644e6279612,0x00ce2ef0c69543e1,0x00cb3d2eb9fe6816)},
+  {FIELD_LITERAL(0x00568d09b9f22a6b,0x00e00a8e18d5e1a5,0x00cddcf90108fa8a,0x0003742222d3e229,0x00c62aae6d10937b,0x00c40b17c935458e,0x00155f9096050332,0x007675e2a6e10754)},
+  {FIELD_LITERAL(0x00b699c07f426656,0x004b0a8084fa04c6,0x00f28837aec5a5d2,0x00713d34765ea025,0x00de649575970a80,0x0019f1f107ef21bb,0x007e164282446b30,0x0049345c8271a885)},
+  {FIELD_LITERAL(0x0073a354264de9e9,0x00193c84964c68f5,0x00c53fc234ff743d,0x00b3c96c3dcb53e2,0x002cf74c90b4f1d4,0x00602ddcc3422081,0x000fa04b1ccc6861,0x000b1efca5908940)},
+  {FIELD_LITERAL(0x005333c4725c15af,0x008ff3216fa735f6,0x00a0006cb9319b28,0x00ade7b084481272,0x00a65487b67024c4,0x00a4408dcd861601,0x00d7034c679c027c,0x00b515108f96aab0)},
+  {FIELD_LITERAL(0x001b1f3ba8c94ddb,0x008ef8468ed210b5,0x00996f0ad7b0c9fe,0x00579819662dbafb,0x00f7c8d41daed60b,0x0006e06628afa4fa,0x0012cc153702b9c2,0x00a95903ad0fbe76)},
+  {FIELD_LITERAL(0x0093dc0cda7ff166,0x00a5afed59f9663f,0x00eb6c15e8efee26,0x00254ba619186d76,0x00983e49bd636ccb,0x002c5a134ae58df8,0x0014ea91c430b790,0x00c5e9ca28ab0e91)},
+  {FIELD_LITERAL(0x00f5b1d99d59aae1,0x00ff6948770b9720,0x00e718e9daa2a4ec,0x00ffeb43370eb9ce,0x003da15c2af28f49,0x000d1ec8900395fa,0x00e556c861203ad9,0x000463e67016341e)},
+  {FIELD_LITERAL(0x00cb85694d089fc3,0x0083bb9368861bcf,0x000cf3502ecd4275,0x002bcddda43a2628,0x000236479229032a,0x00e9c8a63843075c,0x0003db99715466ed,0x0068cf9526159cd2)},
+  {FIELD_LITERAL(0x00031e2c6698d433,0x00fc6b7ada3383df,0x00229d1e166ff7d6,0x00e329a83ec41302,0x00a4ea7a56c0db18,0x00095798bbf27657,0x00a6d3f05d306882,0x00e769ce4e51d279)},
+  {FIELD_LITERAL(0x00a09a51c956986f,0x00287b2e66077010,0x0000358a62d07632,0x006b10ecc7db309f,0x004679a9c8284487,0x00c582288840a456,0x00c6a7e16bf78569,0x0030a852f4e9d139)},
+  {FIELD_LITERAL(0x000c635747485463,0x00c4056e0fdd0f69,0x004ed02af667c9ce,0x00272805b0d1520d,0x00e02e0437dfb0e4,0x00cfd18963ceddab,0x00624fa2480e9d6b,0x008dcaff54779dba)},
+  {FIELD_LITERAL(0x006d59954c433cd6,0x00302dec1a134957,0x008131e3d9cd5573,0x003646644f8d6769,0x0086a28be5f65ee5,0x007588860bd65db9,0x006684abd0cd1248,0x0004628660586996)},
+  {FIELD_LITERAL(0x009c6716f0850ee4,0x003d9fa6e87030ed,0x00e985d9bc6b9dc4,0x00f15f6b0ee1c3fd,0x00017c3e5d12e4c6,0x00612d6f9d9fdf6a,0x00c411c75569ffc1,0x00c2d6c46f82dc20)},
+  {FIELD_LITERAL(0x0061068b3581aba6,0x00fe9189cdf90003,0x00d5ed0e681cf004,0x00151ff68bd5ea3b,0x00c11698cad6aa9f,0x001b5859410fa611,0x002ef3493e9e2af9,0x00e71c74254749b8)},
+  {FIELD_LITERAL(0x009dd23da3e3ab5e,0x001aefbaf2529935,0x00eefcb4703bb6cd,0x0079d39953a79d4e,0x004fde6ff67c1f0a,0x007276b4ec4c99b1,0x002124e6bcdf01b2,0x00611c400fa01e19)},
+  {FIELD_LITERAL(0x00d023f8e4da8ec7,0x00ecbb1f40e635ef,0x00a9f46dbc56f3ee,0x00640ac1f825f79e,0x006669cb2ef95f66,0x00b47d23968d2a78,0x00ce71866a0fb89c,0x008fee90ac64bed5)},
+  {FIELD_LITERAL(0x00a29f6b2359a2da,0x00b2ac5a3e5f3f18,0x00b3a66db3533f07,0x0028c94ec1e69157,0x00540ebc7ab9f09e,0x009f88cf4951a9b7,0x000f72a4b987ca47,0x0078e5752e9ab12a)},
+  {FIELD_LITERAL(0x008149df0d6f178e,0x00ff5b76b50d6983,0x005cc60f47e5f1cf,0x0085957c5ce5c00b,0x00643a3b80c01474,0x00dbd52e80ea7b7c,0x00e0ceb72639723b,0x0045994932da789b)},
+  {FIELD_LITERAL(0x0009b7c035c9f361,0x0005234d09f7942e,0x003d7797e0b11c5d,0x0056dff81c3bb430,0x00e190657c94bd35,0x0047ab208fde0fae,0x006035e872e1f474,0x0016eb83f161e165)},
+  {FIELD_LITERAL(0x00dbffadfbb07717,0x0068d482af386f53,0x009c87494dabf009,0x00a7fc31c7d6071b,0x0086f8cea871a141,0x00544eb9f48420d5,0x000a8204e17b319f,0x005f73bd6f3bead8)},
+  {FIELD_LITERAL(0x00895ad60baa7959,0x005356314cb5a5a9,0x0015c86c1d547150,0x00009ac276829cb2,0x0012365c8eeba1d1,0x00b477db550ab24e,0x00c895225100d72c,0x007195657296a0f2)},
+  {FIELD_LITERAL(0x00572f9be18c5625,0x00fd878af5029ac8,0x000efe7b99ed6e7d,0x0057a75e5a5ffc13,0x00372b415a6dcfb7,0x00b7837f6fb6681b,0x00f004ac7109872e,0x00e8b76abd7169e4)},
+  {FIELD_LITERAL(0x0005cde3da41f6c0,0x0073976e2a61eed9,0x00c66fa0ed917559,0x00f0702f66f2b917,0x00663a3afee43b60,0x003311dc62e096c1,0x00c4ce38dcf87c00,0x009f42239d0efd38)},
+  {FIELD_LITERAL(0x007fa90dfefdc27e,0x00dabe701288a79e,0x00e54b83242b9b92,0x00ea64bd5a411971,0x0099da7e287d5d92,0x005b76d077db9c21,0x00fbff138a1b84de,0x0010451b90791c04)},
+  {FIELD_LITERAL(0x009f490560071811,0x00d121eeed6815fa,0x003c26806894d24b,0x0052214f8e4f1680,0x00cadb905968a815,0x00f986ecc79552b6,0x0077373bd44f5a0b,0x00c6aeb53d3b5ab9)},
+  {FIELD_LITERAL(0x0034770414fe3fab,0x00d53cfd361e841d,0x002c949cf1c70ea1,0x0010c58407f5ecb6,0x007fd3ecba9b285f,0x00ff7ec3e10a4fe6,0x00628c0f15484db4,0x0069888c725464d9)},
+  {FIELD_LITERAL(0x00b9c37cc33dd7da,0x00a2dc91059b20f1,0x0020f304354553f7,0x0051909b1edac8c9,0x0074aec4d0bf927e,0x0094e514e0d35018,0x002bab18f1d8eb35,0x00b9bdbe87fc1d0c)},
+  {FIELD_LITERAL(0x0001a4f786d79e4e,0x00bc9a0d100aff75,0x0027a5957d9668b6,0x006bda303fd2f1c4,0x00a3a831680b169c,0x003d8d8ce35322ef,0x008e7794e0050c5e,0x0079b95fee2982ba)},
+  {FIELD_LITERAL(0x00250bce01f405ea,0x004eddb1c2751be9,0x009bb7754924a659,0x00a8976028ed7958,0x00def8d54f629f06,0x00982ea3f2b7c7da,0x001e5bb0314f5875,0x00da45996c1cdcb7)},
+  {FIELD_LITERAL(0x007c5b4ef7b86e9a,0x0054bf46c4da0cf6,0x00f3723c94f63a70,0x0006a81bef6bdab4,0x008f2ebbdd144bc2,0x00db5a7a8538db1b,0x005516527b729b80,0x0062c014b1eb1c29)},
+  {FIELD_LITERAL(0x00a9d835541fed60,0x0005dbe44d1abe58,0x004887f92c74e674,0x00ecbeee5ca06733,0x003e61c422075a0e,0x00e237ac6d11aef7,0x007ff7ad810fd62f,0x00f553b08aeb9261)},
+  {FIELD_LITERAL(0x0048a6ef0f597158,0x00d2bd08f42bf48e,0x0092e8543aa411de,0x00725ea7f497cbc1,0x00679bd1ea42b57c,0x003839564b6f8459,0x0075b7bb846062d0,0x002f506fd9eb4d7e)},
+  {FIELD_LITERAL(0x00b3111798fd854c,0x000e54d8bd080776,0x0005a6a239ecdbd6,0x007d89903d490d86,0x0061fac971bc23cb,0x00388f1334f71c5d,0x001a1069bce98c7f,0x00523181cdb9d211)},
+  {FIELD_LITERAL(0x00f8cc23799bebda,0x00cfe313d601c370,0x0012bda860bea571,0x002f8aeaad211d51,0x00d67259ce0ac53d,0x006b2c74a328248f,0x001be3bf6ee7dfde,0x00f0946f3cfb7b8d)},
+  {FIELD_LITERAL(0x00662051261c069d,0x007a58f6e85b360f,0x00a27489e812dbae,0x002f9cfb72efb6be,0x00ba360587190a87,0x008636e93549bacf,0x008a067de56a03b7,0x00feb0ef6d6f3421)},
+  {FIELD_LITERAL(0x00b5f54007aaee08,0x000ccef57e4be275,0x0089cf8aa67af3a7,0x00502762f91090e4,0x0024acc48fbc2237,0x00bd5b96a03bffb8,0x000375dba1e00b9a,0x0068222e9c471040)},
+  {FIELD_LITERAL(0x0058c951bca098ea,0x00c8fbfb21be48b9,0x00be1fec2fd486ce,0x00d25a1768937aa3,0x0039bfef358d0261,0x00501bb1e6d46166,0x0072045214d40ecd,0x00f84a70c9729d72)},
+  {FIELD_LITERAL(0x001784a954018b4e,0x008f345fab0e7e0d,0x0092620d39beafe4,0x0004d54bd9dfac53,0x006550d489a14b90,0x003063c8a3a039a6,0x0040d695fa78cb62,0x0088521b6badcd72)},
+  {FIELD_LITERAL(0x0061a426dfdf5030,0x004610d4954516ec,0x00f0bc965685c5fd,0x0049009791061d97,0x001ebd73a3720de6,0x007346c0c41ad203,0x009a2e25dcb166e0,0x00d82d931131c4b1)},
+  {FIELD_LITERAL(0x008ceee4dbe835e6,0x00b41a1e8399fa2e,0x001abd3fd2161be0,0x001ceab8c09c4da0,0x004f1cb3044e3cd8,0x005c49cda7ea8b11,0x00ad17eda963323e,0x005c0d464a14a122)},
+  {FIELD_LITERAL(0x00ca5ee97ad9a13c,0x006687cb41b89433,0x00fa3e02753ac27e,0x00cd9b8524f49e9e,0x007d46244d4deab8,0x0009317786c2def8,0x006c80ad3bf3c276,0x00c3c251ea498bf7)},
+  {FIELD_LITERAL(0x0015b303cd4972c9,0x007c63d6e82811d1,0x00751ab283b1b345,0x0091fe8ee3c2e4a7,0x00d1e6ef4fb692eb,0x00e00a353fcf5912,0x007fb608d663a69d,0x00cb273aa5c2ff4a)},
+  {FIELD_LITERAL(0x004e41d7e24bb319,0x007c34275f64415e,0x00f09fd40b483336,0x002c85f48e820e1f,0x005cadfa21896fe2,0x003b5468e88dd45f,0x002de46af0d2be2c,0x00f05ca41e0ef6d0)},
+  {FIELD_LITERAL(0x0085c0b2249bc741,0x004b2c8059cb3389,0x00532425e802bd7d,0x006784f4782d4344,0x001deebb296f9922,0x00ff30f747e9aaaf,0x001d85b5d314438d,0x00a35844af618b26)},
+  {FIELD_LITERAL(0x00dd36c15ccfee96,0x0025472dc945ee15,0x0013b831c71c2395,0x00e07fc6bc9e6f2f,0x003378a5b4a36469,0x00e4aa6515d303d6,0x00814e2f1e876395,0x007bf5a563635736)},
+  {FIELD_LITERAL(0x00357592036e6416,0x008ee392e62ad0cd,0x00a890280e64ce03,0x003aad18b2736599,0x00983b0ea0480534,0x00aaf2f05d066a78,0x006be1833d666be3,0x00f5257801c9045d)},
+  {FIELD_LITERAL(0x007edfe4da4591f9,0x00ec6e53314cff39,0x001eba4973dc5246,0x003214446a1978cd,0x009e6534fb6661b4,0x0015a4537f61817f,0x0010ed8862c67307,0x0062eeb0f13e6726)},
+  {FIELD_LITERAL(0x00f61281bc2bccd7,0x009840053c8b49df,0x00c3cf3806398326,0x00cafac346fcfa14,0x00af5a7648b6bd12,0x004be14f7e3a49a7,0x0069764b7fe3998d,0x00d5425d63e3ce3f)},
+  {FIELD_LITERAL(0x00fb14a6a236c6f4,0x00af6af8601eee86,0x00074db79e63e695,0x004ab3620234e444,0x00089210ecb5e85b,0x0051c98e7ab59dfd,0x0093bfa97255f90d,0x000de58fac85995d)},
+  {FIELD_LITERAL(0x0086adf38444f2ae,0x0033e49de49a1db6,0x002509d7071f960f,0x00fdf73e8ecb2e31,0x007788c326286ed1,0x003bb81d82da7433,0x00db58c53e92a9f8,0x001b47d5743eb0af)},
+  {FIELD_LITERAL(0x008747ba1e629515,0x00095f53a1c9128d,0x00aca066ab402ad3,0x00c07df42a737029,0x00c027b15cc14d97,0x00251652e442e6fe,0x003b800c6e39117b,0x006ca343f0a29eb0)},
+  {FIELD_LITERAL(0x00b36f947bb6d02c,0x00606e7fafa3798e,0x004204efb9d4036c,0x00000a98f00a3959,0x00f1679d868c328e,0x00df5a734e8ee25d,0x00545d7e4537606d,0x002d335ff0d20a0a)},
+  {FIELD_LITERAL(0x0050835a3b81acfd,0x00ccf553da8aa3d9,0x00c30c94ab746e02,0x00f74cba23db5e52,0x00ad72e97a62549d,0x0095e09674933871,0x002d14cf6fb34218,0x009b977f273e4380)},
+  {FIELD_LITERAL(0x009b10921883b64d,0x003166b752cf3e7a,0x00c057fad6f89e68,0x007d218a24065a72,0x006d47c4b69b4a05,0x003ff4e760f9d3d4,0x0059a2e650d14cf1,0x003bac8b70963cc8)},
+  {FIELD_LITERAL(0x0026287f244b2e89,0x00ae45549af5e8fa,0x00f831bf60bb782c,0x006e70c455732a9f,0x0061acb54535f0fc,0x00104aae688c03d7,0x005e270b5dc2c121,0x0032e0da68f00f55)},
+  {FIELD_LITERAL(0x00b4aa12e4de5302,0x0099313573079d07,0x0002655f8728a857,0x00c3a10a522bd84b,0x006d9cb13b590490,0x00d7466ba21fd600,0x00583f84dce4b2b3,0x002050fab176e0b9)},
+  {FIELD_LITERAL(0x004683dd6e015d9b,0x004d0823bc74839f,0x00a01c3cd4920759,0x00ae59d13d45c918,0x00b5f234025e93e3,0x009891d44914bcfe,0x00e15d7301c1a223,0x003ee4ec52730e56)},
+  {FIELD_LITERAL(0x002c42a617bfb988,0x00d5927ae19fb0ae,0x00e9a17dcc1d47c0,0x00f34d6691bf990d,0x0051f4035c68c9d9,0x005ad2c9dafca34f,0x009548bccc693c6f,0x0030ff5ccafef68a)},
+  {FIELD_LITERAL(0x0035b216eac556ad,0x008131ffce45030a,0x0055880e1e91c691,0x003cd6d74bfa2d9e,0x00894bed862d2f84,0x00d199188f2d1394,0x0066d921dce4f9fd,0x00c4e9f9b5a17927)},
+  {FIELD_LITERAL(0x003a5716941dbced,0x0098f1da07ae831c,0x00d8d9d9103d2704,0x0036c4baceb612db,0x00cf7b770e6cfb5e,0x009690b06494b3f5,0x00bf4ce48dcdfdab,0x0018f322cc104396)},
+  {FIELD_LITERAL(0x00533e87feb83ed7,0x0070223c6a37017e,0x00217c85c3066d92,0x0038cb61df18da75,0x0041b68d44298881,0x00df5423ef4d0cf7,0x0075899b6868f972,0x00253a1db676e164)},
+  {FIELD_LITERAL(0x004ce2f7d1c58fab,0x00a1058c95639483,0x00bfa171609ea627,0x0076feec3569e78d,0x00256ba5ee81d31e,0x00b63e200dcdf6aa,0x00a66d4a3d1b5399,0x00ac4d1661a6dbb9)},
+  {FIELD_LITERAL(0x000e739b16f7b032,0x00557da6d65bca3f,0x005d9461d09c76cf,0x00c5fefaf24655a1,0x00304a081880f114,0x00d7d0483715c455,0x004a7df8201e8c4e,0x0052640493e6f8e5)},
+  {FIELD_LITERAL(0x00384805fe525bce,0x00089f02908c001c,0x009e35e0ac9c610e,0x008726fa44478a6f,0x009f3a55c034ce7c,0x0020f70a06b59094,0x002110cee5a9582e,0x000af228e0fc0d91)},
+  {FIELD_LITERAL(0x009685fa3684c587,0x0048c1fbae3c9b70,0x00e2cfd0368bf9b4,0x00f0d5800f100b0c,0x009f1f673aad7f05,0x0072b68cdf40be14,0x0043216b7232feab,0x00c6e0cc7efb9a00)},
+  {FIELD_LITERAL(0x00e6421c2f0b38e0,0x009ff3b15209c664,0x007c672b712c5d9c,0x006ab1346445ab87,0x004f0f5d8728ed4e,0x00080b9080e8c54a,0x0078fa4c9d21ccf4,0x0020a853653e17c9)},
+  {FIELD_LITERAL(0x0086ac148816a0a5,0x00150d2bd8167c63,0x003c087bc58d7152,0x00cd7196454d7df4,0x00b89e49659fcfe8,0x008788a49a6152b4,0x00c59528e3007d4b,0x005d18905b8667af)},
+  {FIELD_LITERAL(0x0006aed6dcb92fcf,0x00cc5ebeef79f873,0x009f29b65d8e08bd,0x0098c66f6eefcdd5,0x00a14211ddb84b60,0x00168ebf512fe5c8,0x008f7a27acf9a862,0x0082a860ec0b7c5a)},
+  {FIELD_LITERAL(0x00d5a03b7edce1a0,0x00316f1e66114dbe,0x008b830f68066cae,0x00d1ffcf0ecd3473,0x004207f6b7158e51,0x007ff2ff7a114e30,0x0053b5a0a2ffb019,0x009b56fc3bb8f01a)},
+  {FIELD_LITERAL(0x00545accba2c36e1,0x008bcbd2882a0d73,0x00dcd8004ad2ceda,0x00ec9a79a2db91e4,0x0074cba9f190e931,0x00db42467e75376b,0x00b810f6f8fb9335,0x008648439d64681a)},
+  {FIELD_LITERAL(0x0080a3889c19a125,0x000710d58e71068c,0x00e97d3ac621fbed,0x00a0f3d3af2789ea,0x0033e33f3df20488,0x0027997987fff024,0x00126851536ef18a,0x00399d389d920a4e)},
+  {FIELD_LITERAL(0x007125a136d129d8,0x00eeee05633a3421,0x006d921f979a00e0,0x00981a49e45b25ee,0x00d3076d8286817f,0x005e9c8f0e2fe320,0x00cdc63e22a758ba,0x005671bc8356b784)},
+  {FIELD_LITERAL(0x00fa611b264d95f8,0x00b9bb94ec5c16d1,0x00d0d46d980589fc,0x00bc37faa582fb35,0x00f0833069ad8716,0x00b8f63578b32312,0x00c4756888591cc8,0x00422a804c1e5ce6)},
+  {FIELD_LITERAL(0x0083b78cbc23ec67,0x0038230370a59692,0x002583a14786765b,0x00cda43f3737d5e9,0x009243ea57e1148f,0x0056e164236e223e,0x00b9b35b49a066c0,0x00ded6b6d0a966c2)},
+  {FIELD_LITERAL(0x008a5feb0b9ed401,0x003e43470a6e6caf,0x0016b759a55b796b,0x00089ee6e5c22e84,0x0037d274f0055738,0x007052b3ca0d2dbd,0x00db5f01915d2739,0x0035f4a29cc2d6ac)},
+  {FIELD_LITERAL(0x00c251e8e577f30e,0x003dc307616d8ddc,0x00ee7d60026695c9,0x00da44756dac33e7,0x00c280f672a96798,0x0008a69fdcab3d9b,0x006a461f479c4d66,0x005da474f99afd38)},
+  {FIELD_LITERAL(0x0071b8b148f9d304,0x00db42b464afea53,0x00b72a5b46cdde87,0x0098c099a03eff92,0x0090131b3c5f814c,0x00c04e595b9fec70,0x00fcff762dd1fe17,0x001f44ab7ea4fc15)},
+  {FIELD_LITERAL(0x0022f2de59a1f156,0x0054f32b81773b0e,0x008808c21537bd19,0x00fd7713a25f096f,0x009ce6da65820b04,0x000f8ffaffa34d1d,0x006b31f4acb4f1c1,0x003af2273786f4de)},
+  {FIELD_LITERAL(0x00a92c393604e673,0x00a97a6dd2b3cb4d,0x00a3a99845566ad4,0x00db885bcf0f9acc,0x00151514b343d957,0x00e25a7fe8034c80,0x0001a317bdfb2d11,0x00d8ffd51cd84ec8)},
+  {FIELD_LITERAL(0x00c252c61c67157c,0x002473dadb5f13bb,0x004d738a4abdb280,0x0010045fb748a65e,0x00a201c5e229218f,0x00171ea88659852f,0x009fc336783d560f,0x0047fd098fae4f68)},
+  {FIELD_LITERAL(0x00a33ac97091359b,0x00282356e972a6b9,0x00b8850007ebaaa4,0x005733c72f5534e1,0x0011786143376586,0x009382894cec6e9e,0x008fe1dcdffd695f,0x00fea06e5c2f9639)},
+  {FIELD_LITERAL(0x0040238f6c109f9e,0x00fae916ee6039fc,0x000b8a7d7c8dc3f0,0x00339efa0aec98aa,0x00beab1c0eb17a5a,0x00b294c6bba4702e,0x00439f4d78566772,0x0048bdfb50d9c1bf)},
+  {FIELD_LITERAL(0x0077bdbf54b0208d,0x00e1c467093e2292,0x00b96cecefa78e9b,0x00e89924d2c90664,0x00202ec34eeeed66,0x007c80e8eb0a4b4f,0x001583ac4e20de11,0x00de69f7a15a3215)},
+  {FIELD_LITERAL(0x0075e933fa2026d0,0x002c81613d34f87f,0x00839760035063e4,0x0023096d7b7f1804,0x009aed5685aae480,0x00f79fd96fc4c53b,0x00cc14a57186d2dc,0x007ddd4a3a43bc36)},
+  {FIELD_LITERAL(0x0050b8e7ef393522,0x009e7692eb47a7de,0x0064c7da68b9e245,0x004c9cad19e1eb23,0x00201b4053343175,0x00568389c1b58744,0x000e3936b1adfcc3,0x0071666512e2fe60)},
+  {FIELD_LITERAL(0x00243efc75e62cfc,0x00121a8550e02772,0x0060222fb647b9f1,0x005fdd2796a2a91a,0x00bb08877bd5263d,0x004297d33e8abae2,0x00a1ba7fa6df30f6,0x00955d5a928fc9bd)},
+  {FIELD_LITERAL(0x004a493265b3b271,0x00cedc6e9abc3f6e,0x005f672991e6c979,0x00457875775af4c2,0x00baa5ee62629e5f,0x00b68db08bbf4070,0x006e5ca9c502f519,0x00eb932cd52cfe91)},
+  {FIELD_LITERAL(0x00d72d4521796b14,0x001fc592f97eefbf,0x00a4c72fabca1c4e,0x00b1b7fd98455bcb,0x005a8ddcf8334720,0x008d8a2dc80d6bf3,0x00a1820fe5c3b7b8,0x0044f360d6ccf19e)},
+  {FIELD_LITERAL(0x00d7f408a0e83320,0x00981bb5062354a9,0x00cda84d94b72c9e,0x009f684f63421afa,0x0051bc23ee39990f,0x009a6b79061868e3,0x009138d4be465be0,0x00be4e2af30acd84)},
+  {FIELD_LITERAL(0x00c11d73ab7b8b00,0x00d9c6bffa5a8059,0x00b02ba1a4b0da44,0x0005beb199d042fe,0x0010310cbec90f73,0x007df118061c6a5b,0x00dc684a4e36e6a7,0x007b5b2b04488f95)},
+  {FIELD_LITERAL(0x0077b8dacd41ccb1,0x0083a64c5dfe505a,0x00fde54ca3d7df7d,0x003aa1e22fa12343,0x00201e4338df279b,0x00b2c2c3f0cbdab4,0x005f72daedee8a3b,0x0075bf8c205153fe)},
+  {FIELD_LITERAL(0x0012c1ff8f0b2a9d,0x00066dc806b1adf2,0x00e2658db9f00d02,0x000a141b08709c5b,0x00d686e5528a87e4,0x00f3a0333f23731b,0x00621f34ca3a8070,0x006fd87012bca353)},
+  {FIELD_LITERAL(0x009403473c2b72bc,0x00f5ab2227abb496,0x00256e38ea8b370f,0x008cd6a42b8f04b7,0x00962f26d0c91c1f,0x000a2c264d98c763,0x00076837adf4dc1c,0x0018d33c17050dc3)},
+  {FIELD_LITERAL(0x0099a619e1ce68e2,0x00468ad9535507bc,0x00a9567835e5cf5e,0x00907d656deaeeaf,0x00d77f6d55262361,0x000dcfe626e4ab22,0x0010973e28b5a6aa,0x00911e60c85f6f4d)},
+  {FIELD_LITERAL(0x004a4acfc1f97877,0x0098d82e2a7b7d5c,0x000b37bce062aa25,0x003912542654b194,0x00542ca0b34d3d94,0x00d88679b80e0ce5,0x002b3ed4602ab1dd,0x00ec1581a1d2a3c5)},
+  {FIELD_LITERAL(0x0090712b45dac7a0,0x00f5d7627cc11236,0x00f51bccba5dc50a,0x00c375bdc9957063,0x0004f420a4a00849,0x006860c3afab2f15,0x00c809cf28d9f1de,0x00d246d9ad778cdd)},
+  {FIELD_LITERAL(0x0083e6acfc1708ed,0x00121a4ee5d99c21,0x00e0a337de8a52d2,0x000f27df629fac31,0x004b81e6066b09dc,0x0028cffceaedd100,0x00cbf7250219b37d,0x005285fb5d9e0d33)},
+  {FIELD_LITERAL(0x00c2ff08a31c710d,0x0054b38d97dfb25d,0x00de4f8e38f9589d,0x0038f559a3a7eca8,0x002acc37cbb0823e,0x00d16cbdc5085c6d,0x0098d362e61f7a6b,0x00140d9f01c30f84)},
+  {FIELD_LITERAL(0x003a4b9170d3eaa6,0x0013770395279592,0x00b74edfceb08de0,0x00c08a03c5a609b3,0x00b7a77b89fc665e,0x003515a4436d5768,0x00758c3fa184c7d0,0x001b45b5e0d3bd86)},
+  {FIELD_LITERAL(0x009f14355100dea8,0x006dd03991fd1dcf,0x002f19313db707cb,0x00d0502a10ca6013,0x00b5fa40727ad74d,0x00299b4e1555b981,0x00e027a1d1626c6d,0x0038ab7dc4d44daa)},
+  {FIELD_LITERAL(0x005c47cda00e8877,0x007d0c8415dbfab8,0x00bebf5bf774dbf8,0x00a75d2a22a791e1,0x0027ef18f5775be4,0x006fb37699b3679a,0x00c2ebeb3946665f,0x00b2f63f5a3f54d8)},
+  {FIELD_LITERAL(0x00c0a78dafb3327c,0x0047fbacce940c3f,0x00e93b4ac4751939,0x008b76c7b5a9cdfd,0x00b46b3fb35da531,0x000580778567140c,0x00fd9696185b8cc1,0x00dd08b8c4e6b38d)},
+  {FIELD_LITERAL(0x006a4e23cf278981,0x003010455a840782,0x00ffd28207a7acc1,0x0047699f42df9b31,0x00dcdb81e981dbbd,0x00dd81d6b91963b4,0x008bc499713b4e44,0x00bcae008a29f2e4)},
+  {FIELD_LITERAL(0x00a138c1154dcd21,0x00d5c0218fd80baa,0x0035977e5eb576f2,0x00189b2fadf0244c,0x0087a3e75d464bf3,0x007ce248fc21c441,0x005891b7403398f1,0x002146ec1429bb71)},
+  {FIELD_LITERAL(0x00791360604696fe,0x00ee608b1176868b,0x00b9152a109426bd,0x0090c5bcc52d0dfa,0x00ca15bcbea7e192,0x0001eacbdb74f510,0x00488f629923aed4,0x00aeb789a3ceda06)},
+  {FIELD_LITERAL(0x001e3ede5281da82,0x00aa2e4fcaf32dc8,0x00b5c3ba7d701de5,0x006b3bd2d1ea82da,0x00e8a11bf751ecba,0x00c2d5c4a8e72a4c,0x00db3cff28257f9c,0x008973f7547751dc)},
+  {FIELD_LITERAL(0x00cd01bd9f8c0025,0x003c7c0d538685e9,0x000c19c02a6348ba,0x00f6ecb3f279cace,0x00d72c212ecb62bf,0x00472fe03e879923,0x00515ad320467bd5,0x00e9c05756a02abe)},
+  {FIELD_LITERAL(0x00bde04e14827466,0x00a64477cf37cbad,0x00c133b383502478,0x00ae6ed49ae3b235,0x0082d5189b392830,0x0045a89ca00dc206,0x00a7d31c23b4bd2c,0x00faf43ab55b0809)},
+  {FIELD_LITERAL(0x008cb09487567f20,0x00c67a347920fc24,0x005bf7c529a57751,0x00d9c321514e893b,0x0036981548eef713,0x006220d3028a406c,0x007300dc5d07b011,0x00c4fb4a9db67162)},
+  {FIELD_LITERAL(0x00920263d80df1af,0x009039c2c5f32220,0x00d9836b082b4da6,0x00abdab5eed6b186,0x005da5ebbaa3df49,0x00a56d011f05b4e8,0x0055786a88d6a262,0x001c41501c3412ab)},
+  {FIELD_LITERAL(0x008c421a597a45e9,0x007bbd137784aedd,0x0084d791f89c164a,0x0079bfdc5ba98221,0x008691e3dc0e7a7f,0x00cbf36fed7181d7,0x00c8cedb6f838b45,0x00e1e2281b24fb91)},
+  {FIELD_LITERAL(0x00afeb30a2db6472,0x009627beac706056,0x004e1cc882bff593,0x006f1c39f7202884,0x003ce0b71c4adbb5,0x0072d967ed41aaf0,0x0043e9475d284ed6,0x005400e4b223bd19)},
+  {FIELD_LITERAL(0x0043659eb6429cd7,0x00d7884f638040e0,0x0049ad61c8b9c610,0x00f170b57d686f93,0x00bb8444ee59df1b,0x0012190ec4c53a35,0x00be4fd23986f7b1,0x00cb9efabae6c70a)},
+  {FIELD_LITERAL(0x00b27c57053b39d5,0x00d0c9ab2684d511,0x003c69a8fc0db4d6,0x003225132813dca9,0x00f456f351f738d7,0x00880a34d17c886a,0x000ede23fab46aae,0x00a19334a18ca33d)},
+  {FIELD_LITERAL(0x003305d75422e934,0x007743e7896eab77,0x003167ddd99072b6,0x00a76dc3afcc3ec0,0x008fade22130f3aa,0x00957c8483d0b3be,0x006d89cccf5dd41c,0x005ae02af67924a7)},
+  {FIELD_LITERAL(0x00f84f9a8e6a9ddd,0x0088e189bef28d39,0x00e940d8a0acfa1a,0x008fc9e16c2c4a2f,0x00f8f101f5053c80,0x0058fccd1587ed99,0x001d5edd4a66a517,0x00a7de82479b23fb)},
+  {FIELD_LITERAL(0x00e8b920516f36af,0x00a8d6bfa1794d6a,0x00295a0ea8661d3c,0x00406fb67554bc94,0x0045c76c7bac7092,0x00d839d6f8194c5c,0x001ee6edfe0752a0,0x006f0c203bb47738)},
+  {FIELD_LITERAL(0x0073d002b23ab455,0x00bf05328d5a9d46,0x007631d7142e5174,0x005b599694f0ba0e,0x00aa4bf22de0264e,0x0071be645615f5a9,0x00668eba72be560e,0x00dded6fa13f5f28)},
+  {FIELD_LITERAL(0x003e8998b3d3c46d,0x00e87a9142f0eba7,0x005ca54eea36fd1a,0x001f3c45fc7e3afe,0x001010e0bbeee0ae,0x006e842645d89bdb,0x004144dcbd4a303a,0x00c69b09fac158a6)},
+  {FIELD_LITERAL(0x00218c2d486b5e1b,0x006eeabea6e84081,0x00c62b248b193e7d,0x00a98818de7c1f7e,0x000f85ba19e429fd,0x0052987b4e53d0e7,0x003eec2658ca1652,0x00160e704dcee359)},
+  {FIELD_LITERAL(0x00517611fe966aaf,0x0056cd0801ec02d7,0x004d9390d1eb1eef,0x00a64fdb39dee89c,0x00f08cc33d9dece9,0x008d1f803598ef63,0x00e04823da12bc2c,0x00c304b92f7d7a40)},
+  {FIELD_LITERAL(0x00ab0ccf612ff7f6,0x00d9e28cb1c4951e,0x0096fe1802c03778,0x002c6f19f636c82e,0x003d7e463eafb17c,0x006d3f46ec5b23c3,0x00ba320c8f07f4f1,0x00457889ccd86109)},
+  {FIELD_LITERAL(0x0089e10fe416d2b9,0x00d7f4b0e276410c,0x00b2826b34d83886,0x0044b7fde12a32f8,0x00ff6b36d114beef,0x004295a62030d7b7,0x00797b9b378f69f0,0x0061d86652ef9059)},
+  {FIELD_LITERAL(0x00218a3ff50fc1f9,0x002b470cab81176f,0x004a96053a5bbdac,0x00c8ffeadcbb3083,0x003b6cbf39384ed1,0x009b4e5653c3d56f,0x0029a11666309a9b,0x00a4803ea584e5bd)},
+  {FIELD_LITERAL(0x00c9c2beb9c66dc9,0x00b5eabdd6a56020,0x00acfdf55d2a5c15,0x002c917a0d861c95,0x00512bd3f141bfae,0x00289cd9817bfb5d,0x0038a8157ffd0094,0x00a6a6badc7b97de)},
+  {FIELD_LITERAL(0x0066c3cd64d9fc53,0x00a2f5153a54b31f,0x00303968569de064,0x00dfc758dc42c448,0x00409a945ce9ab27,0x007df99fa6822dd3,0x00049edc7be06fcc,0x0021cc1f91ff1cd3)},
+  {FIELD_LITERAL(0x001abf12ffcefe47,0x00e83b756178b89d,0x00503f3510d8913d,0x00c1dc2f99fad8a4,0x00bf0ee71629c68c,0x004f594d28391036,0x002d03010b81a053,0x0050d0f83699f0fd)},
+  {FIELD_LITERAL(0x0049e540ea75811c,0x00731accb11a746a,0x00a12e98e1649331,0x0011df55a0c4c73f,0x0089b0af295c6b12,0x00f9bd150f2b85ef,0x00c287fb3b8eaa3e,0x0047a5146ef33850)},
+  {FIELD_LITERAL(0x0040308e449eb344,0x0049f4eb1527b962,0x00b412d43c36e10e,0x006c1751e504e415,0x00e619ccf7fec4fc,0x00f8455bec00a638,0x00b381ed68cb4163,0x00884fab461e1e37)},
+  {FIELD_LITERAL(0x0038b2f62ca0bb7d,0x003457511e7ddf9e,0x0085c0076b8e7e88,0x00c73c9f30bd0913,0x00b6f9f0118f9ae6,0x001e93b502187a20,0x0069088c592640b0,0x00619cc6088e46cf)},
+  {FIELD_LITERAL(0x00345e739445ec69,0x00c9f6bd96686959,0x00cfc0917613e00a,0x00caffbd5092eaeb,0x009af11b0aebc3ee,0x00d512b9705ad513,0x00397533c6ad785c,0x006e1f58f3cb013d)},
+  {FIELD_LITERAL(0x009fd396c6d2b52f,0x008947948082dc42,0x0061c4fc580581c3,0x00f11f673b260b55,0x00ac1ac4d128efc8,0x004c68ae3712405d,0x002bffb4bc021824,0x00f129340b3c6e0b)},
+  {FIELD_LITERAL(0x00fd9aa2a649a9a8,0x006a468b4ae66937,0x00190b571b8cccd1,0x0050a53c347d4cc6,0x00486b5c2cb8701f,0x0089afb9f56be849,0x00b5ed3250eddfc4,0x004f19a26d21807a)},
+  {FIELD_LITERAL(0x00c615bf1ac7de34,0x008f3820363a3963,0x00de9c24f8f43097,0x00e9e912f1b232d1,0x008f659575605d3b,0x009c16757ae1cc4e,0x0095c740558b5dbe,0x004bce581851ec44)},
+  {FIELD_LITERAL(0x00f800d0e851c4a1,0x008d7fd200642638,0x003a29c92a47884c,0x00d0c630c6897334,0x00dcd5734c143176,0x00783820f6ab0f16,0x002b068be18785fb,0x00dbe6c967ccfdef)}
+};
+#endif
+
+#elif GOLDILOCKS_WNAF_FIXED_TABLE_BITS == 7
+const gf API_NS(precomputed_wnaf_as_fe)[384]
+CACHE_ALIGNED __attribute__((visibility("hidden"))) = {
+  {FIELD_LITERAL(0x00303cda6feea532,0x00860f1d5a3850e4,0x00226b9fa4728ccd,0x00e822938a0a0c0c,0x00263a61c9ea9216,0x001204029321b828,0x006a468360983c65,0x0002846f0a782143)},
+  {FIELD_LITERAL(0x00303cda6feea532,0x00860f1d5a3850e4,0x00226b9fa4728ccd,0x006822938a0a0c0c,0x00263a61c9ea9215,0x001204029321b828,0x006a468360983c65,0x0082846f0a782143)},
+  {FIELD_LITERAL(0x00ef8e22b275198d,0x00b0eb141a0b0e8b,0x001f6789da3cb38c,0x006d2ff8ed39073e,0x00610bdb69a167f3,0x00571f306c9689b4,0x00f557e6f84b2df8,0x002affd38b2c86db)},
+  {FIELD_LITERAL(0x00cea0fc8d2e88b5,0x00821612d69f1862,0x0074c283b3e67522,0x005a195ba05a876d,0x000cddfe557feea4,0x008046c795bcc5e5,0x00540969f4d6e119,0x00d27f96d6b143d5)},
+  {FIELD_LITERAL(0x000c3b1019d474e8,0x00e19533e4952284,0x00cc9810ba7c920a,0x00f103d2785945ac,0x00bfa5696cc69b34,0x00a8d3d51e9ca839,0x005623cb459586b9,0x00eae7ce1cd52e9e)},
+  {FIELD_LITERAL(0x0005a178751dd7d8,0x002cc3844c69c42f,0x00acbfe5efe10539,0x009c20f43431a65a,0x008435d96374a7b3,0x009ee57566877bd3,0x0044691725ed4757,0x001e87bb2fe2c6b2)},
+  {FIELD_LITERAL(0x000cedc4debf7a04,0x002ffa45000470ac,0x002e9f9678201915,0x0017da1208c4fe72,0x007d558cc7d656cb,0x0037a827287cf289,0x00142472d3441819,0x009c21f166cf8dd1)},
+  {FIELD_LITERAL(0x003ef83af164b2f2,0x000949a5a0525d0d,0x00f4498186cac051,0x00e77ac09ef126d2,0x0073ae0b2c9296e9,0x001c163f6922e3ed,0x0062946159321bea,0x00cfb79b22990b39)},
+  {FIELD_LITERAL(0x00b001431ca9e654,0x002d7e5eabcc9a3a,0x0052e8114c2f6747,0x0079ac4f94487f92,0x00bffd919b5d749c,0x00261f92ad15e620,0x00718397b7a97895,0x00c1443e6ebbc0c4)},
+  {FIELD_LITERAL(0x00eacd90c1e0a049,0x008977935b149fbe,0x0004cb9ba11c93dc,0x009fbd5b3470844d,0x004bc18c9bfc22cf,0x0057679a991839f3,0x00ef15b76fb4092e,0x0074a5173a225041)},
+  {FIELD_LITERAL(0x003f5f9d7ec4777b,0x00ab2e733c919c94,0x001bb6c035245ae5,0x00a325a49a883630,0x0033e9a9ea3cea2f,0x00e442a1eaa0e844,0x00b2116d5b0e71b8,0x00c16abed6d64047)},
+  {FIELD_LITERAL(0x00c560b5ed051165,0x001945adc5d65094,0x00e221865710f910,0x00cc12bc9e9b8ceb,0x004faa9518914e35,0x0017476d89d42f6d,0x00b8f637c8fa1c8b,0x0088c7d2790864b8)},
+  {FIELD_LITERAL(0x00ef7eafc1c69be6,0x0085d3855778fbea,0x002c8d5b450cb6f5,0x004e77de5e1e7fec,0x0047c057893abded,0x001b430b85d51e16,0x00965c7b45640c3c,0x00487b2bb1162b97)},
+  {FIELD_LITERAL(0x0099c73a311beec2,0x00a3eff38d8912ad,0x002efa9d1d7e8972,0x00f717ae1e14d126,0x002833f795850c8b,0x0066c12ad71486bd,0x00ae9889da4820eb,0x00d6044309555c08)},
+  {FIELD_LITERAL(0x004b1c5283d15e41,0x00669d8ea308ff75,0x0004390233f762a1,0x00e1d67b83cb6cec,0x003eebaa964c78b1,0x006b0aff965eb664,0x00b313d4470bdc37,0x008814ffcb3cb9d8)},
+  {FIELD_LITERAL(0x009724b8ce68db70,0x007678b5ed006f3d,0x00bdf4b89c0abd73,0x00299748e04c7c6d,0x00ddd86492c3c977,0x00c5a7febfa30a99,0x00ed84715b4b02bb,0x00319568adf70486)},
+  {FIELD_LITERAL(0x0070ff2d864de5bb,0x005a37eeb637ee95,0x0033741c258de160,0x00e6ca5cb1988f46,0x001ceabd92a24661,0x0030957bd500fe40,0x001c3362afe912c5,0x005187889f678bd2)},
+  {FIELD_LITERAL(0x0086835fc62bbdc7,0x009c3516ca4910a1,0x00956c71f8d00783,0x0095c78fcf63235f,0x00fc7ff6ba05c222,0x00cdd8b3f8d74a52,0x00ac5ae16de8256e,0x00e9d4be8ed48624)},
+  {FIELD_LITERAL(0x00c0ce11405df2d8,0x004e3f37b293d7b6,0x002410172e1ac6db,0x00b8dbff4bf8143d,0x003a7b409d56eb66,0x003e0f6a0dfef9af,0x0081c4e4d3645be1,0x00ce76076b127623)},
+  {FIELD_LITERAL(0x00f6ee0f98974239,0x0042d89af07d3a4f,0x00846b7fe84346b5,0x006a21fc6a8d39a1,0x00ac8bc2541ff2d9,0x006d4e2a77732732,0x009a39b694cc3f2f,0x0085c0aa2a404c8f)},
+  {FIELD_LITERAL(0x00b261101a218548,0x00c1cae96424277b,0x00869da0a77dd268,0x00bc0b09f8ec83ea,0x00d61027f8e82ba9,0x00aa4c85999dce67,0x00eac3132b9f3fe1,0x00fb9b0cf1c695d2)},
+  {FIELD_LITERAL(0x0043079295512f0d,0x0046a009861758e0,0x003ee2842a807378,0x0034cc9d1298e4fa,0x009744eb4d31b3ee,0x00afacec96650cd0,0x00ac891b313761ae,0x00e864d6d26e708a)},
+  {FIELD_LITERAL(0x00a84d7c8a23b491,0x0088e19aa868b27f,0x0005986d43e78ce9,0x00f28012f0606d28,0x0017ded7e10249b3,0x005ed4084b23af9b,0x00b9b0a940564472,0x00ad9056cceeb1f4)},
+  {FIELD_LITERAL(0x00db91b357fe755e,0x00a1aa544b15359c,0x00af4931a0195574,0x007686124fe11aef,0x00d1ead3c7b9ef7e,0x00aaf5fc580f8c15,0x00e727be147ee1ec,0x003c61c1e1577b86)},
+  {FIELD_LITERAL(0x009d3fca983220cf,0x00cd11acbc853dc4,0x0017590409d27f1d,0x00d2176698082802,0x00fa01251b2838c8,0x00dd297a0d9b51c6,0x00d76c92c045820a,0x00534bc7c46c9033)},
+  {FIELD_LITERAL(0x0080ed9bc9b07338,0x00fceac7745d2652,0x008a9d55f5f2cc69,0x0096ce72df301ac5,0x00f53232e7974d87,0x0071728c7ae73947,0x0090507602570778,0x00cb81cfd883b1b2)},
+  {FIELD_LITERAL(0x005011aadea373da,0x003a8578ec896034,0x00f20a6535fa6d71,0x005152d31e5a87cf,0x002bac1c8e68ca31,0x00b0e323db4c1381,0x00f1d596b7d5ae25,0x00eae458097cb4e0)},
+  {FIELD_LITERAL(0x00920ac80f9b0d21,0x00f80f7f73401246,0x0086d37849b557d6,0x0002bd4b317b752e,0x00b26463993a42bb,0x002070422a73b129,0x00341acaa0380cb3,0x00541914dd66a1b2)},
+  {FIELD_LITERAL(0x00c1513cd66abe8c,0x000139e01118944d,0x0064abbcb8080bbb,0x00b3b08202473142,0x00c629ef25da2403,0x00f0aec3310d9b7f,0x0050b2227472d8cd,0x00f6c8a922d41fb4)},
+  {FIELD_LITERAL(0x001075ccf26b7b1f,0x00bb6bb213170433,0x00e9491ad262da79,0x009ef4f48d2d384c,0x008992770766f09d,0x001584396b6b1101,0x00af3f8676c9feef,0x0024603c40269118)},
+  {FIELD_LITERAL(0x009dd7b31319527c,0x001e7ac948d873a9,0x00fa54b46ef9673a,0x0066efb8d5b02fe6,0x00754b1d3928aeae,0x0004262ac72a6f6b,0x0079b7d49a6eb026,0x003126a753540102)},
+  {FIELD_LITERAL(0x009666e24f693947,0x00f714311269d45f,0x0010ffac1d0c851c,0x0066e80c37363497,0x00f1f4ad010c60b0,0x0015c87408470ff7,0x00651d5e9c7766a4,0x008138819d7116de)},
+  {FIELD_LITERAL(0x003934b11c57253b,0x00ef308edf21f46e,0x00e54e99c7a16198,0x0080d57135764e63,0x00751c27b946bc24,0x00dd389ce4e9e129,0x00a1a2bfd1cd84dc,0x002fae73e5149b32)},
+  {FIELD_LITERAL(0x00911657dffb4cdd,0x00c100b7cc553d06,0x00449d075ec467cc,0x007062100bc64e70,0x0043cf86f7bd21e7,0x00f401dc4b797dea,0x005224afb2f62e65,0x00d1ede3fb5a42be)},
+  {FIELD_LITERAL(0x00f2ba36a41aa144,0x00a0c22d946ee18f,0x008aae8ef9a14f99,0x00eef4d79b19bb36,0x008e75ce3d27b1fc,0x00a65daa03b29a27,0x00d9cc83684eb145,0x009e1ed80cc2ed74)},
+  {FIELD_LITERAL(0x00bed953d1997988,0x00b93ed175a24128,0x00871c5963fb6365,0x00ca2df20014a787,0x00f5d9c1d0b34322,0x00f6f5942818db0a,0x004cc091f49c9906,0x00e8a188a60bff9f)},
+  {FIELD_LITERAL(0x0032c7762032fae8,0x00e4087232e0bc21,0x00f767344b6e8d85,0x00bbf369b76c2aa2,0x008a1f46c6e1570c,0x001368cd9780369f,0x007359a39d079430,0x0003646512921434)},
+  {FIELD_LITERAL(0x007c4b47ca7c73e7,0x005396221039734b,0x008b64ddf0e45d7e,0x00bfad5af285e6c2,0x008ec711c5b1a1a8,0x00cf663301237f98,0x00917ee3f1655126,0x004152f337efedd8)},
+  {FIELD_LITERAL(0x0007c7edc9305daa,0x000a6664f273701c,0x00f6e78795e200b1,0x005d05b9ecd2473e,0x0014f5f17c865786,0x00c7fd2d166fa995,0x004939a2d8eb80e0,0x002244ba0942c199)},
+  {FIELD_LITERAL(0x00321e767f0262cf,0x002e57d776caf68e,0x00bf2c94814f0437,0x00c339196acd622f,0x001db4cce71e2770,0x001ded5ddba6eee2,0x0078608ab1554c8d,0x00067fe0ab76365b)},
+  {FIELD_LITERAL(0x00f09758e11e3985,0x00169efdbd64fad3,0x00e8889b7d6dacd6,0x0035cdd58ea88209,0x00bcda47586d7f49,0x003cdddcb2879088,0x0016da70187e954b,0x009556ea2e92aacd)},
+  {FIELD_LITERAL(0x008cab16bd1ff897,0x00b389972cdf753f,0x00ea8ed1e46dfdc0,0x004fe7ef94c589f4,0x002b8ae9b805ecf3,0x0025c08d892874a5,0x0023938e98d44c4c,0x00f759134cabf69c)},
+  {FIELD_LITERAL(0x006c2a84678e4b3b,0x007a194aacd1868f,0x00ed0225af424761,0x00da0a6f293c64b8,0x001062ac5c6a7a18,0x0030f5775a8aeef4,0x0002acaad76b7af0,0x00410b8fd63a579f)},
+  {FIELD_LITERAL(0x001ec59db3d9590e,0x001e9e3f1c3f182d,0x0045a9c3ec2cab14,0x0008198572aeb673,0x00773b74068bd167,0x0012535eaa395434,0x0044dba9e3bbb74a,0x002fba4d3c74bd0e)},
+  {FIELD_LITERAL(0x0042bf08fe66922c,0x003318b8fbb49e8c,0x00d75946004aa14c,0x00f601586b42bf1c,0x00c74cf1d912fe66,0x00abcb36974b30ad,0x007eb78720c9d2b8,0x009f54ab7bd4df85)},
+  {FIELD_LITERAL(0x00db9fc948f73826,0x00fa8b3746ed8ee9,0x00132cb65aafbeb2,0x00c36ff3fe7925b8,0x00837daed353d2fe,0x00ec661be0667cf4,0x005beb8ed2e90204,0x00d77dd69e564967)},
+  {FIELD_LITERAL(0x0042e6268b861751,0x0008dd0469500c16,0x00b51b57c338a3fd,0x00cc4497d85cff6b,0x002f13d6b57c34a4,0x0083652eaf301105,0x00cc344294cc93a8,0x0060f4d02810e270)},
+  {FIELD_LITERAL(0x00a8954363cd518b,0x00ad171124bccb7b,0x0065f46a4adaae00,0x001b1a5b2a96e500,0x0043fe24f8233285,0x0066996d8ae1f2c3,0x00c530f3264169f9,0x00c0f92d07cf6a57)},
+  {FIELD_LITERAL(0x0036a55c6815d943,0x008c8d1def993db3,0x002e0e1e8ff7318f,0x00d883a4b92db00a,0x002f5e781ae33906,0x001a72adb235c06d,0x00f2e59e736e9caa,0x001a4b58e3031914)},
+  {FIELD_LITERAL(0x00d73bfae5e00844,0x00bf459766fb5f52,0x0061b4f5a5313cde,0x004392d4c3b95514,0x000d3551b1077523,0x0000998840ee5d71,0x006de6e340448b7b,0x00251aa504875d6e)},
+  {FIELD_LITERAL(0x003bf343427ac342,0x00adc0a78642b8c5,0x0003b893175a8314,0x0061a34ade5703bc,0x00ea3ea8bb71d632,0x00be0df9a1f198c2,0x0046dd8e7c1635fb,0x00f1523fdd25d5e5)},
+  {FIELD_LITERAL(0x00633f63fc9dd406,0x00e713ff80e04a43,0x0060c6e970f2d621,0x00a57cd7f0df1891,0x00f2406a550650bb,0x00b064290efdc684,0x001eab0144d17916,0x00cd15f863c293ab)},
+  {FIELD_LITERAL(0x0029cec55273f70d,0x007044ee275c6340,0x0040f637a93015e2,0x00338bb78db5aae9,0x001491b2a6132147,0x00a125d6cfe6bde3,0x005f7ac561ba8669,0x001d5eaea3fbaacf)},
+  {FIELD_LITERAL(0x00054e9635e3be31,0x000e43f31e2872be,0x00d05b1c9e339841,0x006fac50bd81fd98,0x00cdc7852eaebb09,0x004ff519b061991b,0x009099e8107d4c85,0x00273e24c36a4a61)},
+  {FIELD_LITERAL(0x00070b4441ef2c46,0x00efa5b02801a109,0x00bf0b8c3ee64adf,0x008a67e0b3452e98,0x001916b1f2fa7a74,0x00d781a78ff6cdc3,0x008682ce57e5c919,0x00cc1109dd210da3)},
+  {FIELD_LITERAL(0x00cae8aaff388663,0x005e983a35dda1c7,0x007ab1030d8e37f4,0x00e48940f5d032fe,0x006a36f9ef30b331,0x009be6f03958c757,0x0086231ceba91400,0x008bd0f7b823e7aa)},
+  {FIELD_LITERAL(0x00cf881ebef5a45a,0x004ebea78e7c6f2c,0x0090da9209cf26a0,0x00de2b2e4c775b84,0x0071d6031c3c15ae,0x00d9e927ef177d70,0x00894ee8c23896fd,0x00e3b3b401e41aad)},
+  {FIELD_LITERAL(0x00204fef26864170,0x00819269c5dee0f8,0x00bfb4713ec97966,0x0026339a6f34df78,0x001f26e64c761dc2,0x00effe3af313cb60,0x00e17b70138f601b,0x00f16e1ccd9ede5e)},
+  {FIELD_LITERAL(0x005d9a8353fdb2db,0x0055cc2048c698f0,0x00f6c4ac89657218,0x00525034d73faeb2,0x00435776fbda3c7d,0x0070ea5312323cbc,0x007a105d44d069fb,0x006dbc8d6dc786aa)},
+  {FIELD_LITERAL(0x0017cff19cd394ec,0x00fef7b810922587,0x00e6483970dff548,0x00ddf36ad6874264,0x00e61778523fcce2,0x0093a66c0c93b24a,0x00fd367114db7f86,0x007652d7ddce26dd)},
+  {FIELD_LITERAL(0x00d92ced7ba12843,0x00aea9c7771e86e7,0x0046639693354f7b,0x00a628dbb6a80c47,0x003a0b0507372953,0x00421113ab45c0d9,0x00e545f08362ab7a,0x0028ce087b4d6d96)},
+  {FIELD_LITERAL(0x00a67ee7cf9f99eb,0x005713b275f2ff68,0x00f1d536a841513d,0x00823b59b024712e,0x009c46b9d0d38cec,0x00cdb1595aa2d7d4,0x008375b3423d9af8,0x000ab0b516d978f7)},
+  {FIELD_LITERAL(0x00428dcb3c510b0f,0x00585607ea24bb4e,0x003736bf1603687a,0x00c47e568c4fe3c7,0x003cd00282848605,0x0043a487c3b91939,0x004ffc04e1095a06,0x00a4c989a3d4b918)},
+  {FIELD_LITERAL(0x00a8778d0e429f7a,0x004c02b059105a68,0x0016653b609da3ff,0x00d5107bd1a12d27,0x00b4708f9a771cab,0x00bb63b662033f69,0x0072f322240e7215,0x0019445b59c69222)},
+  {FIELD_LITERAL(0x00cf4f6069a658e6,0x0053ca52859436a6,0x0064b994d7e3e117,0x00cb469b9a07f534,0x00cfb68f399e9d47,0x00f0dcb8dac1c6e7,0x00f2ab67f538b3a5,0x0055544f178ab975)},
+  {FIELD_LITERAL(0x0099b7a2685d538c,0x00e2f1897b7c0018,0x003adac8ce48dae3,0x00089276d5c50c0c,0x00172fca07ad6717,0x00cb1a72f54069e5,0x004ee42f133545b3,0x00785f8651362f16)},
+  {FIELD_LITERAL(0x0049cbac38509e11,0x0015234505d42cdf,0x00794fb0b5840f1c,0x00496437344045a5,0x0031b6d944e4f9b0,0x00b207318ac1f5d8,0x0000c840da7f5c5d,0x00526f373a5c8814)},
+  {FIELD_LITERAL(0x002c7b7742d1dfd9,0x002cabeb18623c01,0x00055f5e3e044446,0x006c20f3b4ef54ba,0x00c600141ec6b35f,0x00354f437f1a32a3,0x00bac4624a3520f9,0x00c483f734a90691)},
+  {FIELD_LITERAL(0x0053a737d422918d,0x00f7fca1d8758625,0x00c360336dadb04c,0x00f38e3d9158a1b8,0x0069ce3b418e84c6,0x005d1697eca16ead,0x00f8bd6a35ece13d,0x007885dfc2b5afea)},
+  {FIELD_LITERAL(0x00c3617ae260776c,0x00b20dc3e96922d7,0x00a1a7802246706a,0x00ca6505a5240244,0x002246b62d919782,0x001439102d7aa9b3,0x00e8af1139e6422c,0x00c888d1b52f2b05)},
+  {FIELD_LITERAL(0x005b67690ffd41d9,0x005294f28df516f9,0x00a879272412fcb9,0x00098b629a6d1c8d,0x00fabd3c8050865a,0x00cd7e5b0a3879c5,0x00153238210f3423,0x00357cac101e9f42)},
+  {FIELD_LITERAL(0x008917b454444fb7,0x00f59247c97e441b,0x00a6200a6815152d,0x0009a4228601d254,0x001c0360559bd374,0x007563362039cb36,0x00bd75b48d74e32b,0x0017f515ac3499e8)},
+  {FIELD_LITERAL(0x001532a7ffe41c5a,0x00eb1edce358d6bf,0x00ddbacc7b678a7b,0x008a7b70f3c841a3,0x00f1923bf27d3f4c,0x000b2713ed8f7873,0x00aaf67e29047902,0x0044994a70b3976d)},
+  {FIELD_LITERAL(0x00d54e802082d42c,0x00a55aa0dce7cc6c,0x006477b96073f146,0x0082efe4ceb43594,0x00a922bcba026845,0x0077f19d1ab75182,0x00c2bb2737846e59,0x0004d7eec791dd33)},
+  {FIELD_LITERAL(0x0044588d1a81d680,0x00b0a9097208e4f8,0x00212605350dc57e,0x0028717cd2871123,0x00fb083c100fd979,0x0045a056ce063fdf,0x00a5d604b4dd6a41,0x001dabc08ba4e236)},
+  {FIELD_LITERAL(0x00c4887198d7a7fa,0x00244f98fb45784a,0x0045911e15a15d01,0x001d323d374c0966,0x00967c3915196562,0x0039373abd2f3c67,0x000d2c5614312423,0x0041cf2215442ce3)},
+  {FIELD_LITERAL(0x008ede889ada7f06,0x001611e91de2e135,0x00fdb9a458a471b9,0x00563484e03710d1,0x0031cc81925e3070,0x0062c97b3af80005,0x00fa733eea28edeb,0x00e82457e1ebbc88)},
+  {FIELD_LITERAL(0x006a0df5fe9b6f59,0x00a0d4ff46040d92,0x004a7cedb6f93250,0x00d1df8855b8c357,0x00e73a46086fd058,0x0048fb0add6dfe59,0x001e03a28f1b4e3d,0x00a871c993308d76)},
+  {FIELD_LITERAL(0x0030dbb2d1766ec8,0x00586c0ad138555e,0x00d1a34f9e91c77c,0x0063408ad0e89014,0x00d61231b05f6f5b,0x0009abf569f5fd8a,0x00aec67a110f1c43,0x0031d1a790938dd7)},
+  {FIELD_LITERAL(0x006cded841e2a862,0x00198d60af0ab6fb,0x0018f09db809e750,0x004e6ac676016263,0x00eafcd1620969cb,0x002c9784ca34917d,0x0054f00079796de7,0x00d9fab5c5972204)},
+  {FIELD_LITERAL(0x004bd0fee2438a83,0x00b571e62b0f83bd,0x0059287d7ce74800,0x00fb3631b645c3f0,0x00a018e977f78494,0x0091e27065c27b12,0x007696c1817165e0,0x008c40be7c45ba3a)},
+  {FIELD_LITERAL(0x00a0f326327cb684,0x001c7d0f672680ff,0x008c1c81ffb112d1,0x00f8f801674eddc8,0x00e926d5d48c2a9d,0x005bd6d954c6fe9a,0x004c6b24b4e33703,0x00d05eb5c09105cc)},
+  {FIELD_LITERAL(0x00d61731caacf2cf,0x002df0c7609e01c5,0x00306172208b1e2b,0x00b413fe4fb2b686,0x00826d360902a221,0x003f8d056e67e7f7,0x0065025b0175e989,0x00369add117865eb)},
+  {FIELD_LITERAL(0x00aaf895aec2fa11,0x000f892bc313eb52,0x005b1c794dad050b,0x003f8ec4864cec14,0x00af81058d0b90e5,0x00ebe43e183997bb,0x00a9d610f9f3e615,0x007acd8eec2e88d3)},
+  {FIELD_LITERAL(0x0049b2fab13812a3,0x00846db32cd60431,0x000177fa578c8d6c,0x00047d0e2ad4bc51,0x00b158ba38d1e588,0x006a45daad79e3f3,0x000997b93cab887b,0x00c47ea42fa23dc3)},
+  {FIELD_LITERAL(0x0012b6fef7aeb1ca,0x009412768194b6a7,0x00ff0d351f23ab93,0x007e8a14c1aff71b,0x006c1c0170c512bc,0x0016243ea02ab2e5,0x007bb6865b303f3e,0x0015ce6b29b159f4)},
+  {FIELD_LITERAL(0x009961cd02e68108,0x00e2035d3a1d0836,0x005d51f69b5e1a1d,0x004bccb4ea36edcd,0x0069be6a7aeef268,0x0063f4dd9de8d5a7,0x006283783092ca35,0x0075a31af2c35409)},
+  {FIELD_LITERAL(0x00c412365162e8cf,0x00012283fb34388a,0x003e6543babf39e2,0x00eead6b3a804978,0x0099c0314e8b326f,0x00e98e0a8d477a4f,0x00d2eb96b127a687,0x00ed8d7df87571bb)},
+  {FIELD_LITERAL(0x00777463e308cacf,0x00c8acb93950132d,0x00ebddbf4ca48b2c,0x0026ad7ca0795a0a,0x00f99a3d9a715064,0x000d60bcf9d4dfcc,0x005e65a73a437a06,0x0019d536a8db56c8)},
+  {FIELD_LITERAL(0x00192d7dd558d135,0x0027cd6a8323ffa7,0x00239f1a412dc1e7,0x0046b4b3be74fc5c,0x0020c47a2bef5bce,0x00aa17e48f43862b,0x00f7e26c96342e5f,0x0008011c530f39a9)},
+  {FIELD_LITERAL(0x00aad4ac569bf0f1,0x00a67adc90b27740,0x0048551369a5751a,0x0031252584a3306a,0x0084e15df770e6fc,0x00d7bba1c74b5805,0x00a80ef223af1012,0x0089c85ceb843a34)},
+  {FIELD_LITERAL(0x00c4545be4a54004,0x0099e11f60357e6c,0x001f3936d19515a6,0x007793df84341a6e,0x0051061886717ffa,0x00e9b0a660b28f85,0x0044ea685892de0d,0x000257d2a1fda9d9)},
+  {FIELD_LITERAL(0x007e8b01b24ac8a8,0x006cf3b0b5ca1337,0x00f1607d3e36a570,0x0039b7fab82991a1,0x00231777065840c5,0x00998e5afdd346f9,0x00b7dc3e64acc85f,0x00baacc748013ad6)},
+  {FIELD_LITERAL(0x008ea6a4177580bf,0x005fa1953e3f0378,0x005fe409ac74d614,0x00452327f477e047,0x00a4018507fb6073,0x007b6e71951caac8,0x0012b42ab8a6ce91,0x0080eca677294ab7)},
+  {FIELD_LITERAL(0x00a53edc023ba69b,0x00c6afa83ddde2e8,0x00c3f638b307b14e,0x004a357a64414062,0x00e4d94d8b582dc9,0x001739caf71695b7,0x0012431b2ae28de1,0x003b6bc98682907c)},
+  {FIELD_LITERAL(0x008a9a93be1f99d6,0x0079fa627cc699c8,0x00b0cfb134ba84c8,0x001c4b778249419a,0x00df4ab3d9c44f40,0x009f596e6c1a9e3c,0x001979c0df237316,0x00501e953a919b87)},
+  {FIELD_LITERAL(0x00e413c68a4586a7,0x003ec446403679fc,0x00f284b604b3b436,0x007ef8125018d243,0x00d6b0a86cf18f1d,0x0065ebb4c2b505f4,0x00c110eb9f40e656,0x00975d950b1f2c9f)},
+  {FIELD_LITERAL(0x00654c303402a961,0x003b5af7bdfac6ba,0x0094319060ac107d,0x00f73a4c063a4883,0x0033dadc9890dadb,0x002c07abe51c36cb,0x00b2272ccc731daa,0x009517368ca0d233)},
+  {FIELD_LITERAL(0x00aafc64264023c5,0x00a0151496ac455c,0x00bd04d8ecf7c4aa,0x00f6d624e7fe6427,0x00bb996d47b4c1fa,0x00bb51a741e57275,0x00839b2ffa3f4538,0x00e6c3e0f2a040aa)},
+  {FIELD_LITERAL(0x00ff75c7d049cebd,0x0017e65d4bd11ccf,0x009ef224bb69e583,0x009641b8b0f11daa,0x001ab94fffe77a63,0x007e1a45ec1f6b42,0x00b987d512f48ac7,0x00fa79db26c1f27d)},
+  {FIELD_LITERAL(0x002b782e91680258,0x0025e14bc23faf00,0x00d2ec57ba084762,0x0013c1770bd8aa0d,0x00c63661bc49cdb2,0x004c2c5897f4ca57,0x00bc87c04beffd43,0x00e7151a232827a6)},
+  {FIELD_LITERAL(0x00039d8c4841ca2a,0x00b8f2b3a783eb8a,0x00f2e8ad568add8a,0x00f0b5e8b6a55f0f,0x0060d03a05425fc2,0x006a51713b6066e8,0x00a2eeb07cc0aee8,0x00b4eb3b309a2dd9)},
+  {FIELD_LITERAL(0x00b226f5656b4f7b,0x00511d68c15fd4a9,0x0021c4294fc0c017,0x00df9f211c01a867,0x00439bb6b23feca0,0x00e044575faa9c2c,0x00cd0195a56a0200,0x000ee94dbe6a9d0c)},
+  {FIELD_LITERAL(0x00afb55844c3d2c6,0x00b1021b66f98b8f,0x00ba83c1adeebfbf,0x00b17f3a323da58c,0x0030f78155052d86,0x00263c308b87d727,0x00d34a72cd61dd97,0x0090e5485a703e9e)},
+  {FIELD_LITERAL(0x0007c4d9669edc69,0x00269af0d7a6f939,0x00ebcb584f53bfb4,0x0097370c38067764,0x00ce2be5cc469219,0x0018a04bf4bdb92d,0x00cd6db2e56a2b50,0x00464c0d3ca529de)},
+  {FIELD_LITERAL(0x007c8e212000ba8a,0x004113d692744385,0x005c28338e5d8128,0x0060fc0892949283,0x00ab21f56e6ede53,0x00012f6814165978,0x007d16f89d900fa4,0x00c808421a2e4017)},
+  {FIELD_LITERAL(0x00d32fdff5184da0,0x001df652e5eef576,0x003d157ebfe13641,0x0006a5c4e5cd4cf4,0x0089342a483bb1c6,0x0098681dcf12192d,0x00f3faa9d56985be,0x003fef63a26f7cd1)},
+  {FIELD_LITERAL(0x00147150439d4884,0x00ab520fa3c80453,0x00d2cb5fa43311cc,0x00a52844786a78a2,0x0032ea6bedd88c35,0x00d05a8d1f80320f,0x00dd2e0ba752f476,0x00d7f5c52580304f)},
+  {FIELD_LITERAL(0x00b2f04df59255a1,0x00fe2ac8e5989b8f,0x00e7dcdda0b21a7c,0x002d422458057222,0x0035d2af379e319f,0x00946eebf1d5ae41,0x00c7d5538161e1fb,0x00216c4722e7deda)},
+  {FIELD_LITERAL(0x00a5d64f3361d64f,0x0032f6475a462003,0x00cbdcc0d10a9d84,0x007efc3ed6c9e0f9,0x006eaa7bd38dfa16,0x00fe868d9102eff2,0x002e83620dc43155,0x002f1c5a6a4efcc4)},
+  {FIELD_LITERAL(0x00b88e94d17813b5,0x00b4002ba77bb154,0x00adeb1f700db5bd,0x0038e166ada0c890,0x00123247320cab97,0x00365452450306d7,0x00877506e59bf26c,0x0027681df7a2e221)},
+  {FIELD_LITERAL(0x0062b9acbc033fa8,0x00ead872f2c82cb5,0x00a46fd2ecda2929,0x00a517fb77431e5e,0x008a1324edb49892,0x00a9c5ececff29e4,0x00bd7ff96701fc36,0x007153a19202ef5d)},
+  {FIELD_LITERAL(0x000a0c82ddc1fbb6,0x008d350364957178,0x00bf1383cfe6d8e8,0x00afb34794b5d6a5,0x0073bd5491bf0b8c,0x00de2a7f451b81af,0x00ad23c46ad5d792,0x00090af6548b2e66)},
+  {FIELD_LITERAL(0x0007cf5670ceabe0,0x00c983ad67faad83,0x00bda8e74e4db53a,0x007f36e2de81eace,0x00252afd593613a7,0x00513bdedb2037c2,0x00cc04cac5e18f98,0x00ba7f8e0c3cb628)},
+  {FIELD_LITERAL(0x0047bcecdb9b6d68,0x00e7c8c16ba4cc5a,0x00ba517259fed111,0x0096aa8f0df64475,0x0032a48f6f63bb66,0x00af2ea6e8c83c71,0x00f9f9d9dd71cafa,0x006dc8868b09a2cc)},
+  {FIELD_LITERAL(0x0043e68a3a85180e,0x002530be422af47f,0x002da968ac01658b,0x006d78eb0f53030f,0x00108e04987ba712,0x00034e6f9d1b547f,0x00e4f6499b2dbd01,0x00727a8f4a084993)},
+  {FIELD_LITERAL(0x0047e6ea5faa14e0,0x00cd456ba9358578,0x00b1a9e3bee6a947,0x005ec2fac9b5d47c,0x00ddeaf5df121013,0x00a5e91a877e5aec,0x003e3d4cbd2f2e06,0x0045f060182bd44f)},
+  {FIELD_LITERAL(0x0094e56962712778,0x00f59beb7144bbf8,0x00f7c61fe70e2eca,0x00e19120474b0109,0x002e85a29382ec81,0x00f4deecd963d5aa,0x0017850eaccf2a57,0x0061d34af8de987b)},
+  {FIELD_LITERAL(0x005149c050637392,0x003effee1eb53636,0x00df69828b6d49a4,0x0003d1c2be4dc31c,0x002c0fc41fb25bf6,0x0096daf8a477703c,0x00982f4243db6630,0x000c5999ac9b93a1)},
+  {FIELD_LITERAL(0x005ed781e94a0565,0x004728fd8fb2291d,0x00dfd625fa0b9e8e,0x00cbd08540ad01d4,0x0016ec7470e591e4,0x005c16878c369c17,0x0090159c97a96d33,0x009dd7b6e0518785)},
+  {FIELD_LITERAL(0x0044931b5c5b5041,0x009c0409a1f15e0e,0x0007a06ca71c63cd,0x005202629723b6e2,0x0028404350ad721c,0x00c80c29ace3f7e1,0x00ee5d6b512761f6,0x0019e46855d2c1eb)},
+  {FIELD_LITERAL(0x00de62235c6ab9f6,0x0073e0be96b8b40c,0x00399331b50cba2c,0x00174728fcd125b5,0x0082e7c9f1fc33c5,0x00344cc7c5eb91fb,0x005eeb2603e3c440,0x00b160f08a7ef705)},
+  {FIELD_LITERAL(0x0085b642a0f1f14b,0x00356f6b3ea5943f,0x006b84e0bf4bb2d1,0x00c4d267d9d91638,0x00256f3c4022a6b3,0x00743433abf100bc,0x002f1638fd7f2105,0x001f5c4d40dbdb3e)},
+  {FIELD_LITERAL(0x00be95b07f00ecc6,0x00aa8c5941b985ad,0x00dd0fc7e158eff6,0x009b0a9b5f807a8f,0x00b1bbb041403f13,0x008fedb18ac01220,0x0007cafd0cd4b638,0x00494a5e5a5be833)},
+  {FIELD_LITERAL(0x002b108946e14b76,0x00f29485d541f43b,0x003957b0b77fc57d,0x0010b3507d4316f1,0x001e24ce7b695f82,0x009199e62ee390d1,0x00b47efeb2e0d9a8,0x00b3a6d3f94dbf25)},
+  {FIELD_LITERAL(0x002c4e6b1705e778,0x0095cbff716069d3,0x009ddd7ca73fa96c,0x00f822553b7c8ea3,0x0070f657917dc4a3,0x0098f0a93b12ec8d,0x003f38bea563f500,0x007bb05c8e5060c7)},
+  {FIELD_LITERAL(0x00155ec7bd28cbee,0x008d3086ac6e2add,0x0003cad477b18f43,0x004d12e59dcc1d81,0x00c308bbdb5cd1ca,0x005a4a8f54791ca2,0x0038ab8b2e3d033f,0x00a1cd18f059cfe6)},
+  {FIELD_LITERAL(0x004d7bcc0035b9a3,0x00a4f1b80f0e6931,0x006e4742bb2aaa16,0x00f5e3ec8448e6d0,0x0096dbcd44c19e51,0x0094a6cd2fba6789,0x0000db365bff3e85,0x001a83b4ddade56e)},
+  {FIELD_LITERAL(0x00f28b9dee3f3a02,0x0042c4e8a1081011,0x0048f75168434e55,0x0024c62dd8eb7933,0x007cc5c3762505f8,0x005e68695bd113e3,0x000c02152ee95e9f,0x005b8ea15d5e0dcd)},
+  {FIELD_LITERAL(0x003a2f88163d8944,0x0071cc5952b80224,0x00beb00d5298b6ee,0x0040d326f1e1c3b9,0x00424255474e8d3e,0x008905181870f841,0x007844165f6add23,0x00a6968394d665e7)},
+  {FIELD_LITERAL(0x00d59359eaf0f1cd,0x00680239585cd7ec,0x00d763e37c894435,0x001c3d9af863c48a,0x002e2c0117fb0ccf,0x001c25c191c5a953,0x0025a4509ac53351,0x00e75eb6dba99638)},
+  {FIELD_LITERAL(0x00e6d46ad132ee44,0x007db85463fbd884,0x00b243fc7fd9b7e9,0x009c7344d5d78e50,0x0068edfd21bbe8c4,0x00aec4f969e4f794,0x001cdc6922e4a7e7,0x00aeb7e809725fd8)},
+  {FIELD_LITERAL(0x003a71e384b38cff,0x00c8000b916e809a,0x00367c3a34265eb1,0x00e1e7a835f4cf98,0x00a24252bb23185a,0x00d052bb202ae958,0x0060fd728bd1a610,0x0070dae251540916)},
+  {FIELD_LITERAL(0x007aed4375b3abd4,0x005d526c0a705012,0x00108b10daf36b56,0x006f9ee64a5e4120,0x004ba43f0329dad8,0x00791c7c4f89e347,0x003b98ecbb8b92f0,0x00ad624347adcdec)},
+  {FIELD_LITERAL(0x005bd1d62f6526e6,0x0017444e96fe2aa1,0x00fd8757e56ee709,0x005d335f77e40727,0x00c187f28c6e4d5c,0x006d4eadb0ef0a3d,0x00d84aaf7ba3760a,0x0084a16d0a5de921)},
+  {FIELD_LITERAL(0x0019f05b71d75738,0x00ff1a33aa4af262,0x0089c4da07b68282,0x00890814bfc9ae08,0x003262e4526d5c44,0x0028ad3974abed50,0x00c7368bc336370f,0x00b1f6abda4324bb)},
+  {FIELD_LITERAL(0x0078828fae951616,0x00ff3b1aa2cd8698,0x000fce2f5f06fbd1,0x00327e568b7ddbba,0x0022ac2bf74bb595,0x00f7b85ae51e2ffd,0x001c156fc5f93eed,0x00396d2b07502fc7)},
+  {FIELD_LITERAL(0x0044c203e3b01d6f,0x0096624c7965f587,0x000f37c4aa44e4bf,0x009a606643fe0ab7,0x00e339bf1ffd8836,0x00933e3694f51cf2,0x005f8b6b8c14a32a,0x0058edcc7c4e5641)},
+  {FIELD_LITERAL(0x0096e0fed8cab38c,0x003dd5972f9c0da1,0x0096830b70acfa59,0x005cf00d85205cb2,0x00f697684856be43,0x00dbb7d61092adf1,0x00f5667c43a72ed6,0x00c88cc090f21b99)},
+  {FIELD_LITERAL(0x0058ce78e4a12941,0x0063f94afce07abb,0x00e8d9068a6258bd,0x00f037373c97892d,0x00be3efee0a7c9ae,0x00d72ead32bcc50d,0x008212a5d5a773bd,0x001d8432c369de28)},
+  {FIELD_LITERAL(0x00438df92cbe8a90,0x00fea66c19e57e0d,0x0096df0a20a3bd06,0x002286db9c685348,0x003635a73e0b9c97,0x00d1ec3f8469102c,0x003229e8e0385ef0,0x00fc8192af89e90c)},
+  {FIELD_LITERAL(0x00abd1aee4589249,0x000ad4d4bdcfd483,0x00d25708826b621a,0x0075a3b1017f3105,0x001da686e6925827,0x00968dd442baca4b,0x004a9dfe45d06bef,0x00424f55830132f9)},
+  {FIELD_LITERAL(0x00a5b6ebff72b4f7,0x00f92709fa31be4a,0x004e567bccda707d,0x0098c9b0ff897f2a,0x00707507e7de7a25,0x00c443854830ec81,0x0048ac60973c8908,0x000094095446b1e4)},
+  {FIELD_LITERAL(0x00b7f4692e1dc87f,0x0033d1f6fb888fc5,0x00ca54acf4711e37,0x007eb769ad2e3a7f,0x009b5e6809d499dc,0x00a9b215c139f0ff,0x0082f83e606c5e34,0x00d7bed1ed7cdc04)},
+  {FIELD_LITERAL(0x0094fb1bd7f8715b,0x0098c893819c96f3,0x00128f0cde47a915,0x0080a160e9e87009,0x00871bf39a9d737f,0x0086bfbef16f6a3f,0x00fce080af5e4996,0x0075263831021c3b)},
+  {FIELD_LITERAL(0x00190acce9243e96,0x00df3d862131f966,0x00b6864c89804337,0x00ed02cf9bf5995d,0x00f6c779c88cc2ca,0x003f1faf5f18e3f4,0x004d12d37d06dacc,0x00fc6d7b8d35d91f)},
+  {FIELD_LITERAL(0x00337c5ffc7b33fc,0x00e661d4be0ea953,0x00f13bc397532e5c,0x00dfc67179dcf16b,0x00a4b7a3a82dc211,0x00c75356a05fa563,0x007cd5d30af0329c,0x00e31e3e8080350f)},
+  {FIELD_LITERAL(0x002430f4b394a5fd,0x002c94dd347577ec,0x00a27058f2385c43,0x00038de48b3886bd,0x00b836eb90925c55,0x00ffa6afd8e09d63,0x00d20715d4200af8,0x00abec58c011c451)},
+  {FIELD_LITERAL(0x00772d9747bba1f7,0x00ac9854600b69ff,0x0045c1642dcdcfd2,0x00684fb2fc8d3c34,0x001a59baf781a0b0,0x00c6658b19f46812,0x00ed40f78be13d5a,0x0027f47fd40df0ed)},
+  {FIELD_LITERAL(0x002bd1f6ad105160,0x00ff4967b72ee2df,0x00ab35f1bd4955a4,0x00dbca5aef876a2e,0x008ffccb6c9ee0ba,0x0040a1470d2293c8,0x00459d02e2fd345f,0x0056c3f938804b92)},
+  {FIELD_LITERAL(0x0098c7d75eef9bfa,0x0066561b76a530cb,0x006f1da7063148ce,0x00c01733f969c2af,0x0095c019cacfded2,0x005a794d38bc776c,0x00754705936d5527,0x001c0df00ca72048)},
+  {FIELD_LITERAL(0x006c395f64f042d0,0x001ddd88bfbae06e,0x00dc67f2423e4f06,0x0083aabd983e7159,0x009cd642d96d8d26,0x00c1cabd008f6771,0x0048a01b02fe595b,0x000e378160eb7b93)},
+  {FIELD_LITERAL(0x00f27612f6ece95b,0x001dc6fec10c16c4,0x008815cb47705cd8,0x00be7f902ca1a77f,0x006740e60401d0cd,0x00a75694183bc516,0x006a88f3059b3538,0x00ceeddd2b8c3421)},
+  {FIELD_LITERAL(0x00efba96c47d81ab,0x00dccd08d752fabd,0x001762dde9468fbc,0x0083d3f2426cb82d,0x00d0e6ff84f5b6c2,0x00766afd18439471,0x00b5b23b46ea30c4,0x00d459fba5961be7)},
+  {FIELD_LITERAL(0x00fd510d0e6958f1,0x0004af90d417c6ec,0x0038861784e95676,0x0052d64e188b4fd7,0x001145af44a06d53,0x008c1a8f048f27bf,0x000876bc4f04e71f,0x00f0edf124d825f1)},
+  {FIELD_LITERAL(0x00d4d776d2a07c2a,0x0005aa01c7fa84ec,0x00377775b1a8c823,0x007c1d680182d08c,0x0011623f3f3d4d2b,0x003f521b7438f2b9,0x0095fe70fcfec80f,0x009c52a1d52676c2)},
+  {FIELD_LITERAL(0x001dae91b3e451de,0x006c7d22c5ab8290,0x0070c41471d7d1a9,0x00d47998a10f0555,0x00c0b6615ec75ce0,0x00cc2f775ed2db90,0x0095551189a3d6cb,0x000cc4ec55ba92d4)},
+  {FIELD_LITERAL(0x00c1bce233c99768,0x00ae4dc3397a8416,0x00b7687d0c892215,0x00880403a7137802,0x00a2c55d54773e94,0x0087d2cee9407ff0,0x006ddc423463219c,0x0087686efaeb8395)},
+  {FIELD_LITERAL(0x00a69b9c77db0b99,0x00b5b29503b76f6c,0x00565233779b3fb1,0x00979f023a40700a,0x006eadeef123380e,0x000875f5b93b9595,0x00504196f0e7325b,0x00b471e929c19a67)},
+  {FIELD_LITERAL(0x002040a6cecb4737,0x00e4809d8dc21e54,0x005600d8b37df1ca,0x00f411004914feac,0x009e6640522c2987,0x00c2037a319f0483,0x008e830c5488d41f,0x00b0e22bc9146bdc)},
+  {FIELD_LITERAL(0x00d575aed321e12f,0x004c7c474620bed6,0x00b0b552bb6351bd,0x004bffae3995c317,0x00a3f47f383b524f,0x0002571b28f04734,0x00406cdc308fa532,0x008c784ea92e41b4)},
+  {FIELD_LITERAL(0x0065f84aa06799d6,0x00e3538cef848272,0x00acd2c5a786393f,0x001999854fb55bde,0x00c9915af0ed6a6c,0x00825d48c7b35a8d,0x00a1b2e8154cd00c,0x00c3f1830625615d)},
+  {FIELD_LITERAL(0x00337475459c17bb,0x00b34e6035440974,0x00a3d69bb57e49d7,0x00adad2d5503a0f3,0x004626a6e76ec54a,0x008518950bed9884,0x00effab448dd343e,0x004c5e545ec88c8a)},
+  {FIELD_LITERAL(0x00ae8a76c3edd8ab,0x003dbc2edec0d68a,0x003cd85daa1b6592,0x00f2ec7f48419a5a,0x00270420f2275e7c,0x0098b40e4feb1c7e,0x0056820c73e6a909,0x0058b2e224bb7514)},
+  {FIELD_LITERAL(0x0060c9d65b245e41,0x00d5fe4832490bca,0x00b9d3b1c42e31ae,0x0066a274a3daa441,0x00991094a7bdde43,0x00703fce348b9134,0x008e054a5a6e875f,0x004d0bde075185a4)},
+  {FIELD_LITERAL(0x0024582656910b7c,0x00f301372d8240e3,0x00b50094162c2b28,0x00a2da26cc1d3a96,0x00b2e3c8dd4aa356,0x005c487c23eaba59,0x00454fc5d9bd2ff3,0x006ebb92ee1e3172)},
+  {FIELD_LITERAL(0x0063ccbf8dd5e635,0x006910622644fdc2,0x00ae7bc4ee866346,0x00b8b5e5ee9f3549,0x00269f749557cb27,0x003d27ceed19d102,0x000fc8dcd186629a,0x00e6d9dc84290c00)},
+  {FIELD_LITERAL(0x00a0d5c185126b85,0x0072835459a05f2c,0x0091dda454e2e1ac,0x00d1cd6fd668aa7a,0x005dd6cba70dc22c,0x007895819f297278,0x00dc259bffdd0531,0x009f68a508ae7759)},
+  {FIELD_LITERAL(0x006c0276b0565e6e,0x007f2a9fc3f1d186,0x0050750c26804453,0x00226ec4f36ce2df,0x00b7ecab414432c0,0x008e073e2b38c775,0x003a047b55d11df8,0x00e144683d185730)},
+  {FIELD_LITERAL(0x000bac4bed91c54a,0x00da7d56ebc7105a,0x00cf075bdfda22c1,0x00aaa356d93e9468,0x0044de217586c689,0x000f377b0d93dad8,0x0018e1cdfef0fa83,0x00a89abfbabb0482)},
+  {FIELD_LITERAL(0x002af05096b91b83,0x00e3ba22b83dc44a,0x00910ac70bed60ec,0x00b30f6307f56337,0x004af6d920477f04,0x00a0449743efe536,0x0078e53b5f7b12c0,0x000ff56b057102d2)},
+  {FIELD_LITERAL(0x00f888a49d1d5974,0x0027d34cfdabf437,0x006115ce266e39dc,0x00f65084a523906c,0x00a2530b4334a121,0x00a3b8ed24d8d900,0x0030db214b1e2975,0x004c224a94cba8c6)},
+  {FIELD_LITERAL(0x00c2c9c3787867af,0x00f23b5da23a0bd9,0x00293fb05750383c,0x00f5284b8dbcedfc,0x004a9ee136eb51b4,0x009670e9325914cd,0x00ca270007fcb414,0x00f21a56ffdad921)},
+  {FIELD_LITERAL(0x00e44023e593730d,0x00e1d642e5254e9c,0x003943432230b74a,0x0043ad1e213034e6,0x00ac50dc4cfba6cf,0x00abedf93d1633a4,0x007efe6fbaaf27f4,0x003b59a54b91d645)},
+  {FIELD_LITERAL(0x00703d0b90b0e031,0x00fe4a291a103857,0x008316df8469d7d9,0x009115e88b6690ae,0x00a4d1c29648cc33,0x00f0c74316c45056,0x0037f4c8029cf158,0x00dd30eb788049b0)},
+  {FIELD_LITERAL(0x00663971208c2a52,0x00bd4beb50c77557,0x00ef2383739b1817,0x00f476b20550b079,0x00fcc580724604af,0x003d5eafa4cfed14,0x00792e7484bc471b,0x00bb3224fccf839d)},
+  {FIELD_LITERAL(0x006a6a6b11582bf2,0x00241753f96ebe7a,0x0017ebf41723b02d,0x005c7299d91d597c,0x00cbeae8fa834cb7,0x00e047cd0c59c228,0x00e77fa5ab52dfd8,0x00282f59460bcf32)},
+  {FIELD_LITERAL(0x00411a58479b2254,0x00e7af7054c33e19,0x004527c8df9408ca,0x00c6dea4106f5c20,0x006ba16a46a69cda,0x006cf63c0e9dfe3b,0x00f4e47e0d34b53b,0x00d6769d1dd689d5)},
+  {FIELD_LITERAL(0x0090f846b8e44a2d,0x000febc6d1760040,0x00198559e76668c8,0x001fdb14701fed04,0x00a3a7bf92ea2b36,0x00445dc761bc03ae,0x0098baf24c192ada,0x00bb1495e6aa214f)},
+  {FIELD_LITERAL(0x005193aa5acb6919,0x00f7c82f3be9e6fe,0x000676f8d1c32365,0x00b7a673d170dc1b,0x001bbac91dd03347,0x00dea168de46e0bb,0x002a6b2de6fa63e9,0x00676183c255cdfc)},
+  {FIELD_LITERAL(0x00a6f25ea7ad5842,0x000a48a1fc231c21,0x001deead68e68d00,0x00ced568e79967d3,0x000683ea8aa10f15,0x00044742b79b5043,0x00b9a6a309a4f8fd,0x002cf92e1bbfe25a)},
+  {FIELD_LITERAL(0x0031561c7b2b532c,0x00c95ed23cbaafb3,0x009e91af12b78d9c,0x00a040d006e7647d,0x001ee1d5e7fc39aa,0x00980183a398c8f1,0x0037d82af144c94b,0x0019f71c959bae3b)},
+  {FIELD_LITERAL(0x005e552f9702cf02,0x006657e60ee02932,0x00e86f5d5da91f03,0x0064f50212df845c,0x000859ef00aef8d8,0x00e96ae6faa7bf33,0x0024047a721a43f2,0x0090bb2bb962edde)},
+  {FIELD_LITERAL(0x003ef7032f196cd0,0x00a07c587a81a6b4,0x00879e5bfbf8e41f,0x00ac9cf6431810d3,0x00fe1e02d4da9908,0x003055dfdaaa5f20,0x00377d1596d673c0,0x00966ad51fc22ace)},
+  {FIELD_LITERAL(0x0001bf645f644528,0x00e58a0381eb7cdd,0x0014eb550b33d370,0x0001412a4835017a,0x00c74cd0e88d70b2,0x00e6d70421530139,0x00154dc396bf07c7,0x00d2c3ed25504aaf)},
+  {FIELD_LITERAL(0x00d7dc22c67da06b,0x0013b6a923c22d73,0x000ded79b6f49405,0x00a3d933fe655108,0x009b066cd146111d,0x007035b84bd58d01,0x0089e49889571351,0x00eaebd558266ffa)},
+  {FIELD_LITERAL(0x00a316611a09c0e6,0x0007b5fd5afb801b,0x009b3f617c4a864d,0x003fbb5be10eece6,0x00c3f319ddbf937b,0x0063d9f2d19eaad1,0x008fbfb7e0566531,0x008bea72cec73b6b)},
+  {FIELD_LITERAL(0x00ae03c31ffbb51d,0x00d199a32332c2a5,0x00f436948e7a2341,0x00e2177398f92e7b,0x0010a223524900ac,0x00678b1cc022c8a6,0x000cbf223b4393c2,0x00c1839506920e6d)},
+  {FIELD_LITERAL(0x005e093892995237,0x00bd29f6573b3464,0x00ef256f2bfc9f72,0x00bf349f5a40060e,0x006f5a68ff0fba43,0x00434c3e9bfef612,0x00e40e5d691ed21a,0x00f81ae7781544f9)},
+  {FIELD_LITERAL(0x00e4007117649995,0x00fa424a4361633d,0x00bfbd2f99c5fa15,0x00210b16fcc7ad0b,0x004e2cc48f28406a,0x0063e166afae7dbd,0x00c8140897dd2261,0x0046587de8ef8a38)},
+  {FIELD_LITERAL(0x00f223bbd96cc532,0x0077df24aafe2789,0x007b021a2c130a86,0x000c431599191b43,0x0093cd8cf3baaf34,0x00776cc1a5130e67,0x00187a0fdd3efec3,0x002b746fe5c3cd89)},
+  {FIELD_LITERAL(0x00bec3f5173410bb,0x00691f9151b0568a,0x00d0254b1a2f41ac,0x00886508882d1aa2,0x00be6c29afa2e6e9,0x00711dc9d3ce1639,0x00f1d1f0cdef233f,0x0052a7daad00605d)},
+  {FIELD_LITERAL(0x008eb6b0da3c1f44,0x00d453fb2698d450,0x0025a4bfccfd7094,0x007192a0d47bf4e2,0x00b22fdbe27b66a6,0x00816380e4fc6642,0x00ad6e41be1f56a7,0x00a1e13b0aae1550)},
+  {FIELD_LITERAL(0x00c9d876e6bd5889,0x00bd82b009287326,0x007b09c56fa3e2ca,0x0078cefced06115f,0x00e565da96cc2a26,0x002db5b64bbdf7bc,0x009ffbe9f2978b50,0x007489dc44365b9b)},
+  {FIELD_LITERAL(0x00003bf9abb7ff8c,0x00d52b23c6ad1433,0x00a0fbdab4491eb3,0x00d08256fdf59433,0x00f1108d2c44b0d4,0x00a45f46f32c5dc0,0x00a18ba9c051bf91,0x00feb4b812fcd10f)},
+  {FIELD_LITERAL(0x004c5f4f8be14d08,0x00f9d46b6b654912,0x00940d793eb96fe3,0x00259b3629025acd,0x00595a3afffad394,0x003c629618fea28b,0x00f588ee535cd18e,0x008ebf885f72fc1f)},
+  {FIELD_LITERAL(0x000a0395db805dd7,0x003b12a308202f86,0x00d59593431abaa4,0x00250ee912b2dd85,0x005df490efc34a7e,0x00e1c93ec901036c,0x0047bf5d52b79817,0x0091a923e74bddfa)},
+  {FIELD_LITERAL(0x009a31cce208bc3b,0x00784ed947717ee3,0x00b87154efe1ebb7,0x0084f7b8c6e78a77,0x000e4ff2cc5e28b3,0x00f254a581dacbe1,0x00fcc6a06754007c,0x0060eacf9089f456)},
+  {FIELD_LITERAL(0x0053d0364a7f74d9,0x0078b2dc94c99b1c,0x00080d086f55068c,0x0079c6a9b52b633c,0x00e889d4a4835fae,0x00580b7fe8622610,0x002ad530c5b604d1,0x00522d0bdd68df68)},
+  {FIELD_LITERAL(0x00d505e54df38dcc,0x00bb5cf9a44e0297,0x00814d479980b357,0x00cd40f76c64d2e1,0x008a74cb5aaf443e,0x00c8cf91784f40f3,0x00b33838c61449fc,0x0002923a46c0d62b)},
+  {FIELD_LITERAL(0x004e21a608d149c7,0x00ff74f437e89c2d,0x00450764d5487559,0x005cc6e22b3d7f1e,0x0059fb13c0be2c9c,0x00db3cd958da7f09,0x00579ce089c8245c,0x001f362141ad19e0)},
+  {FIELD_LITERAL(0x00b40f79f9e2eabc,0x00aaf4261b3669b8,0x00f440985a459b31,0x0067a1eb40b50e24,0x00514732aa8642a4,0x0036e77b56e41bc7,0x00bc94c5932bb329,0x009e279c5bd4a571)},
+  {FIELD_LITERAL(0x0065cae78a7a1214,0x00a7914090a36238,0x002b4c722990fff4,0x00ef3470df70a5c2,0x0006ca15d2562113,0x0098cb7bcf423ae0,0x009e5d500df644cf,0x001a86055b60a28a)},
+  {FIELD_LITERAL(0x00de166f2fdcbae1,0x0000a72bd3fb0a72,0x00729bb1f9441e26,0x00a0fbfe70082f2a,0x00a563ec91bca8ef,0x00db0d53ee095f1f,0x00920967f418eaf9,0x00b62e5ddf98b89d)},
+  {FIELD_LITERAL(0x00527504b4f821c6,0x0036fa61d40f3563,0x005da863e2760f9d,0x004a85c03516ca5f,0x008706faf2c98f69,0x00f345b116e39ede,0x00223357166790a6,0x00f3ca8d4281e2e8)},
+  {FIELD_LITERAL(0x004aec9a0506bfba,0x00a7dbba57b2652c,0x0097619f4e540eba,0x00b1c4f27af417d2,0x007e2f00a07d40f2,0x00eddf070b10a688,0x000093b272919d4f,0x001d5340d2c1431c)},
+  {FIELD_LITERAL(0x007cacd97ebde652,0x005fff8f0c4d6ac8,0x00414e207a83222a,0x00a80741be4d1bc7,0x00eebd029b075acc,0x000a8f5a923ca684,0x00901b78616db067,0x00abb05aaaff6c6f)},
+  {FIELD_LITERAL(0x0071d9dc4a20a217,0x0019a33dc1bb094e,0x00b1e575dbb4c9f5,0x00e05e298f3b1808,0x003982a1cc7e84fd,0x000fd2a92282e2c4,0x00df26ba5a9beb98,0x00ac114c9e084e06)},
+  {FIELD_LITERAL(0x00f9884f879e2fca,0x002a01d29001e2a5,0x009a89f014a1d19c,0x00aa56a5f4536e74,0x00cdfbfb1eae30cb,0x00b45aafa89f4ced,0x005adac0c6f59e98,0x00b7bf7b000a9ca9)},
+  {FIELD_LITERAL(0x00c7c827a6d71508,0x00851545fc995290,0x00041c03e7466028,0x00e912c9176af4ce,0x0038146b9087cd0d,0x001e1a51fb632921,0x008d1fae11a13488,0x00b9b58b2c78bcb2)},
+  {FIELD_LITERAL(0x00c9d5260c6463ba,0x008be11c65698757,0x008a57caf16e9ac8,0x00124abae6ac4a6a,0x00967aeb73b56bee,0x00b9379ef4cb39eb,0x009420debb57ae9a,0x00afe841df3e2702)},
+  {FIELD_LITERAL(0x00cddb54965fd3a2,0x00a13dec4312463e,0x0087d9aed2054a37,0x00782a5f81d8352e,0x0030c8a3c7e38a94,0x005e3274902d4c73,0x00c0e1286cffa975,0x00217b34521a852c)},
+  {FIELD_LITERAL(0x00e5692a3ab14920,0x00658b0193615486,0x00701e083bcab6d1,0x00c026d13e014bd7,0x00148ead43c3a13f,0x00873e86696bc210,0x00cd7fda17de45b3,0x003ab33147e32654)},
+  {FIELD_LITERAL(0x009fe8f8ef82d7ef,0x004ccd9b3cb6cb7b,0x003134748cd05669,0x007441104fddb1a9,0x00488b7758c062ab,0x0078dd1a703ca66a,0x002aa389c7a0d750,0x0071e33049d139a6)},
+  {FIELD_LITERAL(0x0058a6f673786abf,0x001971d500d2c4cd,0x00a89174224b0eb1,0x00d05073795b6519,0x007f35b339b5db6c,0x00cde248abe7fe89,0x00c431cc76b434ab,0x0004d7fba67fb926)},
+  {FIELD_LITERAL(0x009e1c185125382c,0x001fad53f23ad414,0x007ed9d99c7e5ec3,0x00841045f697ce18,0x002be3231d94bd8b,0x00a0985d0d30407c,0x006d371912c1bafb,0x00fb793be6dea403)},
+  {FIELD_LITERAL(0x004d1ea364b213f1,0x00f7eead033a836b,0x0026636b00d7dda5,0x005d99dac98b0af3,0x0095a2574f6622a0,0x005efe42cb4d636f,0x0048652c6706a0bf,0x0006dd1420cc7db2)},
+  {FIELD_LITERAL(0x0045d72bab8f5dff,0x00bac0287479146e,0x00ea6f6ce3ddd237,0x004a1656a832311d,0x00c70bdf6053bcc5,0x0053d9995d632de4,0x00eee69d41ae02e5,0x00af156fe0204acd)},
+  {FIELD_LITERAL(0x0021b1937bb9bcfb,0x00fb6ecb45e4e81c,0x001573d47fc40c4a,0x007476f6a776754c,0x00f1e67a899b4b6e,0x00551b9c61180820,0x00ae0a441fff293d,0x003bb14bc69311e1)},
+  {FIELD_LITERAL(0x002df0965d77ce2d,0x00522b970de0fbe3,0x005e2f157e13761d,0x009566f8cf48b7e1,0x0054b38c9c4dc7bb,0x00cb487954100c64,0x00acb3275c402520,0x00f214471e192dfb)},
+  {FIELD_LITERAL(0x008ffc5b48e06d26,0x00daa30ffe9e08f1,0x00f621f9afad996d,0x00d3239835d18f47,0x004d42cb300efd35,0x0049df6c46414a30,0x0023273cabf2c6d2,0x00ac16a831fabdfb)},
+  {FIELD_LITERAL(0x0080deb2618e0c73,0x001025566c4b7185,0x00ccb16ac8178eff,0x009e771588fbf6c0,0x00c666251d9d38d6,0x00fccf6f09d9a8ce,0x00d1b837c549dd6e,0x00d61264e23b0f23)},
+  {FIELD_LITERAL(0x00d8bb8268d3959a,0x009e490710196e4e,0x000934627c86d977,0x00a3ef7c7b2420cb,0x0026e3bf650aee66,0x00278d79ab70ac07,0x00c41f09021894b6,0x0000a3096afbaffe)},
+  {FIELD_LITERAL(0x00fcc9e4edb50be3,0x004ead93f9bd5fc5,0x005e315f07d23cf1,0x00d02f8619a0c8a1,0x00d5fb640592d74f,0x009e9ea251e4593e,0x00d4943205be8a49,0x00ef0d4699f514e9)},
+  {FIELD_LITERAL(0x00d125055d73d294,0x0043564f2f4333dc,0x0003419e18e7cb1b,0x00431a0e97787221,0x0068b2df7d9e7e19,0x001d5e88386fc08d,0x00abac558c4c8c5e,0x005f1cc083812d55)},
+  {FIELD_LITERAL(0x00edba53911e21a7,0x002dba6132748176,0x0078b24d45390375,0x00be958bf2478d4d,0x00f63013de3b26ac,0x007a9342bf813037,0x00a7daddd52dff74,0x009412292b7530ff)},
+  {FIELD_LITERAL(0x0037278d6785bd6d,0x00447b6bd42131ba,0x005affd830c02c91,0x00ddc1570388d328,0x0076b40a6d1b3b12,0x00f8ef39f9585148,0x0018bec9ea32eec3,0x00e2f1b471ac41c4)},
+  {FIELD_LITERAL(0x001052e3ccc717c2,0x009abbe60c4c5504,0x006beb9f4dc09c12,0x00b9ce2b0a44b03b,0x00db3f51427c3363,0x00a9427646c99c0d,0x0095c8ecf87d62bb,0x003d9556f70caf3a)},
+  {FIELD_LITERAL(0x0018d4a3cc498ab6,0x00b2c899d80b12ff,0x0096e162955007a3,0x005f00c82a14f27c,0x00c8e8cabbc7e60c,0x001ce83ec8ec6417,0x004efc3a3ca30fb7,0x0034b3496b061d4f)},
+  {FIELD_LITERAL(0x00ed0bf92447b50d,0x009921c7f4ae2f40,0x00d30b0bcec088ab,0x0013c19abeceeb0c,0x0036a5a3bf9de725,0x0086e08f800f9fd1,0x00e823976057511a,0x00213d49ec0584f7)},
+  {FIELD_LITERAL(0x008ceacf9cbd0ecb,0x00ca7ba1f8e7c218,0x0076b1654572dd45,0x00b23572196124a4,0x00b5b32a24a9022b,0x00d6dbcebab5f01a,0x00cb1169d4e9d51b,0x00e309a1738e8558)},
+  {FIELD_LITERAL(0x00aa27340b22cc6a,0x0085587ab0dd0aa0,0x000ebbf2f5a4a33b,0x00d2dd91ad0a7dd5,0x005c93784b6a7bf6,0x00e46ca9b7ffbdff,0x00ad07164b535d4c,0x00f02da2e632c6a3)},
+  {FIELD_LITERAL(0x000ca8e39ebad778,0x0002462b830021cc,0x0055742347eeafc9,0x005310d302ce6501,0x00d32c076e26c2c4,0x008e8ea4ed9abe8d,0x0023e30349519119,0x005b87d614368637)},
+  {FIELD_LITERAL(0x00eec2bd0cbe3cd9,0x00337d37b338cf77,0x00b9be43274f4357,0x00bdecc88b34ec96,0x00e6b8aabef38d2a,0x00968603e39416bc,0x0086507ec01ede4a,0x002dd9e9a9eb7b6d)},
+  {FIELD_LITERAL(0x003ea4404ef57695,0x003525f3b4cf4b22,0x00217665dc266ab7,0x00f2269648c92116,0x002d13c12401b4ef,0x0063eb8aa6808625,0x005807a22d686f2b,0x00903ec15b2b04e1)},
+  {FIELD_LITERAL(0x0004f7298a80d047,0x00991d44534b634c,0x000d81a3a5c74f15,0x00f67589d74ca2c8,0x00085e3e42bd82e9,0x00fd78dcf7a6ab4c,0x00bdef13062bd8cf,0x00c01467569c6edf)},
+  {FIELD_LITERAL(0x00a555b222328299,0x0048097a2519ab8b,0x00fe887782634184,0x0018b78575661b0c,0x00dd8c7d5620079c,0x00dd6012b54a5fe8,0x00ee99a306f9aa99,0x00c8dd798e3f7732)},
+  {FIELD_LITERAL(0x00b842a923f27f58,0x00fea6fd3a49be5d,0x00dcd282e1fb2197,0x00741c7f66f2c06a,0x00dee6489a1f3458,0x008f004bbe3b0c9e,0x0043251577765388,0x00e479043ca09a6d)},
+  {FIELD_LITERAL(0x00ea17bf2e2e99cf,0x001ef42fed35f84b,0x00599a8f93fbb0b2,0x004ee645a4d81d7d,0x00b150d72afb25ef,0x00eceea2f136a0ee,0x00b0545f3f7a80ad,0x00ac883f7d1e5ee6)},
+  {FIELD_LITERAL(0x000e2eccb07e984d,0x00350d59d1452bdb,0x005ba11a13156276,0x007896a37c5f55b7,0x0091da33dcf80d28,0x009d3945dc484a8e,0x00695fd5ee03ffea,0x002c7545d41b2f19)},
+  {FIELD_LITERAL(0x0077b7401cbc4ade,0x006db7192153f06e,0x001312a58fba0ae6,0x0016f86193eedddc,0x00216f36b1d60e66,0x00a50c82ed271ffe,0x00a83bdb6e2474b5,0x0067a2add21fdc35)},
+  {FIELD_LITERAL(0x00acaee1bc67ee6a,0x00168617096c51ba,0x00b23544a9c2ace4,0x005ac06d8379ca92,0x00088f1f263e8357,0x00b9bfdd8c99202d,0x00c1a2503a35e23d,0x00d8dda22b17602d)},
+  {FIELD_LITERAL(0x007bf0c76b92a1a1,0x004b4224c10e1da4,0x00ca24041c4aad12,0x00395b49e05ef3e3,0x00e4b911708da2df,0x00c4b0b886417fed,0x00559c1d99be92ae,0x00c1d03d1082e421)},
+  {FIELD_LITERAL(0x00c2207825e96103,0x00c58c75b10694cf,0x00fc05180ad81614,0x0095f976a33827dc,0x00fe3d93ad2ab7d3,0x004ce8ffcd9482f3,0x0091ebb22629effb,0x0032b028402acda3)},
+  {FIELD_LITERAL(0x0014c227876f2cc7,0x00828b04fb691668,0x0011da80089e407f,0x00bb7938a807e85a,0x00cf99fd037ac26d,0x00e64e3c66d7946a,0x0057dc4045578797,0x003957a04ac21e6b)},
+  {FIELD_LITERAL(0x0023100ef4418dc3,0x00d9f08764c3e9e7,0x00af2dae38616a56,0x0097b2557646c682,0x001e6ce6ca710c16,0x0056c18a8ce442d4,0x00124fcd9c5b46ca,0x00f2db4c52d3e6ef)},
+  {FIELD_LITERAL(0x00cbd08104022282,0x00d6455ea52c6b4b,0x0077c13793e3f2b4,0x0097fb72c037c5c5,0x00e27dbdf63b7def,0x00faffbf70bc09b7,0x006ab38ba72f78b4,0x00f6feeba1766cc1)},
+  {FIELD_LITERAL(0x004ad0fcbc8f4bb9,0x001975e9d1e7af48,0x00dc145ac61f0e2f,0x0054b53fe711566c,0x002f32ae087e9c22,0x00d1b68c9b72afbd,0x00063cecc9cc4a0f,0x00bb1d37ecb7fd47)},
+  {FIELD_LITERAL(0x00b46ca906e791b0,0x0037af90bd734945,0x009624c326dc51af,0x0071c825ab7a70c4,0x007bcdb4d8eeca56,0x006114ed6bd3374d,0x00c3faa26d292b6a,0x00069f1d11befdf0)},
+  {FIELD_LITERAL(0x00dcd7e37c412dd4,0x00922d3d89eaeaf4,0x001772cb985c2f3a,0x009954aec213fe10,0x009a83485119d3f9,0x005157f5030940ea,0x00e9dd285202ea02,0x007153fce47b80f9)},
+  {FIELD_LITERAL(0x00903e77d6e1260a,0x00614580c99aa44b,0x002a395748328dbf,0x002973d18bc2878d,0x004c4ac97469e07b,0x0085dd5630375f6b,0x00998d4a029655f5,0x00201a37fc548c59)},
+  {FIELD_LITERAL(0x0071c31135116c0f,0x006fd2400eabb69a,0x00f45d3de5223cdd,0x006e17ac25e59472,0x0077ef4388f33ac2,0x00ccd9a9b15c5b61,0x0026ae0d5acb20c4,0x005015a3817abf04)},
+  {FIELD_LITERAL(0x00403ca646475eec,0x0039003598f0e345,0x00a572ab77153d2b,0x00bd95848fcda7fa,0x00356ab64a54ca1e,0x00a43cf5828aa3ae,0x00bbba8e3da30470,0x00b28c4f0db404a5)},
+  {FIELD_LITERAL(0x002a2032d4d0c6b0,0x0067c2925f240cb9,0x003751bda9460f9f,0x006612a1d531db17,0x00e93a9513e6992c,0x007f7af1a7ac4a76,0x006a66f704ba8a25,0x0063f080544c7f81)},
+  {FIELD_LITERAL(0x0088b22257cadf8c,0x0001620ec9b6680d,0x00427bd468547206,0x003ec12f463a7805,0x0046706ab2e86a6c,0x00ca6672bdc1ea19,0x00b91de1d0c00a48,0x00cdbf961ff5cc8a)},
+  {FIELD_LITERAL(0x00059d54e09e90c0,0x009ca699d8f06af8,0x00d066042374f931,0x0023f57594c72ecb,0x00a3cea54b00ada9,0x006e85d3bf301d64,0x0064f72838f28a65,0x001389c254c1085a)},
+  {FIELD_LITERAL(0x006ef816ae9d9513,0x00c59fea18afa49d,0x006942a6d3f9dc43,0x00f79d28273c3329,0x00cd9d50f4d2ffb8,0x004c21c3890ec897,0x000a9dcc785c1f7b,0x00bd1f5227f1b60d)},
+  {FIELD_LITERAL(0x00e7522830cd1cec,0x00767f8b26f3ede3,0x003b793ad3558cdc,0x00b0945c19a3b1bc,0x0038a900316beea1,0x00032613c7ba78d6,0x008c40f27ab711d7,0x008685b6907e6ca8)},
+  {FIELD_LITERAL(0x00155d029c8bfc13,0x006944b5be202724,0x000cbb3822abfee6,0x00b2d0f9b6ca20cc,0x0044eed1e2e69ec6,0x00dea7ccd3ea7235,0x0097f5329a2e17ea,0x008d372309fd0c1c)},
+  {FIELD_LITERAL(0x0012e9c5afd969c7,0x004ad53b7a096029,0x00b45c949d9615ca,0x00ac1ee1abbed915,0x00347f9545de3405,0x00a8d7dbe5884d62,0x0011ccba6f8e4707,0x007a8aab33e478c1)},
+  {FIELD_LITERAL(0x0067206f664d604e,0x00d9d59374def0f0,0x00df8801b195df06,0x00dc2a3da9b8a34c,0x00fd23b454a41b7b,0x009ef8acf2ca8b90,0x0022ec334196a3b8,0x00ea0bb130567a72)},
+  {FIELD_LITERAL(0x006e47c761afec1f,0x004e2e244a600e73,0x00383092c0cd6398,0x00c9ea57120ff980,0x00b078664be8112e,0x00737922e93bc761,0x0090b3833329d05f,0x00ac9fdc7fe5de4a)},
+  {FIELD_LITERAL(0x00dac0ced08cd420,0x004e9d496b7e90a6,0x0079a81fe8110a77,0x009c18601f6dea09,0x00fabe3ad558e335,0x000b9c2dd7133735,0x0094a3a291223d6b,0x00e6a13af58a579b)},
+  {FIELD_LITERAL(0x0042095e6fa87c92,0x00702158e1b2bbd9,0x0097ffa434ab0f3c,0x0054b668a0283228,0x00d6f540e63c1162,0x0046a293ff7f12c5,0x005cd4297c131fde,0x00f6fba0264eff8a)},
+  {FIELD_LITERAL(0x0022e6b09563dcd5,0x00cee4a14901dc40,0x003fdc27d0dac8bf,0x0082d90d312a0567,0x00cdfec8cd3e272a,0x0062965fa6b62b3e,0x000319d7f627d044,0x001208f28b3d21bf)},
+  {FIELD_LITERAL(0x00186ad53f0d8032,0x009bf66bff1954c6,0x00cb5dce2a0a65f5,0x00eb3c106db233d1,0x00a01d7ed2ea2d93,0x00bdbc1da3758981,0x009d3bb39c9183db,0x00884204f44cf3e2)},
+  {FIELD_LITERAL(0x0010bcdefd3896fe,0x00f6c33699dbef0b,0x00d3c5c92f2c1876,0x00c7518305b7e404,0x00e780462308e3b8,0x003b6107da071653,0x00213aad4d518133,0x008ce45953fa4084)},
+  {FIELD_LITERAL(0x0053259052991231,0x00c8fdef43c191aa,0x0060f494bbc21487,0x0039310b33af6996,0x00774b8ef8aca111,0x00c8c5c1267a91fc,0x00fe1e62b1fd3aaa,0x00e9347a2ab17772)},
+  {FIELD_LITERAL(0x00cb8bb6cca46152,0x008bec0c728d2a93,0x00e937973213a35c,0x0018137caa9b0de4,0x00a78b8f623cb5d3,0x00e7a7f717bbd200,0x00500c27a9869d25,0x007a2b614d833f32)},
+  {FIELD_LITERAL(0x00519712ab060746,0x003c57d75f74f95b,0x00e38027523689c6,0x0065cfbee1c233f1,0x006b16dd80028b68,0x00110096587ab1a1,0x001b7f1e37970b85,0x00c8b025c44f27c4)},
+  {FIELD_LITERAL(0x0070784659226e39,0x00d44a4d48368069,0x0044941a9bf927cb,0x000c80e14f56bea9,0x00dce173f0bb1132,0x00dc1ca9050deffa,0x00d74ed1875d52c3,0x00d19c1b04985418)},
+  {FIELD_LITERAL(0x00b0e20da9ea092b,0x004df1f159df05db,0x004f3c7c837dcc05,0x00097c3069cfb5fc,0x00bcbd270a208505,0x007df20c5656c3b3,0x006a671e80de00bd,0x00f7b233d656a195)},
+  {FIELD_LITERAL(0x0097b8bbd4584ba6,0x005fc08e012e3516,0x008490dfc757e13f,0x008346d631dc9495,0x00d5dd8f83fb6b37,0x0059a111c7365aaf,0x00eb2d63c278040c,0x00281353612d9275)},
+  {FIELD_LITERAL(0x002fe76502b2d1e4,0x00c863556dd4f518,0x008720a08c42119d,0x0088ea745284df13,0x0028a7e287f4fe23,0x00ca09c5a985a3a2,0x0066e9325101ea9d,0x0028cfbbe21e4dd6)},
+  {FIELD_LITERAL(0x001784f956117711,0x005b3de51ec71604,0x005b08f6ab758b42,0x00b5fcdc6c2966a1,0x00f4bab9e33f6877,0x00945100d5820292,0x006ffc6a25c059dc,0x000f239f568264fd)},
+  {FIELD_LITERAL(0x00f20d41458528c8,0x0072775442ab3bc3,0x001bdb7b4d58801e,0x00d27cf53d6a27e4,0x009072dc0dfb3f9e,0x00b00e2e5056f803,0x00e94913b50393c6,0x00e5a631fdce296c)},
+  {FIELD_LITERAL(0x009b0002e52d13db,0x0045c18cd76b1ba7,0x00dc4a5a54f05fe4,0x000e8642af504795,0x007100245d5e9614,0x008f16ca9cb7df20,0x007e724dd6d2de87,0x002c03d48592dcaa)},
+  {FIELD_LITERAL(0x00a8286af87ca005,0x0032733e68e27139,0x001211a8dd025902,0x00319d5f64e3655b,0x00cc1c729c9d16d4,0x0062f113f91725bc,0x00f26ef12129a5c0,0x00122ce5a766b6c9)},
+  {FIELD_LITERAL(0x009747aa38f7c3ff,0x00101a100a735dc5,0x00a1a46ea2411fcb,0x00f60ae6204f3736,0x00cb04adc39ad58a,0x00668bff79ee9023,0x00565a89a0bab3d9,0x0068b1a0796a2ae5)},
+  {FIELD_LITERAL(0x00116ab8c946abff,0x0010debd27f10ec1,0x0066d4b465b7492d,0x00aa0eebc751dd96,0x007a6f00a85ae9b6,0x009217a668288372,0x0023656379487b47,0x0027799d2d378d04)},
+  {FIELD_LITERAL(0x00688b1571479bbd,0x00134a9adc734146,0x00430bb9049c5e81,0x0043ae3eceb97f24,0x00241083f237a620,0x00c0f2955f774a37,0x00f1abc76c8cdae0,0x00f3028a2a59821d)},
+  {FIELD_LITERAL(0x00f45787b3927746,0x00efe5b4fffd7e00,0x00c188ec8cc8c3ce,0x00b3f73c535eae66,0x00dfd87e69b38040,0x0024a7b397fc1a03,0x0078730bc34151e3,0x00536072006d7aff)},
+  {FIELD_LITERAL(0x00a42c6cb10c8465,0x0016a892ffcdbd51,0x0001911bcd3481e1,0x0049ef36df15ee7b,0x00d1b9a1d9e49e36,0x00341467e6e94665,0x001db1a44511b8bb,0x000f312caca612f2)},
+  {FIELD_LITERAL(0x003f8fff7f554970,0x00559ad3577fdd30,0x00a3a9d4943ff9f5,0x00a3bf9744c6675d,0x00205f83d86ed6a7,0x007cdfb3230b4b6c,0x00d3bf156ed7cf8d,0x007b05a36968e3dd)},
+  {FIELD_LITERAL(0x00dc4c704c8b86c8,0x0077ce00e27da58c,0x0032f87fec53f291,0x00f5920ec0cbd4bf,0x0039766951a3ac5a,0x0042555f89187142,0x00dbc52e16e6aa0f,0x0007e024808115ff)},
+  {FIELD_LITERAL(0x006c94e42ca40060,0x000fd785ef353f72,0x00180904d21bd56a,0x003430f405d2058f,0x00c3f3f2f0872625,0x0024ea58b464015b,0x0064173a4d9b54bd,0x006c365554a4f672)},
+  {FIELD_LITERAL(0x001022df222a4dd9,0x00f406656d03f6c6,0x008b13859813eda2,0x007211093b34f532,0x00654c8aac6e14d5,0x00080d5745d439c7,0x0059087693ced263,0x002d219822a96ba5)},
+  {FIELD_LITERAL(0x00a396c673eee92b,0x00085b97e1c114aa,0x002dc56bfb9ec253,0x00930623ee1b7d65,0x004a3a82fe5e24ee,0x00b2592b2dcb290b,0x00fa38c87b43e0f7,0x00c4e8c376abeb74)},
+  {FIELD_LITERAL(0x00f7eb79a0de6c2e,0x0092e5716540317d,0x0089c38b04533eda,0x008dca4bc8775497,0x00dc39f8cabce307,0x00457e84fc0a4dbf,0x003d2a247fa179a0,0x00601b7c4afac880)},
+  {FIELD_LITERAL(0x00fd25e88809878a,0x00d8414c5342ddd4,0x0059140b4816c4f5,0x004f8b0fbdd4994b,0x009198a439b86eae,0x00f7f5cb3137f2d7,0x0082515f7168b05b,0x00f1421f96735a1b)},
+  {FIELD_LITERAL(0x00e9eb626d34b1ab,0x007072514a6c67b1,0x0026bb768c163e28,0x00d3245fb3038aab,0x00bb257fea741cfe,0x0054b4895392e8ef,0x00eb303f719b7c3f,0x0043574e2256489d)},
+  {FIELD_LITERAL(0x0040963b962cd943,0x00dda92456514346,0x00a3eb085247ebbf,0x00af364160a4c718,0x00877014b25f34b5,0x0046a1b20d6e4bb9,0x00efe2f8618f632f,0x00bde62025d4fe46)},
+  {FIELD_LITERAL(0x00c08c920d42384f,0x00fe0645d493f872,0x008739394e385bff,0x00fe8fcd572d37db,0x0049250ec81d2fdb,0x00b04005b6dff776,0x006d8c4d42bfbd1f,0x00f384f463585bc4)},
+  {FIELD_LITERAL(0x007a8f36049115cf,0x00a3ae9db57759b5,0x0069d18d101d380c,0x00691f1e3fa9b04b,0x00de3adcd6a00d13,0x000fd50100432967,0x002a59408a767515,0x00ae9215c9ddf9aa)},
+  {FIELD_LITERAL(0x00e1ffb69b1f24b7,0x0018592f5eaa57cd,0x002df2beb8b0fa93,0x0086835f22a164a4,0x00b7db0b6c3c9c2b,0x0082cc08524821b2,0x0054a77e6251f128,0x00bbf8ebe1eba84b)},
+  {FIELD_LITERAL(0x0023cdd6dbbddf78,0x007ae420fdd83707,0x00cbd314c4c396bc,0x005e074ba6cdd22d,0x00770daca26c1db1,0x00922247470cb6ba,0x00214ccf0f0f4d63,0x0080ac50faf3f4a0)},
+  {FIELD_LITERAL(0x00afae1afce62eb0,0x00541b884c5b29aa,0x00b5ed978736ffbf,0x006efeb2da78b77e,0x00057941bb9a805c,0x00750461b25e56f0,0x00b790aca260c8ff,0x00348d07d2db3c9d)},
+  {FIELD_LITERAL(0x00c794452b7912ec,0x002cacddbb6dc442,0x00bc58e8dc3d3b0a,0x00b49af429cb0172,0x001cb32e518951b5,0x00eb803e9c441730,0x008997473c9856e7,0x008e84b130ed25d1)},
+  {FIELD_LITERAL(0x00820155a0b54407,0x00c146eb4509cc03,0x00d85f98e0b13dd1,0x0047707eae8c4252,0x00c62621760617f2,0x00a93ca522732b1d,0x00bcff9af763e7a6,0x00d2d7c772ff3179)},
+  {FIELD_LITERAL(0x001ae5b8b0799e44,0x002013224c743c16,0x0033cb4fbb637e71,0x00e228d9a9cecb37,0x000e5beefd9d79e2,0x00a720d2318a42f5,0x00f26a23c85c10e0,0x009c9aaa4f206714)},
+  {FIELD_LITERAL(0x0001d879515491b9,0x00bec74e24f8c321,0x005fadcbcfa4f9f6,0x008c18232542bc62,0x00911afeb0ac0775,0x00d218e32a6cc8be,0x002124088cf7a40c,0x0060f333bd702777)},
+  {FIELD_LITERAL(0x00d4a56c3ae939e4,0x00ae31bdaac85455,0x000f8817692bb2af,0x0028d4ac91061aaf,0x00191ab10a12078e,0x00e355d1f4de9cdd,0x00352dcd7466a81f,0x0065174d63494dd2)},
+  {FIELD_LITERAL(0x00e982c12a6993c5,0x00547d237763bdf9,0x008aeda68c02b158,0x00fb7c638b4d2eea,0x00be947342e248f8,0x00fb8427e8fdb5ca,0x006a3823c73aa16b,0x00979d489dab1912)},
+  {FIELD_LITERAL(0x00cb5b1a539e1a79,0x000b56185f161530,0x00612143924e88dd,0x00f266d234cd3fbc,0x00c0832e56f61274,0x003ffec1d81e5eb2,0x00f9f94679637a82,0x00c713841d11c028)},
+  {FIELD_LITERAL(0x007bf538e15112e6,0x00072863e4c46575,0x0037cb0dde66c073,0x00bd616a57151eb9,0x00ea4f05436bf0e2,0x00a8e804916545ba,0x00ceb409a4345605,0x009d0e5ffb982634)},
+  {FIELD_LITERAL(0x0091bb3f1db300cc,0x0027ce34eadf7500,0x0007ba31ab38a692,0x00d7d025f508a51d,0x003eff730f428bad,0x00a3a25959d512cd,0x00ad7a8d41b636ee,0x009b948c29cd83c4)},
+  {FIELD_LITERAL(0x004695fe06262ce2,0x00708c9936847736,0x0073433d15e36e24,0x00d388747e2ca95d,0x00fc87f15143684a,0x00037190276f8b54,0x00d0c462b42b3f60,0x001e15b5d592751a)},
+  {FIELD_LITERAL(0x005c360c9ec926fb,0x00b38b8f8fc77798,0x00ff9c4ede07a46e,0x00e342dde52a79c6,0x00a67a28941e4945,0x0017f178d72afce8,0x00a8b201f09f6639,0x0000cec291abd19b)},
+  {FIELD_LITERAL(0x0078c6c216af9197,0x004c2d3909eb218f,0x004ad00fd6e6859c,0x00245330bffb188f,0x00d2ab74b8e5bd1e,0x004b85effab23517,0x00cf168d52fbac7d,0x0086c9563f3eab4e)},
+  {FIELD_LITERAL(0x00d9c76cfd4d304a,0x00ff5ad9f9445b02,0x00510a92c389d2da,0x0051927866d97843,0x004f50c8c8f73ed4,0x00500af7661e0ac5,0x000fea6bf5628f0c,0x0042655f1167fb64)},
+  {FIELD_LITERAL(0x002ae1a3fa6cf5f2,0x00c88fab26f0cd80,0x005e7c0ad29a9176,0x00d6265d21c3e65a,0x00a68d706eb5ec94,0x002aa725fd008b7b,0x00c4ba6bc7965d79,0x00885ed1092bcbc5)},
+  {FIELD_LITERAL(0x00c3d4928d096d2b,0x00d9e69b9d4c4b7e,0x00402d32b7f14c0d,0x00e951a611a43584,0x00e50a805153c02f,0x0044246171d40671,0x0028aeaa0f1dfb71,0x00b2d8f73d5aed85)},
+  {FIELD_LITERAL(0x008b7f2dc915aa8b,0x00ac1da9d8196285,0x000edcea4cceea71,0x00d2c34b83d47dd8,0x00d0b793858299ca,0x006e659ea9dcd2dc,0x00152a0a4210573e,0x00cfaea2a35245b2)},
+  {FIELD_LITERAL(0x002748dc5b83db3e,0x00153bf38e29bfdd,0x003c4dbd3db0a9c2,0x003338617c6046a4,0x00860ed2d45d14e1,0x007fb0bf1c2a560c,0x00b71b79b93e8092,0x00fd3788a81f4d2f)},
+  {FIELD_LITERAL(0x004f8fac56202e76,0x0022c1614ba605e1,0x0061dcf143a8035d,0x0075654783ced214,0x0066701b647a3365,0x00b6313199267acc,0x00e44813011eca63,0x0086b06a9d201e0b)},
+  {FIELD_LITERAL(0x00db73b00d9d2fa3,0x00dfeeebda45cfb9,0x0011c2cc1c88325f,0x00d0e670fed3996e,0x00ab1ec65e73dc34,0x001144c008e790a9,0x00a08dfd9fe3e033,0x006be83b6dcec020)},
+  {FIELD_LITERAL(0x00095dff0a3f71be,0x005f9341b664ebee,0x005b1856a7b3957b,0x0093f522647f9eb2,0x007056b15ceb5a28,0x006eaae0b47ee71f,0x00c69fd5b49beb92,0x0083757b9ffb4580)},
+  {FIELD_LITERAL(0x00080adfaea4f6b9,0x00ca6dd9b6713b2a,0x008c135e07c20883,0x00de204971fc45c4,0x006a4e9094a9bd92,0x000b73d5e8f8702e,0x006390dfb33daaea,0x004c03e94e4d7480)},
+  {FIELD_LITERAL(0x00e1844851672912,0x008b2f012db56553,0x00cd339cc8b408db,0x001379a3ffb80d77,0x0058d65739284fab,0x00d03b5ef466d145,0x00d5d78d5bc12564,0x001156388880d555)},
+  {FIELD_LITERAL(0x00659ed00bf27741,0x006d84b93bcbe54b,0x0076c983986759a6,0x003942430b12f22b,0x00a79f66d1d1b6f6,0x0015d521d9c84a05,0x0018e4dafe59287e,0x00a3951d5683062f)},
+  {FIELD_LITERAL(0x00af7c61f8ec7789,0x00e9dc486b7baf28,0x000725bb4b990ac4,0x009b9a4936207e43,0x00aacabd16842e54,0x008fbfc12570d6a5,0x002b8d3ad1fa604b,0x0095ae64bd0c36ae)},
+  {FIELD_LITERAL(0x00e5c2a7b6f7acf3,0x0007f34fc69e0b36,0x00ce0604a8baf586,0x0088432e95d3a306,0x001301cb5e6eb3a5,0x00391f0ac8e83a9c,0x0082971f41443359,0x009f67f413581f31)},
+  {FIELD_LITERAL(0x00b59fc6f3d83e44,0x0020f7a0723daee2,0x00c381f003fd7d77,0x0097bcfe4ffbc75d,0x0082ea522532897d,0x00795a88ca1b3bac,0x008022ea9c5375a8,0x0076997be8879508)},
+  {FIELD_LITERAL(0x008d41ccb70ff5ec,0x0014ad976aa9e3ba,0x00dc5460d60b4f05,0x00e9607f51f93089,0x0055f510f502a6de,0x003477a4db797f70,0x001f09a17d4ba6ca,0x00c0fa739632eb2c)},
+  {FIELD_LITERAL(0x007c376f7dde01e8,0x0055a20c534fc9c6,0x005928e493685bff,0x00c91b6f3fb47b1f,0x00daa6e9b8af6a13,0x0076dc35a6ecd0bf,0x00eb82864c87a3d5,0x0073bc278c440364)},
+  {FIELD_LITERAL(0x0040e1345546298c,0x003731caa0fa34b1,0x0013822cbea96a55,0x00dc24391dd352f6,0x00f0b2001786a974,0x0071dd30e1a5d131,0x00193e8e654d8153,0x001e9a1b2d74a0c1)},
+  {FIELD_LITERAL(0x008287eafefc0ac5,0x003e9fd8be6577af,0x002a4f4f2cabbd03,0x00d644fa6b1db0bc,0x00671b65b1ea4019,0x00848d703d38efd5,0x00b6ba6d934d44b1,0x00734f75824134a4)},
+  {FIELD_LITERAL(0x00a6aa86efd8d3c8,0x003fceeca9acd8b1,0x00e81ab00e6f15f8,0x00e21cfa38535ca2,0x000c75fa35cc99e9,0x002106b20b6094d9,0x00b46d7ee950d5d8,0x00309c094b1e27d6)},
+  {FIELD_LITERAL(0x00d41dc141bfadde,0x0077fdcd23bbba32,0x00de1e698c1e0ee2,0x002281189ed34ad7,0x009df4bc0e510b91,0x00756ebb7dac7f1d,0x005e8a7f3fd06af1,0x0085c7fd200a122b)},
+  {FIELD_LITERAL(0x007cdc81c9f5dcf8,0x00f3398511640c78,0x00e550d2aa9bad1d,0x00876c01a1cea453,0x00182480c584060a,0x005186507a70242c,0x00d4e0d501cc0631,0x00eda96dd09ae0af)},
+  {FIELD_LITERAL(0x0051bba7bc8b377a,0x008beb4f60c6ec23,0x00cc9116a22748aa,0x00106c4a3959590d,0x00f3d468abda8158,0x00789641663dc85f,0x000374b2903bd31a,0x00b13db47117f8cb)},
+  {FIELD_LITERAL(0x002de8ae90cbcd7c,0x00230c50d1740187,0x0070ea31bf38a2f8,0x00dabf219fa450e9,0x00c3163fda34256a,0x00e24efa987c40d0,0x00037a09c23e9c19,0x00c8bd617dc94593)},
+  {FIELD_LITERAL(0x007b587a24b3dbbe,0x0045521e0f0f0ce1,0x009e867080ef8948,0x000c59196f95f8b4,0x004d4612faf6853c,0x00462b03c7715889,0x009a12f7b731a3d4,0x008e49f10546135d)},
+  {FIELD_LITERAL(0x004e7fb297e4d4db,0x00cffbec6092aa44,0x00754feb16686505,0x005dfd4df871b4c7,0x00659c420a92cc86,0x00f6b7335ffb91ae,0x00216520a2aa3835,0x00f9cecfebda27c9)},
+  {FIELD_LITERAL(0x00912146ea46ac41,0x003a430e6d7092c4,0x0034e1a9ab4580fd,0x00191dfe2447a345,0x009c1aa2bc818b19,0x00b3ca4bf7a12777,0x004a4ec0cce3e817,0x002bc85381090dab)},
+  {FIELD_LITERAL(0x00ee44969f7fad31,0x009e9e6bf8c83859,0x00762fbd986e7b35,0x00caec2f3a0028ed,0x005ca71ba1fff2a7,0x004b6ab875274a15,0x00b96760e9244215,0x0095c5775c872968)},
+  {FIELD_LITERAL(0x0094b97f40ecd81f,0x007affb30e7b552b,0x00001c91fb1d85f9,0x00fbe0a7594f3291,0x006891cc641cc71a,0x00b5a5c9ebaa72b7,0x0075b4c5825b154f,0x00b06535dc435469)},
+  {FIELD_LITERAL(0x009f1f436fb09873,0x0014d13b7c937123,0x00374fc8e6099db1,0x00bb1682526b2052,0x004a2426fa4253ab,0x00b8849ed62145c0,0x000d463a26f48ce8,0x001dca45d2ef9872)},
+  {FIELD_LITERAL(0x0011196cad5cd667,0x0013e7ecc97487f7,0x000ebb3b7b2daad0,0x00f4a8f150344714,0x0067382e7ab1c824,0x0059eac70581f128,0x00eb513d1e4eb491,0x00150880b4532f3b)},
+  {FIELD_LITERAL(0x007adce2adc2d8dd,0x0046fc2453ac97c3,0x0080fc6d8eab1315,0x00133fba2c6df9c3,0x00d759b0aa982b84,0x0034a27eb387c2f4,0x0035972de775d61b,0x00da8c610127cf1c)},
+  {FIELD_LITERAL(0x0084f300a0c3319d,0x003e9619471a3a4b,0x001c48dc6b5c8e9f,0x00307f80a85ffd00,0x000be40a00e9fac0,0x00fe22b9dc46fc0f,0x005deaec6fb12edf,0x007283be327aaf43)},
+  {FIELD_LITERAL(0x00c062cb693c92bb,0x00e29a76070c195d,0x0095c42dd47c84b9,0x00f9a37f853faa7a,0x00694521c2f576b0,0x00fbbe1474c3225b,0x005261d28b82cda5,0x006e157067dea4af)},
+  {FIELD_LITERAL(0x0002aae25b4fc954,0x00d264bfa674b15e,0x002dddc9294f6d23,0x004ea862160c3ed1,0x008022d5b339e29c,0x007859b983ba48d0,0x000a01404bba116d,0x00e68bce39b27b2f)},
+  {FIELD_LITERAL(0x009114d1daef1f47,0x001bca13282d76dd,0x00acf704efddd511,0x00ae8cc2ee198883,0x00f69d0e494a384f,0x0034015ac10f7081,0x0007d6c9dc0f4b67,0x004548a8ef7bd8ff)},
+  {FIELD_LITERAL(0x002c24360e940891,0x00f58c00aaf559e2,0x00d23ba4b87916f7,0x001cb17f66c28553,0x0002053f09d6ab66,0x0073c51fb5f34132,0x005c53f71a4dff05,0x00fc5942d47205db)},
+  {FIELD_LITERAL(0x00ff950eb7cdfac2,0x004024dba75d3787,0x00c53bd84feff0fb,0x0078ac8b8ebd0428,0x000c5320302dde2a,0x00639cc6cbfa30a7,0x006440eea46f62aa,0x00559e9b8eea1b27)},
+  {FIELD_LITERAL(0x00805eaf273b0f88,0x0056ac8a5b113f7f,0x0088b19fa44c3b9e,0x006fb446efca53db,0x00c273a0e202d80b,0x00e68c381b16e980,0x0036b2e479a43817,0x002cb49b3bd0dbb3)},
+  {FIELD_LITERAL(0x000937ee7a8997c5,0x003e3a5de4b7cccb,0x00ca209829b309d4,0x009b21117202f3ff,0x0069c66e7fe40ae0,0x0088c5324b3e01ca,0x00f28d3c71bde1c9,0x00bdd71bdd1d0795)},
+  {FIELD_LITERAL(0x00df1cea24c57c82,0x0084afaa0dd3d6c7,0x001882e59ab63737,0x002f25f3bd0b5d73,0x0078280c96d42ee7,0x00be917e4580da15,0x004211d777c82754,0x00b11c5b9dc43a0e)},
+  {FIELD_LITERAL(0x00cd3635ab57368d,0x00a97ca195787199,0x00fb9670ab19bfcf,0x00735ac926ad796c,0x00cafc46d6f4de43,0x00c2b7c9765c449e,0x008f2743ec3e306c,0x00852004ba5a792a)},
+  {FIELD_LITERAL(0x00498ada0a1ea13a,0x006b7439e3d14638,0x0016e2a1622c7a0b,0x00b5b9b8440f6090,0x00b6b8b1cf960b39,0x0055b9d92e0cb697,0x0028fbab0de2ee36,0x00cd84aaab444457)},
+  {FIELD_LITERAL(0x009876bdf5539eb0,0x00cb7ca28457cb62,0x004865ec16fa447c,0x00bb030d7c9228be,0x0086f7d200e2d9c9,0x006d67903a535d3d,0x00d50818368a9f40,0x00a3935a0f3c9a4d)},
+  {FIELD_LITERAL(0x00f2eac9a95b47c5,0x00080193f2618087,0x00c21531086013e2,0x006f8aac5088e97e,0x00b449da0ad996ea,0x008250b805d8b58d,0x00022492c2669192,0x00f0c65b17510819)},
+  {FIELD_LITERAL(0x009e78ab5c3fe61d,0x00fbb3172351cf7b,0x00edc6c8bd5e9865,0x00f9fb2c502ee45b,0x00ec4fa7a2cbe7b3,0x004cc349c9531ba7,0x00f1a557a42d7b0e,0x005a604c619bf458)},
+  {FIELD_LITERAL(0x007e22ba9c863c58,0x0054cafe498c63d3,0x00dd2bbff7848dd8,0x0008854f7d8353dd,0x0015cc140f7d5f7d,0x00721f4f0f93aecc,0x005b31eab8754c09,0x0079f33094c64785)},
+  {FIELD_LITERAL(0x00332029bf1a191e,0x007b91fd86e82564,0x00848481bbd64f2b,0x0069f792d5830e23,0x0023769bc2cefa89,0x00208125977dac10,0x006294aed79cff74,0x00990ef05ca95f0b)},
+  {FIELD_LITERAL(0x000636b24e32c725,0x0044e068b98f7455,0x007b368b5bd3e0e2,0x00ebc252f10d7d9a,0x0012998113db3987,0x004feb02b6bd764b,0x00f95fac284bd108,0x0022ba1b94c64b45)},
+  {FIELD_LITERAL(0x00bf3ba94e487894,0x00f09fe3f611e510,0x0085c7023ae388ab,0x0085cb91de61cb0a,0x0025ca636a4b4b49,0x00ebd96d6957277b,0x00f3a6a8f8b4f49f,0x005e2065f3ea0ed3)},
+  {FIELD_LITERAL(0x00bf9a226c325a67,0x0008d63bd91c9cd3,0x0026fb62ab0b072f,0x00301ceb2bb80486,0x00ed567ade7dff5a,0x007d978c4de6f8ce,0x0033de115e42d6d8,0x00f04ca3d19f0f33)},
+  {FIELD_LITERAL(0x00f7d6033dc8c58d,0x002db91badb84a01,0x008c3365b4fde70b,0x004be120a63bfcb7,0x001e734efec24122,0x00aef3aab66f6013,0x00bc127df4360734,0x00853610c8c0527c)},
+  {FIELD_LITERAL(0x003715f0d4d358ef,0x00f5933e2b305334,0x0007989de96a13a0,0x00a00993db8ed470,0x00c4ee0febdb06d1,0x00d2ea605102a7c8,0x0034dbf0507075e4,0x0057f2a989bf638b)},
+  {FIELD_LITERAL(0x00549656bfa55577,0x00bd379b32091f29,0x0032d2e62d34b2bf,0x0055eac2635204de,0x00c759fe91ae0cbe,0x00d5edb37ab13d7d,0x00b91ff21a041d2c,0x0018e4eb457b7022)},
+  {FIELD_LITERAL(0x00e0638cdf0e3fd2,0x001574256261e22e,0x00bd8a317d1e29bf,0x00cd404cc36b5a4a,0x001fea417aab20f9,0x00a526bd5cd66bbb,0x00f2ac729b75437d,0x0053343321c7943d)},
+  {FIELD_LITERAL(0x00e3fc043810caea,0x00c3e246c31103f7,0x00469a2cdc52f3da,0x0085f6cbb490cc46,0x0019e9fe244c2fd3,0x0087655e89139b94,0x00d96197d7c3ff85,0x00819aaaa3af84f5)},
+  {FIELD_LITERAL(0x00b5428215e6358a,0x001802b0d786ac65,0x005d37acb613eed6,0x00b4e31f0911e102,0x003cfdcf355637e2,0x0005df1056401c0a,0x00a2ab9737ae0aeb,0x0051cc138639b188)},
+  {FIELD_LITERAL(0x009af98af63a5713,0x0036983c36d3f7b7,0x00ed04c9fb20b98e,0x00b9e0d3dc96420d,0x0015707fe48868cd,0x001fca9a27fda5b9,0x00cc6df39cbf14ad,0x008236edc3668311)},
+  {FIELD_LITERAL(0x00b6b33fd876e8e0,0x00e907b2f574d867,0x0046be63c8b0e2e8,0x006ee9c07a308f8c,0x008e391bac8ff4d2,0x00dd1e23dcff87bc,0x0095943f5862e374,0x00436b46ae71ce39)},
+  {FIELD_LITERAL(0x00063415859fd6aa,0x003411f7f2720b1d,0x00d50e6fd5122d9b,0x0069bcae31807026,0x006b41e00fda9318,0x00cc6943fe6d7802,0x005dd8d499651e56,0x0075f9bf9931ae2c)},
+  {FIELD_LITERAL(0x006fbdf262216809,0x009f285d8322a692,0x008087aa55ddcce1,0x0001e04ef1745648,0x0059d8fa1697bd50,0x003c71d44e7eccc2,0x002c64907d54f2ba,0x004667a9d2693825)},
+  {FIELD_LITERAL(0x0049f2b2f5b0b488,0x00c888e0ad5f2bbe,0x00ff7d3065df7e10,0x00525c56b472b3a8,0x00e2dc83a8d68427,0x0003bea343d9193d,0x00be2572a0ed7905,0x00fa63ba225c1f8c)},
+  {FIELD_LITERAL(0x00c924adc90c11d7,0x005e3074ebc2a045,0x008466859db98132,0x00be2413acaa032d,0x00aa9be6d623853b,0x0020cf63f24df5fd,0x002f9a8853e9df2b,0x0055c17792a65d16)},
+  {FIELD_LITERAL(0x0092d12cc38bdaf0,0x0086c447f3d88dd5,0x009d9ee2c683f7a5,0x0065785ad24eacfe,0x002c86009a45e03c,0x00e1b5d1cdd4b9af,0x004b21fb49a91474,0x0041699acfc6e106)},
+  {FIELD_LITERAL(0x00f146d224231709,0x00fd6d21278479ad,0x00c462d8a2f8fc26,0x00737f2672e83b25,0x000654c8e1f6da91,0x00bbe1073c912dfe,0x00475e84e61cfeb8,0x00d463d97ca6e138)},
+  {FIELD_LITERAL(0x008bf5dced23268f,0x00a0ab5a769f4748,0x00d7a326b3944126,0x0075ace9533ac3df,0x00997e199053f340,0x000ac45d5fde8cc8,0x00c7afba146f1d7a,0x00244bdd1728eee1)},
+  {FIELD_LITERAL(0x00c58d4133ec5a7e,0x00d8f4dd7e5f1936,0x004c210b46ae73c4,0x00da254355a42089,0x005497b97c2ee854,0x0033188896c8f175,0x004491453e15e2ae,0x007e829c125b26d3)},
+  {FIELD_LITERAL(0x004ad8776c8482c7,0x00a65ed151da2380,0x002fd2c42a5ca6b0,0x00053093261b5db0,0x00cc8907918f97a8,0x002dbfabd3495781,0x00d375f26da95019,0x00736f94607f4042)},
+  {FIELD_LITERAL(0x007c20414d1114df,0x00806a3993b12064,0x004e23753bf50ef8,0x0020e64cda578646,0x001d090de48f8d81,0x00b19182c5fb6ae3,0x00411f764a18ac51,0x004957efbd496997)},
+  {FIELD_LITERAL(0x002545c3637f9b2c,0x007d7885adfb401e,0x0045a95b302d11df,0x00be400e065dd7a4,0x00556d90eeaca0d8,0x0095a93402f29775,0x001175369a6a1caa,0x009229873f8534e2)},
+  {FIELD_LITERAL(0x00362b5408f2ecdf,0x00fed36cfb736fa2,0x009d5178c0890a3e,0x004a89effff3c846,0x00459f34e97bb205,0x0003dadc2bf1b9d8,0x00ef3b902fa207d9,0x00eb0df0270c1f6b)},
+  {FIELD_LITERAL(0x00c0206411c034ac,0x0038bf79ca223582,0x00fe1606a2cd38f9,0x0090e4a4d0ad6089,0x0010c3f24e09e392,0x009f82771568f8c4,0x0059c520d212ecd5,0x008541edbd747736)},
+  {FIELD_LITERAL(0x009f82fa54da4950,0x0043a8d6b35af7da,0x00d56bf6a5b1ec12,0x006357876ef01222,0x00e86c5f3d8a7cc4,0x006dbb8cc78ef37c,0x001246844e24707c,0x003a85d53b39d2d8)},
+  {FIELD_LITERAL(0x006ed357467d506b,0x00abe1001be61d96,0x002f80dd2b1cf369,0x00f8b99b139824a6,0x00912565cd3173d2,0x00c544b59b2293fe,0x007435c9451f1e90,0x00f3cfcde2277456)},
+  {FIELD_LITERAL(0x00ba1933f0a3522d,0x001f0512facc9058,0x0078414b8dc6676a,0x00e2ffa221013029,0x008ccaac6db41f76,0x006c3d8e3c1438a3,0x00c780bfdd89ec3b,0x00c6b48c89856c2c)},
+  {FIELD_LITERAL(0x003bb5b3febb20a9,0x00537c20572c74e6,0x008d54686b99bd4b,0x002c4ad4e0adeb5a,0x007379f655f705fa,0x00c94f71a12ef174,0x00f14a7a7a6b1347,0x00a107791d085e3e)}
+};
+#if GOLDILOCKS_WNAF_FIXED_SPLIT
+const gf API_NS(precomputed_wnaf_split_as_fe)[384]
+CACHE_ALIGNED __attribute__((visibility("hidden"))) = {
+  {FIELD_LITERAL(0x0075fd1241fb006b,0x003a09275d3644a2,0x007a1744ccf42983,0x00c72633b39f66f8,0x001fc99f55438cc6,0x00c71cd00ea2eb65,0x00f7f724ed5950b5,0x000839316ab3c704)},
+  {FIELD_LITERAL(0x008de4ac4c9a9854,0x000ecd24e9652c12,0x0077cb2bdff18870,0x00ec6cef30f79c7a,0x00831e4f6113ba82,0x0098dba3c4eda655,0x004dcc5899b361cf,0x006375c1c82bece1)},
+  {FIELD_LITERAL(0x004c9af0653b190b,0x00ad7d06f87edec6,0x007483e2a337ae8c,0x009cbac9ef29f28c,0x00fd779e4d8f7383,0x00a14430d5558a3a,0x004b9d0c187d2bf0,0x00b2ab442c9752eb)},
+  {FIELD_LITERAL(0x008e982b953dd8b9,0x002a255bd122f13c,0x00dbe8aaaf121bbf,0x000cb11c52dc1627,0x003150b12f174244,0x004ef98e9aed547b,0x001260a4b3cf2f9c,0x00e13bc302453154)},
+  {FIELD_LITERAL(0x0080a1945056586d,0x002e36e76b4086bc,0x009f6a413eab4223,0x00ce3116586ebdd8,0x00127df02b6d1266,0x00c30a32d4033c63,0x00528d28cddd6739,0x00fee79efca6fc67)},
+  {FIELD_LITERAL(0x001ca88e72a17f4f,0x005b282378abfb8e,0x00b08832180cc686,0x0040d526ec25e535,0x00a173eac15961eb,0x0048c632ad5206b4,0x00e6ccef65ef8e8b,0x004b3a1a8f33390d)},
+  {FIELD_LITERAL(0x0046ebfc18490cf8,0x001dc5838d8f075b,0x003841d56dd0d83b,0x0088f6daa20dc032,0x005b2f5d37c35050,0x004034e61448bd7e,0x008d8c4af1565118,0x00a4a87918cdcfd3)},
+  {FIELD_LITERAL(0x00e0cc33b7f9fdd2,0x0057739c80ce7ab6,0x00de90bea754ec6b,0x00294b75bd7f1ea2,0x0029a5f907663b13,0x001bc0c084f5c348,0x001cf7cfebac8855,0x003a79d244fafea1)},
+  {FIELD_LITERAL(0x0041c1d7fb47b3db,0x00a1c9fcd4da560a,0x00a1ac68df356c69,0x00d6a2e1a7670754,0x0099b759e1600760,0x006201df49c03e2c,0x008e19aa126eb9ce,0x00e35cd9e64fd7c6)},
+  {FIELD_LITERAL(0x00b71e4cbfbeb090,0x00df4bfd3d4505ce,0x0055588254b8045c,0x00c39a9ab10542b5,0x00e1b65c8629e70a,0x00f83a50f9cae820,0x006488f236798ea4,0x0065894646a4c840)},
+  {FIELD_LITERAL(0x002a75151726dfbb,0x00544204599697b4,0x00e05e149a84045f,0x0025a656d4b60f79,0x00ca9bae001e24ea,0x00601cc07ffe46a6,0x00e7d1a8c5c46e6f,0x007e94ee17dff170)},
+  {FIELD_LITERAL(0x00482f2895f6a14d,0x0000dc2f794bdc9e,0x0059098b1dc34c01,0x00ef0c6c5cd21a34,0x00da41c9c24c2c97,0x009a2ed1485f6123,0x00bdf7557e8b7b01,0x0045dde397e8bcb9)},
+  {FIELD_LITERAL(0x003cb3efd51c0b45,0x0045cf76e8f98286,0x00dfcbf214d8cb4e,0x00111e569a91b59d,0x0030289fe49394ec,0x00a63191d5aca5f6,0x007388c8b0d16b13,0x0012712eeb33712f)},
+  {FIELD_LITERAL(0x00c08c4f0eddb3ed,0x00a69cb406bbc4cd,0x00466b5c14b6a5c9,0x008e2b6b568d58c4,0x0091f242ab58a92e,0x005b983c449357db,0x0040131296fbbddf,0x00afd385ac412ecc)},
+  {FIELD_LITERAL(0x003f6f9ddaa11a49,0x00e2aa10c1e04a83,0x002aa34097c174df,0x0056bc91a2cfc298,0x00dd145138ad8643,0x009b502e5fbf2273,0x004daef8dadf16de,0x00e0d58533945ca6)},
+  {FIELD_LITERAL(0x00667cbbed8610aa,0x00178dcfc08cdc1b,0x00143e1c5029fab1,0x0025090ba50d0eb5,0x00afef138ae199f2,0x003f143bea5973c0,0x004f0595d97a2f06,0x00317823b2f54f1a)},
+  {FIELD_LITERAL(0x009d138105b87c6a,0x008cf0b180aedef9,0x0001982f8c9acaf2,0x009b615e6d889105,0x00a5a4f54707c6ee,0x00d8a76f839935e8,0x00e56e9b92d1393d,0x00f56be8bb23407f)},
+  {FIELD_LITERAL(0x0049c83a92170c76,0x00179f01515f623b,0x00aa76c57f998717,0x007f4dbb2ecba20a,0x007339b98b275693,0x00f99b1dfd314e0a,0x0090d38aecf21c5e,0x00e9317e8712f592)},
+  {FIELD_LITERAL(0x005464c86ee0e242,0x00b232cbdda78d20,0x009aabd33ca9c284,0x00c38b6a73071963,0x00b983c870c1a2bd,0x007792f93c8289f5,0x00aaa5fd64c42553,0x00ba99d2595045d8)},
+  {FIELD_LITERAL(0x00d0b1296dce7fd0,0x00b5b550cac92797,0x006b692b7843c59f,0x00701d3e5162c3c0,0x0079bd73ba5b14bc,0x009d148d26b87ad9,0x00d41b1b5f8ce7a5,0x00648ea39bd13e13)},
+  {FIELD_LITERAL(0x001683bf57fb049e,0x0037176b75c054c1,0x00386482d2b20213,0x000ad4b193f5c38d,0x00433efb60a1f163,0x00202b5e325402d4,0x00408524495b89d3,0x007d5b123aff637b)},
+  {FIELD_LITERAL(0x00d67e6725beba3d,0x006f173a828e2d5d,0x00e3cb13a5dd95ab,0x0058b79a72974501,0x00f45066bd65e32c,0x00852267d8ed6444,0x0077fdf70b81517b,0x0059d2429800c77f)},
+  {FIELD_LITERAL(0x00430f0ac3d142e0,0x0026a623565bf1bf,0x00b7bf63df20cd37,0x008035abed4a5eae,0x00d3dbb0df825adc,0x009d31a0e1633300,0x00c98906d65384aa,0x00b626aabeba2ed7)},
+  {FIELD_LITERAL(0x007f4cfae81f1423,0x009cbef98c3fe8df,0x00e98863c956964d,0x00fb5713f4179e13,0x0013863d36d10c95,0x00d2f1e4c555cac0,0x00eda9baa50fac33,0x00155692c4a7176e)},
+  {FIELD_LITERAL(0x002cf4d8374137e0,0x0011bcd01cfc8b65,0x00d819428459350e,0x00c2636e55507d46,0x0043bfe72bf49f44,0x00e232e73e600c93,0x00f4cd7ea6144b4a,0x00c8117c7c63707a)},
+  {FIELD_LITERAL(0x002bc6bdaffe2cca,0x0088cd41ca85d89c,0x0080f8199e0742d1,0x00c0d806414e6e86,0x000b13ead9dc050e,0x00c0db5268db156b,0x000aacb76c4120ec,0x0075a902879d2720)},
+  {FIELD_LITERAL(0x007c8f764c23f360,0x0031e6e513a6024f,0x008e4e840ad92c73,0x004325092a3b9a6d,0x00f63712a826406a,0x00409096924a78e0,0x008d28ebdd651f48,0x002331c8cd805b7e)},
+  {FIELD_LITERAL(0x00eb7c2e84be8f9e,0x00225da3976722bb,0x0092175b84abfc77,0x0045ae12de030531,0x0065c57427d6bddb,0x008a30ec7e277ba8,0x0012442a0185745b,0x00620b4b99019d9d)},
+  {FIELD_LITERAL(0x002303cf587ec4d8,0x00a960baaa467b02,0x00bde9a108ad0446,0x001d17fb0182279e,0x004b9bacc68a8c06,0x00a03b2994097255,0x004e79c82db8c972,0x00a0afb289adb754)},
+  {FIELD_LITERAL(0x007670df487c8c6c,0x006e5ac06f3aa617,0x0013351c0ce48529,0x00ac8802da82aec4,0x005cf2967d3eda36,0x00b802b7c48e5ef4,0x00b7b0907570c503,0x00262a7d37014b92)},
+  {FIELD_LITERAL(0x00bc57af5ad474d1,0x00b83c9890b6d477,0x00da60f2b3932ccc,0x00f4f00e085f0325,0x000f84bd8401e0d5,0x0041688cf93ac811,0x00aeeafb64b994dc,0x0024454a653176ff)},
+  {FIELD_LITERAL(0x005c4ee607871eb7,0x00ecdc9963259be2,0x00454d5df525f1c8,0x000445027269ce84,0x0000380605c50a44,0x002b08602d94c271,0x00b17741d712107e,0x00655ccbe939a512)},
+  {FIELD_LITERAL(0x00732b1f632a66bd,0x00095551f51c4fdd,0x0013c4a3ff0d84f7,0x00cb39e019e6ab00,0x0007e028d50e353d,0x00137d931bed8523,0x00c88098a0d1eac4,0x003d80c40a5e3aaa)},
+  {FIELD_LITERAL(0x008bc95eb84a7783,0x00f7f46c87c1799c,0x00106f4d4ca08e46,0x00817644acd1e69e,0x00d1f791490c9d13,0x00563569b20c1dd2,0x00ed734d8b2e8d96,0x005665d2b59081ca)},
+  {FIELD_LITERAL(0x000a4ea98d69c0e3,0x00e94a486bd436fb,0x000f03ac2e7e68e9,0x001e6bb6b7f2c6b9,0x00b3dc1b432f0d0e,0x0061a00270f7d0bf,0x001eef60a46f6add,0x0059972a6fbe7045)},
+  {FIELD_LITERAL(0x00d47e3dfa08980d,0x00daedc2b3371a12,0x002b10fc0289df19,0x00849f3a6397f41d,0x00d4dea1feef9f56,0x00ea283d35305391,0x002d85af4fb121f7,0x008af6602a08e230)},
+  {FIELD_LITERAL(0x00d6abe5147c27fc,0x0016539dc6f9d47c,0x006a1f048b8c4de8,0x001b784bb4759b4e,0x00459ad33a147ffe,0x00ad3338d344b0d8,0x009a5ae24da065af,0x00c40772e389a7bb)},
+  {FIELD_LITERAL(0x0027f8e18fbc0ede,0x005e60e350f44abe,0x00d087b556d58a33,0x00dab6b6a64f2d3a,0x00284a304115b0cf,0x009d50c3c0e08060,0x00e5b20b08ef8ef9,0x00c92a4e72a43f35)},
+  {FIELD_LITERAL(0x0046eacfbe75e7c5,0x00519615deab19ce,0x003983bc3b3746e2,0x00f78498b9d6d8ba,0x0040f00fa4cd47ae,0x00c52ae8d838e070,0x0047987e94135150,0x00716c580ee7b69e)},
+  {FIELD_LITERAL(0x0019f6afa9ab06aa,0x00d3f3cb7105147f,0x00cc0f1a90344702,0x005a0a09725ea7b9,0x002aac19525b7ab4,0x00210b3f88f54db3,0x00077437c1e7456b,0x001042dae2ab4b5d)},
+  {FIELD_LITERAL(0x00f8d6551a584758,0x00b4b0f31db2b924,0x0035a04f6aad608b,0x000aae0e4e20c8cd,0x00cb975a2377c544,0x009647e5200e869a,0x008a8aa5f1d90d1b,0x00ec3ed1ecb17361)},
+  {FIELD_LITERAL(0x00ac64f13f138b16,0x00c4a613e8e7d424,0x00efd959c8aaaa06,0x00d3e34bf8022c95,0x00cba20adb9e908d,0x0036c7d56af7db19,0x00289e56ce23ccbe,0x0095fd864a2fd927)},
+  {FIELD_LITERAL(0x005bdf4385561592,0x00ff6b3266bbdaf5,0x006e9b8f8611b5eb,0x005ec95212047585,0x005b075257f5c198,0x0064143dd1846c1e,0x00458316590e2557,0x00a12186cf4aaf8d)},
+  {FIELD_LITERAL(0x000766f371186363,0x0025f819f24dd710,0x002d943707999c75,0x00a0e7b6b1c37fa2,0x0034a951bfe480a7,0x00ba4a982266b057,0x00fa852da57e97b6,0x00d6c2fc7ca21c87)},
+  {FIELD_LITERAL(0x007d4fbd68a22900,0x00d3b58f75a93153,0x00327f2d475d9600,0x00afa719750d9374,0x0037025d4b127c26,0x001ce32af5847375,0x002df5fd324f1a40,0x00659b9c594422ff)},
+  {FIELD_LITERAL(0x00fc06447aa672a8,0x004fdd061aa5d573,0x0002607f643d5283,0x0081f61f7385bae2,0x00dd28c8cc3b85db,0x008315d0fdb1f516,0x008065ac741db014,0x00621bff59c0bd4f)},
+  {FIELD_LITERAL(0x00037a18ff6d4815,0x0056e16431d5a61e,0x00159e1bb0e7c2d2,0x00ceacc829f29fc2,0x00e5a7b6851b5114,0x0028836384f66075,0x00fdd1a2c83c93fe,0x00d89285784db9ca)},
+  {FIELD_LITERAL(0x0064d41ebb3eebaf,0x00473491cc37c819,0x00b6b61626345d7b,0x001a8202b37a3790,0x0096a1bbe33aea00,0x00d4bb7b93a974dc,0x003057b1acd7e55a,0x0074bfa6b3837755)},
+  {FIELD_LITERAL(0x00f4d623760fc21a,0x00ccbcb94477b749,0x0090948b74c67569,0x0098edc343c15191,0x0088bc71e9f97402,0x0040dc4b367f7692,0x006e532439747a9b,0x008675b9c4d8601d)},
+  {FIELD_LITERAL(0x00a99fc2702e3cbf,0x000cdd4ea1abbbd0,0x0039dd1f6ec8807a,0x004fccde36d625ba,0x002c00d50a1ab661,0x001a58c771b906b8,0x003a58d8bc1ee7ec,0x001cb3b83d1d3afe)},
+  {FIELD_LITERAL(0x0080689a7a7af6df,0x0023f703b961ec26,0x0092ec1290f763a9,0x0093f5eeac6663d8,0x008b67df16d150ea,0x00e338dac65f8378,0x00cb4d02a5399332,0x000b32ac52011866)},
+  {FIELD_LITERAL(0x003e4fe889a6c8f0,0x002486114467fcc5,0x008bc09141018ce8,0x002eddfccb5151ac,0x0064533f4725723a,0x001de20f48cdfa99,0x00f04ca997240cef,0x0063c57607519c88)},
+  {FIELD_LITERAL(0x00f60e12adf6040c,0x00b36cb184c72847,0x00df6d8b890c3c9c,0x00afe158c4c668c1,0x002a4b9b2eb150df,0x00bda387c99630a7,0x002070cd953d67c1,0x003411500b3b20b7)},
+  {FIELD_LITERAL(0x00d9e9da075534ea,0x00a8df1a0c0d64fe,0x0079999ce6afdf5d,0x001d267227508222,0x0087d7f5a2195206,0x00013bd8623bdb81,0x00161770e850445d,0x00e909bf592e27e8)},
+  {FIELD_LITERAL(0x001a401cae18a39f,0x0031674387ef870e,0x008cac9360a1f176,0x0090ab2a5a010a36,0x009f191751d9e926,0x00f914b4e33682c8,0x002123c0e6869b11,0x009c2518360a7228)},
+  {FIELD_LITERAL(0x0017bed74f952bfb,0x00af8688d094df71,0x004d05eb80df783f,0x0051488ab6f9bceb,0x00653e04d9030fbd,0x00f7ecdbe864ecee,0x00948d66506a8bdb,0x00a31a0c3c95a3ce)},
+  {FIELD_LITERAL(0x004325a1e71edb4c,0x006b0e65086b0d39,0x00d6807f539b5d11,0x000fe10afe2fe18c,0x00ca512637538c68,0x00fdd644e6279612,0x00ce2ef0c69543e1,0x00cb3d2eb9fe6816)},
+  {FIELD_LITERAL(0x00568d09b9f22a6b,0x00e00a8e18d5e1a5,0x00cddcf90108fa8a,0x0003742222d3e229,0x00c62aae6d10937b,0x00c40b17c935458e,0x00155f9096050332,0x007675e2a6e10754)},
+  {FIELD_LITERAL(0x00b699c07f426656,0x004b0a8084fa04c6,0x00f28837aec5a5d2,0x00713d34765ea025,0x00de649575970a80,0x0019f1f107ef21bb,0x007e164282446b30,0x0049345c8271a885)},
+  {FIELD_LITERAL(0x0073a354264de9e9,0x00193c84964c68f5,0x00c53fc234ff743d,0x00b3c96c3dcb53e2,0x002cf74c90b4f1d4,0x00602ddcc3422081,0x000fa04b1ccc6861,0x000b1efca5908940)},
+  {FIELD_LITERAL(0x005333c4725c15af,0x008ff3216fa735f6,0x00a0006cb9319b28,0x00ade7b084481272,0x00a65487b67024c4,0x00a4408dcd861601,0x00d7034c679c027c,0x00b515108f96aab0)},
+  {FIELD_LITERAL(0x001b1f3ba8c94ddb,0x008ef8468ed210b5,0x00996f0ad7b0c9fe,0x00579819662dbafb,0x00f7c8d41daed60b,0x0006e06628afa4fa,0x0012cc153702b9c2,0x00a95903ad0fbe76)},
+  {FIELD_LITERAL(0x0093dc0cda7ff166,0x00a5afed59f9663f,0x00eb6c15e8efee26,0x00254ba619186d76,0x00983e49bd636ccb,0x002c5a134ae58df8,0x0014ea91c430b790,0x00c5e9ca28ab0e91)},
+  {FIELD_LITERAL(0x00f5b1d99d59aae1,0x00ff6948770b9720,0x00e718e9daa2a4ec,0x00ffeb43370eb9ce,0x003da15c2af28f49,0x000d1ec8900395fa,0x00e556c861203ad9,0x000463e67016341e)},
+  {FIELD_LITERAL(0x00cb85694d089fc3,0x0083bb9368861bcf,0x000cf3502ecd4275,0x002bcddda43a2628,0x000236479229032a,0x00e9c8a63843075c,0x0003db99715466ed,0x0068cf9526159cd2)},
+  {FIELD_LITERAL(0x00031e2c6698d433,0x00fc6b7ada3383df,0x00229d1e166ff7d6,0x00e329a83ec41302,0x00a4ea7a56c0db18,0x00095798bbf27657,0x00a6d3f05d306882,0x00e769ce4e51d279)},
+  {FIELD_LITERAL(0x00a09a51c956986f,0x00287b2e66077010,0x0000358a62d07632,0x006b10ecc7db309f,0x004679a9c8284487,0x00c582288840a456,0x00c6a7e16bf78569,0x0030a852f4e9d139)},
+  {FIELD_LITERAL(0x000c635747485463,0x00c4056e0fdd0f69,0x004ed02af667c9ce,0x00272805b0d1520d,0x00e02e0437dfb0e4,0x00cfd18963ceddab,0x00624fa2480e9d6b,0x008dcaff54779dba)},
+  {FIELD_LITERAL(0x006d59954c433cd6,0x00302dec1a134957,0x008131e3d9cd5573,0x003646644f8d6769,0x0086a28be5f65ee5,0x007588860bd65db9,0x006684abd0cd1248,0x0004628660586996)},
+  {FIELD_LITERAL(0x009c6716f0850ee4,0x003d9fa6e87030ed,0x00e985d9bc6b9dc4,0x00f15f6b0ee1c3fd,0x00017c3e5d12e4c6,0x00612d6f9d9fdf6a,0x00c411c75569ffc1,0x00c2d6c46f82dc20)},
+  {FIELD_LITERAL(0x0061068b3581aba6,0x00fe9189cdf90003,0x00d5ed0e681cf004,0x00151ff68bd5ea3b,0x00c11698cad6aa9f,0x001b5859410fa611,0x002ef3493e9e2af9,0x00e71c74254749b8)},
+  {FIELD_LITERAL(0x009dd23da3e3ab5e,0x001aefbaf2529935,0x00eefcb4703bb6cd,0x0079d39953a79d4e,0x004fde6ff67c1f0a,0x007276b4ec4c99b1,0x002124e6bcdf01b2,0x00611c400fa01e19)},
+  {FIELD_LITERAL(0x00d023f8e4da8ec7,0x00ecbb1f40e635ef,0x00a9f46dbc56f3ee,0x00640ac1f825f79e,0x006669cb2ef95f66,0x00b47d23968d2a78,0x00ce71866a0fb89c,0x008fee90ac64bed5)},
+  {FIELD_LITERAL(0x00a29f6b2359a2da,0x00b2ac5a3e5f3f18,0x00b3a66db3533f07,0x0028c94ec1e69157,0x00540ebc7ab9f09e,0x009f88cf4951a9b7,0x000f72a4b987ca47,0x0078e5752e9ab12a)},
+  {FIELD_LITERAL(0x008149df0d6f178e,0x00ff5b76b50d6983,0x005cc60f47e5f1cf,0x0085957c5ce5c00b,0x00643a3b80c01474,0x00dbd52e80ea7b7c,0x00e0ceb72639723b,0x0045994932da789b)},
+  {FIELD_LITERAL(0x0009b7c035c9f361,0x0005234d09f7942e,0x003d7797e0b11c5d,0x0056dff81c3bb430,0x00e190657c94bd35,0x0047ab208fde0fae,0x006035e872e1f474,0x0016eb83f161e165)},
+  {FIELD_LITERAL(0x00dbffadfbb07717,0x0068d482af386f53,0x009c87494dabf009,0x00a7fc31c7d6071b,0x0086f8cea871a141,0x00544eb9f48420d5,0x000a8204e17b319f,0x005f73bd6f3bead8)},
+  {FIELD_LITERAL(0x00895ad60baa7959,0x005356314cb5a5a9,0x0015c86c1d547150,0x00009ac276829cb2,0x0012365c8eeba1d1,0x00b477db550ab24e,0x00c895225100d72c,0x007195657296a0f2)},
+  {FIELD_LITERAL(0x00572f9be18c5625,0x00fd878af5029ac8,0x000efe7b99ed6e7d,0x0057a75e5a5ffc13,0x00372b415a6dcfb7,0x00b7837f6fb6681b,0x00f004ac7109872e,0x00e8b76abd7169e4)},
+  {FIELD_LITERAL(0x0005cde3da41f6c0,0x0073976e2a61eed9,0x00c66fa0ed917559,0x00f0702f66f2b917,0x00663a3afee43b60,0x003311dc62e096c1,0x00c4ce38dcf87c00,0x009f42239d0efd38)},
+  {FIELD_LITERAL(0x007fa90dfefdc27e,0x00dabe701288a79e,0x00e54b83242b9b92,0x00ea64bd5a411971,0x0099da7e287d5d92,0x005b76d077db9c21,0x00fbff138a1b84de,0x0010451b90791c04)},
+  {FIELD_LITERAL(0x009f490560071811,0x00d121eeed6815fa,0x003c26806894d24b,0x0052214f8e4f1680,0x00cadb905968a815,0x00f986ecc79552b6,0x0077373bd44f5a0b,0x00c6aeb53d3b5ab9)},
+  {FIELD_LITERAL(0x0034770414fe3fab,0x00d53cfd361e841d,0x002c949cf1c70ea1,0x0010c58407f5ecb6,0x007fd3ecba9b285f,0x00ff7ec3e10a4fe6,0x00628c0f15484db4,0x0069888c725464d9)},
+  {FIELD_LITERAL(0x00b9c37cc33dd7da,0x00a2dc91059b20f1,0x0020f304354553f7,0x0051909b1edac8c9,0x0074aec4d0bf927e,0x0094e514e0d35018,0x002bab18f1d8eb35,0x00b9bdbe87fc1d0c)},
+  {FIELD_LITERAL(0x0001a4f786d79e4e,0x00bc9a0d100aff75,0x0027a5957d9668b6,0x006bda303fd2f1c4,0x00a3a831680b169c,0x003d8d8ce35322ef,0x008e7794e0050c5e,0x0079b95fee2982ba)},
+  {FIELD_LITERAL(0x00250bce01f405ea,0x004eddb1c2751be9,0x009bb7754924a659,0x00a8976028ed7958,0x00def8d54f629f06,0x00982ea3f2b7c7da,0x001e5bb0314f5875,0x00da45996c1cdcb7)},
+  {FIELD_LITERAL(0x007c5b4ef7b86e9a,0x0054bf46c4da0cf6,0x00f3723c94f63a70,0x0006a81bef6bdab4,0x008f2ebbdd144bc2,0x00db5a7a8538db1b,0x005516527b729b80,0x0062c014b1eb1c29)},
+  {FIELD_LITERAL(0x00a9d835541fed60,0x0005dbe44d1abe58,0x004887f92c74e674,0x00ecbeee5ca06733,0x003e61c422075a0e,0x00e237ac6d11aef7,0x007ff7ad810fd62f,0x00f553b08aeb9261)},
+  {FIELD_LITERAL(0x0048a6ef0f597158,0x00d2bd08f42bf48e,0x0092e8543aa411de,0x00725ea7f497cbc1,0x00679bd1ea42b57c,0x003839564b6f8459,0x0075b7bb846062d0,0x002f506fd9eb4d7e)},
+  {FIELD_LITERAL(0x00b3111798fd854c,0x000e54d8bd080776,0x0005a6a239ecdbd6,0x007d89903d490d86,0x0061fac971bc23cb,0x00388f1334f71c5d,0x001a1069bce98c7f,0x00523181cdb9d211)},
+  {FIELD_LITERAL(0x00f8cc23799bebda,0x00cfe313d601c370,0x0012bda860bea571,0x002f8aeaad211d51,0x00d67259ce0ac53d,0x006b2c74a328248f,0x001be3bf6ee7dfde,0x00f0946f3cfb7b8d)},
+  {FIELD_LITERAL(0x00662051261c069d,0x007a58f6e85b360f,0x00a27489e812dbae,0x002f9cfb72efb6be,0x00ba360587190a87,0x008636e93549bacf,0x008a067de56a03b7,0x00feb0ef6d6f3421)},
+  {FIELD_LITERAL(0x00b5f54007aaee08,0x000ccef57e4be275,0x0089cf8aa67af3a7,0x00502762f91090e4,0x0024acc48fbc2237,0x00bd5b96a03bffb8,0x000375dba1e00b9a,0x0068222e9c471040)},
+  {FIELD_LITERAL(0x0058c951bca098ea,0x00c8fbfb21be48b9,0x00be1fec2fd486ce,0x00d25a1768937aa3,0x0039bfef358d0261,0x00501bb1e6d46166,0x0072045214d40ecd,0x00f84a70c9729d72)},
+  {FIELD_LITERAL(0x001784a954018b4e,0x008f345fab0e7e0d,0x0092620d39beafe4,0x0004d54bd9dfac53,0x006550d489a14b90,0x003063c8a3a039a6,0x0040d695fa78cb62,0x0088521b6badcd72)},
+  {FIELD_LITERAL(0x0061a426dfdf5030,0x004610d4954516ec,0x00f0bc965685c5fd,0x0049009791061d97,0x001ebd73a3720de6,0x007346c0c41ad203,0x009a2e25dcb166e0,0x00d82d931131c4b1)},
+  {FIELD_LITERAL(0x008ceee4dbe835e6,0x00b41a1e8399fa2e,0x001abd3fd2161be0,0x001ceab8c09c4da0,0x004f1cb3044e3cd8,0x005c49cda7ea8b11,0x00ad17eda963323e,0x005c0d464a14a122)},
+  {FIELD_LITERAL(0x00ca5ee97ad9a13c,0x006687cb41b89433,0x00fa3e02753ac27e,0x00cd9b8524f49e9e,0x007d46244d4deab8,0x0009317786c2def8,0x006c80ad3bf3c276,0x00c3c251ea498bf7)},
+  {FIELD_LITERAL(0x0015b303cd4972c9,0x007c63d6e82811d1,0x00751ab283b1b345,0x0091fe8ee3c2e4a7,0x00d1e6ef4fb692eb,0x00e00a353fcf5912,0x007fb608d663a69d,0x00cb273aa5c2ff4a)},
+  {FIELD_LITERAL(0x004e41d7e24bb319,0x007c34275f64415e,0x00f09fd40b483336,0x002c85f48e820e1f,0x005cadfa21896fe2,0x003b5468e88dd45f,0x002de46af0d2be2c,0x00f05ca41e0ef6d0)},
+  {FIELD_LITERAL(0x0085c0b2249bc741,0x004b2c8059cb3389,0x00532425e802bd7d,0x006784f4782d4344,0x001deebb296f9922,0x00ff30f747e9aaaf,0x001d85b5d314438d,0x00a35844af618b26)},
+  {FIELD_LITERAL(0x00dd36c15ccfee96,0x0025472dc945ee15,0x0013b831c71c2395,0x00e07fc6bc9e6f2f,0x003378a5b4a36469,0x00e4aa6515d303d6,0x00814e2f1e876395,0x007bf5a563635736)},
+  {FIELD_LITERAL(0x00357592036e6416,0x008ee392e62ad0cd,0x00a890280e64ce03,0x003aad18b2736599,0x00983b0ea0480534,0x00aaf2f05d066a78,0x006be1833d666be3,0x00f5257801c9045d)},
+  {FIELD_LITERAL(0x007edfe4da4591f9,0x00ec6e53314cff39,0x001eba4973dc5246,0x003214446a1978cd,0x009e6534fb6661b4,0x0015a4537f61817f,0x0010ed8862c67307,0x0062eeb0f13e6726)},
+  {FIELD_LITERAL(0x00f61281bc2bccd7,0x009840053c8b49df,0x00c3cf3806398326,0x00cafac346fcfa14,0x00af5a7648b6bd12,0x004be14f7e3a49a7,0x0069764b7fe3998d,0x00d5425d63e3ce3f)},
+  {FIELD_LITERAL(0x00fb14a6a236c6f4,0x00af6af8601eee86,0x00074db79e63e695,0x004ab3620234e444,0x00089210ecb5e85b,0x0051c98e7ab59dfd,0x0093bfa97255f90d,0x000de58fac85995d)},
+  {FIELD_LITERAL(0x0086adf38444f2ae,0x0033e49de49a1db6,0x002509d7071f960f,0x00fdf73e8ecb2e31,0x007788c326286ed1,0x003bb81d82da7433,0x00db58c53e92a9f8,0x001b47d5743eb0af)},
+  {FIELD_LITERAL(0x008747ba1e629515,0x00095f53a1c9128d,0x00aca066ab402ad3,0x00c07df42a737029,0x00c027b15cc14d97,0x00251652e442e6fe,0x003b800c6e39117b,0x006ca343f0a29eb0)},
+  {FIELD_LITERAL(0x00b36f947bb6d02c,0x00606e7fafa3798e,0x004204efb9d4036c,0x00000a98f00a3959,0x00f1679d868c328e,0x00df5a734e8ee25d,0x00545d7e4537606d,0x002d335ff0d20a0a)},
+  {FIELD_LITERAL(0x0050835a3b81acfd,0x00ccf553da8aa3d9,0x00c30c94ab746e02,0x00f74cba23db5e52,0x00ad72e97a62549d,0x0095e09674933871,0x002d14cf6fb34218,0x009b977f273e4380)},
+  {FIELD_LITERAL(0x009b10921883b64d,0x003166b752cf3e7a,0x00c057fad6f89e68,0x007d218a24065a72,0x006d47c4b69b4a05,0x003ff4e760f9d3d4,0x0059a2e650d14cf1,0x003bac8b70963cc8)},
+  {FIELD_LITERAL(0x0026287f244b2e89,0x00ae45549af5e8fa,0x00f831bf60bb782c,0x006e70c455732a9f,0x0061acb54535f0fc,0x00104aae688c03d7,0x005e270b5dc2c121,0x0032e0da68f00f55)},
+  {FIELD_LITERAL(0x00b4aa12e4de5302,0x0099313573079d07,0x0002655f8728a857,0x00c3a10a522bd84b,0x006d9cb13b590490,0x00d7466ba21fd600,0x00583f84dce4b2b3,0x002050fab176e0b9)},
+  {FIELD_LITERAL(0x004683dd6e015d9b,0x004d0823bc74839f,0x00a01c3cd4920759,0x00ae59d13d45c918,0x00b5f234025e93e3,0x009891d44914bcfe,0x00e15d7301c1a223,0x003ee4ec52730e56)},
+  {FIELD_LITERAL(0x002c42a617bfb988,0x00d5927ae19fb0ae,0x00e9a17dcc1d47c0,0x00f34d6691bf990d,0x0051f4035c68c9d9,0x005ad2c9dafca34f,0x009548bccc693c6f,0x0030ff5ccafef68a)},
+  {FIELD_LITERAL(0x0035b216eac556ad,0x008131ffce45030a,0x0055880e1e91c691,0x003cd6d74bfa2d9e,0x00894bed862d2f84,0x00d199188f2d1394,0x0066d921dce4f9fd,0x00c4e9f9b5a17927)},
+  {FIELD_LITERAL(0x003a5716941dbced,0x0098f1da07ae831c,0x00d8d9d9103d2704,0x0036c4baceb612db,0x00cf7b770e6cfb5e,0x009690b06494b3f5,0x00bf4ce48dcdfdab,0x0018f322cc104396)},
+  {FIELD_LITERAL(0x00533e87feb83ed7,0x0070223c6a37017e,0x00217c85c3066d92,0x0038cb61df18da75,0x0041b68d44298881,0x00df5423ef4d0cf7,0x0075899b6868f972,0x00253a1db676e164)},
+  {FIELD_LITERAL(0x004ce2f7d1c58fab,0x00a1058c95639483,0x00bfa171609ea627,0x0076feec3569e78d,0x00256ba5ee81d31e,0x00b63e200dcdf6aa,0x00a66d4a3d1b5399,0x00ac4d1661a6dbb9)},
+  {FIELD_LITERAL(0x000e739b16f7b032,0x00557da6d65bca3f,0x005d9461d09c76cf,0x00c5fefaf24655a1,0x00304a081880f114,0x00d7d0483715c455,0x004a7df8201e8c4e,0x0052640493e6f8e5)},
+  {FIELD_LITERAL(0x00384805fe525bce,0x00089f02908c001c,0x009e35e0ac9c610e,0x008726fa44478a6f,0x009f3a55c034ce7c,0x0020f70a06b59094,0x002110cee5a9582e,0x000af228e0fc0d91)},
+  {FIELD_LITERAL(0x009685fa3684c587,0x0048c1fbae3c9b70,0x00e2cfd0368bf9b4,0x00f0d5800f100b0c,0x009f1f673aad7f05,0x0072b68cdf40be14,0x0043216b7232feab,0x00c6e0cc7efb9a00)},
+  {FIELD_LITERAL(0x00e6421c2f0b38e0,0x009ff3b15209c664,0x007c672b712c5d9c,0x006ab1346445ab87,0x004f0f5d8728ed4e,0x00080b9080e8c54a,0x0078fa4c9d21ccf4,0x0020a853653e17c9)},
+  {FIELD_LITERAL(0x0086ac148816a0a5,0x00150d2bd8167c63,0x003c087bc58d7152,0x00cd7196454d7df4,0x00b89e49659fcfe8,0x008788a49a6152b4,0x00c59528e3007d4b,0x005d18905b8667af)},
+  {FIELD_LITERAL(0x0006aed6dcb92fcf,0x00cc5ebeef79f873,0x009f29b65d8e08bd,0x0098c66f6eefcdd5,0x00a14211ddb84b60,0x00168ebf512fe5c8,0x008f7a27acf9a862,0x0082a860ec0b7c5a)},
+  {FIELD_LITERAL(0x00d5a03b7edce1a0,0x00316f1e66114dbe,0x008b830f68066cae,0x00d1ffcf0ecd3473,0x004207f6b7158e51,0x007ff2ff7a114e30,0x0053b5a0a2ffb019,0x009b56fc3bb8f01a)},
+  {FIELD_LITERAL(0x00545accba2c36e1,0x008bcbd2882a0d73,0x00dcd8004ad2ceda,0x00ec9a79a2db91e4,0x0074cba9f190e931,0x00db42467e75376b,0x00b810f6f8fb9335,0x008648439d64681a)},
+  {FIELD_LITERAL(0x0080a3889c19a125,0x000710d58e71068c,0x00e97d3ac621fbed,0x00a0f3d3af2789ea,0x0033e33f3df20488,0x0027997987fff024,0x00126851536ef18a,0x00399d389d920a4e)},
+  {FIELD_LITERAL(0x007125a136d129d8,0x00eeee05633a3421,0x006d921f979a00e0,0x00981a49e45b25ee,0x00d3076d8286817f,0x005e9c8f0e2fe320,0x00cdc63e22a758ba,0x005671bc8356b784)},
+  {FIELD_LITERAL(0x00fa611b264d95f8,0x00b9bb94ec5c16d1,0x00d0d46d980589fc,0x00bc37faa582fb35,0x00f0833069ad8716,0x00b8f63578b32312,0x00c4756888591cc8,0x00422a804c1e5ce6)},
+  {FIELD_LITERAL(0x0083b78cbc23ec67,0x0038230370a59692,0x002583a14786765b,0x00cda43f3737d5e9,0x009243ea57e1148f,0x0056e164236e223e,0x00b9b35b49a066c0,0x00ded6b6d0a966c2)},
+  {FIELD_LITERAL(0x008a5feb0b9ed401,0x003e43470a6e6caf,0x0016b759a55b796b,0x00089ee6e5c22e84,0x0037d274f0055738,0x007052b3ca0d2dbd,0x00db5f01915d2739,0x0035f4a29cc2d6ac)},
+  {FIELD_LITERAL(0x00c251e8e577f30e,0x003dc307616d8ddc,0x00ee7d60026695c9,0x00da44756dac33e7,0x00c280f672a96798,0x0008a69fdcab3d9b,0x006a461f479c4d66,0x005da474f99afd38)},
+  {FIELD_LITERAL(0x0071b8b148f9d304,0x00db42b464afea53,0x00b72a5b46cdde87,0x0098c099a03eff92,0x0090131b3c5f814c,0x00c04e595b9fec70,0x00fcff762dd1fe17,0x001f44ab7ea4fc15)},
+  {FIELD_LITERAL(0x0022f2de59a1f156,0x0054f32b81773b0e,0x008808c21537bd19,0x00fd7713a25f096f,0x009ce6da65820b04,0x000f8ffaffa34d1d,0x006b31f4acb4f1c1,0x003af2273786f4de)},
+  {FIELD_LITERAL(0x00a92c393604e673,0x00a97a6dd2b3cb4d,0x00a3a99845566ad4,0x00db885bcf0f9acc,0x00151514b343d957,0x00e25a7fe8034c80,0x0001a317bdfb2d11,0x00d8ffd51cd84ec8)},
+  {FIELD_LITERAL(0x00c252c61c67157c,0x002473dadb5f13bb,0x004d738a4abdb280,0x0010045fb748a65e,0x00a201c5e229218f,0x00171ea88659852f,0x009fc336783d560f,0x0047fd098fae4f68)},
+  {FIELD_LITERAL(0x00a33ac97091359b,0x00282356e972a6b9,0x00b8850007ebaaa4,0x005733c72f5534e1,0x0011786143376586,0x009382894cec6e9e,0x008fe1dcdffd695f,0x00fea06e5c2f9639)},
+  {FIELD_LITERAL(0x0040238f6c109f9e,0x00fae916ee6039fc,0x000b8a7d7c8dc3f0,0x00339efa0aec98aa,0x00beab1c0eb17a5a,0x00b294c6bba4702e,0x00439f4d78566772,0x0048bdfb50d9c1bf)},
+  {FIELD_LITERAL(0x0077bdbf54b0208d,0x00e1c467093e2292,0x00b96cecefa78e9b,0x00e89924d2c90664,0x00202ec34eeeed66,0x007c80e8eb0a4b4f,0x001583ac4e20de11,0x00de69f7a15a3215)},
+  {FIELD_LITERAL(0x0075e933fa2026d0,0x002c81613d34f87f,0x00839760035063e4,0x0023096d7b7f1804,0x009aed5685aae480,0x00f79fd96fc4c53b,0x00cc14a57186d2dc,0x007ddd4a3a43bc36)},
+  {FIELD_LITERAL(0x0050b8e7ef393522,0x009e7692eb47a7de,0x0064c7da68b9e245,0x004c9cad19e1eb23,0x00201b4053343175,0x00568389c1b58744,0x000e3936b1adfcc3,0x0071666512e2fe60)},
+  {FIELD_LITERAL(0x00243efc75e62cfc,0x00121a8550e02772,0x0060222fb647b9f1,0x005fdd2796a2a91a,0x00bb08877bd5263d,0x004297d33e8abae2,0x00a1ba7fa6df30f6,0x00955d5a928fc9bd)},
+  {FIELD_LITERAL(0x004a493265b3b271,0x00cedc6e9abc3f6e,0x005f672991e6c979,0x00457875775af4c2,0x00baa5ee62629e5f,0x00b68db08bbf4070,0x006e5ca9c502f519,0x00eb932cd52cfe91)},
+  {FIELD_LITERAL(0x00d72d4521796b14,0x001fc592f97eefbf,0x00a4c72fabca1c4e,0x00b1b7fd98455bcb,0x005a8ddcf8334720,0x008d8a2dc80d6bf3,0x00a1820fe5c3b7b8,0x0044f360d6ccf19e)},
+  {FIELD_LITERAL(0x00d7f408a0e83320,0x00981bb5062354a9,0x00cda84d94b72c9e,0x009f684f63421afa,0x0051bc23ee39990f,0x009a6b79061868e3,0x009138d4be465be0,0x00be4e2af30acd84)},
+  {FIELD_LITERAL(0x00c11d73ab7b8b00,0x00d9c6bffa5a8059,0x00b02ba1a4b0da44,0x0005beb199d042fe,0x0010310cbec90f73,0x007df118061c6a5b,0x00dc684a4e36e6a7,0x007b5b2b04488f95)},
+  {FIELD_LITERAL(0x0077b8dacd41ccb1,0x0083a64c5dfe505a,0x00fde54ca3d7df7d,0x003aa1e22fa12343,0x00201e4338df279b,0x00b2c2c3f0cbdab4,0x005f72daedee8a3b,0x0075bf8c205153fe)},
+  {FIELD_LITERAL(0x0012c1ff8f0b2a9d,0x00066dc806b1adf2,0x00e2658db9f00d02,0x000a141b08709c5b,0x00d686e5528a87e4,0x00f3a0333f23731b,0x00621f34ca3a8070,0x006fd87012bca353)},
+  {FIELD_LITERAL(0x009403473c2b72bc,0x00f5ab2227abb496,0x00256e38ea8b370f,0x008cd6a42b8f04b7,0x00962f26d0c91c1f,0x000a2c264d98c763,0x00076837adf4dc1c,0x0018d33c17050dc3)},
+  {FIELD_LITERAL(0x0099a619e1ce68e2,0x00468ad9535507bc,0x00a9567835e5cf5e,0x00907d656deaeeaf,0x00d77f6d55262361,0x000dcfe626e4ab22,0x0010973e28b5a6aa,0x00911e60c85f6f4d)},
+  {FIELD_LITERAL(0x004a4acfc1f97877,0x0098d82e2a7b7d5c,0x000b37bce062aa25,0x003912542654b194,0x00542ca0b34d3d94,0x00d88679b80e0ce5,0x002b3ed4602ab1dd,0x00ec1581a1d2a3c5)},
+  {FIELD_LITERAL(0x0090712b45dac7a0,0x00f5d7627cc11236,0x00f51bccba5dc50a,0x00c375bdc9957063,0x0004f420a4a00849,0x006860c3afab2f15,0x00c809cf28d9f1de,0x00d246d9ad778cdd)},
+  {FIELD_LITERAL(0x0083e6acfc1708ed,0x00121a4ee5d99c21,0x00e0a337de8a52d2,0x000f27df629fac31,0x004b81e6066b09dc,0x0028cffceaedd100,0x00cbf7250219b37d,0x005285fb5d9e0d33)},
+  {FIELD_LITERAL(0x00c2ff08a31c710d,0x0054b38d97dfb25d,0x00de4f8e38f9589d,0x0038f559a3a7eca8,0x002acc37cbb0823e,0x00d16cbdc5085c6d,0x0098d362e61f7a6b,0x00140d9f01c30f84)},
+  {FIELD_LITERAL(0x003a4b9170d3eaa6,0x0013770395279592,0x00b74edfceb08de0,0x00c08a03c5a609b3,0x00b7a77b89fc665e,0x003515a4436d5768,0x00758c3fa184c7d0,0x001b45b5e0d3bd86)},
+  {FIELD_LITERAL(0x009f14355100dea8,0x006dd03991fd1dcf,0x002f19313db707cb,0x00d0502a10ca6013,0x00b5fa40727ad74d,0x00299b4e1555b981,0x00e027a1d1626c6d,0x0038ab7dc4d44daa)},
+  {FIELD_LITERAL(0x005c47cda00e8877,0x007d0c8415dbfab8,0x00bebf5bf774dbf8,0x00a75d2a22a791e1,0x0027ef18f5775be4,0x006fb37699b3679a,0x00c2ebeb3946665f,0x00b2f63f5a3f54d8)},
+  {FIELD_LITERAL(0x00c0a78dafb3327c,0x0047fbacce940c3f,0x00e93b4ac4751939,0x008b76c7b5a9cdfd,0x00b46b3fb35da531,0x000580778567140c,0x00fd9696185b8cc1,0x00dd08b8c4e6b38d)},
+  {FIELD_LITERAL(0x006a4e23cf278981,0x003010455a840782,0x00ffd28207a7acc1,0x0047699f42df9b31,0x00dcdb81e981dbbd,0x00dd81d6b91963b4,0x008bc499713b4e44,0x00bcae008a29f2e4)},
+  {FIELD_LITERAL(0x00a138c1154dcd21,0x00d5c0218fd80baa,0x0035977e5eb576f2,0x00189b2fadf0244c,0x0087a3e75d464bf3,0x007ce248fc21c441,0x005891b7403398f1,0x002146ec1429bb71)},
+  {FIELD_LITERAL(0x00791360604696fe,0x00ee608b1176868b,0x00b9152a109426bd,0x0090c5bcc52d0dfa,0x00ca15bcbea7e192,0x0001eacbdb74f510,0x00488f629923aed4,0x00aeb789a3ceda06)},
+  {FIELD_LITERAL(0x001e3ede5281da82,0x00aa2e4fcaf32dc8,0x00b5c3ba7d701de5,0x006b3bd2d1ea82da,0x00e8a11bf751ecba,0x00c2d5c4a8e72a4c,0x00db3cff28257f9c,0x008973f7547751dc)},
+  {FIELD_LITERAL(0x00cd01bd9f8c0025,0x003c7c0d538685e9,0x000c19c02a6348ba,0x00f6ecb3f279cace,0x00d72c212ecb62bf,0x00472fe03e879923,0x00515ad320467bd5,0x00e9c05756a02abe)},
+  {FIELD_LITERAL(0x00bde04e14827466,0x00a64477cf37cbad,0x00c133b383502478,0x00ae6ed49ae3b235,0x0082d5189b392830,0x0045a89ca00dc206,0x00a7d31c23b4bd2c,0x00faf43ab55b0809)},
+  {FIELD_LITERAL(0x008cb09487567f20,0x00c67a347920fc24,0x005bf7c529a57751,0x00d9c321514e893b,0x0036981548eef713,0x006220d3028a406c,0x007300dc5d07b011,0x00c4fb4a9db67162)},
+  {FIELD_LITERAL(0x00920263d80df1af,0x009039c2c5f32220,0x00d9836b082b4da6,0x00abdab5eed6b186,0x005da5ebbaa3df49,0x00a56d011f05b4e8,0x0055786a88d6a262,0x001c41501c3412ab)},
+  {FIELD_LITERAL(0x008c421a597a45e9,0x007bbd137784aedd,0x0084d791f89c164a,0x0079bfdc5ba98221,0x008691e3dc0e7a7f,0x00cbf36fed7181d7,0x00c8cedb6f838b45,0x00e1e2281b24fb91)},
+  {FIELD_LITERAL(0x00afeb30a2db6472,0x009627beac706056,0x004e1cc882bff593,0x006f1c39f7202884,0x003ce0b71c4adbb5,0x0072d967ed41aaf0,0x0043e9475d284ed6,0x005400e4b223bd19)},
+  {FIELD_LITERAL(0x0043659eb6429cd7,0x00d7884f638040e0,0x0049ad61c8b9c610,0x00f170b57d686f93,0x00bb8444ee59df1b,0x0012190ec4c53a35,0x00be4fd23986f7b1,0x00cb9efabae6c70a)},
+  {FIELD_LITERAL(0x00b27c57053b39d5,0x00d0c9ab2684d511,0x003c69a8fc0db4d6,0x003225132813dca9,0x00f456f351f738d7,0x00880a34d17c886a,0x000ede23fab46aae,0x00a19334a18ca33d)},
+  {FIELD_LITERAL(0x003305d75422e934,0x007743e7896eab77,0x003167ddd99072b6,0x00a76dc3afcc3ec0,0x008fade22130f3aa,0x00957c8483d0b3be,0x006d89cccf5dd41c,0x005ae02af67924a7)},
+  {FIELD_LITERAL(0x00f84f9a8e6a9ddd,0x0088e189bef28d39,0x00e940d8a0acfa1a,0x008fc9e16c2c4a2f,0x00f8f101f5053c80,0x0058fccd1587ed99,0x001d5edd4a66a517,0x00a7de82479b23fb)},
+  {FIELD_LITERAL(0x00e8b920516f36af,0x00a8d6bfa1794d6a,0x00295a0ea8661d3c,0x00406fb67554bc94,0x0045c76c7bac7092,0x00d839d6f8194c5c,0x001ee6edfe0752a0,0x006f0c203bb47738)},
+  {FIELD_LITERAL(0x0073d002b23ab455,0x00bf05328d5a9d46,0x007631d7142e5174,0x005b599694f0ba0e,0x00aa4bf22de0264e,0x0071be645615f5a9,0x00668eba72be560e,0x00dded6fa13f5f28)},
+  {FIELD_LITERAL(0x003e8998b3d3c46d,0x00e87a9142f0eba7,0x005ca54eea36fd1a,0x001f3c45fc7e3afe,0x001010e0bbeee0ae,0x006e842645d89bdb,0x004144dcbd4a303a,0x00c69b09fac158a6)},
+  {FIELD_LITERAL(0x00218c2d486b5e1b,0x006eeabea6e84081,0x00c62b248b193e7d,0x00a98818de7c1f7e,0x000f85ba19e429fd,0x0052987b4e53d0e7,0x003eec2658ca1652,0x00160e704dcee359)},
+  {FIELD_LITERAL(0x00517611fe966aaf,0x0056cd0801ec02d7,0x004d9390d1eb1eef,0x00a64fdb39dee89c,0x00f08cc33d9dece9,0x008d1f803598ef63,0x00e04823da12bc2c,0x00c304b92f7d7a40)},
+  {FIELD_LITERAL(0x00ab0ccf612ff7f6,0x00d9e28cb1c4951e,0x0096fe1802c03778,0x002c6f19f636c82e,0x003d7e463eafb17c,0x006d3f46ec5b23c3,0x00ba320c8f07f4f1,0x00457889ccd86109)},
+  {FIELD_LITERAL(0x0089e10fe416d2b9,0x00d7f4b0e276410c,0x00b2826b34d83886,0x0044b7fde12a32f8,0x00ff6b36d114beef,0x004295a62030d7b7,0x00797b9b378f69f0,0x0061d86652ef9059)},
+  {FIELD_LITERAL(0x00218a3ff50fc1f9,0x002b470cab81176f,0x004a96053a5bbdac,0x00c8ffeadcbb3083,0x003b6cbf39384ed1,0x009b4e5653c3d56f,0x0029a11666309a9b,0x00a4803ea584e5bd)},
+  {FIELD_LITERAL(0x00c9c2beb9c66dc9,0x00b5eabdd6a56020,0x00acfdf55d2a5c15,0x002c917a0d861c95,0x00512bd3f141bfae,0x00289cd9817bfb5d,0x0038a8157ffd0094,0x00a6a6badc7b97de)},
+  {FIELD_LITERAL(0x0066c3cd64d9fc53,0x00a2f5153a54b31f,0x00303968569de064,0x00dfc758dc42c448,0x00409a945ce9ab27,0x007df99fa6822dd3,0x00049edc7be06fcc,0x0021cc1f91ff1cd3)},
+  {FIELD_LITERAL(0x001abf12ffcefe47,0x00e83b756178b89d,0x00503f3510d8913d,0x00c1dc2f99fad8a4,0x00bf0ee71629c68c,0x004f594d28391036,0x002d03010b81a053,0x0050d0f83699f0fd)},
+  {FIELD_LITERAL(0x0049e540ea75811c,0x00731accb11a746a,0x00a12e98e1649331,0x0011df55a0c4c73f,0x0089b0af295c6b12,0x00f9bd150f2b85ef,0x00c287fb3b8eaa3e,0x0047a5146ef33850)},
+  {FIELD_LITERAL(0x0040308e449eb344,0x0049f4eb1527b962,0x00b412d43c36e10e,0x006c1751e504e415,0x00e619ccf7fec4fc,0x00f8455bec00a638,0x00b381ed68cb4163,0x00884fab461e1e37)},
+  {FIELD_LITERAL(0x0038b2f62ca0bb7d,0x003457511e7ddf9e,0x0085c0076b8e7e88,0x00c73c9f30bd0913,0x00b6f9f0118f9ae6,0x001e93b502187a20,0x0069088c592640b0,0x00619cc6088e46cf)},
+  {FIELD_LITERAL(0x00345e739445ec69,0x00c9f6bd96686959,0x00cfc0917613e00a,0x00caffbd5092eaeb,0x009af11b0aebc3ee,0x00d512b9705ad513,0x00397533c6ad785c,0x006e1f58f3cb013d)},
+  {FIELD_LITERAL(0x009fd396c6d2b52f,0x008947948082dc42,0x0061c4fc580581c3,0x00f11f673b260b55,0x00ac1ac4d128efc8,0x004c68ae3712405d,0x002bffb4bc021824,0x00f129340b3c6e0b)},
+  {FIELD_LITERAL(0x00fd9aa2a649a9a8,0x006a468b4ae66937,0x00190b571b8cccd1,0x0050a53c347d4cc6,0x00486b5c2cb8701f,0x0089afb9f56be849,0x00b5ed3250eddfc4,0x004f19a26d21807a)},
+  {FIELD_LITERAL(0x00c615bf1ac7de34,0x008f3820363a3963,0x00de9c24f8f43097,0x00e9e912f1b232d1,0x008f659575605d3b,0x009c16757ae1cc4e,0x0095c740558b5dbe,0x004bce581851ec44)},
+  {FIELD_LITERAL(0x00f800d0e851c4a1,0x008d7fd200642638,0x003a29c92a47884c,0x00d0c630c6897334,0x00dcd5734c143176,0x00783820f6ab0f16,0x002b068be18785fb,0x00dbe6c967ccfdef)},
+  {FIELD_LITERAL(0x001b70f40ee4ea80,0x009bbfe172199fed,0x00d7004789b5ed6e,0x005105635979fc55,0x00c00153d2acf8c5,0x00e5a44ea1f4d587,0x0028d24c9babbfc8,0x0004aabebde3152c)},
+  {FIELD_LITERAL(0x00e56a98f0f7058a,0x00d2ffc1bff08bca,0x00de9d548962cdf2,0x00aacb8742629f3d,0x00766e114df92518,0x0021e9d8f38f57d6,0x0077db22e97fe83f,0x0090a3977c384e36)},
+  {FIELD_LITERAL(0x00d92681acffa1ff,0x00cf77f3644a7eb8,0x0043ae28955fe958,0x000831fa2915dfb3,0x005e499df9319e69,0x00eb72b09903b18f,0x00412fd40275f48c,0x0038bfa693a69f5a)},
+  {FIELD_LITERAL(0x00471c510ea7ca2f,0x00c76a677482f703,0x00b98c216e86c81b,0x0037007aaf8b4bfb,0x00aaa4092551467a,0x00e1f6b039725779,0x003a042bb4f120bc,0x00a3deff9569a98c)},
+  {FIELD_LITERAL(0x00e788d337da953d,0x00143845146708fd,0x00942938153cf4ab,0x002f6c85b2a8f4a7,0x007a69b8b85d5777,0x0023768f0321e385,0x00baed43f23835ef,0x00c546a0fae9f724)},
+  {FIELD_LITERAL(0x001828ca8dbf7d1f,0x008c4db0552ce563,0x005bcb7235eee507,0x00c1ce20216384f8,0x00916768ebcf4858,0x00ff8df3b1152131,0x000dde64edb05f29,0x0022f276a6faf176)},
+  {FIELD_LITERAL(0x007eafca2811305b,0x000478b3e8894ffe,0x00d388ce8ef4b40f,0x00bc14446b6d90e2,0x00777fe53d4c9c05,0x00ffdda8dd82dbee,0x002e60aa24245008,0x00504c7a09154422)},
+  {FIELD_LITERAL(0x006a325c68d5553e,0x00de675d15285c60,0x00fdf1ae99db215b,0x00169f3b66dec668,0x009416aeb57d2e72,0x009ef8ecba13699f,0x0068014b3b057b4f,0x0093cc74aae08999)},
+  {FIELD_LITERAL(0x008c838b59d48154,0x00b76b233cfc805e,0x004c08b904feff1a,0x005ea9ee1f730c9c,0x007ba3e00f72f08b,0x00d716e00e16752d,0x008b16b18f84c9c2,0x00090a9a06c90851)},
+  {FIELD_LITERAL(0x0076e856bc802517,0x00803b04503694a5,0x000526c03db9b30e,0x00fa928cf94af146,0x002cf91bc12707c4,0x00bcab32b1d09eec,0x00099fb77e94d356,0x0002c0c3d323d310)},
+  {FIELD_LITERAL(0x00ef304f062e56af,0x00cc22da3b22e5e1,0x0023cdb752e94781,0x00fedb80d8738538,0x00b9ccee89d78130,0x00841de211e6190d,0x004389029b6b3000,0x00d9c12f813b3528)},
+  {FIELD_LITERAL(0x008176bc25ee6649,0x00020f5e9277e6ed,0x00d32ed33fbf55d9,0x00c4697b8e4e7821,0x007f27a9cc0119df,0x007779902ee83348,0x003303275189b544,0x0086f8f051a87d44)},
+  {FIELD_LITERAL(0x006d0d765e30eb48,0x0042b8124365a18f,0x00c57c5aa95736ab,0x009e6136fce580ac,0x00a095634cc2261f,0x002f3356e3d9400a,0x002b91d8d54610b7,0x0073ddef3a7aa6bd)},
+  {FIELD_LITERAL(0x001041cbbf605e76,0x006b1bd4ad06c568,0x00fcc9d790aa1b3a,0x00229c636ab6ba57,0x005d904e7b4a2b9f,0x00b092b566df407e,0x00aa9e63d08dab68,0x0068077abbc8984a)},
+  {FIELD_LITERAL(0x00679167bf75a682,0x0096b2b9c05fc9b0,0x0006db144ec47e5e,0x00b8710f41e16e9d,0x004f1265e6b865e0,0x00c6b33081d51631,0x00036ef9f7171b27,0x004deb4493fd3281)},
+  {FIELD_LITERAL(0x0088f60826f08dde,0x0099f6c492dc87ad,0x00f0fc063e7dc836,0x00e5d9d74eb15c4d,0x002728df57c62537,0x00c3d2fb539d9a13,0x00c64b39d3668eb0,0x00c9d3b08944112b)},
+  {FIELD_LITERAL(0x0092780169bbff9b,0x00e02a7bcddd1bff,0x005efa91e2691609,0x00cd18aaf4fd306b,0x008dc112d250dfc0,0x008a933b48249bce,0x0070694366219aff,0x004a7335585f1bfc)},
+  {FIELD_LITERAL(0x00cdbc1db3dd7acf,0x0012a8166662cf1f,0x00cdb53494c1d566,0x00b532c368b0823f,0x00ce6db8a3e6ac6f,0x007dfab115ee5e8a,0x0076dd9ad055d0b1,0x000509af9d2390ea)},
+  {FIELD_LITERAL(0x00f7fed81253752a,0x009e0a84c5487b1a,0x00fb49d0e0d8e000,0x003f149baa418f77,0x006a509dd1a99a04,0x0084afca58b05ebf,0x0082c9ae8c9628d3,0x00b60fe300249f60)},
+  {FIELD_LITERAL(0x006511809d5a8e10,0x00e587d134716d02,0x00192465dc29d8e8,0x00d421f4a4d7fc4c,0x00973866ad0d3215,0x004a1c47c4f2f1b4,0x00b96f6f61c99e37,0x0096976cdc48a53e)},
+  {FIELD_LITERAL(0x00477e8534857d07,0x00aa450b0704271e,0x00c36c7792c55dfe,0x00a189c47bebd66c,0x0034a55dd29a4e6b,0x00c429d492e8f918,0x00aaa2f8ee13ff8d,0x0083a9ed0790318a)},
+  {FIELD_LITERAL(0x004fdb77f764f0f6,0x00c51528f8896146,0x00867ef2c7f8bac7,0x003f51be39d8cd23,0x00bec09af03a2173,0x00cd678b2034406d,0x00ec74618cb3c0aa,0x001431e84fa795b0)},
+  {FIELD_LITERAL(0x0076c8f859b318bb,0x0001c9d2a5063b8d,0x00c336fb40d163a7,0x008952974e42fd00,0x00e0a61e6da7891d,0x009153f3353ba46f,0x002c1ab122fe20c6,0x00d8ab843059c472)},
+  {FIELD_LITERAL(0x004b34dcfad5c3b1,0x00cf0adffe60e3da,0x00d0a0730ec99ebb,0x0038ade81621af6a,0x00442b0f8b8fde3e,0x00253f7cd15a9741,0x005dd99e6243ba2d,0x000dd920f8ae3d12)},
+  {FIELD_LITERAL(0x002890b0635e4f3f,0x0070146ef3757a2c,0x00c49b4c31d4256b,0x007976cf1260e548,0x0011d814d3c2b065,0x002416960c3c21bc,0x00d13af311759f81,0x0096ecdf001de0f5)},
+  {FIELD_LITERAL(0x000089fa4bbb31fa,0x0025d9208de8497e,0x005d3fadd7240daf,0x00b43f2be9692a69,0x008d3b6cb0cd8241,0x009fc990da3c22ed,0x00b5bd1a8b868e6d,0x00840e6d940fa589)},
+  {FIELD_LITERAL(0x0000950406fb8c3a,0x00ec25a9825c5667,0x00bd5d61aff17f92,0x00a8f1ea07b98212,0x002e90a6e6b39a96,0x008829f2c39b098d,0x00476d2a0a82e7ca,0x00f5179b109e4dd9)},
+  {FIELD_LITERAL(0x0017cb0c05428f0a,0x006c50feb5115a57,0x009618ae8d821c0f,0x003231215811f43a,0x00cf9d06e4106d30,0x00cf2226252584fd,0x00d7ef3f1d4090f0,0x00930cf4ea0fc1be)},
+  {FIELD_LITERAL(0x002bf970a65532b4,0x009dd5c9478dc055,0x00eab588a82121ab,0x004a5f2404c29a03,0x000f829323118631,0x00877af71b31993b,0x004e66035ec2e96e,0x007369245020cf08)},
+  {FIELD_LITERAL(0x006bcf34cf1da2e9,0x006a360381087d83,0x003ccb365fe9bc2c,0x00e9de135e8570d2,0x009503e7fdc60f70,0x00f8f268b16bfa0e,0x00d1613c7aa9b85f,0x00796ecb60bddc2e)},
+  {FIELD_LITERAL(0x007c6bbf0d897e47,0x0019afdce8e76fd9,0x005aa6074e3d7c98,0x007f863e537f091f,0x00f192f2189c578b,0x00608181cb69e5f1,0x00d7c2b4a2e70d70,0x001fe4b797fa5d68)},
+  {FIELD_LITERAL(0x00994753d35e0366,0x0085e69517e6b65d,0x00ad8f27782640d7,0x00f45269bfea412d,0x00a873c60f45ebb1,0x006c634ae82a66ab,0x00a83349b8061e8b,0x00bc49f7a07d0f35)},
+  {FIELD_LITERAL(0x00993a5b94e69bb7,0x001f51638e58924c,0x00a923208390ac13,0x0052e7fdd1324b68,0x00ac6df208818031,0x00ae725c3127fd8f,0x00fa67f0e7650128,0x00944051385becb2)},
+  {FIELD_LITERAL(0x00e36184f01ecf9a,0x00910c664eb12453,0x004890f9d3869922,0x009da75fdf980c4a,0x0061cb279550795a,0x009b9a795ea739d3,0x00f7a98476d6850d,0x00de4503fe92b8e6)},
+  {FIELD_LITERAL(0x00f0c60b84f74dca,0x00480e3776a37320,0x00245094fd683260,0x001b7eac60dfe4a3,0x00238da15557c524,0x00bcd7b99c733db3,0x00fa308493ae188b,0x0039895d2f6a4c85)},
+  {FIELD_LITERAL(0x000036fdf7be8124,0x00b4778d9287c391,0x005921a969887fd2,0x00c894ee5ecba43e,0x00fffb4868de5a9e,0x0029b6042f5059c3,0x00891d2c658546c1,0x002731d6ed08d4c8)},
+  {FIELD_LITERAL(0x00d15d2fc5cad83e,0x00835846953b1a88,0x00f23f96f896670c,0x00d54153278e8a7b,0x0091034667a81870,0x008b2a1dd04545b6,0x004df7526cddbe39,0x008a300265cef660)},
+  {FIELD_LITERAL(0x0081992e9134de81,0x00469a7e386496d0,0x00ecc8f371774699,0x0096dd6c45aae5c0,0x00870f6903324f5d,0x0022c155415a9630,0x0081cc295f37bbf6,0x0095a8d43146183a)},
+  {FIELD_LITERAL(0x00b239196193d408,0x002fb2dd65b685e2,0x00bccca1ed059f1b,0x003ae3f04d9b2df2,0x008ea7ef2ccc2927,0x007bd4011d9a6562,0x00c2aabff07afb34,0x0036e567895a5a32)},
+  {FIELD_LITERAL(0x007c25abe5e6005c,0x00c9aaea796ae478,0x000c4ea71ef13972,0x00ad5be092688e7d,0x00134287898edeb0,0x0068b8bb542b5e88,0x00a575360e3e23ba,0x00a80f3d1e3164c4)},
+  {FIELD_LITERAL(0x00a02dc7257bf841,0x00f40f2aa36a1bbe,0x005c0bd5db94d4c0,0x00c56b0ca85ed7aa,0x00b124ca2745b968,0x00ec91d0c1c79752,0x0062c504d645d5dc,0x00a168920fa764a8)},
+  {FIELD_LITERAL(0x0080a50ab532f319,0x0048334393d72c16,0x0007c0859ec7f424,0x00eeb898d1042755,0x008f9276f58c65f0,0x00e65291bc886aed,0x00663d431683ff06,0x00406c2ce131517e)},
+  {FIELD_LITERAL(0x00ff670c31c6854a,0x003accf251215eba,0x0040f9cef76abf88,0x0016580ebe899a89,0x00cd11b7fa0035db,0x00cccd7ae3970e99,0x000701eb356110ee,0x00bb156f3d49286c)},
+  {FIELD_LITERAL(0x005cc368e7e2f44e,0x00f5eb103f6379bd,0x0055d31a7a2c5466,0x004b1ea280fc8479,0x00da27e6496c7b5b,0x00668715e4ceb035,0x00c0ba300accf5a7,0x009161bc3ff8a9eb)},
+  {FIELD_LITERAL(0x0076c8abc4a2b368,0x00c82d6f16abab38,0x0088e6a81e6d3f23,0x0090a6cce34e4a28,0x00516a247264a4d8,0x0000512cf409fa82,0x00dffb9a256b4fb4,0x0008c32442d39e30)},
+  {FIELD_LITERAL(0x00aa90f639300e48,0x00c5fb93b46475b8,0x00145a99ea99c0e9,0x00f45e890d215082,0x00b650ada21e4a7b,0x002ff365a8863790,0x0096f29891a93412,0x00bb171074ed1e43)},
+  {FIELD_LITERAL(0x004d1d39043939e9,0x0009cf48fcb78b2c,0x00625082d4331640,0x00f5ac3040f57e31,0x0092a107d4199c8d,0x003210a132525fd8,0x00a95dd581407990,0x003ef64b3d5c3b86)},
+  {FIELD_LITERAL(0x00b79e973ff9fc46,0x00013f718325eb6c,0x0002833dafdc4f42,0x00917e1c81d1f570,0x00b72732f1ec0c49,0x0069f4ac0a882e1e,0x007356b13736435f,0x00d3ca75fa9b016f)},
+  {FIELD_LITERAL(0x00de7747130c93c0,0x0039610474de1939,0x00e7bef18428f657,0x002e3e59a0b31f2c,0x00b70e6e3b72df10,0x0052a24772ed2a0a,0x00d588cf0cf05e75,0x00e0e9cb0c79231d)},
+  {FIELD_LITERAL(0x003534d923aa0bc4,0x00d9ca105d0aedb2,0x00bd2e6512559a73,0x0020a4d56fcedd1b,0x00cbad5491a0598f,0x00d25c1476b454ce,0x002a3b220c16a070,0x00ca84fdf6130b8a)},
+  {FIELD_LITERAL(0x002e33322b91b3ab,0x0002fddfe6a3056d,0x00fd5aff6accdd08,0x00aa319866e561b0,0x00969eb4f54ade47,0x00f4bbd6c8ac40d5,0x00f58afb7a716b6d,0x001b2cc8731835bf)},
+  {FIELD_LITERAL(0x00361bb39e9d3c51,0x006c11ca515d244b,0x0029f6575ea5ca2b,0x00859b3e1d7ce194,0x00f818ada7e21ee2,0x0001428eb604c18a,0x00ce8c7bf7cb67b5,0x00422924207c0618)},
+  {FIELD_LITERAL(0x00b1d13465b01ac9,0x000a66debc66962e,0x0097268839b7ad57,0x0031628278618bb4,0x00a218c3d882e35d,0x00f78ee9b38d3fd9,0x00973bb906357008,0x002a4f1485d47293)},
+  {FIELD_LITERAL(0x00edac673b2ebeb3,0x00d34532fe45a6f7,0x00df9a9c05ed81cc,0x00776dab10ae3d4e,0x00c246e0e588a94f,0x00160262e76d2b0e,0x0012fd20fb1fd9ba,0x00cb211b6cd6247b)},
+  {FIELD_LITERAL(0x00bf5e20526d9ba1,0x0058c15aa65ae430,0x00559f28e21c9aa0,0x0045a003f0c862a3,0x004b6bee21324a9b,0x002fae1f30eb69f6,0x00cdecbe74a02b0c,0x0067e0db6c238508)},
+  {FIELD_LITERAL(0x003db64036a062d6,0x00f7f45316698085,0x0037fd2f6a9541b3,0x002ae06781dd650f,0x00c75fe0d75155ea,0x008a8e4d74b7a70f,0x001bb31204155be1,0x00390010630ff686)},
+  {FIELD_LITERAL(0x00f6d153e1cd4891,0x005f51abdda05398,0x00803965421f5e83,0x00a7f5fd888f146e,0x003a41679b210338,0x00e775b62494bda3,0x00e60774f1c8213e,0x00717a6ebb9f3379)},
+  {FIELD_LITERAL(0x009c080fc87e410f,0x0082264cdc529383,0x001d543e1ab67f62,0x0011fd362cdfac54,0x00b6fb9b57b58e19,0x005b2b7b4f063e09,0x008ada76b7a9253d,0x0034702bff5de179)},
+  {FIELD_LITERAL(0x00bc8ca25e456715,0x00fd91f72f8619a3,0x00e1adb356b9eff3,0x000b06fdf7990771,0x00c6c61a80fb9559,0x003aed7a17e60f3f,0x002cb8b88674b06a,0x00323f0fb7c32a73)},
+  {FIELD_LITERAL(0x007237ccc3d8cde8,0x0081e5d622960884,0x001a8375f473e65d,0x00f25817e99c61bf,0x00c30f597ffb7ae0,0x00eda36b5f272d37,0x00504c2046d78e33,0x00df9d36e908c6aa)},
+  {FIELD_LITERAL(0x00041cb835af708f,0x00bff595ab287b99,0x00a709ea2e3b36ca,0x0024dab6a7c42fdb,0x00babc2ec06289e0,0x00ac0d026cae57f0,0x007dd5552e4e4eb4,0x00b5df584fd68ef6)},
+  {FIELD_LITERAL(0x00372c6c01db6b6a,0x004080a9895faf9a,0x00a00cc09fe164e2,0x004c9008a360476f,0x0013236126a7138e,0x00a4b3fa180b8821,0x00dc940d79f5a34e,0x0033769828085aca)},
+  {FIELD_LITERAL(0x00420c47afd073a8,0x001caaa65d98196d,0x00726e3944df9334,0x0089529a3fffe47c,0x00b9b939418a7da1,0x009664a5d8d0e0c2,0x00e2bcc8b080277f,0x006da5f4367a960d)},
+  {FIELD_LITERAL(0x0069d5eabd2714f3,0x003a9722c216e9cb,0x003414dab729c9f4,0x00a81315d9b8fb90,0x00aa87d483e9a5e9,0x0096e66ec5fba1cc,0x007fe1bd9785c353,0x00a9d27eddd2d1ef)},
+  {FIELD_LITERAL(0x002144d98825860c,0x00fe2604301de852,0x00a70db28b689ba7,0x00873667f46169e2,0x006db6d14692fb94,0x0002563d846c3d8c,0x00084a89d73c9955,0x0046aa8884703fb0)},
+  {FIELD_LITERAL(0x001c7754df52cbbc,0x00942d3206baac45,0x00511a7fcc159a64,0x00b008f2774273d0,0x001e2f98168e4c10,0x00bc0effae409bb6,0x002cf46aea0f4621,0x00cab0e428ae23af)},
+  {FIELD_LITERAL(0x00740ea02a547c38,0x00507d715c4bca01,0x005d90c678df1ab6,0x00641101f19ca1eb,0x0039a810f921c0c3,0x003f62e8cda90415,0x00618248bd38fbf9,0x00da1b52b9aae414)},
+  {FIELD_LITERAL(0x001e1b4b6d1cbbd5,0x000b3b104e092bc8,0x00e37eb983730900,0x004e7e515ab0e128,0x0000b8ef562d39c6,0x00a63669e5870cbb,0x00d96cc496f4f42e,0x008f4cce10fc5657)},
+  {FIELD_LITERAL(0x00003f8df539d9d1,0x00f01ef00c531381,0x00a758d675f547dd,0x00492691ee10859b,0x00b7fe481b9f312c,0x00846bc5f6e6a5bd,0x002a3d8bac6d13bd,0x0065b7bd0d67e500)},
+  {FIELD_LITERAL(0x00ee7f951de22cbf,0x00dd0dde6f676c88,0x005c86227816386c,0x00ac063d5930deb0,0x00ab2701586e4d87,0x0021819fbd8696bf,0x00e4724ab48d453c,0x00911c20cdbaaf7a)},
+  {FIELD_LITERAL(0x00c1d3a803c18c17,0x00999ee7055b7fc3,0x00adca99eefe2468,0x00ec3039675def6a,0x00382516967961c1,0x00d9f3c5b195b5af,0x0082ab941cd02a93,0x008ecf450415cfe0)},
+  {FIELD_LITERAL(0x00f187fc0bf0c98c,0x00bf2be114af6332,0x003404b25d6780d1,0x0067177130505ca6,0x00eee4851ea5a368,0x00b2b0bd5d3e0ac7,0x00aa01752fd02b41,0x005c0f2655705ce3)},
+  {FIELD_LITERAL(0x0056d85a89219a48,0x008085a70d99a8e9,0x00932054816cae4e,0x001d434ff424c927,0x007d1c59991b62d3,0x0005ae72ec8266f6,0x000e4236481291af,0x005e05faa6289cc1)},
+  {FIELD_LITERAL(0x00dad4117b459660,0x000737ff6bd7bcbf,0x00f4162a06bcdc65,0x007822173ba3a451,0x004013be4ef6c861,0x000abd5677fb9dd2,0x001e051ba4b97c46,0x0054f56cb554f707)},
+  {FIELD_LITERAL(0x0074def94a7838ee,0x0015dc87031cdfb3,0x003dbe6ea3c43db2,0x00408fb3477f3f37,0x00099b4db968f9c3,0x00c580a04bf26403,0x0002107b21f5f7ea,0x00e78b7e6712279d)},
+  {FIELD_LITERAL(0x00c2b0070ca38b11,0x0016373f3f38cd43,0x007415614087d007,0x00e8afe46114aace,0x00f6fdf0e5c71d61,0x00359a4f6e9946ab,0x00011c895a23463e,0x0012a7396ddf0f1a)},
+  {FIELD_LITERAL(0x00c6725dec3f6d0d,0x00e63025896f115e,0x000dca952b9ef6f7,0x00ad5e33d6865cc2,0x0079d7e98ebdad73,0x00a77a9f244bd846,0x008ee6d331294b37,0x00ae4d2b158548d8)},
+  {FIELD_LITERAL(0x002f8b3e116bee8f,0x001a22757b8e22df,0x00eba017e7133caa,0x00c2abf39f96fd74,0x004af02b3d4c8d68,0x00a5895c70052a3e,0x00977fdae6bc0172,0x00f69323f1c04d88)},
+  {FIELD_LITERAL(0x00e4def7a834f2b8,0x00acd7f91052a400,0x0041ec8b4059eab3,0x002a6615fcd7fba2,0x0061f910bc0fcd65,0x002c6a184cb6dea2,0x00a16ea861a31f04,0x00266c90840b3f5a)},
+  {FIELD_LITERAL(0x0073c10c96039320,0x00023bfb4ba18a2a,0x001b3afff4a47dd0,0x000feaed5ab5a73e,0x0085927fb8804a63,0x0086edfc8687ac35,0x009c2f3d797bcf1d,0x004dcde49aaea479)},
+  {FIELD_LITERAL(0x00ded941799de615,0x00e3192c3cdb215d,0x0003cb07b46e4e80,0x00dd541e352dc258,0x007b78bf40d88454,0x0000af012df3847b,0x005a20e3e6b14305,0x004a96b0909321c9)},
+  {FIELD_LITERAL(0x00b7b3bed808bb38,0x0014839e01f28b72,0x00d12f3b798cfe89,0x001cbe87e4dda428,0x00d67e9e1d785972,0x00eb2f4bfd4e4d90,0x000fd8058789ddc3,0x00e32e3aa58ba1c3)},
+  {FIELD_LITERAL(0x00dfd1fbdd8c7140,0x0013f7dd4085243d,0x00aa54337dbb1e21,0x0043014ca198a7a0,0x00f29ed6ed98deb0,0x00993c44a043b857,0x0018a8416f943be9,0x00cc386eae87d952)},
+  {FIELD_LITERAL(0x002ac0a0685db16e,0x00d9acc2b8797faa,0x001903cdda47eb86,0x0075e4de5798572d,0x00ec08c9f8dc9e1f,0x00e063c867a1ebd2,0x003ef4a20abdbfbe,0x00278f6ba4aed180)},
+  {FIELD_LITERAL(0x0028eeafe4335c22,0x0075cc52e9a27eb1,0x00a881dcda77536b,0x00a5920a8a0f1366,0x005bba8d594fb8d2,0x00ec7ef84a2fed30,0x002dba35beefaea0,0x007104b60727b05e)},
+  {FIELD_LITERAL(0x0046050389967ff7,0x00c03b7e803d9d2c,0x00661baade038425,0x00d8db5de3430ba3,0x00f834eeb604ba0d,0x003a9e4d55d038dd,0x00745dd02bf94b9e,0x00552301b1d06843)},
+  {FIELD_LITERAL(0x00557b9f248251b2,0x002422aa8be54fd5,0x00afda6fe1975af9,0x00ea76870a029f58,0x00da4583e9280ff9,0x008705b44f9feae6,0x00bb421a02d8d3a6,0x00f30136781461ae)},
+  {FIELD_LITERAL(0x00a698225dec1b8b,0x00f17375799d75b3,0x00d090e7fdaf5d3d,0x006530929806d10a,0x00faaf6202d62841,0x00cc9a6e15974415,0x00aa549a95b60502,0x00ad1e49bff67cce)},
+  {FIELD_LITERAL(0x00207e8efd8ee561,0x001681f4906e360c,0x0017280a9f435261,0x0096c87c91052644,0x0052a007e34c3d3b,0x009627b995ba2d20,0x0071df09d2e87e13,0x0072354bd4fdf690)},
+  {FIELD_LITERAL(0x00435ecd5b74a400,0x00936c786bfc28c3,0x00961e625397fd2d,0x00ce37d3b36901ab,0x000bb6356a82e651,0x0051e23da50c5eff,0x00551c9a6f437400,0x00e9ac004b0a8954)},
+  {FIELD_LITERAL(0x0027ae01e1c91df0,0x005ff4514e9eaaa4,0x008acc0f1a7331e0,0x0024f8438cf40a11,0x007226c502a8d8ea,0x00485070c9cb36bf,0x00d69e739285b71e,0x0073213075242634)},
+  {FIELD_LITERAL(0x00ebe4f56af4d1e7,0x0061ac401a701eb8,0x0017bcd0340dc348,0x008e08889c2955e8,0x00c9cb7470f37713,0x00c899cba4896f84,0x00a693a807b5ffe5,0x00f485c321d317a6)},
+  {FIELD_LITERAL(0x00d12f9dc33b8c6a,0x008041700ec97c6a,0x00a2de5026f831ab,0x005f33bb937ff741,0x0070b0b32ccbe17b,0x00654005369f2686,0x007f75b189db3c77,0x0084ec3f871348de)},
+  {FIELD_LITERAL(0x005393f6a6f3dd66,0x00730e81e4d2f002,0x00b647b154508c92,0x0098c219edfe8574,0x006279aecc98ac22,0x00e36160854f21c5,0x0086cd79084531a2,0x0011d8987a774c6d)},
+  {FIELD_LITERAL(0x0088017266daef78,0x004ad620a8c34853,0x00dc0d98dbc113df,0x00e3e9d18bbf2c85,0x004ced3d30b91b32,0x00d1619925c96ac1,0x0065b5ba321c15ae,0x00bf53f55ff0751d)},
+  {FIELD_LITERAL(0x0066c2c1d48412ec,0x0087bebf82625f2d,0x00e13e40af59e2e7,0x00ad2ff28e560ebc,0x00559f9f33f3952b,0x009765c0ca6b1f44,0x00125bd17ec9df30,0x00122a00b6783e54)},
+  {FIELD_LITERAL(0x00e051d229e726b8,0x00bc9e9d3202879b,0x0014bb6dcc4731b6,0x00bb87ee1d34c952,0x000e41645421f2ea,0x000002064603a0ad,0x00393e3dfd41ccbe,0x00232b7f8ea3b69f)},
+  {FIELD_LITERAL(0x000e91237fe62e03,0x005bba7204ff5c77,0x005abeaa41a6186f,0x0051b25c707eeff6,0x00b53e25f7b5f363,0x0055cef5a8c91b37,0x00c27817180eaa1a,0x00783e015d7cc681)},
+  {FIELD_LITERAL(0x00f8c8ff8d90880c,0x00f3d0b5c00ad5a2,0x0001db9ceea28e9f,0x00c8f821e7dcb235,0x00a71776a18c0ec5,0x00b98f348aa8d707,0x00da250bed812bbb,0x0095633a9aa0f9cf)},
+  {FIELD_LITERAL(0x00491db0e5f49384,0x002ea80490efa917,0x00a0151052357b5f,0x00f57d8ad2c06541,0x00370b2474c8f81d,0x00bae667d692ee09,0x004f507c9e7c6abf,0x00dfdcce1440f845)},
+  {FIELD_LITERAL(0x0076ec6a3314b8d5,0x0097c74877c3582f,0x005c72280b0e5e2b,0x00f3fd386ab820fb,0x007c5cd0cd31c932,0x0010bf43a8228112,0x002a13f83167fa4f,0x002e84e2a735b206)},
+  {FIELD_LITERAL(0x003baebd57cd99c3,0x0038177b169cf682,0x00d5169256e44690,0x00c444e0cbc420f9,0x00a82289cd4fba39,0x000a95e1242965df,0x00b92623874e0f89,0x0025086202cd0d5e)},
+  {FIELD_LITERAL(0x00af0e0c1249cc6c,0x00ef9378860457aa,0x006b2e75ab82371e,0x00ed73fd42b45b11,0x0052e7cfd4a76a26,0x004195e5b479d2b2,0x001c62b16abc033c,0x00f3755c92061606)},
+  {FIELD_LITERAL(0x00ddb98bfa81a02a,0x003743403c5dd843,0x00eef782fa99afbe,0x00fd1b4952af3561,0x0026cebd1feb7e8d,0x00766c4e087ba697,0x004c473e82c4305e,0x00d28acd42da1683)},
+  {FIELD_LITERAL(0x00003ed4e4ac8a10,0x006e4190a8e581d1,0x00881548d2f9d599,0x001bd43095922aa7,0x006c7ee86ae6b076,0x00b0aaccfdc4c7ca,0x0089f1e550201859,0x0057d717913043b5)},
+  {FIELD_LITERAL(0x004d0959898ed883,0x00846433ef565802,0x0071dca3bf62195d,0x008696083898dcee,0x0096327ac8567732,0x00341d277fe2e17a,0x0030a965c8469812,0x0044ea7df6ec1415)},
+  {FIELD_LITERAL(0x003a6c99acc4d97b,0x002ccfbafee2d09b,0x00df4343dbeb013a,0x00c1a79602d2e6f8,0x008b9f5da57792f8,0x004da0a6cd95140d,0x000de0933e973b17,0x00fcb6a6a7aece9d)},
+  {FIELD_LITERAL(0x00246724ad975686,0x0038682db94bb297,0x009a246a2cf7c93e,0x00ca4f42889caca0,0x00e0b63d7002e97f,0x00dc09373e94ad8b,0x0010491b7818bff7,0x006193bbbf7a7ade)},
+  {FIELD_LITERAL(0x0016cf77079fbcb3,0x00fbe42342ccb705,0x00b65dd0dd058da6,0x00f640a555a84857,0x00adbd5c2a1e84ec,0x007aa2f493b64efe,0x00514440e9a0fa09,0x00f98ab65a3135d4)},
+  {FIELD_LITERAL(0x0075b1739947aa0a,0x00c881047855d22c,0x007f6c888f164177,0x00d1f5f8586ee6e4,0x00a0fa2d65018dd0,0x00aa69714b7c4d0e,0x006d16f6d402225e,0x00c357d27a8f7208)},
+  {FIELD_LITERAL(0x0068d104529c69f7,0x003f42de679e1309,0x00b33d833977b216,0x00f3885af13409a2,0x007a42960e62dc81,0x00e47530b2b6cca8,0x00d3e464ced02a1a,0x0087bb5d564a6824)},
+  {FIELD_LITERAL(0x001906d21ae9a347,0x003617227cab9fe3,0x003aa3f7399d8606,0x00b63747c91c5be6,0x00423a5ce4b6ffa2,0x00115c5308607bfd,0x00f2cc99b080db9d,0x00c894ab74e82b7b)},
+  {FIELD_LITERAL(0x0007d567a2d328fd,0x00c802682c174b00,0x00d5d7d5537c58a6,0x00ff522e8984aa6a,0x00d2607b8a95842c,0x00c015769bc4dedb,0x004c255cc47c9e08,0x00e15362a482dbed)},
+  {FIELD_LITERAL(0x001bd55f3941e1be,0x00cdbc5bcae5724b,0x0031448f81e5fcf4,0x00ffd74283edc6cd,0x00f185d49899d0e8,0x0066049de740789e,0x009253715c2efe54,0x00a2d2fc1dd27034)},
+  {FIELD_LITERAL(0x00c52dc96c64cf98,0x009d415b1121befa,0x008c6a31c7b68e7a,0x0080068943c766e8,0x002d7c4b06984b27,0x00f8180b58f934c6,0x00945961a2ad5149,0x004dfc38d567e3cc)},
+  {FIELD_LITERAL(0x0002b6c888b0a29f,0x000b57198d0d8e4a,0x00779334413abb5b,0x0048c5f74d313173,0x00adc9759b1fd9e1,0x009d0e876d0dd297,0x00445dfe38b14cd9,0x00a4681c7696ade0)},
+  {FIELD_LITERAL(0x00af8619f709a468,0x00168a892aca8452,0x009bbe41c7940b9e,0x003f38f2a44877ab,0x003135749d745b5f,0x0071206fcf79c090,0x007d4f05865c0a42,0x00641c15e4034527)},
+  {FIELD_LITERAL(0x0074df3bd0b04d1e,0x000faad283a209dd,0x0033dc35fe936588,0x00e4541ce33a6e41,0x003f4ab60fc37171,0x004c471129427672,0x009ed0c56dffd540,0x0025fc06cb866d59)},
+  {FIELD_LITERAL(0x0065b620170bb315,0x00823f0bc6889ff6,0x00565a9fef483e7c,0x00115f277063cfc7,0x005ff490b3e0a5ce,0x004a81ab5c53e01b,0x004d814474ee2ed1,0x000629ee178b8870)},
+  {FIELD_LITERAL(0x004e52c9c1cecaa6,0x002f730097fe709b,0x00dd48435476b28f,0x00d5bc9915c82c44,0x0024a640208cd8df,0x00242caa3c422c3a,0x000b76c229c8f9e3,0x00a5eb5e4ecaef8c)},
+  {FIELD_LITERAL(0x00269a919659d7a4,0x00a6e108bdf108f0,0x00ce950c093cf547,0x004f0f7c927f8e1c,0x001eae459bb3bad4,0x00628ff9ae2b71d5,0x0076521c235edafb,0x007d64d68bd6ad46)},
+  {FIELD_LITERAL(0x005a34bcefbd8a76,0x004171f66be375dd,0x005e1cf36f933e22,0x00fd9db940cae876,0x0073021f1a1a7724,0x00c34a18c2fdc8b5,0x0049ff29b5a4adde,0x00125a60a1368483)},
+  {FIELD_LITERAL(0x0098d16413b2f9dc,0x00d92d1e17c73623,0x006348f9990344b7,0x00a696200de28660,0x00366e1cd2352720,0x00984acc36d66c2d,0x007c869d0cab796e,0x00466f59c3fd3e25)},
+  {FIELD_LITERAL(0x0085f9ba7b26eb7e,0x00fa270e52c99ae8,0x00aad3358f7787e7,0x0096413e9051a7e4,0x009debe63bf18e93,0x00e6cd2df34c8944,0x0017f5165392768b,0x0048f312fb86c1ef)},
+  {FIELD_LITERAL(0x00696404e4863582,0x0089604a01694434,0x00380181f2d08ae7,0x00d01862f68f290d,0x003782f3309e0707,0x00cd5a0296905ef4,0x00762eeac008a686,0x00792bd21e613ec2)},
+  {FIELD_LITERAL(0x00ab1970c05105ac,0x00e5c43a211a71db,0x00ef570608369b83,0x00134e1245d2da2b,0x0054259205dc95a7,0x00305b97f51e5613,0x005ef2d5002a3ffe,0x00f458da3935dd30)},
+  {FIELD_LITERAL(0x003191a617e8e528,0x002739a6160c1f4f,0x00c2afb4f67d5952,0x00aa72dd138fb337,0x00d0a1226818a56d,0x00b3d84e9cdee16d,0x00deea8374f7a906,0x000790e0633ea9df)},
+  {FIELD_LITERAL(0x000879f29ad91385,0x00937d446ca64917,0x00387312683890fd,0x00ff0d5088bd5971,0x00c5a3b87b1aefd0,0x004e708c61245cf9,0x00694cabb3f6f2e8,0x0046e73cdaab1249)},
+  {FIELD_LITERAL(0x005b3698fa09da67,0x00b07224defb603b,0x0045d81a16f78ef8,0x00bc05dd5796e3a4,0x0063b3ebbebe5772,0x002402bfef17a9c6,0x0001bdd4e05850b9,0x00e8ac0fc12adfe0)},
+  {FIELD_LITERAL(0x007bb460fc1b8610,0x00d107cad2810c29,0x00fb46bea3d15a8b,0x00e96702c44d042f,0x005dd33ed1940731,0x00ac5a0b6ca89f4b,0x0002867a7c03ea62,0x0070758df17bd709)},
+  {FIELD_LITERAL(0x00c28bd948a538df,0x004464f960ddd19d,0x008c291408f664dd,0x00238a3c445b7a86,0x00d4643a818123a9,0x00be5df90f1e1700,0x00aba8192ea2c9ea,0x0061ce1a602ad93d)},
+  {FIELD_LITERAL(0x0026aa3d1698b5a4,0x00232634403e42de,0x00de768be073fda6,0x00f4cd6f451050b3,0x0049455f91d11347,0x00650fb3d9888bf9,0x00b470fbedf492a4,0x009f3d838fd792d3)},
+  {FIELD_LITERAL(0x003963ea03b4d3e3,0x003b578ea486881c,0x0096f85e6d32f58e,0x00990672c21d319e,0x00339c53efed67e2,0x004ac805c1874039,0x00b916289cb0c9ba,0x00e624acc60c8544)},
+  {FIELD_LITERAL(0x006f67a36b527d79,0x00b3890f0c11d225,0x0062e9f641b08568,0x008865137b8ceed7,0x00e466a6498cef34,0x0038008e7ad93da2,0x00b348ba343194b0,0x00b19edbaf936007)},
+  {FIELD_LITERAL(0x00ff6adfd5141e91,0x00923c7dbcf3fbaf,0x0027b4ecaffbe62f,0x00ce9cc72d6c3973,0x0013562e0869ab27,0x00089c2baee7eeb7,0x00201501c976661c,0x00e458e57febc0b5)},
+  {FIELD_LITERAL(0x006b267eed986197,0x00559e455c2b617c,0x00ed3cf6acde7894,0x009ed1d9f89db0c1,0x00226786e81c2bc6,0x003ef5569fab5821,0x0080de351794db80,0x0064166e50da9544)},
+  {FIELD_LITERAL(0x0026efa81ee9bd2f,0x00aafaae191e8879,0x0089b6dcafd804b4,0x005899dc926f2fd2,0x0017a84c02026f0c,0x0024a1bdf4580556,0x00ab0c3e6829b103,0x00f1582d66bb020a)},
+  {FIELD_LITERAL(0x00ffa17f52da02c8,0x00d13c511d1e103d,0x00962bdc8da84ef6,0x009da81ae6b118fd,0x00f57d5cc74af805,0x006737e7f2fbdd2e,0x006966f8fcd681e4,0x002c8b517d81c7db)},
+  {FIELD_LITERAL(0x00145c38a9738678,0x0030abd2a4804fa0,0x000716944780af6a,0x0080e88bf853ebc8,0x009120c3dcf82bc0,0x000a54fa2fb6ce90,0x00b0fae90980e820,0x00a35ad3085d7327)},
+  {FIELD_LITERAL(0x00c0641ab833bff3,0x00c757de74150ff7,0x0054ee7cbfe65064,0x00a45d17f9080fb1,0x00542683b65d11e9,0x006599c129b63e2e,0x006bc58037739404,0x00da638dab1f0b7b)},
+  {FIELD_LITERAL(0x00057ab2bde6b7f0,0x00e9932589ddc86b,0x00b9f22dc625644b,0x0051b960a2bcc900,0x00d3ee8a9f4002f3,0x0039df924d11e48e,0x006677942ae32e69,0x001c1fdb31c4fea0)},
+  {FIELD_LITERAL(0x001b321dc2287596,0x00cda6a4e0ca8b07,0x000899bdbfb5123a,0x00a6c428ce8c49d9,0x00a6fe2e4c8a4468,0x0068bffaea970309,0x004a8261715f9b69,0x00ada7135a4b9207)},
+  {FIELD_LITERAL(0x00a1e0cb4ea736ad,0x0047daacb280ef5c,0x0017e806dd986376,0x00b99d1032d1f54e,0x00da5fb69287e277,0x004b06c534c653b4,0x00259899a6163ff6,0x000330a317c34911)},
+  {FIELD_LITERAL(0x006ec939b7e2cdc6,0x004d6d2ef4a22b4a,0x00bbd53e8c88dfb5,0x004935563043c8c7,0x0022ce8d485e7a90,0x0042ba2d73d5e7d3,0x00fd2b0feb70f027,0x0030ab61b4c63a55)},
+  {FIELD_LITERAL(0x00d1a3296ee72de7,0x009114846337eecf,0x005ed7e04feec4d4,0x00bfd2a85d681d20,0x0043d8ca4c69744c,0x0002767093c21469,0x00c64d022ce72463,0x008d8c60bb694e1a)},
+  {FIELD_LITERAL(0x00b2432e07cea365,0x00bde9894b3955d7,0x0084c3f6223f6ff4,0x00d2255b323c8cbc,0x00b872877af6e6c2,0x00e0699967c9ea32,0x0044799899c5a027,0x003220d0b8404fba)},
+  {FIELD_LITERAL(0x0032493ce9194dd7,0x00a3bc5fa45a55fb,0x0011fd9815860cad,0x00380fc9db2576f1,0x001483cb5f6e9103,0x004d7b0e7f7de9f5,0x0095703d20a3646d,0x00fffe9668a79733)},
+  {FIELD_LITERAL(0x0038c1daa5d5419a,0x00188eceb5b0953c,0x0058264c8f9de059,0x00ee0de01a72dd47,0x00b83a26bf2eac4b,0x004832dfa10030e3,0x005270780cbd858e,0x00e99584ace4ed46)},
+  {FIELD_LITERAL(0x00bd31d26a1caab5,0x000c22c6067ca207,0x008350b130dfa42c,0x00f680be452d56bb,0x00f1148cb38d92f5,0x00b6f9b8cc4b8622,0x009198e825847498,0x00a64aa60db7fee4)},
+  {FIELD_LITERAL(0x00c8e23841362393,0x0069164ef0cbba95,0x00ae7f5fe9159c13,0x001f9bf61705fda4,0x009023ffd4f814ac,0x001a8c1e519c315b,0x004481a7efc3c16f,0x00bd8407ff00fad7)},
+  {FIELD_LITERAL(0x009a76370b223b20,0x00a0e5dff506fe0b,0x0069c1519f456348,0x004561eabb3c5121,0x00bdd3d3d7405666,0x00403998d42e66f3,0x0089919e4fa7b091,0x009737a811c946d7)},
+  {FIELD_LITERAL(0x005b6faf3579a3c9,0x007f08fa738955b9,0x0066bf2162ad02ad,0x001464646cc74dec,0x00806b4f230cc5a0,0x00638456ec939b6b,0x00e9c1394876f819,0x008a078b00837401)},
+  {FIELD_LITERAL(0x00bcab9ff5bc0585,0x00523934920440d0,0x005cdf4146a1306c,0x00db943685a0499b,0x00ca1f6e883111af,0x00362a401148a14e,0x0076c1b7e726fa69,0x00e4c4433c3349f5)},
+  {FIELD_LITERAL(0x00b43eb149df90c6,0x0092286ae5aa55ec,0x00c69a7927e2c460,0x005d9791a2c45376,0x0059d5163e112864,0x00928f1cd5c5170d,0x001b2072e623edf0,0x00274d321a0d0189)},
+  {FIELD_LITERAL(0x0022559a87b81aba,0x00a42e4f5d80d8e8,0x002e41e3ab22e7cb,0x00efe1fcb631d52e,0x00f45d000ecf09a2,0x00726eca04a15a59,0x00ffb9aeb35a3228,0x00fa100454a3b7e1)},
+  {FIELD_LITERAL(0x005a65a65aee7eae,0x00d88347938e4034,0x00cb2ba30ad8a7a0,0x00545c84532dbd20,0x0016e1368c5013f9,0x0061e4aca5d292a6,0x00fbe40fa0f48c3c,0x0039c7127ecb0c5d)},
+  {FIELD_LITERAL(0x00d5f9ef9091909d,0x00cab919218b9bd4,0x009a8a0e13c850dc,0x00393d5689909537,0x00d15329199b4e34,0x0095e539536a1d94,0x0063044d22a1d69e,0x008dec6062492494)},
+  {FIELD_LITERAL(0x00a2a9d6ff2b5bdc,0x00dc3046bd72bd35,0x00d64ce23be327d8,0x005f4eee900a0512,0x00aae1be9d914e0e,0x00e6e853dc281990,0x0081f19ed01297e4,0x000ca960499b4c55)},
+  {FIELD_LITERAL(0x003937bef4d463e0,0x00ff4dbb4737739c,0x001a65398176200f,0x006d887acc50d300,0x00c893833b266e6f,0x000471b6b02b95f2,0x00b264f17d332537,0x001cffbfa774ef8c)},
+  {FIELD_LITERAL(0x00eeaa8dbab94b03,0x0020fe81dcc6679d,0x00884939032e85a5,0x005ba726d30f840e,0x00bc5bdb3e1beb27,0x00ab0e1e209d9f99,0x002b16076f4089dc,0x003cf28418405493)},
+  {FIELD_LITERAL(0x00a595f1caf9afb6,0x00e6e25ad4d7a0bf,0x00b58434fdf22cce,0x00a1eb2953ac060f,0x00bf302fdffb0ac6,0x0080dbf0241f758f,0x0044e2748d10078b,0x003e65244d9865e8)},
+  {FIELD_LITERAL(0x0028fd26c00697ca,0x00ad95f53cfdd0bb,0x0037b7200ba4f71b,0x00e9abd70922cc19,0x00bf4c8369d70dd6,0x0024f6e87507d410,0x003fd72e9bd7a053,0x00d785cee475716b)},
+  {FIELD_LITERAL(0x00288fb7152933e6,0x007a2e4f67004be5,0x008c817d579adc2d,0x00d23b35894c2e7d,0x00cc9eeac2d379a3,0x006f6d85339d53e3,0x00aab3ecfce78b0b,0x00b39d146cdebd69)},
+  {FIELD_LITERAL(0x0058a853b710f15c,0x00372b084a00d019,0x009aec0c5a9a98cf,0x0069bdcebc4054b9,0x0025b50e5ffcd6c9,0x006f348b9a3ce931,0x0067445b5029308c,0x00999bcac93baf92)},
+  {FIELD_LITERAL(0x007eb53deeece00a,0x005ca709257273bb,0x009a1b0f7e3fb8bf,0x000f08e452b2c99b,0x007f3161b8b8b3ce,0x00335c1aab34cd91,0x000cfc0616f089e8,0x002fbf4165baa1c2)},
+  {FIELD_LITERAL(0x00ec4df934b5e80a,0x00bcec16cb619319,0x009be2f9102b3ecc,0x001926d0fbd25c2f,0x0097a4fbae2d0eff,0x00e4257ac1885227,0x0062f4873de9effc,0x006c6d670fd28d09)},
+  {FIELD_LITERAL(0x0068c0205f321972,0x005ec0659577be70,0x00d9ff3776fe8235,0x00c8589ff45bfef6,0x00a522edb6bf2d9b,0x00e19aec542b3884,0x0025fb32ab544779,0x007e5e6d714ff724)},
+  {FIELD_LITERAL(0x009c64e0999d96b2,0x002d775442480dcb,0x002200c57e20bfe5,0x00a0e88a8835d94b,0x005bbfcaf1fb491b,0x0036f037370a6334,0x008bf995b7f5637d,0x004c4f709796af24)},
+  {FIELD_LITERAL(0x009d9fa9de527b69,0x00c50a406cb35283,0x005da6366792a77a,0x00844fbcf9453d3a,0x005ee94ec2231563,0x0010637bc124b785,0x0067d8052f17e810,0x0023819e490050ee)},
+  {FIELD_LITERAL(0x0028019ddba63450,0x00bcf08492c3be0a,0x0032b49e3175516a,0x001ac6b6009de6e5,0x003d5d1259f3d53c,0x00e51315400fc880,0x00efb537c3db3853,0x00cc92f5e2b9a53e)},
+  {FIELD_LITERAL(0x005b634d1ad25373,0x008a9c1c1bf9491c,0x008b879a02ce71be,0x0028c4bbc79fefcd,0x00bfe9e2cd83e355,0x00be8a51d3c8758f,0x00c4350d203ddcfd,0x00ec9666ee6ffb2e)},
+  {FIELD_LITERAL(0x0072c8fb1b3d0290,0x009f53bc89db5556,0x0089bc6c4263e960,0x00b206c650ad01f6,0x00ac308e59d94f72,0x00a6835ecdcf4fc6,0x00d8169bcfe864cc,0x00ce961d03cfc715)},
+  {FIELD_LITERAL(0x0050879e168533fe,0x00ce8a60a62acf7b,0x00d19be5719a3a77,0x00fabcbe14a22791,0x0008a2945ca36a05,0x00d38626ecbfde72,0x000976c7dd405990,0x00518bc67187d7db)},
+  {FIELD_LITERAL(0x009a8f2bc0936003,0x001361c97e14f800,0x00b1fcde94d1c313,0x0060d85a3294bf4c,0x001fdb98efcd3d5d,0x003cc5a4b340755a,0x003cacf2b82c72a6,0x0056574de1dc7de5)},
+  {FIELD_LITERAL(0x0026d456e05f04fc,0x002aa597cef24a14,0x003ab8fccc0b60ec,0x00e03ec22e8a1635,0x00918aec7f52eda1,0x006d8beaa39a5f4a,0x005d1dfaac1cb231,0x0076012f4bf4eb9c)},
+  {FIELD_LITERAL(0x00af8d2915e11bf4,0x007272dc451ca905,0x009266a21dae24da,0x00ab7a8b7f34c1b1,0x003700442cda4776,0x008dcd3a903569e2,0x00809989a5fd6786,0x009ad3e2cacf45cb)},
+  {FIELD_LITERAL(0x00f6fd4e68741dc6,0x003082856a3ec467,0x003e2fa23b8fd28a,0x0065e8545cd35245,0x00bafce29ffa3d1d,0x00d7bdbe4bbba998,0x00cbe9763ea8e02a,0x0018a5f98667ce0f)},
+  {FIELD_LITERAL(0x00871ec53425e3db,0x0034c2d561ee20ec,0x00bd5539169c285f,0x001609c4da15197c,0x004d553ecc656249,0x00aaca1bbb8c271b,0x00f92e5a71400a96,0x002daf175d13be17)},
+  {FIELD_LITERAL(0x002e5266cf746bc7,0x00cdb8258df4e8c1,0x00d1de570700d171,0x001f42ed0ffd14f3,0x0074bb7a4abc45c8,0x00e65127eac96342,0x00e292f51a0fd996,0x00f735ee79ad9717)},
+  {FIELD_LITERAL(0x00ced7ec3d85000c,0x00d580c2fa2103b9,0x008ce982e8574159,0x00b3e836dbaa3746,0x0022f3c3298a3601,0x00332ead2e637d10,0x00fd3003afe51c95,0x00d49cb269af959a)},
+  {FIELD_LITERAL(0x00aebd45a3d3ed64,0x00ed9dc37aed5171,0x0036d3a3f66c6fd9,0x00704e358080e8a3,0x000609e3a37bb3b9,0x003e2fb89d5b8e6d,0x0019f98633ff5101,0x00fe999e19b2626d)},
+  {FIELD_LITERAL(0x00747862bc254704,0x00650c0d0f3e4a54,0x00ba1f1957299056,0x001e2c98d904c56a,0x00f8cf145a68d931,0x001a7910d128021a,0x004a5634a79b9290,0x0052a7c9420cc7ae)},
+  {FIELD_LITERAL(0x00378c25538eee3b,0x0074729e407e445d,0x004ff9493e371101,0x00bf270e476163c7,0x0029d7aeb315b7e4,0x009e5083cc13169f,0x00e84f6a13c7c6da,0x00a90581dcb0e471)},
+  {FIELD_LITERAL(0x0081d9b756fb635e,0x009579381beb513a,0x00a965f049d5b0bd,0x00e95f71c7f982fb,0x00e8f3f497cf608f,0x00110330391e5ee9,0x0021635b9da478cb,0x00f6103eefc970b3)},
+  {FIELD_LITERAL(0x00b96b256b0b452e,0x005ddc8e17337d31,0x006cae147b4fc265,0x008b71332e777b2b,0x0064a1f41d7f696f,0x0070a2054507b62d,0x004f8e2040c2f724,0x008d00424e4bc046)},
+  {FIELD_LITERAL(0x0020357c6318584b,0x008d882a8de64569,0x00fed07415ae62f9,0x0029e1afc2b82c21,0x005242d1611c2563,0x00383962b0657eda,0x00076f7f6485590a,0x00e17e9b65b256d7)},
+  {FIELD_LITERAL(0x00ec51fc6159cfc0,0x0075016103efffcf,0x0098c6c15b4df98d,0x008adea6f563e3ac,0x001e251f98cca96a,0x007ec75279da5ae1,0x00a1d651cb38c6d2,0x00eb91e47a159880)},
+  {FIELD_LITERAL(0x005494e42da790da,0x00743edd07fa3ec2,0x009d59c8dcd36367,0x00ebca72af3a547d,0x001d694749678478,0x008884c42dba9f02,0x00b3e322778a2808,0x00c3cc2aa5e0f11b)},
+  {FIELD_LITERAL(0x0015f417424c3006,0x006b0b3fade73abf,0x0056b7c294b1b1e0,0x0034b3ea3a3c6a7b,0x0064a588df39b2f3,0x002083780f3e7730,0x006ab45e20834be9,0x00f65f3afeef75f1)},
+  {FIELD_LITERAL(0x00fc6ecbef43e63c,0x00fcb241cca4e826,0x003e0ed12d4d2bd9,0x003111633f1bc755,0x007183e58eb6ee19,0x00407a6b9d943557,0x00a1eb99754ddda7,0x00f071de74d4bf8f)},
+  {FIELD_LITERAL(0x00a37cfa24b27c67,0x00890a4a84e279a4,0x00c32141ff0fc8cf,0x0018e6cd4f351b54,0x00e590ba6a02a8f4,0x0082092bd70c4c71,0x008c0a7f8c16b8ab,0x00d7e214d20ef6eb)},
+  {FIELD_LITERAL(0x007470498d44ce66,0x004e63aff113920b,0x0092a8b3c0f64076,0x0089863857fc853c,0x00ad4c06432b282a,0x00708f6450fa7b78,0x00ced5ddb19fce44,0x00779421c10fd908)}
+};
+#endif
+
+#elif GOLDILOCKS_WNAF_FIXED_TABLE_BITS == 8
+const gf API_NS(precomputed_wnaf_as_fe)[768]
+CACHE_ALIGNED __attribute__((visibility("hidden"))) = {
+  {FIELD_LITERAL(0x00303cda6feea532,0x00860f1d5a3850e4,0x00226b9fa4728ccd,0x00e822938a0a0c0c,0x00263a61c9ea9216,0x001204029321b828,0x006a468360983c65,0x0002846f0a782143)},
+  {FIELD_LITERAL(0x00303cda6feea532,0x00860f1d5a3850e4,0x00226b9fa4728ccd,0x006822938a0a0c0c,0x00263a61c9ea9215,0x001204029321b828,0x006a468360983c65,0x0082846f0a782143)},
+  {FIELD_LITERAL(0x00ef8e22b275198d,0x00b0eb141a0b0e8b,0x001f6789da3cb38c,0x006d2ff8ed39073e,0x00610bdb69a167f3,0x00571f306c9689b4,0x00f557e6f84b2df8,0x002affd38b2c86db)},
+  {FIELD_LITERAL(0x00cea0fc8d2e88b5,0x00821612d69f1862,0x0074c283b3e67522,0x005a195ba05a876d,0x000cddfe557feea4,0x008046c795bcc5e5,0x00540969f4d6e119,0x00d27f96d6b143d5)},
+  {FIELD_LITERAL(0x000c3b1019d474e8,0x00e19533e4952284,0x00cc9810ba7c920a,0x00f103d2785945ac,0x00bfa5696cc69b34,0x00a8d3d51e9ca839,0x005623cb459586b9,0x00eae7ce1cd52e9e)},
+  {FIELD_LITERAL(0x0005a178751dd7d8,0x002cc3844c69c42f,0x00acbfe5efe10539,0x009c20f43431a65a,0x008435d96374a7b3,0x009ee57566877bd3,0x0044691725ed4757,0x001e87bb2fe2c6b2)},
+  {FIELD_LITERAL(0x000cedc4debf7a04,0x002ffa45000470ac,0x002e9f9678201915,0x0017da1208c4fe72,0x007d558cc7d656cb,0x0037a827287cf289,0x00142472d3441819,0x009c21f166cf8dd1)},
+  {FIELD_LITERAL(0x003ef83af164b2f2,0x000949a5a0525d0d,0x00f4498186cac051,0x00e77ac09ef126d2,0x0073ae0b2c9296e9,0x001c163f6922e3ed,0x0062946159321bea,0x00cfb79b22990b39)},
+  {FIELD_LITERAL(0x00b001431ca9e654,0x002d7e5eabcc9a3a,0x0052e8114c2f6747,0x0079ac4f94487f92,0x00bffd919b5d749c,0x00261f92ad15e620,0x00718397b7a97895,0x00c1443e6ebbc0c4)},
+  {FIELD_LITERAL(0x00eacd90c1e0a049,0x008977935b149fbe,0x0004cb9ba11c93dc,0x009fbd5b3470844d,0x004bc18c9bfc22cf,0x0057679a991839f3,0x00ef15b76fb4092e,0x0074a5173a225041)},
+  {FIELD_LITERAL(0x003f5f9d7ec4777b,0x00ab2e733c919c94,0x001bb6c035245ae5,0x00a325a49a883630,0x0033e9a9ea3cea2f,0x00e442a1eaa0e844,0x00b2116d5b0e71b8,0x00c16abed6d64047)},
+  {FIELD_LITERAL(0x00c560b5ed051165,0x001945adc5d65094,0x00e221865710f910,0x00cc12bc9e9b8ceb,0x004faa9518914e35,0x0017476d89d42f6d,0x00b8f637c8fa1c8b,0x0088c7d2790864b8)},
+  {FIELD_LITERAL(0x00ef7eafc1c69be6,0x0085d3855778fbea,0x002c8d5b450cb6f5,0x004e77de5e1e7fec,0x0047c057893abded,0x001b430b85d51e16,0x00965c7b45640c3c,0x00487b2bb1162b97)},
+  {FIELD_LITERAL(0x0099c73a311beec2,0x00a3eff38d8912ad,0x002efa9d1d7e8972,0x00f717ae1e14d126,0x002833f795850c8b,0x0066c12ad71486bd,0x00ae9889da4820eb,0x00d6044309555c08)},
+  {FIELD_LITERAL(0x004b1c5283d15e41,0x00669d8ea308ff75,0x0004390233f762a1,0x00e1d67b83cb6cec,0x003eebaa964c78b1,0x006b0aff965eb664,0x00b313d4470bdc37,0x008814ffcb3cb9d8)},
+  {FIELD_LITERAL(0x009724b8ce68db70,0x007678b5ed006f3d,0x00bdf4b89c0abd73,0x00299748e04c7c6d,0x00ddd86492c3c977,0x00c5a7febfa30a99,0x00ed84715b4b02bb,0x00319568adf70486)},
+  {FIELD_LITERAL(0x0070ff2d864de5bb,0x005a37eeb637ee95,0x0033741c258de160,0x00e6ca5cb1988f46,0x001ceabd92a24661,0x0030957bd500fe40,0x001c3362afe912c5,0x005187889f678bd2)},
+  {FIELD_LITERAL(0x0086835fc62bbdc7,0x009c3516ca4910a1,0x00956c71f8d00783,0x0095c78fcf63235f,0x00fc7ff6ba05c222,0x00cdd8b3f8d74a52,0x00ac5ae16de8256e,0x00e9d4be8ed48624)},
+  {FIELD_LITERAL(0x00c0ce11405df2d8,0x004e3f37b293d7b6,0x002410172e1ac6db,0x00b8dbff4bf8143d,0x003a7b409d56eb66,0x003e0f6a0dfef9af,0x0081c4e4d3645be1,0x00ce76076b127623)},
+  {FIELD_LITERAL(0x00f6ee0f98974239,0x0042d89af07d3a4f,0x00846b7fe84346b5,0x006a21fc6a8d39a1,0x00ac8bc2541ff2d9,0x006d4e2a77732732,0x009a39b694cc3f2f,0x0085c0aa2a404c8f)},
+  {FIELD_LITERAL(0x00b261101a218548,0x00c1cae96424277b,0x00869da0a77dd268,0x00bc0b09f8ec83ea,0x00d61027f8e82ba9,0x00aa4c85999dce67,0x00eac3132b9f3fe1,0x00fb9b0cf1c695d2)},
+  {FIELD_LITERAL(0x0043079295512f0d,0x0046a009861758e0,0x003ee2842a807378,0x0034cc9d1298e4fa,0x009744eb4d31b3ee,0x00afacec96650cd0,0x00ac891b313761ae,0x00e864d6d26e708a)},
+  {FIELD_LITERAL(0x00a84d7c8a23b491,0x0088e19aa868b27f,0x0005986d43e78ce9,0x00f28012f0606d28,0x0017ded7e10249b3,0x005ed4084b23af9b,0x00b9b0a940564472,0x00ad9056cceeb1f4)},
+  {FIELD_LITERAL(0x00db91b357fe755e,0x00a1aa544b15359c,0x00af4931a0195574,0x007686124fe11aef,0x00d1ead3c7b9ef7e,0x00aaf5fc580f8c15,0x00e727be147ee1ec,0x003c61c1e1577b86)},
+  {FIELD_LITERAL(0x009d3fca983220cf,0x00cd11acbc853dc4,0x0017590409d27f1d,0x00d2176698082802,0x00fa01251b2838c8,0x00dd297a0d9b51c6,0x00d76c92c045820a,0x00534bc7c46c9033)},
+  {FIELD_LITERAL(0x0080ed9bc9b07338,0x00fceac7745d2652,0x008a9d55f5f2cc69,0x0096ce72df301ac5,0x00f53232e7974d87,0x0071728c7ae73947,0x0090507602570778,0x00cb81cfd883b1b2)},
+  {FIELD_LITERAL(0x005011aadea373da,0x003a8578ec896034,0x00f20a6535fa6d71,0x005152d31e5a87cf,0x002bac1c8e68ca31,0x00b0e323db4c1381,0x00f1d596b7d5ae25,0x00eae458097cb4e0)},
+  {FIELD_LITERAL(0x00920ac80f9b0d21,0x00f80f7f73401246,0x0086d37849b557d6,0x0002bd4b317b752e,0x00b26463993a42bb,0x002070422a73b129,0x00341acaa0380cb3,0x00541914dd66a1b2)},
+  {FIELD_LITERAL(0x00c1513cd66abe8c,0x000139e01118944d,0x0064abbcb8080bbb,0x00b3b08202473142,0x00c629ef25da2403,0x00f0aec3310d9b7f,0x0050b2227472d8cd,0x00f6c8a922d41fb4)},
+  {FIELD_LITERAL(0x001075ccf26b7b1f,0x00bb6bb213170433,0x00e9491ad262da79,0x009ef4f48d2d384c,0x008992770766f09d,0x001584396b6b1101,0x00af3f8676c9feef,0x0024603c40269118)},
+  {FIELD_LITERAL(0x009dd7b31319527c,0x001e7ac948d873a9,0x00fa54b46ef9673a,0x0066efb8d5b02fe6,0x00754b1d3928aeae,0x0004262ac72a6f6b,0x0079b7d49a6eb026,0x003126a753540102)},
+  {FIELD_LITERAL(0x009666e24f693947,0x00f714311269d45f,0x0010ffac1d0c851c,0x0066e80c37363497,0x00f1f4ad010c60b0,0x0015c87408470ff7,0x00651d5e9c7766a4,0x008138819d7116de)},
+  {FIELD_LITERAL(0x003934b11c57253b,0x00ef308edf21f46e,0x00e54e99c7a16198,0x0080d57135764e63,0x00751c27b946bc24,0x00dd389ce4e9e129,0x00a1a2bfd1cd84dc,0x002fae73e5149b32)},
+  {FIELD_LITERAL(0x00911657dffb4cdd,0x00c100b7cc553d06,0x00449d075ec467cc,0x007062100bc64e70,0x0043cf86f7bd21e7,0x00f401dc4b797dea,0x005224afb2f62e65,0x00d1ede3fb5a42be)},
+  {FIELD_LITERAL(0x00f2ba36a41aa144,0x00a0c22d946ee18f,0x008aae8ef9a14f99,0x00eef4d79b19bb36,0x008e75ce3d27b1fc,0x00a65daa03b29a27,0x00d9cc83684eb145,0x009e1ed80cc2ed74)},
+  {FIELD_LITERAL(0x00bed953d1997988,0x00b93ed175a24128,0x00871c5963fb6365,0x00ca2df20014a787,0x00f5d9c1d0b34322,0x00f6f5942818db0a,0x004cc091f49c9906,0x00e8a188a60bff9f)},
+  {FIELD_LITERAL(0x0032c7762032fae8,0x00e4087232e0bc21,0x00f767344b6e8d85,0x00bbf369b76c2aa2,0x008a1f46c6e1570c,0x001368cd9780369f,0x007359a39d079430,0x0003646512921434)},
+  {FIELD_LITERAL(0x007c4b47ca7c73e7,0x005396221039734b,0x008b64ddf0e45d7e,0x00bfad5af285e6c2,0x008ec711c5b1a1a8,0x00cf663301237f98,0x00917ee3f1655126,0x004152f337efedd8)},
+  {FIELD_LITERAL(0x0007c7edc9305daa,0x000a6664f273701c,0x00f6e78795e200b1,0x005d05b9ecd2473e,0x0014f5f17c865786,0x00c7fd2d166fa995,0x004939a2d8eb80e0,0x002244ba0942c199)},
+  {FIELD_LITERAL(0x00321e767f0262cf,0x002e57d776caf68e,0x00bf2c94814f0437,0x00c339196acd622f,0x001db4cce71e2770,0x001ded5ddba6eee2,0x0078608ab1554c8d,0x00067fe0ab76365b)},
+  {FIELD_LITERAL(0x00f09758e11e3985,0x00169efdbd64fad3,0x00e8889b7d6dacd6,0x0035cdd58ea88209,0x00bcda47586d7f49,0x003cdddcb2879088,0x0016da70187e954b,0x009556ea2e92aacd)},
+  {FIELD_LITERAL(0x008cab16bd1ff897,0x00b389972cdf753f,0x00ea8ed1e46dfdc0,0x004fe7ef94c589f4,0x002b8ae9b805ecf3,0x0025c08d892874a5,0x0023938e98d44c4c,0x00f759134cabf69c)},
+  {FIELD_LITERAL(0x006c2a84678e4b3b,0x007a194aacd1868f,0x00ed0225af424761,0x00da0a6f293c64b8,0x001062ac5c6a7a18,0x0030f5775a8aeef4,0x0002acaad76b7af0,0x00410b8fd63a579f)},
+  {FIELD_LITERAL(0x001ec59db3d9590e,0x001e9e3f1c3f182d,0x0045a9c3ec2cab14,0x0008198572aeb673,0x00773b74068bd167,0x0012535eaa395434,0x0044dba9e3bbb74a,0x002fba4d3c74bd0e)},
+  {FIELD_LITERAL(0x0042bf08fe66922c,0x003318b8fbb49e8c,0x00d75946004aa14c,0x00f601586b42bf1c,0x00c74cf1d912fe66,0x00abcb36974b30ad,0x007eb78720c9d2b8,0x009f54ab7bd4df85)},
+  {FIELD_LITERAL(0x00db9fc948f73826,0x00fa8b3746ed8ee9,0x00132cb65aafbeb2,0x00c36ff3fe7925b8,0x00837daed353d2fe,0x00ec661be0667cf4,0x005beb8ed2e90204,0x00d77dd69e564967)},
+  {FIELD_LITERAL(0x0042e6268b861751,0x0008dd0469500c16,0x00b51b57c338a3fd,0x00cc4497d85cff6b,0x002f13d6b57c34a4,0x0083652eaf301105,0x00cc344294cc93a8,0x0060f4d02810e270)},
+  {FIELD_LITERAL(0x00a8954363cd518b,0x00ad171124bccb7b,0x0065f46a4adaae00,0x001b1a5b2a96e500,0x0043fe24f8233285,0x0066996d8ae1f2c3,0x00c530f3264169f9,0x00c0f92d07cf6a57)},
+  {FIELD_LITERAL(0x0036a55c6815d943,0x008c8d1def993db3,0x002e0e1e8ff7318f,0x00d883a4b92db00a,0x002f5e781ae33906,0x001a72adb235c06d,0x00f2e59e736e9caa,0x001a4b58e3031914)},
+  {FIELD_LITERAL(0x00d73bfae5e00844,0x00bf459766fb5f52,0x0061b4f5a5313cde,0x004392d4c3b95514,0x000d3551b1077523,0x0000998840ee5d71,0x006de6e340448b7b,0x00251aa504875d6e)},
+  {FIELD_LITERAL(0x003bf343427ac342,0x00adc0a78642b8c5,0x0003b893175a8314,0x0061a34ade5703bc,0x00ea3ea8bb71d632,0x00be0df9a1f198c2,0x0046dd8e7c1635fb,0x00f1523fdd25d5e5)},
+  {FIELD_LITERAL(0x00633f63fc9dd406,0x00e713ff80e04a43,0x0060c6e970f2d621,0x00a57cd7f0df1891,0x00f2406a550650bb,0x00b064290efdc684,0x001eab0144d17916,0x00cd15f863c293ab)},
+  {FIELD_LITERAL(0x0029cec55273f70d,0x007044ee275c6340,0x0040f637a93015e2,0x00338bb78db5aae9,0x001491b2a6132147,0x00a125d6cfe6bde3,0x005f7ac561ba8669,0x001d5eaea3fbaacf)},
+  {FIELD_LITERAL(0x00054e9635e3be31,0x000e43f31e2872be,0x00d05b1c9e339841,0x006fac50bd81fd98,0x00cdc7852eaebb09,0x004ff519b061991b,0x009099e8107d4c85,0x00273e24c36a4a61)},
+  {FIELD_LITERAL(0x00070b4441ef2c46,0x00efa5b02801a109,0x00bf0b8c3ee64adf,0x008a67e0b3452e98,0x001916b1f2fa7a74,0x00d781a78ff6cdc3,0x008682ce57e5c919,0x00cc1109dd210da3)},
+  {FIELD_LITERAL(0x00cae8aaff388663,0x005e983a35dda1c7,0x007ab1030d8e37f4,0x00e48940f5d032fe,0x006a36f9ef30b331,0x009be6f03958c757,0x0086231ceba91400,0x008bd0f7b823e7aa)},
+  {FIELD_LITERAL(0x00cf881ebef5a45a,0x004ebea78e7c6f2c,0x0090da9209cf26a0,0x00de2b2e4c775b84,0x0071d6031c3c15ae,0x00d9e927ef177d70,0x00894ee8c23896fd,0x00e3b3b401e41aad)},
+  {FIELD_LITERAL(0x00204fef26864170,0x00819269c5dee0f8,0x00bfb4713ec97966,0x0026339a6f34df78,0x001f26e64c761dc2,0x00effe3af313cb60,0x00e17b70138f601b,0x00f16e1ccd9ede5e)},
+  {FIELD_LITERAL(0x005d9a8353fdb2db,0x0055cc2048c698f0,0x00f6c4ac89657218,0x00525034d73faeb2,0x00435776fbda3c7d,0x0070ea5312323cbc,0x007a105d44d069fb,0x006dbc8d6dc786aa)},
+  {FIELD_LITERAL(0x0017cff19cd394ec,0x00fef7b810922587,0x00e6483970dff548,0x00ddf36ad6874264,0x00e61778523fcce2,0x0093a66c0c93b24a,0x00fd367114db7f86,0x007652d7ddce26dd)},
+  {FIELD_LITERAL(0x00d92ced7ba12843,0x00aea9c7771e86e7,0x0046639693354f7b,0x00a628dbb6a80c47,0x003a0b0507372953,0x00421113ab45c0d9,0x00e545f08362ab7a,0x0028ce087b4d6d96)},
+  {FIELD_LITERAL(0x00a67ee7cf9f99eb,0x005713b275f2ff68,0x00f1d536a841513d,0x00823b59b024712e,0x009c46b9d0d38cec,0x00cdb1595aa2d7d4,0x008375b3423d9af8,0x000ab0b516d978f7)},
+  {FIELD_LITERAL(0x00428dcb3c510b0f,0x00585607ea24bb4e,0x003736bf1603687a,0x00c47e568c4fe3c7,0x003cd00282848605,0x0043a487c3b91939,0x004ffc04e1095a06,0x00a4c989a3d4b918)},
+  {FIELD_LITERAL(0x00a8778d0e429f7a,0x004c02b059105a68,0x0016653b609da3ff,0x00d5107bd1a12d27,0x00b4708f9a771cab,0x00bb63b662033f69,0x0072f322240e7215,0x0019445b59c69222)},
+  {FIELD_LITERAL(0x00cf4f6069a658e6,0x0053ca52859436a6,0x0064b994d7e3e117,0x00cb469b9a07f534,0x00cfb68f399e9d47,0x00f0dcb8dac1c6e7,0x00f2ab67f538b3a5,0x0055544f178ab975)},
+  {FIELD_LITERAL(0x0099b7a2685d538c,0x00e2f1897b7c0018,0x003adac8ce48dae3,0x00089276d5c50c0c,0x00172fca07ad6717,0x00cb1a72f54069e5,0x004ee42f133545b3,0x00785f8651362f16)},
+  {FIELD_LITERAL(0x0049cbac38509e11,0x0015234505d42cdf,0x00794fb0b5840f1c,0x00496437344045a5,0x0031b6d944e4f9b0,0x00b207318ac1f5d8,0x0000c840da7f5c5d,0x00526f373a5c8814)},
+  {FIELD_LITERAL(0x002c7b7742d1dfd9,0x002cabeb18623c01,0x00055f5e3e044446,0x006c20f3b4ef54ba,0x00c600141ec6b35f,0x00354f437f1a32a3,0x00bac4624a3520f9,0x00c483f734a90691)},
+  {FIELD_LITERAL(0x0053a737d422918d,0x00f7fca1d8758625,0x00c360336dadb04c,0x00f38e3d9158a1b8,0x0069ce3b418e84c6,0x005d1697eca16ead,0x00f8bd6a35ece13d,0x007885dfc2b5afea)},
+  {FIELD_LITERAL(0x00c3617ae260776c,0x00b20dc3e96922d7,0x00a1a7802246706a,0x00ca6505a5240244,0x002246b62d919782,0x001439102d7aa9b3,0x00e8af1139e6422c,0x00c888d1b52f2b05)},
+  {FIELD_LITERAL(0x005b67690ffd41d9,0x005294f28df516f9,0x00a879272412fcb9,0x00098b629a6d1c8d,0x00fabd3c8050865a,0x00cd7e5b0a3879c5,0x00153238210f3423,0x00357cac101e9f42)},
+  {FIELD_LITERAL(0x008917b454444fb7,0x00f59247c97e441b,0x00a6200a6815152d,0x0009a4228601d254,0x001c0360559bd374,0x007563362039cb36,0x00bd75b48d74e32b,0x0017f515ac3499e8)},
+  {FIELD_LITERAL(0x001532a7ffe41c5a,0x00eb1edce358d6bf,0x00ddbacc7b678a7b,0x008a7b70f3c841a3,0x00f1923bf27d3f4c,0x000b2713ed8f7873,0x00aaf67e29047902,0x0044994a70b3976d)},
+  {FIELD_LITERAL(0x00d54e802082d42c,0x00a55aa0dce7cc6c,0x006477b96073f146,0x0082efe4ceb43594,0x00a922bcba026845,0x0077f19d1ab75182,0x00c2bb2737846e59,0x0004d7eec791dd33)},
+  {FIELD_LITERAL(0x0044588d1a81d680,0x00b0a9097208e4f8,0x00212605350dc57e,0x0028717cd2871123,0x00fb083c100fd979,0x0045a056ce063fdf,0x00a5d604b4dd6a41,0x001dabc08ba4e236)},
+  {FIELD_LITERAL(0x00c4887198d7a7fa,0x00244f98fb45784a,0x0045911e15a15d01,0x001d323d374c0966,0x00967c3915196562,0x0039373abd2f3c67,0x000d2c5614312423,0x0041cf2215442ce3)},
+  {FIELD_LITERAL(0x008ede889ada7f06,0x001611e91de2e135,0x00fdb9a458a471b9,0x00563484e03710d1,0x0031cc81925e3070,0x0062c97b3af80005,0x00fa733eea28edeb,0x00e82457e1ebbc88)},
+  {FIELD_LITERAL(0x006a0df5fe9b6f59,0x00a0d4ff46040d92,0x004a7cedb6f93250,0x00d1df8855b8c357,0x00e73a46086fd058,0x0048fb0add6dfe59,0x001e03a28f1b4e3d,0x00a871c993308d76)},
+  {FIELD_LITERAL(0x0030dbb2d1766ec8,0x00586c0ad138555e,0x00d1a34f9e91c77c,0x0063408ad0e89014,0x00d61231b05f6f5b,0x0009abf569f5fd8a,0x00aec67a110f1c43,0x0031d1a790938dd7)},
+  {FIELD_LITERAL(0x006cded841e2a862,0x00198d60af0ab6fb,0x0018f09db809e750,0x004e6ac676016263,0x00eafcd1620969cb,0x002c9784ca34917d,0x0054f00079796de7,0x00d9fab5c5972204)},
+  {FIELD_LITERAL(0x004bd0fee2438a83,0x00b571e62b0f83bd,0x0059287d7ce74800,0x00fb3631b645c3f0,0x00a018e977f78494,0x0091e27065c27b12,0x007696c1817165e0,0x008c40be7c45ba3a)},
+  {FIELD_LITERAL(0x00a0f326327cb684,0x001c7d0f672680ff,0x008c1c81ffb112d1,0x00f8f801674eddc8,0x00e926d5d48c2a9d,0x005bd6d954c6fe9a,0x004c6b24b4e33703,0x00d05eb5c09105cc)},
+  {FIELD_LITERAL(0x00d61731caacf2cf,0x002df0c7609e01c5,0x00306172208b1e2b,0x00b413fe4fb2b686,0x00826d360902a221,0x003f8d056e67e7f7,0x0065025b0175e989,0x00369add117865eb)},
+  {FIELD_LITERAL(0x00aaf895aec2fa11,0x000f892bc313eb52,0x005b1c794dad050b,0x003f8ec4864cec14,0x00af81058d0b90e5,0x00ebe43e183997bb,0x00a9d610f9f3e615,0x007acd8eec2e88d3)},
+  {FIELD_LITERAL(0x0049b2fab13812a3,0x00846db32cd60431,0x000177fa578c8d6c,0x00047d0e2ad4bc51,0x00b158ba38d1e588,0x006a45daad79e3f3,0x000997b93cab887b,0x00c47ea42fa23dc3)},
+  {FIELD_LITERAL(0x0012b6fef7aeb1ca,0x009412768194b6a7,0x00ff0d351f23ab93,0x007e8a14c1aff71b,0x006c1c0170c512bc,0x0016243ea02ab2e5,0x007bb6865b303f3e,0x0015ce6b29b159f4)},
+  {FIELD_LITERAL(0x009961cd02e68108,0x00e2035d3a1d0836,0x005d51f69b5e1a1d,0x004bccb4ea36edcd,0x0069be6a7aeef268,0x0063f4dd9de8d5a7,0x006283783092ca35,0x0075a31af2c35409)},
+  {FIELD_LITERAL(0x00c412365162e8cf,0x00012283fb34388a,0x003e6543babf39e2,0x00eead6b3a804978,0x0099c0314e8b326f,0x00e98e0a8d477a4f,0x00d2eb96b127a687,0x00ed8d7df87571bb)},
+  {FIELD_LITERAL(0x00777463e308cacf,0x00c8acb93950132d,0x00ebddbf4ca48b2c,0x0026ad7ca0795a0a,0x00f99a3d9a715064,0x000d60bcf9d4dfcc,0x005e65a73a437a06,0x0019d536a8db56c8)},
+  {FIELD_LITERAL(0x00192d7dd558d135,0x0027cd6a8323ffa7,0x00239f1a412dc1e7,0x0046b4b3be74fc5c,0x0020c47a2bef5bce,0x00aa17e48f43862b,0x00f7e26c96342e5f,0x0008011c530f39a9)},
+  {FIELD_LITERAL(0x00aad4ac569bf0f1,0x00a67adc90b27740,0x0048551369a5751a,0x0031252584a3306a,0x0084e15df770e6fc,0x00d7bba1c74b5805,0x00a80ef223af1012,0x0089c85ceb843a34)},
+  {FIELD_LITERAL(0x00c4545be4a54004,0x0099e11f60357e6c,0x001f3936d19515a6,0x007793df84341a6e,0x0051061886717ffa,0x00e9b0a660b28f85,0x0044ea685892de0d,0x000257d2a1fda9d9)},
+  {FIELD_LITERAL(0x007e8b01b24ac8a8,0x006cf3b0b5ca1337,0x00f1607d3e36a570,0x0039b7fab82991a1,0x00231777065840c5,0x00998e5afdd346f9,0x00b7dc3e64acc85f,0x00baacc748013ad6)},
+  {FIELD_LITERAL(0x008ea6a4177580bf,0x005fa1953e3f0378,0x005fe409ac74d614,0x00452327f477e047,0x00a4018507fb6073,0x007b6e71951caac8,0x0012b42ab8a6ce91,0x0080eca677294ab7)},
+  {FIELD_LITERAL(0x00a53edc023ba69b,0x00c6afa83ddde2e8,0x00c3f638b307b14e,0x004a357a64414062,0x00e4d94d8b582dc9,0x001739caf71695b7,0x0012431b2ae28de1,0x003b6bc98682907c)},
+  {FIELD_LITERAL(0x008a9a93be1f99d6,0x0079fa627cc699c8,0x00b0cfb134ba84c8,0x001c4b778249419a,0x00df4ab3d9c44f40,0x009f596e6c1a9e3c,0x001979c0df237316,0x00501e953a919b87)},
+  {FIELD_LITERAL(0x00e413c68a4586a7,0x003ec446403679fc,0x00f284b604b3b436,0x007ef8125018d243,0x00d6b0a86cf18f1d,0x0065ebb4c2b505f4,0x00c110eb9f40e656,0x00975d950b1f2c9f)},
+  {FIELD_LITERAL(0x00654c303402a961,0x003b5af7bdfac6ba,0x0094319060ac107d,0x00f73a4c063a4883,0x0033dadc9890dadb,0x002c07abe51c36cb,0x00b2272ccc731daa,0x009517368ca0d233)},
+  {FIELD_LITERAL(0x00aafc64264023c5,0x00a0151496ac455c,0x00bd04d8ecf7c4aa,0x00f6d624e7fe6427,0x00bb996d47b4c1fa,0x00bb51a741e57275,0x00839b2ffa3f4538,0x00e6c3e0f2a040aa)},
+  {FIELD_LITERAL(0x00ff75c7d049cebd,0x0017e65d4bd11ccf,0x009ef224bb69e583,0x009641b8b0f11daa,0x001ab94fffe77a63,0x007e1a45ec1f6b42,0x00b987d512f48ac7,0x00fa79db26c1f27d)},
+  {FIELD_LITERAL(0x002b782e91680258,0x0025e14bc23faf00,0x00d2ec57ba084762,0x0013c1770bd8aa0d,0x00c63661bc49cdb2,0x004c2c5897f4ca57,0x00bc87c04beffd43,0x00e7151a232827a6)},
+  {FIELD_LITERAL(0x00039d8c4841ca2a,0x00b8f2b3a783eb8a,0x00f2e8ad568add8a,0x00f0b5e8b6a55f0f,0x0060d03a05425fc2,0x006a51713b6066e8,0x00a2eeb07cc0aee8,0x00b4eb3b309a2dd9)},
+  {FIELD_LITERAL(0x00b226f5656b4f7b,0x00511d68c15fd4a9,0x0021c4294fc0c017,0x00df9f211c01a867,0x00439bb6b23feca0,0x00e044575faa9c2c,0x00cd0195a56a0200,0x000ee94dbe6a9d0c)},
+  {FIELD_LITERAL(0x00afb55844c3d2c6,0x00b1021b66f98b8f,0x00ba83c1adeebfbf,0x00b17f3a323da58c,0x0030f78155052d86,0x00263c308b87d727,0x00d34a72cd61dd97,0x0090e5485a703e9e)},
+  {FIELD_LITERAL(0x0007c4d9669edc69,0x00269af0d7a6f939,0x00ebcb584f53bfb4,0x0097370c38067764,0x00ce2be5cc469219,0x0018a04bf4bdb92d,0x00cd6db2e56a2b50,0x00464c0d3ca529de)},
+  {FIELD_LITERAL(0x007c8e212000ba8a,0x004113d692744385,0x005c28338e5d8128,0x0060fc0892949283,0x00ab21f56e6ede53,0x00012f6814165978,0x007d16f89d900fa4,0x00c808421a2e4017)},
+  {FIELD_LITERAL(0x00d32fdff5184da0,0x001df652e5eef576,0x003d157ebfe13641,0x0006a5c4e5cd4cf4,0x0089342a483bb1c6,0x0098681dcf12192d,0x00f3faa9d56985be,0x003fef63a26f7cd1)},
+  {FIELD_LITERAL(0x00147150439d4884,0x00ab520fa3c80453,0x00d2cb5fa43311cc,0x00a52844786a78a2,0x0032ea6bedd88c35,0x00d05a8d1f80320f,0x00dd2e0ba752f476,0x00d7f5c52580304f)},
+  {FIELD_LITERAL(0x00b2f04df59255a1,0x00fe2ac8e5989b8f,0x00e7dcdda0b21a7c,0x002d422458057222,0x0035d2af379e319f,0x00946eebf1d5ae41,0x00c7d5538161e1fb,0x00216c4722e7deda)},
+  {FIELD_LITERAL(0x00a5d64f3361d64f,0x0032f6475a462003,0x00cbdcc0d10a9d84,0x007efc3ed6c9e0f9,0x006eaa7bd38dfa16,0x00fe868d9102eff2,0x002e83620dc43155,0x002f1c5a6a4efcc4)},
+  {FIELD_LITERAL(0x00b88e94d17813b5,0x00b4002ba77bb154,0x00adeb1f700db5bd,0x0038e166ada0c890,0x00123247320cab97,0x00365452450306d7,0x00877506e59bf26c,0x0027681df7a2e221)},
+  {FIELD_LITERAL(0x0062b9acbc033fa8,0x00ead872f2c82cb5,0x00a46fd2ecda2929,0x00a517fb77431e5e,0x008a1324edb49892,0x00a9c5ececff29e4,0x00bd7ff96701fc36,0x007153a19202ef5d)},
+  {FIELD_LITERAL(0x000a0c82ddc1fbb6,0x008d350364957178,0x00bf1383cfe6d8e8,0x00afb34794b5d6a5,0x0073bd5491bf0b8c,0x00de2a7f451b81af,0x00ad23c46ad5d792,0x00090af6548b2e66)},
+  {FIELD_LITERAL(0x0007cf5670ceabe0,0x00c983ad67faad83,0x00bda8e74e4db53a,0x007f36e2de81eace,0x00252afd593613a7,0x00513bdedb2037c2,0x00cc04cac5e18f98,0x00ba7f8e0c3cb628)},
+  {FIELD_LITERAL(0x0047bcecdb9b6d68,0x00e7c8c16ba4cc5a,0x00ba517259fed111,0x0096aa8f0df64475,0x0032a48f6f63bb66,0x00af2ea6e8c83c71,0x00f9f9d9dd71cafa,0x006dc8868b09a2cc)},
+  {FIELD_LITERAL(0x0043e68a3a85180e,0x002530be422af47f,0x002da968ac01658b,0x006d78eb0f53030f,0x00108e04987ba712,0x00034e6f9d1b547f,0x00e4f6499b2dbd01,0x00727a8f4a084993)},
+  {FIELD_LITERAL(0x0047e6ea5faa14e0,0x00cd456ba9358578,0x00b1a9e3bee6a947,0x005ec2fac9b5d47c,0x00ddeaf5df121013,0x00a5e91a877e5aec,0x003e3d4cbd2f2e06,0x0045f060182bd44f)},
+  {FIELD_LITERAL(0x0094e56962712778,0x00f59beb7144bbf8,0x00f7c61fe70e2eca,0x00e19120474b0109,0x002e85a29382ec81,0x00f4deecd963d5aa,0x0017850eaccf2a57,0x0061d34af8de987b)},
+  {FIELD_LITERAL(0x005149c050637392,0x003effee1eb53636,0x00df69828b6d49a4,0x0003d1c2be4dc31c,0x002c0fc41fb25bf6,0x0096daf8a477703c,0x00982f4243db6630,0x000c5999ac9b93a1)},
+  {FIELD_LITERAL(0x005ed781e94a0565,0x004728fd8fb2291d,0x00dfd625fa0b9e8e,0x00cbd08540ad01d4,0x0016ec7470e591e4,0x005c16878c369c17,0x0090159c97a96d33,0x009dd7b6e0518785)},
+  {FIELD_LITERAL(0x0044931b5c5b5041,0x009c0409a1f15e0e,0x0007a06ca71c63cd,0x005202629723b6e2,0x0028404350ad721c,0x00c80c29ace3f7e1,0x00ee5d6b512761f6,0x0019e46855d2c1eb)},
+  {FIELD_LITERAL(0x00de62235c6ab9f6,0x0073e0be96b8b40c,0x00399331b50cba2c,0x00174728fcd125b5,0x0082e7c9f1fc33c5,0x00344cc7c5eb91fb,0x005eeb2603e3c440,0x00b160f08a7ef705)},
+  {FIELD_LITERAL(0x0085b642a0f1f14b,0x00356f6b3ea5943f,0x006b84e0bf4bb2d1,0x00c4d267d9d91638,0x00256f3c4022a6b3,0x00743433abf100bc,0x002f1638fd7f2105,0x001f5c4d40dbdb3e)},
+  {FIELD_LITERAL(0x00be95b07f00ecc6,0x00aa8c5941b985ad,0x00dd0fc7e158eff6,0x009b0a9b5f807a8f,0x00b1bbb041403f13,0x008fedb18ac01220,0x0007cafd0cd4b638,0x00494a5e5a5be833)},
+  {FIELD_LITERAL(0x002b108946e14b76,0x00f29485d541f43b,0x003957b0b77fc57d,0x0010b3507d4316f1,0x001e24ce7b695f82,0x009199e62ee390d1,0x00b47efeb2e0d9a8,0x00b3a6d3f94dbf25)},
+  {FIELD_LITERAL(0x002c4e6b1705e778,0x0095cbff716069d3,0x009ddd7ca73fa96c,0x00f822553b7c8ea3,0x0070f657917dc4a3,0x0098f0a93b12ec8d,0x003f38bea563f500,0x007bb05c8e5060c7)},
+  {FIELD_LITERAL(0x00155ec7bd28cbee,0x008d3086ac6e2add,0x0003cad477b18f43,0x004d12e59dcc1d81,0x00c308bbdb5cd1ca,0x005a4a8f54791ca2,0x0038ab8b2e3d033f,0x00a1cd18f059cfe6)},
+  {FIELD_LITERAL(0x004d7bcc0035b9a3,0x00a4f1b80f0e6931,0x006e4742bb2aaa16,0x00f5e3ec8448e6d0,0x0096dbcd44c19e51,0x0094a6cd2fba6789,0x0000db365bff3e85,0x001a83b4ddade56e)},
+  {FIELD_LITERAL(0x00f28b9dee3f3a02,0x0042c4e8a1081011,0x0048f75168434e55,0x0024c62dd8eb7933,0x007cc5c3762505f8,0x005e68695bd113e3,0x000c02152ee95e9f,0x005b8ea15d5e0dcd)},
+  {FIELD_LITERAL(0x003a2f88163d8944,0x0071cc5952b80224,0x00beb00d5298b6ee,0x0040d326f1e1c3b9,0x00424255474e8d3e,0x008905181870f841,0x007844165f6add23,0x00a6968394d665e7)},
+  {FIELD_LITERAL(0x00d59359eaf0f1cd,0x00680239585cd7ec,0x00d763e37c894435,0x001c3d9af863c48a,0x002e2c0117fb0ccf,0x001c25c191c5a953,0x0025a4509ac53351,0x00e75eb6dba99638)},
+  {FIELD_LITERAL(0x00e6d46ad132ee44,0x007db85463fbd884,0x00b243fc7fd9b7e9,0x009c7344d5d78e50,0x0068edfd21bbe8c4,0x00aec4f969e4f794,0x001cdc6922e4a7e7,0x00aeb7e809725fd8)},
+  {FIELD_LITERAL(0x003a71e384b38cff,0x00c8000b916e809a,0x00367c3a34265eb1,0x00e1e7a835f4cf98,0x00a24252bb23185a,0x00d052bb202ae958,0x0060fd728bd1a610,0x0070dae251540916)},
+  {FIELD_LITERAL(0x007aed4375b3abd4,0x005d526c0a705012,0x00108b10daf36b56,0x006f9ee64a5e4120,0x004ba43f0329dad8,0x00791c7c4f89e347,0x003b98ecbb8b92f0,0x00ad624347adcdec)},
+  {FIELD_LITERAL(0x005bd1d62f6526e6,0x0017444e96fe2aa1,0x00fd8757e56ee709,0x005d335f77e40727,0x00c187f28c6e4d5c,0x006d4eadb0ef0a3d,0x00d84aaf7ba3760a,0x0084a16d0a5de921)},
+  {FIELD_LITERAL(0x0019f05b71d75738,0x00ff1a33aa4af262,0x0089c4da07b68282,0x00890814bfc9ae08,0x003262e4526d5c44,0x0028ad3974abed50,0x00c7368bc336370f,0x00b1f6abda4324bb)},
+  {FIELD_LITERAL(0x0078828fae951616,0x00ff3b1aa2cd8698,0x000fce2f5f06fbd1,0x00327e568b7ddbba,0x0022ac2bf74bb595,0x00f7b85ae51e2ffd,0x001c156fc5f93eed,0x00396d2b07502fc7)},
+  {FIELD_LITERAL(0x0044c203e3b01d6f,0x0096624c7965f587,0x000f37c4aa44e4bf,0x009a606643fe0ab7,0x00e339bf1ffd8836,0x00933e3694f51cf2,0x005f8b6b8c14a32a,0x0058edcc7c4e5641)},
+  {FIELD_LITERAL(0x0096e0fed8cab38c,0x003dd5972f9c0da1,0x0096830b70acfa59,0x005cf00d85205cb2,0x00f697684856be43,0x00dbb7d61092adf1,0x00f5667c43a72ed6,0x00c88cc090f21b99)},
+  {FIELD_LITERAL(0x0058ce78e4a12941,0x0063f94afce07abb,0x00e8d9068a6258bd,0x00f037373c97892d,0x00be3efee0a7c9ae,0x00d72ead32bcc50d,0x008212a5d5a773bd,0x001d8432c369de28)},
+  {FIELD_LITERAL(0x00438df92cbe8a90,0x00fea66c19e57e0d,0x0096df0a20a3bd06,0x002286db9c685348,0x003635a73e0b9c97,0x00d1ec3f8469102c,0x003229e8e0385ef0,0x00fc8192af89e90c)},
+  {FIELD_LITERAL(0x00abd1aee4589249,0x000ad4d4bdcfd483,0x00d25708826b621a,0x0075a3b1017f3105,0x001da686e6925827,0x00968dd442baca4b,0x004a9dfe45d06bef,0x00424f55830132f9)},
+  {FIELD_LITERAL(0x00a5b6ebff72b4f7,0x00f92709fa31be4a,0x004e567bccda707d,0x0098c9b0ff897f2a,0x00707507e7de7a25,0x00c443854830ec81,0x0048ac60973c8908,0x000094095446b1e4)},
+  {FIELD_LITERAL(0x00b7f4692e1dc87f,0x0033d1f6fb888fc5,0x00ca54acf4711e37,0x007eb769ad2e3a7f,0x009b5e6809d499dc,0x00a9b215c139f0ff,0x0082f83e606c5e34,0x00d7bed1ed7cdc04)},
+  {FIELD_LITERAL(0x0094fb1bd7f8715b,0x0098c893819c96f3,0x00128f0cde47a915,0x0080a160e9e87009,0x00871bf39a9d737f,0x0086bfbef16f6a3f,0x00fce080af5e4996,0x0075263831021c3b)},
+  {FIELD_LITERAL(0x00190acce9243e96,0x00df3d862131f966,0x00b6864c89804337,0x00ed02cf9bf5995d,0x00f6c779c88cc2ca,0x003f1faf5f18e3f4,0x004d12d37d06dacc,0x00fc6d7b8d35d91f)},
+  {FIELD_LITERAL(0x00337c5ffc7b33fc,0x00e661d4be0ea953,0x00f13bc397532e5c,0x00dfc67179dcf16b,0x00a4b7a3a82dc211,0x00c75356a05fa563,0x007cd5d30af0329c,0x00e31e3e8080350f)},
+  {FIELD_LITERAL(0x002430f4b394a5fd,0x002c94dd347577ec,0x00a27058f2385c43,0x00038de48b3886bd,0x00b836eb90925c55,0x00ffa6afd8e09d63,0x00d20715d4200af8,0x00abec58c011c451)},
+  {FIELD_LITERAL(0x00772d9747bba1f7,0x00ac9854600b69ff,0x0045c1642dcdcfd2,0x00684fb2fc8d3c34,0x001a59baf781a0b0,0x00c6658b19f46812,0x00ed40f78be13d5a,0x0027f47fd40df0ed)},
+  {FIELD_LITERAL(0x002bd1f6ad105160,0x00ff4967b72ee2df,0x00ab35f1bd4955a4,0x00dbca5aef876a2e,0x008ffccb6c9ee0ba,0x0040a1470d2293c8,0x00459d02e2fd345f,0x0056c3f938804b92)},
+  {FIELD_LITERAL(0x0098c7d75eef9bfa,0x0066561b76a530cb,0x006f1da7063148ce,0x00c01733f969c2af,0x0095c019cacfded2,0x005a794d38bc776c,0x00754705936d5527,0x001c0df00ca72048)},
+  {FIELD_LITERAL(0x006c395f64f042d0,0x001ddd88bfbae06e,0x00dc67f2423e4f06,0x0083aabd983e7159,0x009cd642d96d8d26,0x00c1cabd008f6771,0x0048a01b02fe595b,0x000e378160eb7b93)},
+  {FIELD_LITERAL(0x00f27612f6ece95b,0x001dc6fec10c16c4,0x008815cb47705cd8,0x00be7f902ca1a77f,0x006740e60401d0cd,0x00a75694183bc516,0x006a88f3059b3538,0x00ceeddd2b8c3421)},
+  {FIELD_LITERAL(0x00efba96c47d81ab,0x00dccd08d752fabd,0x001762dde9468fbc,0x0083d3f2426cb82d,0x00d0e6ff84f5b6c2,0x00766afd18439471,0x00b5b23b46ea30c4,0x00d459fba5961be7)},
+  {FIELD_LITERAL(0x00fd510d0e6958f1,0x0004af90d417c6ec,0x0038861784e95676,0x0052d64e188b4fd7,0x001145af44a06d53,0x008c1a8f048f27bf,0x000876bc4f04e71f,0x00f0edf124d825f1)},
+  {FIELD_LITERAL(0x00d4d776d2a07c2a,0x0005aa01c7fa84ec,0x00377775b1a8c823,0x007c1d680182d08c,0x0011623f3f3d4d2b,0x003f521b7438f2b9,0x0095fe70fcfec80f,0x009c52a1d52676c2)},
+  {FIELD_LITERAL(0x001dae91b3e451de,0x006c7d22c5ab8290,0x0070c41471d7d1a9,0x00d47998a10f0555,0x00c0b6615ec75ce0,0x00cc2f775ed2db90,0x0095551189a3d6cb,0x000cc4ec55ba92d4)},
+  {FIELD_LITERAL(0x00c1bce233c99768,0x00ae4dc3397a8416,0x00b7687d0c892215,0x00880403a7137802,0x00a2c55d54773e94,0x0087d2cee9407ff0,0x006ddc423463219c,0x0087686efaeb8395)},
+  {FIELD_LITERAL(0x00a69b9c77db0b99,0x00b5b29503b76f6c,0x00565233779b3fb1,0x00979f023a40700a,0x006eadeef123380e,0x000875f5b93b9595,0x00504196f0e7325b,0x00b471e929c19a67)},
+  {FIELD_LITERAL(0x002040a6cecb4737,0x00e4809d8dc21e54,0x005600d8b37df1ca,0x00f411004914feac,0x009e6640522c2987,0x00c2037a319f0483,0x008e830c5488d41f,0x00b0e22bc9146bdc)},
+  {FIELD_LITERAL(0x00d575aed321e12f,0x004c7c474620bed6,0x00b0b552bb6351bd,0x004bffae3995c317,0x00a3f47f383b524f,0x0002571b28f04734,0x00406cdc308fa532,0x008c784ea92e41b4)},
+  {FIELD_LITERAL(0x0065f84aa06799d6,0x00e3538cef848272,0x00acd2c5a786393f,0x001999854fb55bde,0x00c9915af0ed6a6c,0x00825d48c7b35a8d,0x00a1b2e8154cd00c,0x00c3f1830625615d)},
+  {FIELD_LITERAL(0x00337475459c17bb,0x00b34e6035440974,0x00a3d69bb57e49d7,0x00adad2d5503a0f3,0x004626a6e76ec54a,0x008518950bed9884,0x00effab448dd343e,0x004c5e545ec88c8a)},
+  {FIELD_LITERAL(0x00ae8a76c3edd8ab,0x003dbc2edec0d68a,0x003cd85daa1b6592,0x00f2ec7f48419a5a,0x00270420f2275e7c,0x0098b40e4feb1c7e,0x0056820c73e6a909,0x0058b2e224bb7514)},
+  {FIELD_LITERAL(0x0060c9d65b245e41,0x00d5fe4832490bca,0x00b9d3b1c42e31ae,0x0066a274a3daa441,0x00991094a7bdde43,0x00703fce348b9134,0x008e054a5a6e875f,0x004d0bde075185a4)},
+  {FIELD_LITERAL(0x0024582656910b7c,0x00f301372d8240e3,0x00b50094162c2b28,0x00a2da26cc1d3a96,0x00b2e3c8dd4aa356,0x005c487c23eaba59,0x00454fc5d9bd2ff3,0x006ebb92ee1e3172)},
+  {FIELD_LITERAL(0x0063ccbf8dd5e635,0x006910622644fdc2,0x00ae7bc4ee866346,0x00b8b5e5ee9f3549,0x00269f749557cb27,0x003d27ceed19d102,0x000fc8dcd186629a,0x00e6d9dc84290c00)},
+  {FIELD_LITERAL(0x00a0d5c185126b85,0x0072835459a05f2c,0x0091dda454e2e1ac,0x00d1cd6fd668aa7a,0x005dd6cba70dc22c,0x007895819f297278,0x00dc259bffdd0531,0x009f68a508ae7759)},
+  {FIELD_LITERAL(0x006c0276b0565e6e,0x007f2a9fc3f1d186,0x0050750c26804453,0x00226ec4f36ce2df,0x00b7ecab414432c0,0x008e073e2b38c775,0x003a047b55d11df8,0x00e144683d185730)},
+  {FIELD_LITERAL(0x000bac4bed91c54a,0x00da7d56ebc7105a,0x00cf075bdfda22c1,0x00aaa356d93e9468,0x0044de217586c689,0x000f377b0d93dad8,0x0018e1cdfef0fa83,0x00a89abfbabb0482)},
+  {FIELD_LITERAL(0x002af05096b91b83,0x00e3ba22b83dc44a,0x00910ac70bed60ec,0x00b30f6307f56337,0x004af6d920477f04,0x00a0449743efe536,0x0078e53b5f7b12c0,0x000ff56b057102d2)},
+  {FIELD_LITERAL(0x00f888a49d1d5974,0x0027d34cfdabf437,0x006115ce266e39dc,0x00f65084a523906c,0x00a2530b4334a121,0x00a3b8ed24d8d900,0x0030db214b1e2975,0x004c224a94cba8c6)},
+  {FIELD_LITERAL(0x00c2c9c3787867af,0x00f23b5da23a0bd9,0x00293fb05750383c,0x00f5284b8dbcedfc,0x004a9ee136eb51b4,0x009670e9325914cd,0x00ca270007fcb414,0x00f21a56ffdad921)},
+  {FIELD_LITERAL(0x00e44023e593730d,0x00e1d642e5254e9c,0x003943432230b74a,0x0043ad1e213034e6,0x00ac50dc4cfba6cf,0x00abedf93d1633a4,0x007efe6fbaaf27f4,0x003b59a54b91d645)},
+  {FIELD_LITERAL(0x00703d0b90b0e031,0x00fe4a291a103857,0x008316df8469d7d9,0x009115e88b6690ae,0x00a4d1c29648cc33,0x00f0c74316c45056,0x0037f4c8029cf158,0x00dd30eb788049b0)},
+  {FIELD_LITERAL(0x00663971208c2a52,0x00bd4beb50c77557,0x00ef2383739b1817,0x00f476b20550b079,0x00fcc580724604af,0x003d5eafa4cfed14,0x00792e7484bc471b,0x00bb3224fccf839d)},
+  {FIELD_LITERAL(0x006a6a6b11582bf2,0x00241753f96ebe7a,0x0017ebf41723b02d,0x005c7299d91d597c,0x00cbeae8fa834cb7,0x00e047cd0c59c228,0x00e77fa5ab52dfd8,0x00282f59460bcf32)},
+  {FIELD_LITERAL(0x00411a58479b2254,0x00e7af7054c33e19,0x004527c8df9408ca,0x00c6dea4106f5c20,0x006ba16a46a69cda,0x006cf63c0e9dfe3b,0x00f4e47e0d34b53b,0x00d6769d1dd689d5)},
+  {FIELD_LITERAL(0x0090f846b8e44a2d,0x000febc6d1760040,0x00198559e76668c8,0x001fdb14701fed04,0x00a3a7bf92ea2b36,0x00445dc761bc03ae,0x0098baf24c192ada,0x00bb1495e6aa214f)},
+  {FIELD_LITERAL(0x005193aa5acb6919,0x00f7c82f3be9e6fe,0x000676f8d1c32365,0x00b7a673d170dc1b,0x001bbac91dd03347,0x00dea168de46e0bb,0x002a6b2de6fa63e9,0x00676183c255cdfc)},
+  {FIELD_LITERAL(0x00a6f25ea7ad5842,0x000a48a1fc231c21,0x001deead68e68d00,0x00ced568e79967d3,0x000683ea8aa10f15,0x00044742b79b5043,0x00b9a6a309a4f8fd,0x002cf92e1bbfe25a)},
+  {FIELD_LITERAL(0x0031561c7b2b532c,0x00c95ed23cbaafb3,0x009e91af12b78d9c,0x00a040d006e7647d,0x001ee1d5e7fc39aa,0x00980183a398c8f1,0x0037d82af144c94b,0x0019f71c959bae3b)},
+  {FIELD_LITERAL(0x005e552f9702cf02,0x006657e60ee02932,0x00e86f5d5da91f03,0x0064f50212df845c,0x000859ef00aef8d8,0x00e96ae6faa7bf33,0x0024047a721a43f2,0x0090bb2bb962edde)},
+  {FIELD_LITERAL(0x003ef7032f196cd0,0x00a07c587a81a6b4,0x00879e5bfbf8e41f,0x00ac9cf6431810d3,0x00fe1e02d4da9908,0x003055dfdaaa5f20,0x00377d1596d673c0,0x00966ad51fc22ace)},
+  {FIELD_LITERAL(0x0001bf645f644528,0x00e58a0381eb7cdd,0x0014eb550b33d370,0x0001412a4835017a,0x00c74cd0e88d70b2,0x00e6d70421530139,0x00154dc396bf07c7,0x00d2c3ed25504aaf)},
+  {FIELD_LITERAL(0x00d7dc22c67da06b,0x0013b6a923c22d73,0x000ded79b6f49405,0x00a3d933fe655108,0x009b066cd146111d,0x007035b84bd58d01,0x0089e49889571351,0x00eaebd558266ffa)},
+  {FIELD_LITERAL(0x00a316611a09c0e6,0x0007b5fd5afb801b,0x009b3f617c4a864d,0x003fbb5be10eece6,0x00c3f319ddbf937b,0x0063d9f2d19eaad1,0x008fbfb7e0566531,0x008bea72cec73b6b)},
+  {FIELD_LITERAL(0x00ae03c31ffbb51d,0x00d199a32332c2a5,0x00f436948e7a2341,0x00e2177398f92e7b,0x0010a223524900ac,0x00678b1cc022c8a6,0x000cbf223b4393c2,0x00c1839506920e6d)},
+  {FIELD_LITERAL(0x005e093892995237,0x00bd29f6573b3464,0x00ef256f2bfc9f72,0x00bf349f5a40060e,0x006f5a68ff0fba43,0x00434c3e9bfef612,0x00e40e5d691ed21a,0x00f81ae7781544f9)},
+  {FIELD_LITERAL(0x00e4007117649995,0x00fa424a4361633d,0x00bfbd2f99c5fa15,0x00210b16fcc7ad0b,0x004e2cc48f28406a,0x0063e166afae7dbd,0x00c8140897dd2261,0x0046587de8ef8a38)},
+  {FIELD_LITERAL(0x00f223bbd96cc532,0x0077df24aafe2789,0x007b021a2c130a86,0x000c431599191b43,0x0093cd8cf3baaf34,0x00776cc1a5130e67,0x00187a0fdd3efec3,0x002b746fe5c3cd89)},
+  {FIELD_LITERAL(0x00bec3f5173410bb,0x00691f9151b0568a,0x00d0254b1a2f41ac,0x00886508882d1aa2,0x00be6c29afa2e6e9,0x00711dc9d3ce1639,0x00f1d1f0cdef233f,0x0052a7daad00605d)},
+  {FIELD_LITERAL(0x008eb6b0da3c1f44,0x00d453fb2698d450,0x0025a4bfccfd7094,0x007192a0d47bf4e2,0x00b22fdbe27b66a6,0x00816380e4fc6642,0x00ad6e41be1f56a7,0x00a1e13b0aae1550)},
+  {FIELD_LITERAL(0x00c9d876e6bd5889,0x00bd82b009287326,0x007b09c56fa3e2ca,0x0078cefced06115f,0x00e565da96cc2a26,0x002db5b64bbdf7bc,0x009ffbe9f2978b50,0x007489dc44365b9b)},
+  {FIELD_LITERAL(0x00003bf9abb7ff8c,0x00d52b23c6ad1433,0x00a0fbdab4491eb3,0x00d08256fdf59433,0x00f1108d2c44b0d4,0x00a45f46f32c5dc0,0x00a18ba9c051bf91,0x00feb4b812fcd10f)},
+  {FIELD_LITERAL(0x004c5f4f8be14d08,0x00f9d46b6b654912,0x00940d793eb96fe3,0x00259b3629025acd,0x00595a3afffad394,0x003c629618fea28b,0x00f588ee535cd18e,0x008ebf885f72fc1f)},
+  {FIELD_LITERAL(0x000a0395db805dd7,0x003b12a308202f86,0x00d59593431abaa4,0x00250ee912b2dd85,0x005df490efc34a7e,0x00e1c93ec901036c,0x0047bf5d52b79817,0x0091a923e74bddfa)},
+  {FIELD_LITERAL(0x009a31cce208bc3b,0x00784ed947717ee3,0x00b87154efe1ebb7,0x0084f7b8c6e78a77,0x000e4ff2cc5e28b3,0x00f254a581dacbe1,0x00fcc6a06754007c,0x0060eacf9089f456)},
+  {FIELD_LITERAL(0x0053d0364a7f74d9,0x0078b2dc94c99b1c,0x00080d086f55068c,0x0079c6a9b52b633c,0x00e889d4a4835fae,0x00580b7fe8622610,0x002ad530c5b604d1,0x00522d0bdd68df68)},
+  {FIELD_LITERAL(0x00d505e54df38dcc,0x00bb5cf9a44e0297,0x00814d479980b357,0x00cd40f76c64d2e1,0x008a74cb5aaf443e,0x00c8cf91784f40f3,0x00b33838c61449fc,0x0002923a46c0d62b)},
+  {FIELD_LITERAL(0x004e21a608d149c7,0x00ff74f437e89c2d,0x00450764d5487559,0x005cc6e22b3d7f1e,0x0059fb13c0be2c9c,0x00db3cd958da7f09,0x00579ce089c8245c,0x001f362141ad19e0)},
+  {FIELD_LITERAL(0x00b40f79f9e2eabc,0x00aaf4261b3669b8,0x00f440985a459b31,0x0067a1eb40b50e24,0x00514732aa8642a4,0x0036e77b56e41bc7,0x00bc94c5932bb329,0x009e279c5bd4a571)},
+  {FIELD_LITERAL(0x0065cae78a7a1214,0x00a7914090a36238,0x002b4c722990fff4,0x00ef3470df70a5c2,0x0006ca15d2562113,0x0098cb7bcf423ae0,0x009e5d500df644cf,0x001a86055b60a28a)},
+  {FIELD_LITERAL(0x00de166f2fdcbae1,0x0000a72bd3fb0a72,0x00729bb1f9441e26,0x00a0fbfe70082f2a,0x00a563ec91bca8ef,0x00db0d53ee095f1f,0x00920967f418eaf9,0x00b62e5ddf98b89d)},
+  {FIELD_LITERAL(0x00527504b4f821c6,0x0036fa61d40f3563,0x005da863e2760f9d,0x004a85c03516ca5f,0x008706faf2c98f69,0x00f345b116e39ede,0x00223357166790a6,0x00f3ca8d4281e2e8)},
+  {FIELD_LITERAL(0x004aec9a0506bfba,0x00a7dbba57b2652c,0x0097619f4e540eba,0x00b1c4f27af417d2,0x007e2f00a07d40f2,0x00eddf070b10a688,0x000093b272919d4f,0x001d5340d2c1431c)},
+  {FIELD_LITERAL(0x007cacd97ebde652,0x005fff8f0c4d6ac8,0x00414e207a83222a,0x00a80741be4d1bc7,0x00eebd029b075acc,0x000a8f5a923ca684,0x00901b78616db067,0x00abb05aaaff6c6f)},
+  {FIELD_LITERAL(0x0071d9dc4a20a217,0x0019a33dc1bb094e,0x00b1e575dbb4c9f5,0x00e05e298f3b1808,0x003982a1cc7e84fd,0x000fd2a92282e2c4,0x00df26ba5a9beb98,0x00ac114c9e084e06)},
+  {FIELD_LITERAL(0x00f9884f879e2fca,0x002a01d29001e2a5,0x009a89f014a1d19c,0x00aa56a5f4536e74,0x00cdfbfb1eae30cb,0x00b45aafa89f4ced,0x005adac0c6f59e98,0x00b7bf7b000a9ca9)},
+  {FIELD_LITERAL(0x00c7c827a6d71508,0x00851545fc995290,0x00041c03e7466028,0x00e912c9176af4ce,0x0038146b9087cd0d,0x001e1a51fb632921,0x008d1fae11a13488,0x00b9b58b2c78bcb2)},
+  {FIELD_LITERAL(0x00c9d5260c6463ba,0x008be11c65698757,0x008a57caf16e9ac8,0x00124abae6ac4a6a,0x00967aeb73b56bee,0x00b9379ef4cb39eb,0x009420debb57ae9a,0x00afe841df3e2702)},
+  {FIELD_LITERAL(0x00cddb54965fd3a2,0x00a13dec4312463e,0x0087d9aed2054a37,0x00782a5f81d8352e,0x0030c8a3c7e38a94,0x005e3274902d4c73,0x00c0e1286cffa975,0x00217b34521a852c)},
+  {FIELD_LITERAL(0x00e5692a3ab14920,0x00658b0193615486,0x00701e083bcab6d1,0x00c026d13e014bd7,0x00148ead43c3a13f,0x00873e86696bc210,0x00cd7fda17de45b3,0x003ab33147e32654)},
+  {FIELD_LITERAL(0x009fe8f8ef82d7ef,0x004ccd9b3cb6cb7b,0x003134748cd05669,0x007441104fddb1a9,0x00488b7758c062ab,0x0078dd1a703ca66a,0x002aa389c7a0d750,0x0071e33049d139a6)},
+  {FIELD_LITERAL(0x0058a6f673786abf,0x001971d500d2c4cd,0x00a89174224b0eb1,0x00d05073795b6519,0x007f35b339b5db6c,0x00cde248abe7fe89,0x00c431cc76b434ab,0x0004d7fba67fb926)},
+  {FIELD_LITERAL(0x009e1c185125382c,0x001fad53f23ad414,0x007ed9d99c7e5ec3,0x00841045f697ce18,0x002be3231d94bd8b,0x00a0985d0d30407c,0x006d371912c1bafb,0x00fb793be6dea403)},
+  {FIELD_LITERAL(0x004d1ea364b213f1,0x00f7eead033a836b,0x0026636b00d7dda5,0x005d99dac98b0af3,0x0095a2574f6622a0,0x005efe42cb4d636f,0x0048652c6706a0bf,0x0006dd1420cc7db2)},
+  {FIELD_LITERAL(0x0045d72bab8f5dff,0x00bac0287479146e,0x00ea6f6ce3ddd237,0x004a1656a832311d,0x00c70bdf6053bcc5,0x0053d9995d632de4,0x00eee69d41ae02e5,0x00af156fe0204acd)},
+  {FIELD_LITERAL(0x0021b1937bb9bcfb,0x00fb6ecb45e4e81c,0x001573d47fc40c4a,0x007476f6a776754c,0x00f1e67a899b4b6e,0x00551b9c61180820,0x00ae0a441fff293d,0x003bb14bc69311e1)},
+  {FIELD_LITERAL(0x002df0965d77ce2d,0x00522b970de0fbe3,0x005e2f157e13761d,0x009566f8cf48b7e1,0x0054b38c9c4dc7bb,0x00cb487954100c64,0x00acb3275c402520,0x00f214471e192dfb)},
+  {FIELD_LITERAL(0x008ffc5b48e06d26,0x00daa30ffe9e08f1,0x00f621f9afad996d,0x00d3239835d18f47,0x004d42cb300efd35,0x0049df6c46414a30,0x0023273cabf2c6d2,0x00ac16a831fabdfb)},
+  {FIELD_LITERAL(0x0080deb2618e0c73,0x001025566c4b7185,0x00ccb16ac8178eff,0x009e771588fbf6c0,0x00c666251d9d38d6,0x00fccf6f09d9a8ce,0x00d1b837c549dd6e,0x00d61264e23b0f23)},
+  {FIELD_LITERAL(0x00d8bb8268d3959a,0x009e490710196e4e,0x000934627c86d977,0x00a3ef7c7b2420cb,0x0026e3bf650aee66,0x00278d79ab70ac07,0x00c41f09021894b6,0x0000a3096afbaffe)},
+  {FIELD_LITERAL(0x00fcc9e4edb50be3,0x004ead93f9bd5fc5,0x005e315f07d23cf1,0x00d02f8619a0c8a1,0x00d5fb640592d74f,0x009e9ea251e4593e,0x00d4943205be8a49,0x00ef0d4699f514e9)},
+  {FIELD_LITERAL(0x00d125055d73d294,0x0043564f2f4333dc,0x0003419e18e7cb1b,0x00431a0e97787221,0x0068b2df7d9e7e19,0x001d5e88386fc08d,0x00abac558c4c8c5e,0x005f1cc083812d55)},
+  {FIELD_LITERAL(0x00edba53911e21a7,0x002dba6132748176,0x0078b24d45390375,0x00be958bf2478d4d,0x00f63013de3b26ac,0x007a9342bf813037,0x00a7daddd52dff74,0x009412292b7530ff)},
+  {FIELD_LITERAL(0x0037278d6785bd6d,0x00447b6bd42131ba,0x005affd830c02c91,0x00ddc1570388d328,0x0076b40a6d1b3b12,0x00f8ef39f9585148,0x0018bec9ea32eec3,0x00e2f1b471ac41c4)},
+  {FIELD_LITERAL(0x001052e3ccc717c2,0x009abbe60c4c5504,0x006beb9f4dc09c12,0x00b9ce2b0a44b03b,0x00db3f51427c3363,0x00a9427646c99c0d,0x0095c8ecf87d62bb,0x003d9556f70caf3a)},
+  {FIELD_LITERAL(0x0018d4a3cc498ab6,0x00b2c899d80b12ff,0x0096e162955007a3,0x005f00c82a14f27c,0x00c8e8cabbc7e60c,0x001ce83ec8ec6417,0x004efc3a3ca30fb7,0x0034b3496b061d4f)},
+  {FIELD_LITERAL(0x00ed0bf92447b50d,0x009921c7f4ae2f40,0x00d30b0bcec088ab,0x0013c19abeceeb0c,0x0036a5a3bf9de725,0x0086e08f800f9fd1,0x00e823976057511a,0x00213d49ec0584f7)},
+  {FIELD_LITERAL(0x008ceacf9cbd0ecb,0x00ca7ba1f8e7c218,0x0076b1654572dd45,0x00b23572196124a4,0x00b5b32a24a9022b,0x00d6dbcebab5f01a,0x00cb1169d4e9d51b,0x00e309a1738e8558)},
+  {FIELD_LITERAL(0x00aa27340b22cc6a,0x0085587ab0dd0aa0,0x000ebbf2f5a4a33b,0x00d2dd91ad0a7dd5,0x005c93784b6a7bf6,0x00e46ca9b7ffbdff,0x00ad07164b535d4c,0x00f02da2e632c6a3)},
+  {FIELD_LITERAL(0x000ca8e39ebad778,0x0002462b830021cc,0x0055742347eeafc9,0x005310d302ce6501,0x00d32c076e26c2c4,0x008e8ea4ed9abe8d,0x0023e30349519119,0x005b87d614368637)},
+  {FIELD_LITERAL(0x00eec2bd0cbe3cd9,0x00337d37b338cf77,0x00b9be43274f4357,0x00bdecc88b34ec96,0x00e6b8aabef38d2a,0x00968603e39416bc,0x0086507ec01ede4a,0x002dd9e9a9eb7b6d)},
+  {FIELD_LITERAL(0x003ea4404ef57695,0x003525f3b4cf4b22,0x00217665dc266ab7,0x00f2269648c92116,0x002d13c12401b4ef,0x0063eb8aa6808625,0x005807a22d686f2b,0x00903ec15b2b04e1)},
+  {FIELD_LITERAL(0x0004f7298a80d047,0x00991d44534b634c,0x000d81a3a5c74f15,0x00f67589d74ca2c8,0x00085e3e42bd82e9,0x00fd78dcf7a6ab4c,0x00bdef13062bd8cf,0x00c01467569c6edf)},
+  {FIELD_LITERAL(0x00a555b222328299,0x0048097a2519ab8b,0x00fe887782634184,0x0018b78575661b0c,0x00dd8c7d5620079c,0x00dd6012b54a5fe8,0x00ee99a306f9aa99,0x00c8dd798e3f7732)},
+  {FIELD_LITERAL(0x00b842a923f27f58,0x00fea6fd3a49be5d,0x00dcd282e1fb2197,0x00741c7f66f2c06a,0x00dee6489a1f3458,0x008f004bbe3b0c9e,0x0043251577765388,0x00e479043ca09a6d)},
+  {FIELD_LITERAL(0x00ea17bf2e2e99cf,0x001ef42fed35f84b,0x00599a8f93fbb0b2,0x004ee645a4d81d7d,0x00b150d72afb25ef,0x00eceea2f136a0ee,0x00b0545f3f7a80ad,0x00ac883f7d1e5ee6)},
+  {FIELD_LITERAL(0x000e2eccb07e984d,0x00350d59d1452bdb,0x005ba11a13156276,0x007896a37c5f55b7,0x0091da33dcf80d28,0x009d3945dc484a8e,0x00695fd5ee03ffea,0x002c7545d41b2f19)},
+  {FIELD_LITERAL(0x0077b7401cbc4ade,0x006db7192153f06e,0x001312a58fba0ae6,0x0016f86193eedddc,0x00216f36b1d60e66,0x00a50c82ed271ffe,0x00a83bdb6e2474b5,0x0067a2add21fdc35)},
+  {FIELD_LITERAL(0x00acaee1bc67ee6a,0x00168617096c51ba,0x00b23544a9c2ace4,0x005ac06d8379ca92,0x00088f1f263e8357,0x00b9bfdd8c99202d,0x00c1a2503a35e23d,0x00d8dda22b17602d)},
+  {FIELD_LITERAL(0x007bf0c76b92a1a1,0x004b4224c10e1da4,0x00ca24041c4aad12,0x00395b49e05ef3e3,0x00e4b911708da2df,0x00c4b0b886417fed,0x00559c1d99be92ae,0x00c1d03d1082e421)},
+  {FIELD_LITERAL(0x00c2207825e96103,0x00c58c75b10694cf,0x00fc05180ad81614,0x0095f976a33827dc,0x00fe3d93ad2ab7d3,0x004ce8ffcd9482f3,0x0091ebb22629effb,0x0032b028402acda3)},
+  {FIELD_LITERAL(0x0014c227876f2cc7,0x00828b04fb691668,0x0011da80089e407f,0x00bb7938a807e85a,0x00cf99fd037ac26d,0x00e64e3c66d7946a,0x0057dc4045578797,0x003957a04ac21e6b)},
+  {FIELD_LITERAL(0x0023100ef4418dc3,0x00d9f08764c3e9e7,0x00af2dae38616a56,0x0097b2557646c682,0x001e6ce6ca710c16,0x0056c18a8ce442d4,0x00124fcd9c5b46ca,0x00f2db4c52d3e6ef)},
+  {FIELD_LITERAL(0x00cbd08104022282,0x00d6455ea52c6b4b,0x0077c13793e3f2b4,0x0097fb72c037c5c5,0x00e27dbdf63b7def,0x00faffbf70bc09b7,0x006ab38ba72f78b4,0x00f6feeba1766cc1)},
+  {FIELD_LITERAL(0x004ad0fcbc8f4bb9,0x001975e9d1e7af48,0x00dc145ac61f0e2f,0x0054b53fe711566c,0x002f32ae087e9c22,0x00d1b68c9b72afbd,0x00063cecc9cc4a0f,0x00bb1d37ecb7fd47)},
+  {FIELD_LITERAL(0x00b46ca906e791b0,0x0037af90bd734945,0x009624c326dc51af,0x0071c825ab7a70c4,0x007bcdb4d8eeca56,0x006114ed6bd3374d,0x00c3faa26d292b6a,0x00069f1d11befdf0)},
+  {FIELD_LITERAL(0x00dcd7e37c412dd4,0x00922d3d89eaeaf4,0x001772cb985c2f3a,0x009954aec213fe10,0x009a83485119d3f9,0x005157f5030940ea,0x00e9dd285202ea02,0x007153fce47b80f9)},
+  {FIELD_LITERAL(0x00903e77d6e1260a,0x00614580c99aa44b,0x002a395748328dbf,0x002973d18bc2878d,0x004c4ac97469e07b,0x0085dd5630375f6b,0x00998d4a029655f5,0x00201a37fc548c59)},
+  {FIELD_LITERAL(0x0071c31135116c0f,0x006fd2400eabb69a,0x00f45d3de5223cdd,0x006e17ac25e59472,0x0077ef4388f33ac2,0x00ccd9a9b15c5b61,0x0026ae0d5acb20c4,0x005015a3817abf04)},
+  {FIELD_LITERAL(0x00403ca646475eec,0x0039003598f0e345,0x00a572ab77153d2b,0x00bd95848fcda7fa,0x00356ab64a54ca1e,0x00a43cf5828aa3ae,0x00bbba8e3da30470,0x00b28c4f0db404a5)},
+  {FIELD_LITERAL(0x002a2032d4d0c6b0,0x0067c2925f240cb9,0x003751bda9460f9f,0x006612a1d531db17,0x00e93a9513e6992c,0x007f7af1a7ac4a76,0x006a66f704ba8a25,0x0063f080544c7f81)},
+  {FIELD_LITERAL(0x0088b22257cadf8c,0x0001620ec9b6680d,0x00427bd468547206,0x003ec12f463a7805,0x0046706ab2e86a6c,0x00ca6672bdc1ea19,0x00b91de1d0c00a48,0x00cdbf961ff5cc8a)},
+  {FIELD_LITERAL(0x00059d54e09e90c0,0x009ca699d8f06af8,0x00d066042374f931,0x0023f57594c72ecb,0x00a3cea54b00ada9,0x006e85d3bf301d64,0x0064f72838f28a65,0x001389c254c1085a)},
+  {FIELD_LITERAL(0x006ef816ae9d9513,0x00c59fea18afa49d,0x006942a6d3f9dc43,0x00f79d28273c3329,0x00cd9d50f4d2ffb8,0x004c21c3890ec897,0x000a9dcc785c1f7b,0x00bd1f5227f1b60d)},
+  {FIELD_LITERAL(0x00e7522830cd1cec,0x00767f8b26f3ede3,0x003b793ad3558cdc,0x00b0945c19a3b1bc,0x0038a900316beea1,0x00032613c7ba78d6,0x008c40f27ab711d7,0x008685b6907e6ca8)},
+  {FIELD_LITERAL(0x00155d029c8bfc13,0x006944b5be202724,0x000cbb3822abfee6,0x00b2d0f9b6ca20cc,0x0044eed1e2e69ec6,0x00dea7ccd3ea7235,0x0097f5329a2e17ea,0x008d372309fd0c1c)},
+  {FIELD_LITERAL(0x0012e9c5afd969c7,0x004ad53b7a096029,0x00b45c949d9615ca,0x00ac1ee1abbed915,0x00347f9545de3405,0x00a8d7dbe5884d62,0x0011ccba6f8e4707,0x007a8aab33e478c1)},
+  {FIELD_LITERAL(0x0067206f664d604e,0x00d9d59374def0f0,0x00df8801b195df06,0x00dc2a3da9b8a34c,0x00fd23b454a41b7b,0x009ef8acf2ca8b90,0x0022ec334196a3b8,0x00ea0bb130567a72)},
+  {FIELD_LITERAL(0x006e47c761afec1f,0x004e2e244a600e73,0x00383092c0cd6398,0x00c9ea57120ff980,0x00b078664be8112e,0x00737922e93bc761,0x0090b3833329d05f,0x00ac9fdc7fe5de4a)},
+  {FIELD_LITERAL(0x00dac0ced08cd420,0x004e9d496b7e90a6,0x0079a81fe8110a77,0x009c18601f6dea09,0x00fabe3ad558e335,0x000b9c2dd7133735,0x0094a3a291223d6b,0x00e6a13af58a579b)},
+  {FIELD_LITERAL(0x0042095e6fa87c92,0x00702158e1b2bbd9,0x0097ffa434ab0f3c,0x0054b668a0283228,0x00d6f540e63c1162,0x0046a293ff7f12c5,0x005cd4297c131fde,0x00f6fba0264eff8a)},
+  {FIELD_LITERAL(0x0022e6b09563dcd5,0x00cee4a14901dc40,0x003fdc27d0dac8bf,0x0082d90d312a0567,0x00cdfec8cd3e272a,0x0062965fa6b62b3e,0x000319d7f627d044,0x001208f28b3d21bf)},
+  {FIELD_LITERAL(0x00186ad53f0d8032,0x009bf66bff1954c6,0x00cb5dce2a0a65f5,0x00eb3c106db233d1,0x00a01d7ed2ea2d93,0x00bdbc1da3758981,0x009d3bb39c9183db,0x00884204f44cf3e2)},
+  {FIELD_LITERAL(0x0010bcdefd3896fe,0x00f6c33699dbef0b,0x00d3c5c92f2c1876,0x00c7518305b7e404,0x00e780462308e3b8,0x003b6107da071653,0x00213aad4d518133,0x008ce45953fa4084)},
+  {FIELD_LITERAL(0x0053259052991231,0x00c8fdef43c191aa,0x0060f494bbc21487,0x0039310b33af6996,0x00774b8ef8aca111,0x00c8c5c1267a91fc,0x00fe1e62b1fd3aaa,0x00e9347a2ab17772)},
+  {FIELD_LITERAL(0x00cb8bb6cca46152,0x008bec0c728d2a93,0x00e937973213a35c,0x0018137caa9b0de4,0x00a78b8f623cb5d3,0x00e7a7f717bbd200,0x00500c27a9869d25,0x007a2b614d833f32)},
+  {FIELD_LITERAL(0x00519712ab060746,0x003c57d75f74f95b,0x00e38027523689c6,0x0065cfbee1c233f1,0x006b16dd80028b68,0x00110096587ab1a1,0x001b7f1e37970b85,0x00c8b025c44f27c4)},
+  {FIELD_LITERAL(0x0070784659226e39,0x00d44a4d48368069,0x0044941a9bf927cb,0x000c80e14f56bea9,0x00dce173f0bb1132,0x00dc1ca9050deffa,0x00d74ed1875d52c3,0x00d19c1b04985418)},
+  {FIELD_LITERAL(0x00b0e20da9ea092b,0x004df1f159df05db,0x004f3c7c837dcc05,0x00097c3069cfb5fc,0x00bcbd270a208505,0x007df20c5656c3b3,0x006a671e80de00bd,0x00f7b233d656a195)},
+  {FIELD_LITERAL(0x0097b8bbd4584ba6,0x005fc08e012e3516,0x008490dfc757e13f,0x008346d631dc9495,0x00d5dd8f83fb6b37,0x0059a111c7365aaf,0x00eb2d63c278040c,0x00281353612d9275)},
+  {FIELD_LITERAL(0x002fe76502b2d1e4,0x00c863556dd4f518,0x008720a08c42119d,0x0088ea745284df13,0x0028a7e287f4fe23,0x00ca09c5a985a3a2,0x0066e9325101ea9d,0x0028cfbbe21e4dd6)},
+  {FIELD_LITERAL(0x001784f956117711,0x005b3de51ec71604,0x005b08f6ab758b42,0x00b5fcdc6c2966a1,0x00f4bab9e33f6877,0x00945100d5820292,0x006ffc6a25c059dc,0x000f239f568264fd)},
+  {FIELD_LITERAL(0x00f20d41458528c8,0x0072775442ab3bc3,0x001bdb7b4d58801e,0x00d27cf53d6a27e4,0x009072dc0dfb3f9e,0x00b00e2e5056f803,0x00e94913b50393c6,0x00e5a631fdce296c)},
+  {FIELD_LITERAL(0x009b0002e52d13db,0x0045c18cd76b1ba7,0x00dc4a5a54f05fe4,0x000e8642af504795,0x007100245d5e9614,0x008f16ca9cb7df20,0x007e724dd6d2de87,0x002c03d48592dcaa)},
+  {FIELD_LITERAL(0x00a8286af87ca005,0x0032733e68e27139,0x001211a8dd025902,0x00319d5f64e3655b,0x00cc1c729c9d16d4,0x0062f113f91725bc,0x00f26ef12129a5c0,0x00122ce5a766b6c9)},
+  {FIELD_LITERAL(0x009747aa38f7c3ff,0x00101a100a735dc5,0x00a1a46ea2411fcb,0x00f60ae6204f3736,0x00cb04adc39ad58a,0x00668bff79ee9023,0x00565a89a0bab3d9,0x0068b1a0796a2ae5)},
+  {FIELD_LITERAL(0x00116ab8c946abff,0x0010debd27f10ec1,0x0066d4b465b7492d,0x00aa0eebc751dd96,0x007a6f00a85ae9b6,0x009217a668288372,0x0023656379487b47,0x0027799d2d378d04)},
+  {FIELD_LITERAL(0x00688b1571479bbd,0x00134a9adc734146,0x00430bb9049c5e81,0x0043ae3eceb97f24,0x00241083f237a620,0x00c0f2955f774a37,0x00f1abc76c8cdae0,0x00f3028a2a59821d)},
+  {FIELD_LITERAL(0x00f45787b3927746,0x00efe5b4fffd7e00,0x00c188ec8cc8c3ce,0x00b3f73c535eae66,0x00dfd87e69b38040,0x0024a7b397fc1a03,0x0078730bc34151e3,0x00536072006d7aff)},
+  {FIELD_LITERAL(0x00a42c6cb10c8465,0x0016a892ffcdbd51,0x0001911bcd3481e1,0x0049ef36df15ee7b,0x00d1b9a1d9e49e36,0x00341467e6e94665,0x001db1a44511b8bb,0x000f312caca612f2)},
+  {FIELD_LITERAL(0x003f8fff7f554970,0x00559ad3577fdd30,0x00a3a9d4943ff9f5,0x00a3bf9744c6675d,0x00205f83d86ed6a7,0x007cdfb3230b4b6c,0x00d3bf156ed7cf8d,0x007b05a36968e3dd)},
+  {FIELD_LITERAL(0x00dc4c704c8b86c8,0x0077ce00e27da58c,0x0032f87fec53f291,0x00f5920ec0cbd4bf,0x0039766951a3ac5a,0x0042555f89187142,0x00dbc52e16e6aa0f,0x0007e024808115ff)},
+  {FIELD_LITERAL(0x006c94e42ca40060,0x000fd785ef353f72,0x00180904d21bd56a,0x003430f405d2058f,0x00c3f3f2f0872625,0x0024ea58b464015b,0x0064173a4d9b54bd,0x006c365554a4f672)},
+  {FIELD_LITERAL(0x001022df222a4dd9,0x00f406656d03f6c6,0x008b13859813eda2,0x007211093b34f532,0x00654c8aac6e14d5,0x00080d5745d439c7,0x0059087693ced263,0x002d219822a96ba5)},
+  {FIELD_LITERAL(0x00a396c673eee92b,0x00085b97e1c114aa,0x002dc56bfb9ec253,0x00930623ee1b7d65,0x004a3a82fe5e24ee,0x00b2592b2dcb290b,0x00fa38c87b43e0f7,0x00c4e8c376abeb74)},
+  {FIELD_LITERAL(0x00f7eb79a0de6c2e,0x0092e5716540317d,0x0089c38b04533eda,0x008dca4bc8775497,0x00dc39f8cabce307,0x00457e84fc0a4dbf,0x003d2a247fa179a0,0x00601b7c4afac880)},
+  {FIELD_LITERAL(0x00fd25e88809878a,0x00d8414c5342ddd4,0x0059140b4816c4f5,0x004f8b0fbdd4994b,0x009198a439b86eae,0x00f7f5cb3137f2d7,0x0082515f7168b05b,0x00f1421f96735a1b)},
+  {FIELD_LITERAL(0x00e9eb626d34b1ab,0x007072514a6c67b1,0x0026bb768c163e28,0x00d3245fb3038aab,0x00bb257fea741cfe,0x0054b4895392e8ef,0x00eb303f719b7c3f,0x0043574e2256489d)},
+  {FIELD_LITERAL(0x0040963b962cd943,0x00dda92456514346,0x00a3eb085247ebbf,0x00af364160a4c718,0x00877014b25f34b5,0x0046a1b20d6e4bb9,0x00efe2f8618f632f,0x00bde62025d4fe46)},
+  {FIELD_LITERAL(0x00c08c920d42384f,0x00fe0645d493f872,0x008739394e385bff,0x00fe8fcd572d37db,0x0049250ec81d2fdb,0x00b04005b6dff776,0x006d8c4d42bfbd1f,0x00f384f463585bc4)},
+  {FIELD_LITERAL(0x007a8f36049115cf,0x00a3ae9db57759b5,0x0069d18d101d380c,0x00691f1e3fa9b04b,0x00de3adcd6a00d13,0x000fd50100432967,0x002a59408a767515,0x00ae9215c9ddf9aa)},
+  {FIELD_LITERAL(0x00e1ffb69b1f24b7,0x0018592f5eaa57cd,0x002df2beb8b0fa93,0x0086835f22a164a4,0x00b7db0b6c3c9c2b,0x0082cc08524821b2,0x0054a77e6251f128,0x00bbf8ebe1eba84b)},
+  {FIELD_LITERAL(0x0023cdd6dbbddf78,0x007ae420fdd83707,0x00cbd314c4c396bc,0x005e074ba6cdd22d,0x00770daca26c1db1,0x00922247470cb6ba,0x00214ccf0f0f4d63,0x0080ac50faf3f4a0)},
+  {FIELD_LITERAL(0x00afae1afce62eb0,0x00541b884c5b29aa,0x00b5ed978736ffbf,0x006efeb2da78b77e,0x00057941bb9a805c,0x00750461b25e56f0,0x00b790aca260c8ff,0x00348d07d2db3c9d)},
+  {FIELD_LITERAL(0x00c794452b7912ec,0x002cacddbb6dc442,0x00bc58e8dc3d3b0a,0x00b49af429cb0172,0x001cb32e518951b5,0x00eb803e9c441730,0x008997473c9856e7,0x008e84b130ed25d1)},
+  {FIELD_LITERAL(0x00820155a0b54407,0x00c146eb4509cc03,0x00d85f98e0b13dd1,0x0047707eae8c4252,0x00c62621760617f2,0x00a93ca522732b1d,0x00bcff9af763e7a6,0x00d2d7c772ff3179)},
+  {FIELD_LITERAL(0x001ae5b8b0799e44,0x002013224c743c16,0x0033cb4fbb637e71,0x00e228d9a9cecb37,0x000e5beefd9d79e2,0x00a720d2318a42f5,0x00f26a23c85c10e0,0x009c9aaa4f206714)},
+  {FIELD_LITERAL(0x0001d879515491b9,0x00bec74e24f8c321,0x005fadcbcfa4f9f6,0x008c18232542bc62,0x00911afeb0ac0775,0x00d218e32a6cc8be,0x002124088cf7a40c,0x0060f333bd702777)},
+  {FIELD_LITERAL(0x00d4a56c3ae939e4,0x00ae31bdaac85455,0x000f8817692bb2af,0x0028d4ac91061aaf,0x00191ab10a12078e,0x00e355d1f4de9cdd,0x00352dcd7466a81f,0x0065174d63494dd2)},
+  {FIELD_LITERAL(0x00e982c12a6993c5,0x00547d237763bdf9,0x008aeda68c02b158,0x00fb7c638b4d2eea,0x00be947342e248f8,0x00fb8427e8fdb5ca,0x006a3823c73aa16b,0x00979d489dab1912)},
+  {FIELD_LITERAL(0x00cb5b1a539e1a79,0x000b56185f161530,0x00612143924e88dd,0x00f266d234cd3fbc,0x00c0832e56f61274,0x003ffec1d81e5eb2,0x00f9f94679637a82,0x00c713841d11c028)},
+  {FIELD_LITERAL(0x007bf538e15112e6,0x00072863e4c46575,0x0037cb0dde66c073,0x00bd616a57151eb9,0x00ea4f05436bf0e2,0x00a8e804916545ba,0x00ceb409a4345605,0x009d0e5ffb982634)},
+  {FIELD_LITERAL(0x0091bb3f1db300cc,0x0027ce34eadf7500,0x0007ba31ab38a692,0x00d7d025f508a51d,0x003eff730f428bad,0x00a3a25959d512cd,0x00ad7a8d41b636ee,0x009b948c29cd83c4)},
+  {FIELD_LITERAL(0x004695fe06262ce2,0x00708c9936847736,0x0073433d15e36e24,0x00d388747e2ca95d,0x00fc87f15143684a,0x00037190276f8b54,0x00d0c462b42b3f60,0x001e15b5d592751a)},
+  {FIELD_LITERAL(0x005c360c9ec926fb,0x00b38b8f8fc77798,0x00ff9c4ede07a46e,0x00e342dde52a79c6,0x00a67a28941e4945,0x0017f178d72afce8,0x00a8b201f09f6639,0x0000cec291abd19b)},
+  {FIELD_LITERAL(0x0078c6c216af9197,0x004c2d3909eb218f,0x004ad00fd6e6859c,0x00245330bffb188f,0x00d2ab74b8e5bd1e,0x004b85effab23517,0x00cf168d52fbac7d,0x0086c9563f3eab4e)},
+  {FIELD_LITERAL(0x00d9c76cfd4d304a,0x00ff5ad9f9445b02,0x00510a92c389d2da,0x0051927866d97843,0x004f50c8c8f73ed4,0x00500af7661e0ac5,0x000fea6bf5628f0c,0x0042655f1167fb64)},
+  {FIELD_LITERAL(0x002ae1a3fa6cf5f2,0x00c88fab26f0cd80,0x005e7c0ad29a9176,0x00d6265d21c3e65a,0x00a68d706eb5ec94,0x002aa725fd008b7b,0x00c4ba6bc7965d79,0x00885ed1092bcbc5)},
+  {FIELD_LITERAL(0x00c3d4928d096d2b,0x00d9e69b9d4c4b7e,0x00402d32b7f14c0d,0x00e951a611a43584,0x00e50a805153c02f,0x0044246171d40671,0x0028aeaa0f1dfb71,0x00b2d8f73d5aed85)},
+  {FIELD_LITERAL(0x008b7f2dc915aa8b,0x00ac1da9d8196285,0x000edcea4cceea71,0x00d2c34b83d47dd8,0x00d0b793858299ca,0x006e659ea9dcd2dc,0x00152a0a4210573e,0x00cfaea2a35245b2)},
+  {FIELD_LITERAL(0x002748dc5b83db3e,0x00153bf38e29bfdd,0x003c4dbd3db0a9c2,0x003338617c6046a4,0x00860ed2d45d14e1,0x007fb0bf1c2a560c,0x00b71b79b93e8092,0x00fd3788a81f4d2f)},
+  {FIELD_LITERAL(0x004f8fac56202e76,0x0022c1614ba605e1,0x0061dcf143a8035d,0x0075654783ced214,0x0066701b647a3365,0x00b6313199267acc,0x00e44813011eca63,0x0086b06a9d201e0b)},
+  {FIELD_LITERAL(0x00db73b00d9d2fa3,0x00dfeeebda45cfb9,0x0011c2cc1c88325f,0x00d0e670fed3996e,0x00ab1ec65e73dc34,0x001144c008e790a9,0x00a08dfd9fe3e033,0x006be83b6dcec020)},
+  {FIELD_LITERAL(0x00095dff0a3f71be,0x005f9341b664ebee,0x005b1856a7b3957b,0x0093f522647f9eb2,0x007056b15ceb5a28,0x006eaae0b47ee71f,0x00c69fd5b49beb92,0x0083757b9ffb4580)},
+  {FIELD_LITERAL(0x00080adfaea4f6b9,0x00ca6dd9b6713b2a,0x008c135e07c20883,0x00de204971fc45c4,0x006a4e9094a9bd92,0x000b73d5e8f8702e,0x006390dfb33daaea,0x004c03e94e4d7480)},
+  {FIELD_LITERAL(0x00e1844851672912,0x008b2f012db56553,0x00cd339cc8b408db,0x001379a3ffb80d77,0x0058d65739284fab,0x00d03b5ef466d145,0x00d5d78d5bc12564,0x001156388880d555)},
+  {FIELD_LITERAL(0x00659ed00bf27741,0x006d84b93bcbe54b,0x0076c983986759a6,0x003942430b12f22b,0x00a79f66d1d1b6f6,0x0015d521d9c84a05,0x0018e4dafe59287e,0x00a3951d5683062f)},
+  {FIELD_LITERAL(0x00af7c61f8ec7789,0x00e9dc486b7baf28,0x000725bb4b990ac4,0x009b9a4936207e43,0x00aacabd16842e54,0x008fbfc12570d6a5,0x002b8d3ad1fa604b,0x0095ae64bd0c36ae)},
+  {FIELD_LITERAL(0x00e5c2a7b6f7acf3,0x0007f34fc69e0b36,0x00ce0604a8baf586,0x0088432e95d3a306,0x001301cb5e6eb3a5,0x00391f0ac8e83a9c,0x0082971f41443359,0x009f67f413581f31)},
+  {FIELD_LITERAL(0x00b59fc6f3d83e44,0x0020f7a0723daee2,0x00c381f003fd7d77,0x0097bcfe4ffbc75d,0x0082ea522532897d,0x00795a88ca1b3bac,0x008022ea9c5375a8,0x0076997be8879508)},
+  {FIELD_LITERAL(0x008d41ccb70ff5ec,0x0014ad976aa9e3ba,0x00dc5460d60b4f05,0x00e9607f51f93089,0x0055f510f502a6de,0x003477a4db797f70,0x001f09a17d4ba6ca,0x00c0fa739632eb2c)},
+  {FIELD_LITERAL(0x007c376f7dde01e8,0x0055a20c534fc9c6,0x005928e493685bff,0x00c91b6f3fb47b1f,0x00daa6e9b8af6a13,0x0076dc35a6ecd0bf,0x00eb82864c87a3d5,0x0073bc278c440364)},
+  {FIELD_LITERAL(0x0040e1345546298c,0x003731caa0fa34b1,0x0013822cbea96a55,0x00dc24391dd352f6,0x00f0b2001786a974,0x0071dd30e1a5d131,0x00193e8e654d8153,0x001e9a1b2d74a0c1)},
+  {FIELD_LITERAL(0x008287eafefc0ac5,0x003e9fd8be6577af,0x002a4f4f2cabbd03,0x00d644fa6b1db0bc,0x00671b65b1ea4019,0x00848d703d38efd5,0x00b6ba6d934d44b1,0x00734f75824134a4)},
+  {FIELD_LITERAL(0x00a6aa86efd8d3c8,0x003fceeca9acd8b1,0x00e81ab00e6f15f8,0x00e21cfa38535ca2,0x000c75fa35cc99e9,0x002106b20b6094d9,0x00b46d7ee950d5d8,0x00309c094b1e27d6)},
+  {FIELD_LITERAL(0x00d41dc141bfadde,0x0077fdcd23bbba32,0x00de1e698c1e0ee2,0x002281189ed34ad7,0x009df4bc0e510b91,0x00756ebb7dac7f1d,0x005e8a7f3fd06af1,0x0085c7fd200a122b)},
+  {FIELD_LITERAL(0x007cdc81c9f5dcf8,0x00f3398511640c78,0x00e550d2aa9bad1d,0x00876c01a1cea453,0x00182480c584060a,0x005186507a70242c,0x00d4e0d501cc0631,0x00eda96dd09ae0af)},
+  {FIELD_LITERAL(0x0051bba7bc8b377a,0x008beb4f60c6ec23,0x00cc9116a22748aa,0x00106c4a3959590d,0x00f3d468abda8158,0x00789641663dc85f,0x000374b2903bd31a,0x00b13db47117f8cb)},
+  {FIELD_LITERAL(0x002de8ae90cbcd7c,0x00230c50d1740187,0x0070ea31bf38a2f8,0x00dabf219fa450e9,0x00c3163fda34256a,0x00e24efa987c40d0,0x00037a09c23e9c19,0x00c8bd617dc94593)},
+  {FIELD_LITERAL(0x007b587a24b3dbbe,0x0045521e0f0f0ce1,0x009e867080ef8948,0x000c59196f95f8b4,0x004d4612faf6853c,0x00462b03c7715889,0x009a12f7b731a3d4,0x008e49f10546135d)},
+  {FIELD_LITERAL(0x004e7fb297e4d4db,0x00cffbec6092aa44,0x00754feb16686505,0x005dfd4df871b4c7,0x00659c420a92cc86,0x00f6b7335ffb91ae,0x00216520a2aa3835,0x00f9cecfebda27c9)},
+  {FIELD_LITERAL(0x00912146ea46ac41,0x003a430e6d7092c4,0x0034e1a9ab4580fd,0x00191dfe2447a345,0x009c1aa2bc818b19,0x00b3ca4bf7a12777,0x004a4ec0cce3e817,0x002bc85381090dab)},
+  {FIELD_LITERAL(0x00ee44969f7fad31,0x009e9e6bf8c83859,0x00762fbd986e7b35,0x00caec2f3a0028ed,0x005ca71ba1fff2a7,0x004b6ab875274a15,0x00b96760e9244215,0x0095c5775c872968)},
+  {FIELD_LITERAL(0x0094b97f40ecd81f,0x007affb30e7b552b,0x00001c91fb1d85f9,0x00fbe0a7594f3291,0x006891cc641cc71a,0x00b5a5c9ebaa72b7,0x0075b4c5825b154f,0x00b06535dc435469)},
+  {FIELD_LITERAL(0x009f1f436fb09873,0x0014d13b7c937123,0x00374fc8e6099db1,0x00bb1682526b2052,0x004a2426fa4253ab,0x00b8849ed62145c0,0x000d463a26f48ce8,0x001dca45d2ef9872)},
+  {FIELD_LITERAL(0x0011196cad5cd667,0x0013e7ecc97487f7,0x000ebb3b7b2daad0,0x00f4a8f150344714,0x0067382e7ab1c824,0x0059eac70581f128,0x00eb513d1e4eb491,0x00150880b4532f3b)},
+  {FIELD_LITERAL(0x007adce2adc2d8dd,0x0046fc2453ac97c3,0x0080fc6d8eab1315,0x00133fba2c6df9c3,0x00d759b0aa982b84,0x0034a27eb387c2f4,0x0035972de775d61b,0x00da8c610127cf1c)},
+  {FIELD_LITERAL(0x0084f300a0c3319d,0x003e9619471a3a4b,0x001c48dc6b5c8e9f,0x00307f80a85ffd00,0x000be40a00e9fac0,0x00fe22b9dc46fc0f,0x005deaec6fb12edf,0x007283be327aaf43)},
+  {FIELD_LITERAL(0x00c062cb693c92bb,0x00e29a76070c195d,0x0095c42dd47c84b9,0x00f9a37f853faa7a,0x00694521c2f576b0,0x00fbbe1474c3225b,0x005261d28b82cda5,0x006e157067dea4af)},
+  {FIELD_LITERAL(0x0002aae25b4fc954,0x00d264bfa674b15e,0x002dddc9294f6d23,0x004ea862160c3ed1,0x008022d5b339e29c,0x007859b983ba48d0,0x000a01404bba116d,0x00e68bce39b27b2f)},
+  {FIELD_LITERAL(0x009114d1daef1f47,0x001bca13282d76dd,0x00acf704efddd511,0x00ae8cc2ee198883,0x00f69d0e494a384f,0x0034015ac10f7081,0x0007d6c9dc0f4b67,0x004548a8ef7bd8ff)},
+  {FIELD_LITERAL(0x002c24360e940891,0x00f58c00aaf559e2,0x00d23ba4b87916f7,0x001cb17f66c28553,0x0002053f09d6ab66,0x0073c51fb5f34132,0x005c53f71a4dff05,0x00fc5942d47205db)},
+  {FIELD_LITERAL(0x00ff950eb7cdfac2,0x004024dba75d3787,0x00c53bd84feff0fb,0x0078ac8b8ebd0428,0x000c5320302dde2a,0x00639cc6cbfa30a7,0x006440eea46f62aa,0x00559e9b8eea1b27)},
+  {FIELD_LITERAL(0x00805eaf273b0f88,0x0056ac8a5b113f7f,0x0088b19fa44c3b9e,0x006fb446efca53db,0x00c273a0e202d80b,0x00e68c381b16e980,0x0036b2e479a43817,0x002cb49b3bd0dbb3)},
+  {FIELD_LITERAL(0x000937ee7a8997c5,0x003e3a5de4b7cccb,0x00ca209829b309d4,0x009b21117202f3ff,0x0069c66e7fe40ae0,0x0088c5324b3e01ca,0x00f28d3c71bde1c9,0x00bdd71bdd1d0795)},
+  {FIELD_LITERAL(0x00df1cea24c57c82,0x0084afaa0dd3d6c7,0x001882e59ab63737,0x002f25f3bd0b5d73,0x0078280c96d42ee7,0x00be917e4580da15,0x004211d777c82754,0x00b11c5b9dc43a0e)},
+  {FIELD_LITERAL(0x00cd3635ab57368d,0x00a97ca195787199,0x00fb9670ab19bfcf,0x00735ac926ad796c,0x00cafc46d6f4de43,0x00c2b7c9765c449e,0x008f2743ec3e306c,0x00852004ba5a792a)},
+  {FIELD_LITERAL(0x00498ada0a1ea13a,0x006b7439e3d14638,0x0016e2a1622c7a0b,0x00b5b9b8440f6090,0x00b6b8b1cf960b39,0x0055b9d92e0cb697,0x0028fbab0de2ee36,0x00cd84aaab444457)},
+  {FIELD_LITERAL(0x009876bdf5539eb0,0x00cb7ca28457cb62,0x004865ec16fa447c,0x00bb030d7c9228be,0x0086f7d200e2d9c9,0x006d67903a535d3d,0x00d50818368a9f40,0x00a3935a0f3c9a4d)},
+  {FIELD_LITERAL(0x00f2eac9a95b47c5,0x00080193f2618087,0x00c21531086013e2,0x006f8aac5088e97e,0x00b449da0ad996ea,0x008250b805d8b58d,0x00022492c2669192,0x00f0c65b17510819)},
+  {FIELD_LITERAL(0x009e78ab5c3fe61d,0x00fbb3172351cf7b,0x00edc6c8bd5e9865,0x00f9fb2c502ee45b,0x00ec4fa7a2cbe7b3,0x004cc349c9531ba7,0x00f1a557a42d7b0e,0x005a604c619bf458)},
+  {FIELD_LITERAL(0x007e22ba9c863c58,0x0054cafe498c63d3,0x00dd2bbff7848dd8,0x0008854f7d8353dd,0x0015cc140f7d5f7d,0x00721f4f0f93aecc,0x005b31eab8754c09,0x0079f33094c64785)},
+  {FIELD_LITERAL(0x00332029bf1a191e,0x007b91fd86e82564,0x00848481bbd64f2b,0x0069f792d5830e23,0x0023769bc2cefa89,0x00208125977dac10,0x006294aed79cff74,0x00990ef05ca95f0b)},
+  {FIELD_LITERAL(0x000636b24e32c725,0x0044e068b98f7455,0x007b368b5bd3e0e2,0x00ebc252f10d7d9a,0x0012998113db3987,0x004feb02b6bd764b,0x00f95fac284bd108,0x0022ba1b94c64b45)},
+  {FIELD_LITERAL(0x00bf3ba94e487894,0x00f09fe3f611e510,0x0085c7023ae388ab,0x0085cb91de61cb0a,0x0025ca636a4b4b49,0x00ebd96d6957277b,0x00f3a6a8f8b4f49f,0x005e2065f3ea0ed3)},
+  {FIELD_LITERAL(0x00bf9a226c325a67,0x0008d63bd91c9cd3,0x0026fb62ab0b072f,0x00301ceb2bb80486,0x00ed567ade7dff5a,0x007d978c4de6f8ce,0x0033de115e42d6d8,0x00f04ca3d19f0f33)},
+  {FIELD_LITERAL(0x00f7d6033dc8c58d,0x002db91badb84a01,0x008c3365b4fde70b,0x004be120a63bfcb7,0x001e734efec24122,0x00aef3aab66f6013,0x00bc127df4360734,0x00853610c8c0527c)},
+  {FIELD_LITERAL(0x003715f0d4d358ef,0x00f5933e2b305334,0x0007989de96a13a0,0x00a00993db8ed470,0x00c4ee0febdb06d1,0x00d2ea605102a7c8,0x0034dbf0507075e4,0x0057f2a989bf638b)},
+  {FIELD_LITERAL(0x00549656bfa55577,0x00bd379b32091f29,0x0032d2e62d34b2bf,0x0055eac2635204de,0x00c759fe91ae0cbe,0x00d5edb37ab13d7d,0x00b91ff21a041d2c,0x0018e4eb457b7022)},
+  {FIELD_LITERAL(0x00e0638cdf0e3fd2,0x001574256261e22e,0x00bd8a317d1e29bf,0x00cd404cc36b5a4a,0x001fea417aab20f9,0x00a526bd5cd66bbb,0x00f2ac729b75437d,0x0053343321c7943d)},
+  {FIELD_LITERAL(0x00e3fc043810caea,0x00c3e246c31103f7,0x00469a2cdc52f3da,0x0085f6cbb490cc46,0x0019e9fe244c2fd3,0x0087655e89139b94,0x00d96197d7c3ff85,0x00819aaaa3af84f5)},
+  {FIELD_LITERAL(0x00b5428215e6358a,0x001802b0d786ac65,0x005d37acb613eed6,0x00b4e31f0911e102,0x003cfdcf355637e2,0x0005df1056401c0a,0x00a2ab9737ae0aeb,0x0051cc138639b188)},
+  {FIELD_LITERAL(0x009af98af63a5713,0x0036983c36d3f7b7,0x00ed04c9fb20b98e,0x00b9e0d3dc96420d,0x0015707fe48868cd,0x001fca9a27fda5b9,0x00cc6df39cbf14ad,0x008236edc3668311)},
+  {FIELD_LITERAL(0x00b6b33fd876e8e0,0x00e907b2f574d867,0x0046be63c8b0e2e8,0x006ee9c07a308f8c,0x008e391bac8ff4d2,0x00dd1e23dcff87bc,0x0095943f5862e374,0x00436b46ae71ce39)},
+  {FIELD_LITERAL(0x00063415859fd6aa,0x003411f7f2720b1d,0x00d50e6fd5122d9b,0x0069bcae31807026,0x006b41e00fda9318,0x00cc6943fe6d7802,0x005dd8d499651e56,0x0075f9bf9931ae2c)},
+  {FIELD_LITERAL(0x006fbdf262216809,0x009f285d8322a692,0x008087aa55ddcce1,0x0001e04ef1745648,0x0059d8fa1697bd50,0x003c71d44e7eccc2,0x002c64907d54f2ba,0x004667a9d2693825)},
+  {FIELD_LITERAL(0x0049f2b2f5b0b488,0x00c888e0ad5f2bbe,0x00ff7d3065df7e10,0x00525c56b472b3a8,0x00e2dc83a8d68427,0x0003bea343d9193d,0x00be2572a0ed7905,0x00fa63ba225c1f8c)},
+  {FIELD_LITERAL(0x00c924adc90c11d7,0x005e3074ebc2a045,0x008466859db98132,0x00be2413acaa032d,0x00aa9be6d623853b,0x0020cf63f24df5fd,0x002f9a8853e9df2b,0x0055c17792a65d16)},
+  {FIELD_LITERAL(0x0092d12cc38bdaf0,0x0086c447f3d88dd5,0x009d9ee2c683f7a5,0x0065785ad24eacfe,0x002c86009a45e03c,0x00e1b5d1cdd4b9af,0x004b21fb49a91474,0x0041699acfc6e106)},
+  {FIELD_LITERAL(0x00f146d224231709,0x00fd6d21278479ad,0x00c462d8a2f8fc26,0x00737f2672e83b25,0x000654c8e1f6da91,0x00bbe1073c912dfe,0x00475e84e61cfeb8,0x00d463d97ca6e138)},
+  {FIELD_LITERAL(0x008bf5dced23268f,0x00a0ab5a769f4748,0x00d7a326b3944126,0x0075ace9533ac3df,0x00997e199053f340,0x000ac45d5fde8cc8,0x00c7afba146f1d7a,0x00244bdd1728eee1)},
+  {FIELD_LITERAL(0x00c58d4133ec5a7e,0x00d8f4dd7e5f1936,0x004c210b46ae73c4,0x00da254355a42089,0x005497b97c2ee854,0x0033188896c8f175,0x004491453e15e2ae,0x007e829c125b26d3)},
+  {FIELD_LITERAL(0x004ad8776c8482c7,0x00a65ed151da2380,0x002fd2c42a5ca6b0,0x00053093261b5db0,0x00cc8907918f97a8,0x002dbfabd3495781,0x00d375f26da95019,0x00736f94607f4042)},
+  {FIELD_LITERAL(0x007c20414d1114df,0x00806a3993b12064,0x004e23753bf50ef8,0x0020e64cda578646,0x001d090de48f8d81,0x00b19182c5fb6ae3,0x00411f764a18ac51,0x004957efbd496997)},
+  {FIELD_LITERAL(0x002545c3637f9b2c,0x007d7885adfb401e,0x0045a95b302d11df,0x00be400e065dd7a4,0x00556d90eeaca0d8,0x0095a93402f29775,0x001175369a6a1caa,0x009229873f8534e2)},
+  {FIELD_LITERAL(0x00362b5408f2ecdf,0x00fed36cfb736fa2,0x009d5178c0890a3e,0x004a89effff3c846,0x00459f34e97bb205,0x0003dadc2bf1b9d8,0x00ef3b902fa207d9,0x00eb0df0270c1f6b)},
+  {FIELD_LITERAL(0x00c0206411c034ac,0x0038bf79ca223582,0x00fe1606a2cd38f9,0x0090e4a4d0ad6089,0x0010c3f24e09e392,0x009f82771568f8c4,0x0059c520d212ecd5,0x008541edbd747736)},
+  {FIELD_LITERAL(0x009f82fa54da4950,0x0043a8d6b35af7da,0x00d56bf6a5b1ec12,0x006357876ef01222,0x00e86c5f3d8a7cc4,0x006dbb8cc78ef37c,0x001246844e24707c,0x003a85d53b39d2d8)},
+  {FIELD_LITERAL(0x006ed357467d506b,0x00abe1001be61d96,0x002f80dd2b1cf369,0x00f8b99b139824a6,0x00912565cd3173d2,0x00c544b59b2293fe,0x007435c9451f1e90,0x00f3cfcde2277456)},
+  {FIELD_LITERAL(0x00ba1933f0a3522d,0x001f0512facc9058,0x0078414b8dc6676a,0x00e2ffa221013029,0x008ccaac6db41f76,0x006c3d8e3c1438a3,0x00c780bfdd89ec3b,0x00c6b48c89856c2c)},
+  {FIELD_LITERAL(0x003bb5b3febb20a9,0x00537c20572c74e6,0x008d54686b99bd4b,0x002c4ad4e0adeb5a,0x007379f655f705fa,0x00c94f71a12ef174,0x00f14a7a7a6b1347,0x00a107791d085e3e)},
+  {FIELD_LITERAL(0x00a28ed1e3c48579,0x00059d0762c6f69e,0x0034d0e8145673d5,0x008cc2d31d461085,0x00896f0f1afc9017,0x000df7fdbdb7e98f,0x00f889efdcfc0b98,0x006bb2fe787a540a)},
+  {FIELD_LITERAL(0x002e491dc9622ea2,0x00394b5acd85fd93,0x00d0f3df1fbf9d11,0x00032e12ea0dbca2,0x001161a4a3a77e1a,0x007be3db0492a69c,0x00b647dc76740152,0x00a03549e052acb7)},
+  {FIELD_LITERAL(0x00899723b8ed16bc,0x00dccb8ad66d44ce,0x001ae86e084d9207,0x00ed9ad834a54075,0x004e16d3f69420f5,0x0063e46eb6e7570e,0x005d565f4d33dab8,0x007c86d14746bc96)},
+  {FIELD_LITERAL(0x005dd22ac7154f4e,0x001ae90701da226a,0x00b5634740820df8,0x0035cec658b4e3d2,0x00e7ce686b52beb4,0x004f06523b8b4287,0x0075e89ae299c91c,0x001b393968f20122)},
+  {FIELD_LITERAL(0x0096a735c5d60099,0x0036a33ee188fa06,0x0058d319c3cd4091,0x00de084f89dd6e0a,0x0026baf314d0443c,0x006befff3d33da0c,0x00252471f718fa0a,0x00c87cc459c1b393)},
+  {FIELD_LITERAL(0x0000c47836bb9d2d,0x004cf59c989433bb,0x00a311610c85620f,0x00cd8c7f2261e7fb,0x0072e6d7183df6af,0x00c3e84c6b638f71,0x0009413449d5f9d6,0x00f81a7097277443)},
+  {FIELD_LITERAL(0x0015a41407831ad1,0x00c2967f71ca3f17,0x00baae6f60beff70,0x004013fbd8c86f0a,0x007eed6500614478,0x00da77f178d4e5a1,0x00ac3145c99358fa,0x00fcb49e2e63461f)},
+  {FIELD_LITERAL(0x0027057bd34798b8,0x00264be7c7384480,0x001516fa7c92b82f,0x00249b08f066117e,0x006b7602cb986982,0x00f862fbc8753ebe,0x00e920783e13ffa8,0x00890394f498c3a3)},
+  {FIELD_LITERAL(0x00d04875e3054d9c,0x00ab07b1b13cd1b5,0x0059c8011dc3d004,0x0084816ecffa2aea,0x006d63f942e609d7,0x00b5afe00d83f5f8,0x00662e5c21515f9a,0x008a3d960e07f3fe)},
+  {FIELD_LITERAL(0x0065b497bf1f4749,0x0080dabd0195ac3d,0x00ba8c6e5861fb59,0x0053b2b0ea97a511,0x00592374de8f723b,0x00d4c13cd6d91f9e,0x00e0c8e026a23cf5,0x0080445554b22dd0)},
+  {FIELD_LITERAL(0x00cec18db84defb6,0x00d8e4e6e47706e5,0x00e17d974f617759,0x0019aa405eca7ce6,0x00260ac134cb7184,0x003a89cd4840491f,0x002ef28d62f6fcbc,0x005bf6890e9651c0)},
+  {FIELD_LITERAL(0x005392ffb2d5f15b,0x0060020eff59927e,0x00b54a0a1721a3fb,0x008efedb79caef19,0x00e73002df0b7467,0x006562d789270d36,0x009518f9e39cef50,0x000c04cd036ccc10)},
+  {FIELD_LITERAL(0x00076b99251d8488,0x006c993fa6947777,0x00be1f2522f5c21e,0x00c548b505bd011f,0x00c76a656a26e00e,0x00390c7c1265891f,0x00f7b830c1892c7b,0x006eb4c6f857e9c0)},
+  {FIELD_LITERAL(0x00e8cbf59c224b2c,0x000c9fd644cb631c,0x00ab9c430be2f41c,0x00e4816cbf83c64b,0x00c82d8e0ff4672e,0x00039ab439fec7e7,0x0035ee0c7d2d3c29,0x00f35df89f5fc4f2)},
+  {FIELD_LITERAL(0x0042ef31944a60c8,0x0042c2f779801bbc,0x00e4fab04aa41738,0x00ab878e43887f42,0x008525e921a4e8fd,0x002543702ce28ee1,0x00d5ebe1078e3c44,0x002683fa94e20a4c)},
+  {FIELD_LITERAL(0x000cfd3a79da18c5,0x00a42b37cc8883c3,0x00c2a0c2a897892c,0x0017c5008cb39733,0x001a9bcbd55f5bfe,0x003d80b7e39d18e0,0x00879cee6983a815,0x006878c5b0ac0f04)},
+  {FIELD_LITERAL(0x008a949d14074896,0x00a123377d198220,0x000eee634c24a9d7,0x003d75dda1856016,0x00e88931b1a8a49d,0x00a31e4ed39a1cf0,0x003296d2451babeb,0x0064417a6c48e1d8)},
+  {FIELD_LITERAL(0x007736bc0d653400,0x004bcebe4dae151b,0x00e3cd02c2c3afa1,0x00e74eb909a78fca,0x0013da525d5db4e8,0x001006a0e6ac190c,0x007fb4d761f62879,0x0087335ddd09df50)},
+  {FIELD_LITERAL(0x00f5fa92de298951,0x00bd317426bfb603,0x006e55c8644628f6,0x00a7c49d8d551c3d,0x0018269ebcbb70df,0x00273b112c6532a0,0x000b8ff2d92a9ac2,0x0039ff0555df50af)},
+  {FIELD_LITERAL(0x00097ef79fd2248e,0x008142c11d06ec23,0x00e1fbc71e7b6f5c,0x006befa15efcce79,0x0019695703e85f94,0x00a6b806f44193a5,0x00daae698a4003bc,0x00e8c816075420a7)},
+  {FIELD_LITERAL(0x006cdce87aa5341d,0x009a6662d3ea4071,0x006cd5b347f533c1,0x0044faacb82fa6b9,0x006892768050b06b,0x00b9a5b87ed63ffd,0x00ad663d1b8528a7,0x00f5d9571c1adfd8)},
+  {FIELD_LITERAL(0x0053299df05756f0,0x00b43ad9624c3f33,0x00a9d508a99690cc,0x00b1459b360080c0,0x00018f836a149c9d,0x00473dfb133a742b,0x004e350605041846,0x006822addc85556e)},
+  {FIELD_LITERAL(0x00d96c770e7d5a12,0x00916478d7cfb90f,0x00f47b86dbb1cd68,0x00494c80f0d1259c,0x0028d5d062f6ee34,0x00a7ec4f37a3cf05,0x007447977c40bcc2,0x00067c7366d7b721)},
+  {FIELD_LITERAL(0x001b8caaf97885c0,0x00371263f40b4349,0x00accf7d643fc37f,0x00a9a64b953e927a,0x004d00c27dfe364f,0x004353826d0c4a61,0x00dd908de392e3ea,0x00a5679d4c88bfc6)},
+  {FIELD_LITERAL(0x009c132d754e2bf9,0x0047a74599485298,0x0060e80fad6f9868,0x00985017e8e9fcc9,0x0077915bc34416c8,0x0026539d838fbe89,0x00f993e595a3b43c,0x008924b087e51896)},
+  {FIELD_LITERAL(0x00fa300ae86adfdf,0x009404d0a15f8597,0x0054d32afd8763ac,0x00302f646af95073,0x006fd03e6d30f92e,0x0008b016eef53a00,0x001b89cb7fae026f,0x009d3f09cb64c3fb)},
+  {FIELD_LITERAL(0x00c4fda2adb4cab3,0x001ec79adedf57a7,0x004419977c7e33a8,0x007a7289be6f349d,0x00eb42af7d2b31e4,0x00ea35df3992ba84,0x0021d3aa0a187bee,0x00d734dc408ce4fd)},
+  {FIELD_LITERAL(0x00d80d7e2a834970,0x0027d34e1b497abe,0x003f333576a998f1,0x00d386efa39da410,0x00aa750b4bc37b45,0x009b01a704f7ddff,0x008bd7afe152f01b,0x0069b9371c7437f3)},
+  {FIELD_LITERAL(0x0096bf3233a1f955,0x00dc1ba0a579140e,0x00cfb7634de051fb,0x001c248e83a2db8f,0x00358a9ad557c0b8,0x00faefdcf39aacf5,0x00565b27b84897dc,0x00b7514ee49dfe91)},
+  {FIELD_LITERAL(0x0025b56b697d8b08,0x00f5a10afef1e005,0x00724994cf802cfc,0x00df968791a3660d,0x0055d9376da66c2f,0x000d22a966b5e9eb,0x00a20e9511bdcba5,0x009fca49f54f2d35)},
+  {FIELD_LITERAL(0x007978ea0ca433c8,0x0097829152099d6a,0x005f998485fdaa06,0x00606263920e584f,0x00c97b120371e604,0x00c18ccac8100a7d,0x00a861462778ddc3,0x00b9e5586eaa0ae3)},
+  {FIELD_LITERAL(0x0060daf6923b3ecc,0x003c55a9730e47a9,0x007331b7a656063c,0x008c598a7d285764,0x00e1112f33ad4788,0x0096cf7deeeb326d,0x005f9cb2649b2032,0x00d59614be5e2350)},
+  {FIELD_LITERAL(0x00c688ee06c9fca0,0x000815cbb131fd8b,0x00b50e2f5405da2a,0x003095db4bdfb730,0x0048dcc215d531c6,0x00ae963a1228877a,0x006110b200c1cc40,0x00f6c183c0e4623b)},
+  {FIELD_LITERAL(0x00381ca78d8ef3b7,0x00e32112e021a81d,0x005cc4831bebd985,0x007eca37f268f058,0x00a3059795486167,0x00fe2cef60435726,0x00abcaa76d179b96,0x00065f49c6895c1f)},
+  {FIELD_LITERAL(0x00b4d026f5574987,0x00464f8dfec2969d,0x00fb10166db564d5,0x000e277f3fc6f257,0x0037dd58a621c0b4,0x0091ef1cfa0cc9de,0x003ff806e4af7b61,0x00a1e1c40f45c22f)},
+  {FIELD_LITERAL(0x00ed72e07f5c5b7f,0x00739c32599a9b4d,0x00ab985c84357b93,0x006055667fcca9e0,0x0065d128648dd53a,0x001a79df9d172f3b,0x005d6c1e30f7bbd2,0x0016864468366bb6)},
+  {FIELD_LITERAL(0x00692f829eb8b0a0,0x00a56fb3db6f20b0,0x00ea204ba7d11fac,0x00228f684a39aafb,0x0018314b134b0b2e,0x0064ff2547623028,0x008f185191c8790a,0x00ca314d309ba9fd)},
+  {FIELD_LITERAL(0x0007c722eb998644,0x009a303229420031,0x006930bc195d7b88,0x0032245ba16ddfc7,0x005f179ff8c49e07,0x00b2659d10dca304,0x00ed0c461bea8359,0x00ca154d9c9f60a8)},
+  {FIELD_LITERAL(0x00ca414f73ff3432,0x009b9d06a11523a9,0x00cf5258c8a80c5d,0x00162a11bc65c35f,0x00a91fc21ac6bd32,0x0069383144d6364f,0x0068d051699d508e,0x00e5ac98af2a3e73)},
+  {FIELD_LITERAL(0x00ba59fb88478c32,0x00221511e7d919df,0x001206ef22785814,0x00d3a1fa09d1effb,0x00a6bf0a486a4845,0x00816a9420e7be67,0x00c14e38bbaae93c,0x002c403e1128e685)},
+  {FIELD_LITERAL(0x00965a692f2c021e,0x00dc3605126b2d13,0x008d432a2d1da0db,0x00bd678aa4e449e0,0x000650d04a217db3,0x0084693179807a99,0x002405ba2d2d3a0a,0x008b16460e4cf47d)},
+  {FIELD_LITERAL(0x001c63f18dc3c125,0x009895553ab091c8,0x0011d7f9ec80a0b4,0x006c445e4e3e7303,0x00275b2604b518c7,0x009bb5ab8bfd0932,0x000b1e11db15f49d,0x0050ea60f2913dde)},
+  {FIELD_LITERAL(0x0053fe6442fba622,0x00c9cf002022f52f,0x00c458711789e515,0x002531633c52283f,0x00b35f48f6f47831,0x000b903a9940cae8,0x0012e82c91c00c0a,0x00326e4a5d8f6992)},
+  {FIELD_LITERAL(0x00ccb14f5c02d208,0x002152fc7fa0b171,0x00e7fda1f5f6046d,0x0099b4cd623200f6,0x00b497d2a5d3d876,0x0025a2a0bc2e2b4f,0x0095201c9b14d5d5,0x009d2f87195b7e5e)},
+  {FIELD_LITERAL(0x00730ad83abf6101,0x00bc55f716dc13b4,0x0037e58d7fcb7863,0x00ef5a66051151a5,0x008696708144f530,0x00bdd51183331875,0x001eceac8b536e22,0x001e4ef569d47e71)},
+  {FIELD_LITERAL(0x00ab22f176ab9963,0x00f7af55104d0036,0x006192e26b29eb0f,0x00ac5fceb6281866,0x006dd173765275b9,0x00f533f514339a10,0x007001f5c348d856,0x0003dacab5c7e7ae)},
+  {FIELD_LITERAL(0x001268a652635790,0x00a9b04b5ab5b4aa,0x00dbd654e1d9a41b,0x0084284e316ccb6f,0x00ec96cdad807b56,0x004b6d8ff772b28c,0x00f7606e72ed7031,0x00bb0f2417c80c67)},
+  {FIELD_LITERAL(0x0001de5fabafffb8,0x009647c077693d80,0x0093e31ef61bce8f,0x008741da598d6f8a,0x00579e82e723498c,0x008c57d9dfdf72ae,0x00430d91875d29ba,0x0062cf56665708d6)},
+  {FIELD_LITERAL(0x000d62411137f98c,0x00bed77aee1e2839,0x00a77b237619f567,0x000fdba4049f4d2b,0x00e13f0e3b935b17,0x00cdb161605759fd,0x00caea3b58fd4af8,0x00f09b21d656b39e)},
+  {FIELD_LITERAL(0x00ef049be7b04caf,0x001371c90765b1f6,0x00f9b2bef6e910f1,0x00ec058e29913f4f,0x008208cd70e1ad37,0x00b21417072bc284,0x00b9938f4abf20b6,0x00f7fcf2962b1911)},
+  {FIELD_LITERAL(0x00e227a7f17d6b3f,0x00f918b6c0563725,0x001306592556b310,0x009144df45d0a0d7,0x00326082e33730d8,0x0085608c4005cbed,0x005a3fbf418caf85,0x009e6c4529ecc067)},
+  {FIELD_LITERAL(0x0058db29a6249653,0x00c6b80c10a0f391,0x0093bbd38c69bbde,0x00ec211b69d1f4cc,0x000b4b248608733d,0x00e579d6f671763b,0x00b7c84df2edda4c,0x009c5e30ba77515a)},
+  {FIELD_LITERAL(0x0017ca751c5ed884,0x008a11698c51e7f8,0x0026dfef63053d7c,0x00c9a095a12d8696,0x000e82a7bfa2133b,0x007cf8f1cbf5d92f,0x00c6383127576626,0x002a1ef871ad2cff)},
+  {FIELD_LITERAL(0x00b24f4d70df6aba,0x00b4c8411be8a1a6,0x0025bf3671b1583f,0x0006f3aa1a36c205,0x00df009bf1f726d9,0x00bc1c88415f4f3c,0x0057111bbfab80a1,0x00233e658dff431d)},
+  {FIELD_LITERAL(0x0071578a16f5d36e,0x001173f6220873b8,0x00df454e68da9a01,0x00bdce66de43e4e8,0x000d4b037a090ae2,0x00bd0282be6e25ab,0x00fc66b0b825c24d,0x00c2b3663974ee3b)},
+  {FIELD_LITERAL(0x00dc8101ee07b31f,0x00fd6c457024d9b8,0x00daf67da161dd00,0x00024b53a5ce8db3,0x000a600f5cc8c685,0x005a42066dabf925,0x00d76a6a8a656e82,0x00c44862b23359d4)},
+  {FIELD_LITERAL(0x002c925c93efc2ac,0x00e92813f46a7d14,0x007f1872c6193359,0x00c964214ad37858,0x00bc62aadb94f0b9,0x0060d81c0a481077,0x0036d93d3dd901bb,0x00da5021f906d162)},
+  {FIELD_LITERAL(0x00eddcd81693e5c1,0x0068dc0ac92ff08d,0x003244582c310004,0x002561adc37cd26a,0x00ac58925db05237,0x00ae2f25953ebe39,0x00d83ecd5173e9ae,0x007e32e0013e0239)},
+  {FIELD_LITERAL(0x004ca2567a8e704e,0x000ded175c6096e2,0x00c3767d2841f999,0x0011cb79359f2144,0x00a0dc433f02e1e2,0x00bfc557069bf9c0,0x00eedb34628bd28e,0x00223e37ef990b8a)},
+  {FIELD_LITERAL(0x00e7a1305184dbc5,0x004b98f3aee69fe4,0x00e57040369ace84,0x000409e11dbd31a1,0x00ab4a85ea132fbf,0x0022639874b1612c,0x00d9280906b0905c,0x00457c196dc48629)},
+  {FIELD_LITERAL(0x00272e2d959f3134,0x00ba6f0070dfab3c,0x0059bbea4bb77fc9,0x0073aa444d57c7a3,0x005fde8b74dec711,0x00d44bcf50d1ecb7,0x00656739052eba7d,0x004cb3b2d5f37916)},
+  {FIELD_LITERAL(0x0000602ffde767b1,0x0005c3b23fa61857,0x008a3a8d8b9fd449,0x008c3635b2dac4d0,0x009b9a3a2587af99,0x0031f0f4fb85c2bf,0x004ca6c37e11d828,0x00cd223cfb115dd3)},
+  {FIELD_LITERAL(0x00065c3129280b88,0x008b0629d2d177a1,0x00436bb904552e5d,0x00192e372dfd6908,0x00fa9a8c11b24800,0x002cd3ceebe9ed6d,0x00c21f10df9f7b1a,0x00e003e08a99868a)},
+  {FIELD_LITERAL(0x006733f99a58398d,0x0027da47feaf95a5,0x00fc130cdd242c7b,0x003c4eeb3b75f8f8,0x004dd1041e1582af,0x00b9d1eabb5534bc,0x00e538b93cb01c20,0x0083e9f530e01f76)},
+  {FIELD_LITERAL(0x0025aa50fd29cb9f,0x00627c06db64ef36,0x00f0fd68d198bee9,0x003a2ffe1e031eaf,0x00ed0d44388ae643,0x00926906c32185d1,0x00a54669e460dea1,0x004750c8e568bffa)},
+  {FIELD_LITERAL(0x004d0b5353d6a8bd,0x00b958319d83fc4e,0x00d468c9a33e9691,0x00ca5b6934b1c2e7,0x007f10fd900260a3,0x0065445a2aeb6a5c,0x00fba43db04c5bfd,0x0054320a8ba10ddf)},
+  {FIELD_LITERAL(0x00434a4e93f30e3b,0x00c75ec420cf943d,0x00e4ce0ee56295f6,0x0075fae1cf9836f9,0x00625477aa919674,0x0075a370fefd7d1a,0x0023cfa8fbf85ecd,0x009036a34e1890f3)},
+  {FIELD_LITERAL(0x006e964c7bd3844c,0x002916956b6598df,0x0001fc18838b8f72,0x00652790e3c06803,0x0075b3fa7170233b,0x00ddc6c9f1d315da,0x00a271cadbfb033c,0x00d5bebdbbb1b3d6)},
+  {FIELD_LITERAL(0x00b10f755fb7e764,0x002a575f6bc50b7e,0x005441f55baba7fd,0x00a3e2023bd52fdb,0x00c7a6b6ed96ed56,0x00de982fe53e4ba1,0x0084ebff47cb4d7f,0x004d58af75213679)},
+  {FIELD_LITERAL(0x00d1a09e40381e51,0x00c99ab164346580,0x00bda6c2d6572810,0x005d989d2fc3fbb7,0x00c3c8545a59d150,0x009e865083376c80,0x00ce4716dc549aef,0x001d208ac464a028)},
+  {FIELD_LITERAL(0x00137abac71f2213,0x0045b5f9ad126c94,0x00fbe7bd140fb0e2,0x0001ce723ba0273c,0x00bff3edb688ddb0,0x00d1531eef6cf9de,0x00fb55785eb89551,0x006baa1858972d34)},
+  {FIELD_LITERAL(0x00a2397982d527d9,0x00de518893af474a,0x006f1a92aa44e645,0x0063f6c0be40c82e,0x0045a7c43de80ade,0x005f05bca0385d8a,0x001c244ca25bb9ba,0x0099f9e89273a6e3)},
+  {FIELD_LITERAL(0x004aa7b33776fc72,0x00968ca81796c3f5,0x00deebb4adbf901e,0x0098a1cf523b4c07,0x00bac1b20762ef7f,0x0049c91b7ddb7db5,0x001e159a3ecb1420,0x006e027f39ba90f7)},
+  {FIELD_LITERAL(0x0098c4aa2efa7d56,0x00dcdca832fd64c6,0x00d80561c501edf3,0x00a27a2e386244d4,0x00c24949b0c77ae9,0x0083d11b768e4a01,0x002976755d0f283c,0x002049ee1b8dbc08)},
+  {FIELD_LITERAL(0x000a105cb893e628,0x0044277552c8764c,0x00fd8e9d8b2e01bb,0x00dda4a293c4781c,0x00970a50dfee5752,0x008bd63726c236a1,0x002164900f8183d6,0x00dabbcf1248b78e)},
+  {FIELD_LITERAL(0x003a1d3255cbc85a,0x0006f8a77495d934,0x00c5c2eb4a44a17e,0x00ca0546b5c29be9,0x0026a471a54fc1c7,0x0078d289d5737df2,0x000bb2b825420a70,0x0001d622f592eb39)},
+  {FIELD_LITERAL(0x00bfadc80abfb972,0x002741895724aa77,0x00fbf404b9391b71,0x00723e6ba0f33ad1,0x001afb47d39ed3ac,0x007e25cbb6196860,0x00067ef0d1d1848a,0x00de5ca941f06c51)},
+  {FIELD_LITERAL(0x0056f71dedc3767b,0x004f4ddb150d813d,0x00f075be4bd84e05,0x00014a47d57c7f1e,0x00d45b2762892db9,0x004ab50567ed2ec2,0x00e485b841e95026,0x00c5e4175227c744)},
+  {FIELD_LITERAL(0x00cb61ea4c38a144,0x0064d2c00f883c21,0x00d44621fa346a06,0x000b8f88e4e33cfc,0x0014528ff21dc5ec,0x00c16ca6e242ddd1,0x00cf01236005d68b,0x00b7387fb1b7fa7e)},
+  {FIELD_LITERAL(0x0035bba8324e5829,0x0040893327baeb1c,0x00482f3252b06020,0x00326f888bd28946,0x0041677394677baa,0x00dcdf9b5d7973f3,0x006e6b28f1aa61f4,0x000da00e30a730b4)},
+  {FIELD_LITERAL(0x00cac3ee9d6c746d,0x00230090d491e86a,0x00c684789e1e0bfd,0x00403823e56b9301,0x00b0386b0047e9bf,0x002372990c38728c,0x0057ea54c0ab262f,0x005f839aae9e39e6)},
+  {FIELD_LITERAL(0x0052697fef992f22,0x00734a3daaeb5df4,0x00828330572bd00f,0x006a4ddd18f454c7,0x0048e0e9436afe3a,0x00ebc5464030ac71,0x00cdccc060e88fd7,0x00671f5e83232695)},
+  {FIELD_LITERAL(0x006a68191da2378a,0x00bc3f3ff5cab10d,0x00121fd670c42f55,0x0075f7cdef390eca,0x007c7f4b96f25f0d,0x0049b1bfb8deef7b,0x00197dbfecdefdb4,0x007b20068a831c94)},
+  {FIELD_LITERAL(0x00fb8a4b37a75140,0x00121d208c51f2cf,0x0080351b2d3300d8,0x0018c0c41953cecb,0x00e72ce51c0d57ef,0x002d4c2e589bb575,0x00566ced65d29eba,0x00d1967600eeeb64)},
+  {FIELD_LITERAL(0x00c50f5e72f06708,0x00e4fc0014cec52a,0x009ea5641ae877fd,0x00f927999e3404e1,0x0081d3931f74cf08,0x0091449dc5d710b9,0x00035b7fb3849172,0x004bb892f78117f4)},
+  {FIELD_LITERAL(0x006c548d1e768120,0x006c30131386fc11,0x00005f6d6739532d,0x00328cdf8182260c,0x00836917a95d6519,0x006a0eb3c39fa63b,0x00369a1763f73a8f,0x001d3c2585f234c9)},
+  {FIELD_LITERAL(0x00ccba6a31344e81,0x00532d06aaaa45c7,0x0051cb11d7859d1b,0x00f7e536d8bf9baf,0x0087df3bf767824e,0x00fde135ffdee166,0x005c989015cc7df0,0x005d2a175b10510d)},
+  {FIELD_LITERAL(0x0047b1547761f5a9,0x0052cbdee902762d,0x00fac39fc9d9f759,0x00f695fb446c2937,0x0051015baa8f85ac,0x006b01c6affb560b,0x00cb05dc5bc9df38,0x00b9130bf9f2c2fe)},
+  {FIELD_LITERAL(0x008f49e1358d81da,0x0010997659f92b14,0x00c4d4e8d1b31dd0,0x0068a6c2903aece1,0x00ec4a16c4d5c071,0x002716551ba2ce3a,0x0029fd7137558ec0,0x002fc31e2a07e229)},
+  {FIELD_LITERAL(0x00ee3d42db896c8f,0x00f500c199c175ea,0x00613f8a20a4161b,0x00217256be6ae109,0x00aea6ca8f395156,0x005094bfd2758619,0x00c5d4014c179042,0x008d9a2dc5fc0096)},
+  {FIELD_LITERAL(0x000270b6e809fe06,0x002e96d4b831b1cd,0x00f14a16cb818c8c,0x006d7e314bf4cdf9,0x00f38ff4b08aac14,0x00130021fe9e2fdb,0x00c39e528bad82db,0x00b8d5f8028d0a11)},
+  {FIELD_LITERAL(0x0050784e1c7d989b,0x00ba4b4ff0ee4ac5,0x006e17fa1033d53a,0x00c1418a63c9b174,0x00111f7ed6020a10,0x00477388d54eaa79,0x00936880405af8c1,0x00d5ff7b7c48d2d6)},
+  {FIELD_LITERAL(0x000c969f405bd71a,0x0005582b380eeef3,0x008be3a82d25ef04,0x00974aedfaa799bc,0x0099995405f7af5d,0x00ac92df02a8192f,0x00eed301a08e6ae6,0x00a745746d2361f4)},
+  {FIELD_LITERAL(0x00cfdb7572012224,0x008e4aaa86cb0456,0x004dfd13c401b802,0x00adbbb25f214860,0x003afa7b3328c2e2,0x00d12e3358061a41,0x00c1397d1c89a7db,0x00b66e9052778bd2)},
+  {FIELD_LITERAL(0x007f1a5a428cc8d4,0x0021922ac29fd43e,0x00ab771733923732,0x004b96c24e29336e,0x003659d342a66752,0x002978a63c030b17,0x00a0e7fa6c9334f2,0x00a0ec9b2c09cee5)},
+  {FIELD_LITERAL(0x0003c674a9f4307c,0x0051b2c4964edbad,0x0082dbbc0e425acd,0x009cf408cf01705e,0x00fe0120c5a22168,0x005c97ef5265c74c,0x006f60893608af18,0x00d658ea679c657b)},
+  {FIELD_LITERAL(0x0050f354a94cb8d9,0x00595394c70590c6,0x006d3ecd792a3f92,0x00873f50b319b1be,0x00a06a261da123b5,0x00039cc9812b6975,0x00c0fa4ad833d4c0,0x00f9ae080e6c5498)},
+  {FIELD_LITERAL(0x0044bc5966242e66,0x00ed06acc85ac4f9,0x005790469f7c250c,0x00eaf338a6a39a26,0x0044f760b6bed777,0x007b240f593999b5,0x003d42bd107c54bc,0x00f5ccda534b4424)},
+  {FIELD_LITERAL(0x00785e75cc4b74b0,0x00868cbd5e6e54f6,0x0035e42fe4257e89,0x00706037bb54a73e,0x00139af0864aa34b,0x00dc185d60c7f7db,0x003ad6863784da2d,0x0017f808b3776baa)},
+  {FIELD_LITERAL(0x008790d654a377d9,0x002c18b09bece677,0x003415b8b9a5a3e5,0x000fd49b6a3cd7d7,0x0051da05d5a42bee,0x006cda532cd6fc49,0x00133615d23ba59e,0x005e20cdcce01ac1)},
+  {FIELD_LITERAL(0x00030e2afa4cadcf,0x00b6d4c999cc1ddd,0x009ff24da22362fd,0x009134e412693972,0x00df51cbc3828a2a,0x00808034bceba3c0,0x001d42c323b30e5d,0x005d5f3629b765e1)},
+  {FIELD_LITERAL(0x00a464761d93a31a,0x0077589496803ce4,0x00f60442bde4062c,0x00318abea8a5323c,0x0042e6174003123b,0x00dc5ea6874738d6,0x004d7146853cc05c,0x0060a1f3a420240a)},
+  {FIELD_LITERAL(0x00d0ebac94468ec1,0x0092eab9f0fa358d,0x0099b122c9ae9292,0x00d43fcd1470c1c1,0x00c1a39e2d6b57cd,0x00dc6b7b796a7965,0x005f7a2a801ad1b3,0x0073c44ced076c0d)},
+  {FIELD_LITERAL(0x00f93014347e8033,0x0001cf897b1ef55f,0x00d2c27c76026294,0x00b145d6d1f05ac3,0x00ff5894aad2e222,0x005ac73c44a1da7f,0x00c6732702bba1c3,0x009df76d889b215e)},
+  {FIELD_LITERAL(0x00d33656e6a17d04,0x008b3f4b94b2470c,0x0058ec1e07ccc984,0x009b03806592da5f,0x00fc7b1cc891ebf5,0x003229708ebc2d6d,0x001bfe451d8f92ae,0x00c8e7c052195400)},
+  {FIELD_LITERAL(0x008a588f0982c1c0,0x002d942e0a2de73d,0x0013f73934715302,0x00d0a6b8f24e8695,0x00c7a9d325496485,0x009ecf403a93a4ae,0x00b4174444d0a538,0x00093430f69bf438)},
+  {FIELD_LITERAL(0x00a91295de891820,0x001cec1a9b30e0ab,0x00a6bf98e23c5d8f,0x0008ceb6b5c77352,0x004fc7c37596e814,0x00687ca1f68f7fe2,0x00e84493f9df344e,0x00452587d2ba061d)},
+  {FIELD_LITERAL(0x00b905a4f21b0faa,0x000cd254504bb07a,0x00e89474cd53e2f3,0x000512a224c45ebc,0x00fa994faa690755,0x00942307c36c73be,0x007e6b03e31b8e23,0x00ad8bedc021f438)},
+  {FIELD_LITERAL(0x002608d913cb68da,0x00aabea1da581c30,0x00409406ee1362b0,0x009459cc233a5e88,0x0057bef39495bb48,0x00272025adaa9a8b,0x009ba085730ce62e,0x000c7c07490b7d14)},
+  {FIELD_LITERAL(0x00fe6fd15a77f5e3,0x009f59951020b514,0x00316226ec36301e,0x00ae5ea396612e8e,0x006ff9e99e542581,0x00a19da990a16d12,0x0044d881d3da2c11,0x009e161830212440)},
+  {FIELD_LITERAL(0x00252f4ab38c110f,0x00a9dc428e4ac5c6,0x00aec8132908bff7,0x00ed577932dbfe1b,0x006588d153f74c24,0x00418e771a7eaf4b,0x004f166499231367,0x001e0e9575ab7087)},
+  {FIELD_LITERAL(0x00b1e995b917a627,0x00541aeb8ad1b561,0x001ca479bd99f672,0x00acbcb16f423826,0x008c23b3e9d7d2eb,0x00871bf7cdaf86be,0x00418f684699b32b,0x00cb0870c97dcd0d)},
+  {FIELD_LITERAL(0x004db29373552257,0x007971ca693bedb3,0x0025d5cc98594a2f,0x00dd614a416f3a7a,0x006ed05735e29111,0x00b85f1a42b9afc0,0x006121dcb0a2a3cb,0x00201528ce9ac329)},
+  {FIELD_LITERAL(0x0090c7b0b3aa0b9a,0x0035cd87617c28f3,0x004006b9fe1a8fdd,0x00a008ef3232ad04,0x00f5dbdcf79ed432,0x0046beba24150b03,0x00f504ec63938a97,0x00b5c68583234878)},
+  {FIELD_LITERAL(0x0093b5a87309e781,0x001bdd4990f1139f,0x0096a57b308502f0,0x00edae2b079aaa81,0x006264efede9de77,0x003991ff27f15d9a,0x00f866308f7380f4,0x004d07a1ebb4aae3)},
+  {FIELD_LITERAL(0x00d3b7eb6bc435c4,0x004d5509a184882c,0x0096d28188293653,0x00e1547d380ecfae,0x001f72ed8bcd8a1a,0x006772697e9d7fbf,0x004264751f04f6e5,0x00a4e7e3d12a4123)},
+  {FIELD_LITERAL(0x009a5819a3126215,0x003042bf8eb8808c,0x003b58630d419abb,0x0022a66435d59133,0x00ae884f6b66ee9f,0x00ac06c056da3851,0x00d8bb690b22653b,0x00b29f28165d5608)},
+  {FIELD_LITERAL(0x006f1f4c3b8a2d18,0x00a32289c624808b,0x009cbaad207c0887,0x0039e454afbe30c3,0x00553ec62acdd903,0x001d703a1f54deb5,0x0007d7c5736a32c8,0x00d4fb3562ca22cc)},
+  {FIELD_LITERAL(0x00a637f3e37469cd,0x00bdaee0f1e957fa,0x00b0883eaaf7c61f,0x0054a2e6035da52b,0x0029311ab410dd58,0x00d84b60ab417dcb,0x00f87a2bb02283c6,0x008f8ac2e6561903)},
+  {FIELD_LITERAL(0x00a58cd738c11d65,0x00b007706a7cec28,0x0093924c36021f11,0x0001ad92a51af3fa,0x00d2e076ff1dfcfe,0x00da66f3e6bcabf3,0x002b5e83812f9eca,0x000a01610a24a9b8)},
+  {FIELD_LITERAL(0x005aea108864f78c,0x0023e1b81552cde1,0x00fe20f5cc954520,0x000fbb88b4d3e43a,0x0018d781a6331e61,0x00ce567b87baaf31,0x00bc94171e4b58ae,0x000e1a0efca488ab)},
+  {FIELD_LITERAL(0x00b8f2651a8ff2b2,0x00d73bbe11f59e5f,0x003180c72ce86b76,0x005ab9179d9d75da,0x006b96ccae424d10,0x001fdb0d518518cd,0x00ccd94099c1e420,0x0038adf933ca77b8)},
+  {FIELD_LITERAL(0x001481bbcfcf2a1a,0x00e6fc3ef8005c3f,0x00a6341080ec80b4,0x00df636d86ea5b68,0x00c3101ec133a2c7,0x00697b280a127528,0x00929208587b4f1f,0x00130a84281db9ff)},
+  {FIELD_LITERAL(0x00519acd3ab90919,0x002a4a649e438f6b,0x00d4208bec00c949,0x000eea029f621ddc,0x0097b39643fb662a,0x006d290478d9cb74,0x0081848c449a2d53,0x00f05ee4d5b5dbb4)},
+  {FIELD_LITERAL(0x00c32b139e4445b2,0x00d00714807c1d2f,0x005048c0b2ffb625,0x00fdb7003dce2fb5,0x00d78c987657f21f,0x00f21fffdbff9c4b,0x0051848b69ce331c,0x009bfaea3f85a60f)},
+  {FIELD_LITERAL(0x00d53634c6a17872,0x0090a26e20d4b184,0x003c8032e7e085e8,0x009c30d038efa1d1,0x0005ac5fe0746070,0x00a4709bffad31c0,0x00ca003685e74d5f,0x005c9b5e779ae4c5)},
+  {FIELD_LITERAL(0x004681bf7eae5bf1,0x009ef805f2eeda16,0x005e8e0d9e2c9290,0x00fedc9759a40b8a,0x00cadf89b3c48d61,0x004e6bfc370cac8a,0x0044f31ca34f07bf,0x00c820677c7d3581)},
+  {FIELD_LITERAL(0x0063ffaa3e9d0b86,0x00230eca75393fb0,0x00bb6adc79bf7f7d,0x00be1c6734d65c29,0x005ddd85d71bb1b3,0x00f4e61acb77f94c,0x00dce874067c0769,0x00e264c049999db7)},
+  {FIELD_LITERAL(0x001308a81a49e7b7,0x00fb868e6629d2f7,0x00aae04e858a6c92,0x00ec8e974a7bded5,0x00e7ce94db0233b3,0x002c71c19fa49694,0x009eb0f3834442cf,0x00422f4a8cf9de09)},
+  {FIELD_LITERAL(0x0077374109c2faca,0x0013919c2ea61963,0x005259c3fe156196,0x00d8a3b205863eee,0x00e0e85f858b1aa3,0x007d417f934b08c6,0x003c9e946a5e292d,0x00fb1a62c267aa5f)},
+  {FIELD_LITERAL(0x0083e2f0eb40f9cf,0x00944aa6d349699c,0x00ddaffedabfae12,0x00d63f9afeb71232,0x00d091a2044e9dde,0x00f5fbda68b3a867,0x00f3c42511c96bd2,0x00b03001335d096d)},
+  {FIELD_LITERAL(0x00800360bf2ef470,0x00c765630817c80c,0x000ede4766866e58,0x000c4e11905d7ff8,0x00b859f1acd02033,0x00014d12d96d53cd,0x000a923b9ef931fe,0x00e49ec8c0d6d6ab)},
+  {FIELD_LITERAL(0x00d8a1150f441f35,0x00de37a8873c3217,0x008df9a91ef9726f,0x008712fda51e4605,0x002b079212f87b5e,0x0011e8860eec57ab,0x0064c5e90e80749b,0x00655984cbc7c905)},
+  {FIELD_LITERAL(0x00d4a1820df8c276,0x00148b51ae7e4161,0x000e7b8b24a7a78f,0x000e9234f2342e8d,0x0047df6420f08c54,0x00170554f5ba72c1,0x0082559e111c1ed2,0x00c9ff681e9d6e79)},
+  {FIELD_LITERAL(0x00c5a43a7695fd8e,0x008204b48d97a6af,0x00db2384de75f3a2,0x006fe411a2b05926,0x006c917ceb7f486a,0x00ee5de6dbd26cda,0x007e54504871efb3,0x002a5526fc9ba3d1)},
+  {FIELD_LITERAL(0x00c8729f3ed10985,0x004ab364c5526084,0x008628112e2e72af,0x00fbe2d15c8f5c0b,0x007e231f6ffaa459,0x00ae3aa988648335,0x00223595f5136f47,0x002e55c2e7691570)},
+  {FIELD_LITERAL(0x004fd46a70961f28,0x00c13b4694fea10b,0x00611247aa10d40e,0x00b0527fcaaf6e54,0x00c652de11d1eff3,0x0065134efd1d0a17,0x00dac494ef64234a,0x00e77aed3016321e)},
+  {FIELD_LITERAL(0x0006331ab049ecf8,0x00f78a0de86ee24b,0x00cf3815745d9727,0x007a3c44d7eff709,0x00c3f127df322609,0x004e442dcdffaa39,0x002bd1c3fc188ff3,0x00451f20282a0774)},
+  {FIELD_LITERAL(0x000be25d806cff98,0x00f00fef1c4a140c,0x00f53999805e98d8,0x005bf736b93781e0,0x00e752b12f84550a,0x008d642acf0e6d56,0x0059d12ebd94d051,0x0019c81577f68db6)},
+  {FIELD_LITERAL(0x0052ee61c27e76a8,0x00c71b0ac2dcea96,0x001deb7abeb97a02,0x0087033d51e6a3ec,0x00668e36eb02eab0,0x0031c3216edc6d5c,0x00921c52f8b5e36a,0x00d2c17151750e4e)},
+  {FIELD_LITERAL(0x0092b8d81369e1cd,0x005230a48efda2e3,0x006ced9e82538201,0x00c731ebf080338c,0x00598e1b5a6ccd2b,0x00b5c9a2f3a454ae,0x00a9664bc9af2cb9,0x0013b0c35190cfe7)},
+  {FIELD_LITERAL(0x0094f3df99937663,0x0051f7ac00a0738c,0x00c6761a70254165,0x0017051d42f401aa,0x0087f1fbff26a246,0x008ee61a0fe69bcd,0x0053ee213d8a6a3f,0x000a67b7ec758798)},
+  {FIELD_LITERAL(0x00f87a2e6073f035,0x0022498148a694b8,0x002a9f8a527c63c4,0x00cee94df574913f,0x00384514098b34d0,0x0059e8de43b57d21,0x00bf8e40201cd1db,0x002526ca875a4244)},
+  {FIELD_LITERAL(0x00a9f0241283fb5f,0x004065a7a9f64f15,0x00df5e59e3afab38,0x0017c1d9586920b5,0x004159da2d0859b1,0x00d214fadc48f390,0x00e2ba49dc81f5b0,0x00fc5734dd0526dc)},
+  {FIELD_LITERAL(0x00cceef6e668fd9e,0x0000f38ebb746dc9,0x00f25b09cc72732d,0x00f5034aae6a595c,0x0069b0ef33dfe653,0x00e964bd72800f7c,0x00a1028c71847250,0x001481379129b232)},
+  {FIELD_LITERAL(0x00231d96d8dbbf98,0x005a6f52710c7576,0x0094fdef8d84d376,0x001f216572de464f,0x00170410aa119e51,0x0045538f4ddbcc75,0x00102fcae9f06484,0x002dadb933a4e327)},
+  {FIELD_LITERAL(0x004a1eb056067be2,0x00c235da890f4300,0x000ab899ae6970cd,0x003de3f74c5cce37,0x00e2c07c7e99b01c,0x00406dd033a2e268,0x00133a556a3ec7ac,0x001107b1b21216f2)},
+  {FIELD_LITERAL(0x003fdbbe8d83752f,0x002ccf6e5267b0e5,0x00f3942eb11719d9,0x0014fed65c71242a,0x001e01a3954b5615,0x00acca4cf1da089b,0x00aa9b03819c2f6b,0x00b816c1b56c4b96)},
+  {FIELD_LITERAL(0x006204911471106a,0x00716a5e9150d9d8,0x00905e89c92ff722,0x005d105c60e92eda,0x00de9e3193fd9785,0x008d271fdaf09e85,0x000d450b26392210,0x00ab0e3626a14c25)},
+  {FIELD_LITERAL(0x0076a7b34e331e55,0x00c07debcc29be7d,0x00793fa4b592ff5c,0x00cf8b8ac85ded61,0x003778b28b115a79,0x00155ee7dabdae45,0x0082ed700b441e63,0x00bdb64a26ba4833)},
+  {FIELD_LITERAL(0x009e7999ecca0744,0x00aef7e4d4dad09e,0x00487309f810110c,0x005f69cae5a4d869,0x00c875e8b4f22747,0x00b14c650068ab1d,0x00c4892a6b3f182c,0x008f86092924aefa)},
+  {FIELD_LITERAL(0x000bd8eea25c6ce8,0x00d4f570cf4fa589,0x0046a150fd524416,0x0070260ce6586877,0x0022be668a00b57b,0x0032cd27fc044897,0x005c7b25bf678114,0x00ab11c7753ec424)},
+  {FIELD_LITERAL(0x00b9d740960b50b7,0x00a620bf63b6e0eb,0x00f90f9b25d1fc0e,0x00ded3e985870ad8,0x008bf786f049f124,0x00537d513fd97c7b,0x0068f2d24d210355,0x00084c2cfd06f323)},
+  {FIELD_LITERAL(0x009b41580212d56e,0x00b89c1f9db1ecaf,0x00b6b7b6a89e7c05,0x006c88ec6856ee21,0x00cfa3ce6c2d6661,0x002092f2134f2edf,0x00abf7fc74947fe1,0x009587cde3c15daf)},
+  {FIELD_LITERAL(0x00e2977e8a53318e,0x006711d95ba8fb6b,0x00da1a0afa762b5a,0x00a5c6d47ca53043,0x00de936d8cacf735,0x00dfe81f0bf11460,0x0042ce9cc63a02a4,0x008680ca32ac1733)},
+  {FIELD_LITERAL(0x004ae0abbe384c4a,0x00c56971b0527756,0x00653f647b3c9539,0x00027de6864f120c,0x008a40b221e26f9b,0x007eda86986f75cb,0x0065f384adab9ec0,0x00969b0dec57ef32)},
+  {FIELD_LITERAL(0x00d8e3a81d67617b,0x00170cbb3a2344ea,0x001a883c04654112,0x000bb4dc23f6cbdc,0x004b0329c31a0fc8,0x00bd7b96be0cac8a,0x00d5d5ce595daa66,0x00a0fafe59cb0c39)},
+  {FIELD_LITERAL(0x00fc07dcc3228850,0x00ba833add860105,0x0051ce13c426a1cd,0x00bab9dc418ad187,0x00d7505d625c035f,0x0040479cbbbf59ad,0x00a8cdad882cea59,0x005034ae363ed657)},
+  {FIELD_LITERAL(0x00f03ea2da6476cf,0x00adc6b68a0e9a04,0x00f9004b6ba62e60,0x0040f29554da5a9d,0x006eea9554f8e638,0x00322416b6961b8b,0x00abf6e21a650c6a,0x00d6d41f7ee31844)},
+  {FIELD_LITERAL(0x00530b469c3f77d2,0x00c55ab35ae4e67f,0x00d589b68a0cf806,0x002c94e41d2f9b38,0x00a661bed703ba75,0x00e71057951b03b6,0x002337427e62e1c2,0x0084be69957d7eb3)},
+  {FIELD_LITERAL(0x00233a55269627b0,0x0040eb58dc05898a,0x003e3f7e5d8d64d2,0x007b0d8af5d90435,0x008e62b412d204d4,0x00ed6928cf56cb46,0x004940658b646788,0x006631e0d74b7d82)},
+  {FIELD_LITERAL(0x00cd745fbda7bcc1,0x00a3bb9e2d92abe2,0x007443b1d6294760,0x001063d2525112dc,0x000b8c895f7828f9,0x00b354cb9f6bafed,0x004575869b7a3dc5,0x0099c6ad723739fc)},
+  {FIELD_LITERAL(0x0055efc5d2039964,0x00d1e28b847d98f9,0x003e45ea8133664d,0x00a0302a583709f9,0x001627e5d3181d4a,0x008902ed3d252a54,0x00046e103d94d7c8,0x006c9a7c90ff700b)},
+  {FIELD_LITERAL(0x0064f81fb9df86b3,0x0053b71dbcbbf8d2,0x00dc5fe5e17b349c,0x00680ffe976908d2,0x001f73c8b9e30682,0x0011d757975780c9,0x005dcf7eb00e8bd1,0x00bfbcc5f5ce2ad9)},
+  {FIELD_LITERAL(0x00f236076e32ec8b,0x0027ec3eb086a107,0x0097044f0733c496,0x000a010eb1d00ad9,0x00b1abeb61cfeb08,0x00006fa726ef7eb6,0x0069728ff7fb5a26,0x00aacb1749131ddd)},
+  {FIELD_LITERAL(0x004ce62e5c68bb66,0x001c31c00a44073b,0x005fb9fa157fbc38,0x003c642a8bb74fb4,0x00c72384c31ba282,0x0025a8f12cfe22c2,0x00ae192024f073c1,0x004dd66ea0471ae2)},
+  {FIELD_LITERAL(0x002e2bd319c7a961,0x0038de45fc78b4c6,0x000d86e7243eb32e,0x00b7c71ba8d0e458,0x006f663effe879c1,0x002b03c041b50412,0x00eab1e011d00879,0x005182724d3f960c)},
+  {FIELD_LITERAL(0x007dbe0c4ca16f64,0x002922894384cc77,0x006ce36a3c9791d0,0x00d0a4d4c4828fd9,0x00b07370918e6b9f,0x00df6d9492751f67,0x0074947c6be9789e,0x00cd0f1493c1dda9)},
+  {FIELD_LITERAL(0x009bec12e424fbd1,0x009e31db2b1629ad,0x00ecb606b9f8951e,0x00646cb91f9ed57b,0x005e00bc28037c54,0x00211cd76c39d676,0x0045173cd4dd8df4,0x00c7b5e24b922e89)},
+  {FIELD_LITERAL(0x004ebf8352e92087,0x00243ac04947effd,0x006393ccb72f926b,0x00fdf5af596b3f95,0x00155772c112ae31,0x0026dd8601c588b4,0x00978ad242d96be4,0x00d2d88a54c3e60f)},
+  {FIELD_LITERAL(0x00685fd43a086c39,0x008bf35762833941,0x00e0abbd7a7f57d8,0x0079e3d9ce8f3d83,0x00e45a2698b6850c,0x00e0eb29bdfce144,0x000b763325022c84,0x00d1ec8531021b86)},
+  {FIELD_LITERAL(0x00481226d20787fe,0x0095396175c686e4,0x006a9b6f98a64d05,0x00c1eecd41750d28,0x00c9708390faca59,0x0042de98cb033c0b,0x00dfae42eb98d5be,0x00e15fc45a1a5eb2)},
+  {FIELD_LITERAL(0x00c87911b21c7c75,0x00393c965ecfbbd0,0x0035eeaff848ebab,0x0094652371942401,0x0081e0425fc84c63,0x00dfb6b4c4e5b0c3,0x00121c33d5f81656,0x00be4ee8e4455fa3)},
+  {FIELD_LITERAL(0x00592e3854143ce1,0x0053f1528f4fe90b,0x00948b53f5603cb3,0x005f309e75dd6b6d,0x0035e482efe04b42,0x0057a0b5c447f62a,0x003749857550c2f3,0x005e4ea0c226750d)},
+  {FIELD_LITERAL(0x00a03757d70b771b,0x00e06428afb68a69,0x0042791844662a35,0x0084015c0cecf416,0x00163c5923fae4a3,0x00e5fabd5fc7c005,0x006f5b2bf1df297a,0x005525bc38f3f354)},
+  {FIELD_LITERAL(0x0025f071c5b822cc,0x0049708f466ac5ae,0x008a264af1e90f5a,0x00c16af346dad588,0x00638f33990efd0c,0x0061debf52b31e47,0x005c89fa3aaa7d15,0x0073552e30e2d7bb)},
+  {FIELD_LITERAL(0x005d4c54d886a2be,0x00b7f6aa530297f0,0x00c20dcdd1a6e0b1,0x008c644996f8637d,0x00cc8d03b50284ed,0x006946f877527ff9,0x00212a9e2e70c353,0x0019d0e735ad575a)},
+  {FIELD_LITERAL(0x004e9a2fa3e6246c,0x00e3a9563c3dba24,0x0037928d2c497663,0x0084713be1e8a609,0x00e26da1570ca347,0x000e9c72a1377942,0x00f5f7fa8175352f,0x00e4290ba746c606)},
+  {FIELD_LITERAL(0x00d66f4d0b3642e0,0x00d091bb3955f1b1,0x00f56c8ae90209ee,0x00733f88a21a9be3,0x002ddbb0fea6b367,0x0072b2318bf888b5,0x00a9d59fa1490da9,0x00015612cbdac5dd)},
+  {FIELD_LITERAL(0x00c51d4ae5dcccb2,0x008da54c85ebd852,0x00c79971e4b54836,0x00ff1fb72b7dc875,0x00aba233cca4c0e0,0x0082f5ebc099b0a7,0x0076c1af327e12f3,0x00bb0029326961f2)},
+  {FIELD_LITERAL(0x00dc0e29773cfd1f,0x00c82ae5ef016e43,0x00e9515e0749989e,0x00da9942f00d79c1,0x00b47b3b5d587ef9,0x004c35e513eacf83,0x00b5ff288b621eb5,0x00da8eb735fe9d1f)},
+  {FIELD_LITERAL(0x007c6bdf3417d56d,0x0080264be93b6272,0x0088669375a20b45,0x00519f8a26263981,0x00a289f5b9357a7b,0x00dcde3bfc08158c,0x0081534e890fef43,0x000f1bd844584a71)},
+  {FIELD_LITERAL(0x006ea495a7270447,0x001192d94560858a,0x00aee4b40f595b1e,0x00f40d5fba84f317,0x009ac108488fb510,0x00010bf342421b51,0x0034009ef5c34493,0x00f6c0c50ce51b83)},
+  {FIELD_LITERAL(0x00431319e55e806f,0x0059d69c45b5a27a,0x00ca2bc4173943ea,0x001511b5f9b6ba5a,0x00c25fbab17f6aa2,0x00b9d7ef9374d91e,0x0061c2256a4ae5c2,0x0092994a1d5b9a0a)},
+  {FIELD_LITERAL(0x005cb713220e9a66,0x00f7fe74241357a7,0x00139b6ad5e0c2f1,0x00fc5975f0412966,0x00fd2a383e5aba4b,0x0049ff71b33d8ce8,0x00851b0f95c4495c,0x00f6ab95a802a910)},
+  {FIELD_LITERAL(0x0031283f361eb399,0x007e86f9ab4d07d1,0x00a9640a0a3a511a,0x0050c495784be8e0,0x00f1c6cc165f74d1,0x00431e64971eee4e,0x00e7379208590996,0x00ba164fecaad91b)},
+  {FIELD_LITERAL(0x00f0fcd0e28a6bcd,0x00486b1829d16b46,0x007c2d2a7f81bf64,0x0078ba13c17a97f2,0x000fa5e046f72a29,0x0010fe58308012fd,0x00c74c79257636d9,0x0054fc13f0eef767)},
+  {FIELD_LITERAL(0x00399c263ba71d3b,0x0089714eb63a931e,0x005c6639d1e87e30,0x00ee57be7e8153a3,0x00076ec006a0f769,0x001aaf834737c355,0x0063fd010321d7a6,0x00f9ad59c0de1952)},
+  {FIELD_LITERAL(0x00012d82ed30c85b,0x004cac86351f92d4,0x00f0ce6f6df5eefd,0x0076e40d3d3b7bea,0x00090d1475f41320,0x00026f62f77be5b7,0x001338b7634cb6fb,0x005c9ba4ddf90738)},
+  {FIELD_LITERAL(0x00e05849b2890a6b,0x00f5970fc7ed0d8c,0x001044406c298eb4,0x00474bb0484be032,0x00c82b79d3f95740,0x00a0b809f493fef4,0x007baf1102518678,0x001d822068622113)},
+  {FIELD_LITERAL(0x0058370490d13064,0x00f753b4c9591f96,0x00c9dc60b58ed6c8,0x00c0575a9bcc5746,0x0076e75bf725ca8d,0x00a88ae49ced7811,0x0093e598b1edd225,0x00d6b5f48d2e43b5)},
+  {FIELD_LITERAL(0x0068a16e6ded43cc,0x000beb4044424124,0x00c317d5c0550fc8,0x00b3507b54dbffec,0x0082fbc878cb2e0d,0x00d7b58de4b8b99b,0x00b2c05d4a5067c9,0x0054d14df0d67f22)},
+  {FIELD_LITERAL(0x00c2855e4ca5eb48,0x002e6b994ee2e07f,0x0041de38cd0ed5c7,0x0033c08812efd602,0x002be3c8c541e99e,0x009b8bc932a08f11,0x00202e5aac648ba5,0x004192e6f38ed66f)},
+  {FIELD_LITERAL(0x006f44c5b972f662,0x001a1d53d8dd06a2,0x00d5d595696622e9,0x0068e75df7705cf1,0x0027d2b48c5896ed,0x00fe3c8d3f979a2a,0x00144601b3f1a975,0x00673277c5b6531d)},
+  {FIELD_LITERAL(0x00fe5e0f0d8ecb6e,0x005112507c3b20c2,0x00e4b0041ad82826,0x0085fab0b231ace0,0x000405369b5f6af6,0x00859101c6c7aae0,0x004020b680b1daac,0x00a1d72a07b64743)},
+  {FIELD_LITERAL(0x00aef6748009a8ad,0x00ce1be96ed6c86c,0x00acbbff62f1ff39,0x00aec5c65b6b929e,0x0090fd1f5e25864a,0x00f20b948a6739ae,0x0021d73e270f27a2,0x006d0566e74bc503)},
+  {FIELD_LITERAL(0x00be84f3c08cfe5e,0x0069e588e4b74cb9,0x006e4e4fa950d083,0x00a93e5492e6fc74,0x00b5e071b7d9a4fd,0x006f883689f8f4ea,0x0093b54627417afb,0x00cd7e26ff139756)},
+  {FIELD_LITERAL(0x00389933775e082f,0x006f11c04d47d432,0x00b4b55a32c9ccda,0x00f1386bc8617309,0x002a36667d9384a4,0x00ad8b00d5e08db7,0x00654d9aa8d02493,0x00a9d8570d1831b2)},
+  {FIELD_LITERAL(0x00d49f5508b8cd5e,0x00c027ba43ed7f79,0x00473ad542285652,0x00464d8c124783fb,0x00c53dd4b776c084,0x004a1de2381bac6b,0x00356dfb107d6a59,0x00f8f02524306684)},
+  {FIELD_LITERAL(0x00298d1c1b35e304,0x001b238cfa014ecc,0x00eca6738158bea4,0x000d6d3ae519df53,0x007f2c835a81bf14,0x00c25bfaccaf37ec,0x0003be07efff8a97,0x00c04fd7a1f0b170)},
+  {FIELD_LITERAL(0x00c3b23a87dafa90,0x0049c19aeda00903,0x00854583768f700d,0x007bc41324159e85,0x009b33fcd02ec149,0x006c0431311dbde5,0x005735da4a8905b1,0x00440c3b0c0ac4bd)},
+  {FIELD_LITERAL(0x00c9ac2570d5f5e2,0x004ffd22da4a2f11,0x00c0614b971a4d52,0x00da087c8954d699,0x00ccc4c777adf07e,0x0090a1f7d47ddd5c,0x003027818ec3cb04,0x00fd4e5a65cb295a)},
+  {FIELD_LITERAL(0x00a29247fbf52faa,0x0069a0e32a078cc5,0x0033be9159b6eff4,0x0094e0d1ad06c836,0x009ee5aff8fd4350,0x006a8c7b892aa9ab,0x0082c21f62760e36,0x0062576ef63e7009)},
+  {FIELD_LITERAL(0x00cfd1e25e6e8735,0x00b801665a68e443,0x00a03310d749708c,0x006fa23fb230d610,0x00ca8c5d4255668a,0x0012e2b63ddfcb0d,0x00e6aff7f311e86a,0x00eefd26fd727e67)},
+  {FIELD_LITERAL(0x00a796a4585bcf85,0x00b3ebda75dadbad,0x006dd8fd501dc4f2,0x00737994541b8fb9,0x0043b832d23451af,0x00b5ea4edeb4fb15,0x00baa8e40fe0b7da,0x003e2adae1cacc5f)},
+  {FIELD_LITERAL(0x000d356394fbb831,0x0007a42a61d50619,0x00c494602a6dc285,0x00e371f2b3f91f2b,0x00f811c2d81fcd0b,0x00465d3ad726c245,0x00360b027f299ff4,0x00adfcdcb2ac9616)},
+  {FIELD_LITERAL(0x001a671819233e0f,0x00eb534c9a324bfb,0x00278cc51c82a2b5,0x005ceed29f970d8e,0x00772f59a1d05a83,0x00ab5fe1fdca908e,0x008076a3ef1d8b20,0x0033fce654e21194)},
+  {FIELD_LITERAL(0x00298cf35fd76377,0x000a48e2747e1446,0x003ae2b25b3fba53,0x0034f1352005cd89,0x0073d277232343a4,0x0039a528d093c2af,0x00437c90ea9ae096,0x0007014eb104f6af)},
+  {FIELD_LITERAL(0x0023eb209666b357,0x008e73a796609d03,0x009ab51634c9fafa,0x004b282792447134,0x0095086706b0f513,0x0037be34971b2615,0x001b3bf9844791ce,0x0081b7ae24747c0d)},
+  {FIELD_LITERAL(0x00eb3d7712269847,0x001a31b9782e2952,0x009693a18903b61f,0x0052d4a148b92ce6,0x00ead959c903104f,0x00859c07d3080125,0x00cf50ef8b9c0876,0x00291749232c1abf)},
+  {FIELD_LITERAL(0x00355c93da9d7950,0x00e004b97be7b32a,0x003f13fb62751bf7,0x00322cd78a370b10,0x0051509516559152,0x00ae614672128d51,0x0088f6949d2af4d2,0x00499db98ee3ae71)},
+  {FIELD_LITERAL(0x007ce10353abf149,0x008d6d69c7d70775,0x007d64edd1077f95,0x00845e458ba6debf,0x0042a230e375e1e6,0x00f087ecd8dcbe2b,0x00d2977a7a75f9ff,0x0043559ee8379a99)},
+  {FIELD_LITERAL(0x00b0e54c48ad9391,0x0013bd096fc38c9b,0x0067e253fe4b54df,0x00e6b1b2f2bef404,0x000b484a888bb37a,0x0030bfb41139132d,0x0025d2712a3e7572,0x0039763454840488)},
+  {FIELD_LITERAL(0x00f08e5857e41171,0x0034f6cddf66518a,0x009fd53e06fde5b3,0x00934563468aac06,0x0045b852992adb97,0x0028d893422caeb7,0x00be3bfddbe4979f,0x004aa20c0f0b2b21)},
+  {FIELD_LITERAL(0x00307915f93c3419,0x00b382c66de8d19e,0x00f1b1c8f48537e6,0x0000ff95fc8caf27,0x002aa66027a4ff14,0x0048aca8a4460402,0x0015951620a3512e,0x00c4e7635bb1c0a9)},
+  {FIELD_LITERAL(0x0015b6bfbe24b1ef,0x006f60fa43a6d543,0x00209434a1afbd34,0x006d44a23574564a,0x00a16274a34cca80,0x0091d908b444e892,0x0029b7272700978a,0x00b0f19d80c73ee8)},
+  {FIELD_LITERAL(0x002dc638fa49083b,0x00f6236acd4f28da,0x0057613524ee4789,0x00c856802bf344ca,0x002bc83a41c6dd4c,0x00522b3ca53a9ea2,0x001c13782b267fb8,0x003439dfd2500f0b)},
+  {FIELD_LITERAL(0x00ab3eac34d1272b,0x00b725bd8448074c,0x006f253bea29af3e,0x00bf289bde00207f,0x009dc1beb97eb6ca,0x0007ad7350f7081d,0x00c61dc71df5c4e6,0x007872301c4991cb)},
+  {FIELD_LITERAL(0x004b78c19d21d999,0x00e4c276c38a9082,0x00f32a76ffd012a3,0x00db2687d0bde1b1,0x0067faced644806d,0x0005a95dda1f74da,0x00181d3d7b94c544,0x006ea6dd90f9e4c7)},
+  {FIELD_LITERAL(0x00cec8b8ece0979f,0x006334b3f344f827,0x00b62d2f973ec599,0x00a7348b69fdebd7,0x0090a1c27689806d,0x0001abb59a793319,0x0037acb0a68ed46e,0x00b5824959c4995d)},
+  {FIELD_LITERAL(0x00c14eea53d40691,0x000cc1125008e576,0x00f62ab668abcba0,0x009b8f3ff3a754e8,0x00d398c72bc7b5b8,0x0085e045f077c841,0x00dd3a730e668aed,0x00f6ec3b1a10f6bb)},
+  {FIELD_LITERAL(0x00da642844c5d9d4,0x00a62073cc59f4ba,0x0082bca07221d333,0x0095175680cc4ca1,0x00c7673d6e62c672,0x005591c209847ad8,0x00d7b5f5ac4a6479,0x00389af742f1cf77)},
+  {FIELD_LITERAL(0x00725770bbeac6f8,0x00f42a002c27ad26,0x00a8aa5f0794c1e0,0x00ed3cb52d01046a,0x00ab1ff3800ac326,0x00c26501bf23731e,0x002cd18a469ea85a,0x00afa223b3772b71)},
+  {FIELD_LITERAL(0x0036f6493e9790c7,0x00ce2e8b9883117b,0x00019637e71c4755,0x00c37b4fd409aab8,0x00c4906bf406e664,0x00237c47dfa9c0a2,0x00007b56115ce228,0x00fef9db2608477c)},
+  {FIELD_LITERAL(0x00d74caa957d2131,0x008808a587f13b04,0x00c1aa2c7b4bfc80,0x00c51046234dc94c,0x0064f9ad44352197,0x005835a3b3c1851c,0x00c43c0ad50a0f45,0x0096523cf21b34b0)},
+  {FIELD_LITERAL(0x0051d71fb735d169,0x00f893b53f2c082a,0x00dd8e976a53cd7b,0x0029654a44c617f6,0x00a8e29cab292163,0x0020e65b534a571b,0x007be4e0ea68b1e4,0x00ef84db8598f240)},
+  {FIELD_LITERAL(0x001a0b0ca2126de8,0x00bf4fd14d8385a1,0x007ecde7fe2835c4,0x00bd81a0fc3346a5,0x0079e02a534c1384,0x000bebe09f5590f5,0x002f5a3393e2bb71,0x0087469764076579)},
+  {FIELD_LITERAL(0x00c67197d3d017a4,0x004c76597368153e,0x00be88d6f2dc08ea,0x009ed6fb6ac8ee99,0x0092bb05b03e4101,0x001291153dc40cd5,0x00792c800187b9c6,0x00c100a1e369ed10)},
+  {FIELD_LITERAL(0x0074904a8aeaaeca,0x00502971c3681d7d,0x00f7362be28ae35c,0x0050e1ac78888cf5,0x0064ae20859b2935,0x006299973e2caffd,0x001e681ed7b54a75,0x005a3dadac80c4a2)},
+  {FIELD_LITERAL(0x008ffe6a1cb34963,0x0069f6dcf39a0412,0x0006a3a170dd50d8,0x009bfb50889beb0d,0x005d40f92162545d,0x00425487aee9ee1c,0x007eca8f0fa4c581,0x002bf853b4d2ba2a)},
+  {FIELD_LITERAL(0x003c5c1f5902f73e,0x00ebb4f1ad8ab860,0x000315a9fec14476,0x00d4cdd35a061b3c,0x0004e8fce7495074,0x002d92c2ad9a7fc5,0x00a2fae695e1ea05,0x0009dcb25122169e)},
+  {FIELD_LITERAL(0x0099bc97a3113980,0x000cdc6461fd070c,0x003afec52703adfe,0x00abefbecf059179,0x004217078419cb29,0x0063289de1a8e3b9,0x00e6cf37e73ff97e,0x00d3b4171a2d2c54)},
+  {FIELD_LITERAL(0x00cf976019346c78,0x003fbcf64af48d4a,0x00b265c50146a5d7,0x0005361b39ccbda0,0x0073507538fe65a0,0x000cca1c44a8d882,0x003fedfaeee5450c,0x00a44e6cf0e363e5)},
+  {FIELD_LITERAL(0x002b5e71c281b906,0x00a6bb0497b0d50b,0x006892da71b60599,0x00273726591c2c2e,0x0005a874ca076d4a,0x00c8804083cdf17a,0x0041feebd099fe55,0x0080d12e608192a7)},
+  {FIELD_LITERAL(0x00dd64136b6973b6,0x0084ef7da1532002,0x0002817ec96ae0cf,0x003230285a80a7d1,0x00fc62ef97ff995c,0x002e9b674d13bafe,0x00b131c7c9b99813,0x00d4ffc855a56cb1)},
+  {FIELD_LITERAL(0x001b380212c875bd,0x004f3949d441540c,0x000eb57bf6e6c85c,0x00a981b2b4c26c7d,0x00f24b3c4bacd064,0x008975e85aa36029,0x002797e796cbe969,0x00db0506bad96fb6)},
+  {FIELD_LITERAL(0x0043e1c26b952e2d,0x00d1fe923b834b82,0x00b98eb797329e82,0x00d87ed35a9c0240,0x009aa20d02cdc337,0x00e1884c6997e27f,0x000698fc5e0f1ff7,0x00227432cccbb572)},
+  {FIELD_LITERAL(0x004e37b1e6fb6d9e,0x00e513a9c761184e,0x00f2aef59ae60a12,0x0052f802339ba35a,0x0034238f385d3fc4,0x00e27371593e83df,0x00abe5c56aed0c5f,0x00ca88f3688247ac)},
+  {FIELD_LITERAL(0x0090c6b5b64461bf,0x00f3550c93e1c20d,0x005e99a88e96608b,0x00c1afeb2e432a9a,0x000ba62888ae4b45,0x000514ee61f255cd,0x00a70f8dcbcd65ee,0x00c144014b7b31cd)},
+  {FIELD_LITERAL(0x00cf1186dd054234,0x0077eccc72ce759d,0x004f643e50d4334f,0x002e03882997a22e,0x00e460d624fd42bd,0x00bcd0cbf292456a,0x00d7ddbf0e51a330,0x00250fb38a97e14f)},
+  {FIELD_LITERAL(0x00b62f63a6016d11,0x00b6f29c282493d1,0x00696e3378736737,0x006a239a08d767e4,0x00808b6ac6c1874f,0x00f01795ecf8b618,0x00cbec9bf403d018,0x0036a4fa005a3b3a)},
+  {FIELD_LITERAL(0x00feb23c0fb6cbff,0x00ef6f4c1dd20094,0x003731341d91b571,0x00fc4155a7ff237e,0x00c62c614440b042,0x008fff0025ef9d41,0x00e027da8fe45fe0,0x007e20cdeb98021d)},
+  {FIELD_LITERAL(0x00bb9cedb989ca84,0x005e7ce5c6ac1a19,0x009e0f18cf7d583e,0x00d40311c18f2be2,0x007b944c721bc566,0x00e6688665d52e1f,0x00e13d3940d9b698,0x008259e60bed41f9)},
+  {FIELD_LITERAL(0x00de41ccd4b53579,0x002da487228efb50,0x004d7f7c63e5a5de,0x00731f0cff228f19,0x00f47b438463e016,0x00e16d8720a61ce6,0x00bd426176c5aa0c,0x002f8dca29e6eb3d)},
+  {FIELD_LITERAL(0x001d0f6feb84eb2a,0x005afd1d0f53775c,0x00724d4a20f51c78,0x0060e160e85d0853,0x006fb0ee3326c7b9,0x0087040c4024a6ab,0x0077cebe91d76e4e,0x00095f5a1896f941)},
+  {FIELD_LITERAL(0x00025c6286c4b4b3,0x00cf2eb3a3e35e5f,0x000c126c8ae90f7d,0x00e6991ee8d8782f,0x000e0ea0816618c0,0x000a18ef9b4c0585,0x00cc2142f2e468b8,0x00c91b44cf9ffbac)},
+  {FIELD_LITERAL(0x00aa4a6059aa5c01,0x00e61c9bbedb30b0,0x0093194922b0efd4,0x00b8a01d5131edcc,0x00dd7d039b5c5d4f,0x007cbbd09984a90c,0x001ce590a7604644,0x00094ee1d7d5f070)},
+  {FIELD_LITERAL(0x00c6054ab1c13169,0x001ce485bcb17cf4,0x00765898d49dcabf,0x00d991d31c81f57c,0x005dbd0bcda91754,0x006942c3787af934,0x00651d3c28c2810d,0x004f808f238f2985)},
+  {FIELD_LITERAL(0x0092a4e424218e67,0x00822cb2e5b84d4a,0x0027b77b96f33cbd,0x00078919870fb500,0x0041a3a5719cfe85,0x00e11a44f1cb440e,0x009e7e2657ef5b64,0x000140334549cb20)},
+  {FIELD_LITERAL(0x00e8237fc86a89c5,0x00933d2a90f1675d,0x00f7a0e821a8d8a9,0x0091855ddf673a07,0x00b2ab3890e99007,0x00c13ce7fd27a544,0x001afa98c5938a0e,0x00c8ce8e396f5699)},
+  {FIELD_LITERAL(0x00b2258396df0961,0x00b72da0efdc3feb,0x00c8a37c90d63ea2,0x0009d7cb5dc0533e,0x00b409dbeeb351a1,0x001e917a18bf424b,0x005dec5ce467a4e9,0x00c28fa1ca9a9835)},
+  {FIELD_LITERAL(0x009f2c0664c7911c,0x009a97228e862aa8,0x0045fb136f2a1d15,0x003ce203ecab1e80,0x008c1b998cba399a,0x00dc9c8b4941a38b,0x004a53378a150605,0x00bf64924c76edc9)},
+  {FIELD_LITERAL(0x00dc4576a5ff7c3c,0x0009cd5aa91e3dfa,0x0069c63ebb870ff9,0x00691799f968f63f,0x005e63f5ae0e72ca,0x00316b1dc7daa27c,0x009282832ff761fe,0x00c21237f5c45e4b)},
+  {FIELD_LITERAL(0x00ff7fa7509aa4f1,0x00d11b1e6122826c,0x00c319ed45493262,0x006c1483d5bb4d25,0x002e6691076e446d,0x0091c31b30a0d532,0x00905aaed3549e6d,0x0076fbb35210c5a3)},
+  {FIELD_LITERAL(0x001431da430b4969,0x00122c3308583238,0x00f99ba3881d027d,0x00a107e79fb86c9b,0x00af1ae4755fd4f6,0x00b7aaa44eff1683,0x001dafbf9208f63a,0x003ee912dd4bfdae)},
+  {FIELD_LITERAL(0x003af6ba67f54251,0x006b2f6d90720a59,0x0033cf0fc6a8bdd3,0x005112953fe67408,0x00307627906e4b3a,0x00a8b5202935bec6,0x00b9c7e4f41750b4,0x00b5601db95f72ab)},
+  {FIELD_LITERAL(0x00c4d2419c50bdde,0x00d469e56942fb97,0x00d3b1788f3c9a6a,0x00d27a6f7a1d0b6d,0x002b9b9c04282448,0x0018930262be95d0,0x004aa80111a7a21d,0x003deb1671cad08c)},
+  {FIELD_LITERAL(0x00a35e8b3c01114f,0x00b5fb22a32549fd,0x0001cc1ffe0fe2ec,0x008f69e1365d5268,0x00fc8251acab9fb4,0x001e4cdcde65b220,0x00c2f2e74b8739ce,0x00761df5ccbf5dbb)},
+  {FIELD_LITERAL(0x005d29ecc779a6ff,0x00a1ca9c2310507f,0x00b09cf29d574d7a,0x00d5d7ccd1a039a1,0x005d17f9603f6c09,0x00795c37ca7b39e8,0x005bd6f421e126bb,0x0022716dc8d1c8e1)},
+  {FIELD_LITERAL(0x00f8bdb118ff53e2,0x0098e99d21194acb,0x0059e150ea098b16,0x00cd1d10d21c3e94,0x00b9abf04615a740,0x00abf230177084cb,0x001b9f1efff15543,0x0010f2ea515ee4d0)},
+  {FIELD_LITERAL(0x000d29e9f4c0a546,0x00de9e9276afd53e,0x001b9fa5564f02e8,0x008bae13194a2b09,0x0077ebc91e7e23cc,0x005842e8affab2d5,0x00c34129182b2c6d,0x008f15c84ca14c73)},
+  {FIELD_LITERAL(0x00d7ee4754f5a008,0x00bafb49425819c9,0x00b33ec071986fc5,0x00a369a97388dd1b,0x00fffc040e0657e7,0x000d283ced2bb41f,0x00cfc9800bcd97ab,0x002f1abe5178c9b5)},
+  {FIELD_LITERAL(0x00ae4569975a1ed8,0x00c2e043ce5b85e7,0x00a388d9eaae3086,0x0009b50c3795e366,0x0039eecc2722b9fa,0x00f6c1ef97b5c3cf,0x0017dc6e678e9fe8,0x00ef1cff8ce63123)},
+  {FIELD_LITERAL(0x00352c490bc3fe6a,0x008894be3a85f5b7,0x001d181ca2ed0798,0x0029ab4b53d43d60,0x0055bd14229e03b9,0x003b3292cee15a59,0x008158d2ccdb3b24,0x00ba21b6831a4b7a)},
+  {FIELD_LITERAL(0x002c56b2b37c11e9,0x006a126da99207b7,0x00f8dc1477ff81ff,0x001155e72c63ca97,0x00e326893568ba01,0x00aaf62bd5d19f99,0x0069930e09f14c23,0x006a0b43c8634faf)},
+  {FIELD_LITERAL(0x005552e609100d18,0x00a9ed74f67dcec3,0x008484f909c1152a,0x0013b53ccd350279,0x000293756726aef9,0x00642631b8a32dd1,0x0065bacf9d14b5bf,0x0073fb8b56613c03)},
+  {FIELD_LITERAL(0x00c9d43b98ac3111,0x00b4cafc88632987,0x00296123892c208c,0x0005f0401e06d1bb,0x00d6459e3aad67e1,0x0062d137f9beda95,0x0046999b8887d785,0x00eddd9c4b8dddf7)},
+  {FIELD_LITERAL(0x00acb6171411c820,0x000f002b24072f89,0x00cb19406b57d142,0x005f32744dbfa428,0x00909f28fa363d41,0x00185aa9c787ae4f,0x000efcdf9e8f046c,0x00d24a156a804598)},
+  {FIELD_LITERAL(0x0010a9bb2249e917,0x00185f4a5ed81389,0x000ccc80df00a948,0x00eb1a647d0fa702,0x0087497112715f16,0x00cda9f8450de8be,0x00d3372b32db4597,0x0015029e2437f3ce)},
+  {FIELD_LITERAL(0x000c347f841ee68d,0x00d09885f545e361,0x00664e36eb394c5b,0x0090ab2167966d1d,0x002455209186389f,0x000f9fd235829994,0x00c78509df6598b3,0x008f87a9bd56f983)},
+  {FIELD_LITERAL(0x00e26664cf9e5615,0x00db8235d9ff565d,0x00fe3081513bab10,0x0009b05b7737dfd1,0x006724bd217e196c,0x0080930defff48d2,0x000db13ed738b4bc,0x009e637588706524)},
+  {FIELD_LITERAL(0x0013a493db74c015,0x00551d04b4b0e28c,0x00fa015d357a4981,0x00be53a5334446fb,0x006abef22efabe0d,0x005ea2b80e13d2f5,0x0093cbc404963712,0x00b56bab802544da)},
+  {FIELD_LITERAL(0x00105bb96cb32171,0x000edbc7ae9b9803,0x002258e52fdf677b,0x0067be7255dc5a6d,0x00a37df1c367d7eb,0x0052b92fbe89d29e,0x007934f6d4532181,0x005ebadc4630dff8)},
+  {FIELD_LITERAL(0x0008c524acd44bfb,0x00d8503eda140ce5,0x00fa00875a05f511,0x0096f8a25c2c97b8,0x00166e49ca86d42d,0x00c057c8ecbf725f,0x00de2deb96fe57a9,0x008db81ac14cbde2)},
+  {FIELD_LITERAL(0x0028b26becdb3baa,0x0030baa927dc7f67,0x003b405c37f1c1a0,0x00512830bb964d07,0x00a0268fcb460141,0x00a8f6d1586eac2a,0x0092f2ba7b474579,0x00153a5f80ab7096)},
+  {FIELD_LITERAL(0x0006448962065ba7,0x00f871cb8bca6ad6,0x005e8e6a008af151,0x00de53a2b2b23e85,0x00578b6484951bed,0x006a1b83d6e9cc88,0x00b2810c02ad5443,0x008219ad50b3101d)},
+  {FIELD_LITERAL(0x00e828ef532d1b2f,0x0001e478bf8bc8e0,0x00845667f37fc95d,0x00c1baa8a8b2f378,0x00b1bf7865639b84,0x00dd6745068e0458,0x00df5f4610c3fa5d,0x00003be97a80ac8f)},
+  {FIELD_LITERAL(0x002ce7f01bd304e6,0x007f4b5e71f09bcd,0x00eb7bae2edbd32c,0x00891aff76abc18e,0x0075317ec641e507,0x00195217e7c19c30,0x008af35c5dcf7cdf,0x00e324d628ff4614)},
+  {FIELD_LITERAL(0x0022445875129e03,0x00e5dc57f6eb77bb,0x007c0e1a9869ef76,0x00eb4866315357f8,0x00200738b923ecdf,0x003cd3a9afd755bc,0x003534c6e8435e72,0x004fce7c4a08e2bb)},
+  {FIELD_LITERAL(0x0063dedfc5c15394,0x00f572fb8bbcd6c2,0x005421c24607ffa1,0x00e5f656854153d9,0x00b1b8e3e31b947b,0x002c07f659092ced,0x0023dd3580d6875d,0x0084da4550f0a528)},
+  {FIELD_LITERAL(0x00ccb4d72a842a2a,0x00a1fa06f5b666da,0x009a59d110e1d916,0x0073791aac685521,0x00a0238768f52647,0x0073a21bb2272015,0x00ce2e5898e3a0e6,0x0008c19c54bc21bc)},
+  {FIELD_LITERAL(0x0088ae5acdee664b,0x006b5c538d96cd4b,0x00c67cb7341813fc,0x00bdbc1dc74dbaf9,0x00725a824ec99311,0x00f508a6550cd088,0x00f44f0e109cb6e6,0x0040ddf0215424c0)},
+  {FIELD_LITERAL(0x0058eb785b36cd6a,0x00a54c6d72a31b69,0x00208ea28e3a1775,0x00faea01dadd2adf,0x00201771dbb12fbf,0x00e6e012b5fa5d01,0x0060f22ecfe571a4,0x005d88ce90f4ce28)},
+  {FIELD_LITERAL(0x00206577995270a6,0x00f219d7bbe3d215,0x00be7b4f6875ab85,0x008930120631f8af,0x00b6b21220284e06,0x00659a47ec77472e,0x003fb5bc8d56d2ad,0x002438d0b9e6424f)},
+  {FIELD_LITERAL(0x001d56dadc6cd31b,0x00239848cab82273,0x0094a729073f0428,0x00cf169d76537e96,0x00898bfaa9c20250,0x00617a78eda14903,0x0065f5a49074041f,0x00f06003a3d11265)},
+  {FIELD_LITERAL(0x00efd157a1a1c9ab,0x00b1ecc3e9a874d0,0x00197ec5edd445c9,0x00a713edd61f1b3e,0x00ebc43f42f3544e,0x005633ca56699767,0x003e583635fae9ea,0x00457a0d807a8a11)},
+  {FIELD_LITERAL(0x00ad68279dbb2b0c,0x00e88eb9720112c1,0x0011ac0956aea648,0x0047320e8747f1cc,0x00fb709865ac5869,0x00fab87c559812f0,0x00c2dcf8596de907,0x007501d692f6ab8f)},
+  {FIELD_LITERAL(0x00620c9c707c8ad4,0x00ecc19fd034003e,0x002378ed84c85393,0x001ccccf93350d65,0x008b5221389db841,0x00491b2ac4f100f3,0x00891459f18af003,0x0075427ae1d945a5)},
+  {FIELD_LITERAL(0x00a3f186ba99b26f,0x0070a37c1dd8f7db,0x004ad6903aa2c01a,0x00982709b160eab5,0x007c8bc211a31499,0x00bfc48f01785497,0x00c4725c54235e7a,0x00999d79f7889411)},
+  {FIELD_LITERAL(0x00ef8b5b7a040ef1,0x008ba6e21ad77aa3,0x005d7bb0b4bbfd48,0x000fdddf939ec4ba,0x004ed45b36c22fea,0x000cf9af64f4dd5f,0x00ed7e3eb2961edf,0x0027687900c143c0)},
+  {FIELD_LITERAL(0x0093509a48919470,0x0072c16781812599,0x00c39f1eac129db0,0x00e2d796a9bbc544,0x008d1818edd4dcb7,0x00f644adf32b346c,0x007aeb260abae553,0x003e4c571cf8078d)},
+  {FIELD_LITERAL(0x002e1cf3a0010454,0x00cf7fb5fb518807,0x00601cb11c5ae254,0x0009d284f4587088,0x003e056f9bd83bb0,0x00e7c149b334bba3,0x008b32d71af43006,0x0072f25795788cf9)},
+  {FIELD_LITERAL(0x00477944fe685868,0x00c5d8cb8f2e5e2c,0x00fb08974cea8e9d,0x00954688085e7a1a,0x00be2f06ef9c04d4,0x00007961547726c2,0x003c47a057c0f450,0x0079f892d8025cf1)},
+  {FIELD_LITERAL(0x006271278227c569,0x00497a978f261eaf,0x00703f36c61e2837,0x0071d41f6c9a3187,0x0004fa5b1fa8b312,0x00e72bd960d2d56a,0x00b39b2fcdc152cb,0x00cb654887c53f19)},
+  {FIELD_LITERAL(0x001b5070e1d64169,0x00d86c3d2553c5a4,0x0076a653d4e2f140,0x00a46727b8f9cb9e,0x000cce361277d84b,0x00e03170714a3300,0x00d9da3391508efe,0x00f651b24764435a)},
+  {FIELD_LITERAL(0x003b165872c78f2a,0x004da321cc03b66d,0x00e7198fd1ccbf5e,0x005ab83733952398,0x00310727a2a05c0d,0x00c0c43d6a0ae55f,0x0025eb5477209082,0x00e4557f18d56b78)},
+  {FIELD_LITERAL(0x000bc177903202ef,0x003bc8e7a32bed09,0x007ba8d3fd8eb0d5,0x00ecb65aee5fc2a9,0x00109d0e67a0a2ed,0x00b8f1cd7c405f03,0x00d2ad2e286a8228,0x003148e8a4e81dc7)},
+  {FIELD_LITERAL(0x008c641cb2925361,0x009363a753244a6e,0x009f520ed7b0ce30,0x008c83530c839520,0x00a2269857bdea1f,0x003917b8a50b47d6,0x000c3d165c39e365,0x00483b82be3a6e2f)},
+  {FIELD_LITERAL(0x00fea0ef4bce8725,0x00cdd8e8ab85025e,0x00b4a7c24136fc27,0x00c0e251429dc7fc,0x00b6049abc5b3151,0x00ff242b48484b39,0x00c790ebe13af81e,0x00ed68641dd874d3)},
+  {FIELD_LITERAL(0x00b3320ddd12aef8,0x0079da79dc0b6b25,0x00f4687697aa47fb,0x00e8139586537949,0x0088649676846f64,0x0068027fa276f699,0x0099a790af1b44a0,0x00365138f37cfaf5)},
+  {FIELD_LITERAL(0x00b958c958e2fe13,0x00e97c6eedc4ceee,0x0026b43a15d6221f,0x0015be454e274c7d,0x00d799e53823cc27,0x00770ab5136fd5f5,0x00f98d8513c015af,0x00ed338973f2cace)},
+  {FIELD_LITERAL(0x00b261c90a759682,0x001b70ead38576a6,0x008122f89b8b4761,0x00b66d9ae9078c58,0x0042f8c3b47c087b,0x00df6dec25ac7bdb,0x006f78cae5e78a1e,0x003998b5ad5a4949)},
+  {FIELD_LITERAL(0x003737cd2ff8b7f6,0x003ec6db01e8a6cf,0x0081ae537d75232f,0x005a68477398a59c,0x003bc52a8c75ec18,0x009df4880172520e,0x001aaee8249c026c,0x000d8228240f0362)},
+  {FIELD_LITERAL(0x0028b8c73004e0c7,0x005528ad9250de06,0x00b9f3c83ed0e15f,0x004e6174c4459fde,0x001949f8de0a5837,0x00a75fbce24e9b17,0x005bd1f256475e8a,0x00a29644d7984c33)},
+  {FIELD_LITERAL(0x009beb11670211d8,0x00649fe4f3e741b9,0x009bb3150f44a817,0x0096fe047ad76b7c,0x00bd27c20e6b38e7,0x00665462ab01d511,0x0092728f835bc0bb,0x00921bdd1502cb1a)},
+  {FIELD_LITERAL(0x002b923b9289904d,0x00d5c9e5c5d5475a,0x00f7405740640df9,0x0089b38ad08c19d0,0x00629163206f0f00,0x00fd747bb27320d8,0x0070046a0d93eeb7,0x00ae5cab6131b983)},
+  {FIELD_LITERAL(0x00be7a30dcb3f118,0x0000118906989f78,0x00fc115336136c9d,0x001a4d8c423220d6,0x00e155c9e39a6e5a,0x007022f30342d6ec,0x00fb7c1ed4e7304f,0x006ed2932adbbc3a)},
+  {FIELD_LITERAL(0x00a9fce05b46a902,0x00b3f833333e31c2,0x00e4381533c45010,0x00635d60c870bfd7,0x00a721c520b498ff,0x00a47b53ba5ebd1c,0x0006fbf64e895201,0x0083daab5192fb32)},
+  {FIELD_LITERAL(0x0046cc04387f7ae5,0x00ab693b1f1c8b6b,0x00b1e1fcabd59dfa,0x00dbee9c577c408f,0x007735c0961ba0fa,0x008e5f7ede436c0f,0x007e78a8527324d0,0x00eb0bc9486a357d)},
+  {FIELD_LITERAL(0x007bc8447e267110,0x00fc8e41a310dc78,0x004a7ccaa92d0504,0x006b4e63dd87e43a,0x00e81d1a85be4724,0x00222e79573f41bc,0x008da3988beb69c1,0x004b47c03023fc1d)},
+  {FIELD_LITERAL(0x00e0b630469ef19b,0x00f3dd5ffea9c659,0x003cf4d1bb7f5c71,0x0070a477ad6179ee,0x0072592c0ffb4590,0x00d3b034cab3e169,0x00f0dbde81808576,0x00069969680883d4)},
+  {FIELD_LITERAL(0x00cbf12aa9e3780c,0x003f20d0c46f1614,0x000aeb877969ee33,0x00293c3cb8760413,0x00d0f5dc6cf5dd76,0x00a6e50e588b17ad,0x00651a137b7756ba,0x007275ad9d121e2a)},
+  {FIELD_LITERAL(0x00439223116a4fb6,0x0077f6fbcf8997d3,0x0047e1f589f19f25,0x0054e3783ea9ff4e,0x006a8e867a05621c,0x0059356f2019948f,0x002305a942f103de,0x0016f90f64f9a801)},
+  {FIELD_LITERAL(0x00707e886e8570a2,0x00e13a1ee7cd19d3,0x0077ed8089fb6783,0x0037c4a5dd168df0,0x006f7d0eda24485d,0x0069f404a9edffa6,0x0096cb12600b0401,0x0051947afb2734b0)},
+  {FIELD_LITERAL(0x00efb33302998650,0x002e15a1715cd27c,0x00ae371b6f4af1ca,0x00897557db0a2ecd,0x00bfc8686d4c5c2f,0x00da67a5eaf6de8d,0x00e276623e02205a,0x00a8f57e1e688436)},
+  {FIELD_LITERAL(0x00105a68236b574e,0x0052be0557defcb7,0x003d308af2239b44,0x0080be247f50b9e1,0x00d687c296a92d0e,0x0059c3b0d3f968b3,0x008fbcdeaea29590,0x00c108d88a97fdf0)},
+  {FIELD_LITERAL(0x007a758aa1c75b97,0x00c244b1d2719ce2,0x00c962a3ecd38041,0x00d0e65314108b1d,0x006b6fa7207acf23,0x00bb14beb4ad7990,0x00f02eeb626a1bb9,0x00bc49300b48acf9)},
+  {FIELD_LITERAL(0x00eb2ffb322c1cab,0x00708201304503b8,0x00af74c205ca36e6,0x00a63f35e376b70f,0x009a8dc23b21bcca,0x00ba69668f73e3c3,0x007a4eee4b45ff98,0x00bed18bb84dc74c)},
+  {FIELD_LITERAL(0x00828b702b9b6985,0x000cd36d3e026eb2,0x0003f634a845506f,0x009eb76875fc7a81,0x0059aa5f34858eb4,0x0081f35f4fce1cc1,0x00efe34895a93015,0x00ec42aaa2a23d48)},
+  {FIELD_LITERAL(0x0067e01158f2707b,0x0031a76859e6951f,0x001f4e6a84ccec29,0x0084c8562c40843a,0x00ee25abe544fb31,0x0051cb0dbb1d68c2,0x0003a33c8d47674a,0x002c5113db101de4)},
+  {FIELD_LITERAL(0x00cdbce518fe13c0,0x00d3960266be019e,0x00a4e0473b4e129f,0x00b2368ac306a000,0x00358391f7ff5bb3,0x00e4cd7b0f90953e,0x00eadaa20fbd7be3,0x00aea71d572b529f)},
+  {FIELD_LITERAL(0x003e78b06aba6d78,0x006f715afec99598,0x00ee6c10a71df9ba,0x00682d4d6363b74e,0x00da7faea9682202,0x008e0abc05bfc7c3,0x003b956c2127f54c,0x009eed81a2ae89ef)},
+  {FIELD_LITERAL(0x00c3d281e92c46b6,0x00288bf48237bb9d,0x006f2adfa20f6ebd,0x00d3a1d239e98320,0x000e8c8c3b6bd8df,0x00d9ca0c81625b4e,0x00063e6bb29c1a19,0x00fe8d5839c7b5b2)},
+  {FIELD_LITERAL(0x0099086e7bdb6bba,0x002d3eac76b49cb3,0x003f655c034a431a,0x00e86f7a003f1559,0x00566322b3b76d9a,0x00c79a421ee9abc7,0x002b1dd2c313bb7d,0x009c40355214fb65)},
+  {FIELD_LITERAL(0x007772fe606527af,0x0085cde2923fd5e7,0x0001b50b412642a2,0x0099dda8473193da,0x00fe3588fcf5d950,0x00497d959342cfd1,0x00466b02e73ee7f5,0x00c3756e1c5e5e51)},
+  {FIELD_LITERAL(0x006c9e8b849ea5f4,0x00411999e76c9e7c,0x00f364b004515219,0x00a2ca431676984f,0x00c5336367e33726,0x00d2bdc9f753dffc,0x0042f4bf76940c0a,0x002fbbb2dc09941e)},
+  {FIELD_LITERAL(0x00eeba20b7054268,0x00d44fa733929677,0x00a2ed91987c42a6,0x00f35893bae048e6,0x00e05d476d594004,0x00b2ce16674547dd,0x00f7fb95156c34be,0x001c69752a4b7c5f)},
+  {FIELD_LITERAL(0x00656e5b2b7303d3,0x005bd5fb19ea63bd,0x00952b5e275f7e1d,0x007a0af0f2bc6f90,0x00725bd9459254d2,0x000251ed39ed136f,0x00b65016f4202779,0x008d148682737a14)},
+  {FIELD_LITERAL(0x00eee9294f02025d,0x007338114f2fbd87,0x0056ca8972b3a65b,0x005e9f2f82f6922b,0x002d5117713bcb05,0x00dab6dd927f9957,0x001dd77f7cdaf7e1,0x000f553d9ed0488d)},
+  {FIELD_LITERAL(0x0086310d8f6f2b28,0x00cd9c8285d3dcb9,0x003f39c8ee967628,0x00a33f7e1e8aeb88,0x00c291828b067da5,0x001656aed8e92cbc,0x004a316747f8a747,0x000e9ca4d7323d91)},
+  {FIELD_LITERAL(0x00b31d36f2fdd64e,0x0015849e3f7172c4,0x00fe07bf0aefbe74,0x002539d3e257b939,0x00e1095acc955254,0x00535bd70f93dbac,0x00458cb58f89b5ed,0x0043faaceaf073ea)},
+  {FIELD_LITERAL(0x00370a45ed86c8f6,0x008cd29b042f724a,0x0013b176de183476,0x000a441655355f78,0x00d8b1598a1544e4,0x00426de23a6ab759,0x0039ea8145097bfa,0x00947905e06a797e)},
+  {FIELD_LITERAL(0x00a1c05b8204d49a,0x009f29ccd4c06e28,0x00285b11734fe6ed,0x00d9739640e3750d,0x00c60d91399efd1e,0x0006ff82529586d8,0x00c97c84e2c6fce2,0x00b5bef591633833)},
+  {FIELD_LITERAL(0x00d69eb0f273bd6a,0x00c66929922f6e2f,0x0078bf175cc53725,0x008fd0df9e94330e,0x00900d21a014fb7a,0x0010921bee4a86ed,0x00832b359f37dbcb,0x00fa945068e867d0)},
+  {FIELD_LITERAL(0x005ff8992f23ec9d,0x00e84d10db217271,0x00749c881758d701,0x0030072027925a0b,0x0083706e5c78f77d,0x000b83474acf7ea8,0x0028c26947b5ed47,0x004e81c15ef64ffd)},
+  {FIELD_LITERAL(0x00e265443ea4d204,0x009b73c296c26fd7,0x009ca7638d12dc18,0x00854497508711f0,0x00f05fbe5136c480,0x00c22f5cf66c7790,0x0078e30c10976fc1,0x0039fcfb01dd42e4)},
+  {FIELD_LITERAL(0x0051b3648f3b879b,0x003ee77b809b00eb,0x00b9c39338803420,0x00ae84939c34cdfe,0x00d33759b4b4525b,0x0016250241d3d28e,0x00ac04117becef7f,0x0083c27d40be058c)},
+  {FIELD_LITERAL(0x00028f0e231c2821,0x002136315f5c0d23,0x00f1d09f50b1d6a5,0x00137f664fcb0769,0x0055dacfef59ead4,0x00e5a1f61aaec5f4,0x001943bc19891b8e,0x0026b60b7bb24db2)},
+  {FIELD_LITERAL(0x00025cbe77accb98,0x00c8a9f76265cb38,0x00a72f71b128bd51,0x0009cc430ac75caa,0x00fe2d12b941b4cf,0x00703f9ed424b46c,0x00c8b5fcdeb8dfb4,0x00caf8a9908e355a)},
+  {FIELD_LITERAL(0x00589ea3b17e0f8e,0x0036303a103ad92b,0x00a789532ff28945,0x0079d14e296fbf42,0x0070e4b136590a6e,0x004228165e280499,0x00dae4d43590a045,0x00f9b098057b85fe)},
+  {FIELD_LITERAL(0x00c4fec2bd97846f,0x00cf92988e12273f,0x00949b541084b727,0x00a7c3dc0b07242f,0x00d6dd26317caa8f,0x00eb3e451fe723b1,0x00c90be8e6208d75,0x001e8cec3261f26e)},
+  {FIELD_LITERAL(0x0079ba544f57d154,0x00e3add52ea17129,0x007e73453f9923bb,0x004c824a77cb1029,0x00906fc1db8d4ce7,0x00e861c98a351ffb,0x00a2cd8232c2c564,0x00074d716059ecd7)},
+  {FIELD_LITERAL(0x00ac1cca9ecbae4b,0x0034a16cc38a850d,0x00192ab8beee3f6e,0x00ecb156d1552f5e,0x00a0e18415a1dd76,0x00c1905055dd1e2d,0x0078e7c4bbc66582,0x00ad54ff2d4c4c24)},
+  {FIELD_LITERAL(0x00b667bc08490141,0x000668d1673c5f08,0x003c006e8c22a537,0x009dfd360f5d4f71,0x0050b3f47fd572ca,0x003b0803b0ec981d,0x008a753cf01be1f5,0x009929af1404288a)},
+  {FIELD_LITERAL(0x0052f8d0e77d395a,0x0082f9756ca13902,0x00141c6ba2723cfe,0x005cdbdc8d5871bb,0x002c74b8f62080f9,0x004f1e34bc146c1c,0x00b746331fcbedcd,0x00be3c7adaea406a)},
+  {FIELD_LITERAL(0x00a4ab316e45768b,0x00dba535bd4bca43,0x0053288a1880e136,0x001b172619097336,0x00bc06ca260a65ee,0x00549eba10d42885,0x00504284caf3865e,0x0067009db3477cc9)},
+  {FIELD_LITERAL(0x00aefc8f3e83ab81,0x003f756510f8d79b,0x007751e46f94b2a0,0x002536e8a9ccbb38,0x0007c7aae2a71c18,0x00b979c3f9b83be1,0x0035d95dcba5d377,0x006965efbe0eafad)},
+  {FIELD_LITERAL(0x0066e24f1d5db9f1,0x00d026be01fa8a67,0x005cdade36c0f795,0x00912350b5f4b8f7,0x00fb8342fe6e2b81,0x00c3822e18e51a36,0x00b1a5d50feb79b9,0x00171dda6fb6c059)},
+  {FIELD_LITERAL(0x003dcc7de8db2f35,0x00842ac48d139775,0x0009e9b091f630af,0x00585905bb2a2de8,0x0078a53b22a9b189,0x0053a9d11bca4549,0x00bbc991c381bd58,0x005e6e3be08a2ae1)},
+  {FIELD_LITERAL(0x00a0ffe5f4a25fe2,0x0010b9cc23cbaef9,0x0053361b21956537,0x001260d6ae2eff13,0x005f97b821873de3,0x0084917349bb9822,0x00cd2f8c541d34f3,0x000470e9c717577c)},
+  {FIELD_LITERAL(0x0069260b7d3ac438,0x006aea05fc114e60,0x00860e6c3bc43e35,0x0003b3a318084857,0x00d254fbf19a4c1b,0x001d4a590dcec841,0x00e759bd4294b388,0x00d3129c3751f240)},
+  {FIELD_LITERAL(0x0066efd041b0adc3,0x00140c7dc70990b6,0x0057c09a344556ea,0x00d47d93b0849fb8,0x00711147cacddc7f,0x00dccb86239ba7ed,0x0058b236b883cac4,0x0053497354c9e581)},
+  {FIELD_LITERAL(0x005940cd9283c150,0x0031a76b45d0f9bf,0x008ebaf52c5caaeb,0x00a7f5c63f0cceb3,0x00acaa7882f1abd7,0x00d01503ecffb371,0x0065975b9329dfeb,0x0034f9d311b0273c)},
+  {FIELD_LITERAL(0x00406e83250d42d2,0x00bc062150d43c06,0x0030bb247542504f,0x009c40e3f2a6025e,0x00cc3fdae4e8279b,0x0042b659a3eeca20,0x009e9c25410197f0,0x00b27c2e7af28b4e)},
+  {FIELD_LITERAL(0x0095e167782a82f8,0x0000a4191272d366,0x0072a2a6836fc4c2,0x00c663feca7758f8,0x00b377f6d22f1de2,0x00891f12520d7450,0x00775d1bf12045c8,0x00d3425a37278a4f)},
+  {FIELD_LITERAL(0x00cf03830797b047,0x007d7b30fbfff4dc,0x00fb6d599b57da13,0x008e703cd8daed33,0x00f894f50ffd15a6,0x00caea07e5048191,0x00f41eb5b644d0e3,0x00205d81b64e8144)},
+  {FIELD_LITERAL(0x00650fc3090a8e7b,0x00887c0259568d4b,0x000e4b195b96f61f,0x00db04620db070c0,0x00198037c786ce41,0x002b63285aa3a4be,0x002896273e1e8b36,0x006b588e73e8aa15)},
+  {FIELD_LITERAL(0x00062627c1eed1f3,0x00e0e2c8dabd0d53,0x007ccf76b15e95bd,0x008e7bee9cc207d2,0x001c167630ae154e,0x00859716e6ad9d49,0x00049f169e03a200,0x00e64a27c355e018)},
+  {FIELD_LITERAL(0x00d6bcb105bfc0d8,0x00d7c245181b1163,0x00abe543271443e6,0x00f6734838bf8696,0x003d0a54ff409e7a,0x009076e06acd7304,0x005c542a9ebba9d2,0x00a87fd675808010)},
+  {FIELD_LITERAL(0x00c467bcd475d554,0x008f74b4410c8fed,0x0038699f2ffb7b3a,0x00e872efae3cfcb1,0x001fc3f3a00c320a,0x00c5dbdc080f334a,0x0095c2cb200376b7,0x0024b0ebe4331141)},
+  {FIELD_LITERAL(0x00c3aa99045852e6,0x0073587301309b8d,0x0061258424247c39,0x00cefcc04c2b1a00,0x0080ebdac69f26ed,0x005cd4328d77a2a8,0x00f816578552ca37,0x009769b3cc18b0cb)},
+  {FIELD_LITERAL(0x00c31ed6c3550868,0x00603ed0b68c8af0,0x006f732c638447db,0x00a3000162bf9af2,0x00731027e79d1b7a,0x004b6c53a088daef,0x00565649dca0c146,0x00ce00a656a6cd0a)},
+  {FIELD_LITERAL(0x00c1fa376b6f837a,0x00af04aa53813fd2,0x006078e71eb2a674,0x0075a8782c742813,0x00f3b0b94fcbe91d,0x00ae94f0f859f2f3,0x002af014760ca559,0x00e3edbb0e21626c)},
+  {FIELD_LITERAL(0x00efdfb517a8e643,0x007f393082fe873e,0x0075c253f7b474a4,0x0062d5ab58e45202,0x002016e981222360,0x00bba0fb7c8dda6e,0x00f5e34276e2f395,0x003ed08f5bd28dc6)},
+  {FIELD_LITERAL(0x00e871f8e9713633,0x00039e7bb5241d92,0x00538cc5d818695a,0x004bf2aa418736e5,0x00d49d33805f093c,0x00958f3b1aa3ce1e,0x0072c22dae92d759,0x008627af2d32d31d)},
+  {FIELD_LITERAL(0x00572d5aada09879,0x00e60320f01195e6,0x000b2bacb710dfd4,0x0069aa9998e00c02,0x009749fa2c1bd7ab,0x00396a1395ed48e7,0x003f100150004d6c,0x00e115567c89a5c6)},
+  {FIELD_LITERAL(0x00c0a0c6d23fa5e6,0x00cc2399231330cb,0x0073a18047773c4e,0x006b72c70d9c73b9,0x0051de052d33771f,0x00861a96b334df38,0x00ff9074f8a6f380,0x00eb4acca015a5ed)},
+  {FIELD_LITERAL(0x002b81e45db30759,0x00f8b661b2ab0a6c,0x00c5fb13f5cd80f1,0x00e3d77c42103d71,0x00057769601bd30a,0x00063c45dec58e4d,0x00b27e9736ef11b2,0x007c96d4d52806c7)},
+  {FIELD_LITERAL(0x00d2bf49b90a21c3,0x00c01efcabdbc720,0x0005fb2a71461c4c,0x0014330bedf3d8ac,0x00574e9fe156b5fe,0x006e1f73da254a16,0x002635911b116283,0x00dacced8007fead)},
+  {FIELD_LITERAL(0x000cf8cea93ed33c,0x0020e1556ec095dc,0x0071785aec39aaf4,0x00b004447e02e9fd,0x00d1a0d034fa4c12,0x00d14e7c9afb1fb3,0x00fe9287c279c8b7,0x00c0c5ac178c2659)},
+  {FIELD_LITERAL(0x0001dd8e59098129,0x00cc90b54281e997,0x00a563b7d3a1a494,0x003dc7b8c4afdafa,0x008c58e5ba22acf1,0x00732e8835d0464c,0x00f6152c9e281a20,0x008e9c14c690b538)},
+  {FIELD_LITERAL(0x00144934ac84347c,0x00c864bde69a1741,0x0058e0e771d5d5a3,0x00da5c5d3137f636,0x00e987114c21fbbf,0x00c27694e678e472,0x001ef98c7cbf3d05,0x00d15e22f1a31241)},
+  {FIELD_LITERAL(0x00e062cfbe7c84f1,0x00248a1dfce1f9a6,0x00e05ecb4ae6bc9a,0x000f30569dc3b5a7,0x0045ed9f98bcb2c6,0x0072b9f9643f1172,0x002113e70622dcfa,0x00b9c89b57c89d00)},
+  {FIELD_LITERAL(0x001d7a0676090fa7,0x006c56178dab72e9,0x000095ee744480ab,0x0085043a422bf38f,0x008a1ed41cb55d47,0x0054e02f91c49ffb,0x006c1cb98e47b288,0x005aff1d6463416c)},
+  {FIELD_LITERAL(0x007d6f1e6340cb5e,0x0055cfd5c4531cb0,0x0029316c2d8541be,0x0019b56fd6766107,0x0050c8348e0f97fc,0x00e90ca7a9e703f7,0x00d6d738a66f8052,0x0081b82db6c50f87)},
+  {FIELD_LITERAL(0x004d9bf7c2334dd5,0x005af27154964201,0x00ef18836bdcd463,0x009d88338f5dc746,0x003687a217d9b855,0x00bdd5f2e8d6de17,0x0064efefb357ad34,0x001ffb4f50c74cf1)},
+  {FIELD_LITERAL(0x0022cf818c1bf2e5,0x00d8484a53debe99,0x0098d46bbc641b2e,0x00da350c470bfac3,0x007d6acab3286d80,0x000871782dffd7b3,0x00de1bf3adb3854c,0x0028d38232435483)},
+  {FIELD_LITERAL(0x006c9cdcb1e063de,0x00e0310156b87758,0x00dfbc23e21dd219,0x00dcaa2ddd3f670d,0x00f141237029c6f6,0x003921b085d781ae,0x002f3bcd12d0b463,0x0058d05bc1b283cc)},
+  {FIELD_LITERAL(0x00b0e59a5d825a26,0x00ed7551f95055c4,0x008d101d64249b2a,0x004020d18decae95,0x00cf118645fd274e,0x008a64d466b3cf94,0x00462bd01b71fdf8,0x00936764eb815f25)},
+  {FIELD_LITERAL(0x00599455c75fcf81,0x00c9b897bed964e9,0x00c3555fa28d1865,0x0061bf934e100302,0x00e3552c1d3d6970,0x0079d3296df4c2bd,0x00f98455874d6fef,0x00b898b98e5d2060)},
+  {FIELD_LITERAL(0x00c14aacf05faf4c,0x0016665088e7d578,0x000da063ad229fbb,0x00df03942beb238e,0x00fca40c4c0fc34b,0x00ad9b1419206bef,0x000e3fc31c3558f5,0x006a1e62721250a8)},
+  {FIELD_LITERAL(0x007a3044290c09b3,0x007c5293f34f0184,0x00df6e5c85ae3da7,0x000b693b34c9bc7f,0x00d708ee2c5827c8,0x00f099ad0d270e40,0x003d83287bd9fef5,0x00ada652046e9290)},
+  {FIELD_LITERAL(0x0023cf278bdceb8e,0x00c6185929aec574,0x00d0b31475797bab,0x0010b069506dc327,0x00f490c54b8e38ef,0x0061036fba1d2c5c,0x00323c6b7b7cb3df,0x00aa69d3084e9298)},
+  {FIELD_LITERAL(0x0062723317bb509f,0x00dcf129632e00eb,0x006a1a378961dbcd,0x0014a43d3dcff8c2,0x00d7cbac7a137ef1,0x00aa42893d86b976,0x0011e050c36206af,0x005ec466b01ffabc)}
+};
+#if GOLDILOCKS_WNAF_FIXED_SPLIT
+const gf API_NS(precomputed_wnaf_split_as_fe)[768]
+CACHE_ALIGNED __attribute__((visibility("hidden"))) = {
+  {FIELD_LITERAL(0x0075fd1241fb006b,0x003a09275d3644a2,0x007a1744ccf42983,0x00c72633b39f66f8,0x001fc99f55438cc6,0x00c71cd00ea2eb65,0x00f7f724ed5950b5,0x000839316ab3c704)},
+  {FIELD_LITERAL(0x008de4ac4c9a9854,0x000ecd24e9652c12,0x0077cb2bdff18870,0x00ec6cef30f79c7a,0x00831e4f6113ba82,0x0098dba3c4eda655,0x004dcc5899b361cf,0x006375c1c82bece1)},
+  {FIELD_LITERAL(0x004c9af0653b190b,0x00ad7d06f87edec6,0x007483e2a337ae8c,0x009cbac9ef29f28c,0x00fd779e4d8f7383,0x00a14430d5558a3a,0x004b9d0c187d2bf0,0x00b2ab442c9752eb)},
+  {FIELD_LITERAL(0x008e982b953dd8b9,0x002a255bd122f13c,0x00dbe8aaaf121bbf,0x000cb11c52dc1627,0x003150b12f174244,0x004ef98e9aed547b,0x001260a4b3cf2f9c,0x00e13bc302453154)},
+  {FIELD_LITERAL(0x0080a1945056586d,0x002e36e76b4086bc,0x009f6a413eab4223,0x00ce3116586ebdd8,0x00127df02b6d1266,0x00c30a32d4033c63,0x00528d28cddd6739,0x00fee79efca6fc67)},
+  {FIELD_LITERAL(0x001ca88e72a17f4f,0x005b282378abfb8e,0x00b08832180cc686,0x0040d526ec25e535,0x00a173eac15961eb,0x0048c632ad5206b4,0x00e6ccef65ef8e8b,0x004b3a1a8f33390d)},
+  {FIELD_LITERAL(0x0046ebfc18490cf8,0x001dc5838d8f075b,0x003841d56dd0d83b,0x0088f6daa20dc032,0x005b2f5d37c35050,0x004034e61448bd7e,0x008d8c4af1565118,0x00a4a87918cdcfd3)},
+  {FIELD_LITERAL(0x00e0cc33b7f9fdd2,0x0057739c80ce7ab6,0x00de90bea754ec6b,0x00294b75bd7f1ea2,0x0029a5f907663b13,0x001bc0c084f5c348,0x001cf7cfebac8855,0x003a79d244fafea1)},
+  {FIELD_LITERAL(0x0041c1d7fb47b3db,0x00a1c9fcd4da560a,0x00a1ac68df356c69,0x00d6a2e1a7670754,0x0099b759e1600760,0x006201df49c03e2c,0x008e19aa126eb9ce,0x00e35cd9e64fd7c6)},
+  {FIELD_LITERAL(0x00b71e4cbfbeb090,0x00df4bfd3d4505ce,0x0055588254b8045c,0x00c39a9ab10542b5,0x00e1b65c8629e70a,0x00f83a50f9cae820,0x006488f236798ea4,0x0065894646a4c840)},
+  {FIELD_LITERAL(0x002a75151726dfbb,0x00544204599697b4,0x00e05e149a84045f,0x0025a656d4b60f79,0x00ca9bae001e24ea,0x00601cc07ffe46a6,0x00e7d1a8c5c46e6f,0x007e94ee17dff170)},
+  {FIELD_LITERAL(0x00482f2895f6a14d,0x0000dc2f794bdc9e,0x0059098b1dc34c01,0x00ef0c6c5cd21a34,0x00da41c9c24c2c97,0x009a2ed1485f6123,0x00bdf7557e8b7b01,0x0045dde397e8bcb9)},
+  {FIELD_LITERAL(0x003cb3efd51c0b45,0x0045cf76e8f98286,0x00dfcbf214d8cb4e,0x00111e569a91b59d,0x0030289fe49394ec,0x00a63191d5aca5f6,0x007388c8b0d16b13,0x0012712eeb33712f)},
+  {FIELD_LITERAL(0x00c08c4f0eddb3ed,0x00a69cb406bbc4cd,0x00466b5c14b6a5c9,0x008e2b6b568d58c4,0x0091f242ab58a92e,0x005b983c449357db,0x0040131296fbbddf,0x00afd385ac412ecc)},
+  {FIELD_LITERAL(0x003f6f9ddaa11a49,0x00e2aa10c1e04a83,0x002aa34097c174df,0x0056bc91a2cfc298,0x00dd145138ad8643,0x009b502e5fbf2273,0x004daef8dadf16de,0x00e0d58533945ca6)},
+  {FIELD_LITERAL(0x00667cbbed8610aa,0x00178dcfc08cdc1b,0x00143e1c5029fab1,0x0025090ba50d0eb5,0x00afef138ae199f2,0x003f143bea5973c0,0x004f0595d97a2f06,0x00317823b2f54f1a)},
+  {FIELD_LITERAL(0x009d138105b87c6a,0x008cf0b180aedef9,0x0001982f8c9acaf2,0x009b615e6d889105,0x00a5a4f54707c6ee,0x00d8a76f839935e8,0x00e56e9b92d1393d,0x00f56be8bb23407f)},
+  {FIELD_LITERAL(0x0049c83a92170c76,0x00179f01515f623b,0x00aa76c57f998717,0x007f4dbb2ecba20a,0x007339b98b275693,0x00f99b1dfd314e0a,0x0090d38aecf21c5e,0x00e9317e8712f592)},
+  {FIELD_LITERAL(0x005464c86ee0e242,0x00b232cbdda78d20,0x009aabd33ca9c284,0x00c38b6a73071963,0x00b983c870c1a2bd,0x007792f93c8289f5,0x00aaa5fd64c42553,0x00ba99d2595045d8)},
+  {FIELD_LITERAL(0x00d0b1296dce7fd0,0x00b5b550cac92797,0x006b692b7843c59f,0x00701d3e5162c3c0,0x0079bd73ba5b14bc,0x009d148d26b87ad9,0x00d41b1b5f8ce7a5,0x00648ea39bd13e13)},
+  {FIELD_LITERAL(0x001683bf57fb049e,0x0037176b75c054c1,0x00386482d2b20213,0x000ad4b193f5c38d,0x00433efb60a1f163,0x00202b5e325402d4,0x00408524495b89d3,0x007d5b123aff637b)},
+  {FIELD_LITERAL(0x00d67e6725beba3d,0x006f173a828e2d5d,0x00e3cb13a5dd95ab,0x0058b79a72974501,0x00f45066bd65e32c,0x00852267d8ed6444,0x0077fdf70b81517b,0x0059d2429800c77f)},
+  {FIELD_LITERAL(0x00430f0ac3d142e0,0x0026a623565bf1bf,0x00b7bf63df20cd37,0x008035abed4a5eae,0x00d3dbb0df825adc,0x009d31a0e1633300,0x00c98906d65384aa,0x00b626aabeba2ed7)},
+  {FIELD_LITERAL(0x007f4cfae81f1423,0x009cbef98c3fe8df,0x00e98863c956964d,0x00fb5713f4179e13,0x0013863d36d10c95,0x00d2f1e4c555cac0,0x00eda9baa50fac33,0x00155692c4a7176e)},
+  {FIELD_LITERAL(0x002cf4d8374137e0,0x0011bcd01cfc8b65,0x00d819428459350e,0x00c2636e55507d46,0x0043bfe72bf49f44,0x00e232e73e600c93,0x00f4cd7ea6144b4a,0x00c8117c7c63707a)},
+  {FIELD_LITERAL(0x002bc6bdaffe2cca,0x0088cd41ca85d89c,0x0080f8199e0742d1,0x00c0d806414e6e86,0x000b13ead9dc050e,0x00c0db5268db156b,0x000aacb76c4120ec,0x0075a902879d2720)},
+  {FIELD_LITERAL(0x007c8f764c23f360,0x0031e6e513a6024f,0x008e4e840ad92c73,0x004325092a3b9a6d,0x00f63712a826406a,0x00409096924a78e0,0x008d28ebdd651f48,0x002331c8cd805b7e)},
+  {FIELD_LITERAL(0x00eb7c2e84be8f9e,0x00225da3976722bb,0x0092175b84abfc77,0x0045ae12de030531,0x0065c57427d6bddb,0x008a30ec7e277ba8,0x0012442a0185745b,0x00620b4b99019d9d)},
+  {FIELD_LITERAL(0x002303cf587ec4d8,0x00a960baaa467b02,0x00bde9a108ad0446,0x001d17fb0182279e,0x004b9bacc68a8c06,0x00a03b2994097255,0x004e79c82db8c972,0x00a0afb289adb754)},
+  {FIELD_LITERAL(0x007670df487c8c6c,0x006e5ac06f3aa617,0x0013351c0ce48529,0x00ac8802da82aec4,0x005cf2967d3eda36,0x00b802b7c48e5ef4,0x00b7b0907570c503,0x00262a7d37014b92)},
+  {FIELD_LITERAL(0x00bc57af5ad474d1,0x00b83c9890b6d477,0x00da60f2b3932ccc,0x00f4f00e085f0325,0x000f84bd8401e0d5,0x0041688cf93ac811,0x00aeeafb64b994dc,0x0024454a653176ff)},
+  {FIELD_LITERAL(0x005c4ee607871eb7,0x00ecdc9963259be2,0x00454d5df525f1c8,0x000445027269ce84,0x0000380605c50a44,0x002b08602d94c271,0x00b17741d712107e,0x00655ccbe939a512)},
+  {FIELD_LITERAL(0x00732b1f632a66bd,0x00095551f51c4fdd,0x0013c4a3ff0d84f7,0x00cb39e019e6ab00,0x0007e028d50e353d,0x00137d931bed8523,0x00c88098a0d1eac4,0x003d80c40a5e3aaa)},
+  {FIELD_LITERAL(0x008bc95eb84a7783,0x00f7f46c87c1799c,0x00106f4d4ca08e46,0x00817644acd1e69e,0x00d1f791490c9d13,0x00563569b20c1dd2,0x00ed734d8b2e8d96,0x005665d2b59081ca)},
+  {FIELD_LITERAL(0x000a4ea98d69c0e3,0x00e94a486bd436fb,0x000f03ac2e7e68e9,0x001e6bb6b7f2c6b9,0x00b3dc1b432f0d0e,0x0061a00270f7d0bf,0x001eef60a46f6add,0x0059972a6fbe7045)},
+  {FIELD_LITERAL(0x00d47e3dfa08980d,0x00daedc2b3371a12,0x002b10fc0289df19,0x00849f3a6397f41d,0x00d4dea1feef9f56,0x00ea283d35305391,0x002d85af4fb121f7,0x008af6602a08e230)},
+  {FIELD_LITERAL(0x00d6abe5147c27fc,0x0016539dc6f9d47c,0x006a1f048b8c4de8,0x001b784bb4759b4e,0x00459ad33a147ffe,0x00ad3338d344b0d8,0x009a5ae24da065af,0x00c40772e389a7bb)},
+  {FIELD_LITERAL(0x0027f8e18fbc0ede,0x005e60e350f44abe,0x00d087b556d58a33,0x00dab6b6a64f2d3a,0x00284a304115b0cf,0x009d50c3c0e08060,0x00e5b20b08ef8ef9,0x00c92a4e72a43f35)},
+  {FIELD_LITERAL(0x0046eacfbe75e7c5,0x00519615deab19ce,0x003983bc3b3746e2,0x00f78498b9d6d8ba,0x0040f00fa4cd47ae,0x00c52ae8d838e070,0x0047987e94135150,0x00716c580ee7b69e)},
+  {FIELD_LITERAL(0x0019f6afa9ab06aa,0x00d3f3cb7105147f,0x00cc0f1a90344702,0x005a0a09725ea7b9,0x002aac19525b7ab4,0x00210b3f88f54db3,0x00077437c1e7456b,0x001042dae2ab4b5d)},
+  {FIELD_LITERAL(0x00f8d6551a584758,0x00b4b0f31db2b924,0x0035a04f6aad608b,0x000aae0e4e20c8cd,0x00cb975a2377c544,0x009647e5200e869a,0x008a8aa5f1d90d1b,0x00ec3ed1ecb17361)},
+  {FIELD_LITERAL(0x00ac64f13f138b16,0x00c4a613e8e7d424,0x00efd959c8aaaa06,0x00d3e34bf8022c95,0x00cba20adb9e908d,0x0036c7d56af7db19,0x00289e56ce23ccbe,0x0095fd864a2fd927)},
+  {FIELD_LITERAL(0x005bdf4385561592,0x00ff6b3266bbdaf5,0x006e9b8f8611b5eb,0x005ec95212047585,0x005b075257f5c198,0x0064143dd1846c1e,0x00458316590e2557,0x00a12186cf4aaf8d)},
+  {FIELD_LITERAL(0x000766f371186363,0x0025f819f24dd710,0x002d943707999c75,0x00a0e7b6b1c37fa2,0x0034a951bfe480a7,0x00ba4a982266b057,0x00fa852da57e97b6,0x00d6c2fc7ca21c87)},
+  {FIELD_LITERAL(0x007d4fbd68a22900,0x00d3b58f75a93153,0x00327f2d475d9600,0x00afa719750d9374,0x0037025d4b127c26,0x001ce32af5847375,0x002df5fd324f1a40,0x00659b9c594422ff)},
+  {FIELD_LITERAL(0x00fc06447aa672a8,0x004fdd061aa5d573,0x0002607f643d5283,0x0081f61f7385bae2,0x00dd28c8cc3b85db,0x008315d0fdb1f516,0x008065ac741db014,0x00621bff59c0bd4f)},
+  {FIELD_LITERAL(0x00037a18ff6d4815,0x0056e16431d5a61e,0x00159e1bb0e7c2d2,0x00ceacc829f29fc2,0x00e5a7b6851b5114,0x0028836384f66075,0x00fdd1a2c83c93fe,0x00d89285784db9ca)},
+  {FIELD_LITERAL(0x0064d41ebb3eebaf,0x00473491cc37c819,0x00b6b61626345d7b,0x001a8202b37a3790,0x0096a1bbe33aea00,0x00d4bb7b93a974dc,0x003057b1acd7e55a,0x0074bfa6b3837755)},
+  {FIELD_LITERAL(0x00f4d623760fc21a,0x00ccbcb94477b749,0x0090948b74c67569,0x0098edc343c15191,0x0088bc71e9f97402,0x0040dc4b367f7692,0x006e532439747a9b,0x008675b9c4d8601d)},
+  {FIELD_LITERAL(0x00a99fc2702e3cbf,0x000cdd4ea1abbbd0,0x0039dd1f6ec8807a,0x004fccde36d625ba,0x002c00d50a1ab661,0x001a58c771b906b8,0x003a58d8bc1ee7ec,0x001cb3b83d1d3afe)},
+  {FIELD_LITERAL(0x0080689a7a7af6df,0x0023f703b961ec26,0x0092ec1290f763a9,0x0093f5eeac6663d8,0x008b67df16d150ea,0x00e338dac65f8378,0x00cb4d02a5399332,0x000b32ac52011866)},
+  {FIELD_LITERAL(0x003e4fe889a6c8f0,0x002486114467fcc5,0x008bc09141018ce8,0x002eddfccb5151ac,0x0064533f4725723a,0x001de20f48cdfa99,0x00f04ca997240cef,0x0063c57607519c88)},
+  {FIELD_LITERAL(0x00f60e12adf6040c,0x00b36cb184c72847,0x00df6d8b890c3c9c,0x00afe158c4c668c1,0x002a4b9b2eb150df,0x00bda387c99630a7,0x002070cd953d67c1,0x003411500b3b20b7)},
+  {FIELD_LITERAL(0x00d9e9da075534ea,0x00a8df1a0c0d64fe,0x0079999ce6afdf5d,0x001d267227508222,0x0087d7f5a2195206,0x00013bd8623bdb81,0x00161770e850445d,0x00e909bf592e27e8)},
+  {FIELD_LITERAL(0x001a401cae18a39f,0x0031674387ef870e,0x008cac9360a1f176,0x0090ab2a5a010a36,0x009f191751d9e926,0x00f914b4e33682c8,0x002123c0e6869b11,0x009c2518360a7228)},
+  {FIELD_LITERAL(0x0017bed74f952bfb,0x00af8688d094df71,0x004d05eb80df783f,0x0051488ab6f9bceb,0x00653e04d9030fbd,0x00f7ecdbe864ecee,0x00948d66506a8bdb,0x00a31a0c3c95a3ce)},
+  {FIELD_LITERAL(0x004325a1e71edb4c,0x006b0e65086b0d39,0x00d6807f539b5d11,0x000fe10afe2fe18c,0x00ca512637538c68,0x00fdd644e6279612,0x00ce2ef0c69543e1,0x00cb3d2eb9fe6816)},
+  {FIELD_LITERAL(0x00568d09b9f22a6b,0x00e00a8e18d5e1a5,0x00cddcf90108fa8a,0x0003742222d3e229,0x00c62aae6d10937b,0x00c40b17c935458e,0x00155f9096050332,0x007675e2a6e10754)},
+  {FIELD_LITERAL(0x00b699c07f426656,0x004b0a8084fa04c6,0x00f28837aec5a5d2,0x00713d34765ea025,0x00de649575970a80,0x0019f1f107ef21bb,0x007e164282446b30,0x0049345c8271a885)},
+  {FIELD_LITERAL(0x0073a354264de9e9,0x00193c84964c68f5,0x00c53fc234ff743d,0x00b3c96c3dcb53e2,0x002cf74c90b4f1d4,0x00602ddcc3422081,0x000fa04b1ccc6861,0x000b1efca5908940)},
+  {FIELD_LITERAL(0x005333c4725c15af,0x008ff3216fa735f6,0x00a0006cb9319b28,0x00ade7b084481272,0x00a65487b67024c4,0x00a4408dcd861601,0x00d7034c679c027c,0x00b515108f96aab0)},
+  {FIELD_LITERAL(0x001b1f3ba8c94ddb,0x008ef8468ed210b5,0x00996f0ad7b0c9fe,0x00579819662dbafb,0x00f7c8d41daed60b,0x0006e06628afa4fa,0x0012cc153702b9c2,0x00a95903ad0fbe76)},
+  {FIELD_LITERAL(0x0093dc0cda7ff166,0x00a5afed59f9663f,0x00eb6c15e8efee26,0x00254ba619186d76,0x00983e49bd636ccb,0x002c5a134ae58df8,0x0014ea91c430b790,0x00c5e9ca28ab0e91)},
+  {FIELD_LITERAL(0x00f5b1d99d59aae1,0x00ff6948770b9720,0x00e718e9daa2a4ec,0x00ffeb43370eb9ce,0x003da15c2af28f49,0x000d1ec8900395fa,0x00e556c861203ad9,0x000463e67016341e)},
+  {FIELD_LITERAL(0x00cb85694d089fc3,0x0083bb9368861bcf,0x000cf3502ecd4275,0x002bcddda43a2628,0x000236479229032a,0x00e9c8a63843075c,0x0003db99715466ed,0x0068cf9526159cd2)},
+  {FIELD_LITERAL(0x00031e2c6698d433,0x00fc6b7ada3383df,0x00229d1e166ff7d6,0x00e329a83ec41302,0x00a4ea7a56c0db18,0x00095798bbf27657,0x00a6d3f05d306882,0x00e769ce4e51d279)},
+  {FIELD_LITERAL(0x00a09a51c956986f,0x00287b2e66077010,0x0000358a62d07632,0x006b10ecc7db309f,0x004679a9c8284487,0x00c582288840a456,0x00c6a7e16bf78569,0x0030a852f4e9d139)},
+  {FIELD_LITERAL(0x000c635747485463,0x00c4056e0fdd0f69,0x004ed02af667c9ce,0x00272805b0d1520d,0x00e02e0437dfb0e4,0x00cfd18963ceddab,0x00624fa2480e9d6b,0x008dcaff54779dba)},
+  {FIELD_LITERAL(0x006d59954c433cd6,0x00302dec1a134957,0x008131e3d9cd5573,0x003646644f8d6769,0x0086a28be5f65ee5,0x007588860bd65db9,0x006684abd0cd1248,0x0004628660586996)},
+  {FIELD_LITERAL(0x009c6716f0850ee4,0x003d9fa6e87030ed,0x00e985d9bc6b9dc4,0x00f15f6b0ee1c3fd,0x00017c3e5d12e4c6,0x00612d6f9d9fdf6a,0x00c411c75569ffc1,0x00c2d6c46f82dc20)},
+  {FIELD_LITERAL(0x0061068b3581aba6,0x00fe9189cdf90003,0x00d5ed0e681cf004,0x00151ff68bd5ea3b,0x00c11698cad6aa9f,0x001b5859410fa611,0x002ef3493e9e2af9,0x00e71c74254749b8)},
+  {FIELD_LITERAL(0x009dd23da3e3ab5e,0x001aefbaf2529935,0x00eefcb4703bb6cd,0x0079d39953a79d4e,0x004fde6ff67c1f0a,0x007276b4ec4c99b1,0x002124e6bcdf01b2,0x00611c400fa01e19)},
+  {FIELD_LITERAL(0x00d023f8e4da8ec7,0x00ecbb1f40e635ef,0x00a9f46dbc56f3ee,0x00640ac1f825f79e,0x006669cb2ef95f66,0x00b47d23968d2a78,0x00ce71866a0fb89c,0x008fee90ac64bed5)},
+  {FIELD_LITERAL(0x00a29f6b2359a2da,0x00b2ac5a3e5f3f18,0x00b3a66db3533f07,0x0028c94ec1e69157,0x00540ebc7ab9f09e,0x009f88cf4951a9b7,0x000f72a4b987ca47,0x0078e5752e9ab12a)},
+  {FIELD_LITERAL(0x008149df0d6f178e,0x00ff5b76b50d6983,0x005cc60f47e5f1cf,0x0085957c5ce5c00b,0x00643a3b80c01474,0x00dbd52e80ea7b7c,0x00e0ceb72639723b,0x0045994932da789b)},
+  {FIELD_LITERAL(0x0009b7c035c9f361,0x0005234d09f7942e,0x003d7797e0b11c5d,0x0056dff81c3bb430,0x00e190657c94bd35,0x0047ab208fde0fae,0x006035e872e1f474,0x0016eb83f161e165)},
+  {FIELD_LITERAL(0x00dbffadfbb07717,0x0068d482af386f53,0x009c87494dabf009,0x00a7fc31c7d6071b,0x0086f8cea871a141,0x00544eb9f48420d5,0x000a8204e17b319f,0x005f73bd6f3bead8)},
+  {FIELD_LITERAL(0x00895ad60baa7959,0x005356314cb5a5a9,0x0015c86c1d547150,0x00009ac276829cb2,0x0012365c8eeba1d1,0x00b477db550ab24e,0x00c895225100d72c,0x007195657296a0f2)},
+  {FIELD_LITERAL(0x00572f9be18c5625,0x00fd878af5029ac8,0x000efe7b99ed6e7d,0x0057a75e5a5ffc13,0x00372b415a6dcfb7,0x00b7837f6fb6681b,0x00f004ac7109872e,0x00e8b76abd7169e4)},
+  {FIELD_LITERAL(0x0005cde3da41f6c0,0x0073976e2a61eed9,0x00c66fa0ed917559,0x00f0702f66f2b917,0x00663a3afee43b60,0x003311dc62e096c1,0x00c4ce38dcf87c00,0x009f42239d0efd38)},
+  {FIELD_LITERAL(0x007fa90dfefdc27e,0x00dabe701288a79e,0x00e54b83242b9b92,0x00ea64bd5a411971,0x0099da7e287d5d92,0x005b76d077db9c21,0x00fbff138a1b84de,0x0010451b90791c04)},
+  {FIELD_LITERAL(0x009f490560071811,0x00d121eeed6815fa,0x003c26806894d24b,0x0052214f8e4f1680,0x00cadb905968a815,0x00f986ecc79552b6,0x0077373bd44f5a0b,0x00c6aeb53d3b5ab9)},
+  {FIELD_LITERAL(0x0034770414fe3fab,0x00d53cfd361e841d,0x002c949cf1c70ea1,0x0010c58407f5ecb6,0x007fd3ecba9b285f,0x00ff7ec3e10a4fe6,0x00628c0f15484db4,0x0069888c725464d9)},
+  {FIELD_LITERAL(0x00b9c37cc33dd7da,0x00a2dc91059b20f1,0x0020f304354553f7,0x0051909b1edac8c9,0x0074aec4d0bf927e,0x0094e514e0d35018,0x002bab18f1d8eb35,0x00b9bdbe87fc1d0c)},
+  {FIELD_LITERAL(0x0001a4f786d79e4e,0x00bc9a0d100aff75,0x0027a5957d9668b6,0x006bda303fd2f1c4,0x00a3a831680b169c,0x003d8d8ce35322ef,0x008e7794e0050c5e,0x0079b95fee2982ba)},
+  {FIELD_LITERAL(0x00250bce01f405ea,0x004eddb1c2751be9,0x009bb7754924a659,0x00a8976028ed7958,0x00def8d54f629f06,0x00982ea3f2b7c7da,0x001e5bb0314f5875,0x00da45996c1cdcb7)},
+  {FIELD_LITERAL(0x007c5b4ef7b86e9a,0x0054bf46c4da0cf6,0x00f3723c94f63a70,0x0006a81bef6bdab4,0x008f2ebbdd144bc2,0x00db5a7a8538db1b,0x005516527b729b80,0x0062c014b1eb1c29)},
+  {FIELD_LITERAL(0x00a9d835541fed60,0x0005dbe44d1abe58,0x004887f92c74e674,0x00ecbeee5ca06733,0x003e61c422075a0e,0x00e237ac6d11aef7,0x007ff7ad810fd62f,0x00f553b08aeb9261)},
+  {FIELD_LITERAL(0x0048a6ef0f597158,0x00d2bd08f42bf48e,0x0092e8543aa411de,0x00725ea7f497cbc1,0x00679bd1ea42b57c,0x003839564b6f8459,0x0075b7bb846062d0,0x002f506fd9eb4d7e)},
+  {FIELD_LITERAL(0x00b3111798fd854c,0x000e54d8bd080776,0x0005a6a239ecdbd6,0x007d89903d490d86,0x0061fac971bc23cb,0x00388f1334f71c5d,0x001a1069bce98c7f,0x00523181cdb9d211)},
+  {FIELD_LITERAL(0x00f8cc23799bebda,0x00cfe313d601c370,0x0012bda860bea571,0x002f8aeaad211d51,0x00d67259ce0ac53d,0x006b2c74a328248f,0x001be3bf6ee7dfde,0x00f0946f3cfb7b8d)},
+  {FIELD_LITERAL(0x00662051261c069d,0x007a58f6e85b360f,0x00a27489e812dbae,0x002f9cfb72efb6be,0x00ba360587190a87,0x008636e93549bacf,0x008a067de56a03b7,0x00feb0ef6d6f3421)},
+  {FIELD_LITERAL(0x00b5f54007aaee08,0x000ccef57e4be275,0x0089cf8aa67af3a7,0x00502762f91090e4,0x0024acc48fbc2237,0x00bd5b96a03bffb8,0x000375dba1e00b9a,0x0068222e9c471040)},
+  {FIELD_LITERAL(0x0058c951bca098ea,0x00c8fbfb21be48b9,0x00be1fec2fd486ce,0x00d25a1768937aa3,0x0039bfef358d0261,0x00501bb1e6d46166,0x0072045214d40ecd,0x00f84a70c9729d72)},
+  {FIELD_LITERAL(0x001784a954018b4e,0x008f345fab0e7e0d,0x0092620d39beafe4,0x0004d54bd9dfac53,0x006550d489a14b90,0x003063c8a3a039a6,0x0040d695fa78cb62,0x0088521b6badcd72)},
+  {FIELD_LITERAL(0x0061a426dfdf5030,0x004610d4954516ec,0x00f0bc965685c5fd,0x0049009791061d97,0x001ebd73a3720de6,0x007346c0c41ad203,0x009a2e25dcb166e0,0x00d82d931131c4b1)},
+  {FIELD_LITERAL(0x008ceee4dbe835e6,0x00b41a1e8399fa2e,0x001abd3fd2161be0,0x001ceab8c09c4da0,0x004f1cb3044e3cd8,0x005c49cda7ea8b11,0x00ad17eda963323e,0x005c0d464a14a122)},
+  {FIELD_LITERAL(0x00ca5ee97ad9a13c,0x006687cb41b89433,0x00fa3e02753ac27e,0x00cd9b8524f49e9e,0x007d46244d4deab8,0x0009317786c2def8,0x006c80ad3bf3c276,0x00c3c251ea498bf7)},
+  {FIELD_LITERAL(0x0015b303cd4972c9,0x007c63d6e82811d1,0x00751ab283b1b345,0x0091fe8ee3c2e4a7,0x00d1e6ef4fb692eb,0x00e00a353fcf5912,0x007fb608d663a69d,0x00cb273aa5c2ff4a)},
+  {FIELD_LITERAL(0x004e41d7e24bb319,0x007c34275f64415e,0x00f09fd40b483336,0x002c85f48e820e1f,0x005cadfa21896fe2,0x003b5468e88dd45f,0x002de46af0d2be2c,0x00f05ca41e0ef6d0)},
+  {FIELD_LITERAL(0x0085c0b2249bc741,0x004b2c8059cb3389,0x00532425e802bd7d,0x006784f4782d4344,0x001deebb296f9922,0x00ff30f747e9aaaf,0x001d85b5d314438d,0x00a35844af618b26)},
+  {FIELD_LITERAL(0x00dd36c15ccfee96,0x0025472dc945ee15,0x0013b831c71c2395,0x00e07fc6bc9e6f2f,0x003378a5b4a36469,0x00e4aa6515d303d6,0x00814e2f1e876395,0x007bf5a563635736)},
+  {FIELD_LITERAL(0x00357592036e6416,0x008ee392e62ad0cd,0x00a890280e64ce03,0x003aad18b2736599,0x00983b0ea0480534,0x00aaf2f05d066a78,0x006be1833d666be3,0x00f5257801c9045d)},
+  {FIELD_LITERAL(0x007edfe4da4591f9,0x00ec6e53314cff39,0x001eba4973dc5246,0x003214446a1978cd,0x009e6534fb6661b4,0x0015a4537f61817f,0x0010ed8862c67307,0x0062eeb0f13e6726)},
+  {FIELD_LITERAL(0x00f61281bc2bccd7,0x009840053c8b49df,0x00c3cf3806398326,0x00cafac346fcfa14,0x00af5a7648b6bd12,0x004be14f7e3a49a7,0x0069764b7fe3998d,0x00d5425d63e3ce3f)},
+  {FIELD_LITERAL(0x00fb14a6a236c6f4,0x00af6af8601eee86,0x00074db79e63e695,0x004ab3620234e444,0x00089210ecb5e85b,0x0051c98e7ab59dfd,0x0093bfa97255f90d,0x000de58fac85995d)},
+  {FIELD_LITERAL(0x0086adf38444f2ae,0x0033e49de49a1db6,0x002509d7071f960f,0x00fdf73e8ecb2e31,0x007788c326286ed1,0x003bb81d82da7433,0x00db58c53e92a9f8,0x001b47d5743eb0af)},
+  {FIELD_LITERAL(0x008747ba1e629515,0x00095f53a1c9128d,0x00aca066ab402ad3,0x00c07df42a737029,0x00c027b15cc14d97,0x00251652e442e6fe,0x003b800c6e39117b,0x006ca343f0a29eb0)},
+  {FIELD_LITERAL(0x00b36f947bb6d02c,0x00606e7fafa3798e,0x004204efb9d4036c,0x00000a98f00a3959,0x00f1679d868c328e,0x00df5a734e8ee25d,0x00545d7e4537606d,0x002d335ff0d20a0a)},
+  {FIELD_LITERAL(0x0050835a3b81acfd,0x00ccf553da8aa3d9,0x00c30c94ab746e02,0x00f74cba23db5e52,0x00ad72e97a62549d,0x0095e09674933871,0x002d14cf6fb34218,0x009b977f273e4380)},
+  {FIELD_LITERAL(0x009b10921883b64d,0x003166b752cf3e7a,0x00c057fad6f89e68,0x007d218a24065a72,0x006d47c4b69b4a05,0x003ff4e760f9d3d4,0x0059a2e650d14cf1,0x003bac8b70963cc8)},
+  {FIELD_LITERAL(0x0026287f244b2e89,0x00ae45549af5e8fa,0x00f831bf60bb782c,0x006e70c455732a9f,0x0061acb54535f0fc,0x00104aae688c03d7,0x005e270b5dc2c121,0x0032e0da68f00f55)},
+  {FIELD_LITERAL(0x00b4aa12e4de5302,0x0099313573079d07,0x0002655f8728a857,0x00c3a10a522bd84b,0x006d9cb13b590490,0x00d7466ba21fd600,0x00583f84dce4b2b3,0x002050fab176e0b9)},
+  {FIELD_LITERAL(0x004683dd6e015d9b,0x004d0823bc74839f,0x00a01c3cd4920759,0x00ae59d13d45c918,0x00b5f234025e93e3,0x009891d44914bcfe,0x00e15d7301c1a223,0x003ee4ec52730e56)},
+  {FIELD_LITERAL(0x002c42a617bfb988,0x00d5927ae19fb0ae,0x00e9a17dcc1d47c0,0x00f34d6691bf990d,0x0051f4035c68c9d9,0x005ad2c9dafca34f,0x009548bccc693c6f,0x0030ff5ccafef68a)},
+  {FIELD_LITERAL(0x0035b216eac556ad,0x008131ffce45030a,0x0055880e1e91c691,0x003cd6d74bfa2d9e,0x00894bed862d2f84,0x00d199188f2d1394,0x0066d921dce4f9fd,0x00c4e9f9b5a17927)},
+  {FIELD_LITERAL(0x003a5716941dbced,0x0098f1da07ae831c,0x00d8d9d9103d2704,0x0036c4baceb612db,0x00cf7b770e6cfb5e,0x009690b06494b3f5,0x00bf4ce48dcdfdab,0x0018f322cc104396)},
+  {FIELD_LITERAL(0x00533e87feb83ed7,0x0070223c6a37017e,0x00217c85c3066d92,0x0038cb61df18da75,0x0041b68d44298881,0x00df5423ef4d0cf7,0x0075899b6868f972,0x00253a1db676e164)},
+  {FIELD_LITERAL(0x004ce2f7d1c58fab,0x00a1058c95639483,0x00bfa171609ea627,0x0076feec3569e78d,0x00256ba5ee81d31e,0x00b63e200dcdf6aa,0x00a66d4a3d1b5399,0x00ac4d1661a6dbb9)},
+  {FIELD_LITERAL(0x000e739b16f7b032,0x00557da6d65bca3f,0x005d9461d09c76cf,0x00c5fefaf24655a1,0x00304a081880f114,0x00d7d0483715c455,0x004a7df8201e8c4e,0x0052640493e6f8e5)},
+  {FIELD_LITERAL(0x00384805fe525bce,0x00089f02908c001c,0x009e35e0ac9c610e,0x008726fa44478a6f,0x009f3a55c034ce7c,0x0020f70a06b59094,0x002110cee5a9582e,0x000af228e0fc0d91)},
+  {FIELD_LITERAL(0x009685fa3684c587,0x0048c1fbae3c9b70,0x00e2cfd0368bf9b4,0x00f0d5800f100b0c,0x009f1f673aad7f05,0x0072b68cdf40be14,0x0043216b7232feab,0x00c6e0cc7efb9a00)},
+  {FIELD_LITERAL(0x00e6421c2f0b38e0,0x009ff3b15209c664,0x007c672b712c5d9c,0x006ab1346445ab87,0x004f0f5d8728ed4e,0x00080b9080e8c54a,0x0078fa4c9d21ccf4,0x0020a853653e17c9)},
+  {FIELD_LITERAL(0x0086ac148816a0a5,0x00150d2bd8167c63,0x003c087bc58d7152,0x00cd7196454d7df4,0x00b89e49659fcfe8,0x008788a49a6152b4,0x00c59528e3007d4b,0x005d18905b8667af)},
+  {FIELD_LITERAL(0x0006aed6dcb92fcf,0x00cc5ebeef79f873,0x009f29b65d8e08bd,0x0098c66f6eefcdd5,0x00a14211ddb84b60,0x00168ebf512fe5c8,0x008f7a27acf9a862,0x0082a860ec0b7c5a)},
+  {FIELD_LITERAL(0x00d5a03b7edce1a0,0x00316f1e66114dbe,0x008b830f68066cae,0x00d1ffcf0ecd3473,0x004207f6b7158e51,0x007ff2ff7a114e30,0x0053b5a0a2ffb019,0x009b56fc3bb8f01a)},
+  {FIELD_LITERAL(0x00545accba2c36e1,0x008bcbd2882a0d73,0x00dcd8004ad2ceda,0x00ec9a79a2db91e4,0x0074cba9f190e931,0x00db42467e75376b,0x00b810f6f8fb9335,0x008648439d64681a)},
+  {FIELD_LITERAL(0x0080a3889c19a125,0x000710d58e71068c,0x00e97d3ac621fbed,0x00a0f3d3af2789ea,0x0033e33f3df20488,0x0027997987fff024,0x00126851536ef18a,0x00399d389d920a4e)},
+  {FIELD_LITERAL(0x007125a136d129d8,0x00eeee05633a3421,0x006d921f979a00e0,0x00981a49e45b25ee,0x00d3076d8286817f,0x005e9c8f0e2fe320,0x00cdc63e22a758ba,0x005671bc8356b784)},
+  {FIELD_LITERAL(0x00fa611b264d95f8,0x00b9bb94ec5c16d1,0x00d0d46d980589fc,0x00bc37faa582fb35,0x00f0833069ad8716,0x00b8f63578b32312,0x00c4756888591cc8,0x00422a804c1e5ce6)},
+  {FIELD_LITERAL(0x0083b78cbc23ec67,0x0038230370a59692,0x002583a14786765b,0x00cda43f3737d5e9,0x009243ea57e1148f,0x0056e164236e223e,0x00b9b35b49a066c0,0x00ded6b6d0a966c2)},
+  {FIELD_LITERAL(0x008a5feb0b9ed401,0x003e43470a6e6caf,0x0016b759a55b796b,0x00089ee6e5c22e84,0x0037d274f0055738,0x007052b3ca0d2dbd,0x00db5f01915d2739,0x0035f4a29cc2d6ac)},
+  {FIELD_LITERAL(0x00c251e8e577f30e,0x003dc307616d8ddc,0x00ee7d60026695c9,0x00da44756dac33e7,0x00c280f672a96798,0x0008a69fdcab3d9b,0x006a461f479c4d66,0x005da474f99afd38)},
+  {FIELD_LITERAL(0x0071b8b148f9d304,0x00db42b464afea53,0x00b72a5b46cdde87,0x0098c099a03eff92,0x0090131b3c5f814c,0x00c04e595b9fec70,0x00fcff762dd1fe17,0x001f44ab7ea4fc15)},
+  {FIELD_LITERAL(0x0022f2de59a1f156,0x0054f32b81773b0e,0x008808c21537bd19,0x00fd7713a25f096f,0x009ce6da65820b04,0x000f8ffaffa34d1d,0x006b31f4acb4f1c1,0x003af2273786f4de)},
+  {FIELD_LITERAL(0x00a92c393604e673,0x00a97a6dd2b3cb4d,0x00a3a99845566ad4,0x00db885bcf0f9acc,0x00151514b343d957,0x00e25a7fe8034c80,0x0001a317bdfb2d11,0x00d8ffd51cd84ec8)},
+  {FIELD_LITERAL(0x00c252c61c67157c,0x002473dadb5f13bb,0x004d738a4abdb280,0x0010045fb748a65e,0x00a201c5e229218f,0x00171ea88659852f,0x009fc336783d560f,0x0047fd098fae4f68)},
+  {FIELD_LITERAL(0x00a33ac97091359b,0x00282356e972a6b9,0x00b8850007ebaaa4,0x005733c72f5534e1,0x0011786143376586,0x009382894cec6e9e,0x008fe1dcdffd695f,0x00fea06e5c2f9639)},
+  {FIELD_LITERAL(0x0040238f6c109f9e,0x00fae916ee6039fc,0x000b8a7d7c8dc3f0,0x00339efa0aec98aa,0x00beab1c0eb17a5a,0x00b294c6bba4702e,0x00439f4d78566772,0x0048bdfb50d9c1bf)},
+  {FIELD_LITERAL(0x0077bdbf54b0208d,0x00e1c467093e2292,0x00b96cecefa78e9b,0x00e89924d2c90664,0x00202ec34eeeed66,0x007c80e8eb0a4b4f,0x001583ac4e20de11,0x00de69f7a15a3215)},
+  {FIELD_LITERAL(0x0075e933fa2026d0,0x002c81613d34f87f,0x00839760035063e4,0x0023096d7b7f1804,0x009aed5685aae480,0x00f79fd96fc4c53b,0x00cc14a57186d2dc,0x007ddd4a3a43bc36)},
+  {FIELD_LITERAL(0x0050b8e7ef393522,0x009e7692eb47a7de,0x0064c7da68b9e245,0x004c9cad19e1eb23,0x00201b4053343175,0x00568389c1b58744,0x000e3936b1adfcc3,0x0071666512e2fe60)},
+  {FIELD_LITERAL(0x00243efc75e62cfc,0x00121a8550e02772,0x0060222fb647b9f1,0x005fdd2796a2a91a,0x00bb08877bd5263d,0x004297d33e8abae2,0x00a1ba7fa6df30f6,0x00955d5a928fc9bd)},
+  {FIELD_LITERAL(0x004a493265b3b271,0x00cedc6e9abc3f6e,0x005f672991e6c979,0x00457875775af4c2,0x00baa5ee62629e5f,0x00b68db08bbf4070,0x006e5ca9c502f519,0x00eb932cd52cfe91)},
+  {FIELD_LITERAL(0x00d72d4521796b14,0x001fc592f97eefbf,0x00a4c72fabca1c4e,0x00b1b7fd98455bcb,0x005a8ddcf8334720,0x008d8a2dc80d6bf3,0x00a1820fe5c3b7b8,0x0044f360d6ccf19e)},
+  {FIELD_LITERAL(0x00d7f408a0e83320,0x00981bb5062354a9,0x00cda84d94b72c9e,0x009f684f63421afa,0x0051bc23ee39990f,0x009a6b79061868e3,0x009138d4be465be0,0x00be4e2af30acd84)},
+  {FIELD_LITERAL(0x00c11d73ab7b8b00,0x00d9c6bffa5a8059,0x00b02ba1a4b0da44,0x0005beb199d042fe,0x0010310cbec90f73,0x007df118061c6a5b,0x00dc684a4e36e6a7,0x007b5b2b04488f95)},
+  {FIELD_LITERAL(0x0077b8dacd41ccb1,0x0083a64c5dfe505a,0x00fde54ca3d7df7d,0x003aa1e22fa12343,0x00201e4338df279b,0x00b2c2c3f0cbdab4,0x005f72daedee8a3b,0x0075bf8c205153fe)},
+  {FIELD_LITERAL(0x0012c1ff8f0b2a9d,0x00066dc806b1adf2,0x00e2658db9f00d02,0x000a141b08709c5b,0x00d686e5528a87e4,0x00f3a0333f23731b,0x00621f34ca3a8070,0x006fd87012bca353)},
+  {FIELD_LITERAL(0x009403473c2b72bc,0x00f5ab2227abb496,0x00256e38ea8b370f,0x008cd6a42b8f04b7,0x00962f26d0c91c1f,0x000a2c264d98c763,0x00076837adf4dc1c,0x0018d33c17050dc3)},
+  {FIELD_LITERAL(0x0099a619e1ce68e2,0x00468ad9535507bc,0x00a9567835e5cf5e,0x00907d656deaeeaf,0x00d77f6d55262361,0x000dcfe626e4ab22,0x0010973e28b5a6aa,0x00911e60c85f6f4d)},
+  {FIELD_LITERAL(0x004a4acfc1f97877,0x0098d82e2a7b7d5c,0x000b37bce062aa25,0x003912542654b194,0x00542ca0b34d3d94,0x00d88679b80e0ce5,0x002b3ed4602ab1dd,0x00ec1581a1d2a3c5)},
+  {FIELD_LITERAL(0x0090712b45dac7a0,0x00f5d7627cc11236,0x00f51bccba5dc50a,0x00c375bdc9957063,0x0004f420a4a00849,0x006860c3afab2f15,0x00c809cf28d9f1de,0x00d246d9ad778cdd)},
+  {FIELD_LITERAL(0x0083e6acfc1708ed,0x00121a4ee5d99c21,0x00e0a337de8a52d2,0x000f27df629fac31,0x004b81e6066b09dc,0x0028cffceaedd100,0x00cbf7250219b37d,0x005285fb5d9e0d33)},
+  {FIELD_LITERAL(0x00c2ff08a31c710d,0x0054b38d97dfb25d,0x00de4f8e38f9589d,0x0038f559a3a7eca8,0x002acc37cbb0823e,0x00d16cbdc5085c6d,0x0098d362e61f7a6b,0x00140d9f01c30f84)},
+  {FIELD_LITERAL(0x003a4b9170d3eaa6,0x0013770395279592,0x00b74edfceb08de0,0x00c08a03c5a609b3,0x00b7a77b89fc665e,0x003515a4436d5768,0x00758c3fa184c7d0,0x001b45b5e0d3bd86)},
+  {FIELD_LITERAL(0x009f14355100dea8,0x006dd03991fd1dcf,0x002f19313db707cb,0x00d0502a10ca6013,0x00b5fa40727ad74d,0x00299b4e1555b981,0x00e027a1d1626c6d,0x0038ab7dc4d44daa)},
+  {FIELD_LITERAL(0x005c47cda00e8877,0x007d0c8415dbfab8,0x00bebf5bf774dbf8,0x00a75d2a22a791e1,0x0027ef18f5775be4,0x006fb37699b3679a,0x00c2ebeb3946665f,0x00b2f63f5a3f54d8)},
+  {FIELD_LITERAL(0x00c0a78dafb3327c,0x0047fbacce940c3f,0x00e93b4ac4751939,0x008b76c7b5a9cdfd,0x00b46b3fb35da531,0x000580778567140c,0x00fd9696185b8cc1,0x00dd08b8c4e6b38d)},
+  {FIELD_LITERAL(0x006a4e23cf278981,0x003010455a840782,0x00ffd28207a7acc1,0x0047699f42df9b31,0x00dcdb81e981dbbd,0x00dd81d6b91963b4,0x008bc499713b4e44,0x00bcae008a29f2e4)},
+  {FIELD_LITERAL(0x00a138c1154dcd21,0x00d5c0218fd80baa,0x0035977e5eb576f2,0x00189b2fadf0244c,0x0087a3e75d464bf3,0x007ce248fc21c441,0x005891b7403398f1,0x002146ec1429bb71)},
+  {FIELD_LITERAL(0x00791360604696fe,0x00ee608b1176868b,0x00b9152a109426bd,0x0090c5bcc52d0dfa,0x00ca15bcbea7e192,0x0001eacbdb74f510,0x00488f629923aed4,0x00aeb789a3ceda06)},
+  {FIELD_LITERAL(0x001e3ede5281da82,0x00aa2e4fcaf32dc8,0x00b5c3ba7d701de5,0x006b3bd2d1ea82da,0x00e8a11bf751ecba,0x00c2d5c4a8e72a4c,0x00db3cff28257f9c,0x008973f7547751dc)},
+  {FIELD_LITERAL(0x00cd01bd9f8c0025,0x003c7c0d538685e9,0x000c19c02a6348ba,0x00f6ecb3f279cace,0x00d72c212ecb62bf,0x00472fe03e879923,0x00515ad320467bd5,0x00e9c05756a02abe)},
+  {FIELD_LITERAL(0x00bde04e14827466,0x00a64477cf37cbad,0x00c133b383502478,0x00ae6ed49ae3b235,0x0082d5189b392830,0x0045a89ca00dc206,0x00a7d31c23b4bd2c,0x00faf43ab55b0809)},
+  {FIELD_LITERAL(0x008cb09487567f20,0x00c67a347920fc24,0x005bf7c529a57751,0x00d9c321514e893b,0x0036981548eef713,0x006220d3028a406c,0x007300dc5d07b011,0x00c4fb4a9db67162)},
+  {FIELD_LITERAL(0x00920263d80df1af,0x009039c2c5f32220,0x00d9836b082b4da6,0x00abdab5eed6b186,0x005da5ebbaa3df49,0x00a56d011f05b4e8,0x0055786a88d6a262,0x001c41501c3412ab)},
+  {FIELD_LITERAL(0x008c421a597a45e9,0x007bbd137784aedd,0x0084d791f89c164a,0x0079bfdc5ba98221,0x008691e3dc0e7a7f,0x00cbf36fed7181d7,0x00c8cedb6f838b45,0x00e1e2281b24fb91)},
+  {FIELD_LITERAL(0x00afeb30a2db6472,0x009627beac706056,0x004e1cc882bff593,0x006f1c39f7202884,0x003ce0b71c4adbb5,0x0072d967ed41aaf0,0x0043e9475d284ed6,0x005400e4b223bd19)},
+  {FIELD_LITERAL(0x0043659eb6429cd7,0x00d7884f638040e0,0x0049ad61c8b9c610,0x00f170b57d686f93,0x00bb8444ee59df1b,0x0012190ec4c53a35,0x00be4fd23986f7b1,0x00cb9efabae6c70a)},
+  {FIELD_LITERAL(0x00b27c57053b39d5,0x00d0c9ab2684d511,0x003c69a8fc0db4d6,0x003225132813dca9,0x00f456f351f738d7,0x00880a34d17c886a,0x000ede23fab46aae,0x00a19334a18ca33d)},
+  {FIELD_LITERAL(0x003305d75422e934,0x007743e7896eab77,0x003167ddd99072b6,0x00a76dc3afcc3ec0,0x008fade22130f3aa,0x00957c8483d0b3be,0x006d89cccf5dd41c,0x005ae02af67924a7)},
+  {FIELD_LITERAL(0x00f84f9a8e6a9ddd,0x0088e189bef28d39,0x00e940d8a0acfa1a,0x008fc9e16c2c4a2f,0x00f8f101f5053c80,0x0058fccd1587ed99,0x001d5edd4a66a517,0x00a7de82479b23fb)},
+  {FIELD_LITERAL(0x00e8b920516f36af,0x00a8d6bfa1794d6a,0x00295a0ea8661d3c,0x00406fb67554bc94,0x0045c76c7bac7092,0x00d839d6f8194c5c,0x001ee6edfe0752a0,0x006f0c203bb47738)},
+  {FIELD_LITERAL(0x0073d002b23ab455,0x00bf05328d5a9d46,0x007631d7142e5174,0x005b599694f0ba0e,0x00aa4bf22de0264e,0x0071be645615f5a9,0x00668eba72be560e,0x00dded6fa13f5f28)},
+  {FIELD_LITERAL(0x003e8998b3d3c46d,0x00e87a9142f0eba7,0x005ca54eea36fd1a,0x001f3c45fc7e3afe,0x001010e0bbeee0ae,0x006e842645d89bdb,0x004144dcbd4a303a,0x00c69b09fac158a6)},
+  {FIELD_LITERAL(0x00218c2d486b5e1b,0x006eeabea6e84081,0x00c62b248b193e7d,0x00a98818de7c1f7e,0x000f85ba19e429fd,0x0052987b4e53d0e7,0x003eec2658ca1652,0x00160e704dcee359)},
+  {FIELD_LITERAL(0x00517611fe966aaf,0x0056cd0801ec02d7,0x004d9390d1eb1eef,0x00a64fdb39dee89c,0x00f08cc33d9dece9,0x008d1f803598ef63,0x00e04823da12bc2c,0x00c304b92f7d7a40)},
+  {FIELD_LITERAL(0x00ab0ccf612ff7f6,0x00d9e28cb1c4951e,0x0096fe1802c03778,0x002c6f19f636c82e,0x003d7e463eafb17c,0x006d3f46ec5b23c3,0x00ba320c8f07f4f1,0x00457889ccd86109)},
+  {FIELD_LITERAL(0x0089e10fe416d2b9,0x00d7f4b0e276410c,0x00b2826b34d83886,0x0044b7fde12a32f8,0x00ff6b36d114beef,0x004295a62030d7b7,0x00797b9b378f69f0,0x0061d86652ef9059)},
+  {FIELD_LITERAL(0x00218a3ff50fc1f9,0x002b470cab81176f,0x004a96053a5bbdac,0x00c8ffeadcbb3083,0x003b6cbf39384ed1,0x009b4e5653c3d56f,0x0029a11666309a9b,0x00a4803ea584e5bd)},
+  {FIELD_LITERAL(0x00c9c2beb9c66dc9,0x00b5eabdd6a56020,0x00acfdf55d2a5c15,0x002c917a0d861c95,0x00512bd3f141bfae,0x00289cd9817bfb5d,0x0038a8157ffd0094,0x00a6a6badc7b97de)},
+  {FIELD_LITERAL(0x0066c3cd64d9fc53,0x00a2f5153a54b31f,0x00303968569de064,0x00dfc758dc42c448,0x00409a945ce9ab27,0x007df99fa6822dd3,0x00049edc7be06fcc,0x0021cc1f91ff1cd3)},
+  {FIELD_LITERAL(0x001abf12ffcefe47,0x00e83b756178b89d,0x00503f3510d8913d,0x00c1dc2f99fad8a4,0x00bf0ee71629c68c,0x004f594d28391036,0x002d03010b81a053,0x0050d0f83699f0fd)},
+  {FIELD_LITERAL(0x0049e540ea75811c,0x00731accb11a746a,0x00a12e98e1649331,0x0011df55a0c4c73f,0x0089b0af295c6b12,0x00f9bd150f2b85ef,0x00c287fb3b8eaa3e,0x0047a5146ef33850)},
+  {FIELD_LITERAL(0x0040308e449eb344,0x0049f4eb1527b962,0x00b412d43c36e10e,0x006c1751e504e415,0x00e619ccf7fec4fc,0x00f8455bec00a638,0x00b381ed68cb4163,0x00884fab461e1e37)},
+  {FIELD_LITERAL(0x0038b2f62ca0bb7d,0x003457511e7ddf9e,0x0085c0076b8e7e88,0x00c73c9f30bd0913,0x00b6f9f0118f9ae6,0x001e93b502187a20,0x0069088c592640b0,0x00619cc6088e46cf)},
+  {FIELD_LITERAL(0x00345e739445ec69,0x00c9f6bd96686959,0x00cfc0917613e00a,0x00caffbd5092eaeb,0x009af11b0aebc3ee,0x00d512b9705ad513,0x00397533c6ad785c,0x006e1f58f3cb013d)},
+  {FIELD_LITERAL(0x009fd396c6d2b52f,0x008947948082dc42,0x0061c4fc580581c3,0x00f11f673b260b55,0x00ac1ac4d128efc8,0x004c68ae3712405d,0x002bffb4bc021824,0x00f129340b3c6e0b)},
+  {FIELD_LITERAL(0x00fd9aa2a649a9a8,0x006a468b4ae66937,0x00190b571b8cccd1,0x0050a53c347d4cc6,0x00486b5c2cb8701f,0x0089afb9f56be849,0x00b5ed3250eddfc4,0x004f19a26d21807a)},
+  {FIELD_LITERAL(0x00c615bf1ac7de34,0x008f3820363a3963,0x00de9c24f8f43097,0x00e9e912f1b232d1,0x008f659575605d3b,0x009c16757ae1cc4e,0x0095c740558b5dbe,0x004bce581851ec44)},
+  {FIELD_LITERAL(0x00f800d0e851c4a1,0x008d7fd200642638,0x003a29c92a47884c,0x00d0c630c6897334,0x00dcd5734c143176,0x00783820f6ab0f16,0x002b068be18785fb,0x00dbe6c967ccfdef)},
+  {FIELD_LITERAL(0x001b70f40ee4ea80,0x009bbfe172199fed,0x00d7004789b5ed6e,0x005105635979fc55,0x00c00153d2acf8c5,0x00e5a44ea1f4d587,0x0028d24c9babbfc8,0x0004aabebde3152c)},
+  {FIELD_LITERAL(0x00e56a98f0f7058a,0x00d2ffc1bff08bca,0x00de9d548962cdf2,0x00aacb8742629f3d,0x00766e114df92518,0x0021e9d8f38f57d6,0x0077db22e97fe83f,0x0090a3977c384e36)},
+  {FIELD_LITERAL(0x00d92681acffa1ff,0x00cf77f3644a7eb8,0x0043ae28955fe958,0x000831fa2915dfb3,0x005e499df9319e69,0x00eb72b09903b18f,0x00412fd40275f48c,0x0038bfa693a69f5a)},
+  {FIELD_LITERAL(0x00471c510ea7ca2f,0x00c76a677482f703,0x00b98c216e86c81b,0x0037007aaf8b4bfb,0x00aaa4092551467a,0x00e1f6b039725779,0x003a042bb4f120bc,0x00a3deff9569a98c)},
+  {FIELD_LITERAL(0x00e788d337da953d,0x00143845146708fd,0x00942938153cf4ab,0x002f6c85b2a8f4a7,0x007a69b8b85d5777,0x0023768f0321e385,0x00baed43f23835ef,0x00c546a0fae9f724)},
+  {FIELD_LITERAL(0x001828ca8dbf7d1f,0x008c4db0552ce563,0x005bcb7235eee507,0x00c1ce20216384f8,0x00916768ebcf4858,0x00ff8df3b1152131,0x000dde64edb05f29,0x0022f276a6faf176)},
+  {FIELD_LITERAL(0x007eafca2811305b,0x000478b3e8894ffe,0x00d388ce8ef4b40f,0x00bc14446b6d90e2,0x00777fe53d4c9c05,0x00ffdda8dd82dbee,0x002e60aa24245008,0x00504c7a09154422)},
+  {FIELD_LITERAL(0x006a325c68d5553e,0x00de675d15285c60,0x00fdf1ae99db215b,0x00169f3b66dec668,0x009416aeb57d2e72,0x009ef8ecba13699f,0x0068014b3b057b4f,0x0093cc74aae08999)},
+  {FIELD_LITERAL(0x008c838b59d48154,0x00b76b233cfc805e,0x004c08b904feff1a,0x005ea9ee1f730c9c,0x007ba3e00f72f08b,0x00d716e00e16752d,0x008b16b18f84c9c2,0x00090a9a06c90851)},
+  {FIELD_LITERAL(0x0076e856bc802517,0x00803b04503694a5,0x000526c03db9b30e,0x00fa928cf94af146,0x002cf91bc12707c4,0x00bcab32b1d09eec,0x00099fb77e94d356,0x0002c0c3d323d310)},
+  {FIELD_LITERAL(0x00ef304f062e56af,0x00cc22da3b22e5e1,0x0023cdb752e94781,0x00fedb80d8738538,0x00b9ccee89d78130,0x00841de211e6190d,0x004389029b6b3000,0x00d9c12f813b3528)},
+  {FIELD_LITERAL(0x008176bc25ee6649,0x00020f5e9277e6ed,0x00d32ed33fbf55d9,0x00c4697b8e4e7821,0x007f27a9cc0119df,0x007779902ee83348,0x003303275189b544,0x0086f8f051a87d44)},
+  {FIELD_LITERAL(0x006d0d765e30eb48,0x0042b8124365a18f,0x00c57c5aa95736ab,0x009e6136fce580ac,0x00a095634cc2261f,0x002f3356e3d9400a,0x002b91d8d54610b7,0x0073ddef3a7aa6bd)},
+  {FIELD_LITERAL(0x001041cbbf605e76,0x006b1bd4ad06c568,0x00fcc9d790aa1b3a,0x00229c636ab6ba57,0x005d904e7b4a2b9f,0x00b092b566df407e,0x00aa9e63d08dab68,0x0068077abbc8984a)},
+  {FIELD_LITERAL(0x00679167bf75a682,0x0096b2b9c05fc9b0,0x0006db144ec47e5e,0x00b8710f41e16e9d,0x004f1265e6b865e0,0x00c6b33081d51631,0x00036ef9f7171b27,0x004deb4493fd3281)},
+  {FIELD_LITERAL(0x0088f60826f08dde,0x0099f6c492dc87ad,0x00f0fc063e7dc836,0x00e5d9d74eb15c4d,0x002728df57c62537,0x00c3d2fb539d9a13,0x00c64b39d3668eb0,0x00c9d3b08944112b)},
+  {FIELD_LITERAL(0x0092780169bbff9b,0x00e02a7bcddd1bff,0x005efa91e2691609,0x00cd18aaf4fd306b,0x008dc112d250dfc0,0x008a933b48249bce,0x0070694366219aff,0x004a7335585f1bfc)},
+  {FIELD_LITERAL(0x00cdbc1db3dd7acf,0x0012a8166662cf1f,0x00cdb53494c1d566,0x00b532c368b0823f,0x00ce6db8a3e6ac6f,0x007dfab115ee5e8a,0x0076dd9ad055d0b1,0x000509af9d2390ea)},
+  {FIELD_LITERAL(0x00f7fed81253752a,0x009e0a84c5487b1a,0x00fb49d0e0d8e000,0x003f149baa418f77,0x006a509dd1a99a04,0x0084afca58b05ebf,0x0082c9ae8c9628d3,0x00b60fe300249f60)},
+  {FIELD_LITERAL(0x006511809d5a8e10,0x00e587d134716d02,0x00192465dc29d8e8,0x00d421f4a4d7fc4c,0x00973866ad0d3215,0x004a1c47c4f2f1b4,0x00b96f6f61c99e37,0x0096976cdc48a53e)},
+  {FIELD_LITERAL(0x00477e8534857d07,0x00aa450b0704271e,0x00c36c7792c55dfe,0x00a189c47bebd66c,0x0034a55dd29a4e6b,0x00c429d492e8f918,0x00aaa2f8ee13ff8d,0x0083a9ed0790318a)},
+  {FIELD_LITERAL(0x004fdb77f764f0f6,0x00c51528f8896146,0x00867ef2c7f8bac7,0x003f51be39d8cd23,0x00bec09af03a2173,0x00cd678b2034406d,0x00ec74618cb3c0aa,0x001431e84fa795b0)},
+  {FIELD_LITERAL(0x0076c8f859b318bb,0x0001c9d2a5063b8d,0x00c336fb40d163a7,0x008952974e42fd00,0x00e0a61e6da7891d,0x009153f3353ba46f,0x002c1ab122fe20c6,0x00d8ab843059c472)},
+  {FIELD_LITERAL(0x004b34dcfad5c3b1,0x00cf0adffe60e3da,0x00d0a0730ec99ebb,0x0038ade81621af6a,0x00442b0f8b8fde3e,0x00253f7cd15a9741,0x005dd99e6243ba2d,0x000dd920f8ae3d12)},
+  {FIELD_LITERAL(0x002890b0635e4f3f,0x0070146ef3757a2c,0x00c49b4c31d4256b,0x007976cf1260e548,0x0011d814d3c2b065,0x002416960c3c21bc,0x00d13af311759f81,0x0096ecdf001de0f5)},
+  {FIELD_LITERAL(0x000089fa4bbb31fa,0x0025d9208de8497e,0x005d3fadd7240daf,0x00b43f2be9692a69,0x008d3b6cb0cd8241,0x009fc990da3c22ed,0x00b5bd1a8b868e6d,0x00840e6d940fa589)},
+  {FIELD_LITERAL(0x0000950406fb8c3a,0x00ec25a9825c5667,0x00bd5d61aff17f92,0x00a8f1ea07b98212,0x002e90a6e6b39a96,0x008829f2c39b098d,0x00476d2a0a82e7ca,0x00f5179b109e4dd9)},
+  {FIELD_LITERAL(0x0017cb0c05428f0a,0x006c50feb5115a57,0x009618ae8d821c0f,0x003231215811f43a,0x00cf9d06e4106d30,0x00cf2226252584fd,0x00d7ef3f1d4090f0,0x00930cf4ea0fc1be)},
+  {FIELD_LITERAL(0x002bf970a65532b4,0x009dd5c9478dc055,0x00eab588a82121ab,0x004a5f2404c29a03,0x000f829323118631,0x00877af71b31993b,0x004e66035ec2e96e,0x007369245020cf08)},
+  {FIELD_LITERAL(0x006bcf34cf1da2e9,0x006a360381087d83,0x003ccb365fe9bc2c,0x00e9de135e8570d2,0x009503e7fdc60f70,0x00f8f268b16bfa0e,0x00d1613c7aa9b85f,0x00796ecb60bddc2e)},
+  {FIELD_LITERAL(0x007c6bbf0d897e47,0x0019afdce8e76fd9,0x005aa6074e3d7c98,0x007f863e537f091f,0x00f192f2189c578b,0x00608181cb69e5f1,0x00d7c2b4a2e70d70,0x001fe4b797fa5d68)},
+  {FIELD_LITERAL(0x00994753d35e0366,0x0085e69517e6b65d,0x00ad8f27782640d7,0x00f45269bfea412d,0x00a873c60f45ebb1,0x006c634ae82a66ab,0x00a83349b8061e8b,0x00bc49f7a07d0f35)},
+  {FIELD_LITERAL(0x00993a5b94e69bb7,0x001f51638e58924c,0x00a923208390ac13,0x0052e7fdd1324b68,0x00ac6df208818031,0x00ae725c3127fd8f,0x00fa67f0e7650128,0x00944051385becb2)},
+  {FIELD_LITERAL(0x00e36184f01ecf9a,0x00910c664eb12453,0x004890f9d3869922,0x009da75fdf980c4a,0x0061cb279550795a,0x009b9a795ea739d3,0x00f7a98476d6850d,0x00de4503fe92b8e6)},
+  {FIELD_LITERAL(0x00f0c60b84f74dca,0x00480e3776a37320,0x00245094fd683260,0x001b7eac60dfe4a3,0x00238da15557c524,0x00bcd7b99c733db3,0x00fa308493ae188b,0x0039895d2f6a4c85)},
+  {FIELD_LITERAL(0x000036fdf7be8124,0x00b4778d9287c391,0x005921a969887fd2,0x00c894ee5ecba43e,0x00fffb4868de5a9e,0x0029b6042f5059c3,0x00891d2c658546c1,0x002731d6ed08d4c8)},
+  {FIELD_LITERAL(0x00d15d2fc5cad83e,0x00835846953b1a88,0x00f23f96f896670c,0x00d54153278e8a7b,0x0091034667a81870,0x008b2a1dd04545b6,0x004df7526cddbe39,0x008a300265cef660)},
+  {FIELD_LITERAL(0x0081992e9134de81,0x00469a7e386496d0,0x00ecc8f371774699,0x0096dd6c45aae5c0,0x00870f6903324f5d,0x0022c155415a9630,0x0081cc295f37bbf6,0x0095a8d43146183a)},
+  {FIELD_LITERAL(0x00b239196193d408,0x002fb2dd65b685e2,0x00bccca1ed059f1b,0x003ae3f04d9b2df2,0x008ea7ef2ccc2927,0x007bd4011d9a6562,0x00c2aabff07afb34,0x0036e567895a5a32)},
+  {FIELD_LITERAL(0x007c25abe5e6005c,0x00c9aaea796ae478,0x000c4ea71ef13972,0x00ad5be092688e7d,0x00134287898edeb0,0x0068b8bb542b5e88,0x00a575360e3e23ba,0x00a80f3d1e3164c4)},
+  {FIELD_LITERAL(0x00a02dc7257bf841,0x00f40f2aa36a1bbe,0x005c0bd5db94d4c0,0x00c56b0ca85ed7aa,0x00b124ca2745b968,0x00ec91d0c1c79752,0x0062c504d645d5dc,0x00a168920fa764a8)},
+  {FIELD_LITERAL(0x0080a50ab532f319,0x0048334393d72c16,0x0007c0859ec7f424,0x00eeb898d1042755,0x008f9276f58c65f0,0x00e65291bc886aed,0x00663d431683ff06,0x00406c2ce131517e)},
+  {FIELD_LITERAL(0x00ff670c31c6854a,0x003accf251215eba,0x0040f9cef76abf88,0x0016580ebe899a89,0x00cd11b7fa0035db,0x00cccd7ae3970e99,0x000701eb356110ee,0x00bb156f3d49286c)},
+  {FIELD_LITERAL(0x005cc368e7e2f44e,0x00f5eb103f6379bd,0x0055d31a7a2c5466,0x004b1ea280fc8479,0x00da27e6496c7b5b,0x00668715e4ceb035,0x00c0ba300accf5a7,0x009161bc3ff8a9eb)},
+  {FIELD_LITERAL(0x0076c8abc4a2b368,0x00c82d6f16abab38,0x0088e6a81e6d3f23,0x0090a6cce34e4a28,0x00516a247264a4d8,0x0000512cf409fa82,0x00dffb9a256b4fb4,0x0008c32442d39e30)},
+  {FIELD_LITERAL(0x00aa90f639300e48,0x00c5fb93b46475b8,0x00145a99ea99c0e9,0x00f45e890d215082,0x00b650ada21e4a7b,0x002ff365a8863790,0x0096f29891a93412,0x00bb171074ed1e43)},
+  {FIELD_LITERAL(0x004d1d39043939e9,0x0009cf48fcb78b2c,0x00625082d4331640,0x00f5ac3040f57e31,0x0092a107d4199c8d,0x003210a132525fd8,0x00a95dd581407990,0x003ef64b3d5c3b86)},
+  {FIELD_LITERAL(0x00b79e973ff9fc46,0x00013f718325eb6c,0x0002833dafdc4f42,0x00917e1c81d1f570,0x00b72732f1ec0c49,0x0069f4ac0a882e1e,0x007356b13736435f,0x00d3ca75fa9b016f)},
+  {FIELD_LITERAL(0x00de7747130c93c0,0x0039610474de1939,0x00e7bef18428f657,0x002e3e59a0b31f2c,0x00b70e6e3b72df10,0x0052a24772ed2a0a,0x00d588cf0cf05e75,0x00e0e9cb0c79231d)},
+  {FIELD_LITERAL(0x003534d923aa0bc4,0x00d9ca105d0aedb2,0x00bd2e6512559a73,0x0020a4d56fcedd1b,0x00cbad5491a0598f,0x00d25c1476b454ce,0x002a3b220c16a070,0x00ca84fdf6130b8a)},
+  {FIELD_LITERAL(0x002e33322b91b3ab,0x0002fddfe6a3056d,0x00fd5aff6accdd08,0x00aa319866e561b0,0x00969eb4f54ade47,0x00f4bbd6c8ac40d5,0x00f58afb7a716b6d,0x001b2cc8731835bf)},
+  {FIELD_LITERAL(0x00361bb39e9d3c51,0x006c11ca515d244b,0x0029f6575ea5ca2b,0x00859b3e1d7ce194,0x00f818ada7e21ee2,0x0001428eb604c18a,0x00ce8c7bf7cb67b5,0x00422924207c0618)},
+  {FIELD_LITERAL(0x00b1d13465b01ac9,0x000a66debc66962e,0x0097268839b7ad57,0x0031628278618bb4,0x00a218c3d882e35d,0x00f78ee9b38d3fd9,0x00973bb906357008,0x002a4f1485d47293)},
+  {FIELD_LITERAL(0x00edac673b2ebeb3,0x00d34532fe45a6f7,0x00df9a9c05ed81cc,0x00776dab10ae3d4e,0x00c246e0e588a94f,0x00160262e76d2b0e,0x0012fd20fb1fd9ba,0x00cb211b6cd6247b)},
+  {FIELD_LITERAL(0x00bf5e20526d9ba1,0x0058c15aa65ae430,0x00559f28e21c9aa0,0x0045a003f0c862a3,0x004b6bee21324a9b,0x002fae1f30eb69f6,0x00cdecbe74a02b0c,0x0067e0db6c238508)},
+  {FIELD_LITERAL(0x003db64036a062d6,0x00f7f45316698085,0x0037fd2f6a9541b3,0x002ae06781dd650f,0x00c75fe0d75155ea,0x008a8e4d74b7a70f,0x001bb31204155be1,0x00390010630ff686)},
+  {FIELD_LITERAL(0x00f6d153e1cd4891,0x005f51abdda05398,0x00803965421f5e83,0x00a7f5fd888f146e,0x003a41679b210338,0x00e775b62494bda3,0x00e60774f1c8213e,0x00717a6ebb9f3379)},
+  {FIELD_LITERAL(0x009c080fc87e410f,0x0082264cdc529383,0x001d543e1ab67f62,0x0011fd362cdfac54,0x00b6fb9b57b58e19,0x005b2b7b4f063e09,0x008ada76b7a9253d,0x0034702bff5de179)},
+  {FIELD_LITERAL(0x00bc8ca25e456715,0x00fd91f72f8619a3,0x00e1adb356b9eff3,0x000b06fdf7990771,0x00c6c61a80fb9559,0x003aed7a17e60f3f,0x002cb8b88674b06a,0x00323f0fb7c32a73)},
+  {FIELD_LITERAL(0x007237ccc3d8cde8,0x0081e5d622960884,0x001a8375f473e65d,0x00f25817e99c61bf,0x00c30f597ffb7ae0,0x00eda36b5f272d37,0x00504c2046d78e33,0x00df9d36e908c6aa)},
+  {FIELD_LITERAL(0x00041cb835af708f,0x00bff595ab287b99,0x00a709ea2e3b36ca,0x0024dab6a7c42fdb,0x00babc2ec06289e0,0x00ac0d026cae57f0,0x007dd5552e4e4eb4,0x00b5df584fd68ef6)},
+  {FIELD_LITERAL(0x00372c6c01db6b6a,0x004080a9895faf9a,0x00a00cc09fe164e2,0x004c9008a360476f,0x0013236126a7138e,0x00a4b3fa180b8821,0x00dc940d79f5a34e,0x0033769828085aca)},
+  {FIELD_LITERAL(0x00420c47afd073a8,0x001caaa65d98196d,0x00726e3944df9334,0x0089529a3fffe47c,0x00b9b939418a7da1,0x009664a5d8d0e0c2,0x00e2bcc8b080277f,0x006da5f4367a960d)},
+  {FIELD_LITERAL(0x0069d5eabd2714f3,0x003a9722c216e9cb,0x003414dab729c9f4,0x00a81315d9b8fb90,0x00aa87d483e9a5e9,0x0096e66ec5fba1cc,0x007fe1bd9785c353,0x00a9d27eddd2d1ef)},
+  {FIELD_LITERAL(0x002144d98825860c,0x00fe2604301de852,0x00a70db28b689ba7,0x00873667f46169e2,0x006db6d14692fb94,0x0002563d846c3d8c,0x00084a89d73c9955,0x0046aa8884703fb0)},
+  {FIELD_LITERAL(0x001c7754df52cbbc,0x00942d3206baac45,0x00511a7fcc159a64,0x00b008f2774273d0,0x001e2f98168e4c10,0x00bc0effae409bb6,0x002cf46aea0f4621,0x00cab0e428ae23af)},
+  {FIELD_LITERAL(0x00740ea02a547c38,0x00507d715c4bca01,0x005d90c678df1ab6,0x00641101f19ca1eb,0x0039a810f921c0c3,0x003f62e8cda90415,0x00618248bd38fbf9,0x00da1b52b9aae414)},
+  {FIELD_LITERAL(0x001e1b4b6d1cbbd5,0x000b3b104e092bc8,0x00e37eb983730900,0x004e7e515ab0e128,0x0000b8ef562d39c6,0x00a63669e5870cbb,0x00d96cc496f4f42e,0x008f4cce10fc5657)},
+  {FIELD_LITERAL(0x00003f8df539d9d1,0x00f01ef00c531381,0x00a758d675f547dd,0x00492691ee10859b,0x00b7fe481b9f312c,0x00846bc5f6e6a5bd,0x002a3d8bac6d13bd,0x0065b7bd0d67e500)},
+  {FIELD_LITERAL(0x00ee7f951de22cbf,0x00dd0dde6f676c88,0x005c86227816386c,0x00ac063d5930deb0,0x00ab2701586e4d87,0x0021819fbd8696bf,0x00e4724ab48d453c,0x00911c20cdbaaf7a)},
+  {FIELD_LITERAL(0x00c1d3a803c18c17,0x00999ee7055b7fc3,0x00adca99eefe2468,0x00ec3039675def6a,0x00382516967961c1,0x00d9f3c5b195b5af,0x0082ab941cd02a93,0x008ecf450415cfe0)},
+  {FIELD_LITERAL(0x00f187fc0bf0c98c,0x00bf2be114af6332,0x003404b25d6780d1,0x0067177130505ca6,0x00eee4851ea5a368,0x00b2b0bd5d3e0ac7,0x00aa01752fd02b41,0x005c0f2655705ce3)},
+  {FIELD_LITERAL(0x0056d85a89219a48,0x008085a70d99a8e9,0x00932054816cae4e,0x001d434ff424c927,0x007d1c59991b62d3,0x0005ae72ec8266f6,0x000e4236481291af,0x005e05faa6289cc1)},
+  {FIELD_LITERAL(0x00dad4117b459660,0x000737ff6bd7bcbf,0x00f4162a06bcdc65,0x007822173ba3a451,0x004013be4ef6c861,0x000abd5677fb9dd2,0x001e051ba4b97c46,0x0054f56cb554f707)},
+  {FIELD_LITERAL(0x0074def94a7838ee,0x0015dc87031cdfb3,0x003dbe6ea3c43db2,0x00408fb3477f3f37,0x00099b4db968f9c3,0x00c580a04bf26403,0x0002107b21f5f7ea,0x00e78b7e6712279d)},
+  {FIELD_LITERAL(0x00c2b0070ca38b11,0x0016373f3f38cd43,0x007415614087d007,0x00e8afe46114aace,0x00f6fdf0e5c71d61,0x00359a4f6e9946ab,0x00011c895a23463e,0x0012a7396ddf0f1a)},
+  {FIELD_LITERAL(0x00c6725dec3f6d0d,0x00e63025896f115e,0x000dca952b9ef6f7,0x00ad5e33d6865cc2,0x0079d7e98ebdad73,0x00a77a9f244bd846,0x008ee6d331294b37,0x00ae4d2b158548d8)},
+  {FIELD_LITERAL(0x002f8b3e116bee8f,0x001a22757b8e22df,0x00eba017e7133caa,0x00c2abf39f96fd74,0x004af02b3d4c8d68,0x00a5895c70052a3e,0x00977fdae6bc0172,0x00f69323f1c04d88)},
+  {FIELD_LITERAL(0x00e4def7a834f2b8,0x00acd7f91052a400,0x0041ec8b4059eab3,0x002a6615fcd7fba2,0x0061f910bc0fcd65,0x002c6a184cb6dea2,0x00a16ea861a31f04,0x00266c90840b3f5a)},
+  {FIELD_LITERAL(0x0073c10c96039320,0x00023bfb4ba18a2a,0x001b3afff4a47dd0,0x000feaed5ab5a73e,0x0085927fb8804a63,0x0086edfc8687ac35,0x009c2f3d797bcf1d,0x004dcde49aaea479)},
+  {FIELD_LITERAL(0x00ded941799de615,0x00e3192c3cdb215d,0x0003cb07b46e4e80,0x00dd541e352dc258,0x007b78bf40d88454,0x0000af012df3847b,0x005a20e3e6b14305,0x004a96b0909321c9)},
+  {FIELD_LITERAL(0x00b7b3bed808bb38,0x0014839e01f28b72,0x00d12f3b798cfe89,0x001cbe87e4dda428,0x00d67e9e1d785972,0x00eb2f4bfd4e4d90,0x000fd8058789ddc3,0x00e32e3aa58ba1c3)},
+  {FIELD_LITERAL(0x00dfd1fbdd8c7140,0x0013f7dd4085243d,0x00aa54337dbb1e21,0x0043014ca198a7a0,0x00f29ed6ed98deb0,0x00993c44a043b857,0x0018a8416f943be9,0x00cc386eae87d952)},
+  {FIELD_LITERAL(0x002ac0a0685db16e,0x00d9acc2b8797faa,0x001903cdda47eb86,0x0075e4de5798572d,0x00ec08c9f8dc9e1f,0x00e063c867a1ebd2,0x003ef4a20abdbfbe,0x00278f6ba4aed180)},
+  {FIELD_LITERAL(0x0028eeafe4335c22,0x0075cc52e9a27eb1,0x00a881dcda77536b,0x00a5920a8a0f1366,0x005bba8d594fb8d2,0x00ec7ef84a2fed30,0x002dba35beefaea0,0x007104b60727b05e)},
+  {FIELD_LITERAL(0x0046050389967ff7,0x00c03b7e803d9d2c,0x00661baade038425,0x00d8db5de3430ba3,0x00f834eeb604ba0d,0x003a9e4d55d038dd,0x00745dd02bf94b9e,0x00552301b1d06843)},
+  {FIELD_LITERAL(0x00557b9f248251b2,0x002422aa8be54fd5,0x00afda6fe1975af9,0x00ea76870a029f58,0x00da4583e9280ff9,0x008705b44f9feae6,0x00bb421a02d8d3a6,0x00f30136781461ae)},
+  {FIELD_LITERAL(0x00a698225dec1b8b,0x00f17375799d75b3,0x00d090e7fdaf5d3d,0x006530929806d10a,0x00faaf6202d62841,0x00cc9a6e15974415,0x00aa549a95b60502,0x00ad1e49bff67cce)},
+  {FIELD_LITERAL(0x00207e8efd8ee561,0x001681f4906e360c,0x0017280a9f435261,0x0096c87c91052644,0x0052a007e34c3d3b,0x009627b995ba2d20,0x0071df09d2e87e13,0x0072354bd4fdf690)},
+  {FIELD_LITERAL(0x00435ecd5b74a400,0x00936c786bfc28c3,0x00961e625397fd2d,0x00ce37d3b36901ab,0x000bb6356a82e651,0x0051e23da50c5eff,0x00551c9a6f437400,0x00e9ac004b0a8954)},
+  {FIELD_LITERAL(0x0027ae01e1c91df0,0x005ff4514e9eaaa4,0x008acc0f1a7331e0,0x0024f8438cf40a11,0x007226c502a8d8ea,0x00485070c9cb36bf,0x00d69e739285b71e,0x0073213075242634)},
+  {FIELD_LITERAL(0x00ebe4f56af4d1e7,0x0061ac401a701eb8,0x0017bcd0340dc348,0x008e08889c2955e8,0x00c9cb7470f37713,0x00c899cba4896f84,0x00a693a807b5ffe5,0x00f485c321d317a6)},
+  {FIELD_LITERAL(0x00d12f9dc33b8c6a,0x008041700ec97c6a,0x00a2de5026f831ab,0x005f33bb937ff741,0x0070b0b32ccbe17b,0x00654005369f2686,0x007f75b189db3c77,0x0084ec3f871348de)},
+  {FIELD_LITERAL(0x005393f6a6f3dd66,0x00730e81e4d2f002,0x00b647b154508c92,0x0098c219edfe8574,0x006279aecc98ac22,0x00e36160854f21c5,0x0086cd79084531a2,0x0011d8987a774c6d)},
+  {FIELD_LITERAL(0x0088017266daef78,0x004ad620a8c34853,0x00dc0d98dbc113df,0x00e3e9d18bbf2c85,0x004ced3d30b91b32,0x00d1619925c96ac1,0x0065b5ba321c15ae,0x00bf53f55ff0751d)},
+  {FIELD_LITERAL(0x0066c2c1d48412ec,0x0087bebf82625f2d,0x00e13e40af59e2e7,0x00ad2ff28e560ebc,0x00559f9f33f3952b,0x009765c0ca6b1f44,0x00125bd17ec9df30,0x00122a00b6783e54)},
+  {FIELD_LITERAL(0x00e051d229e726b8,0x00bc9e9d3202879b,0x0014bb6dcc4731b6,0x00bb87ee1d34c952,0x000e41645421f2ea,0x000002064603a0ad,0x00393e3dfd41ccbe,0x00232b7f8ea3b69f)},
+  {FIELD_LITERAL(0x000e91237fe62e03,0x005bba7204ff5c77,0x005abeaa41a6186f,0x0051b25c707eeff6,0x00b53e25f7b5f363,0x0055cef5a8c91b37,0x00c27817180eaa1a,0x00783e015d7cc681)},
+  {FIELD_LITERAL(0x00f8c8ff8d90880c,0x00f3d0b5c00ad5a2,0x0001db9ceea28e9f,0x00c8f821e7dcb235,0x00a71776a18c0ec5,0x00b98f348aa8d707,0x00da250bed812bbb,0x0095633a9aa0f9cf)},
+  {FIELD_LITERAL(0x00491db0e5f49384,0x002ea80490efa917,0x00a0151052357b5f,0x00f57d8ad2c06541,0x00370b2474c8f81d,0x00bae667d692ee09,0x004f507c9e7c6abf,0x00dfdcce1440f845)},
+  {FIELD_LITERAL(0x0076ec6a3314b8d5,0x0097c74877c3582f,0x005c72280b0e5e2b,0x00f3fd386ab820fb,0x007c5cd0cd31c932,0x0010bf43a8228112,0x002a13f83167fa4f,0x002e84e2a735b206)},
+  {FIELD_LITERAL(0x003baebd57cd99c3,0x0038177b169cf682,0x00d5169256e44690,0x00c444e0cbc420f9,0x00a82289cd4fba39,0x000a95e1242965df,0x00b92623874e0f89,0x0025086202cd0d5e)},
+  {FIELD_LITERAL(0x00af0e0c1249cc6c,0x00ef9378860457aa,0x006b2e75ab82371e,0x00ed73fd42b45b11,0x0052e7cfd4a76a26,0x004195e5b479d2b2,0x001c62b16abc033c,0x00f3755c92061606)},
+  {FIELD_LITERAL(0x00ddb98bfa81a02a,0x003743403c5dd843,0x00eef782fa99afbe,0x00fd1b4952af3561,0x0026cebd1feb7e8d,0x00766c4e087ba697,0x004c473e82c4305e,0x00d28acd42da1683)},
+  {FIELD_LITERAL(0x00003ed4e4ac8a10,0x006e4190a8e581d1,0x00881548d2f9d599,0x001bd43095922aa7,0x006c7ee86ae6b076,0x00b0aaccfdc4c7ca,0x0089f1e550201859,0x0057d717913043b5)},
+  {FIELD_LITERAL(0x004d0959898ed883,0x00846433ef565802,0x0071dca3bf62195d,0x008696083898dcee,0x0096327ac8567732,0x00341d277fe2e17a,0x0030a965c8469812,0x0044ea7df6ec1415)},
+  {FIELD_LITERAL(0x003a6c99acc4d97b,0x002ccfbafee2d09b,0x00df4343dbeb013a,0x00c1a79602d2e6f8,0x008b9f5da57792f8,0x004da0a6cd95140d,0x000de0933e973b17,0x00fcb6a6a7aece9d)},
+  {FIELD_LITERAL(0x00246724ad975686,0x0038682db94bb297,0x009a246a2cf7c93e,0x00ca4f42889caca0,0x00e0b63d7002e97f,0x00dc09373e94ad8b,0x0010491b7818bff7,0x006193bbbf7a7ade)},
+  {FIELD_LITERAL(0x0016cf77079fbcb3,0x00fbe42342ccb705,0x00b65dd0dd058da6,0x00f640a555a84857,0x00adbd5c2a1e84ec,0x007aa2f493b64efe,0x00514440e9a0fa09,0x00f98ab65a3135d4)},
+  {FIELD_LITERAL(0x0075b1739947aa0a,0x00c881047855d22c,0x007f6c888f164177,0x00d1f5f8586ee6e4,0x00a0fa2d65018dd0,0x00aa69714b7c4d0e,0x006d16f6d402225e,0x00c357d27a8f7208)},
+  {FIELD_LITERAL(0x0068d104529c69f7,0x003f42de679e1309,0x00b33d833977b216,0x00f3885af13409a2,0x007a42960e62dc81,0x00e47530b2b6cca8,0x00d3e464ced02a1a,0x0087bb5d564a6824)},
+  {FIELD_LITERAL(0x001906d21ae9a347,0x003617227cab9fe3,0x003aa3f7399d8606,0x00b63747c91c5be6,0x00423a5ce4b6ffa2,0x00115c5308607bfd,0x00f2cc99b080db9d,0x00c894ab74e82b7b)},
+  {FIELD_LITERAL(0x0007d567a2d328fd,0x00c802682c174b00,0x00d5d7d5537c58a6,0x00ff522e8984aa6a,0x00d2607b8a95842c,0x00c015769bc4dedb,0x004c255cc47c9e08,0x00e15362a482dbed)},
+  {FIELD_LITERAL(0x001bd55f3941e1be,0x00cdbc5bcae5724b,0x0031448f81e5fcf4,0x00ffd74283edc6cd,0x00f185d49899d0e8,0x0066049de740789e,0x009253715c2efe54,0x00a2d2fc1dd27034)},
+  {FIELD_LITERAL(0x00c52dc96c64cf98,0x009d415b1121befa,0x008c6a31c7b68e7a,0x0080068943c766e8,0x002d7c4b06984b27,0x00f8180b58f934c6,0x00945961a2ad5149,0x004dfc38d567e3cc)},
+  {FIELD_LITERAL(0x0002b6c888b0a29f,0x000b57198d0d8e4a,0x00779334413abb5b,0x0048c5f74d313173,0x00adc9759b1fd9e1,0x009d0e876d0dd297,0x00445dfe38b14cd9,0x00a4681c7696ade0)},
+  {FIELD_LITERAL(0x00af8619f709a468,0x00168a892aca8452,0x009bbe41c7940b9e,0x003f38f2a44877ab,0x003135749d745b5f,0x0071206fcf79c090,0x007d4f05865c0a42,0x00641c15e4034527)},
+  {FIELD_LITERAL(0x0074df3bd0b04d1e,0x000faad283a209dd,0x0033dc35fe936588,0x00e4541ce33a6e41,0x003f4ab60fc37171,0x004c471129427672,0x009ed0c56dffd540,0x0025fc06cb866d59)},
+  {FIELD_LITERAL(0x0065b620170bb315,0x00823f0bc6889ff6,0x00565a9fef483e7c,0x00115f277063cfc7,0x005ff490b3e0a5ce,0x004a81ab5c53e01b,0x004d814474ee2ed1,0x000629ee178b8870)},
+  {FIELD_LITERAL(0x004e52c9c1cecaa6,0x002f730097fe709b,0x00dd48435476b28f,0x00d5bc9915c82c44,0x0024a640208cd8df,0x00242caa3c422c3a,0x000b76c229c8f9e3,0x00a5eb5e4ecaef8c)},
+  {FIELD_LITERAL(0x00269a919659d7a4,0x00a6e108bdf108f0,0x00ce950c093cf547,0x004f0f7c927f8e1c,0x001eae459bb3bad4,0x00628ff9ae2b71d5,0x0076521c235edafb,0x007d64d68bd6ad46)},
+  {FIELD_LITERAL(0x005a34bcefbd8a76,0x004171f66be375dd,0x005e1cf36f933e22,0x00fd9db940cae876,0x0073021f1a1a7724,0x00c34a18c2fdc8b5,0x0049ff29b5a4adde,0x00125a60a1368483)},
+  {FIELD_LITERAL(0x0098d16413b2f9dc,0x00d92d1e17c73623,0x006348f9990344b7,0x00a696200de28660,0x00366e1cd2352720,0x00984acc36d66c2d,0x007c869d0cab796e,0x00466f59c3fd3e25)},
+  {FIELD_LITERAL(0x0085f9ba7b26eb7e,0x00fa270e52c99ae8,0x00aad3358f7787e7,0x0096413e9051a7e4,0x009debe63bf18e93,0x00e6cd2df34c8944,0x0017f5165392768b,0x0048f312fb86c1ef)},
+  {FIELD_LITERAL(0x00696404e4863582,0x0089604a01694434,0x00380181f2d08ae7,0x00d01862f68f290d,0x003782f3309e0707,0x00cd5a0296905ef4,0x00762eeac008a686,0x00792bd21e613ec2)},
+  {FIELD_LITERAL(0x00ab1970c05105ac,0x00e5c43a211a71db,0x00ef570608369b83,0x00134e1245d2da2b,0x0054259205dc95a7,0x00305b97f51e5613,0x005ef2d5002a3ffe,0x00f458da3935dd30)},
+  {FIELD_LITERAL(0x003191a617e8e528,0x002739a6160c1f4f,0x00c2afb4f67d5952,0x00aa72dd138fb337,0x00d0a1226818a56d,0x00b3d84e9cdee16d,0x00deea8374f7a906,0x000790e0633ea9df)},
+  {FIELD_LITERAL(0x000879f29ad91385,0x00937d446ca64917,0x00387312683890fd,0x00ff0d5088bd5971,0x00c5a3b87b1aefd0,0x004e708c61245cf9,0x00694cabb3f6f2e8,0x0046e73cdaab1249)},
+  {FIELD_LITERAL(0x005b3698fa09da67,0x00b07224defb603b,0x0045d81a16f78ef8,0x00bc05dd5796e3a4,0x0063b3ebbebe5772,0x002402bfef17a9c6,0x0001bdd4e05850b9,0x00e8ac0fc12adfe0)},
+  {FIELD_LITERAL(0x007bb460fc1b8610,0x00d107cad2810c29,0x00fb46bea3d15a8b,0x00e96702c44d042f,0x005dd33ed1940731,0x00ac5a0b6ca89f4b,0x0002867a7c03ea62,0x0070758df17bd709)},
+  {FIELD_LITERAL(0x00c28bd948a538df,0x004464f960ddd19d,0x008c291408f664dd,0x00238a3c445b7a86,0x00d4643a818123a9,0x00be5df90f1e1700,0x00aba8192ea2c9ea,0x0061ce1a602ad93d)},
+  {FIELD_LITERAL(0x0026aa3d1698b5a4,0x00232634403e42de,0x00de768be073fda6,0x00f4cd6f451050b3,0x0049455f91d11347,0x00650fb3d9888bf9,0x00b470fbedf492a4,0x009f3d838fd792d3)},
+  {FIELD_LITERAL(0x003963ea03b4d3e3,0x003b578ea486881c,0x0096f85e6d32f58e,0x00990672c21d319e,0x00339c53efed67e2,0x004ac805c1874039,0x00b916289cb0c9ba,0x00e624acc60c8544)},
+  {FIELD_LITERAL(0x006f67a36b527d79,0x00b3890f0c11d225,0x0062e9f641b08568,0x008865137b8ceed7,0x00e466a6498cef34,0x0038008e7ad93da2,0x00b348ba343194b0,0x00b19edbaf936007)},
+  {FIELD_LITERAL(0x00ff6adfd5141e91,0x00923c7dbcf3fbaf,0x0027b4ecaffbe62f,0x00ce9cc72d6c3973,0x0013562e0869ab27,0x00089c2baee7eeb7,0x00201501c976661c,0x00e458e57febc0b5)},
+  {FIELD_LITERAL(0x006b267eed986197,0x00559e455c2b617c,0x00ed3cf6acde7894,0x009ed1d9f89db0c1,0x00226786e81c2bc6,0x003ef5569fab5821,0x0080de351794db80,0x0064166e50da9544)},
+  {FIELD_LITERAL(0x0026efa81ee9bd2f,0x00aafaae191e8879,0x0089b6dcafd804b4,0x005899dc926f2fd2,0x0017a84c02026f0c,0x0024a1bdf4580556,0x00ab0c3e6829b103,0x00f1582d66bb020a)},
+  {FIELD_LITERAL(0x00ffa17f52da02c8,0x00d13c511d1e103d,0x00962bdc8da84ef6,0x009da81ae6b118fd,0x00f57d5cc74af805,0x006737e7f2fbdd2e,0x006966f8fcd681e4,0x002c8b517d81c7db)},
+  {FIELD_LITERAL(0x00145c38a9738678,0x0030abd2a4804fa0,0x000716944780af6a,0x0080e88bf853ebc8,0x009120c3dcf82bc0,0x000a54fa2fb6ce90,0x00b0fae90980e820,0x00a35ad3085d7327)},
+  {FIELD_LITERAL(0x00c0641ab833bff3,0x00c757de74150ff7,0x0054ee7cbfe65064,0x00a45d17f9080fb1,0x00542683b65d11e9,0x006599c129b63e2e,0x006bc58037739404,0x00da638dab1f0b7b)},
+  {FIELD_LITERAL(0x00057ab2bde6b7f0,0x00e9932589ddc86b,0x00b9f22dc625644b,0x0051b960a2bcc900,0x00d3ee8a9f4002f3,0x0039df924d11e48e,0x006677942ae32e69,0x001c1fdb31c4fea0)},
+  {FIELD_LITERAL(0x001b321dc2287596,0x00cda6a4e0ca8b07,0x000899bdbfb5123a,0x00a6c428ce8c49d9,0x00a6fe2e4c8a4468,0x0068bffaea970309,0x004a8261715f9b69,0x00ada7135a4b9207)},
+  {FIELD_LITERAL(0x00a1e0cb4ea736ad,0x0047daacb280ef5c,0x0017e806dd986376,0x00b99d1032d1f54e,0x00da5fb69287e277,0x004b06c534c653b4,0x00259899a6163ff6,0x000330a317c34911)},
+  {FIELD_LITERAL(0x006ec939b7e2cdc6,0x004d6d2ef4a22b4a,0x00bbd53e8c88dfb5,0x004935563043c8c7,0x0022ce8d485e7a90,0x0042ba2d73d5e7d3,0x00fd2b0feb70f027,0x0030ab61b4c63a55)},
+  {FIELD_LITERAL(0x00d1a3296ee72de7,0x009114846337eecf,0x005ed7e04feec4d4,0x00bfd2a85d681d20,0x0043d8ca4c69744c,0x0002767093c21469,0x00c64d022ce72463,0x008d8c60bb694e1a)},
+  {FIELD_LITERAL(0x00b2432e07cea365,0x00bde9894b3955d7,0x0084c3f6223f6ff4,0x00d2255b323c8cbc,0x00b872877af6e6c2,0x00e0699967c9ea32,0x0044799899c5a027,0x003220d0b8404fba)},
+  {FIELD_LITERAL(0x0032493ce9194dd7,0x00a3bc5fa45a55fb,0x0011fd9815860cad,0x00380fc9db2576f1,0x001483cb5f6e9103,0x004d7b0e7f7de9f5,0x0095703d20a3646d,0x00fffe9668a79733)},
+  {FIELD_LITERAL(0x0038c1daa5d5419a,0x00188eceb5b0953c,0x0058264c8f9de059,0x00ee0de01a72dd47,0x00b83a26bf2eac4b,0x004832dfa10030e3,0x005270780cbd858e,0x00e99584ace4ed46)},
+  {FIELD_LITERAL(0x00bd31d26a1caab5,0x000c22c6067ca207,0x008350b130dfa42c,0x00f680be452d56bb,0x00f1148cb38d92f5,0x00b6f9b8cc4b8622,0x009198e825847498,0x00a64aa60db7fee4)},
+  {FIELD_LITERAL(0x00c8e23841362393,0x0069164ef0cbba95,0x00ae7f5fe9159c13,0x001f9bf61705fda4,0x009023ffd4f814ac,0x001a8c1e519c315b,0x004481a7efc3c16f,0x00bd8407ff00fad7)},
+  {FIELD_LITERAL(0x009a76370b223b20,0x00a0e5dff506fe0b,0x0069c1519f456348,0x004561eabb3c5121,0x00bdd3d3d7405666,0x00403998d42e66f3,0x0089919e4fa7b091,0x009737a811c946d7)},
+  {FIELD_LITERAL(0x005b6faf3579a3c9,0x007f08fa738955b9,0x0066bf2162ad02ad,0x001464646cc74dec,0x00806b4f230cc5a0,0x00638456ec939b6b,0x00e9c1394876f819,0x008a078b00837401)},
+  {FIELD_LITERAL(0x00bcab9ff5bc0585,0x00523934920440d0,0x005cdf4146a1306c,0x00db943685a0499b,0x00ca1f6e883111af,0x00362a401148a14e,0x0076c1b7e726fa69,0x00e4c4433c3349f5)},
+  {FIELD_LITERAL(0x00b43eb149df90c6,0x0092286ae5aa55ec,0x00c69a7927e2c460,0x005d9791a2c45376,0x0059d5163e112864,0x00928f1cd5c5170d,0x001b2072e623edf0,0x00274d321a0d0189)},
+  {FIELD_LITERAL(0x0022559a87b81aba,0x00a42e4f5d80d8e8,0x002e41e3ab22e7cb,0x00efe1fcb631d52e,0x00f45d000ecf09a2,0x00726eca04a15a59,0x00ffb9aeb35a3228,0x00fa100454a3b7e1)},
+  {FIELD_LITERAL(0x005a65a65aee7eae,0x00d88347938e4034,0x00cb2ba30ad8a7a0,0x00545c84532dbd20,0x0016e1368c5013f9,0x0061e4aca5d292a6,0x00fbe40fa0f48c3c,0x0039c7127ecb0c5d)},
+  {FIELD_LITERAL(0x00d5f9ef9091909d,0x00cab919218b9bd4,0x009a8a0e13c850dc,0x00393d5689909537,0x00d15329199b4e34,0x0095e539536a1d94,0x0063044d22a1d69e,0x008dec6062492494)},
+  {FIELD_LITERAL(0x00a2a9d6ff2b5bdc,0x00dc3046bd72bd35,0x00d64ce23be327d8,0x005f4eee900a0512,0x00aae1be9d914e0e,0x00e6e853dc281990,0x0081f19ed01297e4,0x000ca960499b4c55)},
+  {FIELD_LITERAL(0x003937bef4d463e0,0x00ff4dbb4737739c,0x001a65398176200f,0x006d887acc50d300,0x00c893833b266e6f,0x000471b6b02b95f2,0x00b264f17d332537,0x001cffbfa774ef8c)},
+  {FIELD_LITERAL(0x00eeaa8dbab94b03,0x0020fe81dcc6679d,0x00884939032e85a5,0x005ba726d30f840e,0x00bc5bdb3e1beb27,0x00ab0e1e209d9f99,0x002b16076f4089dc,0x003cf28418405493)},
+  {FIELD_LITERAL(0x00a595f1caf9afb6,0x00e6e25ad4d7a0bf,0x00b58434fdf22cce,0x00a1eb2953ac060f,0x00bf302fdffb0ac6,0x0080dbf0241f758f,0x0044e2748d10078b,0x003e65244d9865e8)},
+  {FIELD_LITERAL(0x0028fd26c00697ca,0x00ad95f53cfdd0bb,0x0037b7200ba4f71b,0x00e9abd70922cc19,0x00bf4c8369d70dd6,0x0024f6e87507d410,0x003fd72e9bd7a053,0x00d785cee475716b)},
+  {FIELD_LITERAL(0x00288fb7152933e6,0x007a2e4f67004be5,0x008c817d579adc2d,0x00d23b35894c2e7d,0x00cc9eeac2d379a3,0x006f6d85339d53e3,0x00aab3ecfce78b0b,0x00b39d146cdebd69)},
+  {FIELD_LITERAL(0x0058a853b710f15c,0x00372b084a00d019,0x009aec0c5a9a98cf,0x0069bdcebc4054b9,0x0025b50e5ffcd6c9,0x006f348b9a3ce931,0x0067445b5029308c,0x00999bcac93baf92)},
+  {FIELD_LITERAL(0x007eb53deeece00a,0x005ca709257273bb,0x009a1b0f7e3fb8bf,0x000f08e452b2c99b,0x007f3161b8b8b3ce,0x00335c1aab34cd91,0x000cfc0616f089e8,0x002fbf4165baa1c2)},
+  {FIELD_LITERAL(0x00ec4df934b5e80a,0x00bcec16cb619319,0x009be2f9102b3ecc,0x001926d0fbd25c2f,0x0097a4fbae2d0eff,0x00e4257ac1885227,0x0062f4873de9effc,0x006c6d670fd28d09)},
+  {FIELD_LITERAL(0x0068c0205f321972,0x005ec0659577be70,0x00d9ff3776fe8235,0x00c8589ff45bfef6,0x00a522edb6bf2d9b,0x00e19aec542b3884,0x0025fb32ab544779,0x007e5e6d714ff724)},
+  {FIELD_LITERAL(0x009c64e0999d96b2,0x002d775442480dcb,0x002200c57e20bfe5,0x00a0e88a8835d94b,0x005bbfcaf1fb491b,0x0036f037370a6334,0x008bf995b7f5637d,0x004c4f709796af24)},
+  {FIELD_LITERAL(0x009d9fa9de527b69,0x00c50a406cb35283,0x005da6366792a77a,0x00844fbcf9453d3a,0x005ee94ec2231563,0x0010637bc124b785,0x0067d8052f17e810,0x0023819e490050ee)},
+  {FIELD_LITERAL(0x0028019ddba63450,0x00bcf08492c3be0a,0x0032b49e3175516a,0x001ac6b6009de6e5,0x003d5d1259f3d53c,0x00e51315400fc880,0x00efb537c3db3853,0x00cc92f5e2b9a53e)},
+  {FIELD_LITERAL(0x005b634d1ad25373,0x008a9c1c1bf9491c,0x008b879a02ce71be,0x0028c4bbc79fefcd,0x00bfe9e2cd83e355,0x00be8a51d3c8758f,0x00c4350d203ddcfd,0x00ec9666ee6ffb2e)},
+  {FIELD_LITERAL(0x0072c8fb1b3d0290,0x009f53bc89db5556,0x0089bc6c4263e960,0x00b206c650ad01f6,0x00ac308e59d94f72,0x00a6835ecdcf4fc6,0x00d8169bcfe864cc,0x00ce961d03cfc715)},
+  {FIELD_LITERAL(0x0050879e168533fe,0x00ce8a60a62acf7b,0x00d19be5719a3a77,0x00fabcbe14a22791,0x0008a2945ca36a05,0x00d38626ecbfde72,0x000976c7dd405990,0x00518bc67187d7db)},
+  {FIELD_LITERAL(0x009a8f2bc0936003,0x001361c97e14f800,0x00b1fcde94d1c313,0x0060d85a3294bf4c,0x001fdb98efcd3d5d,0x003cc5a4b340755a,0x003cacf2b82c72a6,0x0056574de1dc7de5)},
+  {FIELD_LITERAL(0x0026d456e05f04fc,0x002aa597cef24a14,0x003ab8fccc0b60ec,0x00e03ec22e8a1635,0x00918aec7f52eda1,0x006d8beaa39a5f4a,0x005d1dfaac1cb231,0x0076012f4bf4eb9c)},
+  {FIELD_LITERAL(0x00af8d2915e11bf4,0x007272dc451ca905,0x009266a21dae24da,0x00ab7a8b7f34c1b1,0x003700442cda4776,0x008dcd3a903569e2,0x00809989a5fd6786,0x009ad3e2cacf45cb)},
+  {FIELD_LITERAL(0x00f6fd4e68741dc6,0x003082856a3ec467,0x003e2fa23b8fd28a,0x0065e8545cd35245,0x00bafce29ffa3d1d,0x00d7bdbe4bbba998,0x00cbe9763ea8e02a,0x0018a5f98667ce0f)},
+  {FIELD_LITERAL(0x00871ec53425e3db,0x0034c2d561ee20ec,0x00bd5539169c285f,0x001609c4da15197c,0x004d553ecc656249,0x00aaca1bbb8c271b,0x00f92e5a71400a96,0x002daf175d13be17)},
+  {FIELD_LITERAL(0x002e5266cf746bc7,0x00cdb8258df4e8c1,0x00d1de570700d171,0x001f42ed0ffd14f3,0x0074bb7a4abc45c8,0x00e65127eac96342,0x00e292f51a0fd996,0x00f735ee79ad9717)},
+  {FIELD_LITERAL(0x00ced7ec3d85000c,0x00d580c2fa2103b9,0x008ce982e8574159,0x00b3e836dbaa3746,0x0022f3c3298a3601,0x00332ead2e637d10,0x00fd3003afe51c95,0x00d49cb269af959a)},
+  {FIELD_LITERAL(0x00aebd45a3d3ed64,0x00ed9dc37aed5171,0x0036d3a3f66c6fd9,0x00704e358080e8a3,0x000609e3a37bb3b9,0x003e2fb89d5b8e6d,0x0019f98633ff5101,0x00fe999e19b2626d)},
+  {FIELD_LITERAL(0x00747862bc254704,0x00650c0d0f3e4a54,0x00ba1f1957299056,0x001e2c98d904c56a,0x00f8cf145a68d931,0x001a7910d128021a,0x004a5634a79b9290,0x0052a7c9420cc7ae)},
+  {FIELD_LITERAL(0x00378c25538eee3b,0x0074729e407e445d,0x004ff9493e371101,0x00bf270e476163c7,0x0029d7aeb315b7e4,0x009e5083cc13169f,0x00e84f6a13c7c6da,0x00a90581dcb0e471)},
+  {FIELD_LITERAL(0x0081d9b756fb635e,0x009579381beb513a,0x00a965f049d5b0bd,0x00e95f71c7f982fb,0x00e8f3f497cf608f,0x00110330391e5ee9,0x0021635b9da478cb,0x00f6103eefc970b3)},
+  {FIELD_LITERAL(0x00b96b256b0b452e,0x005ddc8e17337d31,0x006cae147b4fc265,0x008b71332e777b2b,0x0064a1f41d7f696f,0x0070a2054507b62d,0x004f8e2040c2f724,0x008d00424e4bc046)},
+  {FIELD_LITERAL(0x0020357c6318584b,0x008d882a8de64569,0x00fed07415ae62f9,0x0029e1afc2b82c21,0x005242d1611c2563,0x00383962b0657eda,0x00076f7f6485590a,0x00e17e9b65b256d7)},
+  {FIELD_LITERAL(0x00ec51fc6159cfc0,0x0075016103efffcf,0x0098c6c15b4df98d,0x008adea6f563e3ac,0x001e251f98cca96a,0x007ec75279da5ae1,0x00a1d651cb38c6d2,0x00eb91e47a159880)},
+  {FIELD_LITERAL(0x005494e42da790da,0x00743edd07fa3ec2,0x009d59c8dcd36367,0x00ebca72af3a547d,0x001d694749678478,0x008884c42dba9f02,0x00b3e322778a2808,0x00c3cc2aa5e0f11b)},
+  {FIELD_LITERAL(0x0015f417424c3006,0x006b0b3fade73abf,0x0056b7c294b1b1e0,0x0034b3ea3a3c6a7b,0x0064a588df39b2f3,0x002083780f3e7730,0x006ab45e20834be9,0x00f65f3afeef75f1)},
+  {FIELD_LITERAL(0x00fc6ecbef43e63c,0x00fcb241cca4e826,0x003e0ed12d4d2bd9,0x003111633f1bc755,0x007183e58eb6ee19,0x00407a6b9d943557,0x00a1eb99754ddda7,0x00f071de74d4bf8f)},
+  {FIELD_LITERAL(0x00a37cfa24b27c67,0x00890a4a84e279a4,0x00c32141ff0fc8cf,0x0018e6cd4f351b54,0x00e590ba6a02a8f4,0x0082092bd70c4c71,0x008c0a7f8c16b8ab,0x00d7e214d20ef6eb)},
+  {FIELD_LITERAL(0x007470498d44ce66,0x004e63aff113920b,0x0092a8b3c0f64076,0x0089863857fc853c,0x00ad4c06432b282a,0x00708f6450fa7b78,0x00ced5ddb19fce44,0x00779421c10fd908)},
+  {FIELD_LITERAL(0x0065a502fef36738,0x001ed6915bb171ac,0x00a20c82e365537b,0x00a979c4c50392be,0x00df4ad46c218b43,0x00dd46427420c63b,0x00ada7af8c55409f,0x008cae269e048e46)},
+  {FIELD_LITERAL(0x0065ab0c9c3640f2,0x0054231383c00d50,0x004f2e7c48765d14,0x001b483e624c08e4,0x0074959ba9c5f34e,0x000a7e89b778b3d1,0x008adf59070d0a7a,0x005742d806e36f98)},
+  {FIELD_LITERAL(0x00215bf3742ed308,0x0091b4c6fce4bc62,0x000fa859ea33a0a4,0x005f3a2e7b752dbc,0x008ff377fed148c9,0x0061b6ad44bcd2f2,0x00a4293c8c147893,0x00218c01271de4d5)},
+  {FIELD_LITERAL(0x00f7e9a48d6b6019,0x002c6b1a43404a6e,0x007ee167bac979ef,0x00af24f8a3d047b6,0x00e4ea72363850c1,0x00b85a2f70c14fc9,0x00b2083b98c7af0e,0x00b589a45ede0a11)},
+  {FIELD_LITERAL(0x0011fe37cb219900,0x00bd92eec11570a6,0x007a0f6f5f191125,0x005ca8d7529fd9a2,0x009052791fbc26c3,0x00f87565c95e60da,0x0018e50232d543ce,0x00b80b71f4cf53ce)},
+  {FIELD_LITERAL(0x00b606a0ea8706be,0x0099b8e0c7e78a32,0x00846cdaa6153459,0x0087479c7c0fd888,0x00d22bfb1ef31755,0x00bc02d8c659b707,0x00e68b4f7ae18533,0x009f581c45f78057)},
+  {FIELD_LITERAL(0x00192cb9abf6584f,0x00e3da13618c987d,0x002c7000c1feefaa,0x001271a6aa182e1c,0x002b79cf4338c805,0x005004639f34261b,0x00e87fa4567bfc6f,0x00b258dc282ea77d)},
+  {FIELD_LITERAL(0x0086a026633ba7e2,0x0093d0a4bfdb830d,0x0031dd6852505d0f,0x00220f45e3ef8f2c,0x00efd5ad4f6e3b39,0x006008c1ec0565fa,0x005711cad4e863c7,0x009996f8a5c70036)},
+  {FIELD_LITERAL(0x00a8c0c88e22cb8a,0x0079adfff3fd4468,0x00de6a62f331d14d,0x00c6ee32ca88b15b,0x0097a6ad7e119839,0x00605ef105bbe539,0x00ef0ff253333221,0x002c28ed125fc999)},
+  {FIELD_LITERAL(0x009ff0bbd766ac9c,0x009c96645759b305,0x00eddde13dfe14a7,0x00d2dcfc1b49cc29,0x00e541d555ebf573,0x00ff38e9d43ee961,0x000ef7c1e850a09b,0x005f8ebfd8d5d376)},
+  {FIELD_LITERAL(0x00b5bae2960882d6,0x00c08c17c3bad0e8,0x00273f74a5c89fae,0x00a1a24623af0905,0x00da1f80a02d8ca0,0x00b0bd91994a4a09,0x008dd4956b78c658,0x00b977dabbe3ed83)},
+  {FIELD_LITERAL(0x00fc600656ba8481,0x00671a9a2f779ffa,0x000cb55ef4f85e5e,0x005c3a4b578be133,0x00908648143fe691,0x00a584c0cb9ee2b6,0x0095e52418c2078b,0x008f98841e9c6861)},
+  {FIELD_LITERAL(0x00587337344c2155,0x009c89b94f8fa22e,0x006e4a7a41596688,0x00fa1fe12f7e4608,0x00a293773e9f9304,0x003f0f69c0e25d07,0x00f2634b32fa045c,0x003b1037ca893586)},
+  {FIELD_LITERAL(0x008c9c64f615ea34,0x00a9497b18df08af,0x00e21ba2b927ad8a,0x00cc0d879c8a067a,0x0035fa5fc7b2cdf9,0x001c0a6186af126d,0x0053c35743afe6d4,0x008d21a09cdc9457)},
+  {FIELD_LITERAL(0x00fd5e12d65ae46d,0x00c6ef0243154b7e,0x00171463bfd099c4,0x00453f96279613c8,0x002dce29d2eabf69,0x00c29520ea5484ed,0x00ebd12094599691,0x001269beebb9d0ee)},
+  {FIELD_LITERAL(0x005a1e7ee5e7981b,0x00b217b9fe2fae15,0x00a7a66b0333ebb6,0x00fd9ae568243c8f,0x006ff0ad68fc869d,0x00fdee411e0c11a9,0x00d0eeaaf13377bc,0x0096508e19663fcd)},
+  {FIELD_LITERAL(0x007beea75ebfd2f2,0x0097a00e799cc904,0x0089f9fa522beca1,0x002a1a05f7fea225,0x002a40f037c6003e,0x0059b43a4d888a3f,0x00c7e3dfc9ea0812,0x006a11a29311c661)},
+  {FIELD_LITERAL(0x00a1a816e040d05c,0x00125d0a73269c90,0x002fd0b3f7abaef8,0x001353c977cc153a,0x00785a7460e7b14b,0x0058e4c397ccc3df,0x0093ec9e33c89300,0x006987a555a6a60b)},
+  {FIELD_LITERAL(0x00a764e9836c0037,0x00841a530f52bb94,0x00fb8422279b7863,0x00e22caed093e45d,0x002367fa0ba15f7e,0x00e729dee6391127,0x0060c91eaf79e963,0x0090def34aef25c8)},
+  {FIELD_LITERAL(0x000c638fcb5a37ae,0x004be5959e551cdd,0x00f2d8922ec93ad0,0x00dd4ff1b93bee43,0x006cacd1abaccaa3,0x00b349ae94fdba20,0x001e8493826db3f7,0x00c0b1897e11ef91)},
+  {FIELD_LITERAL(0x00096ce38a76260b,0x00007623ed9becc5,0x00cd44585508c4bf,0x00472406197acbc7,0x000299c229177ae8,0x00d938c41df7b480,0x00647d73e8b58507,0x005f8fe387ff3827)},
+  {FIELD_LITERAL(0x008c79960e22b28e,0x001584f79f9c5027,0x009bce8c03aa622e,0x00ab5d474a14fa82,0x00153ec570c1a828,0x00138176c03d658f,0x00f81617d8b52286,0x002a9af644d992ba)},
+  {FIELD_LITERAL(0x0025b9b125946b81,0x00e160886ffca6cc,0x0071ddeb530fab6f,0x001cac69d941b2eb,0x0053ba30fde55917,0x00d8ca2e0e203eb4,0x000bff5d8f5c58f2,0x00532ac845380baa)},
+  {FIELD_LITERAL(0x0086b8dd4c7cc8b0,0x00b629247bb50b70,0x00317ca65da2766d,0x00305b9065aa4502,0x00d2c6f8161df7d1,0x00963e2416d7f602,0x00aa1411b4375993,0x002875bfb146c186)},
+  {FIELD_LITERAL(0x0032a311bbc7541d,0x0019c30c52c82004,0x0092bc592dca36d1,0x00e6feb918a770b8,0x008dc6e19e3d110e,0x0034382a68cdb676,0x00e767aa9020e488,0x0066f32d3c66dafb)},
+  {FIELD_LITERAL(0x00aaa03f8c222623,0x0004354b6ce5e78d,0x0038120362cf6019,0x00ac697229729cee,0x0037687157474c1b,0x00ac62703ce4c39a,0x004e806d845effed,0x00023fb17a68d71c)},
+  {FIELD_LITERAL(0x00c338d45849226e,0x002ae61733a402fe,0x008dd344fd499ce6,0x00d3e326eaedff64,0x008a0ebb895bce37,0x00a529046ba4be79,0x001ebe7fc5a81717,0x00d58edce3028a07)},
+  {FIELD_LITERAL(0x005187c408cc018c,0x002ff69a9f7dcde4,0x0061aa0f4cf2d086,0x00d9d774a39c14b1,0x00b5a74989452813,0x002ba0c3294e81c2,0x0005847539a91a40,0x0085c75448cc3710)},
+  {FIELD_LITERAL(0x002ad8f161304c4c,0x009e48884b2d794e,0x00bc7345dd8d8cbf,0x00398c483e28daa6,0x00dbd48cd23293c3,0x00f9faf87707a933,0x00e058e73ede3370,0x002498ea5158311b)},
+  {FIELD_LITERAL(0x0041788abb0e123e,0x009eb1330a218711,0x00dbd1906504f67b,0x00a689a7cce59d17,0x00fb3b25b42fd561,0x004d5915213f5a76,0x00d8025c64e28795,0x000923025baa7886)},
+  {FIELD_LITERAL(0x00abaa869cf6682c,0x00943b070ad3871c,0x00a2c098d5b5fdbe,0x00c05cec86101de6,0x008bc17df2f74da4,0x00dd54076258cbfc,0x009d50fea0cedca3,0x00b202ded9a7bdb4)},
+  {FIELD_LITERAL(0x003fa516954a1d48,0x0047a4ef4ba5cd13,0x00451c9eec208773,0x00276f497faac76e,0x00eb5285c7f9bfe6,0x00f0114d64721c95,0x0053ccb3fb2ed40c,0x009a0b58f210dd61)},
+  {FIELD_LITERAL(0x0001fe833507d730,0x006d6dabcaf43293,0x00ff1ff1cac5f449,0x00b2d4cdaa2fc702,0x002acc394b4e3f3b,0x001f00c7b5e79e0b,0x0022388478045ce7,0x0045349880d4cb58)},
+  {FIELD_LITERAL(0x0052d79666aebf22,0x00b70d280409e0c7,0x00bdcf325b59cf80,0x0014fc3d72f90ef4,0x005fd116db59f729,0x0059ec97a7a28465,0x00a17b910f87fa68,0x0018a8a8715b4b18)},
+  {FIELD_LITERAL(0x006a2220f5a49194,0x0074dd0eccc77468,0x00771d410eef9390,0x00896e862aa4afc6,0x00516cf80d68d0f9,0x0002cd8d5f25856b,0x0029e9c6cc11c854,0x0020dbe434f02920)},
+  {FIELD_LITERAL(0x009d2fb8483888f8,0x0059ab8db307420b,0x00cfbe3b07ed6b4a,0x00c938c1c0d086c1,0x00804e3d4f7fe876,0x00cdd92615392eee,0x009dade112961780,0x009e95f6b5b5823e)},
+  {FIELD_LITERAL(0x00192f4e54565fb3,0x0079d3efb1b8f287,0x005d72c264126faa,0x00c18c26140a22e8,0x003e7ed78c58b4bc,0x00e053575161060b,0x00541090cb91070e,0x00aba6bfc30a015c)},
+  {FIELD_LITERAL(0x003a169a17fe485b,0x00abab6bd492b713,0x002c17080e98d8db,0x0014b9c90266293d,0x00437a83aaf6b33f,0x000fca735c0022ab,0x007d1b4baaf1f85a,0x00c482ee7107b27c)},
+  {FIELD_LITERAL(0x00b2d62d6ab90fcb,0x00553fd42d05c7c0,0x00df6bf348ed3b80,0x0093009a0e8dba11,0x006ae28629089b40,0x00bb6730df08e0f7,0x00c154776c1f6f30,0x00d419fe4ddb0364)},
+  {FIELD_LITERAL(0x00a448aaebab914f,0x0000f23ded3e7955,0x00d099326444113b,0x0062edb2c72da0f1,0x00550e6db3ad1c66,0x004dd54e2605edb1,0x002118633780239c,0x00eb65782697edbf)},
+  {FIELD_LITERAL(0x0075c91481734391,0x000346c366f5b924,0x007c00a77a0edd10,0x000c075800174c28,0x003a5a7ac45ec132,0x00c61463b35e092d,0x00fe43c75b0a61d0,0x00064da35d310bde)},
+  {FIELD_LITERAL(0x00c5f16ed95f2147,0x006a2c4d847c0c67,0x00b77b91bcd70606,0x00c298e57d8bcf4a,0x00aca9c8d0d27770,0x0073a67be1ee930e,0x00450da9e57405b0,0x00385b2798ebcad4)},
+  {FIELD_LITERAL(0x00a32311300ddbe0,0x0001052b9865fe7d,0x0005ebe748ab3495,0x003486e12f3ce6f0,0x00d8be3f91dbb605,0x0070c6ceb0fb4727,0x00cb63d391b2f8c2,0x00a7bca64ace11e7)},
+  {FIELD_LITERAL(0x00bfe7406409a09a,0x009c20d455b67a39,0x002298c51a1abebb,0x0024d71f9dd9c45c,0x000fc3506b3f939d,0x008788b9d74ea7d3,0x008480977476cb43,0x0078932f3cde2761)},
+  {FIELD_LITERAL(0x006b451028dfd268,0x00ac3dd1581d2682,0x0075369920d96ac0,0x00f0a0cf9f88176b,0x001bf969737c8713,0x00a302feddcf488f,0x001a2e1834842077,0x009c5baccacd7ad6)},
+  {FIELD_LITERAL(0x00453371cacc51ac,0x003f620ce1dcdb8e,0x005196b3a9e620c8,0x00a1944f6e73ca97,0x009d5d5113b2efc7,0x00cd66228ffb0371,0x00e5d4ad0f3fea7f,0x0006a3f0646033c7)},
+  {FIELD_LITERAL(0x009ab26e51f75162,0x00d1895fb6d2f3e7,0x004a6450c68504d2,0x009b52c26eec9f7e,0x00716f3274b74fb7,0x003a0c5578bbd725,0x004511d1b2023a30,0x00f5257b1f508f80)},
+  {FIELD_LITERAL(0x0073800c6e7fe303,0x004d26a3c881e936,0x00c4cf3049b8047a,0x0047b1e0d14620bd,0x00e484b0b3d0ea7d,0x0067d6b3bf9a538b,0x005f421c5ab6b1ab,0x006e252c9673101c)},
+  {FIELD_LITERAL(0x00fbba10f9548a08,0x00e30d343622918a,0x009948eb218d11aa,0x00fbc4f99b7516f8,0x00ed64d18cc28f09,0x007c86c6c3646e63,0x0047c154c3fca7d9,0x00145c7be321afa6)},
+  {FIELD_LITERAL(0x00ba0845821a2660,0x00f1d9fd8eb9e64e,0x00ada1128c054b20,0x00ec176157c3e0ed,0x00decd0530c408b8,0x008575df722818e1,0x00e61f8189c03e06,0x0068682bee6e077d)},
+  {FIELD_LITERAL(0x00e8c51b498e106d,0x00380e8b3b0e588b,0x006131b5cf190d09,0x004b7c14e62a6800,0x004b6d9c40b5bd24,0x009065fa481c9482,0x003b8599eee02dcb,0x00fc06bb787a8f2f)},
+  {FIELD_LITERAL(0x00589877dfc436b8,0x0099105ec55806af,0x00868eb7d927ae01,0x000a944093d441c9,0x009d627e5d2c133e,0x0060cbe30172ab6f,0x007db00ed3d6b29d,0x004bada54aec945f)},
+  {FIELD_LITERAL(0x00e8003070f83500,0x009d6d38fb6c5575,0x009a3352cc5acff9,0x007028f772ae81e2,0x00b9cfcf8c324eb6,0x00456276a995fc46,0x0016a523305c9ae9,0x005e2e3ae19773f4)},
+  {FIELD_LITERAL(0x00a92c01d4aee273,0x0000526d9b847478,0x00aef78a5930670a,0x00d2f83f1892bbda,0x000736997054082c,0x00df89bdab2413b4,0x00883afe60dd20bc,0x00ae5175de93ccca)},
+  {FIELD_LITERAL(0x001467fae5c86f3f,0x0031353a156503f6,0x001366e234e8e31a,0x006d2c069e31f95a,0x005cfcb0a390e336,0x005ab5e31f40d911,0x00b988ddafb8a189,0x007974ac3fdb358c)},
+  {FIELD_LITERAL(0x00386b0cdf2a08bf,0x00fdb4bba5b11ed2,0x00592072c4f55271,0x009879c8f2f2cf5f,0x008b4186327565e1,0x0047f266d1b5c995,0x00691dacd7cb5b77,0x00736bd1dc705025)},
+  {FIELD_LITERAL(0x005a1258085f2864,0x00dffa8ed43f750e,0x00aaa531967cf75f,0x00f4426eda214c26,0x00d11c0553135cec,0x00e1fe5957015e00,0x008167ef8f215684,0x00090cf1ac26dbdc)},
+  {FIELD_LITERAL(0x00718d1b1c490231,0x008643bcc5c89aae,0x00871aea822457a7,0x00fddec1561a3a2b,0x00ca17d1693d5b03,0x001734af844e2ea7,0x00e4d574ad3413b6,0x0024ea3efe96967a)},
+  {FIELD_LITERAL(0x00441fb3316997e0,0x00d1c2b93c8bf8f1,0x006b88fd78a7e1dc,0x0040c0698764ad53,0x00d4eb3239e8561b,0x006ee7020e0f7f5c,0x00e3044f51bde7f5,0x00628ecd207f8ff8)},
+  {FIELD_LITERAL(0x0050bc86d793ae7e,0x006f2b2541f07991,0x001df11654b078b7,0x0022a25739a8f7b0,0x004a9cfe7963e9a2,0x00d9bb64c9dbcecf,0x00dd3b683e9c1bd9,0x0054e080bfc66b5f)},
+  {FIELD_LITERAL(0x000b3bdd9a358ab8,0x0060b93a97dde657,0x004a55130a90c6b3,0x002d790ebf00034a,0x0016eb21da60a218,0x003e02ccdbaea2c7,0x003c43dba78e8206,0x00e9693e0131bc7a)},
+  {FIELD_LITERAL(0x0099f1f5a8ee07f4,0x005317a7b9caafd8,0x0001de5c387b70ec,0x00fdbf43fd890be7,0x00ac5e052c1daf10,0x0032dfe7cd3ffe65,0x0092c2613e8f2a70,0x0052c9e1ea4ff5d3)},
+  {FIELD_LITERAL(0x008a5fea22b6a053,0x00c067bcd4dbb009,0x00101613313e8846,0x00f164e66167cc25,0x000e355c5468c966,0x00778e741d38ea58,0x0006be3f8406040a,0x00ce590c96dff19c)},
+  {FIELD_LITERAL(0x008faa09fc8cb3c9,0x00ed6a704a4ea2d6,0x00416d15755f128a,0x001d6b26251ced98,0x0029f7b44ff79e16,0x002769e40371d2ea,0x005407009cb03439,0x005711ffd6552527)},
+  {FIELD_LITERAL(0x00604e5b217efbb5,0x00a019c985dbbb47,0x00e68ce6c3b6cc58,0x0055d7cac37c47d7,0x00da0d8ce55f3b06,0x0027fe04d134283d,0x003f8e9045193eb1,0x00c15ae87c3fd9bd)},
+  {FIELD_LITERAL(0x00e377b7d13d1285,0x0024387a7f5f54ef,0x00bbacb8a266c457,0x00cd868ff4d9bc6e,0x00bb1a08853e7e99,0x00e39013814e7573,0x00893616e15de4cf,0x00a38119142bab6c)},
+  {FIELD_LITERAL(0x006b6846e016b36f,0x0000cbd0555e5752,0x00a221445a30a9c7,0x00f8779331e31bae,0x0036bf1f319f7bfd,0x000b37fef05525ce,0x000877cbdb68abff,0x00e0c40454cf0cf4)},
+  {FIELD_LITERAL(0x0005f9ab679c4de0,0x00fe7819919a2d11,0x008a0534a4a1af4f,0x00d47561530f300f,0x008ab9336a4200e6,0x005dc0b769b58078,0x00e819fadcf3f224,0x0014953f69a33085)},
+  {FIELD_LITERAL(0x007902f401e0028f,0x00bf37124bd4f807,0x00a054efaefcc742,0x006326ba2a7fbfbd,0x003adb7f6d257ed3,0x00dd00af7e501c8b,0x00831e31569734e5,0x0078257aad838353)},
+  {FIELD_LITERAL(0x00883584d08050b8,0x00864fc7eefd7f5b,0x00c111b76fdf5f76,0x004b9b0f91f0d259,0x00af9f61cc2615c8,0x0068b36c7caa45d4,0x003114444591674b,0x00956ef1f1767526)},
+  {FIELD_LITERAL(0x00c4ab305e634a92,0x00156e49f9e5abd1,0x002ce9d8ca480cfe,0x00491b347b589e4d,0x00037330c8e912a5,0x0049fb5b74f3e908,0x002024cf512ccf48,0x00ddcd24f8f345ed)},
+  {FIELD_LITERAL(0x006108030683f6eb,0x002187ea82daf925,0x00c308a14e6a2922,0x00c26f4c5d5dd2ed,0x007f4038c7382909,0x00d173cc721592a3,0x0089d2ca366da2e2,0x00c99dbab52930a6)},
+  {FIELD_LITERAL(0x00916c72679e9767,0x00549d4e395077ca,0x00ab081316453a3b,0x00849740da0ed88f,0x008be1078db87652,0x00ff3b44f4c4524c,0x006d9688e609581d,0x00755fa68f6503f8)},
+  {FIELD_LITERAL(0x008481fb8f9e2715,0x00ca073bb5f33c9d,0x00e6386fe10db2ef,0x001d7ac16faba25b,0x006219830c44b6b4,0x00258922567680ce,0x0074fed1cd0f9835,0x00dbd38c082b189f)},
+  {FIELD_LITERAL(0x0054ba7b493697b7,0x0055b18f719a6aa9,0x0000ba46d520b957,0x003b62de66969b1c,0x00845add72de265a,0x005d8b4ffdf22a3e,0x00c324f7fb2cb6dc,0x00232f56cd31d987)},
+  {FIELD_LITERAL(0x00e9f716cecd1de8,0x003b4dc9ec05ab20,0x00f925a9abf5732c,0x009e612aa46e21bf,0x008873581394c12c,0x00510d1d274f847d,0x001d25d9f63045af,0x00881eefc4abfeed)},
+  {FIELD_LITERAL(0x00fabe355b3e262d,0x006eb0a51383931c,0x004e7337d2cd9481,0x00e4bc438b2564cb,0x00e767065efc99c4,0x0033b1995e2eee7a,0x0029d37f564f9c54,0x00e49a87ed51da52)},
+  {FIELD_LITERAL(0x00ba6b570d30813d,0x00fd7fef36bae9f8,0x00d03ebc6337cd55,0x00364613ba9ae3be,0x00b0622f5b815a6b,0x00256fe6ed68d8af,0x0092fe9af3a92839,0x0042387a7cc90953)},
+  {FIELD_LITERAL(0x00b45d41a2d6174a,0x00956fb84ad2b6f1,0x003e846e21200995,0x0069c974ef5e6804,0x007a186b0b9e3faa,0x008d7ff5589ab0ad,0x0032314fae41b94d,0x000315d2e09d9299)},
+  {FIELD_LITERAL(0x00cc8d47bccd03bd,0x00ad1e187220a87a,0x00a40c1bd39b46f0,0x0011f76a8b085836,0x00dd01e302499eb4,0x00f341bb2ef6c5e2,0x00d8bbeb11e45ff2,0x00c32adf3469700d)},
+  {FIELD_LITERAL(0x006c20d69973f1b6,0x00ab4c528e51a9f0,0x0023d1d8fe657a42,0x0073159db6ca9101,0x00e86484ba787071,0x004fd77f36e118ee,0x00020f31cf53cbe6,0x0003b834eb567daa)},
+  {FIELD_LITERAL(0x001e7a4523a0660c,0x008706a96ba32236,0x00687a33cc3c5c82,0x006e6840ff0468b1,0x0009d61c0c80f776,0x003bf5c7164533b5,0x00821c2fc4b547e2,0x0010a6d5217d1622)},
+  {FIELD_LITERAL(0x006e9319c6d9d0c1,0x001912d709401796,0x00379ae2afbc3974,0x0075139b8321320b,0x009d2da7000ceb69,0x00ae0151eb4b0dcb,0x00ae334b864705d1,0x003c340fbd7121c9)},
+  {FIELD_LITERAL(0x00537a48b5ae7005,0x00134e236d27b35f,0x00513170441a2261,0x00495bbab5218306,0x009ce0c3aa7523db,0x001cafb3ee37bff3,0x003ad4390f6b1b23,0x0007caeb678ba43d)},
+  {FIELD_LITERAL(0x00db6aead01fa474,0x0057d4f4fa948420,0x001f40dd72585c47,0x0098d26d295c119e,0x0095e9d2fe848e19,0x000606dbdd514dd2,0x00a98f1f775b7a9c,0x009fab814865e20c)},
+  {FIELD_LITERAL(0x00a2001f4e6cea9f,0x005a22315d2d402a,0x0057057c4d6686eb,0x0061a47fbc1140a4,0x00e8c092a351aded,0x00e65f55011f5234,0x003a69d923ebdba4,0x007a0e68260e29e6)},
+  {FIELD_LITERAL(0x00c1cf084160211d,0x000ad86dab64d819,0x00910c69b7bc0f8b,0x00e3b285f6d0ddfc,0x0053d4bf6d194761,0x00dc40248127ad31,0x00694c7386ee50ab,0x00359e8ddbaac02e)},
+  {FIELD_LITERAL(0x00a0c73e1993a652,0x009995041eab7589,0x000354ba1fbf9ba0,0x005e8d941070e7bc,0x0050324b38360358,0x00f528fa720c51ee,0x00ce549b89e23ebe,0x00f770cac9429cca)},
+  {FIELD_LITERAL(0x00d07b9543d0817e,0x002306fe017dc8db,0x0089daaac3c7c5a1,0x00d631c03e0b2bda,0x006f8bfad5ff1691,0x00531d4a06b55064,0x007f145eab6996ab,0x00ad8cff00f6c357)},
+  {FIELD_LITERAL(0x00778c1661c21e5e,0x00f47be9e344d5e2,0x00db8b19801ba648,0x0031fe707cf91549,0x000fe9ea0f01796e,0x00fc04e0cae4b47f,0x006e0c0c69130e39,0x00448a38895794bd)},
+  {FIELD_LITERAL(0x004ff35eacb0ffc3,0x000bdbc6214419f5,0x009998ea617068f9,0x00ebd7f3a9da27bd,0x000ae289e1c6635a,0x00ad9a6cfc5fb25c,0x0081ef562667fea3,0x00bb3dd9b459c444)},
+  {FIELD_LITERAL(0x00e7dcc237bcccbb,0x00428f4010365955,0x00b0db72fbf2e569,0x0015cf1dbfcde224,0x00bd1bfbce870f90,0x001a882f5437ad0e,0x00b4c8b385cf7d08,0x0019313fd56fad5a)},
+  {FIELD_LITERAL(0x00b33378f7681173,0x00e69e8b8a778dd4,0x0066340f105b46cd,0x00d2cf537aadcbd9,0x00244b6d327103a9,0x00a22f033beb482d,0x0027c934da969c43,0x00d70cc65fa69f5e)},
+  {FIELD_LITERAL(0x00cd3306e6fe34c2,0x00ee482edde9cf3d,0x0079451cf20dc903,0x00b03dfa95909503,0x0071d79d3b5a8d34,0x002595727fde1001,0x0091952657a3d9fe,0x0027d36edab42d31)},
+  {FIELD_LITERAL(0x00234842fc45d9b9,0x004f9d5c0f97fa7f,0x000951d039ee8a48,0x00c22d1303fcf744,0x001f793ac09a57fb,0x00a178f81aede290,0x00bec24ec8d01054,0x001a3bfc22984d69)},
+  {FIELD_LITERAL(0x00f4073e553b6b33,0x00a4ecf975e6ab5f,0x00b6d993e2678515,0x00f1577fcb16c80d,0x004eb8b0b6f3da40,0x00222902762e4679,0x002840a70ed1cadc,0x000e34a0013db712)},
+  {FIELD_LITERAL(0x0046d6671ef01f32,0x007860d5e7c5fc00,0x0006f98fe4fc291b,0x00be2c1f98bad722,0x00bf007d632d3870,0x00420624832105c1,0x00dd3d83fc2124cf,0x008c2397446f013a)},
+  {FIELD_LITERAL(0x00a5c05644d6b891,0x00393fb27d8f050f,0x00e0ec28ea66da25,0x00565734d7db26a2,0x00fa1cd0e00fa7d1,0x00d5e73a38b40a95,0x00db40e45317e496,0x00a050215e9f4471)},
+  {FIELD_LITERAL(0x0064f1335dc0f410,0x0067f9c617fc7c0d,0x00452f6138a708dd,0x00870d9ff6b6f939,0x00d3cd0775895479,0x00e85a60a82ada5b,0x000210bb19e5e32c,0x00a393f1bc9af636)},
+  {FIELD_LITERAL(0x0018e23806776e35,0x004a6852395cb6e1,0x001db75e48dcab92,0x00183e96b8d24cd4,0x000c6d54549c52a5,0x006512ebeccc53e7,0x00828bd57be72932,0x00a1a3c959b17865)},
+  {FIELD_LITERAL(0x0089f3df99986ca8,0x00b7c8c4aad96efa,0x0008639f9eb988e3,0x00d0bcbcce9e7efe,0x00b195062f559429,0x00e49cc6e55da33f,0x00cdc92c7f57b3f3,0x00a495524e9fb03f)},
+  {FIELD_LITERAL(0x0030050474518802,0x002e54aedba1d3a5,0x004da43bff49820e,0x0002ce24bb1d94d1,0x0068c298f8ce47ad,0x0058c3324dfe9e28,0x00c22e070677d297,0x00314fd8eebb6ba5)},
+  {FIELD_LITERAL(0x000f0f09594ff89a,0x00df27d9b2068a3b,0x00e237daac27a681,0x0040f080cef4670f,0x00c4bdf3e96aa234,0x00c2b09bf7d9a01f,0x004d450b0eec4d6f,0x00dd10bb78d5108d)},
+  {FIELD_LITERAL(0x0075f3b702c56f12,0x0090e5181826e4d0,0x00586f6fab0f26b0,0x00db7c9ff8e3d57b,0x00eeb9a2d7c43b32,0x00efc4328b97edba,0x00ef1f4d2ea77693,0x007075e3642cecee)},
+  {FIELD_LITERAL(0x003af0eca62652d9,0x003d2fde8e14b2bb,0x008987898bb27fa7,0x00976c9762406759,0x00f3dbb1ad96e9f1,0x003374ebec6ea29f,0x0046de5cc970c121,0x00c6c87df2c51d97)},
+  {FIELD_LITERAL(0x00a97cff20b32bc7,0x0043b96986f9cf98,0x00017dbc869e142b,0x00c62c5afe39e1c9,0x00caea5e5a3f7604,0x001f1b4037221b32,0x004b69e8b3db714a,0x008320d49fad2fa8)},
+  {FIELD_LITERAL(0x00b8ca084cd57d93,0x000a9f29506f5b6d,0x00e66674782aa4ce,0x00a6981e065a184f,0x003315772ba5e032,0x00fe27bd86a6b544,0x001ecdee168789fc,0x00e89feed44a4617)},
+  {FIELD_LITERAL(0x00d56de7f05f4a37,0x00c4ba53d9dd7a4c,0x00614657edeb3b4e,0x00ce5f434bb430b6,0x0095fc1af7088b2c,0x000f90e2fac17d5f,0x0079736f84bf1f6f,0x00eec39da4fecd30)},
+  {FIELD_LITERAL(0x0082f47db623b3f1,0x007409af488b7d20,0x00d63f706b6a5883,0x003f3282470834b9,0x006fb4a661697578,0x00a75b4f57ebc3e7,0x00d55789e0db7d7d,0x004b52d53e5a39e7)},
+  {FIELD_LITERAL(0x004bf0ddb2544307,0x00cdb04f4f777f3e,0x00f1adc7b7262e3f,0x00ce38484a894778,0x002f14141d2851ae,0x00087f0ed2d18a51,0x003e5b1c40b6c16b,0x006e67445ad2b9e2)},
+  {FIELD_LITERAL(0x004f76fd8121e3a0,0x0073770e174047e1,0x0012e29be6d86e70,0x003b175e7e232c45,0x00bf808a7955512e,0x0091ea1a8db402d1,0x00614cedc78e8757,0x00a56880949eb219)},
+  {FIELD_LITERAL(0x00315c51f850a505,0x0052e7e9d28f49f6,0x00ab73e39c0e33aa,0x00b56f92d83315df,0x001de56978c2f5fd,0x00db870419ca3a7d,0x0058d52a9ee098ba,0x00265f559e77d05b)},
+  {FIELD_LITERAL(0x00997dcacbf0e8b4,0x00131d6535c0ccaf,0x00db5c409b9aa9a4,0x007660154befff8c,0x00875895744ae6db,0x00bee6ddfa839b99,0x0063cc32c9b90894,0x0060119493197cb2)},
+  {FIELD_LITERAL(0x0081282844387c56,0x0077cf479235bbf7,0x00e5958b6571c0e0,0x00df6c28cd5ef96c,0x0066452b3f89fa55,0x00716353785ad654,0x005486d6f4d90a31,0x0025c37c6f9699fa)},
+  {FIELD_LITERAL(0x00a27acfc53998e0,0x0074811ae58b9891,0x0042daf694ab3a7b,0x00b2e68ad665ef80,0x002ff36576f41853,0x007df473d4d17cc5,0x0079b374825de8a1,0x0013221a95f9b1c6)},
+  {FIELD_LITERAL(0x00b5ca1dd7dbb2d8,0x00087d9c9f23d0e6,0x0052e5f0e695da9c,0x00769819fbe23dc4,0x0080b0b23efd137a,0x003e04e43b383567,0x0007adc22a752e68,0x0023ac8d5b43d3e5)},
+  {FIELD_LITERAL(0x00ed04f41d579160,0x001825abcd21d81a,0x0024e471513ba04e,0x00169c733019c125,0x0088f3ed57ae52eb,0x00c4b7ac741ee053,0x003ab1c961757e34,0x001a7445b6dd3810)},
+  {FIELD_LITERAL(0x003379bd5cf247ce,0x0065e4ceeb977b6c,0x008de9070344d36d,0x008549d454ed70fa,0x00f040d8a1d1cf3e,0x00e6ea1577616a41,0x0008d83e464b5b20,0x00bff88f5ee6c3e3)},
+  {FIELD_LITERAL(0x003052c288709184,0x0004dc2d6e02a127,0x00d9a5ae3ba4683a,0x003345ed51e37467,0x00591ded4d9fc285,0x00554bd88a4ce060,0x0052a0158050011a,0x00787045434539be)},
+  {FIELD_LITERAL(0x00d565a83760f75b,0x0073b93145f4cca4,0x0033a9c92e74a313,0x0028c75bf4352ce5,0x00334fa551347e11,0x006c5bc88cb47370,0x00b055ca05adf453,0x00b1ae739519634a)},
+  {FIELD_LITERAL(0x00d30c85c9afb9e1,0x0055123f6f3a2e51,0x0052b1746338a663,0x008eef0dd0f4766c,0x00e50d419d00a2dc,0x0032079f4bd402f8,0x00b80221917d9602,0x0066ad18a4ced7b1)},
+  {FIELD_LITERAL(0x002555a3375f683c,0x000078074b51e4b1,0x003dd42cb3ef06d3,0x0059a52a96625e63,0x006d16c0f990fd71,0x00c387e3444a19e2,0x0042628898974fc8,0x00c9910d34f68e19)},
+  {FIELD_LITERAL(0x00e5d508771de486,0x00800fa27fa6b01d,0x0038dcdeabb0f330,0x00e7e43dfabdd9b3,0x00fb050db92f3444,0x0097cb9ab3d1fca7,0x00d878ff30b60b8f,0x009d9892aa4e54cb)},
+  {FIELD_LITERAL(0x0091b6d9a8a1bc60,0x006028cef4244502,0x00eff102fe19797a,0x00833c0f168dd18a,0x007ea679eea02556,0x00a259758d308c90,0x000e8d4d0994eac2,0x0053c1ca5fa34aa2)},
+  {FIELD_LITERAL(0x0063bd63bb11e9f5,0x002b42815de19f35,0x007a738aa1790052,0x004628ce50316c01,0x001fc986684cfacd,0x002a0b8163b6dd70,0x0053e35c87c3f102,0x00c77cc6a09bacdf)},
+  {FIELD_LITERAL(0x00fd90005d94b214,0x00945221cbdcf845,0x00df8097b7178413,0x004d81249ca68e0c,0x00f2ef4a63ce33bc,0x009cd6e23f9ae75d,0x00e4c41b8aa23b8a,0x00d8e69cc0a64f12)},
+  {FIELD_LITERAL(0x0003174ced16a592,0x00109522afdd9fc9,0x00567caeeeb00677,0x004082c77381ec4f,0x00af0cab59e652bb,0x0004a3996f9f6ad8,0x0030fba058ceffc6,0x0082f0ad9a1e7da3)},
+  {FIELD_LITERAL(0x00f69f4bea545d4d,0x0068f498dc4c76ff,0x00a1f1adf28880ca,0x00cadc36ddb07288,0x006865033cefc4eb,0x0036c946d0eb54c0,0x001d8b04890aa66e,0x00c17c6f7d5c625a)},
+  {FIELD_LITERAL(0x0071fd1735eb51c2,0x00b6132db859cef3,0x003545c84f9fc332,0x001275ee110cb3d9,0x0027a03f98e1ab8c,0x001b6140de4dc08d,0x0060421d971c68ba,0x004a1d85b1946ab9)},
+  {FIELD_LITERAL(0x00f732d1e65e7ca0,0x00a021866089a79c,0x001add75d091787d,0x0071d8ffa33c58ef,0x00c5288a1cf96647,0x00c13829c0cee99e,0x00b0e108f8a0b1c5,0x00165a189bda0155)},
+  {FIELD_LITERAL(0x00d60ca36d84a639,0x002ca7d1f03db9f3,0x00ff5ba7c7f5d163,0x00ba5470a29612de,0x002d3b6a8faa1e44,0x0042015f66dddd42,0x006c636b06694907,0x002dcced5242ae82)},
+  {FIELD_LITERAL(0x0030569cd59f70f7,0x0028387e87a3cd62,0x00b21473a07f090c,0x003de4343471a43e,0x00cc201f6a1aca05,0x001df19f0316a3b3,0x009e8bd2e3b99c27,0x00b83a653b995f39)},
+  {FIELD_LITERAL(0x00c670d16bbf3040,0x00254685189a3449,0x00b02b1f10163244,0x00f5241c47cb1b88,0x0057eda085e08860,0x0071a27a69c2a968,0x00e57b1e52579b76,0x0085f7dfafa8cec5)},
+  {FIELD_LITERAL(0x0010d65e2f5de405,0x00a76eb1337155db,0x00fcb7a4a35f7d26,0x000ca0616685573f,0x00565ff564429726,0x003eb048604fcff4,0x00b435497b58e61a,0x007e3620f7c386bf)},
+  {FIELD_LITERAL(0x00aa92078a122381,0x00a6a6d87d69eed1,0x0048168d15e5d018,0x009141ee3b3f1a7c,0x00a0cf5958e35f0f,0x00e559b1fc2689f5,0x000682316d890a20,0x00bd0e58273a4012)},
+  {FIELD_LITERAL(0x00aadb987201269e,0x008d0b4fb46b2c68,0x00a907eb66c8102b,0x00489269d039bbe2,0x001f0329edb8bd2a,0x00b084881ac02ec4,0x00e27606a3fe7c30,0x00f46a385e0a974d)},
+  {FIELD_LITERAL(0x000be5f1a56f309a,0x0042df70e9efe289,0x0016e7d1386da357,0x0072d850fc6e9fd9,0x00f214f7bbc05345,0x00e58e3fbca4fd51,0x0021fb5854784ad3,0x003234fc19a2db9d)},
+  {FIELD_LITERAL(0x00f41f53a7239cf7,0x009065e95845b346,0x00d78ec314195c9c,0x0082db5247317cc1,0x009f50e81a7d6cde,0x00da868f9d3fb34f,0x001a8f202d306ee4,0x006de8469990db1d)},
+  {FIELD_LITERAL(0x00efe4996da861df,0x00c3858fb9862a62,0x00198d8ce813f9c0,0x003be8a920fbac47,0x00582142d3205a6e,0x00bad504e1116761,0x00507b101509e540,0x00ad2cb9a5ce35fa)},
+  {FIELD_LITERAL(0x0041d255592799b8,0x00596bbb3673d98c,0x00ac501c74bf1eca,0x00c0a0c436b991c7,0x00a6236c689e3551,0x003f03f64277979c,0x001e96b3a65d70a0,0x00bae6b933d23818)},
+  {FIELD_LITERAL(0x008942a42ae36c77,0x003e1c2b3ef18e98,0x00a7c28e4aee0dd6,0x004b800f3fc74d4b,0x000b1abb6af6b585,0x00b9b79de49c08e7,0x00d7d67793190a0c,0x0043f23985414d92)},
+  {FIELD_LITERAL(0x008b368b944dbddc,0x00ef9ad4a0990d68,0x003c5f308fd9a81f,0x001aa8008a83a766,0x000c376c5743372a,0x0068bac7fab395ca,0x0054a3c569b67abd,0x0056654953da6d99)},
+  {FIELD_LITERAL(0x0031922720ac5e4a,0x00fd473b49ab3271,0x0075bd22f7160be9,0x009b176fb95c0c95,0x0041fa730aa353d3,0x00c9e436bac49bb4,0x00f97f79d47e0b97,0x00ee7033c27eace2)},
+  {FIELD_LITERAL(0x00f4221d0e548178,0x0065d4a4a2d1ccba,0x00ac4c0c6715925d,0x006592778ba6e96f,0x00736f5a99631bd7,0x001cbab43e4bf8da,0x009d267b3268b7c4,0x009c5aa2bbc7d8aa)},
+  {FIELD_LITERAL(0x00faaaaa0795fc3e,0x002eada6f4bcaa89,0x00570ef565eb23a5,0x008efa4689b6688e,0x00a595156e18262c,0x007cf6dfee480616,0x00da3b4392a95e62,0x00a801fc74ea85ce)},
+  {FIELD_LITERAL(0x0021e579d0870bba,0x000654d1dd135ebc,0x00c08d98268925e9,0x00505e4b54b0838d,0x006ab7f28aaf1e9c,0x00af3caa16fba36a,0x0045c1d7295e8e8a,0x003a83403235e9f5)},
+  {FIELD_LITERAL(0x00bd8504b5ff80fa,0x00cc2fb7d890b031,0x001bf593be7721f2,0x006f583819a0e93f,0x0062cf136a776e80,0x00b45298b831744d,0x007c18a18ba71100,0x00337270edd013b6)},
+  {FIELD_LITERAL(0x000b29ae45263869,0x0074713b06dc45d1,0x00cfbad07b96a5dc,0x00907ee3e2e53d75,0x003fd72010e40ef4,0x006b048123064ec9,0x0015c7651584165a,0x002c5da8417463b6)},
+  {FIELD_LITERAL(0x00f016941d3e960a,0x00f2766623d440a6,0x0009a691d842d435,0x006bab5ee97dafa0,0x00fd2639b717a0cb,0x00556a244ae95942,0x00022f8fc5ea18b5,0x004609fb0316e21a)},
+  {FIELD_LITERAL(0x00f2f1ad4f843d55,0x0025e369cc865203,0x00241358c560f4dc,0x004c530c74bd7feb,0x007bf2cb147c9a61,0x00a5123c13a64451,0x006de665a3912305,0x00c7696fbe002e5d)},
+  {FIELD_LITERAL(0x00f30ccbbffd88d8,0x00f18f1e5bb1a93f,0x002429c0f6401af8,0x00f14f03e286f3d6,0x00de658ed523a0fc,0x0010fda06f1957cf,0x001294e808d6a3a6,0x0071f7758a22d217)},
+  {FIELD_LITERAL(0x0067ac84789c8ecd,0x001d715a1099c678,0x00294d159fe9bcaf,0x00268b7ea7142463,0x005edec82df336b2,0x000fda35e3a456e6,0x0004e9624039ef53,0x008ebf1e317c709b)},
+  {FIELD_LITERAL(0x001221259095ea14,0x00c9599c29a788d9,0x0053ba753cf7718b,0x006b6685d82b655b,0x002c56c63cbc75ea,0x00557b2bf0d1dc7b,0x0051172cff0a4ee2,0x002795cd9904f28c)},
+  {FIELD_LITERAL(0x0057c7df83bc487c,0x001b2faefefc6249,0x000d42fc26ec5f68,0x0081be412d6e0c3e,0x008c5233e807d6bf,0x00b982e121f5c2f8,0x00d2d8c0e013c9bb,0x00e1347b3951f8b7)},
+  {FIELD_LITERAL(0x00b5f9a57b4e0c2a,0x0055ac5d76e59d48,0x001d3d0180ede142,0x0091d906623f4b29,0x006fa8455c472a21,0x00741cf917600e46,0x00f57adc4e330a67,0x00c8b7e937ee9603)},
+  {FIELD_LITERAL(0x00e3b527f36ae706,0x00e1e630b5151250,0x00993fc970f7b0eb,0x0019979e7e8bb3c0,0x00b3b5ec0ee244c1,0x006204851295af09,0x0080d83a141f1302,0x00611f4725aad6ba)},
+  {FIELD_LITERAL(0x0010996879c0e715,0x00b9f752ea74b9ee,0x00fb1e941990e456,0x007f62d1f37c3164,0x00d1c51d48ff2db9,0x00ec818229bbaf76,0x004bdcd1946c1e8c,0x008235fb273e49c6)},
+  {FIELD_LITERAL(0x00ddefcfae7e1c8d,0x0041e884c3575907,0x0072f1994e39dca4,0x009715829bf6f9c8,0x003a2b796c446084,0x00e4b6d406b23581,0x00461f8861242730,0x003b7f4864e43aec)},
+  {FIELD_LITERAL(0x001ac1d2487b2197,0x006f22a594d08dca,0x00a35b3572f6c128,0x0090ef2058b5a2d5,0x0087414443ee0b6b,0x0076829906c4263b,0x00beb6435301e864,0x00eda9dceb9589c9)},
+  {FIELD_LITERAL(0x00437ba3bb804050,0x0042a2ba0442b8b9,0x000fd0183366355a,0x00fcfa1a36ed6dfa,0x00022372126c0a2a,0x0002e33cb0d76a30,0x0045e31dd26cbd3e,0x00e95efc6002b8ea)},
+  {FIELD_LITERAL(0x005c7f236ea12460,0x00f03ddf10110cfd,0x00d5718ac7d821f7,0x00fc4cff923ea69e,0x00958e8775953586,0x00c4ea6eab907b6a,0x00835ce394c58f41,0x0088dd308c495487)},
+  {FIELD_LITERAL(0x000b13a3ee3c4095,0x00ce8e9eb8b7692e,0x00282b86019f518c,0x00734e699e520f72,0x0006152f6af711d9,0x00887e8900631a01,0x00c6793f3959b16e,0x00a0e2e52183ad19)},
+  {FIELD_LITERAL(0x00eeae677e5b8f34,0x00bf49c1c7127a1e,0x00c08ea3042646d3,0x00815ac8d939ef52,0x00512bafff3d0a49,0x00a6290d14c9adca,0x000794d6f6b499ee,0x0093458edabc8294)},
+  {FIELD_LITERAL(0x00e8248e167c7ef3,0x00fd12c7d5e0ade5,0x003d2b4547e15639,0x007e3a2f8d8a0c2b,0x005eda1ddc61dbb7,0x004b25b1ce3564ab,0x003309975a39febf,0x00e74dcb840a0da9)},
+  {FIELD_LITERAL(0x0098c268b152b265,0x00f3f1d314a5b4a0,0x005506c7469ecb65,0x00a4f6ea7f840bb4,0x00d5855fa32d087e,0x00ce16a1507711d6,0x004d8d4b201d9be4,0x00ef717eb1f01311)},
+  {FIELD_LITERAL(0x008b544aff88bc2b,0x006ac3a94f8a71f9,0x007c0e5055e32e95,0x008a5e671934387d,0x0083bede2431b7b8,0x00ff952d02d3314d,0x003196bbf4f30bfe,0x0057fdd0db7c01e4)},
+  {FIELD_LITERAL(0x002289610913b828,0x006c5536aab3cf57,0x00da2c46f651bcae,0x00df283cbe5706a8,0x007c2cb3897632b9,0x00ea7c810ca481e0,0x00e3f0d3d726ed4a,0x007f72ad90e99954)},
+  {FIELD_LITERAL(0x0046c6b892c7a9dd,0x0013733653a5e8e6,0x00bf4613b918be58,0x009baf61aeb2ef02,0x00c7c7990daf019c,0x0013662a28df18b4,0x00c24210f27c5c21,0x005d7429226e1035)},
+  {FIELD_LITERAL(0x00c7e5df136becd8,0x00fd3379557f0ff5,0x00ca07e9fa679543,0x00e2e6401c2c46f9,0x00ea473b51666d9b,0x0016a5b5b2eaa25c,0x004a770d0ac64877,0x000fb39de8ffcdbc)},
+  {FIELD_LITERAL(0x006ba079a4cc4219,0x003ec649ea5726f1,0x005b4348d7c8438a,0x00db44132bec95fe,0x008b79eca0289380,0x00128e774672d3c9,0x005aba248deac68a,0x00d9b9c00da28c84)},
+  {FIELD_LITERAL(0x006c9557dd0605a4,0x00011b07a6053f3e,0x000644e9769f95ed,0x0054cb5566515367,0x00a9c185a1df6c54,0x00907082df9e674f,0x007224043c91945e,0x00159faa00121026)},
+  {FIELD_LITERAL(0x008188118a13b0ad,0x00dac414a6ce03db,0x00f3483d8d0be4b1,0x002cc5ec3e88c08f,0x002acefb05da5f83,0x0013d86d1a32928d,0x0096c9317e46921f,0x005e27bf29e20c29)},
+  {FIELD_LITERAL(0x0051729be7c769c0,0x00b1a5bd13cceb4d,0x0029433e671fb2a4,0x007a2bf91d3c7245,0x0033db89bcbfa6cd,0x008ca743839ed7d9,0x0033653b42abbff6,0x00d736daf454f035)},
+  {FIELD_LITERAL(0x00699b0cacb7a5a5,0x00245c34bfeac005,0x00e7e16fbcfe4d3c,0x00c481d35d14e118,0x000ca7567a7a5eb0,0x0009aaec7b0083b9,0x00d2a4391dcf0f58,0x006d882d44bb9c23)},
+  {FIELD_LITERAL(0x0058318cb41ae2f2,0x007e7e6136e8d41e,0x0006069503f4c203,0x0031dd71c2daae98,0x0076d0676248774e,0x00eb8f5c62ba3799,0x00d6a9adb44b004c,0x008fd05aff002aa4)},
+  {FIELD_LITERAL(0x00bdfe32d2902624,0x005b99e6b3724b6b,0x00f2eaf9a295f208,0x00930152c1fdbfe8,0x00f8c6024472af97,0x0045198024642711,0x00fd9b498a7b04bd,0x0079dab4e29725a9)},
+  {FIELD_LITERAL(0x00fba0be02170242,0x00d2c68c1361fcd0,0x00bb21ea7afe3151,0x00d970848c81000e,0x00aaece7210789a8,0x0047f55949eedf9b,0x00c897c2c7ca099a,0x00f05139234d2140)},
+  {FIELD_LITERAL(0x009bbbc74379b866,0x00183f7f1fb2d62f,0x00ec906dd4e2483b,0x00a4310b225a126f,0x002714f79505db9d,0x00aa6b15cb7639b1,0x005eb670f4eb3df4,0x001f404c747d4e5e)},
+  {FIELD_LITERAL(0x00683d0995078411,0x007e28fdce91280b,0x006445fa39c4ee48,0x0008b729c0941ecc,0x00fa80c95804c3dc,0x0044b929d5a3ee7b,0x00b523907886701c,0x00aeab3448cd72aa)},
+  {FIELD_LITERAL(0x00c12742dd04c07f,0x002dd5b924f09c92,0x00fdf71502bce4eb,0x008d723b14a2a727,0x000103643c02cd35,0x00a1e0e963b21a1e,0x00ac61be317fe6b2,0x00eec7e73d8593ac)},
+  {FIELD_LITERAL(0x00ecb0f6536529a4,0x000144c6d33f8d22,0x00907e77ce4a6b81,0x00afceddbeabf680,0x009d75d77a808f26,0x008e0f42339428e5,0x00ab460a93366fe5,0x00c564434bb14028)},
+  {FIELD_LITERAL(0x001ed541b588ea0a,0x00f69a7bccf4c997,0x00f5902b3acce6db,0x0026f2f36d9ea2d0,0x00d2aa1100b464cc,0x00eea1bd20594435,0x00f5e8cf77b8cb5f,0x00354d7527a35151)},
+  {FIELD_LITERAL(0x006c048e7353b5a8,0x00a52b7cb74bb42e,0x0002e18ef543e7e8,0x005fc8803f30beb1,0x00e04d33471ec891,0x009ed3873d90c1cb,0x001139c036cb56c9,0x00647f622b25fc98)},
+  {FIELD_LITERAL(0x00709cf8f5642b4b,0x006f754a7a61e81d,0x00d47678efcc7421,0x00c8be9d38fcef3c,0x0017627d32b9fc57,0x00a93acc6bb9b2d0,0x00f1db62c63254ab,0x006acde7692fbef9)},
+  {FIELD_LITERAL(0x00b8f80564f44474,0x00265c4f4baf895b,0x00cbbd19f25968f0,0x006e53a0c69f0618,0x00fe72c9a5778129,0x0073af9e2c809b18,0x00ef090e7c8781e2,0x00138cfb8f84afd0)},
+  {FIELD_LITERAL(0x00082fa17527f53e,0x00d2b06b5b9c381f,0x0060876526b93489,0x00b7f73dba58668b,0x000302392226cb6f,0x00ed21733d172691,0x0012ad453715a03f,0x000e6a051444d0c4)},
+  {FIELD_LITERAL(0x00185c9a32f5f334,0x00f6e6b34d15e719,0x00a3672bee52f10e,0x00b79235bda88747,0x00c3d22ee8fa343e,0x00de764dc1f165ff,0x00c150e3debbc9c7,0x006f31aae4ad0762)},
+  {FIELD_LITERAL(0x00699c7ccd751cc8,0x00de3c5c4f32cacf,0x000eecf3c84e4465,0x00fe8acab609ead1,0x00898a3fe9ed5588,0x001fc76d44c7b51a,0x00c67260e2a60d35,0x00aeee90498c9565)},
+  {FIELD_LITERAL(0x009d376a507f2ec0,0x00ff8cfaeb3c7d03,0x00b96586eb0b48ba,0x00f8fe67bf18448d,0x00ccc3796dedef45,0x00c0ec2129000c80,0x008830a41cfddf06,0x000521d8a85d105e)},
+  {FIELD_LITERAL(0x0034871b84091ba9,0x0001140e569fbbbb,0x00e792ff2790c842,0x00b9d8b2c03c5f5c,0x002ecacf3934e20e,0x00321f1199312246,0x008a56b3edd20dac,0x00c6bbb2fe7e0d86)},
+  {FIELD_LITERAL(0x00d7baf0d2b91c40,0x00cf2d020198c495,0x0005dff87a2f94a9,0x002e488290e390fb,0x00f6041e19f0a467,0x00f992ab8104d3e0,0x0074e1c888d2c903,0x0051bb10f23cf9e5)},
+  {FIELD_LITERAL(0x00d5716523f1951b,0x00b5f78950c5dfa9,0x0084a5590a8d75b5,0x006fdc19ecaa8ff9,0x003ec7dffe8eecee,0x00613d5e4841f219,0x006ab0572d4f86f6,0x00978e8c6e932421)},
+  {FIELD_LITERAL(0x008d4e09c9a2ac10,0x00d7e195b8cd78fd,0x0018c8f141dbb4a4,0x001fdc910154ff50,0x00b3551cd31d2fdf,0x003c98393106c306,0x0007f0daed51bc1d,0x001f86347e4e7f7e)},
+  {FIELD_LITERAL(0x00cdb87fde9bfe16,0x00702ecaf502101b,0x001f9e651a48b649,0x00205acedf7f3bb7,0x00ce09563c4ff83f,0x00f108d69ee41ae9,0x007589809456071c,0x00d8c91543f64122)},
+  {FIELD_LITERAL(0x0016b73e5f0aa89c,0x00605014eee677e4,0x00c52498b6a8ceff,0x00308cb0bf468685,0x00ad19403a1b6d73,0x00a45b414989fd46,0x002bfa9ad203de99,0x0097d22e7e2d6952)},
+  {FIELD_LITERAL(0x008fdedbac70ded0,0x00eb1e34ac3c5842,0x00df8992a585fa2e,0x00497dd12158e725,0x00b7250c5c800171,0x00e794d3aad9b819,0x00339feef9da5403,0x0089d21a988dbc14)},
+  {FIELD_LITERAL(0x005b989e67f2c60d,0x00b37d6ac9b874a5,0x00732bdc2f86bafe,0x006ca6bf55894053,0x0028fc27cb375eb6,0x006cb2a7c17e9562,0x0056417943c79f19,0x0068e4c6a0186c65)},
+  {FIELD_LITERAL(0x0022df627f4cfcac,0x006848eb0a167a9b,0x00bf42151ea9a67a,0x00b82e94b765bf28,0x008c03f580d2e768,0x009c6bf302b1904f,0x0023030412192d24,0x00ccca3cc4edee9c)},
+  {FIELD_LITERAL(0x00829dfc704750df,0x00a2c9a90ceccbc5,0x001ef1f426402ce5,0x00a2a71cedcf7fc2,0x00c298de3cf4a1bf,0x00e42a62f8a53855,0x003334d30b557eec,0x00433333f0a6c024)},
+  {FIELD_LITERAL(0x00369aa6320ee3bf,0x008bf72d659059a6,0x00a17a62f1a2aaef,0x0095a66e74c0749a,0x0086a800a5531c6e,0x00f71dcf310d54ff,0x00d487ea3a5bc414,0x00b8465eae890704)},
+  {FIELD_LITERAL(0x00c36d3589d781ce,0x009ae2766706604e,0x00bb2fe4fa807217,0x003dab6e775cc3c7,0x00ed211ba8ef3baa,0x00aa5aa6280fe0ed,0x00e76f16da7bd960,0x00f8112a77168598)},
+  {FIELD_LITERAL(0x004ad14c8cbdeaaa,0x002e224536d9f4df,0x008ce87d11b67717,0x0052908915c10744,0x00a3ddf38c2ccc8d,0x00df4712520aa0b5,0x003099b719b1d49d,0x00bb79071bae7a5d)},
+  {FIELD_LITERAL(0x000836fef034b63d,0x009ef819b2f9476b,0x00b561c0e306bf84,0x0013f34d23312690,0x008fc3def9444c28,0x00b529a39f713bd5,0x0074c7a09a26b189,0x00cca035efd53931)},
+  {FIELD_LITERAL(0x00153f3de38a65c3,0x00f171bf64700f4d,0x0010848487415e8e,0x00ba98b823f74eb1,0x00304d24d72ba262,0x00ba0d79f6b006e4,0x00c325f00ee0e2ad,0x00719a599ce8d744)},
+  {FIELD_LITERAL(0x00bdb3a5d677abba,0x00cb0bf40812d69c,0x00db2f31a69e1960,0x008261e5f0152912,0x00b6be713e3624f2,0x0065059be6438f03,0x00039d3c1864b58c,0x0079ca476b7120c9)},
+  {FIELD_LITERAL(0x0023a764d8ad1103,0x00cecd425e76c9c6,0x00b8c15bb1b4cbde,0x00e428ba2d5ee747,0x00c0f073805125d1,0x0035c269cc011e76,0x0036f46e71ce6a7c,0x00e317f1bc5adb26)},
+  {FIELD_LITERAL(0x001ece6b180e9d27,0x00e595fc3438fb9f,0x006ad206fd4d8835,0x00d5d6138df2dc4e,0x004f218c1645a2a2,0x00326abc56b9fec8,0x0026c99c8fd7538f,0x0070d52dc731524b)},
+  {FIELD_LITERAL(0x008c67083be5e02e,0x0055ae0398b5362d,0x00d03f945ab3274d,0x004b1fd20ba740c9,0x00b66beab39b4d18,0x00cd2cbe9580ffb5,0x007cf745f282ac47,0x008b9be91126acd4)},
+  {FIELD_LITERAL(0x0039feccfef34844,0x0009a7370c5945a2,0x00e0dea322feb750,0x004bd9021cd4e266,0x0058a21905216ada,0x00922d6d0bb858c2,0x001470c3c0ddcc1b,0x00eed89350b52c16)},
+  {FIELD_LITERAL(0x00d63dc159f3064a,0x004f4a98f2fcf838,0x000db4675692972b,0x00e93b6e19292bff,0x004bd5fb32d44886,0x00633ceeb7bed8f0,0x009cbc75ba6d7350,0x00f837b5399e082e)},
+  {FIELD_LITERAL(0x0010d6ac2465fc6c,0x00b2c098adc553bc,0x00e85750f71b80c1,0x00193362d44fdea9,0x0078de858c1840d4,0x00328c38fc3b2066,0x00dc32568c168fb0,0x006b902fbe3144d9)},
+  {FIELD_LITERAL(0x00ac082033115351,0x00e468cded48e3d8,0x00c6132588f8d6f5,0x000b9313a7790615,0x00cee98d1cc18f00,0x00415ed8d8f06846,0x00200fef7e793b06,0x00a072560e45047d)},
+  {FIELD_LITERAL(0x004ae486057bd8de,0x00cb9c34ad15146a,0x00dc15a49c354605,0x002c4a1d68015bce,0x00fb2d9f39c76f3f,0x0048bfb6db54d7d4,0x003f07e76efe0ae5,0x0040a25e58f90d9a)},
+  {FIELD_LITERAL(0x0006d6b7efcd4e17,0x00a3eb6b6d495535,0x00200a6a3e3a0fcc,0x001e5842e5f7e730,0x00e3ce000e3ce000,0x0068dd03e8627e34,0x00d2f697b34f81b7,0x00ab20a6438f84dc)},
+  {FIELD_LITERAL(0x006ee57c4acb633c,0x0079f951f4e5a713,0x00f786899e6f9b06,0x008cc5da8ca06e2c,0x00f5bc2182f61262,0x00ae07450c973a97,0x00c3745990805570,0x002c5acef4042bf7)},
+  {FIELD_LITERAL(0x00720b5747fcf950,0x0045363f578712c6,0x00d55c01ef38d196,0x00348f9ebb9387b1,0x00845de4fc6b4556,0x00ab7ff0bee21370,0x00083cbd8a24e382,0x003e426736a7d5ba)},
+  {FIELD_LITERAL(0x0078cca7bb16b4f2,0x006116f732755e3f,0x001eb75f38e4507a,0x00d5d69112db76a8,0x0045244c94187b79,0x00f3e18278c141eb,0x00bfc130970f2540,0x00a8a92134f48cc6)},
+  {FIELD_LITERAL(0x0041e90f377ec65b,0x00a0ff1a4a7ef144,0x00a94862e334903c,0x0050a5774a433484,0x002c5219f9875045,0x0085f56ed8c66bab,0x00748762d5c213a0,0x00f46e9a10a2c256)},
+  {FIELD_LITERAL(0x00902d2521a120df,0x00890938faf5aa48,0x00e45f6f8dd6ce3e,0x00cf51b2b16234f4,0x004b1242d2b0cff5,0x00c169cf470add59,0x0011a96f089145ee,0x00da5214d7bfc9a2)},
+  {FIELD_LITERAL(0x0033db9c2475af93,0x00bdb4562d4b938f,0x0033a88ade676e88,0x003cb28f508daedc,0x004864d775bd83a3,0x00649284d53e9d96,0x0055dbd57dce0ca5,0x00137f1edb891ca8)},
+  {FIELD_LITERAL(0x008a318f6db520ef,0x001f93d7ca0ec6c9,0x00711cf7660f4382,0x00dda6176780315a,0x002f2998011d512b,0x004279de65fd15cc,0x0069f706a6dea0a2,0x001c09bb68b0c35c)},
+  {FIELD_LITERAL(0x007c935ad057fd10,0x00c54db453b5d0f5,0x00944bda397f6205,0x00c94b8e46c148b4,0x0002d2acd410d546,0x00fa11d7d48265b6,0x0077433e32fdda84,0x003c53c9d093a9a4)},
+  {FIELD_LITERAL(0x005448e912d9fb59,0x0004f9c49100dd98,0x005a28d07214b936,0x004d12624d95760f,0x00fd1fec49bbedc5,0x0038def856ce10f8,0x00fa414cf5cc8dd0,0x00cbb70125ff21a3)},
+  {FIELD_LITERAL(0x00bc6aee6b24b7eb,0x002d66753b26b312,0x004d68272083a9ea,0x00e127b1bb816031,0x0079927b41e3a083,0x001b9dfdce2e879c,0x00bfb79db3e614a0,0x004a86837527a5e0)},
+  {FIELD_LITERAL(0x009e613afa2c825d,0x00cc3b133127b7d0,0x00de530db26f4f11,0x009f695665a815a7,0x009b3b84948372cb,0x0015a0c775a0143e,0x00dba13887863898,0x0025085ebd5e51da)},
+  {FIELD_LITERAL(0x00a4f6f5bbe8891c,0x0097403ecccef26d,0x009138169f6c46f7,0x002f3596b66f6520,0x002fe7a64c35e2c7,0x00c969b06642cc64,0x001a3088e1c85996,0x00659e187e5db537)},
+  {FIELD_LITERAL(0x006f2311ef067ee4,0x0099b331c01d0aa7,0x001017344bf623aa,0x005aedb4001a889e,0x00a1ca0be9ea6606,0x00911014e9d1a0cb,0x00ecd6e3358692fc,0x00c6b58e88d1f6e4)},
+  {FIELD_LITERAL(0x00f6f65cf9e36e79,0x00ff46c3ff50d638,0x0042c10fce4b3a19,0x00aafea60aed7bb3,0x00c19c372c6a9208,0x000b8d6167f823d7,0x001bb4d9e1789a87,0x00f29374cbe475fe)},
+  {FIELD_LITERAL(0x00924b6dddd397cb,0x00a5b5354e8f7162,0x002b9a1655b404d6,0x00361a32c9aa7ced,0x00ee3ad9a342b9cc,0x00cb018568b110e4,0x00e3e3f2d34b45ad,0x002976037c0164f8)},
+  {FIELD_LITERAL(0x009476ea785f3a3f,0x0027e558ab0d33f4,0x004329b9520756fb,0x0078c3eada96ad9c,0x00a9402db2988fcc,0x00b68848b508d9e4,0x0015f6cad32dd3e7,0x006487eeb0ad58e3)},
+  {FIELD_LITERAL(0x007a54b27adc0d6a,0x007670e19c4bd2db,0x0078281f1e307bbf,0x00e7cf5e2499c3db,0x0056f37d3f7c8dd0,0x003117cd22a518e9,0x0038a2572af1bc74,0x00ceac85f17cbacb)},
+  {FIELD_LITERAL(0x00d22e83879b00eb,0x007d6d7ffd17ba16,0x00f098c64b62d394,0x00649d43c65d7f0e,0x003e9fa912db7ca3,0x00547334eb546868,0x00e5ed08fb316f7a,0x00599d2fe94eeaf3)},
+  {FIELD_LITERAL(0x006207692192eca7,0x00f16532a2c12562,0x004be2f135a72168,0x00633b4e7d9c4b83,0x0044a710a0ada1d5,0x0056326072ed6673,0x00444da48bd33640,0x001801705afc5c51)},
+  {FIELD_LITERAL(0x008a5d825c8f6c6a,0x005395837a0ff6e9,0x00222c812e79c799,0x000bf7728b6d0101,0x0097af85b85843ae,0x005ce571355ddf6d,0x0014d60a0b1daa21,0x00975dc3967025ed)},
+  {FIELD_LITERAL(0x00a4e34dd4a16f0d,0x00f4ef21cc877cfc,0x00d78677555af4b7,0x00cd1f82f0cc049d,0x001fbbbb6532f3c7,0x00e4e54586f75c25,0x009ec1fe28be7800,0x00674453a7ecd5a0)},
+  {FIELD_LITERAL(0x00cad374d27c7820,0x0061f463bb772a98,0x00f4228f169ef5d7,0x00ea4ebfb783bef3,0x003dad9691589f4a,0x007b757c23fef97b,0x00ac8e98b2841179,0x00fb24839b6943bf)},
+  {FIELD_LITERAL(0x006daac38410caa8,0x0081fb87be435b26,0x00010c304dc70af2,0x00d908281ad311e2,0x0079d915c9121b68,0x00132f0f3eb8ed9d,0x001b6321562a28ad,0x006b3eee028d674f)},
+  {FIELD_LITERAL(0x0048e66a9862c754,0x0056d78097536c3c,0x002cb336960fec04,0x006473daa9113ae0,0x00ae3179d2bbb81c,0x00247b251acbb6bb,0x00bd4147696980f8,0x00ed2fca9469396f)},
+  {FIELD_LITERAL(0x00d19ca6a546ddcd,0x004b6c9fea43e4bb,0x00f3a28589db8a29,0x0016ef545544a587,0x006e50f7291afaad,0x00239ce166354938,0x0017b8fa860085f0,0x001099c10a53eab5)},
+  {FIELD_LITERAL(0x0077fd4926fd7d25,0x00a44ed0915db003,0x00e6da036dfc72c6,0x00426d76d57b538d,0x00f287f9012bb528,0x004fecacd5ca493c,0x00954364fb61bd53,0x005b1cbfa87b991c)},
+  {FIELD_LITERAL(0x00ca567525aac5a8,0x0099278227886ee0,0x00da1c4b87e05385,0x005cc3db5af8735b,0x000d7db3e7b39900,0x004b4af8b11a58d8,0x008cab33b8970632,0x00f750d2d9c068b2)},
+  {FIELD_LITERAL(0x00fd11a124287ab0,0x00f5046ee691aeae,0x0032e79c6938f387,0x008d81d45d6ccb2e,0x008acd495c8f66a1,0x00fc1af1b6763191,0x0022f86e8b992123,0x0059fc9779f91a51)},
+  {FIELD_LITERAL(0x0078cef208ff66cb,0x00797b90f895229d,0x007691d07bc0234f,0x002d1404d58f98e6,0x0027c7bb0959242c,0x009587598fc2fd48,0x00de171bff45b0c1,0x0009150efa6e0470)},
+  {FIELD_LITERAL(0x000753366ae2867b,0x0008160cc314a220,0x0076c78b582c4c4c,0x00ea04399c26a40b,0x00d337403de84894,0x0088ea8b2caacdb4,0x00acbe7f1d088474,0x00009a7fd93a9727)},
+  {FIELD_LITERAL(0x00af536ebef76390,0x00b3920be931377f,0x00cd8fb5c89c9b96,0x00337f47aee41a14,0x00bc37a1f401a24d,0x004b6133dbb34f71,0x0005165a796834a3,0x0059c0ff032de5b4)},
+  {FIELD_LITERAL(0x0097023564ed2d1d,0x00d8b6e9346c9b5f,0x0013557f2e6606c4,0x00af728bac7971d3,0x0078b9f81ea34481,0x00e318a7852cd63f,0x00687a5fd8707aa4,0x00453648f14cacd7)},
+  {FIELD_LITERAL(0x00444cb96b4ec827,0x00370c22fb12f8e6,0x00cacbb85827d6dc,0x00bc882078f673f3,0x000ce56c8bc25ffb,0x00f1b399d45d7260,0x00f9a16fa8b1ea31,0x001428ee6b3bd084)},
+  {FIELD_LITERAL(0x006f1592eed07c46,0x0077135bc9f25ba8,0x008a34d7b9d6dcb4,0x00f1d959a77d4884,0x00af87e371f44a56,0x0071ad0f868ab08d,0x004742c8e134036d,0x005df7902b8d3c26)},
+  {FIELD_LITERAL(0x0066d9b4a1b088f9,0x00a2659d6cbe7e4c,0x009cdc8c8a96b48e,0x0019335188714ec4,0x00b959f01e42d681,0x004669712274633d,0x007651117f07eae9,0x0033358e9ab8817d)},
+  {FIELD_LITERAL(0x00f704d78d73661f,0x00339720ddbdffd1,0x00569f3f1267c8db,0x0082cb85259cba99,0x002885cd2254452d,0x00c3388ae76b3b9c,0x0004d2305dade7d4,0x004eac324f7ece60)},
+  {FIELD_LITERAL(0x0022a03f623f31e9,0x0021a2dae842969a,0x000114713e624911,0x009e8194731f88bb,0x0003ec033c65afe9,0x0065a920805bee32,0x00674357818f9ee4,0x00d13c0c6527eb4d)},
+  {FIELD_LITERAL(0x0056c498c8bd773f,0x004518242bf15ed0,0x0046dc193d0fd732,0x00e0b70bfa9908e3,0x00375300d9f6cf83,0x00b50d0a1d8bc783,0x006de20334e91b6b,0x00ab704bbb7489ff)},
+  {FIELD_LITERAL(0x000fe8e45da5ac9e,0x006df1f4e23f9146,0x00f06e0631db05a0,0x001886378e7c5bdd,0x00400e20e05ea552,0x00bf83cd991cdbf4,0x00255a808a8bab79,0x0028dd8969f894b1)},
+  {FIELD_LITERAL(0x00f22f61ffb302e3,0x000492a0dba1ace5,0x00d594edfd0d2235,0x00b80c596e957d96,0x00927d6e377136fb,0x009444c7dcd7fb89,0x0052fa2874bc81f7,0x007785ddb0cb9abd)},
+  {FIELD_LITERAL(0x009ee3aa84a74062,0x009215bd94c6a46b,0x00d564298126a3e1,0x005ca45513ccfa2e,0x003b42c67394c907,0x00b44cf8307b8491,0x0036588f35a926f8,0x0015197420b0cfeb)},
+  {FIELD_LITERAL(0x00ea22e56dfa0ba3,0x0005f5286ba9ef4a,0x000be812dda1bf8e,0x00a3e9059ff17ab8,0x00fd759843adf282,0x00dc33f53fc279a8,0x00d3a28d2f4daadd,0x00900839d16c88e8)},
+  {FIELD_LITERAL(0x0025fdd53eab17cc,0x00a28cb864f90188,0x00f0cb77469a151a,0x00595fee04f19b30,0x009dc4d0c2376c85,0x002dd9a03a6060a7,0x00212b9af1f2b93e,0x00140d7bf96e56ea)},
+  {FIELD_LITERAL(0x005c4b28d7215fdb,0x007a6265a1c31285,0x0006c908bca6a9d8,0x00745144074eecc6,0x00e95d753c359d7d,0x00bdf64f7bb09c5b,0x00507110f69fd6c1,0x00d6434fcc610310)},
+  {FIELD_LITERAL(0x00908cb4eddb7b65,0x000341d1bf5bc878,0x000cef3b2429dc45,0x007a7d5efbcec308,0x00d5533388284124,0x0039f0de447920be,0x001a6dd66c161a74,0x009dce39785028e4)},
+  {FIELD_LITERAL(0x00d06a497f655cb0,0x0079629e7fb6b974,0x00f8273dbe836ae5,0x00d23770e384aa0d,0x00e26bde0e6c84ee,0x000709cc03ff8b72,0x0012f486cc38f3f3,0x0018fd4e323b25a5)},
+  {FIELD_LITERAL(0x003a4baef649a7b2,0x003caa590b26d08b,0x00794f390a99e90e,0x006804f6a74bb4fe,0x00f3d99c23e1c1cb,0x00cc4a2deea93445,0x00c75e1296a2ff56,0x006ce9603d046fa8)},
+  {FIELD_LITERAL(0x000d399d3d7b10c1,0x00c582c2894de345,0x00c6ead8ac0a287f,0x005c2968c38198bc,0x000c2d9b673bf5ca,0x00b08ba43c9c70da,0x00fcd3d90343c216,0x0065f13fe26d5e99)},
+  {FIELD_LITERAL(0x00ccded89380c3a7,0x009df8bc0e2172db,0x00cdc07060b096c9,0x006bb7650e130ded,0x00ccd9e4d0944a4b,0x00789c73efa8fee5,0x00611f09eeeaa946,0x00c0e3b0e94b8576)},
+  {FIELD_LITERAL(0x00af14e8753100e1,0x007bb4c58fe34f0e,0x00a9dd778afdc853,0x004a07e429121c03,0x0073483205179e99,0x002bf079cd364bb9,0x00c0daea89c97dfa,0x002deda2249a9ad1)},
+  {FIELD_LITERAL(0x000506544ac3dcbf,0x0027b54e15fa1872,0x00a7fc2fedf748ae,0x008034a434f2ef59,0x0081adb17749d8b3,0x00d94c41012b03fa,0x00c44198c5c6bf08,0x00c597cbcde6e61a)},
+  {FIELD_LITERAL(0x00bc44312b0be6e0,0x003bb3993cdcddf0,0x009f1172cf86d04d,0x00331b99d2fc5875,0x0058f3d80f9a8ad9,0x00e24bec2eb4fda3,0x00644cc6a39ed27b,0x00ac23a591820666)},
+  {FIELD_LITERAL(0x007345665a86125f,0x007e89b2955c16df,0x00fe28bc28f44ffe,0x005b73ee27d858b2,0x00e3404b4f513d67,0x00dba76cc7e0e5c1,0x00cb08801a8b3477,0x006f1518506b6556)},
+  {FIELD_LITERAL(0x00421ceb461474eb,0x0077bbe4a57842e7,0x00ab3df0734d8723,0x00c802004657f742,0x007a0714b214862f,0x00ec847ba401a24a,0x003f77c71fd9bcd4,0x003d43fe48bae34e)},
+  {FIELD_LITERAL(0x00baeaf6cd9e38f6,0x00e2d0a8f66dad53,0x00bd14b4f90dc8e3,0x001da073439c649c,0x0019a45583c852db,0x0039a3390874b560,0x00f95703075a68f0,0x00ab87242fb0a993)},
+  {FIELD_LITERAL(0x0012bdfa9e5b2c7a,0x0085a98a1ec66024,0x001a2bd5217fc46b,0x00a1d904a278f17e,0x007664cc1707669a,0x00ac1da1b529e6b5,0x00535c1803d0e473,0x00815e247064d0dc)},
+  {FIELD_LITERAL(0x004996b3b4653029,0x00f6eac5ff8db2e5,0x008f5b6a302ec602,0x00fca88c68e01316,0x00ee61f1d2a2dd94,0x00c6d6da70882e3a,0x00079d787ceaa756,0x00e1a4fb1103a87e)},
+  {FIELD_LITERAL(0x0000abd62d13fb10,0x00c02b39677273c3,0x0065675d4fa3f34e,0x0083f60fd5224840,0x00da08c7f3122ab1,0x00b24de9899b5175,0x001c09012012b155,0x00fa52b7f882c574)},
+  {FIELD_LITERAL(0x00b1633cc15d345f,0x006a1f82dda1fd74,0x00b4a8b709fb104d,0x00d56ae89013517a,0x00bdd6458ba5fc42,0x002a89efd2f63ecf,0x00a09d5cbd64d8b7,0x007975fb0714a902)},
+  {FIELD_LITERAL(0x007053b66efa8195,0x007ac825267581a9,0x00013f1e7ece9634,0x00a8c36ee24eaf68,0x009a285df6a7d19f,0x0092439c69b98479,0x00c113e087a7f3a4,0x001e82091b567b19)},
+  {FIELD_LITERAL(0x00dd482a985bc532,0x00d25215d7a6c317,0x00b9bf595dae8310,0x0099d316b4a8a9e5,0x00fdf754cf180d29,0x00df9cba18e8091e,0x009cbbcedf498966,0x00256a8f33346a48)},
+  {FIELD_LITERAL(0x0051b498ffc68212,0x00ce092fb8ec40e7,0x00994ceb9170ea02,0x00df9c359511d677,0x00b480ce2647ea15,0x0051a58ccf71a497,0x00c1c9ef73379d87,0x00b0897e52f273e0)},
+  {FIELD_LITERAL(0x005bd9e0fc99f885,0x00f98f404def1fc7,0x003f83b5db7e3df4,0x00a3b2da91b7854c,0x00298a1316b36db0,0x0048fb88f8c4482f,0x0040dc8436204072,0x00da047eb34e21cb)},
+  {FIELD_LITERAL(0x003e5fa4890e77a4,0x0006ac087683cc58,0x00199c11836aee56,0x004ef42111524192,0x009414e9d4b1e289,0x0061dfa7350257b9,0x0097deb7057ff9a2,0x00ae9e891190c333)},
+  {FIELD_LITERAL(0x0029a7d43dceae64,0x007d264c4b69db3f,0x001c81d8866b9b30,0x0061735ba1eb2dcf,0x00a2b9e44b0a5f0c,0x00151f283a0b6500,0x00c1c1e75e7aa8dd,0x00c917bdccb0c627)},
+  {FIELD_LITERAL(0x004bc4d81d655c20,0x00ce864dad1a1768,0x008465b6f0103806,0x00d6236029b2ddd0,0x00bf0c74580728d4,0x00d3af914b0020b3,0x00f532b367cd1e1b,0x005eef6795714b37)},
+  {FIELD_LITERAL(0x00fbe4e4fa1d0052,0x00974186f70d9453,0x0058ef7d0146317f,0x0046f961946e7551,0x008dc250351049dd,0x008eab39573c45c2,0x0081d87ec887282c,0x00dbf7eff1308116)},
+  {FIELD_LITERAL(0x00cbd3ed0f152ad5,0x00db00df87591063,0x0062d2edd4b10603,0x00bed311319debe9,0x0059c8bb48cac778,0x00358e5b84ab4808,0x00887fac47965840,0x006c517b69547528)},
+  {FIELD_LITERAL(0x006c392460592bce,0x00e87160b5fcf499,0x00c89553760074c2,0x0070a96d5d8bd5a8,0x00f97fcf60819483,0x0011545dc2c81240,0x00f66dc259bdbf85,0x0001347cc9657c2f)},
+  {FIELD_LITERAL(0x00c201db332a5dc0,0x00c42b1cb4cb946a,0x0034d8057a74bd65,0x00dcb567720f34b3,0x00e945dece956fba,0x0077311ac3e0e7fc,0x00cdefd2fd217267,0x006072ff94be217b)},
+  {FIELD_LITERAL(0x00b816a93c797811,0x00047216d3b5dfb3,0x00cfd3b92b9e318b,0x0039e3a928333b50,0x008342ed73185d5e,0x0043776399c4c45b,0x00249daed6bf4977,0x00fb43bc4144ecfa)},
+  {FIELD_LITERAL(0x005180b770810347,0x008c8246b8391192,0x00a41fd8a4d1a73f,0x0087b0f2231530f8,0x00f4b9b02d99eb6f,0x0096a1882b73f222,0x00f347891b0f43cc,0x00b77376e9816d13)},
+  {FIELD_LITERAL(0x0079fb99d6cf9f2f,0x00c39f495aa917de,0x007dbfa3903f5777,0x00f10e8b0035dfde,0x00f7d43ad986b6da,0x00e9e9090bd1cf92,0x0097b81a0255737c,0x002976db1a05e789)},
+  {FIELD_LITERAL(0x000288b5c7be4e7a,0x007b9064f0616fc3,0x0036d71f22ae4c5a,0x00dc8a168fa7ec24,0x00cb9a0a2829c143,0x002c147f64959827,0x009e7adec137c23f,0x00602e1e41a1b7ad)},
+  {FIELD_LITERAL(0x00680443b200f877,0x0011f9ab49c04e40,0x00910eb1b95743d6,0x00ef6c9cb71756ee,0x000112d6ec668e57,0x00f125379c70b748,0x002846208b158005,0x00d3d860a2e5c09c)},
+  {FIELD_LITERAL(0x00eb252bda41071e,0x008f56c285c2310c,0x0084cdfafbd1d6e7,0x00738db2b1318e9f,0x00893f7e24621152,0x0040fca3f31ed37b,0x00d153f14a3bca36,0x00133e7f6ee0b392)},
+  {FIELD_LITERAL(0x00e69d8968a060dc,0x00fd4ae2113d37eb,0x008ab783f84f68f9,0x00290eb342800b64,0x009f67a6e60fd76a,0x003f36a59f6a9c62,0x00d927833338fa67,0x00228cb0f12a6f9a)},
+  {FIELD_LITERAL(0x0090061d180c3645,0x006e84975ea29ad5,0x00991f950c1b1886,0x009c98209c50d53a,0x005f329118224099,0x0081e8db810136bd,0x002e0bb3fc0bc7d6,0x00ed32c334f92797)},
+  {FIELD_LITERAL(0x004d21340e90b768,0x00a714ce0d02f965,0x002a0ba60455a22a,0x00f6b002c53e56af,0x001b9a3ffca74bdf,0x0025d1bb995fd4b7,0x007aeaa152794742,0x00267d74f9d706cc)},
+  {FIELD_LITERAL(0x00569bd303ec46d8,0x0032aae8e4c6e38c,0x007890d2d33f2731,0x007ce226a6b8b044,0x00dc6777a7aa9fc7,0x002e9ec941d2c4c1,0x0021cb156a21ba82,0x004067e824be1f22)},
+  {FIELD_LITERAL(0x007db2a07cd02110,0x00aabc1439a528bc,0x00dcc30fd7395de4,0x006ed00704dfa31f,0x00ca307366acc91a,0x0062b4ea852bfc06,0x0057c36ad7443681,0x0040f01856fe026f)},
+  {FIELD_LITERAL(0x0003ca44e88daa12,0x0050a84e17a54b93,0x005e796fe06746ed,0x008f73b78821d287,0x002af5bde05faec7,0x00f3faf4282dd780,0x00c37148ff195fa4,0x00641968474ae8da)},
+  {FIELD_LITERAL(0x00d188eb439328b7,0x0075ae51f4c24eb3,0x00a8827ccd5b9af4,0x00ccfd3d4ef5641d,0x008fe43ada4e506e,0x002b886500ee2872,0x00156b6f47bc9666,0x00a378a818e15367)},
+  {FIELD_LITERAL(0x00a89676be9ce73b,0x00438e87e8d402aa,0x000862d54d433b96,0x00a8f276f2913894,0x007b9dd4769f3eaf,0x00d2815efdb494e0,0x001974d5e8f1c9ea,0x00a896f2d0d0c53a)},
+  {FIELD_LITERAL(0x003f560070a01a14,0x00a41166dc6f5d48,0x0074c92eee4c64ad,0x008c4689f0f74ff9,0x0007041ea75d4b88,0x00a4919cc0bf6f09,0x008442abb1cd0093,0x00d95fec686a3eab)},
+  {FIELD_LITERAL(0x00dd6e140476fe67,0x0049697c864b1cbc,0x008db29371a6abfe,0x0075947896ef37a1,0x0079753e6a2f4f81,0x0081f930d89c334c,0x00ba98f9e97bd425,0x008d39dcae9f1bb1)},
+  {FIELD_LITERAL(0x004b792cba98194a,0x00361a6a09779fe2,0x0010a56e09ecf1f6,0x0082c2a54fd41464,0x002ea1c261621605,0x00c6eb66802f4633,0x0092150b3a0d69b9,0x00defb294a6184a6)},
+  {FIELD_LITERAL(0x005c42be5944406b,0x00c6a866a6529832,0x00f10a302720c0c0,0x005d92263adfc647,0x004f66909556f5c1,0x00354893ac297b2c,0x00d78073dfc24383,0x007ece64cf849e78)},
+  {FIELD_LITERAL(0x0075faf83fb7d4e5,0x0068c497cd6d0a19,0x001b0b46fcda435c,0x00c3cd38c831c530,0x00ab940e6c57dec5,0x0069672496a13fbd,0x00664f6bd7d6ee51,0x0073cf7cb390de7c)},
+  {FIELD_LITERAL(0x00b884032d753dbc,0x009b0d9b6ca28da2,0x00463305ab403ada,0x00af7da8d7a51684,0x0041e293ef31acb2,0x0070f7a881c3bfb5,0x004ac9af003c0899,0x00770db7d7c344b2)},
+  {FIELD_LITERAL(0x0013f55e9c7e2503,0x00c778eee1df7ca8,0x00e15d4b00ee3ba1,0x0058606aa6639c76,0x00731794237c2478,0x0024b8d439236af0,0x00a640b55c399fbb,0x001901a8a0c72839)},
+  {FIELD_LITERAL(0x007a3f6c48c2e185,0x0008af50ddb64027,0x0024109957eca029,0x00688dec55dcd526,0x0055f81990621842,0x006778af7346c16a,0x00f3a304fcb956a8,0x009fa265e09d9450)},
+  {FIELD_LITERAL(0x0058c8900cb64c8c,0x001436ea58a4fb24,0x00fb0aa0d869d38f,0x008cc6907d5570c6,0x001eb43618b5b5cb,0x000609d3469dd039,0x009239cd05c18c99,0x002ce94262a57c20)},
+  {FIELD_LITERAL(0x00f44b811a826e07,0x004ea93ecfa43af9,0x00cafb6083f52a1d,0x008f288d126f418a,0x00f8b37f06f42fa6,0x0083dcc222e0c156,0x00456245e5334850,0x00e5d97ffd17bef2)},
+  {FIELD_LITERAL(0x000431f663909515,0x0006a6e76b451b7c,0x00478a235971f0e6,0x00c989ada1e1deca,0x0005100b1b969f8d,0x00c77d6cd3edc721,0x00a84d71a783a595,0x0047c4f321073400)},
+  {FIELD_LITERAL(0x00eab47ebed28d55,0x00da5413991cbad9,0x00b2a1450f5de8bb,0x0055fe56dd65534f,0x00466dc536544879,0x0075c8c9cd60b53e,0x00c4f17275e242f2,0x0092ddb90fcaa1db)},
+  {FIELD_LITERAL(0x0094771ae7b92561,0x005735bdead51612,0x009a3b919fc72f6c,0x002390e298823736,0x00dd592b6c2f6cb4,0x00f534746cf131b3,0x006fcb9619903cee,0x009b95735648df00)},
+  {FIELD_LITERAL(0x003798a32368910e,0x00649415749ce353,0x00492e3ac038ceae,0x0040a8cffea81fc8,0x00836196002ab1ae,0x00b2bceaeea51951,0x0092571d5fdf32e2,0x0003ab0ba7702d51)},
+  {FIELD_LITERAL(0x00dbb04eee19f989,0x00d473aff8df2114,0x00c205b4b7cb958e,0x00d2b673b744af15,0x00e7df1ae9409331,0x00e82f9bb8db9739,0x00114aa9b4364741,0x00a04a8c66f9a336)},
+  {FIELD_LITERAL(0x005e9e46bad3f9ee,0x0016ecd9e31ea42d,0x000abe37df2b63a1,0x001962f7db309669,0x009120a4412fde58,0x0011d5a86145182d,0x0029a1e365f5c924,0x00c0055475d41108)},
+  {FIELD_LITERAL(0x00cf6cd65748ccc8,0x008dcd2e6b8ce4ef,0x00b5d3eba676646a,0x004e29d830cfbaa9,0x006ef5d3f1879ce5,0x00348a669a413c4b,0x00e7b34377174420,0x003ea0e38b7e8457)},
+  {FIELD_LITERAL(0x00cdd30ba945725b,0x001a76b4aaaed1a8,0x00c32f94d6d963ba,0x00de88917da00d3a,0x00b14271dbf45218,0x0040c5544d158d62,0x00c458a108356ee9,0x002bdcf585fa325a)},
+  {FIELD_LITERAL(0x0042e89e6fbcb2a6,0x001c7ed9e1524be1,0x009a59f2f9747d99,0x009b07022c1b6e3e,0x009d1b59d9489eb3,0x00072eb11293b0c2,0x000ce3e167e14b42,0x00fc728557787d79)},
+  {FIELD_LITERAL(0x00bf0f9914a2a268,0x00de95a74c5868e8,0x00cb6ad127de4274,0x00547b955302f413,0x00c09cf86b997954,0x0064bf6cd4e9aac4,0x00b4c4517f5705f0,0x00e0381d2c7074cd)},
+  {FIELD_LITERAL(0x001203603516e453,0x00e35832d14bceec,0x0051b09da6f8c21a,0x007619f875f6b246,0x0042df5881d52015,0x003237c036cb9d60,0x00c5d4cc95ca642d,0x002c65dd5958435f)},
+  {FIELD_LITERAL(0x00e8183b5d23fba2,0x0074b51e8c908963,0x0023505cddb68e46,0x00fab5c6d623205e,0x003d424a6522bb7f,0x00b7343275ac93d4,0x00d193c16121a538,0x00f910c56d1981a0)},
+  {FIELD_LITERAL(0x0030eb85979ca60e,0x00740cf2244e6839,0x004a2e687b2b25e0,0x003a9f736535f6fe,0x0094af517e8c5a42,0x00cec1f938746b00,0x00137434f2284fe8,0x0023ea9c6bc640c2)},
+  {FIELD_LITERAL(0x00c2b61f0437d192,0x0005eeea2ab409ce,0x0038d878abd7f525,0x00185995a13a965e,0x0048d3a45a2e626d,0x003c0d4d9dc49786,0x0087a152db883023,0x001e815994bcb975)},
+  {FIELD_LITERAL(0x00a1305696c4f8fa,0x006695ad433da40c,0x00f3f8d006223ee5,0x00a0fa45fce52e6c,0x00da78c790e7246b,0x00e0fb0cbebb91dc,0x008ac5f10d9f561b,0x008200ab0c9c36cd)},
+  {FIELD_LITERAL(0x00529c98ca61427f,0x00a5e6a911770b56,0x003050f627eb9c35,0x00d98a3224997d01,0x00a3e09841a0715d,0x00591c96ee83d327,0x001204db74b0aae0,0x00ac39d68d5b9cdb)},
+  {FIELD_LITERAL(0x00d0ddeb1fb62b12,0x0084b272ead9bcca,0x001a0d094a3e93ec,0x00b409c40557cd49,0x00c32d5337fdf2d0,0x004aa2c4320e81cf,0x000f1460433ebc98,0x00756793a45d1a28)},
+  {FIELD_LITERAL(0x003c035648e9541c,0x00f87cc99ca58b10,0x009697f13b9801ff,0x00445cff5074db91,0x0041b959ebf7abc2,0x007f25af7655ca6f,0x00404679a26b3138,0x00f6e76b6e3cec2d)},
+  {FIELD_LITERAL(0x00efbdcc1204ff62,0x00c534ee0f3c2011,0x0010168081eb618f,0x00764a6c7678504c,0x00f4f45c4973fbfb,0x008ed455679585bf,0x00f1d0789af373e7,0x00338a3cc8174214)},
+  {FIELD_LITERAL(0x00d40c7ee4e74cfd,0x000eba58f405d351,0x00e9ed0e2440f44b,0x00a608ffabd86ce4,0x0005c6c0e3eff472,0x001037fb18da14e2,0x00ca9cbba14980a0,0x0025dac1ae61cbec)},
+  {FIELD_LITERAL(0x0064cf3fde10dc8b,0x00cbe22aff537c6c,0x00e5e95ba708d5a2,0x0013b94ba454c3d1,0x00736058326dac78,0x0056307931b639df,0x0061d7adc39781c6,0x00e2d4ec565cc7ed)},
+  {FIELD_LITERAL(0x00c635be0fb3c2f4,0x00bf5c6594db47b3,0x008b3070e5ba9a2f,0x00b86e308eb5e54c,0x000ebaf4e58783ed,0x00bb82f5c7c2d8e6,0x004d3662fbb1099e,0x00dc1f702e0c6fde)},
+  {FIELD_LITERAL(0x002b316be6fd8727,0x007e22e94290ad4e,0x004fcfa087592e31,0x00805449e6e1579e,0x00506a519ff0693d,0x0011d5094ee24d38,0x0071b1ee14e77ce3,0x00744c68147a5246)},
+  {FIELD_LITERAL(0x005fb91890876a13,0x00c58e75db3e2a0d,0x00d0294b2830aa5a,0x009c559c2077eec6,0x00246fb1ab86d71b,0x00c11019b06cfb65,0x0022596c2585a0a3,0x004e0a09b6e9e9cc)},
+  {FIELD_LITERAL(0x00b208f9466f255c,0x004dc0dc713c221b,0x00769122b753bf8f,0x0013480d84490f86,0x0016481fa6b58d70,0x000412eafad91648,0x0075c8ebcbaff575,0x00816f09e44bbe65)},
+  {FIELD_LITERAL(0x001c117ba4b48160,0x00676949a20fcddc,0x00b70fb8855263b3,0x0075574ac1fd81f0,0x002f1876bc4fcda1,0x009adebba72f2c0b,0x0091fe6ccf970003,0x0026281795a6e3c7)},
+  {FIELD_LITERAL(0x00b61613b030ecff,0x00465300a22cb47f,0x00811fa609d6af9a,0x002c3420cbfe3109,0x00616e8b0ca6a4ac,0x006c58c60ad5abf3,0x004697750ca4e51b,0x00067e8c3e81c6fd)},
+  {FIELD_LITERAL(0x008961e1ed8bd258,0x00edd54b6a52afcb,0x0084e809abc44815,0x008e20a3ca652934,0x001c75ab8cf27de6,0x00bf55cc356882c6,0x006410b8a1c30fba,0x00903ba6ec8d7fae)},
+  {FIELD_LITERAL(0x00f368c1c17a53f2,0x006adf152e58fba7,0x0007a2d92f747916,0x003812be91d1ff2e,0x007db582ba1a90b5,0x00569259f239e658,0x000bcae420e4f729,0x00cc766cc2abc65a)},
+  {FIELD_LITERAL(0x001f24ff7dd995f4,0x007fdecacc56b1f5,0x00e1b52cf813f76e,0x003b79981c25daa0,0x00ffe835ce97b990,0x003a1b32baae2747,0x00d59310690c316b,0x00b68f88b7bea316)},
+  {FIELD_LITERAL(0x00f5323850098f4a,0x009ae13912fccee3,0x00ee1bfc02ab69f1,0x00f814fca6ed04dc,0x0085195087cdbaed,0x001f5cfbd9ae50e8,0x0058dbfce4f27b52,0x00bbfcd806874aad)},
+  {FIELD_LITERAL(0x00413522cb156904,0x005715f390d324e7,0x00248c6b2cd7cd11,0x00c2dd42e493b46b,0x00463c9f6f841f95,0x006474c7e0a91aff,0x0025cb592084fb9f,0x000ac73a3d061c4b)},
+  {FIELD_LITERAL(0x00316d4f24dbcc61,0x00cd700ddc03eba4,0x00e97faff1c1896a,0x00ea39c2e67727ca,0x00f28e07e05cc494,0x0028c467096119d4,0x00aaa3138e121854,0x00380bcbb7efff22)},
+  {FIELD_LITERAL(0x00e201eef10d068a,0x0000b8906814268a,0x006207e4c64dbb6a,0x00894f8987cbd288,0x00abe1e0054096f9,0x000cd065dac70c0a,0x000164ae1184a466,0x001cdbeb2a8bb613)},
+  {FIELD_LITERAL(0x006a828b64de09b7,0x0031ff29d4aa8484,0x002812642d849464,0x003d103a1b13947f,0x00c50cd1c9fda425,0x007f8df8f7acd2f4,0x00c7509e05bd3420,0x009d127bb9685651)},
+  {FIELD_LITERAL(0x0083752ed18cfc67,0x00c44bd64eee8b5d,0x0038b98b8679ef33,0x0098a0a8575179b5,0x00ba6652e521358e,0x005a8bf167c604d3,0x005dbd474641f142,0x00f2c2efbae63b54)},
+  {FIELD_LITERAL(0x00a4bcb1123d1503,0x00f5b8e44168ffab,0x004bf99671bd2956,0x00a6633f81eba1b0,0x0002c767ffb69ac9,0x0089a10ea461453c,0x0045e067556d7f08,0x00a1da056f45dd45)},
+  {FIELD_LITERAL(0x00f86efce44fcbbf,0x008d2833afb5b3f0,0x00042fe58aff2068,0x00c8f1aafac658f8,0x0066c3a7accfa94d,0x00a5e676f1e39732,0x00892155687e1ca2,0x00c30f72a9bd54ec)},
+  {FIELD_LITERAL(0x008e668ff6379f93,0x003ec4dd4e601f02,0x006e7774792d708b,0x00ac44e053319fd9,0x00a601f8aad6827e,0x00f653331ead93a1,0x005fd771dfca2804,0x005fe4caf0eac983)},
+  {FIELD_LITERAL(0x00d27f670d507a4f,0x001ba76140d6fdbc,0x00e438bb5db69260,0x000c98db2248cc42,0x00974fe8b6ecfe1c,0x00c0cdfe01bca910,0x0015a7ecf9510e4e,0x009f4137f49f18e8)},
+  {FIELD_LITERAL(0x00d02ad5cb00bc61,0x00936256afd0a010,0x0020a396fbf28c9b,0x0097b74f4d371af7,0x00fe343cceaef668,0x008a90b50bbd769b,0x007c4d070475ce9c,0x003065eb19468c38)},
+  {FIELD_LITERAL(0x007e1cd5ee9e9be3,0x005e0ca567e59cc1,0x00e29e5511590f6a,0x00ff873974926857,0x00cde60b512f3b0e,0x00114820e17d6867,0x009d7ddb12a5e643,0x008f1621acbe0b46)},
+  {FIELD_LITERAL(0x00e73f1199756746,0x006f3f3f6f19fdd4,0x00e07352f2a7bdf6,0x0095caea649fd5d0,0x0074fd977b9a8010,0x00880d1d862fecb4,0x00f83746f9d64326,0x00cbda217ddd6927)},
+  {FIELD_LITERAL(0x0049655eebdd461f,0x002577eef88a5d39,0x0075b0e6a8e50705,0x007b0f57188950bb,0x00f70c7a5576b57f,0x0063c9e5ef52317e,0x007312eeb6f95732,0x00bf928618a71563)},
+  {FIELD_LITERAL(0x006b59c643218d8c,0x00f7ddafc6fa3645,0x00225292edafc26a,0x0035764c12163f9f,0x009264132a717e96,0x00e5f81952f44455,0x00963cb9d577fc28,0x00476ab602f62945)},
+  {FIELD_LITERAL(0x00ba749f7d61eed9,0x00a3055d5c64fc53,0x00df447babb6a73f,0x00efd6681484f5cb,0x00425b1c7062058f,0x00c3d024a1cdef06,0x00c91939953398f3,0x00e6972211b58f88)},
+  {FIELD_LITERAL(0x003a74c8871a8f0c,0x00a58b86866e6ae9,0x0062912aa1eb67b3,0x00c8448e702c8bfc,0x00694e8d97bbad1f,0x006d0913ce28b127,0x0046371f379ca821,0x00368565c6a4cea4)},
+  {FIELD_LITERAL(0x0090875a0fd0d1e3,0x00479ef995b9eaad,0x003195e450214c87,0x00976865ba7070e8,0x000c98d7762ddf23,0x006d27d2d7913ed6,0x009f18ec983a6ea3,0x009159db2fca78aa)},
+  {FIELD_LITERAL(0x007580c4c0d4f294,0x00c63221bd5fa22e,0x0010e8622c40a443,0x0039b9f07628b0d4,0x003ef3266aa23dfd,0x00e74385e292d341,0x0069b93951296708,0x005d6cb69193bf11)},
+  {FIELD_LITERAL(0x0080615bb0003833,0x0015f286a1741572,0x00baafcb77238ba0,0x005a9d0443e7c516,0x008d06df51041b28,0x00ce538c3369850a,0x0089bf289ad41f1a,0x00f2960bc5cb5a7a)},
+  {FIELD_LITERAL(0x002d560cd27a8a1a,0x0026d9f9a90a0411,0x003604cab0eb2a83,0x0045f2c5322c59da,0x006ccbae9b8981fb,0x00b0e43e8cc19ec9,0x00598ab5bad6986e,0x00dd8927d56e67a7)},
+  {FIELD_LITERAL(0x0069934e1ce648f2,0x0001859da6341f70,0x00a35f53e34b83ca,0x001319a544135a8f,0x0069170ab45504f3,0x00d9aa6bbb37ea7f,0x00b41c7f28a76571,0x00ddd76d8fe60e2c)},
+  {FIELD_LITERAL(0x00fff02a72b52457,0x0002e964c72b570a,0x005e6b4441d7bfc1,0x00c17eb644bea153,0x003af4a6bcf2fc34,0x00e92570ea006913,0x00a698ab74205f69,0x0020417df36b26f2)},
+  {FIELD_LITERAL(0x009d386cbcd58d40,0x00829b386542c4b0,0x00f6126674373bde,0x0068265ac6896ef0,0x000abd0df4e680e6,0x001f257c22943eff,0x004b768f14b59d38,0x001bff5c0f1a5883)},
+  {FIELD_LITERAL(0x0088aff85ec9e843,0x001f0a7a6397ad71,0x001a6e26f14d06db,0x0066816804603d37,0x003e559ef28f7957,0x00b3e75e349f05f8,0x001baa7ff151f0e6,0x001ceaa005e8197a)},
+  {FIELD_LITERAL(0x0036699afc038098,0x00cc3cbd30d11d3d,0x00b9ec5772722540,0x007d4a964fdc2b72,0x009d7341b2109735,0x00dfaf7b6c0115b1,0x00e0cb3bb6bf3ab1,0x001020b4e85461e2)},
+  {FIELD_LITERAL(0x00b83a8e806fcdaf,0x00a47f6d4e5acb9c,0x005872eed83d62df,0x00a898d1304af418,0x000b19f97cc7d348,0x00413a465a6a08ab,0x00d9fe27873fb839,0x005907c8ce1d13f9)},
+  {FIELD_LITERAL(0x00dab4bb09551b14,0x00870721ede84102,0x002ca0ea7fa78b37,0x00e56f297507c06f,0x00cb929d1f639421,0x00dd08a5191fe998,0x00e23faa1877b8a6,0x00397f91e90d2a4a)},
+  {FIELD_LITERAL(0x0063f272c5990cf1,0x000950ffe856a59b,0x00790fe3aa92b9db,0x0060ef576cfd901a,0x00ea64b9dade89bb,0x00355779535fded3,0x00b2f1117984904e,0x00fea56af5fa106d)},
+  {FIELD_LITERAL(0x00397f959d9be5aa,0x00919b00d356952b,0x00ce36d8ab15e13e,0x0092c94b3fa59047,0x009ec4def89dff22,0x001113393c9f4971,0x00174d8351ed92b2,0x00cbdd38ea4e5e10)},
+  {FIELD_LITERAL(0x003b238f9ae7b2b8,0x0052b8e318e6c018,0x00ebd740544e61a8,0x00249ae9b0b715f8,0x00986ff987d96fe3,0x00e3a330f8207f1f,0x002d9a7ab3564697,0x00b1f1b187a2081e)},
+  {FIELD_LITERAL(0x00cd4d36eb6760d9,0x00a9e7950aee5f80,0x002a71f6694d3fb0,0x00a2ef02727f304b,0x00747850ddf8abd2,0x0030ea2451b2e1d3,0x00a109f14b3c6bf6,0x0024b7691fa7d322)},
+  {FIELD_LITERAL(0x001c99ac60650bb1,0x00b6c6e0f73eaaca,0x00ae6fe1e5033c9e,0x007aa43a5c303887,0x00ab71200a2555fd,0x00b575f537326326,0x0026906c732bb78d,0x00699fb4f4658201)},
+  {FIELD_LITERAL(0x00202c69bc4527fa,0x00c2716e608e3d07,0x0085a7124527386a,0x004542a643390138,0x00ba9342bfd47b90,0x00d8feb547e01870,0x00e76fed5c293f54,0x008f8dd9a558e3e8)},
+  {FIELD_LITERAL(0x002c32a776875327,0x0021aa1aba1c2588,0x00c37250454c56cf,0x006c9f401d3b6aa9,0x00dc72753389e069,0x00bf10ff9306a8bd,0x00f5c314595445c1,0x00db2079fa797c78)},
+  {FIELD_LITERAL(0x002b79063c711810,0x00775ee28eea0283,0x006422a050a6d55f,0x00f754129a4a2d27,0x00562723afe5af4e,0x001fa479e573088e,0x009b9dc6dff62b23,0x00c9e39be60b225a)},
+  {FIELD_LITERAL(0x007a53629c89012b,0x00c7902bdc47ffc7,0x00f59b4d5cc25ebd,0x003b5d62edf6cd75,0x00e22359fce477e6,0x00c2acb6bafd37e2,0x000366c0662620b0,0x00f4f77ebba8bd7d)},
+  {FIELD_LITERAL(0x008be4ba049d937e,0x00bab8c9d92cc09e,0x00debeb9be859599,0x00f76e116eb429cb,0x005d5c268d4e3cb1,0x007490fababc8763,0x00bf9767076816e3,0x008265b8e136dd12)},
+  {FIELD_LITERAL(0x00bd607e6036ab55,0x00c3ffc739ce875d,0x001185d12a2514b2,0x004468aa8a95787b,0x005cd17a07562b61,0x0000015310160ee7,0x00a74a2aea1bc4b3,0x004e62b79fe94c64)},
+  {FIELD_LITERAL(0x00d9625730ededb9,0x005cacf349a17b77,0x00ae195558acdd23,0x0074c934d812179c,0x00b6da2e2ea3e117,0x001a0fe2a3c01135,0x00e2bbf8796b7778,0x002069ccaa93ff24)},
+  {FIELD_LITERAL(0x003d53bdb7098938,0x0074e90e43738a96,0x008b9c0437b76515,0x00feb675f759cd49,0x009b219e1254c5b6,0x00cfb568aa4f5791,0x00782ad3fecbb3c3,0x001fe70cf2606dd8)},
+  {FIELD_LITERAL(0x0042aa66d0feefcb,0x00e0d5d66dfd10c1,0x00558c986385ea4c,0x005eddc2d1b21934,0x0006e7ed56f40995,0x00bd87ae0e99de59,0x00d85a75aaec96b4,0x0091219b6a24afe8)},
+  {FIELD_LITERAL(0x00a526e95708e6d1,0x00e98bb6c77adfd3,0x00e3abd197a17111,0x0016b968f232de8b,0x00c7b56ba51dddb0,0x006841b94674d98b,0x0015067310dc516f,0x006132f85e893ff8)},
+  {FIELD_LITERAL(0x009bd00dbece3b5b,0x00072207a092dafe,0x0083ff6be5834c43,0x0010472cfe2e64c9,0x00bf93046ed653fe,0x00e42f6b2f6e0373,0x00191290a58b038a,0x009c3e7e6100b62f)},
+  {FIELD_LITERAL(0x00269f2571cc6517,0x001d5002b8417f01,0x008ca8da49298dcf,0x00f88db8c2504a0b,0x00aa06b66726089a,0x0034c3909b316c1a,0x009ea78064defb03,0x00b4165c074eacf6)},
+  {FIELD_LITERAL(0x00d54b6faf0f1665,0x000c01d9ee65ec6a,0x000dc41d6170c9b5,0x00fe589af38e3ef0,0x00f4f32041012876,0x0090714c048385d4,0x0002108299eff506,0x00ded19e7b8fbe75)}
+};
+#endif
+#else
+#error "No generated wNAF table for this GOLDILOCKS_WNAF_FIXED_TABLE_BITS"
+#endif
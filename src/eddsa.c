@@ -123,7 +123,7 @@ void goldilocks_ed448_derive_secret_scalar (
         API_NS(scalar_halve)(secret,secret);
     }
 
-    goldilocks_bzero(secret_scalar_ser, sizeof(secret_scalar_ser));
+    SCRUB(secret_scalar_ser, sizeof(secret_scalar_ser));
 }
 
 void goldilocks_ed448_derive_public_key (
@@ -177,7 +177,7 @@ void goldilocks_ed448_sign (
         hash_init_with_dom(hash,prehashed,0,context,context_len);
         hash_update(hash,expanded.seed,sizeof(expanded.seed));
         hash_update(hash,message,message_len);
-        goldilocks_bzero(&expanded, sizeof(expanded));
+        SCRUB(&expanded, sizeof(expanded));
     }
 
     /* Decode the nonce */
@@ -185,7 +185,7 @@ void goldilocks_ed448_sign (
         uint8_t nonce[2*GOLDILOCKS_EDDSA_448_PRIVATE_BYTES];
         hash_final(hash,nonce,sizeof(nonce));
         API_NS(scalar_decode_long)(nonce_scalar, nonce, sizeof(nonce));
-        goldilocks_bzero(nonce, sizeof(nonce));
+        SCRUB(nonce, sizeof(nonce));
     }
 
     {
@@ -214,7 +214,7 @@ void goldilocks_ed448_sign (
         hash_final(hash,challenge,sizeof(challenge));
         hash_destroy(hash);
         API_NS(scalar_decode_long)(challenge_scalar,challenge,sizeof(challenge));
-        goldilocks_bzero(challenge,sizeof(challenge));
+        SCRUB(challenge,sizeof(challenge));
     }
 
     API_NS(scalar_mul)(challenge_scalar,challenge_scalar,secret_scalar);
@@ -247,26 +247,25 @@ void goldilocks_ed448_sign_prehash (
     }
 
     goldilocks_ed448_sign(signature,privkey,pubkey,hash_output,sizeof(hash_output),1,context,context_len);
-    goldilocks_bzero(hash_output,sizeof(hash_output));
+    SCRUB(hash_output,sizeof(hash_output));
 }
 
-goldilocks_error_t goldilocks_ed448_verify (
+/* Verify against pk_point, which the caller has already decoded from pubkey. */
+static goldilocks_error_t verify_with_point (
     const uint8_t signature[GOLDILOCKS_EDDSA_448_SIGNATURE_BYTES],
     const uint8_t pubkey[GOLDILOCKS_EDDSA_448_PUBLIC_BYTES],
+    const API_NS(point_p) pk_point,
     const uint8_t *message,
     size_t message_len,
     uint8_t prehashed,
     const uint8_t *context,
     uint8_t context_len
 ) {
-    API_NS(point_p) pk_point, r_point;
+    API_NS(point_p) r_point;
     API_NS(scalar_p) challenge_scalar;
     API_NS(scalar_p) response_scalar;
     unsigned  int c;
-    goldilocks_error_t error = API_NS(point_decode_like_eddsa_and_mul_by_ratio)(pk_point,pubkey);
-    if (GOLDILOCKS_SUCCESS != error) { return error; }
-
-    error = API_NS(point_decode_like_eddsa_and_mul_by_ratio)(r_point,signature);
+    goldilocks_error_t error = API_NS(point_decode_like_eddsa_and_mul_by_ratio)(r_point,signature);
     if (GOLDILOCKS_SUCCESS != error) { return error; }
 
     {
@@ -280,7 +279,7 @@ goldilocks_error_t goldilocks_ed448_verify (
         hash_final(hash,challenge,sizeof(challenge));
         hash_destroy(hash);
         API_NS(scalar_decode_long)(challenge_scalar,challenge,sizeof(challenge));
-        goldilocks_bzero(challenge,sizeof(challenge));
+        SCRUB_PUBLIC(challenge,sizeof(challenge));
     }
     API_NS(scalar_sub)(challenge_scalar, API_NS(scalar_zero), challenge_scalar);
 
@@ -295,14 +294,48 @@ goldilocks_error_t goldilocks_ed448_verify (
     }
 
 
-    /* pk_point = -c(x(P)) + (cx + k)G = kG */
-    API_NS(base_double_scalarmul_non_secret)(
-        pk_point,
+    /* -c(x(P)) + (cx + k)G = kG */
+    return goldilocks_succeed_if(API_NS(base_double_scalarmul_non_secret_eq)(
         response_scalar,
         pk_point,
-        challenge_scalar
-    );
-    return goldilocks_succeed_if(API_NS(point_eq(pk_point,r_point)));
+        challenge_scalar,
+        r_point
+    ));
+}
+
+goldilocks_error_t goldilocks_ed448_verify (
+    const uint8_t signature[GOLDILOCKS_EDDSA_448_SIGNATURE_BYTES],
+    const uint8_t pubkey[GOLDILOCKS_EDDSA_448_PUBLIC_BYTES],
+    const uint8_t *message,
+    size_t message_len,
+    uint8_t prehashed,
+    const uint8_t *context,
+    uint8_t context_len
+) {
+    API_NS(point_p) pk_point;
+    goldilocks_error_t error = API_NS(point_decode_like_eddsa_and_mul_by_ratio)(pk_point,pubkey);
+    if (GOLDILOCKS_SUCCESS != error) { return error; }
+
+    return verify_with_point(signature,pubkey,pk_point,message,message_len,
+        prehashed,context,context_len);
+}
+
+goldilocks_error_t goldilocks_ed448_verify_with_point (
+    const uint8_t signature[GOLDILOCKS_EDDSA_448_SIGNATURE_BYTES],
+    const uint8_t pubkey[GOLDILOCKS_EDDSA_448_PUBLIC_BYTES],
+    const goldilocks_448_affine_point_p pubkey_point,
+    const uint8_t *message,
+    size_t message_len,
+    uint8_t prehashed,
+    const uint8_t *context,
+    uint8_t context_len
+) {
+    API_NS(point_p) pk_point;
+    goldilocks_error_t error = API_NS(point_from_affine)(pk_point,pubkey_point);
+    if (GOLDILOCKS_SUCCESS != error) { return error; }
+
+    return verify_with_point(signature,pubkey,pk_point,message,message_len,
+        prehashed,context,context_len);
 }
 
 
@@ -29,6 +29,12 @@ extern mask_t API_NS(deisogenize) (
     mask_t toggle_rotation
 );
 
+extern void API_NS(deisogenize_all) (
+    gf_s inv_el_sum[2],
+    gf_s inv_el_m1[2],
+    const point_p p
+);
+
 void API_NS(point_from_hash_nonuniform) (
     point_p p,
     const unsigned char ser[SER_BYTES]
@@ -93,6 +99,38 @@ void API_NS(point_from_hash_uniform) (
     API_NS(point_add)(pt,pt,pt2);
 }
 
+/* Map a few inputs at a time when the caller only wants affine outputs,
+ * to bound the space used for the intermediate points.
+ */
+#define HASH_BATCH 16
+
+void API_NS(point_from_hash_uniform_batch) (
+    API_NS(point_s) *points,
+    API_NS(affine_point_s) *affine,
+    const unsigned char *hashed_data,
+    size_t n
+) {
+    API_NS(point_s) chunk[HASH_BATCH], *out;
+    point_p pt2;
+    size_t i, j, m;
+
+    for (i=0; i<n; i+=m) {
+        m = n-i;
+        if (m > HASH_BATCH) m = HASH_BATCH;
+        out = points ? &points[i] : chunk;
+        for (j=0; j<m; j++) {
+            const unsigned char *h = &hashed_data[2*SER_BYTES*(i+j)];
+            API_NS(point_from_hash_nonuniform)(&out[j],h);
+            API_NS(point_from_hash_nonuniform)(pt2,&h[SER_BYTES]);
+            API_NS(point_add)(&out[j],&out[j],pt2);
+        }
+        if (affine) API_NS(point_to_affine_batch)(&affine[i],out,m);
+    }
+
+    SCRUB(chunk,sizeof(chunk));
+    SCRUB(pt2,sizeof(pt2));
+}
+
 /* Elligator_onto:
  * Make elligator-inverse onto at the cost of roughly halving the success probability.
  * Currently no effect for curves with field size 1 bit mod 8 (where the top bit
@@ -101,24 +139,20 @@ void API_NS(point_from_hash_uniform) (
  */
 #define MAX(A,B) (((A)>(B)) ? (A) : (B))
 
-goldilocks_error_t
-API_NS(invert_elligator_nonuniform) (
-    unsigned char recovered_hash[SER_BYTES],
+/* The common part of the inversion, from deisogenize's inv_el_sum and
+ * inv_el_m1 (which this clobbers).  Leaves in b the recovered r0 up to
+ * sign, and returns whether it exists.
+ */
+static mask_t invert_elligator_r0 (
+    gf b,
+    gf c,
     const point_p p,
-    uint32_t hint_
+    mask_t sgn_s,
+    mask_t sgn_altx
 ) {
-    mask_t hint = hint_;
-    mask_t sgn_s = -(hint & 1),
-        sgn_altx = -(hint>>1 & 1),
-        sgn_r0 = -(hint>>2 & 1),
-        /* FUTURE MAGIC: eventually if there's a curve which needs sgn_ed_T but not sgn_r0,
-         * change this mask extraction.
-         */
-        sgn_ed_T = -(hint>>3 & 1);
-    gf a,b,c;
+    gf a;
     mask_t is_identity;
     mask_t succ;
-    API_NS(deisogenize)(a,b,c,p,sgn_s,sgn_altx,sgn_ed_T);
 
     is_identity = gf_eq(p->t,ZERO);
     gf_cond_sel(b,b,ONE,is_identity & sgn_altx);
@@ -133,11 +167,44 @@ API_NS(invert_elligator_nonuniform) (
     succ = gf_isr(c,b);
     succ |= gf_eq(b,ZERO);
     gf_mul(b,c,a);
+    return succ;
+}
 
+/* Choose the sign of r0, and serialize it. */
+static mask_t invert_elligator_finish (
+    unsigned char recovered_hash[SER_BYTES],
+    gf b,
+    mask_t succ,
+    mask_t sgn_s,
+    mask_t sgn_r0
+) {
     gf_cond_neg(b, sgn_r0^gf_lobit(b));
     /* Eliminate duplicate values for identity ... */
     succ &= ~(gf_eq(b,ZERO) & (sgn_r0 | sgn_s));
     gf_serialize(recovered_hash,b);
+    return succ;
+}
+
+goldilocks_error_t
+API_NS(invert_elligator_nonuniform) (
+    unsigned char recovered_hash[SER_BYTES],
+    const point_p p,
+    uint32_t hint_
+) {
+    mask_t hint = hint_;
+    mask_t sgn_s = -(hint & 1),
+        sgn_altx = -(hint>>1 & 1),
+        sgn_r0 = -(hint>>2 & 1),
+        /* FUTURE MAGIC: eventually if there's a curve which needs sgn_ed_T but not sgn_r0,
+         * change this mask extraction.
+         */
+        sgn_ed_T = -(hint>>3 & 1);
+    gf a,b,c;
+    mask_t succ;
+    API_NS(deisogenize)(a,b,c,p,sgn_s,sgn_altx,sgn_ed_T);
+
+    succ = invert_elligator_r0(b,c,p,sgn_s,sgn_altx);
+    succ = invert_elligator_finish(recovered_hash,b,succ,sgn_s,sgn_r0);
 // TODO: ??!
 #if 0
         recovered_hash[SER_BYTES-1] ^= (hint>>3)<<0;
@@ -145,6 +212,33 @@ API_NS(invert_elligator_nonuniform) (
     return goldilocks_succeed_if(mask_to_bool(succ));
 }
 
+uint32_t
+API_NS(invert_elligator_nonuniform_all) (
+    unsigned char recovered_hashes[1<<GOLDILOCKS_448_INVERT_ELLIGATOR_WHICH_BITS][SER_BYTES],
+    const point_p p
+) {
+    gf_s sums[2], m1s[2];
+    gf b, c, b2;
+    mask_t succ;
+    uint32_t hint, found = 0;
+
+    API_NS(deisogenize_all)(sums,m1s,p);
+    for (hint=0; hint<4; hint++) {
+        mask_t sgn_s = -(mask_t)(hint & 1), sgn_altx = -(mask_t)(hint>>1 & 1);
+        gf_copy(b,&sums[hint>>1]);
+        gf_copy(c,&m1s[hint>>1]);
+        gf_add(b2,p->t,p->t);
+        gf_sub(b2,b2,c);
+        gf_cond_sel(c,c,b2,sgn_s);
+
+        succ = invert_elligator_r0(b,c,p,sgn_s,sgn_altx);
+        gf_copy(b2,b);
+        found |= (uint32_t)(invert_elligator_finish(recovered_hashes[hint],b,succ,sgn_s,0) & 1) << hint;
+        found |= (uint32_t)(invert_elligator_finish(recovered_hashes[hint+4],b2,succ,sgn_s,-(mask_t)1) & 1) << (hint+4);
+    }
+    return found;
+}
+
 goldilocks_error_t
 API_NS(invert_elligator_uniform) (
     unsigned char partial_hash[2*SER_BYTES],
@@ -156,3 +250,15 @@ API_NS(invert_elligator_uniform) (
     API_NS(point_sub)(pt2,p,pt2);
     return API_NS(invert_elligator_nonuniform)(partial_hash,pt2,hint);
 }
+
+uint32_t
+API_NS(invert_elligator_uniform_all) (
+    unsigned char recovered_hashes[1<<GOLDILOCKS_448_INVERT_ELLIGATOR_WHICH_BITS][SER_BYTES],
+    const point_p p,
+    const unsigned char second_half[SER_BYTES]
+) {
+    point_p pt2;
+    API_NS(point_from_hash_nonuniform)(pt2,second_half);
+    API_NS(point_sub)(pt2,p,pt2);
+    return API_NS(invert_elligator_nonuniform_all)(recovered_hashes,pt2);
+}
@@ -12,29 +12,33 @@
 #define _XOPEN_SOURCE 600 /* for posix_memalign */
 #include "word.h"
 #include "field.h"
+#include "tuning.h"
 
 #include <goldilocks.h>
 #include <goldilocks/ed448.h>
 #include "api.h"
 
+#include <pthread.h>
+#if GOLDILOCKS_POINT_SUM_THREADS > 1
+#include <unistd.h>
+#endif
+
 /* Template stuff */
 #define point_p API_NS(point_p)
+#define point_s API_NS(point_s)
+#define scalar_s API_NS(scalar_s)
 #define precomputed_s API_NS(precomputed_s)
+#define precomputed_wnafs_s API_NS(precomputed_wnafs_s)
+#define scalarmul_state_s API_NS(scalarmul_state_s)
 
-/* Comb config: number of combs, n, t, s. */
-#define COMBS_N 5
-#define COMBS_T 5
-#define COMBS_S 18
-#define GOLDILOCKS_WINDOW_BITS 5
-#define GOLDILOCKS_WNAF_FIXED_TABLE_BITS 5
-#define GOLDILOCKS_WNAF_VAR_TABLE_BITS 3
+/* Comb config: number of combs, n, t, s.  See tuning.h. */
+#define COMBS_N GOLDILOCKS_COMBS_N
+#define COMBS_T GOLDILOCKS_COMBS_T
+#define COMBS_S GOLDILOCKS_COMBS_S
+#define COMBS_T_MAX 8
+#define COMBS_NORMALIZE_BATCH 128
 
 static const int EDWARDS_D = -39081;
-static const scalar_p point_scalarmul_adjustment = {{{
-    SC_LIMB(0xc873d6d54a7bb0cf), SC_LIMB(0xe933d8d723a70aad), SC_LIMB(0xbb124b65129c96fd), SC_LIMB(0x00000008335dc163)
-}}}, precomputed_scalarmul_adjustment = {{{
-    SC_LIMB(0xc873d6d54a7bb0cf), SC_LIMB(0xe933d8d723a70aad), SC_LIMB(0xbb124b65129c96fd), SC_LIMB(0x00000008335dc163)
-}}};
 
 const uint8_t goldilocks_x448_base_point[GOLDILOCKS_X448_PUBLIC_BYTES] = { 0x05 };
 
@@ -53,17 +57,46 @@ extern const point_p API_NS(point_base);
 
 /* Projective Niels coordinates */
 typedef struct { gf a, b, c; } niels_s, niels_p[1];
-typedef struct { niels_p n; gf z; } VECTOR_ALIGNED pniels_s, pniels_p[1];
+typedef struct { niels_p n; gf z; } CACHE_ALIGNED pniels_s, pniels_p[1];
 
 /* Precomputed base */
-struct precomputed_s { niels_p table [COMBS_N<<(COMBS_T-1)]; };
+struct precomputed_s { niels_p table [COMBS_N<<(COMBS_T-1)]; } CACHE_ALIGNED;
 
 extern const gf API_NS(precomputed_base_as_fe)[];
 const precomputed_s *API_NS(precomputed_base) =
     (const precomputed_s *) &API_NS(precomputed_base_as_fe);
 
 const size_t API_NS(sizeof_precomputed_s) = sizeof(precomputed_s);
-const size_t API_NS(alignof_precomputed_s) = sizeof(big_register_t);
+const size_t API_NS(alignof_precomputed_s) = 64;
+const API_NS(comb_geometry_s) API_NS(comb_geometry) = { COMBS_N, COMBS_T, COMBS_S };
+
+/* Tables of the constant-time scalarmul family.  They live on the stack,
+ * or in the caller's workspace for the _ws variants.
+ */
+#define WINDOW_NTABLE (1<<(GOLDILOCKS_WINDOW_BITS-1))
+#define MULTISCALARMUL_NTABLE (1<<(GOLDILOCKS_MULTISCALARMUL_WINDOW_BITS-1))
+
+struct multiscalarmul_entry {
+    scalar_p scalarx;
+    pniels_p multiples[MULTISCALARMUL_NTABLE];
+};
+
+union scalarmul_workspace {
+    pniels_p scalarmul[WINDOW_NTABLE];
+    struct { pniels_p b[WINDOW_NTABLE], c[WINDOW_NTABLE]; } double_scalarmul;
+    struct { point_p a1[WINDOW_NTABLE], a2[WINDOW_NTABLE]; } dual_scalarmul;
+    struct {
+        gf zs[COMBS_NORMALIZE_BATCH], zis[COMBS_NORMALIZE_BATCH];
+        point_p doubles[COMBS_T_MAX-1];
+    } precompute;
+    struct multiscalarmul_entry multiscalarmul[1];
+} CACHE_ALIGNED;
+
+/* A workspace holds as large a multiscalarmul batch as fits. */
+#define WORKSPACE_MULTISCALARMUL_BATCH \
+    (sizeof(union scalarmul_workspace) / sizeof(struct multiscalarmul_entry))
+
+const size_t API_NS(alignof_workspace) = 64;
 
 /** Inverse. */
 static void
@@ -82,6 +115,11 @@ gf_invert(gf y, const gf x, int assert_nonzero) {
 /** identity = (0,1) */
 const point_p API_NS(point_identity) = {{{{{0}}},{{{1}}},{{{1}}},{{{0}}}}};
 
+/* Predeclare because not static: called by hash_to_curve */
+void API_NS(point_from_untwisted) (
+    point_p p
+);
+
 /* Predeclare because not static: called by elligator */
 void API_NS(deisogenize) (
     gf_s *__restrict__ s,
@@ -93,31 +131,43 @@ void API_NS(deisogenize) (
     mask_t toggle_rotation
 );
 
-// TODO: this function signature should change to not include
-// toggle_rotation
-void API_NS(deisogenize) (
+void API_NS(deisogenize_all) (
+    gf_s inv_el_sum[2],
+    gf_s inv_el_m1[2],
+    const point_p p
+);
+
+/* The part of deisogenize which doesn't depend on the toggles. */
+static void deisogenize_isr (
+    gf_s *__restrict__ isr,
+    gf_s *__restrict__ num,
+    const point_p p
+) {
+    gf t1, t2;
+    gf_add(t1,p->x,p->t);
+    gf_sub(t2,p->x,p->t);
+    gf_mul(num,t1,t2);
+    gf_sqr(t2,p->x);
+    gf_mul(t1,t2,num);
+    gf_mulw(t2,t1,-1-TWISTED_D); /* -x^2 * (a-d) * num */
+    gf_isr(isr,t2);
+}
+
+static void deisogenize_finish (
     gf_s *__restrict__ s,
     gf_s *__restrict__ inv_el_sum,
     gf_s *__restrict__ inv_el_m1,
     const point_p p,
+    const gf isr,
+    const gf num,
     mask_t toggle_s,
-    mask_t toggle_altx,
-    mask_t toggle_rotation
+    mask_t toggle_altx
 ) {
-    gf t1;
     mask_t negx;
     mask_t lobs;
     gf_s *t2 = s, *t3=inv_el_sum, *t4=inv_el_m1;
-    (void)toggle_rotation; /* Only applies to cofactor 8 */
 
-    gf_add(t1,p->x,p->t);
-    gf_sub(t2,p->x,p->t);
-    gf_mul(t3,t1,t2); /* t3 = num */
-    gf_sqr(t2,p->x);
-    gf_mul(t1,t2,t3);
-    gf_mulw(t2,t1,-1-TWISTED_D); /* -x^2 * (a-d) * num */
-    gf_isr(t1,t2);    /* t1 = isr */
-    gf_mul(t2,t1,t3); /* t2 = ratio */
+    gf_mul(t2,isr,num); /* t2 = ratio */
     gf_mul(t4,t2,GOLDILOCKS_448_FACTOR);
     negx = gf_lobit(t4) ^ toggle_altx;
     gf_cond_neg(t2, negx);
@@ -125,7 +175,7 @@ void API_NS(deisogenize) (
     gf_sub(t3,t3,p->t);
     gf_mul(t2,t3,p->x);
     gf_mulw(t4,t2,-1-TWISTED_D);
-    gf_mul(s,t4,t1);
+    gf_mul(s,t4,isr);
     lobs = gf_lobit(s);
     gf_cond_neg(s,lobs);
     gf_copy(inv_el_m1,p->x);
@@ -133,6 +183,38 @@ void API_NS(deisogenize) (
     gf_add(inv_el_m1,inv_el_m1,p->t);
 }
 
+// TODO: this function signature should change to not include
+// toggle_rotation
+void API_NS(deisogenize) (
+    gf_s *__restrict__ s,
+    gf_s *__restrict__ inv_el_sum,
+    gf_s *__restrict__ inv_el_m1,
+    const point_p p,
+    mask_t toggle_s,
+    mask_t toggle_altx,
+    mask_t toggle_rotation
+) {
+    gf isr, num;
+    (void)toggle_rotation; /* Only applies to cofactor 8 */
+    deisogenize_isr(isr,num,p);
+    deisogenize_finish(s,inv_el_sum,inv_el_m1,p,isr,num,toggle_s,toggle_altx);
+}
+
+/* inv_el_sum and inv_el_m1 of deisogenize with toggle_s clear, for
+ * toggle_altx clear and set, sharing one inverse square root.  Setting
+ * toggle_s instead gives inv_el_m1 = 2t - inv_el_m1.
+ */
+void API_NS(deisogenize_all) (
+    gf_s inv_el_sum[2],
+    gf_s inv_el_m1[2],
+    const point_p p
+) {
+    gf isr, num, s;
+    deisogenize_isr(isr,num,p);
+    deisogenize_finish(s,&inv_el_sum[0],&inv_el_m1[0],p,isr,num,0,0);
+    deisogenize_finish(s,&inv_el_sum[1],&inv_el_m1[1],p,isr,num,0,-(mask_t)1);
+}
+
 void API_NS(point_encode)( unsigned char ser[SER_BYTES], const point_p p ) {
     gf s,ie1,ie2;
     API_NS(deisogenize)(s,ie1,ie2,p,0,0,0);
@@ -311,6 +393,22 @@ niels_to_pt (
     gf_copy ( e->z, ONE );
 }
 
+/* Load a point from compact affine form.  Returns true if both
+ * coordinates were canonical; the caller checks the curve equation if
+ * it needs to.
+ */
+static mask_t
+affine_to_pt (
+    point_p p,
+    const API_NS(affine_point_s) *a
+) {
+    mask_t succ = gf_deserialize(p->x, a->x, 0);
+    succ &= gf_deserialize(p->y, a->y, 0);
+    gf_copy(p->z, ONE);
+    gf_mul(p->t, p->x, p->y);
+    return succ;
+}
+
 static GOLDILOCKS_NOINLINE void
 add_niels_to_pt (
     point_p d,
@@ -398,35 +496,77 @@ prepare_fixed_window(
         pt_to_pniels(multiples[i], tmp);
     }
 
-    goldilocks_bzero(pn,sizeof(pn));
-    goldilocks_bzero(tmp,sizeof(tmp));
+    SCRUB(pn,sizeof(pn));
+    SCRUB(tmp,sizeof(tmp));
 }
 
-void API_NS(point_scalarmul) (
-    point_p a,
-    const point_p b,
-    const scalar_p scalar
+/**
+ * Signed windows covering the low bits of a scalar represent
+ * 2*k - (2^bits - 1), so the scalar must first be adjusted by 2^bits - 1.
+ */
+static void
+window_adjustment(
+    scalar_p adj,
+    unsigned int bits
 ) {
-    const int WINDOW = GOLDILOCKS_WINDOW_BITS,
-        WINDOW_MASK = (1<<WINDOW)-1,
-        WINDOW_T_MASK = WINDOW_MASK >> 1,
-        NTABLE = 1<<(WINDOW-1);
+    unsigned char ones[2*SCALAR_SER_BYTES];
+    unsigned int nbytes = (bits+7)/8;
+    assert(nbytes <= sizeof(ones));
+    memset(ones, 0xFF, nbytes);
+    if (bits%8) ones[nbytes-1] = (1<<(bits%8))-1;
+    API_NS(scalar_decode_long)(adj, ones, nbytes);
+}
 
-    scalar_p scalar1x;
-    pniels_p pn, multiples[NTABLE];
-    point_p tmp;
-    int i,j,first=1;
+/* Windows from the top, for point_scalarmul_windows and point_multiscalarmul. */
+#define WINDOW_TOP (SCALAR_BITS - ((SCALAR_BITS-1) % GOLDILOCKS_WINDOW_BITS) - 1)
+#define WINDOW_COUNT (WINDOW_TOP/GOLDILOCKS_WINDOW_BITS + 1)
+#define MULTISCALARMUL_TOP (SCALAR_BITS - ((SCALAR_BITS-1) % GOLDILOCKS_MULTISCALARMUL_WINDOW_BITS) - 1)
+
+/* The adjustments for the secret scalarmuls, computed on first use. */
+static scalar_p window_adjust, multiscalarmul_adjust;
+static pthread_once_t window_adjust_once = PTHREAD_ONCE_INIT;
+
+static void window_adjust_setup (void) {
+    window_adjustment(window_adjust, WINDOW_TOP+GOLDILOCKS_WINDOW_BITS);
+    window_adjustment(multiscalarmul_adjust,
+        MULTISCALARMUL_TOP+GOLDILOCKS_MULTISCALARMUL_WINDOW_BITS);
+}
 
-    API_NS(scalar_add)(scalar1x, scalar, point_scalarmul_adjustment);
+/** Adjust and halve a scalar for the GOLDILOCKS_WINDOW_BITS signed windows. */
+static void
+window_scalar_prepare(
+    scalar_p scalar1x,
+    const scalar_p scalar
+) {
+    pthread_once(&window_adjust_once, window_adjust_setup);
+    API_NS(scalar_add)(scalar1x, scalar, window_adjust);
     API_NS(scalar_halve)(scalar1x,scalar1x);
+}
 
-    /* Set up a precomputed table with odd multiples of b. */
-    prepare_fixed_window(multiples, b, NTABLE);
+/**
+ * Run windows from..to-1 of point_scalarmul, counting from the top,
+ * on the halved and adjusted scalar1x.  tmp needs no t coordinate
+ * between runs.
+ */
+static void
+point_scalarmul_windows (
+    point_p tmp,
+    const pniels_p *multiples,
+    const scalar_p scalar1x,
+    unsigned int from,
+    unsigned int to
+) {
+    const int WINDOW = GOLDILOCKS_WINDOW_BITS,
+        WINDOW_MASK = (1<<WINDOW)-1,
+        WINDOW_T_MASK = WINDOW_MASK >> 1,
+        NTABLE = WINDOW_NTABLE;
 
-    /* Initialize. */
-    i = SCALAR_BITS - ((SCALAR_BITS-1) % WINDOW) - 1;
+    pniels_p pn;
+    int i,j,stop;
 
-    for (; i>=0; i-=WINDOW) {
+    i = WINDOW_TOP - WINDOW*(int)from;
+    stop = WINDOW_TOP - WINDOW*(int)to;
+    for (; i>stop; i-=WINDOW) {
         mask_t inv;
         /* Fetch another block of bits */
         word_t bits = scalar1x->limb[i/WBITS] >> (i%WBITS);
@@ -440,9 +580,8 @@ void API_NS(point_scalarmul) (
         /* Add in from table.  Compute t only on last iteration. */
         constant_time_lookup(pn, multiples, sizeof(pn), NTABLE, bits & WINDOW_T_MASK);
         cond_neg_niels(pn->n, inv);
-        if (first) {
+        if (i == WINDOW_TOP) {
             pniels_to_pt(tmp, pn);
-            first = 0;
         } else {
            /* Using Hisil et al's lookahead method instead of extensible here
             * for no particular reason.  Double WINDOW times, but only compute t on
@@ -455,35 +594,73 @@ void API_NS(point_scalarmul) (
         }
     }
 
+    SCRUB(pn,sizeof(pn));
+}
+
+static void
+point_scalarmul (
+    point_p a,
+    const point_p b,
+    const scalar_p scalar,
+    pniels_p *multiples
+) {
+    scalar_p scalar1x;
+    point_p tmp;
+
+    window_scalar_prepare(scalar1x, scalar);
+
+    /* Set up a precomputed table with odd multiples of b. */
+    prepare_fixed_window(multiples, b, WINDOW_NTABLE);
+    point_scalarmul_windows(tmp, (const pniels_p *)multiples, scalar1x, 0, WINDOW_COUNT);
+
     /* Write out the answer */
     API_NS(point_copy)(a,tmp);
 
-    goldilocks_bzero(scalar1x,sizeof(scalar1x));
-    goldilocks_bzero(pn,sizeof(pn));
-    goldilocks_bzero(multiples,sizeof(multiples));
-    goldilocks_bzero(tmp,sizeof(tmp));
+    SCRUB(scalar1x,sizeof(scalar1x));
+    SCRUB(multiples,WINDOW_NTABLE*sizeof(pniels_p));
+    SCRUB(tmp,sizeof(tmp));
 }
 
-void API_NS(point_double_scalarmul) (
+void API_NS(point_scalarmul) (
+    point_p a,
+    const point_p b,
+    const scalar_p scalar
+) {
+    pniels_p multiples[WINDOW_NTABLE];
+    point_scalarmul(a, b, scalar, multiples);
+}
+
+void API_NS(point_scalarmul_ws) (
+    point_p a,
+    const point_p b,
+    const scalar_p scalar,
+    void *workspace
+) {
+    union scalarmul_workspace *ws = (union scalarmul_workspace *)workspace;
+    point_scalarmul(a, b, scalar, ws->scalarmul);
+}
+
+static void
+point_double_scalarmul (
     point_p a,
     const point_p b,
     const scalar_p scalarb,
     const point_p c,
-    const scalar_p scalarc
+    const scalar_p scalarc,
+    pniels_p *multiples1,
+    pniels_p *multiples2
 ) {
     const int WINDOW = GOLDILOCKS_WINDOW_BITS,
         WINDOW_MASK = (1<<WINDOW)-1,
         WINDOW_T_MASK = WINDOW_MASK >> 1,
-        NTABLE = 1<<(WINDOW-1);
+        NTABLE = WINDOW_NTABLE;
 
     scalar_p scalar1x, scalar2x;
-    pniels_p pn, multiples1[NTABLE], multiples2[NTABLE];
+    pniels_p pn;
     point_p tmp;
     int i,j,first=1;
-    API_NS(scalar_add)(scalar1x, scalarb, point_scalarmul_adjustment);
-    API_NS(scalar_halve)(scalar1x,scalar1x);
-    API_NS(scalar_add)(scalar2x, scalarc, point_scalarmul_adjustment);
-    API_NS(scalar_halve)(scalar2x,scalar2x);
+    window_scalar_prepare(scalar1x, scalarb);
+    window_scalar_prepare(scalar2x, scalarc);
 
     /* Set up a precomputed table with odd multiples of b. */
     prepare_fixed_window(multiples1, b, NTABLE);
@@ -532,34 +709,59 @@ void API_NS(point_double_scalarmul) (
     /* Write out the answer */
     API_NS(point_copy)(a,tmp);
 
-    goldilocks_bzero(scalar1x,sizeof(scalar1x));
-    goldilocks_bzero(scalar2x,sizeof(scalar2x));
-    goldilocks_bzero(pn,sizeof(pn));
-    goldilocks_bzero(multiples1,sizeof(multiples1));
-    goldilocks_bzero(multiples2,sizeof(multiples2));
-    goldilocks_bzero(tmp,sizeof(tmp));
+    SCRUB(scalar1x,sizeof(scalar1x));
+    SCRUB(scalar2x,sizeof(scalar2x));
+    SCRUB(pn,sizeof(pn));
+    SCRUB(multiples1,NTABLE*sizeof(pniels_p));
+    SCRUB(multiples2,NTABLE*sizeof(pniels_p));
+    SCRUB(tmp,sizeof(tmp));
 }
 
-void API_NS(point_dual_scalarmul) (
+void API_NS(point_double_scalarmul) (
+    point_p a,
+    const point_p b,
+    const scalar_p scalarb,
+    const point_p c,
+    const scalar_p scalarc
+) {
+    pniels_p multiples1[WINDOW_NTABLE], multiples2[WINDOW_NTABLE];
+    point_double_scalarmul(a, b, scalarb, c, scalarc, multiples1, multiples2);
+}
+
+void API_NS(point_double_scalarmul_ws) (
+    point_p a,
+    const point_p b,
+    const scalar_p scalarb,
+    const point_p c,
+    const scalar_p scalarc,
+    void *workspace
+) {
+    union scalarmul_workspace *ws = (union scalarmul_workspace *)workspace;
+    point_double_scalarmul(a, b, scalarb, c, scalarc,
+        ws->double_scalarmul.b, ws->double_scalarmul.c);
+}
+
+static void
+point_dual_scalarmul (
     point_p a1,
     point_p a2,
     const point_p b,
     const scalar_p scalar1,
-    const scalar_p scalar2
+    const scalar_p scalar2,
+    point_p *multiples1,
+    point_p *multiples2
 ) {
     const int WINDOW = GOLDILOCKS_WINDOW_BITS,
         WINDOW_MASK = (1<<WINDOW)-1,
         WINDOW_T_MASK = WINDOW_MASK >> 1,
-        NTABLE = 1<<(WINDOW-1);
+        NTABLE = WINDOW_NTABLE;
 
     scalar_p scalar1x, scalar2x;
-    point_p multiples1[NTABLE], multiples2[NTABLE], working, tmp;
+    point_p working, tmp;
     pniels_p pn;
     int i,j;
-    API_NS(scalar_add)(scalar1x, scalar1, point_scalarmul_adjustment);
-    API_NS(scalar_halve)(scalar1x,scalar1x);
-    API_NS(scalar_add)(scalar2x, scalar2, point_scalarmul_adjustment);
-    API_NS(scalar_halve)(scalar2x,scalar2x);
+    window_scalar_prepare(scalar1x, scalar1);
+    window_scalar_prepare(scalar2x, scalar2);
 
     /* Set up a precomputed table with odd multiples of b. */
 
@@ -632,13 +834,161 @@ void API_NS(point_dual_scalarmul) (
         API_NS(point_copy)(a2, multiples2[0]);
     }
 
-    goldilocks_bzero(scalar1x,sizeof(scalar1x));
-    goldilocks_bzero(scalar2x,sizeof(scalar2x));
-    goldilocks_bzero(pn,sizeof(pn));
-    goldilocks_bzero(multiples1,sizeof(multiples1));
-    goldilocks_bzero(multiples2,sizeof(multiples2));
-    goldilocks_bzero(tmp,sizeof(tmp));
-    goldilocks_bzero(working,sizeof(working));
+    SCRUB(scalar1x,sizeof(scalar1x));
+    SCRUB(scalar2x,sizeof(scalar2x));
+    SCRUB(pn,sizeof(pn));
+    SCRUB(multiples1,NTABLE*sizeof(point_p));
+    SCRUB(multiples2,NTABLE*sizeof(point_p));
+    SCRUB(tmp,sizeof(tmp));
+    SCRUB(working,sizeof(working));
+}
+
+void API_NS(point_dual_scalarmul) (
+    point_p a1,
+    point_p a2,
+    const point_p b,
+    const scalar_p scalar1,
+    const scalar_p scalar2
+) {
+    point_p multiples1[WINDOW_NTABLE], multiples2[WINDOW_NTABLE];
+    point_dual_scalarmul(a1, a2, b, scalar1, scalar2, multiples1, multiples2);
+}
+
+void API_NS(point_dual_scalarmul_ws) (
+    point_p a1,
+    point_p a2,
+    const point_p b,
+    const scalar_p scalar1,
+    const scalar_p scalar2,
+    void *workspace
+) {
+    union scalarmul_workspace *ws = (union scalarmul_workspace *)workspace;
+    point_dual_scalarmul(a1, a2, b, scalar1, scalar2,
+        ws->dual_scalarmul.a1, ws->dual_scalarmul.a2);
+}
+
+/* Returns false if any affine base was invalid; combo is then meaningless. */
+static mask_t
+point_multiscalarmul (
+    point_p combo,
+    const point_s *bases,
+    const API_NS(affine_point_s) *affine_bases,
+    const scalar_s *scalars,
+    size_t n,
+    struct multiscalarmul_entry *batch,
+    size_t batch_size
+) {
+    const int WINDOW = GOLDILOCKS_MULTISCALARMUL_WINDOW_BITS,
+        WINDOW_MASK = (1<<WINDOW)-1,
+        WINDOW_T_MASK = WINDOW_MASK >> 1,
+        NTABLE = MULTISCALARMUL_NTABLE,
+        TOP = MULTISCALARMUL_TOP;
+
+    pniels_p pn;
+    point_p tmp, sum, base;
+    size_t done, m, k;
+    int i,j;
+    mask_t succ = -1;
+
+    API_NS(point_copy)(sum, API_NS(point_identity));
+    pthread_once(&window_adjust_once, window_adjust_setup);
+
+    /* Each batch of points shares one doubling chain.
+     * Batching bounds the stack used by the tables. */
+    for (done=0; done<n; done+=m) {
+        m = n-done;
+        if (m > batch_size) m = batch_size;
+
+        /* Set up precomputed tables with odd multiples of each base. */
+        for (k=0; k<m; k++) {
+            API_NS(scalar_add)(batch[k].scalarx, &scalars[done+k], multiscalarmul_adjust);
+            API_NS(scalar_halve)(batch[k].scalarx, batch[k].scalarx);
+            if (affine_bases) {
+                succ &= affine_to_pt(base, &affine_bases[done+k]);
+                succ &= bool_to_mask(API_NS(point_valid)(base));
+                prepare_fixed_window(batch[k].multiples, base, NTABLE);
+            } else {
+                prepare_fixed_window(batch[k].multiples, &bases[done+k], NTABLE);
+            }
+        }
+
+        for (i=TOP; i>=0; i-=WINDOW) {
+            if (i != TOP) {
+                for (j=0; j<WINDOW-1; j++)
+                    point_double_internal(tmp, tmp, -1);
+                point_double_internal(tmp, tmp, 0);
+            }
+
+            for (k=0; k<m; k++) {
+                mask_t inv;
+                /* Fetch another block of bits */
+                word_t bits = batch[k].scalarx->limb[i/WBITS] >> (i%WBITS);
+                if (i%WBITS >= WBITS-WINDOW && i/WBITS<SCALAR_LIMBS-1) {
+                    bits ^= batch[k].scalarx->limb[i/WBITS+1] << (WBITS - (i%WBITS));
+                }
+                bits &= WINDOW_MASK;
+                inv = (bits>>(WINDOW-1))-1;
+                bits ^= inv;
+
+                /* Add in from table.  Skip t when a doubling comes next. */
+                constant_time_lookup(pn, batch[k].multiples, sizeof(pn), NTABLE, bits & WINDOW_T_MASK);
+                cond_neg_niels(pn->n, inv);
+                if (i == TOP && k == 0) {
+                    pniels_to_pt(tmp, pn);
+                } else {
+                    add_pniels_to_pt(tmp, pn, (i && k == m-1) ? -1 : 0);
+                }
+            }
+        }
+
+        API_NS(point_add)(sum, sum, tmp);
+    }
+
+    /* Write out the answer */
+    API_NS(point_copy)(combo, sum);
+
+    SCRUB(batch,batch_size*sizeof(*batch));
+    SCRUB(pn,sizeof(pn));
+    SCRUB(tmp,sizeof(tmp));
+    SCRUB(sum,sizeof(sum));
+    SCRUB(base,sizeof(base));
+    return succ;
+}
+
+void API_NS(point_multiscalarmul) (
+    point_p combo,
+    const point_s *bases,
+    const scalar_s *scalars,
+    size_t n
+) {
+    struct multiscalarmul_entry batch[GOLDILOCKS_MULTISCALARMUL_BATCH];
+    ignore_result(point_multiscalarmul(combo, bases, NULL, scalars, n, batch, GOLDILOCKS_MULTISCALARMUL_BATCH));
+}
+
+goldilocks_error_t API_NS(point_multiscalarmul_affine) (
+    point_p combo,
+    const API_NS(affine_point_s) *bases,
+    const scalar_s *scalars,
+    size_t n
+) {
+    struct multiscalarmul_entry batch[GOLDILOCKS_MULTISCALARMUL_BATCH];
+    mask_t succ = point_multiscalarmul(combo, NULL, bases, scalars, n, batch, GOLDILOCKS_MULTISCALARMUL_BATCH);
+    return goldilocks_succeed_if(mask_to_bool(succ));
+}
+
+void API_NS(point_multiscalarmul_ws) (
+    point_p combo,
+    const point_s *bases,
+    const scalar_s *scalars,
+    size_t n,
+    void *workspace
+) {
+    union scalarmul_workspace *ws = (union scalarmul_workspace *)workspace;
+    ignore_result(point_multiscalarmul(combo, bases, NULL, scalars, n, ws->multiscalarmul, WORKSPACE_MULTISCALARMUL_BATCH));
+}
+
+size_t API_NS(sizeof_workspace) (void) {
+    return sizeof(union scalarmul_workspace);
 }
 
 goldilocks_bool_t API_NS(point_eq) ( const point_p p, const point_p q ) {
@@ -707,7 +1057,12 @@ static void gf_batch_invert (
 ) {
     gf t1;
     int i;
-    assert(n>1);
+    assert(n>0);
+
+    if (n == 1) {
+        gf_invert(out[0], in[0], 1);
+        return;
+    }
 
     gf_copy(out[1], in[0]);
     for (i=1; i<(int) (n-1); i++) {
@@ -749,49 +1104,248 @@ static void batch_normalize_niels (
         gf_copy(table[i]->c, product);
     }
 
-    goldilocks_bzero(product,sizeof(product));
+    SCRUB(product,sizeof(product));
 }
 
-void API_NS(precompute) (
-    precomputed_s *table,
-    const point_p base
+/* Prepared points are affine niels. */
+#define PREPARE_BATCH 32
+typedef char prepared_point_is_niels[
+    (sizeof(API_NS(prepared_point_s)) == sizeof(niels_s)) ? 1 : -1];
+
+void API_NS(point_prepare) (
+    API_NS(prepared_point_p) prepared,
+    const point_p p
 ) {
-    const unsigned int n = COMBS_N, t = COMBS_T, s = COMBS_S;
-    point_p working, start, doubles[t-1];
-    pniels_p pn_tmp;
-    gf zs[n<<(t-1)], zis[n<<(t-1)];
-    unsigned int i,j,k;
+    API_NS(point_prepare_batch)(prepared, p, 1);
+}
 
-    assert(n*t*s >= SCALAR_BITS);
+void API_NS(point_prepare_batch) (
+    API_NS(prepared_point_s) *prepared,
+    const point_s *points,
+    size_t n
+) {
+    niels_p *out = (niels_p *)prepared;
+    pniels_p pn;
+    gf zs[PREPARE_BATCH], zis[PREPARE_BATCH];
+    size_t i, j, m;
+
+    for (i=0; i<n; i+=m) {
+        m = n-i;
+        if (m > PREPARE_BATCH) m = PREPARE_BATCH;
+        for (j=0; j<m; j++) {
+            pt_to_pniels(pn, &points[i+j]);
+            memcpy(out[i+j], pn->n, sizeof(niels_p));
+            gf_copy(zs[j], pn->z);
+        }
+        batch_normalize_niels(&out[i], (const gf *)zs, zis, m);
+    }
 
-    API_NS(point_copy)(working, base);
+    SCRUB(pn,sizeof(pn));
+    SCRUB(zs,sizeof(zs));
+    SCRUB(zis,sizeof(zis));
+}
 
-    /* Compute n tables */
-    for (i=0; i<n; i++) {
+void API_NS(point_add_prepared) (
+    point_p sum,
+    const point_p a,
+    const API_NS(prepared_point_p) b
+) {
+    if (sum != a) API_NS(point_copy)(sum,a);
+    add_niels_to_pt(sum, (const niels_s *)b, 0);
+}
 
-        /* Doubling phase */
-        for (j=0; j<t; j++) {
-            if (j) API_NS(point_add)(start, start, working);
-            else API_NS(point_copy)(start, working);
+void API_NS(point_sub_prepared) (
+    point_p diff,
+    const point_p a,
+    const API_NS(prepared_point_p) b
+) {
+    if (diff != a) API_NS(point_copy)(diff,a);
+    sub_niels_from_pt(diff, (const niels_s *)b, 0);
+}
 
-            if (j==t-1 && i==n-1) break;
+/* The sum of n points, in extended coordinates.  Normalizing the points
+ * first would make each addition 2 multiplications cheaper, but costs
+ * about 6 per point, so it only pays for points which are added again.
+ */
+static void
+point_sum_serial (
+    point_p out,
+    const point_s *points,
+    size_t n
+) {
+    point_p sum;
+    size_t i;
+    API_NS(point_copy)(sum, API_NS(point_identity));
+    for (i=0; i<n; i++) API_NS(point_add)(sum, sum, &points[i]);
+    API_NS(point_copy)(out, sum);
+    SCRUB(sum,sizeof(sum));
+}
 
-            point_double_internal(working, working,0);
-            if (j<t-1) API_NS(point_copy)(doubles[j], working);
+#if GOLDILOCKS_POINT_SUM_THREADS > 1
+struct point_sum_job {
+    point_p sum;
+    const point_s *points;
+    size_t n;
+};
 
-            for (k=0; k<s-1; k++)
-                point_double_internal(working, working, k<s-2);
-        }
+static void *point_sum_thread(void *arg) {
+    struct point_sum_job *job = (struct point_sum_job *)arg;
+    point_sum_serial(job->sum, job->points, job->n);
+    return NULL;
+}
 
-        /* Gray-code phase */
-        for (j=0;; j++) {
-            int gray = j ^ (j>>1);
-            int idx = (((i+1)<<(t-1))-1) ^ gray;
-            int delta;
+static unsigned int point_sum_nthreads(size_t n) {
+    size_t nthreads = n / GOLDILOCKS_POINT_SUM_THREAD_MIN;
+    long cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    if (nthreads > GOLDILOCKS_POINT_SUM_THREADS) nthreads = GOLDILOCKS_POINT_SUM_THREADS;
+    if (cpus > 0 && nthreads > (size_t)cpus) nthreads = cpus;
+    return nthreads ? nthreads : 1;
+}
+#endif
 
-            pt_to_pniels(pn_tmp, start);
-            memcpy(table->table[idx], pn_tmp->n, sizeof(pn_tmp->n));
-            gf_copy(zs[idx], pn_tmp->z);
+void API_NS(point_sum) (
+    point_p sum,
+    const point_s *points,
+    size_t n
+) {
+#if GOLDILOCKS_POINT_SUM_THREADS > 1
+    struct point_sum_job jobs[GOLDILOCKS_POINT_SUM_THREADS];
+    pthread_t threads[GOLDILOCKS_POINT_SUM_THREADS];
+    int started[GOLDILOCKS_POINT_SUM_THREADS];
+    unsigned int nthreads = point_sum_nthreads(n), i, step;
+    size_t first = 0;
+
+    if (nthreads > 1) {
+        for (i=0; i<nthreads; i++) {
+            jobs[i].points = &points[first];
+            jobs[i].n = (i == nthreads-1) ? n-first : n/nthreads;
+            first += jobs[i].n;
+        }
+
+        /* If a thread can't be started, its share is summed here. */
+        for (i=1; i<nthreads; i++) {
+            started[i] = !pthread_create(&threads[i], NULL, point_sum_thread, &jobs[i]);
+        }
+        point_sum_thread(&jobs[0]);
+        for (i=1; i<nthreads; i++) {
+            if (started[i]) pthread_join(threads[i], NULL);
+            else point_sum_thread(&jobs[i]);
+        }
+
+        /* Combine the partial sums pairwise. */
+        for (step=1; step<nthreads; step*=2) {
+            for (i=0; i+step<nthreads; i+=2*step) {
+                API_NS(point_add)(jobs[i].sum, jobs[i].sum, jobs[i+step].sum);
+            }
+        }
+        API_NS(point_copy)(sum, jobs[0].sum);
+        SCRUB(jobs,sizeof(jobs));
+        return;
+    }
+#endif
+    point_sum_serial(sum, points, n);
+}
+
+void API_NS(point_to_affine) (
+    API_NS(affine_point_p) affine,
+    const point_p p
+) {
+    API_NS(point_to_affine_batch)(affine, p, 1);
+}
+
+void API_NS(point_to_affine_batch) (
+    API_NS(affine_point_s) *affine,
+    const point_s *points,
+    size_t n
+) {
+    gf zs[PREPARE_BATCH], zis[PREPARE_BATCH], c;
+    size_t i, j, m;
+
+    for (i=0; i<n; i+=m) {
+        m = n-i;
+        if (m > PREPARE_BATCH) m = PREPARE_BATCH;
+        for (j=0; j<m; j++) gf_copy(zs[j], points[i+j].z);
+        gf_batch_invert(zis, (const gf *)zs, m);
+        for (j=0; j<m; j++) {
+            gf_mul(c, points[i+j].x, zis[j]);
+            gf_serialize(affine[i+j].x, c);
+            gf_mul(c, points[i+j].y, zis[j]);
+            gf_serialize(affine[i+j].y, c);
+        }
+    }
+
+    SCRUB(zs,sizeof(zs));
+    SCRUB(zis,sizeof(zis));
+    SCRUB(c,sizeof(c));
+}
+
+goldilocks_error_t API_NS(point_from_affine) (
+    point_p p,
+    const API_NS(affine_point_p) affine
+) {
+    mask_t succ = affine_to_pt(p, affine);
+    succ &= bool_to_mask(API_NS(point_valid)(p));
+    return goldilocks_succeed_if(mask_to_bool(succ));
+}
+
+/* Normalize a few combs at a time, to bound the space used for zs. */
+static unsigned int
+precompute_combs_batch (
+    unsigned int n,
+    unsigned int t
+) {
+    const unsigned int per_comb = 1u<<(t-1),
+        batch_combs = (per_comb >= COMBS_NORMALIZE_BATCH) ? 1 : COMBS_NORMALIZE_BATCH/per_comb;
+    return batch_combs < n ? batch_combs : n;
+}
+
+static void
+precompute_combs (
+    niels_p *table,
+    const point_p base,
+    unsigned int n,
+    unsigned int t,
+    unsigned int s,
+    gf *zs,
+    gf *__restrict__ zis,
+    point_p *doubles
+) {
+    const unsigned int batch_combs = precompute_combs_batch(n,t),
+        batch = batch_combs << (t-1);
+    point_p working, start;
+    pniels_p pn_tmp;
+    unsigned int i,j,k,first=0;
+
+    assert(n*t*s >= SCALAR_BITS);
+
+    API_NS(point_copy)(working, base);
+
+    /* Compute n tables */
+    for (i=0; i<n; i++) {
+
+        /* Doubling phase */
+        for (j=0; j<t; j++) {
+            if (j) API_NS(point_add)(start, start, working);
+            else API_NS(point_copy)(start, working);
+
+            if (j==t-1 && i==n-1) break;
+
+            point_double_internal(working, working,0);
+            if (j<t-1) API_NS(point_copy)(doubles[j], working);
+
+            for (k=0; k<s-1; k++)
+                point_double_internal(working, working, k<s-2);
+        }
+
+        /* Gray-code phase */
+        for (j=0;; j++) {
+            int gray = j ^ (j>>1);
+            int idx = (((i+1)<<(t-1))-1) ^ gray;
+            int delta;
+
+            pt_to_pniels(pn_tmp, start);
+            memcpy(table[idx], pn_tmp->n, sizeof(pn_tmp->n));
+            gf_copy(zs[idx-first], pn_tmp->z);
 
             if (j >= (1u<<(t-1)) - 1) break;
             delta = (j+1) ^ ((j+1)>>1) ^ gray;
@@ -805,16 +1359,78 @@ void API_NS(precompute) (
                 API_NS(point_sub)(start, start, doubles[k]);
             }
         }
+
+        if ((i+1) % batch_combs == 0 || i == n-1) {
+            batch_normalize_niels(&table[first],(const gf *)zs,zis,((i+1)<<(t-1))-first);
+            first = (i+1)<<(t-1);
+        }
     }
 
-    batch_normalize_niels(table->table,(const gf *)zs,zis,n<<(t-1));
+    SCRUB(zs,batch*sizeof(gf));
+    SCRUB(zis,batch*sizeof(gf));
+    SCRUB(pn_tmp,sizeof(pn_tmp));
+    SCRUB(working,sizeof(working));
+    SCRUB(start,sizeof(start));
+    SCRUB(doubles,(t-1)*sizeof(point_p));
+}
+
+/* Precompute on the stack, whose use depends on the geometry. */
+static void
+precompute_combs_stack (
+    niels_p *table,
+    const point_p base,
+    unsigned int n,
+    unsigned int t,
+    unsigned int s
+) {
+    const unsigned int batch = precompute_combs_batch(n,t) << (t-1);
+    point_p doubles[t-1];
+    gf zs[batch], zis[batch];
+    precompute_combs(table, base, n, t, s, zs, zis, doubles);
+}
 
-    goldilocks_bzero(zs,sizeof(zs));
-    goldilocks_bzero(zis,sizeof(zis));
-    goldilocks_bzero(pn_tmp,sizeof(pn_tmp));
-    goldilocks_bzero(working,sizeof(working));
-    goldilocks_bzero(start,sizeof(start));
-    goldilocks_bzero(doubles,sizeof(doubles));
+static int
+comb_geometry_valid (
+    const API_NS(comb_geometry_s) *geometry
+) {
+    unsigned int n = geometry->n, t = geometry->t, s = geometry->s;
+    return n >= 1 && t >= 2 && t <= COMBS_T_MAX && s >= 1
+        && n <= 2*SCALAR_BITS && s <= 2*SCALAR_BITS
+        && n*t*s >= SCALAR_BITS && n*t*s <= 2*SCALAR_BITS;
+}
+
+void API_NS(precompute) (
+    precomputed_s *table,
+    const point_p base
+) {
+    precompute_combs_stack(table->table, base, COMBS_N, COMBS_T, COMBS_S);
+}
+
+void API_NS(precompute_ws) (
+    precomputed_s *table,
+    const point_p base,
+    void *workspace
+) {
+    union scalarmul_workspace *ws = (union scalarmul_workspace *)workspace;
+    precompute_combs(table->table, base, COMBS_N, COMBS_T, COMBS_S,
+        ws->precompute.zs, ws->precompute.zis, ws->precompute.doubles);
+}
+
+size_t API_NS(sizeof_precomputed_combs) (
+    const API_NS(comb_geometry_s) *geometry
+) {
+    if (!comb_geometry_valid(geometry)) return 0;
+    return sizeof(niels_p) * (geometry->n << (geometry->t-1));
+}
+
+goldilocks_error_t API_NS(precompute_combs) (
+    precomputed_s *table,
+    const API_NS(comb_geometry_s) *geometry,
+    const point_p base
+) {
+    if (!comb_geometry_valid(geometry)) return GOLDILOCKS_FAILURE;
+    precompute_combs_stack(table->table, base, geometry->n, geometry->t, geometry->s);
+    return GOLDILOCKS_SUCCESS;
 }
 
 static GOLDILOCKS_INLINE void
@@ -827,53 +1443,163 @@ constant_time_lookup_niels (
     constant_time_lookup(ni, table, sizeof(niels_s), nelts, idx);
 }
 
+/** Fetch the signed entry of comb j for column i of the (adjusted) scalar. */
+static GOLDILOCKS_INLINE void
+comb_lookup_niels (
+    niels_p ni,
+    const niels_p *table,
+    unsigned int t,
+    unsigned int s,
+    const scalar_p scalar1x,
+    int i,
+    unsigned int j
+) {
+    unsigned int k;
+    int tab = 0;
+    mask_t invert;
+
+    for (k=0; k<t; k++) {
+        unsigned int bit = i + s*(k + j*t);
+        if (bit < SCALAR_BITS) {
+            tab |= (scalar1x->limb[bit/WBITS] >> (bit%WBITS) & 1) << k;
+        }
+    }
+
+    invert = (tab>>(t-1))-1;
+    tab ^= invert;
+    tab &= (1<<(t-1)) - 1;
+
+    constant_time_lookup_niels(ni, &table[j<<(t-1)], 1<<(t-1), tab);
+
+    cond_neg_niels(ni, invert);
+}
+
+/**
+ * Run columns from..to-1 of a comb scalarmul, counting from the top,
+ * on the halved and adjusted scalar1x.  out needs no t coordinate
+ * between runs.
+ */
+static void
+precomputed_combs_columns (
+    point_p out,
+    const niels_p *table,
+    unsigned int n,
+    unsigned int t,
+    unsigned int s,
+    const scalar_p scalar1x,
+    unsigned int from,
+    unsigned int to
+) {
+    int i;
+    unsigned j;
+    niels_p ni;
+
+    for (i=(int)s-1-(int)from; i>(int)s-1-(int)to; i--) {
+        if (i != (int)s-1) point_double_internal(out,out,0);
+
+        for (j=0; j<n; j++) {
+            comb_lookup_niels(ni, table, t, s, scalar1x, i, j);
+            if ((i!=(int)s-1)||j) {
+                add_niels_to_pt(out, ni, j==n-1 && i);
+            } else {
+                niels_to_pt(out, ni);
+            }
+        }
+    }
+
+    SCRUB(ni,sizeof(ni));
+}
+
+/* Adjust and halve a scalar for the comb columns. */
+static void
+precomputed_combs_prepare (
+    scalar_p scalar1x,
+    const scalar_p scalar,
+    unsigned int n,
+    unsigned int t,
+    unsigned int s
+) {
+    window_adjustment(scalar1x, n*t*s);
+    API_NS(scalar_add)(scalar1x, scalar, scalar1x);
+    API_NS(scalar_halve)(scalar1x,scalar1x);
+}
+
+static void
+precomputed_combs_scalarmul (
+    point_p out,
+    const niels_p *table,
+    unsigned int n,
+    unsigned int t,
+    unsigned int s,
+    const scalar_p scalar
+) {
+    scalar_p scalar1x;
+    precomputed_combs_prepare(scalar1x, scalar, n, t, s);
+    precomputed_combs_columns(out, table, n, t, s, scalar1x, 0, s);
+    SCRUB(scalar1x,sizeof(scalar1x));
+}
+
 void API_NS(precomputed_scalarmul) (
     point_p out,
     const precomputed_s *table,
     const scalar_p scalar
+) {
+    precomputed_combs_scalarmul(out, table->table, COMBS_N, COMBS_T, COMBS_S, scalar);
+}
+
+goldilocks_error_t API_NS(precomputed_combs_scalarmul) (
+    point_p out,
+    const precomputed_s *table,
+    const API_NS(comb_geometry_s) *geometry,
+    const scalar_p scalar
+) {
+    if (!comb_geometry_valid(geometry)) return GOLDILOCKS_FAILURE;
+    precomputed_combs_scalarmul(out, table->table, geometry->n, geometry->t, geometry->s, scalar);
+    return GOLDILOCKS_SUCCESS;
+}
+
+void API_NS(precomputed_double_scalarmul) (
+    point_p out,
+    const precomputed_s *table1,
+    const scalar_p scalar1,
+    const precomputed_s *table2,
+    const scalar_p scalar2
 ) {
     int i;
-    unsigned j,k;
+    unsigned j;
     const unsigned int n = COMBS_N, t = COMBS_T, s = COMBS_S;
 
-    scalar_p scalar1x;
+    scalar_p scalar1x, scalar2x;
     niels_p ni;
 
-    API_NS(scalar_add)(scalar1x, scalar, precomputed_scalarmul_adjustment);
+    window_adjustment(scalar2x, n*t*s);
+    API_NS(scalar_add)(scalar1x, scalar1, scalar2x);
     API_NS(scalar_halve)(scalar1x,scalar1x);
+    API_NS(scalar_add)(scalar2x, scalar2, scalar2x);
+    API_NS(scalar_halve)(scalar2x,scalar2x);
 
-
+    /* Both combs have the same shape, so they share the doublings. */
     for (i=s-1; i>=0; i--) {
         if (i != (int)s-1) point_double_internal(out,out,0);
 
         for (j=0; j<n; j++) {
-            int tab = 0;
-            mask_t invert;
-
-            for (k=0; k<t; k++) {
-                unsigned int bit = i + s*(k + j*t);
-                if (bit < SCALAR_BITS) {
-                    tab |= (scalar1x->limb[bit/WBITS] >> (bit%WBITS) & 1) << k;
-                }
-            }
-
-            invert = (tab>>(t-1))-1;
-            tab ^= invert;
-            tab &= (1<<(t-1)) - 1;
-
-            constant_time_lookup_niels(ni, &table->table[j<<(t-1)], 1<<(t-1), tab);
-
-            cond_neg_niels(ni, invert);
+            comb_lookup_niels(ni, table1->table, t, s, scalar1x, i, j);
             if ((i!=(int)s-1)||j) {
-                add_niels_to_pt(out, ni, j==n-1 && i);
+                add_niels_to_pt(out, ni, 0);
             } else {
                 niels_to_pt(out, ni);
             }
         }
+
+        for (j=0; j<n; j++) {
+            comb_lookup_niels(ni, table2->table, t, s, scalar2x, i, j);
+            add_niels_to_pt(out, ni, j==n-1 && i);
+        }
     }
 
-    goldilocks_bzero(ni,sizeof(ni));
-    goldilocks_bzero(scalar1x,sizeof(scalar1x));
+    SCRUB(ni,sizeof(ni));
+    SCRUB(scalar1x,sizeof(scalar1x));
+    SCRUB(scalar2x,sizeof(scalar2x));
 }
 
 void API_NS(point_cond_sel) (
@@ -902,49 +1628,121 @@ goldilocks_error_t API_NS(direct_scalarmul) (
     return succ;
 }
 
-void API_NS(point_mul_by_ratio_and_encode_like_eddsa) (
-    uint8_t enc[GOLDILOCKS_EDDSA_448_PUBLIC_BYTES],
+/* Move a point from the twisted curve to the untwisted one, multiplying
+ * by the ratio.  The output is projective.
+ */
+static void point_to_untwisted (
+    gf x,
+    gf y,
+    gf z,
     const point_p p
 ) {
-
-    /* The point is now on the twisted curve.  Move it to untwisted. */
-    gf x, y, z, t;
-    point_p q;
-    gf u;
-    API_NS(point_copy)(q,p);
+    gf t, u;
     /* 4-isogeny: 2xy/(y^+x^2), (y^2-x^2)/(2z^2-y^2+x^2) */
-    gf_sqr ( x, q->x );
-    gf_sqr ( t, q->y );
+    gf_sqr ( x, p->x );
+    gf_sqr ( t, p->y );
     gf_add( u, x, t );
-    gf_add( z, q->y, q->x );
+    gf_add( z, p->y, p->x );
     gf_sqr ( y, z);
     gf_sub ( y, y, u );
     gf_sub ( z, t, x );
-    gf_sqr ( x, q->z );
+    gf_sqr ( x, p->z );
     gf_add ( t, x, x);
     gf_sub ( t, t, z);
     gf_mul ( x, t, y );
     gf_mul ( y, z, u );
     gf_mul ( z, u, t );
-    goldilocks_bzero(u,sizeof(u));
+    SCRUB(t,sizeof(t));
+    SCRUB(u,sizeof(u));
+}
 
-    /* Affinize */
-    gf_invert(z,z,1);
-    gf_mul(t,x,z);
-    gf_mul(x,y,z);
+static void encode_untwisted (
+    uint8_t enc[GOLDILOCKS_EDDSA_448_PUBLIC_BYTES],
+    const gf x,
+    const gf y,
+    const gf zi
+) {
+    gf ax, ay;
+    gf_mul(ax,x,zi);
+    gf_mul(ay,y,zi);
 
-    /* Encode */
     enc[GOLDILOCKS_EDDSA_448_PRIVATE_BYTES-1] = 0;
-    gf_serialize(enc, x);
-    enc[GOLDILOCKS_EDDSA_448_PRIVATE_BYTES-1] |= 0x80 & gf_lobit(t);
+    gf_serialize(enc, ay);
+    enc[GOLDILOCKS_EDDSA_448_PRIVATE_BYTES-1] |= 0x80 & gf_lobit(ax);
+
+    SCRUB(ax,sizeof(ax));
+    SCRUB(ay,sizeof(ay));
+}
+
+void API_NS(point_mul_by_ratio_and_encode_like_eddsa) (
+    uint8_t enc[GOLDILOCKS_EDDSA_448_PUBLIC_BYTES],
+    const point_p p
+) {
+    /* The point is now on the twisted curve.  Move it to untwisted. */
+    gf x, y, z;
+    point_to_untwisted(x,y,z,p);
+
+    /* Affinize and encode */
+    gf_invert(z,z,1);
+    encode_untwisted(enc,x,y,z);
 
-    goldilocks_bzero(x,sizeof(x));
-    goldilocks_bzero(y,sizeof(y));
-    goldilocks_bzero(z,sizeof(z));
-    goldilocks_bzero(t,sizeof(t));
-    API_NS(point_destroy)(q);
+    SCRUB(x,sizeof(x));
+    SCRUB(y,sizeof(y));
+    SCRUB(z,sizeof(z));
 }
 
+void API_NS(point_mul_by_ratio_and_encode_like_eddsa_batch) (
+    uint8_t *enc,
+    const point_s *points,
+    size_t n
+) {
+    gf xs[PREPARE_BATCH], ys[PREPARE_BATCH], zs[PREPARE_BATCH], zis[PREPARE_BATCH];
+    size_t i, j, m;
+
+    for (i=0; i<n; i+=m) {
+        m = n-i;
+        if (m > PREPARE_BATCH) m = PREPARE_BATCH;
+        for (j=0; j<m; j++) point_to_untwisted(xs[j],ys[j],zs[j],&points[i+j]);
+        gf_batch_invert(zis, (const gf *)zs, m);
+        for (j=0; j<m; j++) {
+            encode_untwisted(&enc[(i+j)*GOLDILOCKS_EDDSA_448_PUBLIC_BYTES],xs[j],ys[j],zis[j]);
+        }
+    }
+
+    SCRUB(xs,sizeof(xs));
+    SCRUB(ys,sizeof(ys));
+    SCRUB(zs,sizeof(zs));
+    SCRUB(zis,sizeof(zis));
+}
+
+/* Move a point from the untwisted curve to the twisted one, in place.
+ * On input p->x, p->y and p->z hold its projective coordinates on the
+ * untwisted curve; p->t is ignored.
+ */
+void API_NS(point_from_untwisted) (
+    point_p p
+) {
+    gf a, b, c, d;
+    /* 4-isogeny 2xy/(y^2-ax^2), (y^2+ax^2)/(2-y^2-ax^2) */
+    gf_sqr ( c, p->x );
+    gf_sqr ( a, p->y );
+    gf_add ( d, c, a );
+    gf_add ( p->t, p->y, p->x );
+    gf_sqr ( b, p->t );
+    gf_sub ( b, b, d );
+    gf_sub ( p->t, a, c );
+    gf_sqr ( p->x, p->z );
+    gf_add ( p->z, p->x, p->x );
+    gf_sub ( a, p->z, d );
+    gf_mul ( p->x, a, b );
+    gf_mul ( p->z, p->t, a );
+    gf_mul ( p->y, p->t, d );
+    gf_mul ( p->t, b, d );
+    SCRUB(a,sizeof(a));
+    SCRUB(b,sizeof(b));
+    SCRUB(c,sizeof(c));
+    SCRUB(d,sizeof(d));
+}
 
 goldilocks_error_t API_NS(point_decode_like_eddsa_and_mul_by_ratio) (
     point_p p,
@@ -952,7 +1750,6 @@ goldilocks_error_t API_NS(point_decode_like_eddsa_and_mul_by_ratio) (
 ) {
     uint8_t enc2[GOLDILOCKS_EDDSA_448_PUBLIC_BYTES];
     mask_t low, succ;
-    gf a, b, c, d;
     memcpy(enc2,enc,sizeof(enc2));
 
     low = ~word_is_zero(enc2[GOLDILOCKS_EDDSA_448_PRIVATE_BYTES-1] & 0x80);
@@ -976,49 +1773,46 @@ goldilocks_error_t API_NS(point_decode_like_eddsa_and_mul_by_ratio) (
     gf_mul(p->x,p->t,p->z); /* sqrt(num / denom) */
     gf_cond_neg(p->x,gf_lobit(p->x)^low);
     gf_copy(p->z,ONE);
+    API_NS(point_from_untwisted)(p);
 
-    /* 4-isogeny 2xy/(y^2-ax^2), (y^2+ax^2)/(2-y^2-ax^2) */
-    gf_sqr ( c, p->x );
-    gf_sqr ( a, p->y );
-    gf_add ( d, c, a );
-    gf_add ( p->t, p->y, p->x );
-    gf_sqr ( b, p->t );
-    gf_sub ( b, b, d );
-    gf_sub ( p->t, a, c );
-    gf_sqr ( p->x, p->z );
-    gf_add ( p->z, p->x, p->x );
-    gf_sub ( a, p->z, d );
-    gf_mul ( p->x, a, b );
-    gf_mul ( p->z, p->t, a );
-    gf_mul ( p->y, p->t, d );
-    gf_mul ( p->t, b, d );
-    goldilocks_bzero(a,sizeof(a));
-    goldilocks_bzero(b,sizeof(b));
-    goldilocks_bzero(c,sizeof(c));
-    goldilocks_bzero(d,sizeof(d));
-
-    goldilocks_bzero(enc2,sizeof(enc2));
+    SCRUB(enc2,sizeof(enc2));
     assert(API_NS(point_valid)(p) || ~succ);
 
     return goldilocks_succeed_if(mask_to_bool(succ));
 }
 
-goldilocks_error_t goldilocks_x448 (
-    uint8_t out[X_PUBLIC_BYTES],
-    const uint8_t base[X_PUBLIC_BYTES],
-    const uint8_t scalar[X_PRIVATE_BYTES]
+/* State of the X448 Montgomery ladder. */
+struct x448_ladder {
+    gf x1, x2, z2, x3, z3;
+    mask_t swap;
+};
+
+static void
+x448_ladder_init (
+    struct x448_ladder *l,
+    const uint8_t base[X_PUBLIC_BYTES]
 ) {
-    gf x1, x2, z2, x3, z3, t1, t2;
-    int t;
-    mask_t swap = 0, nz = 0;
-    ignore_result(gf_deserialize(x1,base,0));
-    gf_copy(x2,ONE);
-    gf_copy(z2,ZERO);
-    gf_copy(x3,x1);
-    gf_copy(z3,ONE);
+    ignore_result(gf_deserialize(l->x1,base,0));
+    gf_copy(l->x2,ONE);
+    gf_copy(l->z2,ZERO);
+    gf_copy(l->x3,l->x1);
+    gf_copy(l->z3,ONE);
+    l->swap = 0;
+}
 
+/* Run ladder steps from..to-1, counting from the top bit of the scalar. */
+static void
+x448_ladder_steps (
+    struct x448_ladder *l,
+    const uint8_t scalar[X_PRIVATE_BYTES],
+    unsigned int from,
+    unsigned int to
+) {
+    gf t1, t2;
+    int t;
+    mask_t swap = l->swap;
 
-    for (t = X_PRIVATE_BITS-1; t>=0; t--) {
+    for (t = X_PRIVATE_BITS-1-(int)from; t > X_PRIVATE_BITS-1-(int)to; t--) {
         uint8_t sb = scalar[t/8];
         mask_t k_t;
 
@@ -1030,51 +1824,174 @@ goldilocks_error_t goldilocks_x448 (
         k_t = -k_t; /* set to all 0s or all 1s */
 
         swap ^= k_t;
-        gf_cond_swap(x2,x3,swap);
-        gf_cond_swap(z2,z3,swap);
+        gf_cond_swap(l->x2,l->x3,swap);
+        gf_cond_swap(l->z2,l->z3,swap);
         swap = k_t;
 
-        gf_add_nr(t1,x2,z2); /* A = x2 + z2 */        /* 2+e */
-        gf_sub_nr(t2,x2,z2); /* B = x2 - z2 */        /* 3+e */
-        gf_sub_nr(z2,x3,z3); /* D = x3 - z3 */        /* 3+e */
-        gf_mul(x2,t1,z2);    /* DA */
-        gf_add_nr(z2,z3,x3); /* C = x3 + z3 */        /* 2+e */
-        gf_mul(x3,t2,z2);    /* CB */
-        gf_sub_nr(z3,x2,x3); /* DA-CB */              /* 3+e */
-        gf_sqr(z2,z3);       /* (DA-CB)^2 */
-        gf_mul(z3,x1,z2);    /* z3 = x1(DA-CB)^2 */
-        gf_add_nr(z2,x2,x3); /* (DA+CB) */            /* 2+e */
-        gf_sqr(x3,z2);       /* x3 = (DA+CB)^2 */
-
-        gf_sqr(z2,t1);       /* AA = A^2 */
-        gf_sqr(t1,t2);       /* BB = B^2 */
-        gf_mul(x2,z2,t1);    /* x2 = AA*BB */
-        gf_sub_nr(t2,z2,t1); /* E = AA-BB */          /* 3+e */
+        gf_add_nr(t1,l->x2,l->z2); /* A = x2 + z2 */        /* 2+e */
+        gf_sub_nr(t2,l->x2,l->z2); /* B = x2 - z2 */        /* 3+e */
+        gf_sub_nr(l->z2,l->x3,l->z3); /* D = x3 - z3 */     /* 3+e */
+        gf_mul(l->x2,t1,l->z2);    /* DA */
+        gf_add_nr(l->z2,l->z3,l->x3); /* C = x3 + z3 */     /* 2+e */
+        gf_mul(l->x3,t2,l->z2);    /* CB */
+        gf_sub_nr(l->z3,l->x2,l->x3); /* DA-CB */           /* 3+e */
+        gf_sqr(l->z2,l->z3);       /* (DA-CB)^2 */
+        gf_mul(l->z3,l->x1,l->z2); /* z3 = x1(DA-CB)^2 */
+        gf_add_nr(l->z2,l->x2,l->x3); /* (DA+CB) */         /* 2+e */
+        gf_sqr(l->x3,l->z2);       /* x3 = (DA+CB)^2 */
+
+        gf_sqr(l->z2,t1);          /* AA = A^2 */
+        gf_sqr(t1,t2);             /* BB = B^2 */
+        gf_mul(l->x2,l->z2,t1);    /* x2 = AA*BB */
+        gf_sub_nr(t2,l->z2,t1);    /* E = AA-BB */          /* 3+e */
 
         gf_mulw(t1,t2,-EDWARDS_D); /* E*-d = a24*E */
-        gf_add_nr(t1,t1,z2); /* AA + a24*E */         /* 2+e */
-        gf_mul(z2,t2,t1); /* z2 = E(AA+a24*E) */
+        gf_add_nr(t1,t1,l->z2);    /* AA + a24*E */         /* 2+e */
+        gf_mul(l->z2,t2,t1);       /* z2 = E(AA+a24*E) */
     }
 
-    /* Finish */
-    gf_cond_swap(x2,x3,swap);
-    gf_cond_swap(z2,z3,swap);
-    gf_invert(z2,z2,0);
-    gf_mul(x1,x2,z2);
-    gf_serialize(out,x1);
-    nz = ~gf_eq(x1,ZERO);
-
-    goldilocks_bzero(x1,sizeof(x1));
-    goldilocks_bzero(x2,sizeof(x2));
-    goldilocks_bzero(z2,sizeof(z2));
-    goldilocks_bzero(x3,sizeof(x3));
-    goldilocks_bzero(z3,sizeof(z3));
-    goldilocks_bzero(t1,sizeof(t1));
-    goldilocks_bzero(t2,sizeof(t2));
+    l->swap = swap;
+    SCRUB(t1,sizeof(t1));
+    SCRUB(t2,sizeof(t2));
+}
+
+static goldilocks_error_t
+x448_ladder_finish (
+    uint8_t out[X_PUBLIC_BYTES],
+    struct x448_ladder *l
+) {
+    mask_t nz;
+
+    gf_cond_swap(l->x2,l->x3,l->swap);
+    gf_cond_swap(l->z2,l->z3,l->swap);
+    gf_invert(l->z2,l->z2,0);
+    gf_mul(l->x1,l->x2,l->z2);
+    gf_serialize(out,l->x1);
+    nz = ~gf_eq(l->x1,ZERO);
+
+    SCRUB(l,sizeof(*l));
 
     return goldilocks_succeed_if(mask_to_bool(nz));
 }
 
+goldilocks_error_t goldilocks_x448 (
+    uint8_t out[X_PUBLIC_BYTES],
+    const uint8_t base[X_PUBLIC_BYTES],
+    const uint8_t scalar[X_PRIVATE_BYTES]
+) {
+    struct x448_ladder l;
+    x448_ladder_init(&l, base);
+    x448_ladder_steps(&l, scalar, 0, X_PRIVATE_BITS);
+    return x448_ladder_finish(out, &l);
+}
+
+/* Resumable scalarmul: the same steps as the one-shot versions, a few at a time. */
+enum scalarmul_kind {
+    SCALARMUL_POINT = 1,
+    SCALARMUL_PRECOMPUTED = 2,
+    SCALARMUL_X448 = 3
+};
+
+struct scalarmul_state_s {
+    union {
+        pniels_p multiples[WINDOW_NTABLE];
+        struct x448_ladder ladder;
+    } u;
+    point_p acc;
+    scalar_p scalar1x;
+    uint8_t x_scalar[X_PRIVATE_BYTES];
+    const precomputed_s *table;
+    unsigned int kind, done, total;
+} CACHE_ALIGNED;
+
+const size_t API_NS(sizeof_scalarmul_state) = sizeof(scalarmul_state_s);
+const size_t API_NS(alignof_scalarmul_state) = 64;
+
+void API_NS(point_scalarmul_start) (
+    scalarmul_state_s *state,
+    const point_p base,
+    const scalar_p scalar
+) {
+    state->kind = SCALARMUL_POINT;
+    state->done = 0;
+    state->total = WINDOW_COUNT;
+    window_scalar_prepare(state->scalar1x, scalar);
+    prepare_fixed_window(state->u.multiples, base, WINDOW_NTABLE);
+}
+
+void API_NS(precomputed_scalarmul_start) (
+    scalarmul_state_s *state,
+    const precomputed_s *table,
+    const scalar_p scalar
+) {
+    state->kind = SCALARMUL_PRECOMPUTED;
+    state->done = 0;
+    state->total = COMBS_S;
+    state->table = table;
+    precomputed_combs_prepare(state->scalar1x, scalar, COMBS_N, COMBS_T, COMBS_S);
+}
+
+void goldilocks_x448_start (
+    scalarmul_state_s *state,
+    const uint8_t base[X_PUBLIC_BYTES],
+    const uint8_t scalar[X_PRIVATE_BYTES]
+) {
+    state->kind = SCALARMUL_X448;
+    state->done = 0;
+    state->total = X_PRIVATE_BITS;
+    memcpy(state->x_scalar, scalar, sizeof(state->x_scalar));
+    x448_ladder_init(&state->u.ladder, base);
+}
+
+unsigned int API_NS(scalarmul_resume) (
+    scalarmul_state_s *state,
+    unsigned int max_steps
+) {
+    unsigned int from = state->done, to = state->total;
+    if (max_steps < to - from) to = from + max_steps;
+
+    switch (state->kind) {
+    case SCALARMUL_POINT:
+        point_scalarmul_windows(state->acc, (const pniels_p *)state->u.multiples,
+            state->scalar1x, from, to);
+        break;
+    case SCALARMUL_PRECOMPUTED:
+        precomputed_combs_columns(state->acc, state->table->table, COMBS_N, COMBS_T, COMBS_S,
+            state->scalar1x, from, to);
+        break;
+    case SCALARMUL_X448:
+        x448_ladder_steps(&state->u.ladder, state->x_scalar, from, to);
+        break;
+    default:
+        assert(0);
+    }
+
+    state->done = to;
+    return state->total - to;
+}
+
+void API_NS(point_scalarmul_finish) (
+    point_p out,
+    scalarmul_state_s *state
+) {
+    assert(state->kind == SCALARMUL_POINT || state->kind == SCALARMUL_PRECOMPUTED);
+    API_NS(scalarmul_resume)(state, state->total);
+    API_NS(point_copy)(out, state->acc);
+    SCRUB(state, sizeof(*state));
+}
+
+goldilocks_error_t goldilocks_x448_finish (
+    uint8_t out[X_PUBLIC_BYTES],
+    scalarmul_state_s *state
+) {
+    goldilocks_error_t ret;
+    assert(state->kind == SCALARMUL_X448);
+    API_NS(scalarmul_resume)(state, state->total);
+    ret = x448_ladder_finish(out, &state->u.ladder);
+    SCRUB(state, sizeof(*state));
+    return ret;
+}
+
 /* Thanks Johan Pascal */
 void goldilocks_ed448_convert_public_key_to_x448 (
     uint8_t x[GOLDILOCKS_X448_PUBLIC_BYTES],
@@ -1096,9 +2013,9 @@ void goldilocks_ed448_convert_public_key_to_x448 (
     gf_mul(n, y, d); /* y^2 * (1-dy^2) / (1-y^2) */
     gf_serialize(x,n);
 
-    goldilocks_bzero(y,sizeof(y));
-    goldilocks_bzero(n,sizeof(n));
-    goldilocks_bzero(d,sizeof(d));
+    SCRUB_PUBLIC(y,sizeof(y));
+    SCRUB_PUBLIC(n,sizeof(n));
+    SCRUB_PUBLIC(d,sizeof(d));
 }
 
 void API_NS(point_mul_by_ratio_and_encode_like_x448) (
@@ -1226,36 +2143,166 @@ prepare_wnaf_table(
     }
 
     API_NS(point_destroy)(tmp);
-    goldilocks_bzero(twop,sizeof(twop));
+    SCRUB_PUBLIC(twop,sizeof(twop));
+}
+
+/* Variable-time combination of several wNAF-recoded terms along one
+ * doubling chain.  Each term reads from either a fixed niels table or a
+ * per-call pniels table.
+ */
+struct smvt_term {
+    const struct smvt_control *control;
+    const niels_p *niels;
+    const pniels_p *pniels;
+};
+
+static void smvt_combine (
+    point_p combo,
+    struct smvt_term *terms,
+    unsigned int nterms
+) {
+    int i = -1, started = 0;
+    unsigned int t, pending;
+
+    for (t=0; t<nterms; t++) {
+        if (terms[t].control->power > i) i = terms[t].control->power;
+    }
+
+    if (i < 0) {
+        API_NS(point_copy)(combo, API_NS(point_identity));
+        return;
+    }
+
+    for (; i >= 0; i--) {
+        pending = 0;
+        for (t=0; t<nterms; t++) pending += (terms[t].control->power == i);
+
+        if (started) point_double_internal(combo,combo,i && !pending);
+
+        for (t=0; t<nterms && pending; t++) {
+            const struct smvt_control *c = terms[t].control;
+            int before_double;
+            if (c->power != i) continue;
+
+            assert(c->addend);
+            pending--;
+            before_double = i && !pending;
+
+            if (!started) {
+                /* recode_wnaf's leading digit is always positive */
+                assert(c->addend > 0);
+                if (terms[t].niels) niels_to_pt(combo, terms[t].niels[c->addend >> 1]);
+                else pniels_to_pt(combo, terms[t].pniels[c->addend >> 1]);
+                started = 1;
+            } else if (terms[t].niels) {
+                if (c->addend > 0) {
+                    add_niels_to_pt(combo, terms[t].niels[c->addend >> 1], before_double);
+                } else {
+                    sub_niels_from_pt(combo, terms[t].niels[(-c->addend) >> 1], before_double);
+                }
+            } else {
+                if (c->addend > 0) {
+                    add_pniels_to_pt(combo, terms[t].pniels[c->addend >> 1], before_double);
+                } else {
+                    sub_pniels_from_pt(combo, terms[t].pniels[(-c->addend) >> 1], before_double);
+                }
+            }
+            terms[t].control++;
+        }
+    }
+
+    for (t=0; t<nterms; t++) assert(terms[t].control->power == -1);
 }
 
+/* The split table holds odd multiples of 2^WNAF_SPLIT_BITS * base, so that
+ * the base scalar can be handled as two half-length halves.
+ */
+#define WNAF_SPLIT_BITS 224
+#define WNAF_TABLE_BITS_MAX 8
+
 extern const gf API_NS(precomputed_wnaf_as_fe)[];
 static const niels_p *API_NS(wnaf_base) = (const niels_p *)API_NS(precomputed_wnaf_as_fe);
-const size_t API_NS(sizeof_precomputed_wnafs) = sizeof(niels_p)<<GOLDILOCKS_WNAF_FIXED_TABLE_BITS;
+#if GOLDILOCKS_WNAF_FIXED_SPLIT
+extern const gf API_NS(precomputed_wnaf_split_as_fe)[];
+static const niels_p *API_NS(wnaf_split) = (const niels_p *)API_NS(precomputed_wnaf_split_as_fe);
+#endif
 
-void API_NS(precompute_wnafs) (
-    niels_p out[1<<GOLDILOCKS_WNAF_FIXED_TABLE_BITS],
-    const point_p base
+size_t API_NS(sizeof_precomputed_wnafs) (
+    unsigned int table_bits
+) {
+    if (table_bits < 1 || table_bits > WNAF_TABLE_BITS_MAX) return 0;
+    return sizeof(niels_p)<<table_bits;
+}
+
+void API_NS(precompute_wnaf_niels) (
+    niels_p *out,
+    const point_p base,
+    unsigned int tbits,
+    int split
 ) __attribute__ ((visibility ("hidden")));
 
-void API_NS(precompute_wnafs) (
-    niels_p out[1<<GOLDILOCKS_WNAF_FIXED_TABLE_BITS],
-    const point_p base
+void API_NS(precompute_wnaf_niels) (
+    niels_p *out,
+    const point_p base,
+    unsigned int tbits,
+    int split
 ) {
-    pniels_p tmp[1<<GOLDILOCKS_WNAF_FIXED_TABLE_BITS];
-    gf zs[1<<GOLDILOCKS_WNAF_FIXED_TABLE_BITS], zis[1<<GOLDILOCKS_WNAF_FIXED_TABLE_BITS];
-    int i;
-    prepare_wnaf_table(tmp,base,GOLDILOCKS_WNAF_FIXED_TABLE_BITS);
-    for (i=0; i<1<<GOLDILOCKS_WNAF_FIXED_TABLE_BITS; i++) {
-        memcpy(out[i], tmp[i]->n, sizeof(niels_p));
-        gf_copy(zs[i], tmp[i]->z);
+    /* Normalize in batches so that wide tables don't need a wide stack. */
+    const unsigned int batch = 32;
+    pniels_p tmp[32], twop;
+    gf zs[32], zis[32];
+    point_p working;
+    unsigned int i, j, n;
+
+    assert(tbits >= 1);
+    API_NS(point_copy)(working, base);
+    for (i=0; split && i<WNAF_SPLIT_BITS; i++) API_NS(point_double)(working, working);
+
+    pt_to_pniels(tmp[0], working);
+    API_NS(point_double)(working, working);
+    pt_to_pniels(twop, working);
+    pniels_to_pt(working, tmp[0]);
+
+    for (i=0; i < 1u<<tbits; i+=n) {
+        n = (1u<<tbits) - i;
+        if (n > batch) n = batch;
+        for (j=0; j<n; j++) {
+            if (i+j) add_pniels_to_pt(working, twop, 0);
+            pt_to_pniels(tmp[j], working);
+            memcpy(out[i+j], tmp[j]->n, sizeof(niels_p));
+            gf_copy(zs[j], tmp[j]->z);
+        }
+        batch_normalize_niels(&out[i], (const gf *)zs, zis, n);
     }
-    batch_normalize_niels(out, (const gf *)zs, zis, 1<<GOLDILOCKS_WNAF_FIXED_TABLE_BITS);
 
-    goldilocks_bzero(tmp,sizeof(tmp));
-    goldilocks_bzero(zs,sizeof(zs));
-    goldilocks_bzero(zis,sizeof(zis));
+    API_NS(point_destroy)(working);
+    SCRUB_PUBLIC(tmp,sizeof(tmp));
+    SCRUB_PUBLIC(twop,sizeof(twop));
+    SCRUB_PUBLIC(zs,sizeof(zs));
+    SCRUB_PUBLIC(zis,sizeof(zis));
+}
+
+#if GOLDILOCKS_WNAF_FIXED_SPLIT
+/* lo = scalar mod 2^WNAF_SPLIT_BITS, hi = scalar >> WNAF_SPLIT_BITS */
+static void scalar_split_wnaf (
+    scalar_p lo,
+    scalar_p hi,
+    const scalar_p scalar
+) {
+    const unsigned int w = WNAF_SPLIT_BITS / WBITS, b = WNAF_SPLIT_BITS % WBITS;
+    unsigned int i;
+    for (i=0; i<SCALAR_LIMBS; i++) {
+        goldilocks_word_t limb = 0;
+        if (i+w < SCALAR_LIMBS) limb = scalar->limb[i+w] >> b;
+        if (b && i+w+1 < SCALAR_LIMBS) limb |= scalar->limb[i+w+1] << (WBITS-b);
+        hi->limb[i] = limb;
+
+        if (i < w) lo->limb[i] = scalar->limb[i];
+        else if (i == w && b) lo->limb[i] = scalar->limb[i] & ((((goldilocks_word_t)1)<<b)-1);
+        else lo->limb[i] = 0;
+    }
 }
+#endif
 
 void API_NS(base_double_scalarmul_non_secret) (
     point_p combo,
@@ -1265,68 +2312,282 @@ void API_NS(base_double_scalarmul_non_secret) (
 ) {
     const int table_bits_var = GOLDILOCKS_WNAF_VAR_TABLE_BITS,
         table_bits_pre = GOLDILOCKS_WNAF_FIXED_TABLE_BITS;
-    int contp=0, contv=0, i;
     struct smvt_control control_var[SCALAR_BITS/(table_bits_var+1)+3];
     struct smvt_control control_pre[SCALAR_BITS/(table_bits_pre+1)+3];
-
-    int ncb_pre = recode_wnaf(control_pre, scalar1, table_bits_pre);
-    int ncb_var = recode_wnaf(control_var, scalar2, table_bits_var);
-
     pniels_p precmp_var[1<<table_bits_var];
+    struct smvt_term terms[3];
+    unsigned int nterms = 0;
+#if GOLDILOCKS_WNAF_FIXED_SPLIT
+    struct smvt_control control_split[SCALAR_BITS/(table_bits_pre+1)+3];
+    scalar_p lo, hi;
+
+    scalar_split_wnaf(lo, hi, scalar1);
+    recode_wnaf(control_pre, lo, table_bits_pre);
+    recode_wnaf(control_split, hi, table_bits_pre);
+    terms[nterms].control = control_split;
+    terms[nterms].niels = API_NS(wnaf_split);
+    terms[nterms++].pniels = NULL;
+#else
+    recode_wnaf(control_pre, scalar1, table_bits_pre);
+#endif
+    recode_wnaf(control_var, scalar2, table_bits_var);
+
+    /* Build the table before writing combo, in case it aliases base2. */
     prepare_wnaf_table(precmp_var, base2, table_bits_var);
 
-    i = control_var[0].power;
+    terms[nterms].control = control_var;
+    terms[nterms].niels = NULL;
+    terms[nterms++].pniels = (const pniels_p *)precmp_var;
+    terms[nterms].control = control_pre;
+    terms[nterms].niels = API_NS(wnaf_base);
+    terms[nterms++].pniels = NULL;
+
+    smvt_combine(combo, terms, nterms);
+
+    /* This function is non-secret; see SCRUB_PUBLIC. */
+    SCRUB_PUBLIC(control_var,sizeof(control_var));
+    SCRUB_PUBLIC(control_pre,sizeof(control_pre));
+    SCRUB_PUBLIC(precmp_var,sizeof(precmp_var));
+#if GOLDILOCKS_WNAF_FIXED_SPLIT
+    SCRUB_PUBLIC(control_split,sizeof(control_split));
+    SCRUB_PUBLIC(lo,sizeof(lo));
+    SCRUB_PUBLIC(hi,sizeof(hi));
+#endif
+}
 
-    if (i < 0) {
-        API_NS(point_copy)(combo, API_NS(point_identity));
-        return;
-    } else if (i > control_pre[0].power) {
-        pniels_to_pt(combo, precmp_var[control_var[0].addend >> 1]);
-        contv++;
-    } else if (i == control_pre[0].power && i >=0 ) {
-        pniels_to_pt(combo, precmp_var[control_var[0].addend >> 1]);
-        add_niels_to_pt(combo, API_NS(wnaf_base)[control_pre[0].addend >> 1], i);
-        contv++; contp++;
-    } else {
-        i = control_pre[0].power;
-        niels_to_pt(combo, API_NS(wnaf_base)[control_pre[0].addend >> 1]);
-        contp++;
+#if GOLDILOCKS_WNAF_FIXED_SPLIT
+/* Two's complement integers wide enough for q and the Euclid cofactors. */
+#define LATTICE_LIMBS (SCALAR_LIMBS+1)
+typedef goldilocks_word_t lattice_int[LATTICE_LIMBS];
+
+static unsigned int lattice_bitlen(const lattice_int x) {
+    int i;
+    for (i=LATTICE_LIMBS-1; i>=0; i--) {
+        if (x[i]) return i*WBITS + 64 - __builtin_clzll((unsigned long long)x[i]);
     }
+    return 0;
+}
 
-    for (i--; i >= 0; i--) {
-        int cv = (i==control_var[contv].power), cp = (i==control_pre[contp].power);
-        point_double_internal(combo,combo,i && !(cv||cp));
+/* x -= y << shift; return nonzero if the result is negative. */
+static int lattice_sub_shifted(lattice_int x, const lattice_int y, unsigned int shift) {
+    const unsigned int w = shift / WBITS, b = shift % WBITS;
+    goldilocks_dsword_t borrow = 0;
+    unsigned int i;
+    for (i=w; i<LATTICE_LIMBS; i++) {
+        goldilocks_word_t yi = y[i-w] << b;
+        if (b && i > w) yi |= y[i-w-1] >> (WBITS-b);
+        borrow += (goldilocks_dsword_t)x[i] - yi;
+        x[i] = (goldilocks_word_t)borrow;
+        borrow >>= WBITS;
+    }
+    return x[LATTICE_LIMBS-1] >> (WBITS-1);
+}
 
-        if (cv) {
-            assert(control_var[contv].addend);
+static int lattice_lt(const lattice_int x, const lattice_int y) {
+    int i;
+    for (i=LATTICE_LIMBS-1; i>=0; i--) {
+        if (x[i] != y[i]) return x[i] < y[i];
+    }
+    return 0;
+}
 
-            if (control_var[contv].addend > 0) {
-                add_pniels_to_pt(combo, precmp_var[control_var[contv].addend >> 1], i&&!cp);
-            } else {
-                sub_pniels_from_pt(combo, precmp_var[(-control_var[contv].addend) >> 1], i&&!cp);
-            }
-            contv++;
+/* Find c, d with d*k == c mod q and both about half the size of q, by
+ * running the extended Euclidean algorithm on (q, k) until the remainder
+ * drops below 2^(SCALAR_BITS/2+1).  Since r0*|t1| + r1*|t0| = q at every
+ * step, the cofactor d = t1 is then also below 2^(SCALAR_BITS/2+1).
+ * Quotients are taken one shifted subtraction at a time.
+ *
+ * Outputs c >= 0, |d| and the sign of d.
+ */
+static int lattice_reduce(
+    scalar_p c,
+    scalar_p d_abs,
+    const scalar_p k
+) {
+    const unsigned int half = SCALAR_BITS/2 + 1;
+    lattice_int r0, r1, t0, t1, tmp, *rp0 = &r0, *rp1 = &r1, *tp0 = &t0, *tp1 = &t1, *swap;
+    scalar_p qm1;
+    unsigned int i, shift;
+    int neg;
+
+    /* r0 = q, r1 = k, t0 = 0, t1 = 1 */
+    API_NS(scalar_sub)(qm1, API_NS(scalar_zero), API_NS(scalar_one));
+    memset(r0, 0, sizeof(r0));
+    memset(r1, 0, sizeof(r1));
+    memset(t0, 0, sizeof(t0));
+    memset(t1, 0, sizeof(t1));
+    for (i=0; i<SCALAR_LIMBS; i++) {
+        r0[i] = qm1->limb[i];
+        r1[i] = k->limb[i];
+    }
+    r0[0]++; /* q is odd, so this can't carry */
+    t1[0] = 1;
+
+    while (lattice_bitlen(*rp1) > half) {
+        shift = lattice_bitlen(*rp0) - lattice_bitlen(*rp1);
+        memcpy(tmp, *rp0, sizeof(tmp));
+        if (lattice_sub_shifted(tmp, *rp1, shift)) {
+            assert(shift > 0);
+            shift--;
+            memcpy(tmp, *rp0, sizeof(tmp));
+            lattice_sub_shifted(tmp, *rp1, shift);
         }
+        memcpy(*rp0, tmp, sizeof(tmp));
+        lattice_sub_shifted(*tp0, *tp1, shift);
 
-        if (cp) {
-            assert(control_pre[contp].addend);
-
-            if (control_pre[contp].addend > 0) {
-                add_niels_to_pt(combo, API_NS(wnaf_base)[control_pre[contp].addend >> 1], i);
-            } else {
-                sub_niels_from_pt(combo, API_NS(wnaf_base)[(-control_pre[contp].addend) >> 1], i);
-            }
-            contp++;
+        if (lattice_lt(*rp0, *rp1)) {
+            swap = rp0; rp0 = rp1; rp1 = swap;
+            swap = tp0; tp0 = tp1; tp1 = swap;
         }
     }
 
-    /* This function is non-secret, but whatever this is cheap. */
-    goldilocks_bzero(control_var,sizeof(control_var));
-    goldilocks_bzero(control_pre,sizeof(control_pre));
-    goldilocks_bzero(precmp_var,sizeof(precmp_var));
+    /* c = r1; d = t1 */
+    neg = (*tp1)[LATTICE_LIMBS-1] >> (WBITS-1);
+    if (neg) {
+        memset(tmp, 0, sizeof(tmp));
+        lattice_sub_shifted(tmp, *tp1, 0);
+        memcpy(*tp1, tmp, sizeof(tmp));
+    }
+    for (i=0; i<SCALAR_LIMBS; i++) {
+        c->limb[i] = (*rp1)[i];
+        d_abs->limb[i] = (*tp1)[i];
+    }
+    assert(lattice_bitlen(*tp1) <= half);
+    return neg;
+}
+#endif
+
+goldilocks_bool_t API_NS(base_double_scalarmul_non_secret_eq) (
+    const scalar_p scalar1,
+    const point_p base2,
+    const scalar_p scalar2,
+    const point_p expected
+) {
+#if GOLDILOCKS_WNAF_FIXED_SPLIT
+    /* With d*scalar2 == c, check
+     *     (d*scalar1)*B + c*base2 - d*expected == 0.
+     * Multiplying by d is a bijection on the prime-order group, so this is
+     * equivalent, and c, d and the halves of d*scalar1 are all half-size.
+     */
+    const int table_bits_var = GOLDILOCKS_WNAF_VAR_TABLE_BITS,
+        table_bits_pre = GOLDILOCKS_WNAF_FIXED_TABLE_BITS;
+    struct smvt_control control_c[SCALAR_BITS/(table_bits_var+1)+3];
+    struct smvt_control control_d[SCALAR_BITS/(table_bits_var+1)+3];
+    struct smvt_control control_lo[SCALAR_BITS/(table_bits_pre+1)+3];
+    struct smvt_control control_hi[SCALAR_BITS/(table_bits_pre+1)+3];
+    pniels_p precmp_c[1<<table_bits_var], precmp_d[1<<table_bits_var];
+    struct smvt_term terms[4];
+    scalar_p c, d, e, lo, hi;
+    point_p combo;
+    goldilocks_bool_t ret;
+    int d_neg;
+
+    d_neg = lattice_reduce(c, d, scalar2);
+    API_NS(scalar_mul)(e, scalar1, d);
+    if (d_neg) API_NS(scalar_sub)(e, API_NS(scalar_zero), e);
+    scalar_split_wnaf(lo, hi, e);
+
+    recode_wnaf(control_hi, hi, table_bits_pre);
+    recode_wnaf(control_lo, lo, table_bits_pre);
+    recode_wnaf(control_c, c, table_bits_var);
+    recode_wnaf(control_d, d, table_bits_var);
+
+    prepare_wnaf_table(precmp_c, base2, table_bits_var);
+    if (d_neg) {
+        prepare_wnaf_table(precmp_d, expected, table_bits_var);
+    } else {
+        API_NS(point_negate)(combo, expected);
+        prepare_wnaf_table(precmp_d, combo, table_bits_var);
+    }
+
+    terms[0].control = control_hi;
+    terms[0].niels = API_NS(wnaf_split);
+    terms[0].pniels = NULL;
+    terms[1].control = control_c;
+    terms[1].niels = NULL;
+    terms[1].pniels = (const pniels_p *)precmp_c;
+    terms[2].control = control_d;
+    terms[2].niels = NULL;
+    terms[2].pniels = (const pniels_p *)precmp_d;
+    terms[3].control = control_lo;
+    terms[3].niels = API_NS(wnaf_base);
+    terms[3].pniels = NULL;
+
+    smvt_combine(combo, terms, 4);
+    ret = API_NS(point_eq)(combo, API_NS(point_identity));
+
+    /* This function is non-secret; see SCRUB_PUBLIC. */
+    SCRUB_PUBLIC(control_c,sizeof(control_c));
+    SCRUB_PUBLIC(control_d,sizeof(control_d));
+    SCRUB_PUBLIC(control_lo,sizeof(control_lo));
+    SCRUB_PUBLIC(control_hi,sizeof(control_hi));
+    SCRUB_PUBLIC(precmp_c,sizeof(precmp_c));
+    SCRUB_PUBLIC(precmp_d,sizeof(precmp_d));
+    SCRUB_PUBLIC(c,sizeof(c));
+    SCRUB_PUBLIC(d,sizeof(d));
+    SCRUB_PUBLIC(e,sizeof(e));
+    SCRUB_PUBLIC(lo,sizeof(lo));
+    SCRUB_PUBLIC(hi,sizeof(hi));
+    SCRUB_PUBLIC(combo,sizeof(combo));
+    return ret;
+#else
+    point_p combo;
+    goldilocks_bool_t ret;
+    API_NS(base_double_scalarmul_non_secret)(combo, scalar1, base2, scalar2);
+    ret = API_NS(point_eq)(combo, expected);
+    API_NS(point_destroy)(combo);
+    return ret;
+#endif
+}
+
+void API_NS(point_scalarmul_non_secret) (
+    point_p scaled,
+    const point_p base,
+    const scalar_p scalar
+) {
+    const int table_bits = GOLDILOCKS_WNAF_SCALARMUL_TABLE_BITS;
+    struct smvt_control control[SCALAR_BITS/(table_bits+1)+3];
+    pniels_p precmp[1<<table_bits];
+    struct smvt_term term;
+
+    recode_wnaf(control, scalar, table_bits);
+
+    /* Build the table before writing scaled, in case it aliases base. */
+    prepare_wnaf_table(precmp, base, table_bits);
+
+    term.control = control;
+    term.niels = NULL;
+    term.pniels = (const pniels_p *)precmp;
+    smvt_combine(scaled, &term, 1);
+}
+
+goldilocks_error_t API_NS(precompute_wnafs) (
+    precomputed_wnafs_s *table,
+    unsigned int table_bits,
+    const point_p base
+) {
+    if (!API_NS(sizeof_precomputed_wnafs)(table_bits)) return GOLDILOCKS_FAILURE;
+    API_NS(precompute_wnaf_niels)((niels_p *)table, base, table_bits, 0);
+    return GOLDILOCKS_SUCCESS;
+}
+
+goldilocks_error_t API_NS(precomputed_wnafs_scalarmul_non_secret) (
+    point_p scaled,
+    const precomputed_wnafs_s *table,
+    unsigned int table_bits,
+    const scalar_p scalar
+) {
+    struct smvt_control control[SCALAR_BITS/2+3];
+    struct smvt_term term;
+
+    if (!API_NS(sizeof_precomputed_wnafs)(table_bits)) return GOLDILOCKS_FAILURE;
+    recode_wnaf(control, scalar, table_bits);
 
-    assert(contv == ncb_var); (void)ncb_var;
-    assert(contp == ncb_pre); (void)ncb_pre;
+    term.control = control;
+    term.niels = (const niels_p *)table;
+    term.pniels = NULL;
+    smvt_combine(scaled, &term, 1);
+    return GOLDILOCKS_SUCCESS;
 }
 
 void API_NS(point_destroy) (
@@ -1335,6 +2596,12 @@ void API_NS(point_destroy) (
     goldilocks_bzero(point, sizeof(point_p));
 }
 
+void API_NS(prepared_point_destroy) (
+    API_NS(prepared_point_p) prepared
+) {
+    goldilocks_bzero(prepared, sizeof(API_NS(prepared_point_p)));
+}
+
 void API_NS(precomputed_destroy) (
     precomputed_s *pre
 ) {
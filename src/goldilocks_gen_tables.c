@@ -18,6 +18,15 @@
 #include "goldilocks.h"
 #include "api.h"
 
+/* Comb geometries for which base tables are generated.  The library
+ * selects one with GOLDILOCKS_COMBS_N/T/S; see tuning.h.
+ */
+static const API_NS(comb_geometry_s) comb_geometries[] = {
+    { 5, 5, 18 }, /* 15 KiB, the default */
+    { 10, 5, 9 }, /* 30 KiB */
+    { 15, 5, 6 }  /* 45 KiB */
+};
+
 static const unsigned char base_point_ser_for_pregen[SER_BYTES] = {
     0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33
 };
@@ -28,12 +37,18 @@ const API_NS(point_p) API_NS(point_base);
 
 struct niels_s;
 const gf_s *API_NS(precomputed_wnaf_as_fe);
-extern const size_t API_NS(sizeof_precomputed_wnafs);
+const gf_s *API_NS(precomputed_wnaf_split_as_fe);
 
-void API_NS(precompute_wnafs) (
+void API_NS(precompute_wnaf_niels) (
     struct niels_s *out,
-    const API_NS(point_p) base
+    const API_NS(point_p) base,
+    unsigned int tbits,
+    int split
 );
+
+/* Fixed-base wNAF table widths which are generated; see tuning.h. */
+#define WNAF_TABLE_BITS_MIN 5
+#define WNAF_TABLE_BITS_MAX 8
 static void field_print(const gf f) {
     unsigned char ser[SER_BYTES];
     int b=0, i, comma=0;
@@ -56,6 +71,19 @@ static void field_print(const gf f) {
     assert(b<8);
 }
 
+static void fe_table_print(const char *name, const void *table, size_t size) {
+    const gf_s *output = (const gf_s *)table;
+    size_t i;
+    printf("const gf API_NS(%s)[%d]\n", name, (int)(size / sizeof(gf)));
+    printf("CACHE_ALIGNED __attribute__((visibility(\"hidden\"))) = {\n  ");
+
+    for (i=0; i < size; i+=sizeof(gf)) {
+        if (i) printf(",\n  ");
+        field_print(output++);
+    }
+    printf("\n};\n");
+}
+
 int main(int argc, char **argv) {
     API_NS(point_p) real_point_base;
     int ret;
@@ -63,6 +91,7 @@ int main(int argc, char **argv) {
     const gf_s *output;
     unsigned i;
     struct niels_s *pre_wnaf;
+    int split;
 
     (void)argc; (void)argv;
 
@@ -72,22 +101,9 @@ int main(int argc, char **argv) {
         return 1;
     }
 
-    ret = posix_memalign((void**)&pre, API_NS(alignof_precomputed_s), API_NS(sizeof_precomputed_s));
-    if (ret || !pre) {
-        fprintf(stderr, "Can't allocate space for precomputed table\n");
-        return 1;
-    }
-    API_NS(precompute)(pre, real_point_base);
-
-    ret = posix_memalign((void**)&pre_wnaf, API_NS(alignof_precomputed_s), API_NS(sizeof_precomputed_wnafs));
-    if (ret || !pre_wnaf) {
-        fprintf(stderr, "Can't allocate space for precomputed WNAF table\n");
-        return 1;
-    }
-    API_NS(precompute_wnafs)(pre_wnaf, real_point_base);
-
     printf("/** @warning: this file was automatically generated. */\n");
-    printf("#include \"field.h\"\n\n");
+    printf("#include \"field.h\"\n");
+    printf("#include \"tuning.h\"\n\n");
     printf("#include <goldilocks.h>\n\n");
     printf("#define API_NS(_id) goldilocks_448_##_id\n");
 
@@ -99,26 +115,45 @@ int main(int argc, char **argv) {
     }
     printf("\n}};\n");
 
-    output = (const gf_s *)pre;
-    printf("const gf API_NS(precomputed_base_as_fe)[%d]\n",
-        (int)(API_NS(sizeof_precomputed_s) / sizeof(gf)));
-    printf("VECTOR_ALIGNED __attribute__((visibility(\"hidden\"))) = {\n  ");
+    for (i=0; i<sizeof(comb_geometries)/sizeof(comb_geometries[0]); i++) {
+        const API_NS(comb_geometry_s) *geometry = &comb_geometries[i];
+        size_t size = API_NS(sizeof_precomputed_combs)(geometry);
 
-    for (i=0; i < API_NS(sizeof_precomputed_s); i+=sizeof(gf)) {
-        if (i) printf(",\n  ");
-        field_print(output++);
-    }
-    printf("\n};\n");
+        ret = posix_memalign((void**)&pre, API_NS(alignof_precomputed_s), size);
+        if (ret || !pre) {
+            fprintf(stderr, "Can't allocate space for precomputed table\n");
+            return 1;
+        }
+        if (API_NS(precompute_combs)(pre, geometry, real_point_base) != GOLDILOCKS_SUCCESS) {
+            fprintf(stderr, "Unsupported comb geometry %u,%u,%u\n", geometry->n, geometry->t, geometry->s);
+            return 1;
+        }
 
-    output = (const gf_s *)pre_wnaf;
-    printf("const gf API_NS(precomputed_wnaf_as_fe)[%d]\n",
-        (int)(API_NS(sizeof_precomputed_wnafs) / sizeof(gf)));
-    printf("VECTOR_ALIGNED __attribute__((visibility(\"hidden\"))) = {\n  ");
-    for (i=0; i < API_NS(sizeof_precomputed_wnafs); i+=sizeof(gf)) {
-        if (i) printf(",\n  ");
-        field_print(output++);
+        printf("\n#%s GOLDILOCKS_COMBS_N == %u && GOLDILOCKS_COMBS_T == %u && GOLDILOCKS_COMBS_S == %u\n",
+            i ? "elif" : "if", geometry->n, geometry->t, geometry->s);
+        fe_table_print("precomputed_base_as_fe", pre, size);
+        free(pre);
     }
-    printf("\n};\n");
+    printf("#else\n#error \"No generated base table for this GOLDILOCKS_COMBS_N/T/S\"\n#endif\n\n");
+
+    for (i=WNAF_TABLE_BITS_MIN; i<=WNAF_TABLE_BITS_MAX; i++) {
+        size_t size = API_NS(sizeof_precomputed_wnafs)(i);
+        printf("\n#%s GOLDILOCKS_WNAF_FIXED_TABLE_BITS == %u\n", i==WNAF_TABLE_BITS_MIN ? "if" : "elif", i);
+
+        for (split=0; split<2; split++) {
+            ret = posix_memalign((void**)&pre_wnaf, API_NS(alignof_precomputed_s), size);
+            if (ret || !pre_wnaf) {
+                fprintf(stderr, "Can't allocate space for precomputed WNAF table\n");
+                return 1;
+            }
+            API_NS(precompute_wnaf_niels)(pre_wnaf, real_point_base, i, split);
+            if (split) printf("#if GOLDILOCKS_WNAF_FIXED_SPLIT\n");
+            fe_table_print(split ? "precomputed_wnaf_split_as_fe" : "precomputed_wnaf_as_fe", pre_wnaf, size);
+            if (split) printf("#endif\n");
+            free(pre_wnaf);
+        }
+    }
+    printf("#else\n#error \"No generated wNAF table for this GOLDILOCKS_WNAF_FIXED_TABLE_BITS\"\n#endif\n");
 
     return 0;
 }
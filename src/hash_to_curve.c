@@ -0,0 +1,289 @@
+/**
+ * @file hash_to_curve.c
+ * @copyright
+ *   Copyright (c) 2018 the libgoldilocks contributors.  \n
+ *   Released under the MIT License.  See LICENSE.txt for license information.
+ *
+ * @brief Hashing to edwards448 as RFC 9380 specifies: the suites
+ * edwards448_XOF:SHAKE256_ELL2_RO_ and edwards448_XOF:SHAKE256_ELL2_NU_.
+ *
+ * Elligator 2 maps to curve448, and the 4-isogeny of RFC 7748 maps on to
+ * edwards448, following the straight-line versions of RFC 9380 appendix
+ * G.2.  The point is then moved to the twisted curve with the isogeny
+ * that EdDSA decoding uses.  Encoding it like EdDSA moves it back,
+ * multiplying by 4, which is the suites' cofactor clearing.
+ */
+#include <string.h>
+
+#include "word.h"
+#include "field.h"
+#include <goldilocks.h>
+#include <goldilocks/ed448.h>
+#include <goldilocks/shake.h>
+#include "api.h"
+
+/* Template stuff */
+#define point_p API_NS(point_p)
+#define point_s API_NS(point_s)
+static const int MONTGOMERY_J = 156326;
+/* End of template stuff */
+
+#define H2C_K 224                      /* security level */
+#define H2C_L ((448 + H2C_K + 7) / 8)  /* bytes per field element */
+#define H2C_MAX_DST 255
+#define H2C_BATCH 16
+
+static const char OVERSIZE_DST_PREFIX[] = "H2C-OVERSIZE-DST-";
+
+extern void API_NS(point_from_untwisted) (
+    point_p p
+);
+
+/* DST_prime of expand_message_xof: the DST, hashed if it is too long,
+ * followed by its length.  Returns the length of DST_prime.
+ */
+static size_t prepare_dst (
+    uint8_t dst_prime[H2C_MAX_DST+1],
+    const uint8_t *dst,
+    size_t dst_len
+) {
+    if (dst_len > H2C_MAX_DST) {
+        goldilocks_shake256_ctx_p ctx;
+        goldilocks_shake256_init(ctx);
+        goldilocks_shake256_update(ctx,(const uint8_t *)OVERSIZE_DST_PREFIX,sizeof(OVERSIZE_DST_PREFIX)-1);
+        goldilocks_shake256_update(ctx,dst,dst_len);
+        dst_len = 2*H2C_K/8;
+        goldilocks_shake256_final(ctx,dst_prime,dst_len);
+        goldilocks_shake256_destroy(ctx);
+    } else {
+        memcpy(dst_prime,dst,dst_len);
+    }
+    dst_prime[dst_len] = (uint8_t)dst_len;
+    return dst_len+1;
+}
+
+static void expand_message_xof (
+    uint8_t *out,
+    size_t out_len,
+    const uint8_t *msg,
+    size_t msg_len,
+    const uint8_t *dst_prime,
+    size_t dst_prime_len
+) {
+    goldilocks_shake256_ctx_p ctx;
+    uint8_t len[2];
+    len[0] = (uint8_t)(out_len >> 8);
+    len[1] = (uint8_t)out_len;
+
+    goldilocks_shake256_init(ctx);
+    if (msg_len) goldilocks_shake256_update(ctx,msg,msg_len);
+    goldilocks_shake256_update(ctx,len,sizeof(len));
+    goldilocks_shake256_update(ctx,dst_prime,dst_prime_len);
+    goldilocks_shake256_final(ctx,out,out_len);
+    goldilocks_shake256_destroy(ctx);
+}
+
+/* Reduce H2C_L big-endian bytes mod p.  Writing them as hi*2^448 + lo,
+ * 2^448 = 2^224 + 1 mod p, so this is lo + hi + hi*2^224.
+ */
+static void field_from_bytes (
+    gf x,
+    const uint8_t in[H2C_L]
+) {
+    uint8_t buf[SER_BYTES];
+    gf a;
+    unsigned int i;
+    const unsigned int hi_bytes = H2C_L - SER_BYTES;
+
+    for (i=0; i<SER_BYTES; i++) buf[i] = in[H2C_L-1-i];
+    ignore_result(gf_deserialize(x,buf,0));
+
+    memset(buf,0,sizeof(buf));
+    for (i=0; i<hi_bytes; i++) buf[i] = in[hi_bytes-1-i];
+    ignore_result(gf_deserialize(a,buf,0));
+    gf_add(x,x,a);
+
+    memset(buf,0,sizeof(buf));
+    for (i=0; i<hi_bytes; i++) buf[SER_BYTES-hi_bytes+i] = in[hi_bytes-1-i];
+    ignore_result(gf_deserialize(a,buf,0));
+    gf_add(x,x,a);
+
+    SCRUB(buf,sizeof(buf));
+    SCRUB(a,sizeof(a));
+}
+
+/* map_to_curve_elligator2_edwards448: Elligator 2 to curve448, and then
+ * the 4-isogeny to edwards448.  Writes projective coordinates on
+ * edwards448 to p->x, p->y and p->z.
+ */
+static void map_to_untwisted (
+    point_p p,
+    const gf u
+) {
+    gf tv1, tv2, tv3, tv4, xd, gxd, gx1, y1, y2, xn, yn;
+    gf xn2, xd2, xd4, yn2, xen, xed, yen, yed;
+    mask_t e1, e2, e3;
+
+    /* Elligator 2 to curve448, with Z = -1.  x1n = -J, and yd = 1. */
+    gf_sqr(tv1,u);
+    e1 = gf_eq(tv1,ONE);
+    gf_cond_sel(tv1,tv1,ZERO,e1);   /* If Z * u^2 == -1, set tv1 = 0 */
+    gf_sub(xd,ONE,tv1);
+    gf_sqr(tv2,xd);
+    gf_mul(gxd,tv2,xd);             /* xd^3 */
+    gf_mulw(tv3,tv1,-MONTGOMERY_J); /* x1n + J * xd */
+    gf_mulw(tv4,tv3,-MONTGOMERY_J);
+    gf_add(tv4,tv4,tv2);
+    gf_mulw(gx1,tv4,-MONTGOMERY_J); /* x1n^3 + J * x1n^2 * xd + x1n * xd^2 */
+    gf_sqr(tv3,gxd);
+    gf_mul(tv2,gx1,gxd);
+    gf_mul(tv4,tv3,tv2);            /* gx1 * gxd^3 */
+    ignore_result(gf_isr(tv3,tv4)); /* (gx1 * gxd^3)^((p - 3) / 4) */
+    gf_mul(y1,tv3,tv2);
+    gf_mulw(xn,tv1,MONTGOMERY_J);   /* x2n = -tv1 * x1n */
+    gf_mul(y2,y1,u);
+    gf_cond_sel(y2,y2,ZERO,e1);
+    gf_sqr(tv2,y1);
+    gf_mul(tv3,tv2,gxd);
+    e2 = gf_eq(tv3,gx1);
+    gf_mulw(tv1,ONE,-MONTGOMERY_J);
+    gf_cond_sel(xn,xn,tv1,e2);
+    gf_cond_sel(yn,y2,y1,e2);
+    e3 = gf_lobit(yn);
+    gf_cond_neg(yn,e2^e3);
+
+    /* The 4-isogeny to edwards448 */
+    gf_sqr(xn2,xn);
+    gf_sqr(xd2,xd);
+    gf_sqr(xd4,xd2);
+    gf_sqr(yn2,yn);
+    gf_sub(tv1,xn2,xd2);
+    gf_sub(tv2,tv1,xd2);
+    gf_mul(tv3,tv1,xd2);
+    gf_mul(tv1,tv3,yn);
+    gf_mulw(xen,tv1,4);
+    gf_mul(tv1,tv2,xn2);            /* tv2 */
+    gf_mulw(tv3,yn2,4);
+    gf_add(tv2,tv3,ONE);
+    gf_mul(xed,tv2,xd4);
+    gf_add(xed,xed,tv1);
+    gf_mul(tv2,tv1,xn);             /* tv2 * xn */
+    gf_mul(tv4,xn,xd4);
+    gf_sub(tv1,tv3,ONE);
+    gf_mul(yen,tv1,tv4);
+    gf_sub(yen,yen,tv2);
+    gf_add(tv1,xn2,xd2);
+    gf_mul(tv3,tv1,xd2);
+    gf_mul(tv1,tv3,xd);
+    gf_mul(tv3,tv1,yn2);
+    gf_mulw(tv1,tv3,-2);
+    gf_add(yed,tv2,tv1);
+    gf_add(yed,yed,tv4);
+
+    /* Exceptional case: the identity */
+    gf_mul(tv1,xed,yed);
+    e1 = gf_eq(tv1,ZERO);
+    gf_cond_sel(xen,xen,ZERO,e1);
+    gf_cond_sel(xed,xed,ONE,e1);
+    gf_cond_sel(yen,yen,ONE,e1);
+    gf_cond_sel(yed,yed,ONE,e1);
+
+    gf_mul(p->x,xen,yed);
+    gf_mul(p->y,yen,xed);
+    gf_mul(p->z,xed,yed);
+
+    SCRUB(tv1,sizeof(tv1)); SCRUB(tv2,sizeof(tv2));
+    SCRUB(tv3,sizeof(tv3)); SCRUB(tv4,sizeof(tv4));
+    SCRUB(xd,sizeof(xd));   SCRUB(gxd,sizeof(gxd));
+    SCRUB(gx1,sizeof(gx1)); SCRUB(y1,sizeof(y1));
+    SCRUB(y2,sizeof(y2));   SCRUB(xn,sizeof(xn));
+    SCRUB(yn,sizeof(yn));   SCRUB(xn2,sizeof(xn2));
+    SCRUB(xd2,sizeof(xd2)); SCRUB(xd4,sizeof(xd4));
+    SCRUB(yn2,sizeof(yn2)); SCRUB(xen,sizeof(xen));
+    SCRUB(xed,sizeof(xed)); SCRUB(yen,sizeof(yen));
+    SCRUB(yed,sizeof(yed));
+}
+
+static void hash_to_point (
+    point_p p,
+    const uint8_t *msg,
+    size_t msg_len,
+    const uint8_t *dst_prime,
+    size_t dst_prime_len,
+    uint8_t random_oracle
+) {
+    uint8_t uniform[2*H2C_L];
+    size_t count = random_oracle ? 2 : 1;
+    point_p q;
+    gf u;
+
+    expand_message_xof(uniform,count*H2C_L,msg,msg_len,dst_prime,dst_prime_len);
+    field_from_bytes(u,uniform);
+    map_to_untwisted(p,u);
+    API_NS(point_from_untwisted)(p);
+    if (random_oracle) {
+        field_from_bytes(u,&uniform[H2C_L]);
+        map_to_untwisted(q,u);
+        API_NS(point_from_untwisted)(q);
+        API_NS(point_add)(p,p,q);
+    }
+
+    SCRUB(uniform,sizeof(uniform));
+    SCRUB(q,sizeof(q));
+    SCRUB(u,sizeof(u));
+}
+
+void goldilocks_ed448_hash_to_curve (
+    goldilocks_448_point_p p,
+    const uint8_t *msg,
+    size_t msg_len,
+    const uint8_t *dst,
+    size_t dst_len
+) {
+    uint8_t dst_prime[H2C_MAX_DST+1];
+    size_t dst_prime_len = prepare_dst(dst_prime,dst,dst_len);
+    hash_to_point(p,msg,msg_len,dst_prime,dst_prime_len,1);
+}
+
+void goldilocks_ed448_encode_to_curve (
+    goldilocks_448_point_p p,
+    const uint8_t *msg,
+    size_t msg_len,
+    const uint8_t *dst,
+    size_t dst_len
+) {
+    uint8_t dst_prime[H2C_MAX_DST+1];
+    size_t dst_prime_len = prepare_dst(dst_prime,dst,dst_len);
+    hash_to_point(p,msg,msg_len,dst_prime,dst_prime_len,0);
+}
+
+void goldilocks_ed448_hash_to_curve_batch (
+    uint8_t *encoded,
+    goldilocks_448_point_s *points,
+    const uint8_t *const *msgs,
+    const size_t *msg_lens,
+    size_t n,
+    const uint8_t *dst,
+    size_t dst_len,
+    uint8_t random_oracle
+) {
+    uint8_t dst_prime[H2C_MAX_DST+1];
+    size_t dst_prime_len = prepare_dst(dst_prime,dst,dst_len);
+    point_s chunk[H2C_BATCH], *out;
+    size_t i, j, m;
+
+    for (i=0; i<n; i+=m) {
+        m = n-i;
+        if (m > H2C_BATCH) m = H2C_BATCH;
+        out = points ? &points[i] : chunk;
+        for (j=0; j<m; j++) {
+            hash_to_point(&out[j],msgs[i+j],msg_lens[i+j],dst_prime,dst_prime_len,random_oracle);
+        }
+        if (encoded) {
+            API_NS(point_mul_by_ratio_and_encode_like_eddsa_batch)(
+                &encoded[i*GOLDILOCKS_EDDSA_448_PUBLIC_BYTES],out,m);
+        }
+    }
+
+    SCRUB(chunk,sizeof(chunk));
+}
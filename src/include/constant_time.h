@@ -123,6 +123,91 @@ constant_time_cond_swap (
     }
 }
 
+/*
+ * Lookup kernels for AVX2 and AVX-512, for elements which are a whole
+ * number of vectors long (niels and pniels are 3 and 4 field elements).
+ * The whole element is accumulated in registers, instead of being or'd
+ * into memory once per table entry, and each entry's mask comes from one
+ * vector compare.  Entries are independent apart from the final or, so
+ * the loads of successive entries overlap.
+ *
+ * Each table row is forced into a register before it is masked, so that
+ * the compiler can't fold the mask into a masked load, which might skip
+ * the memory access for entries that aren't selected.
+ */
+#if defined(__AVX512F__)
+    #define CT_LOOKUP_VECTOR_BYTES 64
+    typedef __m512i ct_lookup_vector_t;
+#elif defined(__AVX2__)
+    #define CT_LOOKUP_VECTOR_BYTES 32
+    typedef __m256i ct_lookup_vector_t;
+#endif
+
+#ifdef CT_LOOKUP_VECTOR_BYTES
+#define CT_LOOKUP_MAX_VECTORS (256 / CT_LOOKUP_VECTOR_BYTES)
+
+/* The accumulators only stay in registers if the inner loop is unrolled,
+ * which -Os won't do by itself.
+ */
+#if defined(__clang__)
+    #define CT_LOOKUP_UNROLL _Pragma("unroll")
+#elif defined(__GNUC__) && __GNUC__ >= 8
+    #define CT_LOOKUP_UNROLL _Pragma("GCC unroll 8")
+#else
+    #define CT_LOOKUP_UNROLL
+#endif
+
+static __inline__ void
+__attribute__((unused,always_inline))
+constant_time_lookup_vector (
+    void *__restrict__ out_,
+    const void *table_,
+    word_t elem_bytes,
+    word_t n_table,
+    word_t idx
+) {
+    unsigned char *out = (unsigned char *)out_;
+    const unsigned char *table = (const unsigned char *)table_;
+    const word_t nvec = elem_bytes / CT_LOOKUP_VECTOR_BYTES;
+    ct_lookup_vector_t acc[CT_LOOKUP_MAX_VECTORS], row, mask;
+    word_t j,k;
+
+#if defined(__AVX512F__)
+    const __m512i vidx = _mm512_set1_epi32((int)idx);
+    __m512i ones = _mm512_set1_epi32(-1);
+    __asm__ ("" : "+v"(ones)); /* nor a masked load of the constant */
+    for (k=0; k<nvec; k++) acc[k] = _mm512_setzero_si512();
+    for (j=0; j<n_table; j++) {
+        mask = _mm512_maskz_mov_epi32(_mm512_cmpeq_epi32_mask(_mm512_set1_epi32((int)j), vidx), ones);
+        CT_LOOKUP_UNROLL
+        for (k=0; k<nvec; k++) {
+            row = _mm512_loadu_si512((const void *)&table[j*elem_bytes + k*CT_LOOKUP_VECTOR_BYTES]);
+            __asm__ ("" : "+v"(row));
+            acc[k] = _mm512_ternarylogic_epi32(acc[k], mask, row, 0xF8); /* acc | (mask & row) */
+        }
+    }
+    for (k=0; k<nvec; k++) {
+        _mm512_storeu_si512((void *)&out[k*CT_LOOKUP_VECTOR_BYTES], acc[k]);
+    }
+#else
+    const __m256i vidx = _mm256_set1_epi32((int)idx);
+    for (k=0; k<nvec; k++) acc[k] = _mm256_setzero_si256();
+    for (j=0; j<n_table; j++) {
+        mask = _mm256_cmpeq_epi32(_mm256_set1_epi32((int)j), vidx);
+        CT_LOOKUP_UNROLL
+        for (k=0; k<nvec; k++) {
+            row = _mm256_loadu_si256((const __m256i *)&table[j*elem_bytes + k*CT_LOOKUP_VECTOR_BYTES]);
+            __asm__ ("" : "+v"(row));
+            acc[k] = _mm256_or_si256(acc[k], _mm256_and_si256(mask, row));
+        }
+    }
+    for (k=0; k<nvec; k++) {
+        _mm256_storeu_si256((__m256i *)&out[k*CT_LOOKUP_VECTOR_BYTES], acc[k]);
+    }
+#endif
+}
+#endif /* CT_LOOKUP_VECTOR_BYTES */
+
 /**
  * @brief Constant-time equivalent of memcpy(out, table + elem_bytes*idx, elem_bytes);
  *
@@ -133,7 +218,7 @@ constant_time_cond_swap (
  */
 static __inline__ void
 __attribute__((unused,always_inline))
-constant_time_lookup (
+constant_time_lookup_generic (
     void *__restrict__ out_,
     const void *table_,
     word_t elem_bytes,
@@ -182,6 +267,31 @@ constant_time_lookup (
     }
 }
 
+/**
+ * @brief Constant-time equivalent of memcpy(out, table + elem_bytes*idx, elem_bytes);
+ *
+ * Uses a vector kernel when one is available for elem_bytes, and
+ * constant_time_lookup_generic otherwise.  The same requirements apply.
+ */
+static __inline__ void
+__attribute__((unused,always_inline))
+constant_time_lookup (
+    void *__restrict__ out_,
+    const void *table_,
+    word_t elem_bytes,
+    word_t n_table,
+    word_t idx
+) {
+#ifdef CT_LOOKUP_VECTOR_BYTES
+    if (elem_bytes % CT_LOOKUP_VECTOR_BYTES == 0
+        && elem_bytes <= CT_LOOKUP_MAX_VECTORS * CT_LOOKUP_VECTOR_BYTES) {
+        constant_time_lookup_vector(out_, table_, elem_bytes, n_table, idx);
+        return;
+    }
+#endif
+    constant_time_lookup_generic(out_, table_, elem_bytes, n_table, idx);
+}
+
 /**
  * @brief Constant-time equivalent of memcpy(table + elem_bytes*idx, in, elem_bytes);
  *
@@ -0,0 +1,81 @@
+/**
+ * @file tuning.h
+ * @copyright
+ *   Copyright (c) 2018 the libgoldilocks contributors.  \n
+ *   Released under the MIT License.  See LICENSE.txt for license information.
+ *
+ * @brief Build-time parameters for the scalar multiplication algorithms.
+ *
+ * Each of these may be overridden on the compiler command line, e.g.
+ * XCFLAGS="-DGOLDILOCKS_COMBS_N=10 -DGOLDILOCKS_COMBS_S=9".  "make -f
+ * Makefile.custom tune" measures them on the build host, and writes the
+ * best ones to src/GEN/tuning_host.h, which later builds include first.
+ */
+
+#ifndef __TUNING_H__
+#define __TUNING_H__ 1
+
+/* Comb geometry of the fixed-base tables: n combs of t teeth, spaced s
+ * apart.  The generated base table must exist for the chosen geometry;
+ * see goldilocks_gen_tables.c for the ones which are emitted.
+ */
+#ifndef GOLDILOCKS_COMBS_N
+#define GOLDILOCKS_COMBS_N 5
+#endif
+#ifndef GOLDILOCKS_COMBS_T
+#define GOLDILOCKS_COMBS_T 5
+#endif
+#ifndef GOLDILOCKS_COMBS_S
+#define GOLDILOCKS_COMBS_S 18
+#endif
+
+/* Signed window width for constant-time variable-base scalarmul. */
+#ifndef GOLDILOCKS_WINDOW_BITS
+#define GOLDILOCKS_WINDOW_BITS 5
+#endif
+
+/* wNAF table sizes for the variable-time algorithms.  The fixed-base
+ * table holds 2^bits entries of 168 bytes; tables are generated for
+ * 5 to 8 bits (5 KiB to 42 KiB).
+ */
+#ifndef GOLDILOCKS_WNAF_FIXED_TABLE_BITS
+#define GOLDILOCKS_WNAF_FIXED_TABLE_BITS 5
+#endif
+/* Also keep a fixed-base table of multiples of 2^224 times the base, so
+ * that the base half of base_double_scalarmul_non_secret needs only half
+ * as many doublings.  EdDSA verify needs it for its half-size check, which
+ * is about a quarter faster than the full-width one.  It doubles the
+ * fixed-base wNAF memory (5 KiB more at 5 bits).  Set it to 0 to do
+ * without; "make -f Makefile.custom test-configs" tests that too.
+ */
+#ifndef GOLDILOCKS_WNAF_FIXED_SPLIT
+#define GOLDILOCKS_WNAF_FIXED_SPLIT 1
+#endif
+#ifndef GOLDILOCKS_WNAF_VAR_TABLE_BITS
+#define GOLDILOCKS_WNAF_VAR_TABLE_BITS 3
+#endif
+#ifndef GOLDILOCKS_WNAF_SCALARMUL_TABLE_BITS
+#define GOLDILOCKS_WNAF_SCALARMUL_TABLE_BITS 4
+#endif
+
+/* Signed window width and batch size for constant-time multiscalarmul. */
+#ifndef GOLDILOCKS_MULTISCALARMUL_WINDOW_BITS
+#define GOLDILOCKS_MULTISCALARMUL_WINDOW_BITS 4
+#endif
+#ifndef GOLDILOCKS_MULTISCALARMUL_BATCH
+#define GOLDILOCKS_MULTISCALARMUL_BATCH 16
+#endif
+
+/* goldilocks_448_point_sum splits its input among up to this many
+ * threads, each of which sums at least POINT_SUM_THREAD_MIN points.  Set
+ * the thread count to 1 to sum on the calling thread only.  The library
+ * still needs pthreads for the thread-local RNG and the secure arena.
+ */
+#ifndef GOLDILOCKS_POINT_SUM_THREADS
+#define GOLDILOCKS_POINT_SUM_THREADS 8
+#endif
+#ifndef GOLDILOCKS_POINT_SUM_THREAD_MIN
+#define GOLDILOCKS_POINT_SUM_THREAD_MIN 512
+#endif
+
+#endif /* __TUNING_H__ */
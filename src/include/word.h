@@ -152,6 +152,12 @@ extern int posix_memalign(void **, size_t, size_t);
     }
 #endif
 
+/* Tables scanned by constant_time_lookup start on a cache line.  Their
+ * entries are whole cache lines long, so each scan touches as few lines
+ * as possible.
+ */
+#define CACHE_ALIGNED __attribute__((aligned(64)))
+
 typedef struct {
     uint64xn_t unaligned;
 } __attribute__((packed)) unaligned_uint64xn_s;
@@ -203,15 +209,36 @@ typedef struct {
         memset_s(p, s, c, s);
     }
 #else
-    /* PERF: use words? */
+    /* A plain memset, which the compiler can inline as a few vector stores.
+     * The empty asm claims to read the memory, so the stores can't be
+     * dropped as dead.
+     */
     static GOLDILOCKS_INLINE void
     really_memset(void *p, char c, size_t s) {
-        volatile char *pv = (volatile char *)p;
-        size_t i;
-        for (i=0; i<s; i++) pv[i] = c;
+        memset(p, c, s);
+        __asm__ __volatile__("" : : "r"(p) : "memory");
     }
 #endif
 
+/* Scrubbing policy for stack temporaries.
+ *
+ * Secret temporaries are scrubbed with SCRUB as they go out of use.
+ * Functions which only ever handle public data (verification, for
+ * instance) scrub with SCRUB_PUBLIC, which does nothing unless
+ * GOLDILOCKS_SCRUB_PUBLIC=1.
+ */
+#ifndef GOLDILOCKS_SCRUB_PUBLIC
+#define GOLDILOCKS_SCRUB_PUBLIC 0
+#endif
+
+#define SCRUB(p,s) really_memset(p,0,s)
+
+#if GOLDILOCKS_SCRUB_PUBLIC
+    #define SCRUB_PUBLIC(p,s) SCRUB(p,s)
+#else
+    #define SCRUB_PUBLIC(p,s) ((void)(p))
+#endif
+
 /**
  * Allocate memory which is sufficiently aligned to be used for the
  * largest vector on the system (for now that's a big_register_t).
@@ -0,0 +1,248 @@
+/**
+ * @file precomputed_file.c
+ * @copyright
+ *   Copyright (c) 2018 the libgoldilocks contributors.  \n
+ *   Released under the MIT License.  See LICENSE.txt for license information.
+ *
+ * @brief Saving precomputed tables to files, and mapping them back.
+ *
+ * A table file is a fixed-size header followed by the table exactly as it
+ * is laid out in memory.  The table starts TABLE_FILE_HEADER_BYTES into
+ * the file, so that it is suitably aligned when the file is mapped.
+ */
+#define _XOPEN_SOURCE 600 /* for mmap and friends */
+#include <string.h>
+#include <stdint.h>
+
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <errno.h>
+
+#include "word.h"
+#include "field.h"
+#include <goldilocks.h>
+#include <goldilocks/shake.h>
+#include "api.h"
+
+#define TABLE_FILE_VERSION 1
+#define TABLE_FILE_HEADER_BYTES 128
+#define TABLE_FILE_DIGEST_BYTES 32
+
+static const char TABLE_FILE_MAGIC[8] = {'G','L','D','K','T','A','B','L'};
+
+enum table_kind {
+    TABLE_KIND_COMBS = 1,
+    TABLE_KIND_WNAFS = 2
+};
+
+/* All fields are in native byte order; byte_order catches a mismatch. */
+struct table_file_header {
+    char magic[8];
+    uint32_t version;
+    uint32_t byte_order;  /* 0x01020304 */
+    uint32_t word_bits;   /* GOLDILOCKS_WORD_BITS */
+    uint32_t limb_bits;   /* LIMB_PLACE_VALUE(0) of the field implementation */
+    uint32_t gf_bytes;    /* sizeof(gf) */
+    uint32_t kind;        /* enum table_kind */
+    uint32_t params[3];   /* n, t, s for combs; table_bits for wNAFs */
+    uint32_t reserved;
+    uint64_t table_bytes;
+    uint8_t digest[TABLE_FILE_DIGEST_BYTES]; /* SHAKE256 of the table */
+};
+
+typedef char table_file_header_fits[
+    (sizeof(struct table_file_header) <= TABLE_FILE_HEADER_BYTES) ? 1 : -1];
+
+static void table_file_header_init (
+    struct table_file_header *header,
+    enum table_kind kind,
+    const uint32_t params[3],
+    const void *table,
+    size_t table_bytes
+) {
+    memset(header, 0, sizeof(*header));
+    memcpy(header->magic, TABLE_FILE_MAGIC, sizeof(TABLE_FILE_MAGIC));
+    header->version = TABLE_FILE_VERSION;
+    header->byte_order = 0x01020304;
+    header->word_bits = GOLDILOCKS_WORD_BITS;
+    header->limb_bits = LIMB_PLACE_VALUE(0);
+    header->gf_bytes = sizeof(gf);
+    header->kind = kind;
+    memcpy(header->params, params, sizeof(header->params));
+    header->table_bytes = table_bytes;
+    if (table) {
+        goldilocks_shake256_hash(header->digest, sizeof(header->digest),
+            (const uint8_t *)table, table_bytes);
+    }
+}
+
+static goldilocks_error_t write_fully(int fd, const void *data, size_t len) {
+    const uint8_t *p = (const uint8_t *)data;
+    while (len) {
+        ssize_t ret = write(fd, p, len);
+        if (ret < 0 && errno == EINTR) continue;
+        if (ret <= 0) return GOLDILOCKS_FAILURE;
+        p += ret;
+        len -= ret;
+    }
+    return GOLDILOCKS_SUCCESS;
+}
+
+static goldilocks_error_t table_file_save (
+    const char *path,
+    enum table_kind kind,
+    const uint32_t params[3],
+    const void *table,
+    size_t table_bytes
+) {
+    uint8_t header[TABLE_FILE_HEADER_BYTES];
+    goldilocks_error_t ret;
+    int fd;
+
+    memset(header, 0, sizeof(header));
+    table_file_header_init((struct table_file_header *)header, kind, params, table, table_bytes);
+
+    fd = open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) return GOLDILOCKS_FAILURE;
+
+    ret = write_fully(fd, header, sizeof(header));
+    if (ret == GOLDILOCKS_SUCCESS) ret = write_fully(fd, table, table_bytes);
+    if (close(fd) != 0) ret = GOLDILOCKS_FAILURE;
+    return ret;
+}
+
+/* Map a table file and check its header against this build.  The caller
+ * checks that params describe a table of header->table_bytes bytes.
+ */
+static goldilocks_error_t table_file_map (
+    const uint8_t **table,
+    uint32_t params[3],
+    const char *path,
+    enum table_kind kind
+) {
+    struct table_file_header expected, header;
+    uint8_t digest[TABLE_FILE_DIGEST_BYTES];
+    const uint8_t *map;
+    struct stat st;
+    size_t table_bytes;
+    int fd;
+
+    fd = open(path, O_RDONLY);
+    if (fd < 0) return GOLDILOCKS_FAILURE;
+    if (fstat(fd, &st) != 0 || st.st_size < TABLE_FILE_HEADER_BYTES) {
+        close(fd);
+        return GOLDILOCKS_FAILURE;
+    }
+
+    map = (const uint8_t *)mmap(NULL, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (map == (const uint8_t *)MAP_FAILED) return GOLDILOCKS_FAILURE;
+
+    memcpy(&header, map, sizeof(header));
+    table_bytes = st.st_size - TABLE_FILE_HEADER_BYTES;
+    table_file_header_init(&expected, kind, header.params, NULL, table_bytes);
+    memcpy(expected.digest, header.digest, sizeof(expected.digest));
+
+    if (memcmp(&header, &expected, sizeof(header)) != 0) goto fail;
+
+    goldilocks_shake256_hash(digest, sizeof(digest), map + TABLE_FILE_HEADER_BYTES, table_bytes);
+    if (memcmp(digest, header.digest, sizeof(digest)) != 0) goto fail;
+
+    memcpy(params, header.params, sizeof(header.params));
+    *table = map + TABLE_FILE_HEADER_BYTES;
+    return GOLDILOCKS_SUCCESS;
+
+fail:
+    munmap((void *)map, st.st_size);
+    return GOLDILOCKS_FAILURE;
+}
+
+goldilocks_error_t API_NS(precomputed_save) (
+    const char *path,
+    const API_NS(precomputed_s) *table,
+    const API_NS(comb_geometry_s) *geometry
+) {
+    uint32_t params[3];
+    size_t size = API_NS(sizeof_precomputed_combs)(geometry);
+    if (!size) return GOLDILOCKS_FAILURE;
+
+    params[0] = geometry->n;
+    params[1] = geometry->t;
+    params[2] = geometry->s;
+    return table_file_save(path, TABLE_KIND_COMBS, params, table, size);
+}
+
+goldilocks_error_t API_NS(precomputed_map) (
+    const API_NS(precomputed_s) **table,
+    API_NS(comb_geometry_s) *geometry,
+    const char *path
+) {
+    uint32_t params[3];
+    const uint8_t *map;
+    API_NS(comb_geometry_s) g;
+
+    if (table_file_map(&map, params, path, TABLE_KIND_COMBS) != GOLDILOCKS_SUCCESS) {
+        return GOLDILOCKS_FAILURE;
+    }
+
+    g.n = params[0];
+    g.t = params[1];
+    g.s = params[2];
+    if (API_NS(sizeof_precomputed_combs)(&g) != ((const struct table_file_header *)
+            (map - TABLE_FILE_HEADER_BYTES))->table_bytes) {
+        API_NS(precomputed_unmap)(map);
+        return GOLDILOCKS_FAILURE;
+    }
+
+    *geometry = g;
+    *table = (const API_NS(precomputed_s) *)map;
+    return GOLDILOCKS_SUCCESS;
+}
+
+goldilocks_error_t API_NS(precomputed_wnafs_save) (
+    const char *path,
+    const API_NS(precomputed_wnafs_s) *table,
+    unsigned int table_bits
+) {
+    uint32_t params[3] = {0,0,0};
+    size_t size = API_NS(sizeof_precomputed_wnafs)(table_bits);
+    if (!size) return GOLDILOCKS_FAILURE;
+
+    params[0] = table_bits;
+    return table_file_save(path, TABLE_KIND_WNAFS, params, table, size);
+}
+
+goldilocks_error_t API_NS(precomputed_wnafs_map) (
+    const API_NS(precomputed_wnafs_s) **table,
+    unsigned int *table_bits,
+    const char *path
+) {
+    uint32_t params[3];
+    const uint8_t *map;
+
+    if (table_file_map(&map, params, path, TABLE_KIND_WNAFS) != GOLDILOCKS_SUCCESS) {
+        return GOLDILOCKS_FAILURE;
+    }
+
+    if (params[1] || params[2]
+        || API_NS(sizeof_precomputed_wnafs)(params[0]) != ((const struct table_file_header *)
+            (map - TABLE_FILE_HEADER_BYTES))->table_bytes) {
+        API_NS(precomputed_unmap)(map);
+        return GOLDILOCKS_FAILURE;
+    }
+
+    *table_bits = params[0];
+    *table = (const API_NS(precomputed_wnafs_s) *)map;
+    return GOLDILOCKS_SUCCESS;
+}
+
+void API_NS(precomputed_unmap) (
+    const void *table
+) {
+    const uint8_t *map = (const uint8_t *)table - TABLE_FILE_HEADER_BYTES;
+    const struct table_file_header *header = (const struct table_file_header *)map;
+    munmap((void *)map, TABLE_FILE_HEADER_BYTES + header->table_bytes);
+}
@@ -111,6 +111,33 @@ goldilocks_bool_t goldilocks_memeq (
     size_t size
 ) GOLDILOCKS_NONNULL GOLDILOCKS_WARN_UNUSED GOLDILOCKS_API_VIS;
 
+/**
+ * Allocate size bytes of zeroed memory for secrets, aligned to alignment
+ * (a power of two, or 0).  Requests of up to 32kiB come from a pool which
+ * is excluded from core dumps and, as far as RLIMIT_MEMLOCK allows, locked
+ * into RAM.  Larger requests, and those which don't fit in the pool, come
+ * from the heap.  Returns NULL if out of memory.
+ */
+void *goldilocks_secure_alloc (
+    size_t size,
+    size_t alignment
+) GOLDILOCKS_WARN_UNUSED GOLDILOCKS_API_VIS;
+
+/**
+ * Zeroize and release memory from goldilocks_secure_alloc, which may have
+ * been allocated by another thread.  size is the size which was requested.
+ * Does nothing if ptr is NULL.
+ */
+void goldilocks_secure_free (
+    void *ptr,
+    size_t size
+) GOLDILOCKS_API_VIS;
+
+/** Return GOLDILOCKS_TRUE if goldilocks_secure_alloc served ptr from the pool. */
+goldilocks_bool_t goldilocks_secure_is_pooled (
+    const void *ptr
+) GOLDILOCKS_WARN_UNUSED GOLDILOCKS_API_VIS;
+
 #ifdef __cplusplus
 } /* extern "C" */
 #endif
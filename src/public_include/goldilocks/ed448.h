@@ -188,6 +188,109 @@ goldilocks_error_t goldilocks_ed448_verify_prehash (
     uint8_t context_len
 ) GOLDILOCKS_API_VIS __attribute__((nonnull(1,2))) GOLDILOCKS_NOINLINE;
 
+/**
+ * @brief EdDSA signature verification against a stored public key point.
+ *
+ * Same as goldilocks_ed448_verify, but takes the public key point in compact
+ * affine form, so that a verifier which checks many signatures under the same
+ * key needn't decode it each time.  Store the point with:
+ *
+ *     goldilocks_448_point_decode_like_eddsa_and_mul_by_ratio(p, pubkey);
+ *     goldilocks_448_point_to_affine(pubkey_point, p);
+ *
+ * @param [in] signature The signature.
+ * @param [in] pubkey The public key.  It is still hashed into the challenge.
+ * @param [in] pubkey_point The public key point, as above.  The caller is
+ * responsible for it matching pubkey.
+ * @param [in] message The message to verify.
+ * @param [in] message_len The length of the message.
+ * @param [in] prehashed Nonzero if the message is actually the hash of something you want to verify.
+ * @param [in] context A "context" for this signature of up to 255 bytes.
+ * @param [in] context_len Length of the context.
+ *
+ * @retval GOLDILOCKS_FAILURE The signature doesn't verify, or pubkey_point isn't on the curve.
+ */
+goldilocks_error_t goldilocks_ed448_verify_with_point (
+    const uint8_t signature[GOLDILOCKS_EDDSA_448_SIGNATURE_BYTES],
+    const uint8_t pubkey[GOLDILOCKS_EDDSA_448_PUBLIC_BYTES],
+    const goldilocks_448_affine_point_p pubkey_point,
+    const uint8_t *message,
+    size_t message_len,
+    uint8_t prehashed,
+    const uint8_t *context,
+    uint8_t context_len
+) GOLDILOCKS_API_VIS __attribute__((nonnull(1,2,3))) GOLDILOCKS_NOINLINE;
+
+/**
+ * @brief Hash a message to the curve as the RFC 9380 suite
+ * edwards448_XOF:SHAKE256_ELL2_RO_ does.
+ *
+ * The result is held the way EdDSA decoding holds points: pass it to
+ * goldilocks_448_point_mul_by_ratio_and_encode_like_eddsa to get the
+ * encoding of the suite's output, which includes its cofactor clearing.
+ * Scalar multiples of the result encode to the same multiples of it.
+ *
+ * @param [out] p The point.
+ * @param [in] msg The message.
+ * @param [in] msg_len The length of the message.
+ * @param [in] dst The domain separation tag, which must not be empty.
+ * Tags of more than 255 bytes are hashed first, as the RFC says.
+ * @param [in] dst_len The length of the domain separation tag.
+ */
+void goldilocks_ed448_hash_to_curve (
+    goldilocks_448_point_p p,
+    const uint8_t *msg,
+    size_t msg_len,
+    const uint8_t *dst,
+    size_t dst_len
+) GOLDILOCKS_API_VIS __attribute__((nonnull(1,4))) GOLDILOCKS_NOINLINE;
+
+/**
+ * @brief Hash a message to the curve as the RFC 9380 suite
+ * edwards448_XOF:SHAKE256_ELL2_NU_ does.  This is cheaper than
+ * goldilocks_ed448_hash_to_curve, but its output is not uniformly
+ * distributed; see the RFC.
+ *
+ * @param [out] p The point, held as goldilocks_ed448_hash_to_curve holds it.
+ * @param [in] msg The message.
+ * @param [in] msg_len The length of the message.
+ * @param [in] dst The domain separation tag, which must not be empty.
+ * @param [in] dst_len The length of the domain separation tag.
+ */
+void goldilocks_ed448_encode_to_curve (
+    goldilocks_448_point_p p,
+    const uint8_t *msg,
+    size_t msg_len,
+    const uint8_t *dst,
+    size_t dst_len
+) GOLDILOCKS_API_VIS __attribute__((nonnull(1,4))) GOLDILOCKS_NOINLINE;
+
+/**
+ * @brief Hash many messages to the curve under the same domain separation
+ * tag.  Optionally writes the EdDSA encodings of the results, with one
+ * field inversion shared among several of them.
+ *
+ * @param [out] encoded n encoded points, one after another, each
+ * GOLDILOCKS_EDDSA_448_PUBLIC_BYTES long; or NULL if they are not wanted.
+ * @param [out] points The points, or NULL if they are not wanted.
+ * @param [in] msgs The messages.
+ * @param [in] msg_lens Their lengths.
+ * @param [in] n The number of messages.
+ * @param [in] dst The domain separation tag, which must not be empty.
+ * @param [in] dst_len The length of the domain separation tag.
+ * @param [in] random_oracle Nonzero for the _RO_ suite, zero for _NU_.
+ */
+void goldilocks_ed448_hash_to_curve_batch (
+    uint8_t *encoded,
+    goldilocks_448_point_s *points,
+    const uint8_t *const *msgs,
+    const size_t *msg_lens,
+    size_t n,
+    const uint8_t *dst,
+    size_t dst_len,
+    uint8_t random_oracle
+) GOLDILOCKS_API_VIS __attribute__((nonnull(6))) GOLDILOCKS_NOINLINE;
+
 /**
  * @brief EdDSA point encoding.  Used internally, exposed externally.
  * Multiplies by GOLDILOCKS_448_EDDSA_ENCODE_RATIO first.
@@ -217,6 +320,22 @@ void goldilocks_448_point_mul_by_ratio_and_encode_like_eddsa (
     const goldilocks_448_point_p p
 ) GOLDILOCKS_API_VIS GOLDILOCKS_NONNULL GOLDILOCKS_NOINLINE;
 
+/**
+ * @brief EdDSA point encoding of many points, sharing one field inversion
+ * among several of them.  Otherwise the same as
+ * goldilocks_448_point_mul_by_ratio_and_encode_like_eddsa.
+ *
+ * @param [out] enc n encoded points, one after another, each
+ * GOLDILOCKS_EDDSA_448_PUBLIC_BYTES long.
+ * @param [in] points The points to encode.
+ * @param [in] n The number of points.
+ */
+void goldilocks_448_point_mul_by_ratio_and_encode_like_eddsa_batch (
+    uint8_t *enc,
+    const goldilocks_448_point_s *points,
+    size_t n
+) GOLDILOCKS_API_VIS GOLDILOCKS_NOINLINE;
+
 /**
  * @brief EdDSA point decoding.  Multiplies by GOLDILOCKS_448_EDDSA_DECODE_RATIO,
  * and ignores cofactor information.
@@ -50,6 +50,9 @@ typedef class PrivateKeyBase PrivateKey, PrivateKeyPure, PrivateKeyPh;
 typedef class PublicKeyBase PublicKey, PublicKeyPure, PublicKeyPh;
 /** @endcond */
 
+/** A signature, held on the stack */
+typedef FixedArrayBuffer<GOLDILOCKS_EDDSA_448_SIGNATURE_BYTES> Signature;
+
 /**
  * Signatures support a "context" block, which allows you to domain separate them if
  * (for some reason) it's annoying to domain separate the message itself.  The default
@@ -126,11 +129,27 @@ public:
         const Block &message,
         const Block &context = NO_CONTEXT()
     ) const /* throw(LengthException, std::bad_alloc) */ {
+        SecureBuffer out(CRTP::SIG_BYTES);
+        FixedBuffer<GOLDILOCKS_EDDSA_448_SIGNATURE_BYTES> buf(out);
+        sign_into(buf,message,context);
+        return out;
+    }
+
+    /**
+     * Sign a message into a buffer, without allocating.
+     * @param [out] out The signature.
+     * @param [in] message The message to be signed.
+     * @param [in] context A context for the signature; must be at most 255 bytes.
+     */
+    inline void sign_into (
+        FixedBuffer<GOLDILOCKS_EDDSA_448_SIGNATURE_BYTES> &out,
+        const Block &message,
+        const Block &context = NO_CONTEXT()
+    ) const /* throw(LengthException) */ {
         if (context.size() > 255) {
             throw LengthException();
         }
 
-        SecureBuffer out(CRTP::SIG_BYTES);
         goldilocks_ed448_sign (
             out.data(),
             ((const CRTP*)this)->priv_.data(),
@@ -141,8 +160,19 @@ public:
             context.data(),
             context.size()
         );
+    }
+
+#if __cplusplus >= 201103L
+    /** Sign a message, returning the signature on the stack. */
+    inline Signature sign_fixed (
+        const Block &message,
+        const Block &context = NO_CONTEXT()
+    ) const /* throw(LengthException) */ {
+        Signature out((NOINIT()));
+        sign_into(out,message,context);
         return out;
     }
+#endif
 };
 
 /** Signing (i.e. private) key class, prehashed version */
@@ -151,6 +181,16 @@ public:
     /** Sign a prehash context, and reset the context */
     inline SecureBuffer sign_prehashed ( const Prehash &ph ) const /*throw(std::bad_alloc)*/ {
         SecureBuffer out(CRTP::SIG_BYTES);
+        FixedBuffer<GOLDILOCKS_EDDSA_448_SIGNATURE_BYTES> buf(out);
+        sign_prehashed_into(buf,ph);
+        return out;
+    }
+
+    /** Sign a prehash context into a buffer, without allocating */
+    inline void sign_prehashed_into (
+        FixedBuffer<GOLDILOCKS_EDDSA_448_SIGNATURE_BYTES> &out,
+        const Prehash &ph
+    ) const GOLDILOCKS_NOEXCEPT {
         goldilocks_ed448_sign_prehash (
             out.data(),
             ((const CRTP*)this)->priv_.data(),
@@ -159,7 +199,6 @@ public:
             ph.context_.data(),
             ph.context_.size()
         );
-        return out;
     }
 
     /** Sign a message using the prehasher */
@@ -233,6 +272,20 @@ public:
         return *this;
     }
 
+#if __cplusplus >= 201103L
+    /** Move constructor.  k is wiped, and must be assigned to before it is used again. */
+    inline PrivateKeyBase(PrivateKey &&k) GOLDILOCKS_NOEXCEPT
+        : priv_(static_cast<FixedArrayBuffer<SER_BYTES>&&>(k.priv_))
+        , pub_(static_cast<FixedArrayBuffer<GOLDILOCKS_EDDSA_448_PUBLIC_BYTES>&&>(k.pub_)) { }
+
+    /** Move assignment.  k is wiped, and must be assigned to before it is used again. */
+    inline PrivateKeyBase &operator=(PrivateKey &&k) GOLDILOCKS_NOEXCEPT {
+        priv_ = static_cast<FixedArrayBuffer<SER_BYTES>&&>(k.priv_);
+        pub_ = static_cast<FixedArrayBuffer<GOLDILOCKS_EDDSA_448_PUBLIC_BYTES>&&>(k.pub_);
+        return *this;
+    }
+#endif
+
     /** Serialization size. */
     inline size_t ser_size() const GOLDILOCKS_NOEXCEPT { return SER_BYTES; }
 
@@ -248,6 +301,11 @@ public:
         return out;
     }
 
+    /** Convert to X format into a buffer, without allocating */
+    inline void convert_to_x(FixedBuffer<GOLDILOCKS_X448_PRIVATE_BYTES> &out) const GOLDILOCKS_NOEXCEPT {
+        goldilocks_ed448_convert_private_key_to_x448(out.data(), priv_.data());
+    }
+
     /** Return the corresponding public key */
     inline PublicKey pub() const GOLDILOCKS_NOEXCEPT {
         PublicKey pub(*this);
@@ -419,6 +477,11 @@ public:
         goldilocks_ed448_convert_public_key_to_x448(out.data(), pub_.data());
         return out;
     }
+
+    /** Convert to X format into a buffer, without allocating */
+    inline void convert_to_x(FixedBuffer<GOLDILOCKS_X448_PUBLIC_BYTES> &out) const GOLDILOCKS_NOEXCEPT {
+        goldilocks_ed448_convert_public_key_to_x448(out.data(), pub_.data());
+    }
 }; /* class PublicKey */
 
 }; /* template<> struct EdDSA<Ed448Goldilocks> */
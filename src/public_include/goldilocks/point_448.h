@@ -69,6 +69,29 @@ typedef struct goldilocks_448_point_s {
     /** @endcond */
 } goldilocks_448_point_s, goldilocks_448_point_p[1];
 
+/**
+ * A point prepared for repeated addition, in affine Niels coordinates.
+ * Adding one costs 7 field multiplications instead of the 9 of
+ * goldilocks_448_point_add.
+ */
+typedef struct goldilocks_448_prepared_point_s {
+    /** @cond internal */
+    gf_448_p a,b,c; /* y-x, y+x and 2dxy on the twisted curve */
+    /** @endcond */
+} goldilocks_448_prepared_point_s, goldilocks_448_prepared_point_p[1];
+
+/**
+ * A point in compact affine form, for keeping many points in memory: 112
+ * bytes instead of the 256 of goldilocks_448_point_s.  Convert with
+ * goldilocks_448_point_to_affine_batch, which shares one inversion among
+ * many points.
+ */
+typedef struct goldilocks_448_affine_point_s {
+    /** @cond internal */
+    uint8_t x[GOLDILOCKS_448_SER_BYTES], y[GOLDILOCKS_448_SER_BYTES]; /* canonical, little-endian */
+    /** @endcond */
+} goldilocks_448_affine_point_s, goldilocks_448_affine_point_p[1];
+
 /** Precomputed table based on a point.  Can be trivial implementation. */
 struct goldilocks_448_precomputed_s;
 
@@ -78,12 +101,36 @@ typedef struct goldilocks_448_precomputed_s goldilocks_448_precomputed_s;
 /** Size and alignment of precomputed point tables. */
 extern const size_t goldilocks_448_sizeof_precomputed_s GOLDILOCKS_API_VIS, goldilocks_448_alignof_precomputed_s GOLDILOCKS_API_VIS;
 
+/**
+ * Shape of a comb table for fixed-base scalar multiplication: n combs
+ * of t teeth each, with the teeth spaced s bits apart.  A table has
+ * n*2^(t-1) entries, and a multiply costs n*s additions and s-1 doublings.
+ */
+typedef struct goldilocks_448_comb_geometry_s {
+    unsigned int n, t, s;
+} goldilocks_448_comb_geometry_s;
+
+/** The comb geometry of goldilocks_448_precomputed_s, chosen at build time. */
+extern const goldilocks_448_comb_geometry_s goldilocks_448_comb_geometry GOLDILOCKS_API_VIS;
+
+/** Table of odd multiples of a point, for variable-time scalar multiplication. */
+typedef struct goldilocks_448_precomputed_wnafs_s goldilocks_448_precomputed_wnafs_s;
+
+/** Alignment of the workspaces taken by the _ws scalar multiplications. */
+extern const size_t goldilocks_448_alignof_workspace GOLDILOCKS_API_VIS;
+
+/** State of a scalar multiplication which runs a few steps at a time. */
+typedef struct goldilocks_448_scalarmul_state_s goldilocks_448_scalarmul_state_s;
+
+/** Size and alignment of goldilocks_448_scalarmul_state_s. */
+extern const size_t goldilocks_448_sizeof_scalarmul_state GOLDILOCKS_API_VIS, goldilocks_448_alignof_scalarmul_state GOLDILOCKS_API_VIS;
+
 /** Representation of an element of the scalar field. */
 typedef struct goldilocks_448_scalar_s {
     /** @cond internal */
     goldilocks_word_t limb[GOLDILOCKS_448_SCALAR_LIMBS];
     /** @endcond */
-} goldilocks_448_scalar_p[1];
+} goldilocks_448_scalar_s, goldilocks_448_scalar_p[1];
 
 /** The scalar 1. */
 extern const goldilocks_448_scalar_p goldilocks_448_scalar_one GOLDILOCKS_API_VIS;
@@ -333,6 +380,119 @@ void goldilocks_448_point_sub (
     const goldilocks_448_point_p b
 ) GOLDILOCKS_API_VIS GOLDILOCKS_NONNULL;
 
+/**
+ * @brief Prepare a point for repeated addition.  This costs a field
+ * inversion; to prepare many points, goldilocks_448_point_prepare_batch
+ * shares one inversion among them.
+ *
+ * @param [out] prepared The prepared form of p.
+ * @param [in] p The point.
+ */
+void goldilocks_448_point_prepare (
+    goldilocks_448_prepared_point_p prepared,
+    const goldilocks_448_point_p p
+) GOLDILOCKS_API_VIS GOLDILOCKS_NONNULL GOLDILOCKS_NOINLINE;
+
+/**
+ * @brief Prepare an array of points for repeated addition, normalizing
+ * them in batches with one field inversion per batch.
+ *
+ * @param [out] prepared The prepared forms of the points.
+ * @param [in] points The points.
+ * @param [in] n The number of points.
+ */
+void goldilocks_448_point_prepare_batch (
+    goldilocks_448_prepared_point_s *prepared,
+    const goldilocks_448_point_s *points,
+    size_t n
+) GOLDILOCKS_API_VIS GOLDILOCKS_NOINLINE;
+
+/**
+ * @brief Add a prepared point to a point.  The input and output
+ * points can be pointers to the same memory.
+ *
+ * @param [out] sum The sum a+b.
+ * @param [in] a An addend.
+ * @param [in] b An addend, prepared by goldilocks_448_point_prepare.
+ */
+void goldilocks_448_point_add_prepared (
+    goldilocks_448_point_p sum,
+    const goldilocks_448_point_p a,
+    const goldilocks_448_prepared_point_p b
+) GOLDILOCKS_API_VIS GOLDILOCKS_NONNULL;
+
+/**
+ * @brief Subtract a prepared point from a point.  The input and
+ * output points can be pointers to the same memory.
+ *
+ * @param [out] diff The difference a-b.
+ * @param [in] a The minuend.
+ * @param [in] b The subtrahend, prepared by goldilocks_448_point_prepare.
+ */
+void goldilocks_448_point_sub_prepared (
+    goldilocks_448_point_p diff,
+    const goldilocks_448_point_p a,
+    const goldilocks_448_prepared_point_p b
+) GOLDILOCKS_API_VIS GOLDILOCKS_NONNULL;
+
+/**
+ * @brief Convert a point to compact affine form.  This costs a field
+ * inversion; goldilocks_448_point_to_affine_batch shares one among many
+ * points.
+ *
+ * @param [out] affine The affine form of p.
+ * @param [in] p The point.
+ */
+void goldilocks_448_point_to_affine (
+    goldilocks_448_affine_point_p affine,
+    const goldilocks_448_point_p p
+) GOLDILOCKS_API_VIS GOLDILOCKS_NONNULL GOLDILOCKS_NOINLINE;
+
+/**
+ * @brief Convert an array of points to compact affine form, in batches
+ * with one field inversion per batch.
+ *
+ * @param [out] affine The affine forms of the points.
+ * @param [in] points The points.
+ * @param [in] n The number of points.
+ */
+void goldilocks_448_point_to_affine_batch (
+    goldilocks_448_affine_point_s *affine,
+    const goldilocks_448_point_s *points,
+    size_t n
+) GOLDILOCKS_API_VIS GOLDILOCKS_NOINLINE;
+
+/**
+ * @brief Convert a point from compact affine form.  This is cheap: one
+ * field multiplication, and a check that the point is on the curve.
+ *
+ * @param [out] p The point.
+ * @param [in] affine Its affine form.
+ *
+ * @retval GOLDILOCKS_SUCCESS The affine form was valid.
+ * @retval GOLDILOCKS_FAILURE The coordinates were not canonical, or not
+ * on the curve.  The contents of p are undefined.
+ */
+goldilocks_error_t goldilocks_448_point_from_affine (
+    goldilocks_448_point_p p,
+    const goldilocks_448_affine_point_p affine
+) GOLDILOCKS_API_VIS GOLDILOCKS_WARN_UNUSED GOLDILOCKS_NONNULL GOLDILOCKS_NOINLINE;
+
+/**
+ * @brief Sum an array of points.  Large arrays are split among several
+ * threads, whose partial sums are then added pairwise.  The output may
+ * be one of the inputs.
+ *
+ * @param [out] sum The sum of the points; the identity if n is 0.
+ * @param [in] points The points.
+ * @param [in] n The number of points.
+ */
+void goldilocks_448_point_sum (
+    goldilocks_448_point_p sum,
+    const goldilocks_448_point_s *points,
+    size_t n
+) GOLDILOCKS_API_VIS GOLDILOCKS_NOINLINE;
+
 /**
  * @brief Negate a point to produce another point.  The input
  * and output points can use the same memory.
@@ -348,6 +508,8 @@ void goldilocks_448_point_negate (
 /**
  * @brief Multiply a base point by a scalar: scaled = scalar*base.
  *
+ * Uses about 6.5 KiB of stack; goldilocks_448_point_scalarmul_ws uses less.
+ *
  * @param [out] scaled The scaled point base*scalar
  * @param [in] base The point to be scaled.
  * @param [in] scalar The scalar to multiply by.
@@ -455,6 +617,8 @@ void goldilocks_x448_derive_public_key (
  * those implementations, this implementation simply copies the
  * point.
  *
+ * Uses about 13.5 KiB of stack; goldilocks_448_precompute_ws uses less.
+ *
  * @param [out] a A precomputed table of multiples of the point.
  * @param [in] b Any point.
  */
@@ -463,6 +627,60 @@ void goldilocks_448_precompute (
     const goldilocks_448_point_p b
 ) GOLDILOCKS_API_VIS GOLDILOCKS_NONNULL GOLDILOCKS_NOINLINE;
 
+/**
+ * @brief Return the size in bytes of a precomputed table with the given
+ * comb geometry, or 0 if the geometry is not supported.  Tables must be
+ * aligned to goldilocks_448_alignof_precomputed_s.
+ *
+ * A geometry is supported when 2 <= t <= 8 and n*t*s is between 446 and
+ * 892.  The build-time geometry is goldilocks_448_comb_geometry.
+ *
+ * @param [in] geometry The comb geometry.
+ */
+size_t goldilocks_448_sizeof_precomputed_combs (
+    const goldilocks_448_comb_geometry_s *geometry
+) GOLDILOCKS_API_VIS GOLDILOCKS_NONNULL GOLDILOCKS_NOINLINE;
+
+/**
+ * @brief Precompute a table with the given comb geometry for fast
+ * scalar multiplication.  Larger tables trade memory for speed.
+ *
+ * Uses up to 20.5 KiB of stack, depending on the geometry.
+ *
+ * @param [out] a A precomputed table of multiples of the point, of
+ * goldilocks_448_sizeof_precomputed_combs(geometry) bytes.
+ * @param [in] geometry The comb geometry.
+ * @param [in] b Any point.
+ *
+ * @retval GOLDILOCKS_SUCCESS The table was computed.
+ * @retval GOLDILOCKS_FAILURE The geometry is not supported.
+ */
+goldilocks_error_t goldilocks_448_precompute_combs (
+    goldilocks_448_precomputed_s *a,
+    const goldilocks_448_comb_geometry_s *geometry,
+    const goldilocks_448_point_p b
+) GOLDILOCKS_API_VIS GOLDILOCKS_NONNULL GOLDILOCKS_NOINLINE;
+
+/**
+ * @brief Multiply a base point precomputed by goldilocks_448_precompute_combs
+ * by a scalar: scaled = scalar*base.
+ *
+ * @param [out] scaled The scaled point base*scalar
+ * @param [in] base The point to be scaled.
+ * @param [in] geometry The comb geometry the table was computed with.
+ * @param [in] scalar The scalar to multiply by.
+ *
+ * @retval GOLDILOCKS_SUCCESS The point was scaled.
+ * @retval GOLDILOCKS_FAILURE The geometry is not supported.  The output
+ * is left unchanged.
+ */
+goldilocks_error_t goldilocks_448_precomputed_combs_scalarmul (
+    goldilocks_448_point_p scaled,
+    const goldilocks_448_precomputed_s *base,
+    const goldilocks_448_comb_geometry_s *geometry,
+    const goldilocks_448_scalar_p scalar
+) GOLDILOCKS_API_VIS GOLDILOCKS_NONNULL GOLDILOCKS_NOINLINE;
+
 /**
  * @brief Multiply a precomputed base point by a scalar:
  * scaled = scalar*base.
@@ -480,6 +698,28 @@ void goldilocks_448_precomputed_scalarmul (
     const goldilocks_448_scalar_p scalar
 ) GOLDILOCKS_API_VIS GOLDILOCKS_NONNULL GOLDILOCKS_NOINLINE;
 
+/**
+ * @brief Multiply two precomputed base points by two scalars:
+ * combo = scalar1*base1 + scalar2*base2.
+ *
+ * Equivalent to two calls to goldilocks_448_precomputed_scalarmul and an
+ * addition, but faster: both comb tables are walked in one pass, sharing
+ * the doublings.  This is the shape of a Pedersen commitment.
+ *
+ * @param [out] combo The linear combination scalar1*base1 + scalar2*base2.
+ * @param [in] base1 A precomputed first point to be scaled.
+ * @param [in] scalar1 A first scalar to multiply by.
+ * @param [in] base2 A precomputed second point to be scaled.
+ * @param [in] scalar2 A second scalar to multiply by.
+ */
+void goldilocks_448_precomputed_double_scalarmul (
+    goldilocks_448_point_p combo,
+    const goldilocks_448_precomputed_s *base1,
+    const goldilocks_448_scalar_p scalar1,
+    const goldilocks_448_precomputed_s *base2,
+    const goldilocks_448_scalar_p scalar2
+) GOLDILOCKS_API_VIS GOLDILOCKS_NONNULL GOLDILOCKS_NOINLINE;
+
 /**
  * @brief Multiply two base points by two scalars:
  * scaled = scalar1*base1 + scalar2*base2.
@@ -487,6 +727,9 @@ void goldilocks_448_precomputed_scalarmul (
  * Equivalent to two calls to goldilocks_448_point_scalarmul, but may be
  * faster.
  *
+ * Uses about 11 KiB of stack; goldilocks_448_point_double_scalarmul_ws
+ * uses less.
+ *
  * @param [out] combo The linear combination scalar1*base1 + scalar2*base2.
  * @param [in] base1 A first point to be scaled.
  * @param [in] scalar1 A first scalar to multiply by.
@@ -510,6 +753,9 @@ void goldilocks_448_point_double_scalarmul (
  * Equivalent to two calls to goldilocks_448_point_scalarmul, but may be
  * faster.
  *
+ * Uses about 10.5 KiB of stack; goldilocks_448_point_dual_scalarmul_ws
+ * uses less.
+ *
  * @param [out] a1 The first multiple.  It may be the same as the input point.
  * @param [out] a2 The second multiple.  It may be the same as the input point.
  * @param [in] base1 A point to be scaled.
@@ -524,12 +770,256 @@ void goldilocks_448_point_dual_scalarmul (
     const goldilocks_448_scalar_p scalar2
 ) GOLDILOCKS_API_VIS GOLDILOCKS_NONNULL GOLDILOCKS_NOINLINE;
 
+/**
+ * @brief Multiply n points by n scalars:
+ * combo = scalars[0]*bases[0] + ... + scalars[n-1]*bases[n-1].
+ *
+ * Equivalent to n calls to goldilocks_448_point_scalarmul followed by
+ * additions, but faster: up to 16 points share one doubling chain.
+ * The tables are kept on the stack, using about 36 KiB of it regardless
+ * of n.  If n is zero, combo is set to the identity.
+ *
+ * @param [out] combo The linear combination of the bases.
+ * @param [in] bases An array of n points to be scaled.
+ * @param [in] scalars An array of n scalars to multiply by.
+ * @param [in] n The number of points and scalars.
+ */
+void goldilocks_448_point_multiscalarmul (
+    goldilocks_448_point_p combo,
+    const goldilocks_448_point_s *bases,
+    const goldilocks_448_scalar_s *scalars,
+    size_t n
+) GOLDILOCKS_API_VIS GOLDILOCKS_NOINLINE;
+
+/**
+ * @brief Multiply many points in compact affine form by scalars, and add
+ * the results.  Equivalent to goldilocks_448_point_multiscalarmul, without
+ * converting the whole array first.  Each point is checked as
+ * goldilocks_448_point_from_affine checks it.
+ *
+ * @param [out] combo The linear combination.
+ * @param [in] bases The points, in affine form.
+ * @param [in] scalars The scalars.
+ * @param [in] n The number of points and of scalars.
+ *
+ * @retval GOLDILOCKS_SUCCESS All the points were valid.
+ * @retval GOLDILOCKS_FAILURE Some point had a non-canonical coordinate or
+ * was not on the curve.  Then combo is meaningless.
+ */
+goldilocks_error_t goldilocks_448_point_multiscalarmul_affine (
+    goldilocks_448_point_p combo,
+    const goldilocks_448_affine_point_s *bases,
+    const goldilocks_448_scalar_s *scalars,
+    size_t n
+) GOLDILOCKS_API_VIS GOLDILOCKS_WARN_UNUSED GOLDILOCKS_NOINLINE;
+
+/**
+ * @brief Return the size in bytes of the workspace taken by the _ws
+ * variants of the constant-time scalar multiplications, about 18 KiB.
+ *
+ * Those variants keep their tables in the workspace instead of on the
+ * stack, and use at most about 3 KiB of stack each (3.1 KiB for
+ * goldilocks_448_point_multiscalarmul_ws, less for the others), so they
+ * suit threads with small stacks.  One workspace may be reused for any of them, but
+ * not by two calls at once.  It must be aligned to
+ * goldilocks_448_alignof_workspace.  What a call writes to it is
+ * erased before the call returns.
+ *
+ * The stack figures in this file are worst cases for x86-64 with gcc -Os;
+ * "make -f Makefile.custom stack-usage" reports them for a given build.
+ */
+size_t goldilocks_448_sizeof_workspace (void) GOLDILOCKS_API_VIS GOLDILOCKS_NOINLINE;
+
+/**
+ * @brief goldilocks_448_point_scalarmul, with its tables in a workspace.
+ *
+ * @param [out] scaled The scaled point base*scalar
+ * @param [in] base The point to be scaled.
+ * @param [in] scalar The scalar to multiply by.
+ * @param [in] workspace A workspace of goldilocks_448_sizeof_workspace() bytes.
+ */
+void goldilocks_448_point_scalarmul_ws (
+    goldilocks_448_point_p scaled,
+    const goldilocks_448_point_p base,
+    const goldilocks_448_scalar_p scalar,
+    void *workspace
+) GOLDILOCKS_API_VIS GOLDILOCKS_NONNULL GOLDILOCKS_NOINLINE;
+
+/**
+ * @brief goldilocks_448_point_double_scalarmul, with its tables in a workspace.
+ *
+ * @param [out] combo The linear combination scalar1*base1 + scalar2*base2.
+ * @param [in] base1 A first point to be scaled.
+ * @param [in] scalar1 A first scalar to multiply by.
+ * @param [in] base2 A second point to be scaled.
+ * @param [in] scalar2 A second scalar to multiply by.
+ * @param [in] workspace A workspace of goldilocks_448_sizeof_workspace() bytes.
+ */
+void goldilocks_448_point_double_scalarmul_ws (
+    goldilocks_448_point_p combo,
+    const goldilocks_448_point_p base1,
+    const goldilocks_448_scalar_p scalar1,
+    const goldilocks_448_point_p base2,
+    const goldilocks_448_scalar_p scalar2,
+    void *workspace
+) GOLDILOCKS_API_VIS GOLDILOCKS_NONNULL GOLDILOCKS_NOINLINE;
+
+/**
+ * @brief goldilocks_448_point_dual_scalarmul, with its tables in a workspace.
+ *
+ * @param [out] a1 The first multiple.  It may be the same as the input point.
+ * @param [out] a2 The second multiple.  It may be the same as the input point.
+ * @param [in] base1 A point to be scaled.
+ * @param [in] scalar1 A first scalar to multiply by.
+ * @param [in] scalar2 A second scalar to multiply by.
+ * @param [in] workspace A workspace of goldilocks_448_sizeof_workspace() bytes.
+ */
+void goldilocks_448_point_dual_scalarmul_ws (
+    goldilocks_448_point_p a1,
+    goldilocks_448_point_p a2,
+    const goldilocks_448_point_p base1,
+    const goldilocks_448_scalar_p scalar1,
+    const goldilocks_448_scalar_p scalar2,
+    void *workspace
+) GOLDILOCKS_API_VIS GOLDILOCKS_NONNULL GOLDILOCKS_NOINLINE;
+
+/**
+ * @brief goldilocks_448_point_multiscalarmul, with its tables in a workspace.
+ *
+ * A workspace holds tables for 8 points rather than 16, so each
+ * doubling chain is shared by at most 8 points.
+ *
+ * @param [out] combo The linear combination of the bases.
+ * @param [in] bases An array of n points to be scaled.
+ * @param [in] scalars An array of n scalars to multiply by.
+ * @param [in] n The number of points and scalars.
+ * @param [in] workspace A workspace of goldilocks_448_sizeof_workspace() bytes.
+ */
+void goldilocks_448_point_multiscalarmul_ws (
+    goldilocks_448_point_p combo,
+    const goldilocks_448_point_s *bases,
+    const goldilocks_448_scalar_s *scalars,
+    size_t n,
+    void *workspace
+) GOLDILOCKS_API_VIS GOLDILOCKS_NOINLINE;
+
+/**
+ * @brief goldilocks_448_precompute, with its temporaries in a workspace.
+ *
+ * @param [out] a A precomputed table of multiples of the point.
+ * @param [in] b Any point.
+ * @param [in] workspace A workspace of goldilocks_448_sizeof_workspace() bytes.
+ */
+void goldilocks_448_precompute_ws (
+    goldilocks_448_precomputed_s *a,
+    const goldilocks_448_point_p b,
+    void *workspace
+) GOLDILOCKS_API_VIS GOLDILOCKS_NONNULL GOLDILOCKS_NOINLINE;
+
+/**
+ * @brief Start a resumable goldilocks_448_point_scalarmul.
+ *
+ * A resumable scalar multiplication is started by one of the _start
+ * functions, advanced by goldilocks_448_scalarmul_resume, and completed by
+ * goldilocks_448_point_scalarmul_finish or goldilocks_x448_finish.  This
+ * lets a cooperative scheduler interleave it with other work.  Each step
+ * takes the same time whatever the scalar.
+ *
+ * Starting builds the table of multiples, which costs a few percent of
+ * the whole multiplication.
+ *
+ * @param [out] state The state, of goldilocks_448_sizeof_scalarmul_state
+ * bytes aligned to goldilocks_448_alignof_scalarmul_state.
+ * @param [in] base The point to be scaled.
+ * @param [in] scalar The scalar to multiply by.
+ */
+void goldilocks_448_point_scalarmul_start (
+    goldilocks_448_scalarmul_state_s *state,
+    const goldilocks_448_point_p base,
+    const goldilocks_448_scalar_p scalar
+) GOLDILOCKS_API_VIS GOLDILOCKS_NONNULL GOLDILOCKS_NOINLINE;
+
+/**
+ * @brief Start a resumable goldilocks_448_precomputed_scalarmul.
+ *
+ * @param [out] state The state.
+ * @param [in] base The point to be scaled.  It must stay valid until
+ * the multiplication is finished.
+ * @param [in] scalar The scalar to multiply by.
+ */
+void goldilocks_448_precomputed_scalarmul_start (
+    goldilocks_448_scalarmul_state_s *state,
+    const goldilocks_448_precomputed_s *base,
+    const goldilocks_448_scalar_p scalar
+) GOLDILOCKS_API_VIS GOLDILOCKS_NONNULL GOLDILOCKS_NOINLINE;
+
+/**
+ * @brief Start a resumable goldilocks_x448.
+ *
+ * @param [out] state The state.
+ * @param [in] base The other party's public key.
+ * @param [in] scalar The private scalar to multiply by.
+ */
+void goldilocks_x448_start (
+    goldilocks_448_scalarmul_state_s *state,
+    const uint8_t base[GOLDILOCKS_X448_PUBLIC_BYTES],
+    const uint8_t scalar[GOLDILOCKS_X448_PRIVATE_BYTES]
+) GOLDILOCKS_API_VIS GOLDILOCKS_NONNULL GOLDILOCKS_NOINLINE;
+
+/**
+ * @brief Advance a resumable scalar multiplication by up to max_steps steps.
+ *
+ * A step is a window of goldilocks_448_point_scalarmul (90 in all), a comb
+ * column of goldilocks_448_precomputed_scalarmul (18 with the default
+ * tables), or a ladder step of goldilocks_x448 (448).  On x86-64 these
+ * take about 11000, 13000 and 2400 cycles respectively.
+ *
+ * @param [in,out] state The state.
+ * @param [in] max_steps The most steps to take.
+ *
+ * @return The number of steps left; 0 when the multiplication is ready to
+ * finish.
+ */
+unsigned int goldilocks_448_scalarmul_resume (
+    goldilocks_448_scalarmul_state_s *state,
+    unsigned int max_steps
+) GOLDILOCKS_API_VIS GOLDILOCKS_NONNULL GOLDILOCKS_NOINLINE;
+
+/**
+ * @brief Finish a resumable goldilocks_448_point_scalarmul or
+ * goldilocks_448_precomputed_scalarmul, and erase its state.  Any steps
+ * left are run first.
+ *
+ * @param [out] scaled The scaled point base*scalar
+ * @param [in,out] state The state.
+ */
+void goldilocks_448_point_scalarmul_finish (
+    goldilocks_448_point_p scaled,
+    goldilocks_448_scalarmul_state_s *state
+) GOLDILOCKS_API_VIS GOLDILOCKS_NONNULL GOLDILOCKS_NOINLINE;
+
+/**
+ * @brief Finish a resumable goldilocks_x448, and erase its state.  Any
+ * steps left are run first.
+ *
+ * @param [out] shared The shared secret base*scalar
+ * @param [in,out] state The state.
+ *
+ * @retval GOLDILOCKS_SUCCESS The scalarmul succeeded.
+ * @retval GOLDILOCKS_FAILURE The scalarmul didn't succeed, because the base
+ * point is in a small subgroup.
+ */
+goldilocks_error_t goldilocks_x448_finish (
+    uint8_t shared[GOLDILOCKS_X448_PUBLIC_BYTES],
+    goldilocks_448_scalarmul_state_s *state
+) GOLDILOCKS_API_VIS GOLDILOCKS_NONNULL GOLDILOCKS_WARN_UNUSED GOLDILOCKS_NOINLINE;
+
 /**
  * @brief Multiply two base points by two scalars:
  * scaled = scalar1*goldilocks_448_point_base + scalar2*base2.
  *
  * Otherwise equivalent to goldilocks_448_point_double_scalarmul, but may be
- * faster at the expense of being variable time.
+ * faster at the expense of being variable time.  Uses about 6 KiB of stack.
  *
  * @param [out] combo The linear combination scalar1*base + scalar2*base2.
  * @param [in] scalar1 A first scalar to multiply by.
@@ -546,6 +1036,198 @@ void goldilocks_448_base_double_scalarmul_non_secret (
     const goldilocks_448_scalar_p scalar2
 ) GOLDILOCKS_API_VIS GOLDILOCKS_NONNULL GOLDILOCKS_NOINLINE;
 
+/**
+ * @brief Check whether scalar1*(base point) + scalar2*base2 == expected.
+ *
+ * Otherwise equivalent to goldilocks_448_base_double_scalarmul_non_secret
+ * followed by goldilocks_448_point_eq, but faster: scalar2 is first
+ * written as c/d with c and d about half as long, and
+ * (d*scalar1)*(base point) + c*base2 - d*expected == 0 is checked instead.
+ * Uses about 10 KiB of stack.  A library built with
+ * GOLDILOCKS_WNAF_FIXED_SPLIT=0 has no table for the short base multiple,
+ * and does the full-width check instead.
+ *
+ * @param [in] scalar1 A first scalar to multiply by.
+ * @param [in] base2 A second point to be scaled.
+ * @param [in] scalar2 A second scalar to multiply by.
+ * @param [in] expected The point to compare against.
+ *
+ * @retval GOLDILOCKS_TRUE The combination equals expected.
+ * @retval GOLDILOCKS_FALSE The combination does not equal expected.
+ *
+ * @warning: This function takes variable time, and may leak the scalars
+ * used.  It is designed for signature verification.
+ */
+goldilocks_bool_t goldilocks_448_base_double_scalarmul_non_secret_eq (
+    const goldilocks_448_scalar_p scalar1,
+    const goldilocks_448_point_p base2,
+    const goldilocks_448_scalar_p scalar2,
+    const goldilocks_448_point_p expected
+) GOLDILOCKS_API_VIS GOLDILOCKS_WARN_UNUSED GOLDILOCKS_NONNULL GOLDILOCKS_NOINLINE;
+
+/**
+ * @brief Multiply a point by a scalar: scaled = scalar*base.
+ *
+ * Otherwise equivalent to goldilocks_448_point_scalarmul, but may be
+ * faster at the expense of being variable time.  Uses about 6.5 KiB of stack.
+ *
+ * @param [out] scaled The scaled point base*scalar
+ * @param [in] base The point to be scaled.
+ * @param [in] scalar The scalar to multiply by.
+ *
+ * @warning: This function takes variable time, and may leak the scalar
+ * used.  Use it only when both the point and the scalar are public.
+ */
+void goldilocks_448_point_scalarmul_non_secret (
+    goldilocks_448_point_p scaled,
+    const goldilocks_448_point_p base,
+    const goldilocks_448_scalar_p scalar
+) GOLDILOCKS_API_VIS GOLDILOCKS_NONNULL GOLDILOCKS_NOINLINE;
+
+/**
+ * @brief Return the size in bytes of a wNAF table with 2^table_bits
+ * entries, or 0 if table_bits is not between 1 and 8.  Tables must be
+ * aligned to goldilocks_448_alignof_precomputed_s.
+ *
+ * @param [in] table_bits The log2 of the number of entries.
+ */
+size_t goldilocks_448_sizeof_precomputed_wnafs (
+    unsigned int table_bits
+) GOLDILOCKS_API_VIS GOLDILOCKS_NOINLINE;
+
+/**
+ * @brief Precompute a wNAF table of a point, for repeated variable-time
+ * multiplication by goldilocks_448_precomputed_wnafs_scalarmul_non_secret.
+ * Uses about 14 KiB of stack.
+ *
+ * @param [out] table A table of goldilocks_448_sizeof_precomputed_wnafs(table_bits) bytes.
+ * @param [in] table_bits The log2 of the number of entries.
+ * @param [in] base Any point.
+ *
+ * @retval GOLDILOCKS_SUCCESS The table was computed.
+ * @retval GOLDILOCKS_FAILURE table_bits is not supported.
+ */
+goldilocks_error_t goldilocks_448_precompute_wnafs (
+    goldilocks_448_precomputed_wnafs_s *table,
+    unsigned int table_bits,
+    const goldilocks_448_point_p base
+) GOLDILOCKS_API_VIS GOLDILOCKS_NONNULL GOLDILOCKS_NOINLINE;
+
+/**
+ * @brief Multiply a point by a scalar using its wNAF table:
+ * scaled = scalar*base.
+ *
+ * @param [out] scaled The scaled point base*scalar
+ * @param [in] table The table made by goldilocks_448_precompute_wnafs.
+ * @param [in] table_bits The table_bits the table was made with.
+ * @param [in] scalar The scalar to multiply by.
+ *
+ * @retval GOLDILOCKS_SUCCESS The point was scaled.
+ * @retval GOLDILOCKS_FAILURE table_bits is not supported.  The output
+ * is left unchanged.
+ *
+ * @warning: This function takes variable time, and may leak the scalar
+ * used.  Use it only when both the point and the scalar are public.
+ */
+goldilocks_error_t goldilocks_448_precomputed_wnafs_scalarmul_non_secret (
+    goldilocks_448_point_p scaled,
+    const goldilocks_448_precomputed_wnafs_s *table,
+    unsigned int table_bits,
+    const goldilocks_448_scalar_p scalar
+) GOLDILOCKS_API_VIS GOLDILOCKS_NONNULL GOLDILOCKS_NOINLINE;
+
+/**
+ * @brief Save a comb table to a file, for goldilocks_448_precomputed_map.
+ *
+ * The file records the format version, the field representation of this
+ * build and a SHAKE256 digest of the table, so that it is only loaded by
+ * compatible builds.  To replace a file which other processes may be
+ * mapping, save to a temporary name and rename() it into place.
+ *
+ * @param [in] path The file to write.
+ * @param [in] table The table to save.
+ * @param [in] geometry The comb geometry of the table.
+ *
+ * @retval GOLDILOCKS_SUCCESS The table was saved.
+ * @retval GOLDILOCKS_FAILURE The geometry is not supported or the file
+ * could not be written.
+ */
+goldilocks_error_t goldilocks_448_precomputed_save (
+    const char *path,
+    const goldilocks_448_precomputed_s *table,
+    const goldilocks_448_comb_geometry_s *geometry
+) GOLDILOCKS_API_VIS GOLDILOCKS_WARN_UNUSED GOLDILOCKS_NONNULL GOLDILOCKS_NOINLINE;
+
+/**
+ * @brief Map a comb table saved by goldilocks_448_precomputed_save.
+ *
+ * The file is mapped read-only and shared, so processes mapping the same
+ * file share one physical copy.  Release it with
+ * goldilocks_448_precomputed_unmap.
+ *
+ * @param [out] table The mapped table.
+ * @param [out] geometry The comb geometry of the table.
+ * @param [in] path The file to map.
+ *
+ * @retval GOLDILOCKS_SUCCESS The table was mapped.
+ * @retval GOLDILOCKS_FAILURE The file could not be mapped, or is not a
+ * valid comb table for this build.
+ *
+ * @warning The table is trusted: a forged file with a valid digest gives
+ * wrong results.  Keep table files as protected as the code itself.
+ */
+goldilocks_error_t goldilocks_448_precomputed_map (
+    const goldilocks_448_precomputed_s **table,
+    goldilocks_448_comb_geometry_s *geometry,
+    const char *path
+) GOLDILOCKS_API_VIS GOLDILOCKS_WARN_UNUSED GOLDILOCKS_NONNULL GOLDILOCKS_NOINLINE;
+
+/**
+ * @brief Save a wNAF table to a file, for goldilocks_448_precomputed_wnafs_map.
+ * The file format is as for goldilocks_448_precomputed_save.
+ *
+ * @param [in] path The file to write.
+ * @param [in] table The table to save.
+ * @param [in] table_bits The table_bits the table was made with.
+ *
+ * @retval GOLDILOCKS_SUCCESS The table was saved.
+ * @retval GOLDILOCKS_FAILURE table_bits is not supported or the file
+ * could not be written.
+ */
+goldilocks_error_t goldilocks_448_precomputed_wnafs_save (
+    const char *path,
+    const goldilocks_448_precomputed_wnafs_s *table,
+    unsigned int table_bits
+) GOLDILOCKS_API_VIS GOLDILOCKS_WARN_UNUSED GOLDILOCKS_NONNULL GOLDILOCKS_NOINLINE;
+
+/**
+ * @brief Map a wNAF table saved by goldilocks_448_precomputed_wnafs_save.
+ * Release it with goldilocks_448_precomputed_unmap.
+ *
+ * @param [out] table The mapped table.
+ * @param [out] table_bits The table_bits of the table.
+ * @param [in] path The file to map.
+ *
+ * @retval GOLDILOCKS_SUCCESS The table was mapped.
+ * @retval GOLDILOCKS_FAILURE The file could not be mapped, or is not a
+ * valid wNAF table for this build.
+ */
+goldilocks_error_t goldilocks_448_precomputed_wnafs_map (
+    const goldilocks_448_precomputed_wnafs_s **table,
+    unsigned int *table_bits,
+    const char *path
+) GOLDILOCKS_API_VIS GOLDILOCKS_WARN_UNUSED GOLDILOCKS_NONNULL GOLDILOCKS_NOINLINE;
+
+/**
+ * @brief Unmap a table mapped by goldilocks_448_precomputed_map or
+ * goldilocks_448_precomputed_wnafs_map.
+ *
+ * @param [in] table The mapped table.
+ */
+void goldilocks_448_precomputed_unmap (
+    const void *table
+) GOLDILOCKS_API_VIS GOLDILOCKS_NONNULL GOLDILOCKS_NOINLINE;
+
 /**
  * @brief Constant-time decision between two points.  If pick_b
  * is zero, out = a; else out = b.
@@ -663,6 +1345,25 @@ void goldilocks_448_point_from_hash_uniform (
     const unsigned char hashed_data[2*GOLDILOCKS_448_HASH_BYTES]
 ) GOLDILOCKS_API_VIS GOLDILOCKS_NONNULL GOLDILOCKS_NOINLINE;
 
+/**
+ * @brief Hash many inputs to the curve, as goldilocks_448_point_from_hash_uniform
+ * does each one, and write them in compact affine form, with one field
+ * inversion shared among several points.  This is the point of the batch:
+ * the maps themselves cost the same as one call each.
+ *
+ * @param [out] points The points, or NULL if only the affine forms are wanted.
+ * @param [out] affine Their affine forms, or NULL if they are not wanted.
+ * @param [in] hashed_data n outputs of some hash function, each of
+ * 2*GOLDILOCKS_448_HASH_BYTES bytes, one after another.
+ * @param [in] n The number of inputs.
+ */
+void goldilocks_448_point_from_hash_uniform_batch (
+    goldilocks_448_point_s *points,
+    goldilocks_448_affine_point_s *affine,
+    const unsigned char *hashed_data,
+    size_t n
+) GOLDILOCKS_API_VIS GOLDILOCKS_NOINLINE;
+
 /**
  * @brief Inverse of elligator-like hash to curve.
  *
@@ -723,6 +1424,42 @@ goldilocks_448_invert_elligator_uniform (
     uint32_t which
 ) GOLDILOCKS_API_VIS GOLDILOCKS_NONNULL GOLDILOCKS_NOINLINE GOLDILOCKS_WARN_UNUSED;
 
+/**
+ * @brief Inverse of elligator-like hash to curve, for every "which" value
+ * at once.  This costs about as much as three calls to
+ * goldilocks_448_invert_elligator_nonuniform, instead of eight, because
+ * the hints share most of the work.
+ *
+ * @param [out] recovered_hashes For each "which" value, what
+ * goldilocks_448_invert_elligator_nonuniform would write.
+ * @param [in] pt The point to encode.
+ *
+ * @return A mask with bit "which" set if the inverse for that value succeeded.
+ */
+uint32_t
+goldilocks_448_invert_elligator_nonuniform_all (
+    unsigned char recovered_hashes[1<<GOLDILOCKS_448_INVERT_ELLIGATOR_WHICH_BITS][GOLDILOCKS_448_HASH_BYTES],
+    const goldilocks_448_point_p pt
+) GOLDILOCKS_API_VIS GOLDILOCKS_NONNULL GOLDILOCKS_NOINLINE GOLDILOCKS_WARN_UNUSED;
+
+/**
+ * @brief Inverse of elligator-like hash to curve, for every "which" value
+ * at once, with the second half of the hash fixed.
+ *
+ * @param [out] recovered_hashes For each "which" value, the first half of
+ * the hash, which goldilocks_448_invert_elligator_uniform would write.
+ * @param [in] pt The point to encode.
+ * @param [in] second_half The second half of the hash.
+ *
+ * @return A mask with bit "which" set if the inverse for that value succeeded.
+ */
+uint32_t
+goldilocks_448_invert_elligator_uniform_all (
+    unsigned char recovered_hashes[1<<GOLDILOCKS_448_INVERT_ELLIGATOR_WHICH_BITS][GOLDILOCKS_448_HASH_BYTES],
+    const goldilocks_448_point_p pt,
+    const unsigned char second_half[GOLDILOCKS_448_HASH_BYTES]
+) GOLDILOCKS_API_VIS GOLDILOCKS_NONNULL GOLDILOCKS_NOINLINE GOLDILOCKS_WARN_UNUSED;
+
 /** Securely erase a scalar. */
 void goldilocks_448_scalar_destroy (
     goldilocks_448_scalar_p scalar
@@ -735,6 +1472,13 @@ void goldilocks_448_point_destroy (
     goldilocks_448_point_p point
 ) GOLDILOCKS_NONNULL GOLDILOCKS_API_VIS;
 
+/** Securely erase a prepared point by overwriting it with zeros.
+ * @warning This causes the prepared point to become invalid.
+ */
+void goldilocks_448_prepared_point_destroy (
+    goldilocks_448_prepared_point_p prepared
+) GOLDILOCKS_NONNULL GOLDILOCKS_API_VIS;
+
 /** Securely erase a precomputed table by overwriting it with zeros.
  * @warning This causes the table object to become invalid.
  */
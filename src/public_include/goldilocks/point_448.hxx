@@ -67,6 +67,11 @@ static const int FIELD_MODULUS_TYPE = 3;
 /** @cond internal */
 class Point;
 class Precomputed;
+class ScaledPoint;
+class ScaledPrecomputed;
+class Addend;
+template<class Derived> class Expression;
+template<class L, class R> class Sum;
 /** @endcond */
 
 /**
@@ -127,6 +132,17 @@ public:
     /** Assignment. */
     inline Scalar& operator=(const Scalar &x) GOLDILOCKS_NOEXCEPT { goldilocks_448_scalar_copy(s,x.s); return *this; }
 
+#if __cplusplus >= 201103L
+    /** Move constructor.  Copies x, and then wipes it to zero. */
+    inline Scalar(Scalar &&x) GOLDILOCKS_NOEXCEPT { *this = static_cast<Scalar&&>(x); }
+
+    /** Move assignment.  Copies x, and then wipes it to zero. */
+    inline Scalar& operator=(Scalar &&x) GOLDILOCKS_NOEXCEPT {
+        if (&x != this) { goldilocks_448_scalar_copy(s,x.s); goldilocks_448_scalar_destroy(x.s); }
+        return *this;
+    }
+#endif
+
     /** Assign from unsigned 64-bit integer. */
     inline Scalar& operator=(uint64_t w) GOLDILOCKS_NOEXCEPT { goldilocks_448_scalar_set_unsigned(s,w); return *this; }
 
@@ -293,6 +309,17 @@ public:
     /** Assignment. */
     inline Point& operator=(const Point &q) GOLDILOCKS_NOEXCEPT { goldilocks_448_point_copy(p,q.p); return *this; }
 
+#if __cplusplus >= 201103L
+    /** Move constructor.  Copies q, and then resets it to the identity. */
+    inline Point(Point &&q) GOLDILOCKS_NOEXCEPT { *this = static_cast<Point&&>(q); }
+
+    /** Move assignment.  Copies q, and then resets it to the identity. */
+    inline Point& operator=(Point &&q) GOLDILOCKS_NOEXCEPT {
+        if (&q != this) { goldilocks_448_point_copy(p,q.p); goldilocks_448_point_copy(q.p,goldilocks_448_point_identity); }
+        return *this;
+    }
+#endif
+
     /** Destructor securely zeorizes the point. */
     inline ~Point() GOLDILOCKS_NOEXCEPT { goldilocks_448_point_destroy(p); }
 
@@ -445,9 +472,79 @@ public:
     /** Point subtract. */
     inline Point &operator-=(const Point &q) GOLDILOCKS_NOEXCEPT { goldilocks_448_point_sub(p,p,q.p); return *this; }
 
+    /** Point add, fused into the evaluation of e. */
+    template<class R> inline Sum<Addend,R> operator+ (const Expression<R> &e) const GOLDILOCKS_NOEXCEPT;
+
+    /** Point subtract, fused into the evaluation of e. */
+    template<class R> inline Sum<Addend,typename R::Negated> operator- (const Expression<R> &e) const GOLDILOCKS_NOEXCEPT;
+
     /** Point negate. */
     inline Point operator- () const GOLDILOCKS_NOEXCEPT { Point r((NOINIT())); goldilocks_448_point_negate(r.p,p); return r; }
 
+    /**
+     * A point prepared for repeated addition to other points.  Adding one
+     * is cheaper than adding a Point, but preparing it costs an inversion;
+     * Prepared::batch shares one inversion among many points.
+     */
+    class Prepared {
+    public:
+        /** Wrapped C type */
+        typedef goldilocks_448_prepared_point_p Wrapped;
+
+        /** The c-level object. */
+        Wrapped p;
+
+        /** @cond internal */
+        /** Don't initialize. */
+        inline Prepared(const NOINIT &) GOLDILOCKS_NOEXCEPT {}
+        /** @endcond */
+
+        /** Prepare a point; the identity by default. */
+        inline explicit Prepared(const Point &q = Point::identity()) GOLDILOCKS_NOEXCEPT {
+            goldilocks_448_point_prepare(p,q.p);
+        }
+
+        /** Copy constructor. */
+        inline Prepared(const Prepared &q) GOLDILOCKS_NOEXCEPT { *this = q; }
+
+        /** Assignment. */
+        inline Prepared& operator=(const Prepared &q) GOLDILOCKS_NOEXCEPT { p[0] = q.p[0]; return *this; }
+
+        /** Destructor securely zeorizes the prepared point. */
+        inline ~Prepared() GOLDILOCKS_NOEXCEPT { goldilocks_448_prepared_point_destroy(p); }
+
+        /** Prepare many points, with one inversion per batch. */
+        static inline std::vector<Prepared> batch(
+            const std::vector<Point> &points
+        ) /*throw(std::bad_alloc)*/ {
+            std::vector<Prepared> out;
+            if (points.empty()) return out;
+            std::vector<goldilocks_448_point_s, SanitizingAllocator<goldilocks_448_point_s, 32> > ps(points.size());
+            std::vector<goldilocks_448_prepared_point_s, SanitizingAllocator<goldilocks_448_prepared_point_s, 32> > pp(points.size());
+            for (size_t i=0; i<points.size(); i++) ps[i] = points[i].p[0];
+            goldilocks_448_point_prepare_batch(&pp[0],&ps[0],ps.size());
+            out.reserve(points.size());
+            for (size_t i=0; i<points.size(); i++) {
+                Prepared q((NOINIT()));
+                q.p[0] = pp[i];
+                out.push_back(q);
+            }
+            return out;
+        }
+    };
+
+    /** Add a prepared point. */
+    inline Point operator+ (const Prepared &q) const GOLDILOCKS_NOEXCEPT { Point r((NOINIT())); goldilocks_448_point_add_prepared(r.p,p,q.p); return r; }
+
+    /** Add a prepared point. */
+    inline Point &operator+=(const Prepared &q) GOLDILOCKS_NOEXCEPT { goldilocks_448_point_add_prepared(p,p,q.p); return *this; }
+
+    /** Subtract a prepared point. */
+    inline Point operator- (const Prepared &q) const GOLDILOCKS_NOEXCEPT { Point r((NOINIT())); goldilocks_448_point_sub_prepared(r.p,p,q.p); return r; }
+
+    /** Subtract a prepared point. */
+    inline Point &operator-=(const Prepared &q) GOLDILOCKS_NOEXCEPT { goldilocks_448_point_sub_prepared(p,p,q.p); return *this; }
+
     /** Double the point out of place. */
     inline Point times_two () const GOLDILOCKS_NOEXCEPT { Point r((NOINIT())); goldilocks_448_point_double(r.p,p); return r; }
 
@@ -463,9 +560,20 @@ public:
     /** Scalar multiply. */
     inline Point operator* (const Scalar &s) const GOLDILOCKS_NOEXCEPT { Point r((NOINIT())); goldilocks_448_point_scalarmul(r.p,p,s.s); return r; }
 
+    /** Scalar multiply, as a term of an Expression which fuses it with others when evaluated. */
+    inline ScaledPoint scaled_by (const Scalar &s) const GOLDILOCKS_NOEXCEPT;
+
     /** Scalar multiply in place. */
     inline Point &operator*=(const Scalar &s) GOLDILOCKS_NOEXCEPT { goldilocks_448_point_scalarmul(p,p,s.s); return *this; }
 
+    /**
+     * Scalar multiply, equivalent to this*s but faster.
+     * @warning This function takes variable time, and may leak the scalar.
+     */
+    inline Point mul_vartime(const Scalar &s) const GOLDILOCKS_NOEXCEPT {
+        Point r((NOINIT())); goldilocks_448_point_scalarmul_non_secret(r.p,p,s.s); return r;
+    }
+
     /** Multiply by s.inverse(). If s=0, maps to the identity. */
     inline Point operator/ (const Scalar &s) const /*throw(CryptoException)*/ { return (*this) * s.inverse(); }
 
@@ -482,6 +590,36 @@ public:
         Point p((NOINIT())); goldilocks_448_point_double_scalarmul(p.p,q.p,qs.s,r.p,rs.s); return p;
     }
 
+    /**
+     * Multi-scalar multiply, equivalent to the sum of points[i]*scalars[i] but faster.
+     * @throw LengthException if the vectors have different sizes.
+     */
+    static inline Point multiscalarmul (
+        const std::vector<Point> &points, const std::vector<Scalar> &scalars
+    ) /*throw(LengthException, std::bad_alloc)*/ {
+        if (points.size() != scalars.size()) throw LengthException();
+        Point r((NOINIT()));
+        if (points.empty()) return identity();
+        std::vector<goldilocks_448_point_s, SanitizingAllocator<goldilocks_448_point_s, 32> > ps(points.size());
+        std::vector<goldilocks_448_scalar_s, SanitizingAllocator<goldilocks_448_scalar_s, 0> > ss(scalars.size());
+        for (size_t i=0; i<points.size(); i++) {
+            ps[i] = points[i].p[0];
+            ss[i] = scalars[i].s[0];
+        }
+        goldilocks_448_point_multiscalarmul(r.p,&ps[0],&ss[0],ps.size());
+        return r;
+    }
+
+    /** Sum of the points; the identity if there are none. */
+    static inline Point sum(const std::vector<Point> &points) /*throw(std::bad_alloc)*/ {
+        if (points.empty()) return identity();
+        Point r((NOINIT()));
+        std::vector<goldilocks_448_point_s, SanitizingAllocator<goldilocks_448_point_s, 32> > ps(points.size());
+        for (size_t i=0; i<points.size(); i++) ps[i] = points[i].p[0];
+        goldilocks_448_point_sum(r.p,&ps[0],ps.size());
+        return r;
+    }
+
     /** Dual-scalar multiply, equivalent to this*r1, this*r2 but faster. */
     inline void dual_scalarmul (
         Point &q1, Point &q2, const Scalar &r1, const Scalar &r2
@@ -508,6 +646,17 @@ public:
         Point r((NOINIT())); goldilocks_448_base_double_scalarmul_non_secret(r.p,s_base.s,p,s.s); return r;
     }
 
+    /**
+     * Check whether this point times s plus base times s_base equals expected.
+     * Faster than comparing non_secret_combo_with_base against expected.
+     * @warning This function takes variable time, and may leak the scalars.
+     */
+    inline bool non_secret_combo_with_base_eq(
+        const Scalar &s, const Scalar &s_base, const Point &expected
+    ) const GOLDILOCKS_NOEXCEPT {
+        return goldilocks_448_base_double_scalarmul_non_secret_eq(s_base.s,p,s.s,expected.p);
+    }
+
     /** Return a point equal to *this, whose internal data is rotated by a torsion element. */
     inline Point debugging_torque() const GOLDILOCKS_NOEXCEPT {
         Point q;
@@ -554,7 +703,12 @@ public:
         return goldilocks_succeed_if(ret);
     }
 
-    /** Steganographically encode this */
+    /**
+     * Steganographically encode this.  Each attempt tries one random hint
+     * with fresh random bytes, which keeps the output uniform.  Trying all
+     * the hints at once (invert_elligator_uniform_all) would not make it
+     * cheaper, since a hint must then still be drawn at random.
+     */
     inline SecureBuffer steg_encode(Rng &rng, size_t size=STEG_BYTES) const /*throw(std::bad_alloc, LengthException)*/ {
         if (size <= HASH_BYTES + 4 || size > 2*HASH_BYTES) throw LengthException();
         SecureBuffer out(STEG_BYTES);
@@ -654,12 +808,65 @@ public:
     /** Fixed base scalarmul. */
     inline Point operator* (const Scalar &s) const GOLDILOCKS_NOEXCEPT { Point r; goldilocks_448_precomputed_scalarmul(r.p,get(),s.s); return r; }
 
+    /**
+     * Fixed base scalarmul, as a term of an Expression which fuses it with
+     * others when evaluated.  The table must outlive the Expression.
+     */
+    inline ScaledPrecomputed scaled_by (const Scalar &s) const GOLDILOCKS_NOEXCEPT;
+
     /** Multiply by s.inverse(). If s=0, maps to the identity. */
     inline Point operator/ (const Scalar &s) const /*throw(CryptoException)*/ { return (*this) * s.inverse(); }
 
+    /** Fixed base double-scalar multiply, equivalent to g*gs + h*hs but faster. */
+    static inline Point double_scalarmul (
+        const Precomputed &g, const Scalar &gs, const Precomputed &h, const Scalar &hs
+    ) GOLDILOCKS_NOEXCEPT {
+        Point r((NOINIT())); goldilocks_448_precomputed_double_scalarmul(r.p,g.get(),gs.s,h.get(),hs.s); return r;
+    }
+
+    /**
+     * Fixed base double-scalar multiply, equivalent to g*gs + h*hs but faster.
+     * For those who like their scalars before the point.
+     */
+    static inline Point double_scalarmul (
+        const Scalar &gs, const Precomputed &g, const Scalar &hs, const Precomputed &h
+    ) GOLDILOCKS_NOEXCEPT {
+        return double_scalarmul(g,gs,h,hs);
+    }
+
     /** Return the table for the base point. */
     static inline const Precomputed base() GOLDILOCKS_NOEXCEPT { return Precomputed(); }
 
+    /**
+     * Save the table to a file, for map().
+     * @throw CryptoException if the file could not be written.
+     */
+    inline void save(const std::string &path) const /*throw(CryptoException)*/ {
+        if (GOLDILOCKS_SUCCESS != goldilocks_448_precomputed_save(
+            path.c_str(),get(),&goldilocks_448_comb_geometry
+        )) throw CryptoException();
+    }
+
+    /**
+     * Map a table saved by save().  The mapping is shared between processes and
+     * stays in place for the life of the process.
+     * @throw CryptoException if the file is missing, or is not a valid table with
+     * this build's comb geometry.
+     */
+    static inline Precomputed map(const std::string &path) /*throw(CryptoException)*/ {
+        const Precomputed_U *table;
+        goldilocks_448_comb_geometry_s geometry;
+        if (GOLDILOCKS_SUCCESS != goldilocks_448_precomputed_map(&table,&geometry,path.c_str()))
+            throw CryptoException();
+        if (geometry.n != goldilocks_448_comb_geometry.n
+            || geometry.t != goldilocks_448_comb_geometry.t
+            || geometry.s != goldilocks_448_comb_geometry.s) {
+            goldilocks_448_precomputed_unmap(table);
+            throw CryptoException();
+        }
+        return Precomputed(*table);
+    }
+
 public:
     /** @cond internal */
     friend class OwnedOrUnowned<Precomputed,Precomputed_U>;
@@ -669,6 +876,204 @@ public:
     /** @endcond */
 };
 
+/** @cond internal */
+/** The terms of an Expression, gathered into the arrays which the C kernels take. */
+struct Terms {
+    goldilocks_448_point_s *points;
+    goldilocks_448_scalar_s *scalars;
+    size_t n_points;
+    const Precomputed_U **tables;
+    goldilocks_448_scalar_s *table_scalars;
+    size_t n_tables;
+    goldilocks_448_point_s *addends;
+    size_t n_addends;
+
+    /** Sum the terms into out, with the fewest kernel calls. */
+    inline void evaluate(Point &out, bool non_secret) const GOLDILOCKS_NOEXCEPT {
+        if (n_points == 0) {
+            goldilocks_448_point_copy(out.p,goldilocks_448_point_identity);
+        } else if (n_points == 1 && non_secret) {
+            goldilocks_448_point_scalarmul_non_secret(out.p,&points[0],&scalars[0]);
+        } else if (n_points == 1) {
+            goldilocks_448_point_scalarmul(out.p,&points[0],&scalars[0]);
+        } else if (n_points == 2) {
+            goldilocks_448_point_double_scalarmul(out.p,&points[0],&scalars[0],&points[1],&scalars[1]);
+        } else {
+            goldilocks_448_point_multiscalarmul(out.p,points,scalars,n_points);
+        }
+
+        Point r((NOINIT()));
+        for (size_t i=0; i+1<n_tables; i+=2) {
+            goldilocks_448_precomputed_double_scalarmul(
+                r.p,tables[i],&table_scalars[i],tables[i+1],&table_scalars[i+1]
+            );
+            goldilocks_448_point_add(out.p,out.p,r.p);
+        }
+        if (n_tables & 1) {
+            goldilocks_448_precomputed_scalarmul(r.p,tables[n_tables-1],&table_scalars[n_tables-1]);
+            goldilocks_448_point_add(out.p,out.p,r.p);
+        }
+
+        for (size_t i=0; i<n_addends; i++) {
+            goldilocks_448_point_add(out.p,out.p,&addends[i]);
+        }
+    }
+};
+/** @endcond */
+
+/**
+ * A sum of scalar multiples of points, which is computed only when it is
+ * converted to a Point.  Point::scaled_by and Precomputed::scaled_by build
+ * one of these, and so do sums and differences of them with each other and
+ * with Points, so that
+ *
+ *     Point r = P.scaled_by(a) + Q.scaled_by(b) - Precomputed::base().scaled_by(c);
+ *
+ * makes one call to goldilocks_448_point_double_scalarmul and one to
+ * goldilocks_448_precomputed_scalarmul.  In general the Point terms share
+ * one double or multi-scalar multiplication, the Precomputed terms are taken
+ * in pairs by goldilocks_448_precomputed_double_scalarmul, and plain Points
+ * are added at the end.
+ *
+ * The conversion takes constant time.  If the scalars are public,
+ * non_secret() may evaluate the expression faster in variable time.
+ *
+ * Expressions hold copies of their points and scalars, but only pointers to
+ * Precomputed tables, which must outlive them.  Each conversion evaluates the
+ * expression again, so convert it once and keep the Point.
+ */
+template<class Derived> class Expression {
+public:
+    /** Evaluate in constant time. */
+    inline operator Point() const GOLDILOCKS_NOEXCEPT { return evaluate(false); }
+
+    /**
+     * Evaluate, equivalent to converting to Point but perhaps faster.
+     * @warning This function takes variable time, and may leak the scalars.
+     */
+    inline Point non_secret() const GOLDILOCKS_NOEXCEPT { return evaluate(true); }
+
+    /** Sum of two expressions. */
+    template<class R> inline Sum<Derived,R> operator+ (const Expression<R> &e) const GOLDILOCKS_NOEXCEPT {
+        return Sum<Derived,R>(self(),static_cast<const R&>(e));
+    }
+
+    /** Difference of two expressions. */
+    template<class R> inline Sum<Derived,typename R::Negated> operator- (const Expression<R> &e) const GOLDILOCKS_NOEXCEPT {
+        return Sum<Derived,typename R::Negated>(self(),static_cast<const R&>(e).negate());
+    }
+
+    /** Add a point. */
+    inline Sum<Derived,Addend> operator+ (const Point &q) const GOLDILOCKS_NOEXCEPT;
+
+    /** Subtract a point. */
+    inline Sum<Derived,Addend> operator- (const Point &q) const GOLDILOCKS_NOEXCEPT;
+
+    /** Evaluate and compare in constant time. */
+    inline bool operator==(const Point &q) const GOLDILOCKS_NOEXCEPT { return evaluate(false) == q; }
+
+    /** Evaluate and compare in constant time. */
+    inline bool operator!=(const Point &q) const GOLDILOCKS_NOEXCEPT { return evaluate(false) != q; }
+
+private:
+    inline const Derived &self() const GOLDILOCKS_NOEXCEPT { return static_cast<const Derived&>(*this); }
+
+    inline Point evaluate(bool non_secret) const GOLDILOCKS_NOEXCEPT {
+        goldilocks_448_point_s points[Derived::POINTS+1], addends[Derived::ADDENDS+1];
+        goldilocks_448_scalar_s scalars[Derived::POINTS+1], table_scalars[Derived::TABLES+1];
+        const Precomputed_U *tables[Derived::TABLES+1];
+        Terms t = { points, scalars, 0, tables, table_scalars, 0, addends, 0 };
+        self().gather(t);
+
+        Point r((NOINIT()));
+        t.evaluate(r,non_secret);
+        goldilocks_bzero(points,sizeof(points));
+        goldilocks_bzero(scalars,sizeof(scalars));
+        goldilocks_bzero(table_scalars,sizeof(table_scalars));
+        goldilocks_bzero(addends,sizeof(addends));
+        return r;
+    }
+};
+
+/** A point times a scalar, as an Expression. */
+class ScaledPoint : public Expression<ScaledPoint> {
+public:
+    /** @cond internal */
+    typedef ScaledPoint Negated;
+    static const size_t POINTS = 1, TABLES = 0, ADDENDS = 0;
+    inline ScaledPoint(const Point &q, const Scalar &s) GOLDILOCKS_NOEXCEPT : q(q), s(s) {}
+    inline Negated negate() const GOLDILOCKS_NOEXCEPT { return ScaledPoint(q,-s); }
+    using Expression<ScaledPoint>::operator-;
+    inline void gather(Terms &t) const GOLDILOCKS_NOEXCEPT {
+        t.points[t.n_points] = q.p[0];
+        t.scalars[t.n_points++] = s.s[0];
+    }
+    /** @endcond */
+
+    /** Negate the expression. */
+    inline Negated operator- () const GOLDILOCKS_NOEXCEPT { return negate(); }
+private:
+    Point q;
+    Scalar s;
+};
+
+/** A precomputed point times a scalar, as an Expression. */
+class ScaledPrecomputed : public Expression<ScaledPrecomputed> {
+public:
+    /** @cond internal */
+    typedef ScaledPrecomputed Negated;
+    static const size_t POINTS = 0, TABLES = 1, ADDENDS = 0;
+    inline ScaledPrecomputed(const Precomputed_U *table, const Scalar &s) GOLDILOCKS_NOEXCEPT : table(table), s(s) {}
+    inline Negated negate() const GOLDILOCKS_NOEXCEPT { return ScaledPrecomputed(table,-s); }
+    using Expression<ScaledPrecomputed>::operator-;
+    inline void gather(Terms &t) const GOLDILOCKS_NOEXCEPT {
+        t.tables[t.n_tables] = table;
+        t.table_scalars[t.n_tables++] = s.s[0];
+    }
+    /** @endcond */
+
+    /** Negate the expression. */
+    inline Negated operator- () const GOLDILOCKS_NOEXCEPT { return negate(); }
+private:
+    const Precomputed_U *table;
+    Scalar s;
+};
+
+/** @cond internal */
+/** A point added to an Expression. */
+class Addend {
+public:
+    typedef Addend Negated;
+    static const size_t POINTS = 0, TABLES = 0, ADDENDS = 1;
+    inline explicit Addend(const Point &q) GOLDILOCKS_NOEXCEPT : q(q) {}
+    inline Negated negate() const GOLDILOCKS_NOEXCEPT { return Addend(-q); }
+    inline void gather(Terms &t) const GOLDILOCKS_NOEXCEPT { t.addends[t.n_addends++] = q.p[0]; }
+private:
+    Point q;
+};
+/** @endcond */
+
+/** A sum of two Expressions, or of an Expression and a Point. */
+template<class L, class R> class Sum : public Expression<Sum<L,R> > {
+public:
+    /** @cond internal */
+    typedef Sum<typename L::Negated, typename R::Negated> Negated;
+    static const size_t POINTS = L::POINTS + R::POINTS;
+    static const size_t TABLES = L::TABLES + R::TABLES;
+    static const size_t ADDENDS = L::ADDENDS + R::ADDENDS;
+    inline Sum(const L &l, const R &r) GOLDILOCKS_NOEXCEPT : l(l), r(r) {}
+    inline Negated negate() const GOLDILOCKS_NOEXCEPT { return Negated(l.negate(),r.negate()); }
+    using Expression<Sum<L,R> >::operator-;
+    inline void gather(Terms &t) const GOLDILOCKS_NOEXCEPT { l.gather(t); r.gather(t); }
+    /** @endcond */
+
+    /** Negate the expression. */
+    inline Negated operator- () const GOLDILOCKS_NOEXCEPT { return negate(); }
+private:
+    L l;
+    R r;
+};
+
 /** X-only Diffie-Hellman ladder functions */
 struct DhLadder {
 public:
@@ -753,6 +1158,42 @@ inline goldilocks_error_t Ed448Goldilocks::Scalar::direct_scalarmul_noexcept (
 ) const GOLDILOCKS_NOEXCEPT {
     return goldilocks_448_direct_scalarmul(out.data(), in.data(), s, allow_identity, short_circuit);
 }
+
+inline Ed448Goldilocks::ScaledPoint Ed448Goldilocks::Point::scaled_by (
+    const Ed448Goldilocks::Scalar &s
+) const GOLDILOCKS_NOEXCEPT {
+    return ScaledPoint(*this,s);
+}
+
+inline Ed448Goldilocks::ScaledPrecomputed Ed448Goldilocks::Precomputed::scaled_by (
+    const Ed448Goldilocks::Scalar &s
+) const GOLDILOCKS_NOEXCEPT {
+    return ScaledPrecomputed(get(),s);
+}
+
+template<class R> inline Ed448Goldilocks::Sum<Ed448Goldilocks::Addend,R> Ed448Goldilocks::Point::operator+ (
+    const Ed448Goldilocks::Expression<R> &e
+) const GOLDILOCKS_NOEXCEPT {
+    return Sum<Addend,R>(Addend(*this),static_cast<const R&>(e));
+}
+
+template<class R> inline Ed448Goldilocks::Sum<Ed448Goldilocks::Addend,typename R::Negated> Ed448Goldilocks::Point::operator- (
+    const Ed448Goldilocks::Expression<R> &e
+) const GOLDILOCKS_NOEXCEPT {
+    return Sum<Addend,typename R::Negated>(Addend(*this),static_cast<const R&>(e).negate());
+}
+
+template<class Derived> inline Ed448Goldilocks::Sum<Derived,Ed448Goldilocks::Addend> Ed448Goldilocks::Expression<Derived>::operator+ (
+    const Ed448Goldilocks::Point &q
+) const GOLDILOCKS_NOEXCEPT {
+    return Sum<Derived,Addend>(self(),Addend(q));
+}
+
+template<class Derived> inline Ed448Goldilocks::Sum<Derived,Ed448Goldilocks::Addend> Ed448Goldilocks::Expression<Derived>::operator- (
+    const Ed448Goldilocks::Point &q
+) const GOLDILOCKS_NOEXCEPT {
+    return Sum<Derived,Addend>(self(),Addend(-q));
+}
 /** @endcond */
 
 
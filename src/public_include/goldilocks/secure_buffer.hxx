@@ -12,13 +12,24 @@
 #ifndef __GOLDILOCKS_SECURE_BUFFER_HXX__
 #define __GOLDILOCKS_SECURE_BUFFER_HXX__ 1
 
+#include <goldilocks/spongerng.h>
 #include <string>
 #include <sys/types.h>
+#include <stdlib.h>
 #include <stdio.h>
 #include <vector>
 #include <stdexcept>
 #include <cstddef>
 #include <limits>
+#if __cplusplus >= 201103L
+#include <array>
+#endif
+#if __cplusplus >= 202002L && defined(__has_include)
+#if __has_include(<span>)
+#include <span>
+#define GOLDILOCKS_HAVE_SPAN 1
+#endif
+#endif
 
 /** @cond internal */
 #if __cplusplus >= 201103L
@@ -37,7 +48,11 @@ namespace goldilocks {
 */
 static inline void really_bzero(void *data, size_t size) { goldilocks_bzero(data,size); }
 
-/** @brief An allocator which zeros its memory on free */
+/**
+ * @brief An allocator which zeros its memory on free.  Small allocations
+ * come from goldilocks_secure_alloc's pool, which is kept out of swap and
+ * core dumps.
+ */
 template<typename T, size_t alignment = 0> class SanitizingAllocator {
 /** @cond internal */
 /* Based on http://www.codeproject.com/Articles/4795/C-Standard-Allocator-An-Introduction-and-Implement */
@@ -50,7 +65,7 @@ public:
    typedef size_t size_type;
    typedef std::ptrdiff_t difference_type;
    
-   template<typename U> struct rebind { typedef SanitizingAllocator<U> other; };
+   template<typename U> struct rebind { typedef SanitizingAllocator<U, alignment> other; };
    inline SanitizingAllocator() GOLDILOCKS_NOEXCEPT {}
    inline ~SanitizingAllocator() GOLDILOCKS_NOEXCEPT {}
    inline SanitizingAllocator(const SanitizingAllocator &) GOLDILOCKS_NOEXCEPT {}
@@ -60,7 +75,7 @@ public:
    inline const T* address(const T& r) const GOLDILOCKS_NOEXCEPT { return &r; }
    inline T* allocate (
        size_type cnt,
-       typename std::allocator<void>::const_pointer = 0
+       const void * = 0
     ) /*throw(std::bad_alloc)*/;
    inline void deallocate(T* p, size_t size) GOLDILOCKS_NOEXCEPT;
    inline size_t max_size() const GOLDILOCKS_NOEXCEPT { return std::numeric_limits<size_t>::max() / sizeof(T); }
@@ -82,6 +97,13 @@ inline bool memeq(const std::vector<T,U> &a, const std::vector<V,W> &b) {
     return goldilocks_memeq(a.data(),b.data(),a.size());
 }
 
+/** @brief Passed to constructors to avoid (conservative) initialization */
+struct NOINIT {};
+
+/**@cond internal*/
+template<size_t Size> class FixedArrayBuffer;
+/**@endcond*/
+
 /** Base class of objects which support serialization */
 template<class Base> class Serializable {
 public:
@@ -105,6 +127,14 @@ public:
     explicit inline operator SecureBuffer() const /*throw(std::bad_alloc)*/ {
         return serialize();
     }
+
+    /** @brief Serialize this object into a buffer on the stack and return it */
+    template<class B = Base>
+    inline FixedArrayBuffer<B::SER_BYTES> serialize_fixed() const GOLDILOCKS_NOEXCEPT {
+        FixedArrayBuffer<B::SER_BYTES> out((NOINIT()));
+        serialize_into(out.data());
+        return out;
+    }
 #endif
 };
 
@@ -126,9 +156,6 @@ public:
     virtual const char * what() const GOLDILOCKS_NOEXCEPT { return "LengthException"; }
 };
 
-/** @brief Passed to constructors to avoid (conservative) initialization */
-struct NOINIT {};
-
 /** @brief Prototype of a random number generator.
  * FUTURE: Are the noexcept methods really noexcept?  What about self-reseeding RNGs?
  */
@@ -149,6 +176,9 @@ public:
 
     /** @brief Read into a SecureBuffer. */
     inline SecureBuffer read(size_t length) /*throw(std::bad_alloc)*/;
+
+    /** @brief The calling thread's default RNG; see ThreadRng. */
+    static inline Rng &thread_default() GOLDILOCKS_NOEXCEPT;
 };
 
 
@@ -186,6 +216,22 @@ public:
     template<class alloc> inline Block(const std::vector<unsigned char,alloc> &s)
         : data_(((unsigned char *)&(s)[0])), size_(s.size()), zero_on_destroy_(false) {}
 
+    /** Block from a C array */
+    template<size_t Size> inline Block(const unsigned char (&s)[Size]) GOLDILOCKS_NOEXCEPT
+        : data_((unsigned char *)s), size_(Size), zero_on_destroy_(false) {}
+
+#if __cplusplus >= 201103L
+    /** Block from std::array */
+    template<size_t Size> inline Block(const std::array<unsigned char,Size> &s) GOLDILOCKS_NOEXCEPT
+        : data_((unsigned char *)s.data()), size_(Size), zero_on_destroy_(false) {}
+#endif
+
+#ifdef GOLDILOCKS_HAVE_SPAN
+    /** Block from std::span */
+    inline Block(std::span<const unsigned char> s) GOLDILOCKS_NOEXCEPT
+        : data_((unsigned char *)s.data()), size_(s.size()), zero_on_destroy_(false) {}
+#endif
+
     /** Get const data */
     inline const unsigned char *data() const GOLDILOCKS_NOEXCEPT { return data_; }
     
@@ -269,6 +315,19 @@ public:
     /** Block from std::vector */
     template<class alloc> inline Buffer(std::vector<unsigned char,alloc> &s) : Block(s) {}
 
+    /** Buffer from a C array */
+    template<size_t Size> inline Buffer(unsigned char (&s)[Size]) GOLDILOCKS_NOEXCEPT : Block(s,Size) {}
+
+#if __cplusplus >= 201103L
+    /** Buffer from std::array */
+    template<size_t Size> inline Buffer(std::array<unsigned char,Size> &s) GOLDILOCKS_NOEXCEPT : Block(s.data(),Size) {}
+#endif
+
+#ifdef GOLDILOCKS_HAVE_SPAN
+    /** Buffer from std::span */
+    inline Buffer(std::span<unsigned char> s) GOLDILOCKS_NOEXCEPT : Block(s.data(),s.size()) {}
+#endif
+
     /** Get const data */
     inline const unsigned char *data() const GOLDILOCKS_NOEXCEPT { return data_; }
 
@@ -357,7 +416,7 @@ public:
     
     /** Copy operator */
     inline FixedArrayBuffer& operator=(const Block &b) /*throw(LengthException)*/ {
-        *this = FixedBlock<Size>(b);
+        return *this = FixedBlock<Size>(b);
     }
     
     /** Copy constructor */
@@ -370,6 +429,20 @@ public:
     inline explicit FixedArrayBuffer(const FixedArrayBuffer<Size> &b) GOLDILOCKS_NOEXCEPT : FixedBuffer<Size>(storage,true) {
         memcpy(storage,b.data(),Size);
     }
+
+#if __cplusplus >= 201103L
+    /** Move constructor.  The contents are copied, and b is zeroized. */
+    inline FixedArrayBuffer(FixedArrayBuffer<Size> &&b) GOLDILOCKS_NOEXCEPT : FixedBuffer<Size>(storage,true) {
+        memcpy(storage,b.data(),Size);
+        b.zeroize();
+    }
+
+    /** Move operator.  The contents are copied, and b is zeroized. */
+    inline FixedArrayBuffer& operator=(FixedArrayBuffer<Size> &&b) GOLDILOCKS_NOEXCEPT {
+        if (&b != this) { memcpy(storage,b.data(),Size); b.zeroize(); }
+        return *this;
+    }
+#endif
     
     /** Destroy the buffer */
     ~FixedArrayBuffer() GOLDILOCKS_NOEXCEPT { zeroize(); }
@@ -386,6 +459,33 @@ inline SecureBuffer Rng::read(size_t length) /*throw(std::bad_alloc)*/ {
 }
 /** @endcond */
 
+/**
+ * @brief The calling thread's default RNG, which needs no setup.
+ * See goldilocks_spongerng_thread_next.  The state is per thread, not per
+ * object, so ThreadRng objects can be made freely.
+ */
+class ThreadRng : public Rng {
+public:
+    /** Nothing to initialize. */
+    inline ThreadRng() {}
+
+    using Rng::read;
+
+    /** Read data to a buffer.  Aborts if the system can't seed the RNG. */
+    virtual inline void read(Buffer buffer) GOLDILOCKS_NOEXCEPT {
+        if (!goldilocks_successful(goldilocks_spongerng_thread_next(buffer.data(),buffer.size()))) {
+            abort();
+        }
+    }
+};
+
+/** @cond internal */
+inline Rng &Rng::thread_default() GOLDILOCKS_NOEXCEPT {
+    static ThreadRng rng;
+    return rng;
+}
+/** @endcond */
+
 /** @cond internal */
 /** A secure buffer which stores an owned or unowned underlying value.
  * If it is owned, it will be securely zeroed.
@@ -401,16 +501,15 @@ protected:
 
     inline void clear() GOLDILOCKS_NOEXCEPT {
         if (is_mine) {
-            really_bzero(ours.mine, T::size());
-            free(ours.mine);
+            goldilocks_secure_free(ours.mine, T::size());
             ours.yours = T::default_value();
             is_mine = false;
         }
     }
     inline void alloc() /*throw(std::bad_alloc)*/ {
         if (is_mine) return;
-        int ret = posix_memalign((void**)&ours.mine, T::alignment(), T::size());
-        if (ret || !ours.mine) {
+        ours.mine = static_cast<Wrapped *>(goldilocks_secure_alloc(T::size(), T::alignment()));
+        if (!ours.mine) {
             is_mine = false;
             throw std::bad_alloc();
         }
@@ -463,23 +562,17 @@ protected:
 template<typename T, size_t alignment>
 T* SanitizingAllocator<T,alignment>::allocate (
     size_type cnt, 
-    typename std::allocator<void>::const_pointer
+    const void *
 ) /*throw(std::bad_alloc)*/ { 
-    void *v;
-    int ret = 0;
- 
-    if (alignment) ret = posix_memalign(&v, alignment, cnt * sizeof(T));
-    else v = malloc(cnt * sizeof(T));
- 
-    if (ret || v==NULL) throw(std::bad_alloc());
+    if (cnt > max_size()) throw(std::bad_alloc());
+    void *v = goldilocks_secure_alloc(cnt * sizeof(T), alignment);
+    if (v==NULL) throw(std::bad_alloc());
     return reinterpret_cast<T*>(v);
 }
 
 template<typename T, size_t alignment>
 void SanitizingAllocator<T,alignment>::deallocate(T* p, size_t size) GOLDILOCKS_NOEXCEPT {
-    if (p==NULL) return;
-    really_bzero(reinterpret_cast<void*>(p), size);
-    free(reinterpret_cast<void*>(p));
+    goldilocks_secure_free(reinterpret_cast<void*>(p), size * sizeof(T));
 }
 
 /** @endcond */
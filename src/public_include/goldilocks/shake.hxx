@@ -84,6 +84,15 @@ public:
         }
     }
 
+#if __cplusplus >= 201103L
+    /** @brief Output Size bytes from the sponge into a buffer on the stack. */
+    template<size_t Size> inline FixedArrayBuffer<Size> output_fixed() /*throw(LengthException)*/ {
+        FixedArrayBuffer<Size> out((NOINIT()));
+        output(out);
+        return out;
+    }
+#endif
+
     /**  @brief Output bytes from the sponge and reinitialize it.  Throw
      * LengthException if you've output too many bytes from a SHA3 instance.
      */
@@ -27,6 +27,39 @@ typedef struct {
 /** Keccak CSPRNG structure as one-element array */
 typedef goldilocks_keccak_prng_s goldilocks_keccak_prng_p[1];
 
+/** Most output that a buffered sponge RNG squeezes at once: four SHAKE256 blocks. */
+#define GOLDILOCKS_SPONGERNG_BUFFER_BYTES 544
+
+/**
+ * Buffered Keccak CSPRNG.  This is opaque, so that its layout may change,
+ * and is allocated by goldilocks_spongerng_buffered_new.
+ */
+typedef struct goldilocks_spongerng_buffered_s goldilocks_spongerng_buffered_s;
+
+/**
+ * Output block size of a counter-mode RNG.  This is less than the SHAKE256
+ * rate, so that each block costs one Keccak permutation.
+ */
+#define GOLDILOCKS_SPONGERNG_CTR_BLOCK_BYTES 128
+
+/**
+ * Seekable deterministic RNG structure as struct.  Its output is a
+ * function of (seed, stream, position), so one seed can be split into
+ * independent streams, and each stream read from anywhere.
+ */
+typedef struct {
+    /** @cond internal */
+    uint8_t key[32];        /**< Derived from the seed. */
+    uint64_t stream;        /**< Stream number. */
+    uint64_t position;      /**< Offset of the next output byte. */
+    uint64_t cached;        /**< 1 + the index of the block in block[], or 0. */
+    uint8_t block[GOLDILOCKS_SPONGERNG_CTR_BLOCK_BYTES]; /**< Output block. */
+    /** @endcond */
+} goldilocks_spongerng_ctr_s;
+
+/** Seekable deterministic RNG structure as one-element array */
+typedef goldilocks_spongerng_ctr_s goldilocks_spongerng_ctr_p[1];
+
 /** Initialize a sponge-based CSPRNG from a buffer. */
 void goldilocks_spongerng_init_from_buffer (
     goldilocks_keccak_prng_p prng,             /**< [out] The PRNG object. */
@@ -65,6 +98,74 @@ void goldilocks_spongerng_next (
     size_t len                  /**< [in]    Number of bytes to output. */
 ) GOLDILOCKS_API_VIS;
 
+/**
+ * @brief Make a buffered CSPRNG from a sponge-based one.
+ *
+ * The buffered RNG squeezes rekey_bytes of output at a time, and then
+ * re-keys the sponge from its own output, so that its state can no longer
+ * reproduce them.  Reads are served from the buffer, and each byte is
+ * erased as it is handed out.  This is much faster for small reads than
+ * goldilocks_spongerng_next, which re-keys after every read.
+ *
+ * A nondeterministic RNG stirs in CPU entropy once per re-key instead of
+ * once per read.  It also reseeds itself from getrandom(2), or from
+ * /dev/urandom where that isn't available, after reseed_bytes bytes of
+ * output or reseed_seconds seconds, whichever comes first; zero disables
+ * either trigger.  If neither can be read, the reseed only stirs in CPU
+ * entropy.
+ *
+ * A deterministic RNG never reseeds, but its buffered output differs from
+ * the output of goldilocks_spongerng_next.
+ *
+ * @return The new RNG, which is kept in secure memory (see
+ * goldilocks_secure_alloc), or NULL if it can't be allocated.  Either way
+ * prng is destroyed.
+ */
+goldilocks_spongerng_buffered_s *goldilocks_spongerng_buffered_new (
+    goldilocks_keccak_prng_p prng, /**< [inout] The initialized PRNG object to take over. */
+    size_t rekey_bytes,     /**< [in] Bytes squeezed per re-key, from 1 to GOLDILOCKS_SPONGERNG_BUFFER_BYTES. */
+    size_t reseed_bytes,    /**< [in] Output bytes between reseeds, or 0 for no limit. */
+    unsigned reseed_seconds /**< [in] Seconds between reseeds, or 0 for no limit. */
+) GOLDILOCKS_NONNULL GOLDILOCKS_API_VIS GOLDILOCKS_WARN_UNUSED;
+
+/** Output bytes from a buffered CSPRNG. */
+void goldilocks_spongerng_buffered_next (
+    goldilocks_spongerng_buffered_s *rng, /**< [inout] The PRNG object. */
+    uint8_t * __restrict__ out,           /**< [out]   Output buffer. */
+    size_t len                            /**< [in]    Number of bytes to output. */
+) GOLDILOCKS_NONNULL GOLDILOCKS_API_VIS;
+
+/** Stir entropy into a buffered CSPRNG, and discard its buffered output. */
+void goldilocks_spongerng_buffered_stir (
+    goldilocks_spongerng_buffered_s *rng, /**< [inout] The PRNG object. */
+    const uint8_t * __restrict__ in,      /**< [in] The entropy data. */
+    size_t len                            /**< [in] The length of the initial data. */
+) GOLDILOCKS_NONNULL GOLDILOCKS_API_VIS;
+
+/** Securely destroy and free a buffered CSPRNG.  Does nothing if doomed is NULL. */
+void goldilocks_spongerng_buffered_destroy (
+    goldilocks_spongerng_buffered_s *doomed /**< [in] The object to destroy. */
+) GOLDILOCKS_API_VIS;
+
+/**
+ * @brief Output bytes from the calling thread's default RNG.
+ *
+ * This is a nondeterministic buffered sponge RNG (see
+ * goldilocks_spongerng_buffered_new) which each thread seeds on first use
+ * from getrandom(2), or /dev/urandom without it.  It takes no locks and
+ * holds no file descriptors.  It reseeds itself from the system
+ * periodically, and in a child process after fork().  Its state is wiped
+ * when the thread exits.
+ *
+ * @retval GOLDILOCKS_SUCCESS success.
+ * @retval GOLDILOCKS_FAILURE the system RNG couldn't seed it.  The output
+ * is then all zeros.
+ */
+goldilocks_error_t goldilocks_spongerng_thread_next (
+    uint8_t * __restrict__ out, /**< [out] Output buffer. */
+    size_t len                  /**< [in]  Number of bytes to output. */
+) GOLDILOCKS_API_VIS GOLDILOCKS_WARN_UNUSED;
+
 /** Stir entropy data into a sponge-based CSPRNG from a buffer.  */
 void goldilocks_spongerng_stir (
     goldilocks_keccak_prng_p prng,              /**< [out] The PRNG object. */
@@ -72,12 +173,46 @@ void goldilocks_spongerng_stir (
     size_t len                       /**< [in]  The length of the initial data. */
 ) GOLDILOCKS_NONNULL GOLDILOCKS_API_VIS;
 
+/**
+ * @brief Initialize a seekable deterministic RNG at the start of a stream.
+ *
+ * Block i of stream s is the first GOLDILOCKS_SPONGERNG_CTR_BLOCK_BYTES
+ * bytes of SHAKE256(key || s || i), with s and i as 64-bit little-endian
+ * integers, and key the first 32 bytes of
+ * SHAKE256("goldilocks_spongerng_ctr" || seed).
+ */
+void goldilocks_spongerng_ctr_init (
+    goldilocks_spongerng_ctr_p ctr, /**< [out] The RNG object. */
+    const uint8_t *seed,            /**< [in]  The seed. */
+    size_t seed_len,                /**< [in]  The length of the seed. */
+    uint64_t stream                 /**< [in]  The stream number. */
+) GOLDILOCKS_NONNULL GOLDILOCKS_API_VIS;
+
+/** Move a seekable deterministic RNG to a byte offset in its stream. */
+void goldilocks_spongerng_ctr_seek (
+    goldilocks_spongerng_ctr_p ctr, /**< [inout] The RNG object. */
+    uint64_t position               /**< [in]    The offset of the next output byte. */
+) GOLDILOCKS_NONNULL GOLDILOCKS_API_VIS;
+
+/** Output bytes from a seekable deterministic RNG, and advance its position. */
+void goldilocks_spongerng_ctr_next (
+    goldilocks_spongerng_ctr_p ctr, /**< [inout] The RNG object. */
+    uint8_t * __restrict__ out,     /**< [out]   Output buffer. */
+    size_t len                      /**< [in]    Number of bytes to output. */
+) GOLDILOCKS_API_VIS;
+
 /** Securely destroy a sponge RNG object by overwriting it. */
 static GOLDILOCKS_INLINE void
 goldilocks_spongerng_destroy (
     goldilocks_keccak_prng_p doomed /**< [in] The object to destroy. */
 );
 
+/** Securely destroy a seekable deterministic RNG object by overwriting it. */
+static GOLDILOCKS_INLINE void
+goldilocks_spongerng_ctr_destroy (
+    goldilocks_spongerng_ctr_p doomed /**< [in] The object to destroy. */
+);
+
 /** @cond internal */
 /***************************************/
 /* Implementations of inline functions */
@@ -85,6 +220,9 @@ goldilocks_spongerng_destroy (
 void goldilocks_spongerng_destroy (goldilocks_keccak_prng_p doomed) {
     goldilocks_sha3_destroy(doomed->sponge);
 }
+void goldilocks_spongerng_ctr_destroy (goldilocks_spongerng_ctr_p doomed) {
+    goldilocks_bzero(doomed,sizeof(*doomed));
+}
 /** @endcond */ /* internal */
 
 #ifdef __cplusplus
@@ -18,6 +18,7 @@
 #include <goldilocks/spongerng.h>
 
 #include <string>
+#include <new>
 #include <sys/types.h>
 #include <errno.h>
 
@@ -93,6 +94,123 @@ private:
     SpongeRng(const SpongeRng &) GOLDILOCKS_DELETE;
     SpongeRng &operator=(const SpongeRng &) GOLDILOCKS_DELETE;
 };
+
+/**
+ * Sponge-based random-number generator which hands out output from a
+ * buffer, re-keying every rekey_bytes bytes, and reseeding a
+ * nondeterministic RNG after reseed_bytes bytes or reseed_seconds seconds.
+ * This is much faster than SpongeRng for small reads.  See
+ * goldilocks_spongerng_buffered_new.
+ */
+class BufferedSpongeRng : public Rng {
+private:
+    /** C wrapped object */
+    goldilocks_spongerng_buffered_s *sp;
+
+    /** @cond internal */
+    inline void take(
+        goldilocks_keccak_prng_p prng, size_t rekey_bytes, size_t reseed_bytes, unsigned reseed_seconds
+    ) /*throw(std::bad_alloc)*/ {
+        sp = goldilocks_spongerng_buffered_new(prng,rekey_bytes,reseed_bytes,reseed_seconds);
+        if (!sp) throw std::bad_alloc();
+    }
+    /** @endcond */
+
+public:
+    /** Initialize, deterministically by default, from block */
+    inline BufferedSpongeRng(
+        const Block &in,
+        SpongeRng::Deterministic det,
+        size_t rekey_bytes = GOLDILOCKS_SPONGERNG_BUFFER_BYTES,
+        size_t reseed_bytes = 0,
+        unsigned reseed_seconds = 0
+    ) /*throw(std::bad_alloc)*/ {
+        goldilocks_keccak_prng_p prng;
+        goldilocks_spongerng_init_from_buffer(prng,in.data(),in.size(),(int)det);
+        take(prng,rekey_bytes,reseed_bytes,reseed_seconds);
+    }
+
+    /** Initialize, non-deterministically by default, from C/C++ filename */
+    inline BufferedSpongeRng(
+        const std::string &in = "/dev/urandom",
+        size_t len = 32,
+        SpongeRng::Deterministic det = SpongeRng::RANDOM,
+        size_t rekey_bytes = GOLDILOCKS_SPONGERNG_BUFFER_BYTES,
+        size_t reseed_bytes = 0,
+        unsigned reseed_seconds = 0
+    ) /*throw(SpongeRng::RngException, std::bad_alloc)*/ {
+        goldilocks_keccak_prng_p prng;
+        goldilocks_error_t ret = goldilocks_spongerng_init_from_file(prng,in.c_str(),len,det);
+        if (!goldilocks_successful(ret)) {
+            goldilocks_spongerng_destroy(prng);
+            throw SpongeRng::RngException(errno, "Couldn't load from file");
+        }
+        take(prng,rekey_bytes,reseed_bytes,reseed_seconds);
+    }
+
+    /** Stir in new data, discarding any buffered output */
+    inline void stir( const Block &data ) GOLDILOCKS_NOEXCEPT {
+        goldilocks_spongerng_buffered_stir(sp,data.data(),data.size());
+    }
+
+    /** Securely destroy by overwriting state. */
+    inline ~BufferedSpongeRng() GOLDILOCKS_NOEXCEPT { goldilocks_spongerng_buffered_destroy(sp); }
+
+    using Rng::read;
+
+    /** Read data to a buffer. */
+    virtual inline void read(Buffer buffer) GOLDILOCKS_NOEXCEPT
+#if __cplusplus >= 201103L
+        final
+#endif
+        { goldilocks_spongerng_buffered_next(sp,buffer.data(),buffer.size()); }
+
+private:
+    BufferedSpongeRng(const BufferedSpongeRng &) GOLDILOCKS_DELETE;
+    BufferedSpongeRng &operator=(const BufferedSpongeRng &) GOLDILOCKS_DELETE;
+};
+
+/**
+ * Seekable deterministic RNG, for reproducible inputs which several
+ * threads generate at once.  Its output depends only on the seed, the
+ * stream number and the position, so each thread can take its own stream,
+ * or its own part of one stream.
+ */
+class CounterRng : public Rng {
+private:
+    /** C wrapped object */
+    goldilocks_spongerng_ctr_p sp;
+
+public:
+    /** Initialize at the start of stream number stream */
+    inline CounterRng( const Block &seed, uint64_t stream = 0 ) GOLDILOCKS_NOEXCEPT {
+        goldilocks_spongerng_ctr_init(sp,seed.data(),seed.size(),stream);
+    }
+
+    /** Move to a byte offset in the stream */
+    inline void seek( uint64_t position ) GOLDILOCKS_NOEXCEPT {
+        goldilocks_spongerng_ctr_seek(sp,position);
+    }
+
+    /** The byte offset of the next output */
+    inline uint64_t tell() const GOLDILOCKS_NOEXCEPT { return sp->position; }
+
+    /** Securely destroy by overwriting state. */
+    inline ~CounterRng() GOLDILOCKS_NOEXCEPT { goldilocks_spongerng_ctr_destroy(sp); }
+
+    using Rng::read;
+
+    /** Read data to a buffer. */
+    virtual inline void read(Buffer buffer) GOLDILOCKS_NOEXCEPT
+#if __cplusplus >= 201103L
+        final
+#endif
+        { goldilocks_spongerng_ctr_next(sp,buffer.data(),buffer.size()); }
+
+private:
+    CounterRng(const CounterRng &) GOLDILOCKS_DELETE;
+    CounterRng &operator=(const CounterRng &) GOLDILOCKS_DELETE;
+};
 /**@endcond*/
 
 } /* namespace goldilocks */
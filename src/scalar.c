@@ -161,7 +161,7 @@ goldilocks_error_t API_NS(scalar_invert) (
 
     /* Demontgomerize */
     sc_montmul(out,out,API_NS(scalar_one));
-    goldilocks_bzero(precmp, sizeof(precmp));
+    SCRUB(precmp, sizeof(precmp));
     return goldilocks_succeed_if(~API_NS(scalar_eq)(out,API_NS(scalar_zero)));
 }
 
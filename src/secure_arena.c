@@ -0,0 +1,241 @@
+/**
+ * @file secure_arena.c
+ * @copyright
+ *   Copyright (c) 2018 the libgoldilocks contributors.  \n
+ *   Released under the MIT License.  See LICENSE.txt for license information.
+ *
+ * @brief A pool of memory for secrets, which is kept out of core dumps and
+ * (where RLIMIT_MEMLOCK allows) out of swap.
+ *
+ * One region is mapped on first use, and carved into slabs as they are
+ * needed.  Each slab serves a single power-of-two size class, so blocks are
+ * aligned to their size, and the class of a block can be found from its
+ * address.  Slabs are locked into memory as they are carved, so that only
+ * the part of the pool which is in use counts towards the limit.
+ *
+ * Each thread caches free blocks of each class, and trades them in batches
+ * with shared per-class lists, so that most allocations take no lock.
+ * Blocks are zeroized when they are released, and so are handed out zeroed.
+ * Requests which are too large, or which don't fit in what is left of the
+ * pool, go to the heap instead.
+ */
+#define _DEFAULT_SOURCE 1 /* for MAP_ANONYMOUS and madvise with glibc */
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include <sys/types.h>
+#include <sys/mman.h>
+
+#include "word.h"
+
+#ifndef GOLDILOCKS_SECURE_ARENA_BYTES
+/** Size of the pool, which is reserved (but not committed) on first use. */
+#define GOLDILOCKS_SECURE_ARENA_BYTES (4<<20)
+#endif
+
+#define SLAB_BYTES (64<<10)
+#define N_SLABS (GOLDILOCKS_SECURE_ARENA_BYTES / SLAB_BYTES)
+#define MIN_CLASS_BITS 6  /* 64-byte blocks */
+#define MAX_CLASS_BITS 15 /* 32kiB blocks, so a slab holds at least two */
+#define N_CLASSES (MAX_CLASS_BITS - MIN_CLASS_BITS + 1)
+#define CLASS_BYTES(c) ((size_t)1 << ((c) + MIN_CLASS_BITS))
+
+/** Blocks moved between a thread's cache and the shared lists at once. */
+#define THREAD_CACHE_BATCH 16
+
+/* Each slab holds at least two blocks.  (Precomputed tables fit the 16kiB class.) */
+typedef char slabs_hold_blocks[(CLASS_BYTES(N_CLASSES-1) <= SLAB_BYTES/2) ? 1 : -1];
+
+/** A free block.  All of it but the link is zero, so long as callers only write to the size they asked for. */
+struct block {
+    struct block *next;
+};
+
+static struct {
+    uint8_t *base;            /**< SLAB_BYTES-aligned, or NULL if the pool is unavailable */
+    size_t next_slab;         /**< Index of the next slab to carve */
+    uint8_t slab_class[N_SLABS];
+    pthread_mutex_t locks[N_CLASSES];
+    struct block *free[N_CLASSES];
+} arena;
+
+/** A thread's cached free blocks. */
+struct thread_cache_s {
+    struct block *free[N_CLASSES];
+    unsigned count[N_CLASSES];
+    uint8_t registered;
+};
+
+/* The default TLS model, since the library may be loaded with dlopen (as
+ * python/edgold does), and static TLS may not have room left by then. */
+static __thread struct thread_cache_s thread_cache;
+static pthread_once_t arena_once = PTHREAD_ONCE_INIT;
+static pthread_key_t thread_cache_key;
+static int thread_cache_have_key = 0;
+
+/** Return a thread's cache to the shared lists when it exits. */
+static void thread_cache_flush (void *cache) {
+    struct thread_cache_s *t = (struct thread_cache_s *)cache;
+    unsigned c;
+    for (c=0; c<N_CLASSES; c++) {
+        struct block *b = t->free[c];
+        if (!b) continue;
+        while (b->next) b = b->next;
+        pthread_mutex_lock(&arena.locks[c]);
+        b->next = arena.free[c];
+        arena.free[c] = t->free[c];
+        pthread_mutex_unlock(&arena.locks[c]);
+        t->free[c] = NULL;
+        t->count[c] = 0;
+    }
+    t->registered = 0;
+}
+
+/* Hold every lock across fork, so that the child's are consistent. */
+static void arena_before_fork (void) {
+    unsigned c;
+    for (c=0; c<N_CLASSES; c++) pthread_mutex_lock(&arena.locks[c]);
+}
+
+static void arena_after_fork (void) {
+    unsigned c;
+    for (c=0; c<N_CLASSES; c++) pthread_mutex_unlock(&arena.locks[c]);
+}
+
+static void arena_setup (void) {
+    unsigned c;
+    uint8_t *map = (uint8_t *)mmap(NULL, GOLDILOCKS_SECURE_ARENA_BYTES + SLAB_BYTES,
+        PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (map == (uint8_t *)MAP_FAILED) return;
+    for (c=0; c<N_CLASSES; c++) pthread_mutex_init(&arena.locks[c], NULL);
+#if defined(MADV_DONTDUMP)
+    (void)madvise(map, GOLDILOCKS_SECURE_ARENA_BYTES + SLAB_BYTES, MADV_DONTDUMP);
+#endif
+    pthread_atfork(arena_before_fork, arena_after_fork, arena_after_fork);
+    thread_cache_have_key = !pthread_key_create(&thread_cache_key, thread_cache_flush);
+    __atomic_store_n(&arena.base,
+        (uint8_t *)(((uintptr_t)map + SLAB_BYTES - 1) & ~(uintptr_t)(SLAB_BYTES - 1)),
+        __ATOMIC_RELEASE);
+}
+
+/** Carve a new slab for class c, and return its blocks.  Called with the class lock held. */
+static struct block *carve_slab (unsigned c) {
+    size_t i = __atomic_fetch_add(&arena.next_slab, 1, __ATOMIC_RELAXED), j;
+    uint8_t *slab;
+    if (i >= N_SLABS) return NULL;
+    slab = arena.base + i*SLAB_BYTES;
+    arena.slab_class[i] = c;
+    /* Best effort: the pool is still kept out of core dumps past the limit. */
+    (void)mlock(slab, SLAB_BYTES);
+    for (j=0; j+CLASS_BYTES(c) < SLAB_BYTES; j += CLASS_BYTES(c)) {
+        ((struct block *)&slab[j])->next = (struct block *)&slab[j+CLASS_BYTES(c)];
+    }
+    return (struct block *)slab;
+}
+
+static struct thread_cache_s *thread_cache_get (void) {
+    struct thread_cache_s *t = &thread_cache;
+    if (!t->registered) {
+        pthread_once(&arena_once, arena_setup);
+        if (thread_cache_have_key) pthread_setspecific(thread_cache_key, t);
+        t->registered = 1;
+    }
+    return t;
+}
+
+static void thread_cache_refill (struct thread_cache_s *t, unsigned c) {
+    unsigned n;
+    pthread_mutex_lock(&arena.locks[c]);
+    if (!arena.free[c]) arena.free[c] = carve_slab(c);
+    for (n=0; n<THREAD_CACHE_BATCH && arena.free[c]; n++) {
+        struct block *b = arena.free[c];
+        arena.free[c] = b->next;
+        b->next = t->free[c];
+        t->free[c] = b;
+        t->count[c]++;
+    }
+    pthread_mutex_unlock(&arena.locks[c]);
+}
+
+static void thread_cache_trim (struct thread_cache_s *t, unsigned c) {
+    unsigned n;
+    pthread_mutex_lock(&arena.locks[c]);
+    for (n=0; n<THREAD_CACHE_BATCH; n++) {
+        struct block *b = t->free[c];
+        t->free[c] = b->next;
+        t->count[c]--;
+        b->next = arena.free[c];
+        arena.free[c] = b;
+    }
+    pthread_mutex_unlock(&arena.locks[c]);
+}
+
+static int arena_contains (const void *ptr) {
+    const uint8_t *base = __atomic_load_n(&arena.base, __ATOMIC_ACQUIRE);
+    return base && (const uint8_t *)ptr >= base
+        && (const uint8_t *)ptr < base + GOLDILOCKS_SECURE_ARENA_BYTES;
+}
+
+void *goldilocks_secure_alloc (
+    size_t size,
+    size_t alignment
+) {
+    size_t need = size > alignment ? size : alignment;
+    void *ret = NULL;
+
+    if (need <= CLASS_BYTES(N_CLASSES-1)) {
+        struct thread_cache_s *t = thread_cache_get();
+        unsigned c = 0;
+        while (CLASS_BYTES(c) < need) c++;
+        if (!t->free[c] && arena.base) thread_cache_refill(t, c);
+        if (t->free[c]) {
+            struct block *b = t->free[c];
+            t->free[c] = b->next;
+            t->count[c]--;
+            b->next = NULL;
+            return b;
+        }
+    }
+
+    /* Too big, or the pool is exhausted */
+    if (alignment > sizeof(void *)) {
+        if (posix_memalign(&ret, alignment, size ? size : 1)) return NULL;
+    } else {
+        ret = malloc(size ? size : 1);
+        if (!ret) return NULL;
+    }
+    memset(ret, 0, size);
+    return ret;
+}
+
+void goldilocks_secure_free (
+    void *ptr,
+    size_t size
+) {
+    struct thread_cache_s *t;
+    struct block *b;
+    unsigned c;
+
+    if (ptr == NULL) return;
+    if (!arena_contains(ptr)) {
+        goldilocks_bzero(ptr, size);
+        free(ptr);
+        return;
+    }
+
+    c = arena.slab_class[((uint8_t *)ptr - arena.base) / SLAB_BYTES];
+    /* The rest of the block is still zero */
+    really_memset(ptr, 0, size < CLASS_BYTES(c) ? size : CLASS_BYTES(c));
+    t = thread_cache_get();
+    b = (struct block *)ptr;
+    b->next = t->free[c];
+    t->free[c] = b;
+    if (++t->count[c] > 2*THREAD_CACHE_BATCH) thread_cache_trim(t, c);
+}
+
+goldilocks_bool_t goldilocks_secure_is_pooled (
+    const void *ptr
+) {
+    return arena_contains(ptr) ? GOLDILOCKS_TRUE : GOLDILOCKS_FALSE;
+}
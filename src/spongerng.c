@@ -12,6 +12,7 @@
  */
 
 #define __STDC_WANT_LIB_EXT1__ 1 /* for memset_s */
+#define _DEFAULT_SOURCE 1 /* for clock_gettime with glibc */
 #include <assert.h>
 #include <stdint.h>
 #include <string.h>
@@ -24,12 +25,29 @@
 #include <sys/stat.h>
 #include <fcntl.h>
 #include <unistd.h>
+#include <time.h>
+#include <errno.h>
+#include <pthread.h>
+#if defined(__linux__)
+#include <sys/syscall.h>
+#endif
+
+#ifndef GOLDILOCKS_THREAD_RNG_RESEED_BYTES
+/** The thread-local RNG reseeds from the system after this much output... */
+#define GOLDILOCKS_THREAD_RNG_RESEED_BYTES (1<<20)
+#endif
+#ifndef GOLDILOCKS_THREAD_RNG_RESEED_SECONDS
+/** ... or after this many seconds. */
+#define GOLDILOCKS_THREAD_RNG_RESEED_SECONDS 300
+#endif
 
 /** Get entropy from a CPU, preferably in the form of RDRAND, but possibly instead from RDTSC. */
 static void get_cpu_entropy(uint8_t *entropy, size_t len) {
 # if (defined(__i386__) || defined(__x86_64__))
-    static char tested = 0, have_rdrand = 0;
-    if (!tested) {
+    /* 0: not probed yet, 1: no RDRAND, 2: RDRAND.  Racing probes store the same value. */
+    static int rdrand_state = 0;
+    int state = __atomic_load_n(&rdrand_state, __ATOMIC_RELAXED);
+    if (!state) {
         uint32_t a,b,c,d;
 #if defined(__i386__) && defined(__PIC__)
         /* Don't clobber ebx.  The compiler doesn't like when when __PIC__ */
@@ -47,11 +65,11 @@ static void get_cpu_entropy(uint8_t *entropy, size_t len) {
         __asm__("cpuid" : "=a"(a), "=b"(b), "=c"(c), "=d"(d) : "0"(1));
 #endif
         (void)a; (void)b; (void)d;
-        have_rdrand = (c>>30)&1;
-        tested = 1;
+        state = 1 + ((c>>30)&1);
+        __atomic_store_n(&rdrand_state, state, __ATOMIC_RELAXED);
     }
 
-    if (have_rdrand) {
+    if (state == 2) {
         # if defined(__x86_64__)
             uint64_t out=0, a=0, *eo = (uint64_t *)entropy;
         # elif defined(__i386__)
@@ -89,6 +107,187 @@ static void get_cpu_entropy(uint8_t *entropy, size_t len) {
 #endif
 }
 
+/**
+ * Read len bytes from getrandom(2), or from /dev/urandom where it isn't
+ * available.  Return nonzero on success.
+ */
+static int get_system_entropy(uint8_t *entropy, size_t len) {
+    int fd;
+#if defined(__linux__) && defined(SYS_getrandom)
+    while (len) {
+        long got = syscall(SYS_getrandom, entropy, len, 0);
+        if (got < 0 && errno == EINTR) continue;
+        if (got <= 0) break; /* ENOSYS on old kernels */
+        entropy += got;
+        len -= got;
+    }
+    if (!len) return 1;
+#endif
+
+    fd = open("/dev/urandom", O_RDONLY);
+    if (fd < 0) return 0;
+    while (len) {
+        ssize_t red = read(fd, entropy, len);
+        if (red <= 0) {
+            close(fd);
+            return 0;
+        }
+        entropy += red;
+        len -= red;
+    }
+    close(fd);
+    return 1;
+}
+
+/** Seconds on a monotonic clock, for the reseed timer. */
+static uint64_t monotonic_seconds(void) {
+#ifdef CLOCK_MONOTONIC
+    struct timespec ts;
+    if (clock_gettime(CLOCK_MONOTONIC, &ts) == 0) return ts.tv_sec;
+#endif
+    return time(NULL);
+}
+
+/** Replace the sponge state with a key squeezed from it, and absorb in. */
+static void spongerng_rekey (
+    goldilocks_keccak_prng_p prng,
+    const uint8_t * __restrict__ in,
+    size_t len
+) {
+    uint8_t seed[32];
+    uint8_t nondet;
+    goldilocks_sha3_output(prng->sponge,seed,sizeof(seed));
+    nondet = prng->sponge->params->remaining;
+
+    goldilocks_sha3_reset(prng->sponge);
+    goldilocks_sha3_update(prng->sponge,seed,sizeof(seed));
+    goldilocks_sha3_update(prng->sponge,in,len);
+
+    prng->sponge->params->remaining = nondet;
+    goldilocks_bzero(seed,sizeof(seed));
+}
+
+/** A buffered sponge RNG. */
+struct goldilocks_spongerng_buffered_s {
+    goldilocks_keccak_prng_p prng;
+    uint8_t buffer[GOLDILOCKS_SPONGERNG_BUFFER_BYTES]; /**< Squeezed output not yet handed out. */
+    size_t available;       /**< Bytes left at the end of the buffer. */
+    size_t rekey_bytes;     /**< Bytes squeezed per re-key. */
+    size_t reseed_bytes;    /**< Bytes to hand out between reseeds, or 0. */
+    size_t since_reseed;    /**< Bytes handed out since the last reseed. */
+    uint64_t reseed_seconds;/**< Seconds between reseeds, or 0. */
+    uint64_t last_reseed;   /**< Monotonic time of the last reseed, in seconds. */
+};
+
+/** Throw away any buffered output. */
+static void spongerng_discard (goldilocks_spongerng_buffered_s *rng) {
+    goldilocks_bzero(rng->buffer,sizeof(rng->buffer));
+    rng->available = 0;
+}
+
+static int spongerng_reseed_due (const goldilocks_spongerng_buffered_s *rng) {
+    if (!rng->prng->sponge->params->remaining) return 0;
+    if (rng->reseed_bytes && rng->since_reseed >= rng->reseed_bytes) return 1;
+    return rng->reseed_seconds
+        && monotonic_seconds() - rng->last_reseed >= rng->reseed_seconds;
+}
+
+/**
+ * Squeeze a new buffer, then re-key so that the sponge state can't
+ * reproduce it.  A nondeterministic RNG first stirs in CPU entropy, and
+ * system entropy if a reseed is due.
+ */
+static void spongerng_refill (goldilocks_spongerng_buffered_s *rng) {
+    const uint8_t nope;
+    if (rng->prng->sponge->params->remaining) {
+        uint8_t entropy[64] = {0};
+        size_t len = 32;
+        get_cpu_entropy(entropy, 32);
+        if (spongerng_reseed_due(rng)) {
+            if (get_system_entropy(&entropy[32], 32)) len = sizeof(entropy);
+            rng->since_reseed = 0;
+            rng->last_reseed = monotonic_seconds();
+        }
+        spongerng_rekey(rng->prng,entropy,len);
+        goldilocks_bzero(entropy,sizeof(entropy));
+    }
+
+    goldilocks_sha3_output(rng->prng->sponge,rng->buffer,rng->rekey_bytes);
+    spongerng_rekey(rng->prng,&nope,0);
+    rng->available = rng->rekey_bytes;
+}
+
+/** Set up the buffer of rng, whose prng is already initialized. */
+static void spongerng_buffered_init (
+    goldilocks_spongerng_buffered_s *rng,
+    size_t rekey_bytes,
+    size_t reseed_bytes,
+    unsigned reseed_seconds
+) {
+    if (rekey_bytes == 0 || rekey_bytes > sizeof(rng->buffer)) rekey_bytes = sizeof(rng->buffer);
+    spongerng_discard(rng);
+    rng->rekey_bytes = rekey_bytes;
+    rng->reseed_bytes = reseed_bytes;
+    rng->reseed_seconds = reseed_seconds;
+    rng->since_reseed = 0;
+    rng->last_reseed = reseed_seconds ? monotonic_seconds() : 0;
+}
+
+goldilocks_spongerng_buffered_s *goldilocks_spongerng_buffered_new (
+    goldilocks_keccak_prng_p prng,
+    size_t rekey_bytes,
+    size_t reseed_bytes,
+    unsigned reseed_seconds
+) {
+    goldilocks_spongerng_buffered_s *rng = (goldilocks_spongerng_buffered_s *)
+        goldilocks_secure_alloc(sizeof(*rng), sizeof(uint64_t));
+    if (rng) {
+        memcpy(rng->prng,prng,sizeof(rng->prng));
+        spongerng_buffered_init(rng,rekey_bytes,reseed_bytes,reseed_seconds);
+    }
+    goldilocks_spongerng_destroy(prng);
+    return rng;
+}
+
+void goldilocks_spongerng_buffered_next (
+    goldilocks_spongerng_buffered_s *rng,
+    uint8_t * __restrict__ out,
+    size_t len
+) {
+    /* Don't hand out output squeezed before the reseed came due */
+    if (rng->available && spongerng_reseed_due(rng)) spongerng_discard(rng);
+
+    while (len) {
+        size_t n = (len < rng->available) ? len : rng->available;
+        uint8_t *from = &rng->buffer[rng->rekey_bytes - rng->available];
+        if (!n) {
+            spongerng_refill(rng);
+            continue;
+        }
+        memcpy(out,from,n);
+        goldilocks_bzero(from,n);
+        out += n;
+        len -= n;
+        rng->available -= n;
+        rng->since_reseed += n;
+    }
+}
+
+void goldilocks_spongerng_buffered_stir (
+    goldilocks_spongerng_buffered_s *rng,
+    const uint8_t * __restrict__ in,
+    size_t len
+) {
+    spongerng_discard(rng);
+    spongerng_rekey(rng->prng,in,len);
+}
+
+void goldilocks_spongerng_buffered_destroy (
+    goldilocks_spongerng_buffered_s *doomed
+) {
+    goldilocks_secure_free(doomed,sizeof(*doomed));
+}
+
 void goldilocks_spongerng_next (
     goldilocks_keccak_prng_p prng,
     uint8_t * __restrict__ out,
@@ -102,7 +301,7 @@ void goldilocks_spongerng_next (
         /* nondet */
         uint8_t cpu_entropy[32] = {0};
         get_cpu_entropy(cpu_entropy, sizeof(cpu_entropy));
-        goldilocks_spongerng_stir(prng,cpu_entropy,sizeof(cpu_entropy));
+        spongerng_rekey(prng,cpu_entropy,sizeof(cpu_entropy));
         goldilocks_bzero(cpu_entropy,sizeof(cpu_entropy));
     }
 
@@ -114,7 +313,7 @@ void goldilocks_spongerng_next (
     goldilocks_sha3_update(prng->sponge,lenx,sizeof(lenx));
     goldilocks_sha3_output(prng->sponge,out,len);
 
-    goldilocks_spongerng_stir(prng,&nope,0);
+    spongerng_rekey(prng,&nope,0);
 }
 
 void goldilocks_spongerng_stir (
@@ -122,17 +321,16 @@ void goldilocks_spongerng_stir (
     const uint8_t * __restrict__ in,
     size_t len
 ) {
-    uint8_t seed[32];
-    uint8_t nondet;
-    goldilocks_sha3_output(prng->sponge,seed,sizeof(seed));
-    nondet = prng->sponge->params->remaining;
-
-    goldilocks_sha3_reset(prng->sponge);
-    goldilocks_sha3_update(prng->sponge,seed,sizeof(seed));
-    goldilocks_sha3_update(prng->sponge,in,len);
+    spongerng_rekey(prng,in,len);
+}
 
-    prng->sponge->params->remaining = nondet;
-    goldilocks_bzero(seed,sizeof(seed));
+/** Start a sponge RNG with nothing absorbed, in unbuffered mode. */
+static void spongerng_init (
+    goldilocks_keccak_prng_p prng,
+    int deterministic
+) {
+    goldilocks_sha3_init(prng->sponge,&GOLDILOCKS_SHAKE256_params_s);
+    prng->sponge->params->remaining = !deterministic; /* A bit of a hack; this param is ignored for SHAKE */
 }
 
 void goldilocks_spongerng_init_from_buffer (
@@ -141,9 +339,8 @@ void goldilocks_spongerng_init_from_buffer (
     size_t len,
     int deterministic
 ) {
-    goldilocks_sha3_init(prng->sponge,&GOLDILOCKS_SHAKE256_params_s);
-    prng->sponge->params->remaining = !deterministic; /* A bit of a hack; this param is ignored for SHAKE */
-    goldilocks_spongerng_stir(prng, in, len);
+    spongerng_init(prng,deterministic);
+    spongerng_rekey(prng, in, len);
 }
 
 goldilocks_error_t goldilocks_spongerng_init_from_file (
@@ -155,8 +352,7 @@ goldilocks_error_t goldilocks_spongerng_init_from_file (
     int fd;
     uint8_t buffer[128];
     const uint8_t nope;
-    goldilocks_sha3_init(prng->sponge,&GOLDILOCKS_SHAKE256_params_s);
-    prng->sponge->params->remaining = !deterministic; /* A bit of a hack; this param is ignored for SHAKE */
+    spongerng_init(prng,deterministic);
     if (!len) return GOLDILOCKS_FAILURE;
 
     fd = open(file, O_RDONLY);
@@ -172,7 +368,7 @@ goldilocks_error_t goldilocks_spongerng_init_from_file (
         len -= red;
     };
     close(fd);
-    goldilocks_spongerng_stir(prng,&nope,0);
+    spongerng_rekey(prng,&nope,0);
 
     return GOLDILOCKS_SUCCESS;
 }
@@ -182,3 +378,125 @@ goldilocks_error_t goldilocks_spongerng_init_from_dev_urandom (
 ) {
     return goldilocks_spongerng_init_from_file(goldilocks_sponge, "/dev/urandom", 64, 0);
 }
+
+static void le64_encode(uint8_t out[8], uint64_t x) {
+    unsigned int i;
+    for (i=0; i<8; i++, x>>=8) out[i] = (uint8_t)x;
+}
+
+void goldilocks_spongerng_ctr_init (
+    goldilocks_spongerng_ctr_p ctr,
+    const uint8_t *seed,
+    size_t seed_len,
+    uint64_t stream
+) {
+    static const char domain[] = "goldilocks_spongerng_ctr";
+    goldilocks_keccak_sponge_p sponge;
+    goldilocks_sha3_init(sponge,&GOLDILOCKS_SHAKE256_params_s);
+    goldilocks_sha3_update(sponge,(const uint8_t *)domain,sizeof(domain)-1);
+    goldilocks_sha3_update(sponge,seed,seed_len);
+    goldilocks_sha3_output(sponge,ctr->key,sizeof(ctr->key));
+    goldilocks_sha3_destroy(sponge);
+
+    ctr->stream = stream;
+    ctr->position = 0;
+    ctr->cached = 0;
+}
+
+void goldilocks_spongerng_ctr_seek (
+    goldilocks_spongerng_ctr_p ctr,
+    uint64_t position
+) {
+    ctr->position = position;
+}
+
+/** Compute block number index of the stream into ctr->block. */
+static void spongerng_ctr_block (
+    goldilocks_spongerng_ctr_p ctr,
+    uint64_t index
+) {
+    uint8_t in[sizeof(ctr->key)+16];
+    goldilocks_keccak_sponge_p sponge;
+    memcpy(in,ctr->key,sizeof(ctr->key));
+    le64_encode(&in[sizeof(ctr->key)],ctr->stream);
+    le64_encode(&in[sizeof(ctr->key)+8],index);
+
+    goldilocks_sha3_init(sponge,&GOLDILOCKS_SHAKE256_params_s);
+    goldilocks_sha3_update(sponge,in,sizeof(in));
+    goldilocks_sha3_output(sponge,ctr->block,sizeof(ctr->block));
+    goldilocks_sha3_destroy(sponge);
+    goldilocks_bzero(in,sizeof(in));
+    ctr->cached = index+1;
+}
+
+void goldilocks_spongerng_ctr_next (
+    goldilocks_spongerng_ctr_p ctr,
+    uint8_t * __restrict__ out,
+    size_t len
+) {
+    while (len) {
+        uint64_t index = ctr->position / sizeof(ctr->block);
+        size_t off = ctr->position % sizeof(ctr->block);
+        size_t n = sizeof(ctr->block) - off;
+        if (n > len) n = len;
+        if (ctr->cached != index+1) spongerng_ctr_block(ctr,index);
+        memcpy(out,&ctr->block[off],n);
+        out += n;
+        len -= n;
+        ctr->position += n;
+    }
+}
+
+/** A thread's default RNG. */
+struct thread_rng_s {
+    goldilocks_spongerng_buffered_s rng;
+    uint64_t generation; /**< fork_generation when it was seeded */
+    uint8_t seeded;
+};
+
+static __thread struct thread_rng_s thread_rng;
+static volatile uint64_t fork_generation = 0;
+static pthread_once_t thread_rng_once = PTHREAD_ONCE_INIT;
+static pthread_key_t thread_rng_key;
+static int thread_rng_have_key = 0;
+
+/** In a child process, every thread RNG must reseed so as not to repeat the parent's output. */
+static void thread_rng_after_fork (void) {
+    fork_generation++;
+}
+
+static void thread_rng_wipe (void *doomed) {
+    goldilocks_bzero(doomed, sizeof(struct thread_rng_s));
+}
+
+static void thread_rng_setup (void) {
+    pthread_atfork(NULL, NULL, thread_rng_after_fork);
+    thread_rng_have_key = !pthread_key_create(&thread_rng_key, thread_rng_wipe);
+}
+
+goldilocks_error_t goldilocks_spongerng_thread_next (
+    uint8_t * __restrict__ out,
+    size_t len
+) {
+    struct thread_rng_s *t = &thread_rng;
+    if (!t->seeded || t->generation != fork_generation) {
+        uint8_t seed[64];
+        if (!t->seeded) {
+            pthread_once(&thread_rng_once, thread_rng_setup);
+            /* Wipe the state when the thread exits */
+            if (thread_rng_have_key) pthread_setspecific(thread_rng_key, t);
+        }
+        if (!get_system_entropy(seed, sizeof(seed))) {
+            memset(out, 0, len);
+            return GOLDILOCKS_FAILURE;
+        }
+        goldilocks_spongerng_init_from_buffer(t->rng.prng, seed, sizeof(seed), 0);
+        goldilocks_bzero(seed, sizeof(seed));
+        spongerng_buffered_init(&t->rng, GOLDILOCKS_SPONGERNG_BUFFER_BYTES,
+            GOLDILOCKS_THREAD_RNG_RESEED_BYTES, GOLDILOCKS_THREAD_RNG_RESEED_SECONDS);
+        t->generation = fork_generation;
+        t->seeded = 1;
+    }
+    goldilocks_spongerng_buffered_next(&t->rng, out, len);
+    return GOLDILOCKS_SUCCESS;
+}
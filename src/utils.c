@@ -9,24 +9,13 @@
  * @brief Goldilocks utility functions.
  */
 
-#include <goldilocks/common.h>
+#include "word.h"
 
 void goldilocks_bzero (
     void *s,
     size_t size
 ) {
-#ifdef __STDC_LIB_EXT1__
-    memset_s(s, size, 0, size);
-#else
-    const size_t sw = sizeof(goldilocks_word_t);
-    volatile uint8_t *destroy = (volatile uint8_t *)s;
-    for (; size && ((uintptr_t)destroy)%sw; size--, destroy++)
-        *destroy = 0;
-    for (; size >= sw; size -= sw, destroy += sw)
-        *(volatile goldilocks_word_t *)destroy = 0;
-    for (; size; size--, destroy++)
-        *destroy = 0;
-#endif
+    really_memset(s, 0, size);
 }
 
 goldilocks_bool_t goldilocks_memeq (
@@ -14,10 +14,14 @@
 #include <goldilocks/spongerng.hxx>
 #include <goldilocks/eddsa.hxx>
 #include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
 #include <sys/time.h>
 #include <assert.h>
 #include <stdint.h>
+#include <pthread.h>
 #include <vector>
+#include <string>
 #include <algorithm>
 
 using namespace goldilocks;
@@ -74,12 +78,17 @@ class Benchmark {
     static const int NTESTS = 20, NSAMPLES=50, DISCARD=2;
     static double totalCy, totalS;
 public:
+    /** If not empty, run only the benchmarks with these names. */
+    static std::vector<std::string> only;
+    bool skip;
     int i, j, ntests, nsamples;
     double begin;
     uint64_t tsc_begin;
     std::vector<double> times;
     std::vector<uint64_t> cycles;
     Benchmark(const char *s, double factor = 1) {
+        skip = !only.empty() && std::find(only.begin(), only.end(), s) == only.end();
+        if (skip) return;
         printf("%s:", s);
         if (strlen(s) < 25) printf("%*s",int(25-strlen(s)),"");
         fflush(stdout);
@@ -94,6 +103,7 @@ public:
     ~Benchmark() {
         double tsc = 0;
         double t = 0;
+        if (skip) return;
 
         std::sort(times.begin(), times.end());
         std::sort(cycles.begin(), cycles.end());
@@ -116,6 +126,7 @@ public:
         printf("\n");
     }
     inline bool iter() {
+        if (skip) return false;
         i++;
         if (i >= ntests) {
             uint64_t tsc = rdtsc() - tsc_begin;
@@ -143,6 +154,10 @@ public:
 };
 
 double Benchmark::totalCy = 0, Benchmark::totalS = 0;
+std::vector<std::string> Benchmark::only;
+
+/* The comb geometries which goldilocks_gen_tables emits base tables for */
+static const goldilocks_448_comb_geometry_s comb_geometries[] = {{5,5,18},{10,5,9},{15,5,6}};
 
 
 template<typename Group> struct Benches {
@@ -150,6 +165,55 @@ template<typename Group> struct Benches {
 typedef typename Group::Scalar Scalar;
 typedef typename Group::Point Point;
 typedef typename Group::Precomputed Precomputed;
+typedef typename Group::Point::Prepared Prepared;
+
+/* EdDSA keygen and sign by hand, as the library does them but with a base
+ * table of the given comb geometry, computed at run time. */
+static void eddsa_combs(const goldilocks_448_comb_geometry_s *g, const FixedBlock<GOLDILOCKS_EDDSA_448_PRIVATE_BYTES> &priv) {
+    std::vector<unsigned char, SanitizingAllocator<unsigned char,64> >
+        table(goldilocks_448_sizeof_precomputed_combs(g));
+    goldilocks_448_precomputed_s *base = (goldilocks_448_precomputed_s *)&table[0];
+    if (GOLDILOCKS_SUCCESS != goldilocks_448_precompute_combs(base,g,goldilocks_448_point_base)) return;
+
+    const uint8_t dom[2] = {0,0};
+    const size_t bytes = priv.size();
+    FixedArrayBuffer<GOLDILOCKS_EDDSA_448_PUBLIC_BYTES> pub;
+    FixedArrayBuffer<GOLDILOCKS_EDDSA_448_SIGNATURE_BYTES> sig;
+    Scalar secret;
+    Point r;
+    char name[64];
+
+    snprintf(name,sizeof(name),"EdDSA keygen %u,%u,%u",g->n,g->t,g->s);
+    for (Benchmark b(name); b.iter(); ) {
+        goldilocks_ed448_derive_secret_scalar(secret.s,priv.data());
+        ignore_result(goldilocks_448_precomputed_combs_scalarmul(r.p,base,g,secret.s));
+        goldilocks_448_point_mul_by_ratio_and_encode_like_eddsa(pub.data(),r.p);
+    }
+
+    snprintf(name,sizeof(name),"EdDSA sign %u,%u,%u",g->n,g->t,g->s);
+    for (Benchmark b(name); b.iter(); ) {
+        SHAKE<256> hash;
+        hash << priv;
+        SecureBuffer expanded = hash.output(2*bytes);
+        expanded[0] &= ~(Group::REMOVED_COFACTOR-1);
+        expanded[bytes-1] = 0;
+        expanded[bytes-2] |= 0x80;
+        secret = Block(expanded).slice(0,bytes);
+
+        hash.reset();
+        hash << Block("SigEd448") << Block(dom,sizeof(dom)) << Block(expanded).slice(bytes,bytes);
+        Scalar nonce(hash.output(2*bytes)), nonce_ratio = nonce;
+        for (int c=1; c<Point::EDDSA_ENCODE_RATIO; c<<=1) nonce_ratio = nonce_ratio.half();
+        ignore_result(goldilocks_448_precomputed_combs_scalarmul(r.p,base,g,nonce_ratio.s));
+        goldilocks_448_point_mul_by_ratio_and_encode_like_eddsa(sig.data(),r.p);
+
+        hash.reset();
+        hash << Block("SigEd448") << Block(dom,sizeof(dom)) << Block(sig).slice(0,bytes) << pub;
+        Scalar challenge(hash.output(2*bytes));
+        (challenge*secret + nonce).serialize_into(sig.data()+bytes);
+        sig[sig.size()-1] = 0;
+    }
+}
 
 static void cfrg() {
     SpongeRng rng(Block("bench_cfrg_crypto"),SpongeRng::DETERMINISTIC);
@@ -163,9 +227,45 @@ static void cfrg() {
     typename EdDSA<Group>::PrivateKey priv((NOINIT()));
     SecureBuffer sig;
     for (Benchmark b("EdDSA keygen"); b.iter(); ) { priv = e1; }
+    priv = e1; /* in case the benchmark was skipped */
     for (Benchmark b("EdDSA sign"); b.iter(); ) { sig = priv.sign(Block(NULL,0)); }
+    {
+        typename EdDSA<Group>::Signature fsig((NOINIT()));
+        for (Benchmark b("EdDSA sign_into"); b.iter(); ) { priv.sign_into(fsig,Block(NULL,0)); }
+    }
+    for (unsigned i=0; i<sizeof(comb_geometries)/sizeof(comb_geometries[0]); i++) {
+        eddsa_combs(&comb_geometries[i],e1);
+    }
+    sig = priv.sign(Block(NULL,0));
     pub = priv;
     for (Benchmark b("EdDSA verify"); b.iter(); ) { pub.verify(sig,Block(NULL,0)); }
+    {
+        /* The same checks by hand, ending in the half-size comparison.  It
+         * is full-width if the library is built with
+         * GOLDILOCKS_WNAF_FIXED_SPLIT=0. */
+        const uint8_t dom[2] = {0,0};
+        SecureBuffer pub_ser = pub.serialize();
+        Block sig_b(sig);
+        for (Benchmark b("EdDSA verify (half-size)"); b.iter(); ) {
+            Point r, a;
+            ignore_result(r.decode_like_eddsa_and_mul_by_ratio_noexcept(sig_b.slice(0,pub_ser.size())));
+            ignore_result(a.decode_like_eddsa_and_mul_by_ratio_noexcept(pub_ser));
+            SHAKE<256> hash;
+            hash << Block("SigEd448") << Block(dom,sizeof(dom)) << sig_b.slice(0,pub_ser.size()) << pub_ser;
+            Scalar challenge(hash.output(2*pub_ser.size()));
+            Scalar response(sig_b.slice(pub_ser.size(),sig_b.size()-pub_ser.size()));
+            ignore_result(a.non_secret_combo_with_base_eq(-challenge, response*Point::EDDSA_DECODE_RATIO, r));
+        }
+    }
+
+    SecureBuffer pub_ser = pub.serialize();
+    goldilocks_448_point_p pk;
+    goldilocks_448_affine_point_p pk_affine;
+    ignore_result(goldilocks_448_point_decode_like_eddsa_and_mul_by_ratio(pk,pub_ser.data()));
+    goldilocks_448_point_to_affine(pk_affine,pk);
+    for (Benchmark b("EdDSA verify with point"); b.iter(); ) {
+        ignore_result(goldilocks_ed448_verify_with_point(sig.data(),pub_ser.data(),pk_affine,NULL,0,0,NULL,0));
+    }
 }
 
 static void macro() {
@@ -177,8 +277,8 @@ static void macro() {
 static void micro() {
     SpongeRng rng(Block("per-curve-benchmarks"),SpongeRng::DETERMINISTIC);
     Precomputed pBase;
-    Point p,q;
-    Scalar s(1),t(2);
+    Point p(rng),q(rng);
+    Scalar s(rng),t(rng); /* not constants, so that skipped benchmarks don't matter */
     SecureBuffer ep, ep2(Point::SER_BYTES*2);
 
     printf("\nMicro-benchmarks for %s:\n", Group::name());
@@ -186,24 +286,214 @@ static void micro() {
     for (Benchmark b("Scalar times", 100); b.iter(); ) { s*=t; }
     for (Benchmark b("Scalar inv", 1); b.iter(); ) { s.inverse(); }
     for (Benchmark b("Point add", 100); b.iter(); ) { p += q; }
+    {
+        Prepared pq(q);
+        for (Benchmark b("Point add prepared", 100); b.iter(); ) { p += pq; }
+        for (Benchmark b("Point prepare"); b.iter(); ) { Prepared r(q); }
+        std::vector<Point> pts(64, q);
+        for (Benchmark b("Point prepare batch x64", 0.1); b.iter(); ) { Prepared::batch(pts); }
+        std::vector<Point> many(4096, q);
+        for (Benchmark b("Point sum x4096", 0.05); b.iter(); ) { Point::sum(many); }
+        for (Benchmark b("Point add x4096", 0.05); b.iter(); ) {
+            Point r;
+            for (size_t i=0; i<many.size(); i++) r += many[i];
+        }
+    }
     for (Benchmark b("Point double", 100); b.iter(); ) { p.double_in_place(); }
     for (Benchmark b("Point scalarmul"); b.iter(); ) { p * s; }
+    for (Benchmark b("Point scalarmul_v"); b.iter(); ) { p.mul_vartime(s); }
     for (Benchmark b("Point encode"); b.iter(); ) { ep = p.serialize(); }
+    for (Benchmark b("Point encode fixed"); b.iter(); ) { p.serialize_fixed(); }
+    ep = p.serialize(); /* in case the benchmark was skipped */
     for (Benchmark b("Point decode"); b.iter(); ) { p = Point(ep); }
+    {
+        FixedArrayBuffer<GOLDILOCKS_EDDSA_448_PUBLIC_BYTES> ee;
+        Point r;
+        p.mul_by_ratio_and_encode_like_eddsa(ee);
+        for (Benchmark b("Point encode like EdDSA"); b.iter(); ) { p.mul_by_ratio_and_encode_like_eddsa(ee); }
+        for (Benchmark b("Point decode like EdDSA"); b.iter(); ) { r.decode_like_eddsa_and_mul_by_ratio(ee); }
+    }
     for (Benchmark b("Point create/destroy"); b.iter(); ) { Point r; }
     for (Benchmark b("Point hash nonuniform"); b.iter(); ) { Point::from_hash(ep); }
     for (Benchmark b("Point hash uniform"); b.iter(); ) { Point::from_hash(ep2); }
+    {
+        SecureBuffer hashes(64*2*Point::HASH_BYTES);
+        rng.read(hashes);
+        std::vector<goldilocks_448_point_s, SanitizingAllocator<goldilocks_448_point_s,32> > ps(64);
+        std::vector<goldilocks_448_affine_point_s> affine(64);
+        for (Benchmark b("Point hash uniform x64", 0.1); b.iter(); ) {
+            for (size_t i=0; i<64; i++) Point::from_hash(Block(&hashes[i*2*Point::HASH_BYTES],2*Point::HASH_BYTES));
+        }
+        for (Benchmark b("Point hash uniform + affine x64", 0.1); b.iter(); ) {
+            for (size_t i=0; i<64; i++) {
+                goldilocks_448_point_from_hash_uniform(&ps[i],&hashes[i*2*Point::HASH_BYTES]);
+                goldilocks_448_point_to_affine(&affine[i],&ps[i]);
+            }
+        }
+        for (Benchmark b("Point hash uniform batch affine x64", 0.1); b.iter(); ) {
+            goldilocks_448_point_from_hash_uniform_batch(NULL,&affine[0],hashes.data(),64);
+        }
+    }
+    {
+        const uint8_t dst[] = "QUUX-V01-CS02-with-edwards448_XOF:SHAKE256_ELL2_RO_";
+        SecureBuffer msgs(64*32), enc(64*GOLDILOCKS_EDDSA_448_PUBLIC_BYTES);
+        rng.read(msgs);
+        std::vector<const uint8_t *> ptrs(64);
+        std::vector<size_t> lens(64, 32);
+        for (size_t i=0; i<64; i++) ptrs[i] = &msgs[i*32];
+        Point r;
+        for (Benchmark b("Hash to curve (RFC 9380)"); b.iter(); ) {
+            goldilocks_ed448_hash_to_curve(r.p,ptrs[0],32,dst,sizeof(dst)-1);
+        }
+        for (Benchmark b("Encode to curve (RFC 9380)"); b.iter(); ) {
+            goldilocks_ed448_encode_to_curve(r.p,ptrs[0],32,dst,sizeof(dst)-1);
+        }
+        for (Benchmark b("Hash to curve and encode x64", 0.1); b.iter(); ) {
+            for (size_t i=0; i<64; i++) {
+                goldilocks_ed448_hash_to_curve(r.p,ptrs[i],32,dst,sizeof(dst)-1);
+                goldilocks_448_point_mul_by_ratio_and_encode_like_eddsa(&enc[i*GOLDILOCKS_EDDSA_448_PUBLIC_BYTES],r.p);
+            }
+        }
+        for (Benchmark b("Hash to curve batch encode x64", 0.1); b.iter(); ) {
+            goldilocks_ed448_hash_to_curve_batch(enc.data(),NULL,&ptrs[0],&lens[0],64,dst,sizeof(dst)-1,1);
+        }
+    }
     for (Benchmark b("Point unhash nonuniform"); b.iter(); ) { ignore_result(p.invert_elligator(ep,0)); }
     for (Benchmark b("Point unhash uniform"); b.iter(); ) { ignore_result(p.invert_elligator(ep2,0)); }
+    {
+        unsigned char all[1<<Point::INVERT_ELLIGATOR_WHICH_BITS][Point::HASH_BYTES];
+        for (Benchmark b("Point unhash nonuniform x8"); b.iter(); ) {
+            for (uint32_t j=0; j<sizeof(all)/sizeof(all[0]); j++) ignore_result(p.invert_elligator(ep,j));
+        }
+        for (Benchmark b("Point unhash nonuniform all"); b.iter(); ) {
+            ignore_result(goldilocks_448_invert_elligator_nonuniform_all(all,p.p));
+        }
+        for (Benchmark b("Point unhash uniform all"); b.iter(); ) {
+            ignore_result(goldilocks_448_invert_elligator_uniform_all(all,p.p,&ep2[Point::HASH_BYTES]));
+        }
+    }
     for (Benchmark b("Point steg"); b.iter(); ) { p.steg_encode(rng); }
     for (Benchmark b("Point double scalarmul"); b.iter(); ) { Point::double_scalarmul(p,s,q,t); }
     for (Benchmark b("Point dual scalarmul"); b.iter(); ) { p.dual_scalarmul(p,q,s,t); }
+    {
+        /* The same, with the tables in a reused workspace instead of on the stack */
+        std::vector<unsigned char, SanitizingAllocator<unsigned char,64> >
+            workspace(goldilocks_448_sizeof_workspace());
+        Point r;
+        for (Benchmark b("Point scalarmul ws"); b.iter(); ) {
+            goldilocks_448_point_scalarmul_ws(r.p,p.p,s.s,&workspace[0]);
+        }
+        for (Benchmark b("Point double scalarmul ws"); b.iter(); ) {
+            goldilocks_448_point_double_scalarmul_ws(r.p,p.p,s.s,q.p,t.s,&workspace[0]);
+        }
+    }
+    {
+        std::vector<Point> pts;
+        std::vector<Scalar> scs;
+        for (int i=0; i<16; i++) { pts.push_back(Point(rng)); scs.push_back(Scalar(rng)); }
+        for (Benchmark b("Point multiscalarmul x16", 0.1); b.iter(); ) { Point::multiscalarmul(pts,scs); }
+
+        std::vector<goldilocks_448_point_s, SanitizingAllocator<goldilocks_448_point_s,32> > ps;
+        std::vector<goldilocks_448_affine_point_s> affine(pts.size());
+        std::vector<goldilocks_448_scalar_s> ss;
+        for (size_t i=0; i<pts.size(); i++) { ps.push_back(pts[i].p[0]); ss.push_back(scs[i].s[0]); }
+        for (Benchmark b("Point to affine batch x16"); b.iter(); ) {
+            goldilocks_448_point_to_affine_batch(&affine[0],&ps[0],ps.size());
+        }
+        goldilocks_448_point_to_affine_batch(&affine[0],&ps[0],ps.size());
+        Point r;
+        for (Benchmark b("Point multiscalarmul affine x16", 0.1); b.iter(); ) {
+            ignore_result(goldilocks_448_point_multiscalarmul_affine(r.p,&affine[0],&ss[0],affine.size()));
+        }
+    }
     for (Benchmark b("Point precmp scalarmul"); b.iter(); ) { pBase * s; }
+    {
+        /* Resumable versions, 8 steps per call */
+        std::vector<unsigned char, SanitizingAllocator<unsigned char,64> >
+            state_buf(goldilocks_448_sizeof_scalarmul_state);
+        goldilocks_448_scalarmul_state_s *state = (goldilocks_448_scalarmul_state_s *)&state_buf[0];
+        FixedArrayBuffer<Group::DhLadder::PUBLIC_BYTES> base(rng);
+        FixedArrayBuffer<Group::DhLadder::PRIVATE_BYTES> scalar(rng);
+        uint8_t shared[Group::DhLadder::PUBLIC_BYTES];
+        Point r;
+        for (Benchmark b("Point scalarmul resumable"); b.iter(); ) {
+            goldilocks_448_point_scalarmul_start(state,p.p,s.s);
+            while (goldilocks_448_scalarmul_resume(state,8)) {}
+            goldilocks_448_point_scalarmul_finish(r.p,state);
+        }
+        for (Benchmark b("Point precmp resumable"); b.iter(); ) {
+            goldilocks_448_precomputed_scalarmul_start(state,goldilocks_448_precomputed_base,s.s);
+            while (goldilocks_448_scalarmul_resume(state,8)) {}
+            goldilocks_448_point_scalarmul_finish(r.p,state);
+        }
+        for (Benchmark b("X448 resumable"); b.iter(); ) {
+            goldilocks_x448_start(state,base.data(),scalar.data());
+            while (goldilocks_448_scalarmul_resume(state,8)) {}
+            ignore_result(goldilocks_x448_finish(shared,state));
+        }
+    }
+    {
+        /* Startup cost of a table for a fixed non-standard generator */
+        char path[] = "/tmp/goldilocks_bench_XXXXXX";
+        int fd = mkstemp(path);
+        if (fd >= 0) {
+            close(fd);
+            Precomputed(q).save(path);
+            for (Benchmark b("Point precompute", 0.1); b.iter(); ) { Precomputed pq(q); }
+            for (Benchmark b("Point precmp map+unmap", 0.1); b.iter(); ) {
+                const goldilocks_448_precomputed_s *table;
+                goldilocks_448_comb_geometry_s g;
+                if (GOLDILOCKS_SUCCESS == goldilocks_448_precomputed_map(&table,&g,path)) {
+                    goldilocks_448_precomputed_unmap(table);
+                }
+            }
+            unlink(path);
+        }
+    }
+    {
+        Precomputed pq(q);
+        for (Benchmark b("Point precmp 2x + add"); b.iter(); ) { pBase * s + pq * t; }
+        for (Benchmark b("Point precmp double smul"); b.iter(); ) { Precomputed::double_scalarmul(pBase,s,pq,t); }
+
+        /* Expressions are fused into one multi-scalar multiplication */
+        Point u(rng), v(rng);
+        Scalar w(rng);
+        for (Benchmark b("Point expr 3 unfused"); b.iter(); ) { Point r = s*p + t*q + w*u; }
+        for (Benchmark b("Point expr 3 fused"); b.iter(); ) { Point r = p.scaled_by(s) + q.scaled_by(t) + u.scaled_by(w); }
+        for (Benchmark b("Point expr 2+2pre unfused"); b.iter(); ) { Point r = s*p + t*q + w*pBase + s*pq; }
+        for (Benchmark b("Point expr 2+2pre fused"); b.iter(); ) {
+            Point r = p.scaled_by(s) + q.scaled_by(t) + pBase.scaled_by(w) + pq.scaled_by(s);
+        }
+
+        /* Larger comb tables, computed at run time */
+        for (unsigned i=0; i<sizeof(comb_geometries)/sizeof(comb_geometries[0]); i++) {
+            const goldilocks_448_comb_geometry_s *g = &comb_geometries[i];
+            size_t size = goldilocks_448_sizeof_precomputed_combs(g);
+            std::vector<unsigned char, SanitizingAllocator<unsigned char,64> > table(size);
+            goldilocks_448_precomputed_s *pre = (goldilocks_448_precomputed_s *)&table[0];
+            Point out;
+            char name[64];
+            goldilocks_448_precompute_combs(pre,g,q.p);
+            snprintf(name,sizeof(name),"Point precmp %u,%u,%u (%uk)",g->n,g->t,g->s,(unsigned)(size>>10));
+            for (Benchmark b(name); b.iter(); ) {
+                goldilocks_448_precomputed_combs_scalarmul(out.p,pre,g,s.s);
+            }
+        }
+    }
     for (Benchmark b("Point double scalarmul_v"); b.iter(); ) {
         s = Scalar(rng);
         t = Scalar(rng);
         p.non_secret_combo_with_base(s,t);
     }
+    {
+        Point expected = p.non_secret_combo_with_base(s,t);
+        for (Benchmark b("Point ds_v + eq"); b.iter(); ) {
+            (void)(p.non_secret_combo_with_base(s,t) == expected);
+        }
+        for (Benchmark b("Point ds_v eq (half-size)"); b.iter(); ) {
+            (void)p.non_secret_combo_with_base_eq(s,t,expected);
+        }
+    }
 }
 
 }; /* template <typename group> struct Benches */
@@ -211,11 +501,28 @@ static void micro() {
 template <typename Group> struct Macro { static void run() { Benches<Group>::macro(); } };
 template <typename Group> struct Micro { static void run() { Benches<Group>::micro(); } };
 
+/* Allocate and free small secure buffers, as a signing thread does */
+static void *secure_buffer_churn(void *) {
+    for (int i=0; i<10000; i++) {
+        SecureBuffer a(57), b(114);
+        a[0] = b[0] = 1;
+    }
+    return NULL;
+}
+
 int main(int argc, char **argv) {
 
     bool micro = false;
-    if (argc >= 2 && !strcmp(argv[1], "--micro"))
-        micro = true;
+    for (int i=1; i<argc; i++) {
+        if (!strcmp(argv[i], "--micro")) {
+            micro = true;
+        } else if (!strcmp(argv[i], "--only") && i+1 < argc) {
+            Benchmark::only.push_back(argv[++i]);
+        } else {
+            fprintf(stderr, "Usage: %s [--micro] [--only NAME]...\n", argv[0]);
+            return 1;
+        }
+    }
 
     SpongeRng rng(Block("micro-benchmarks"),SpongeRng::DETERMINISTIC);
     if (micro) {
@@ -228,6 +535,31 @@ int main(int argc, char **argv) {
         for (Benchmark b("SHAKE256 1kiB", 30); b.iter(); ) { shake2 += Buffer(b1024,1024); }
         for (Benchmark b("SHA3-512 1kiB", 30); b.iter(); ) { sha5 += Buffer(b1024,1024); }
 
+        {
+            SpongeRng det(Block("bench_rng"),SpongeRng::DETERMINISTIC), nondet;
+            FixedArrayBuffer<57> out;
+            for (Benchmark b("SpongeRng 57B", 30); b.iter(); ) { det.read(out); }
+            for (Benchmark b("SpongeRng 57B nondet", 30); b.iter(); ) { nondet.read(out); }
+            BufferedSpongeRng bdet(Block("bench_rng"),SpongeRng::DETERMINISTIC);
+            BufferedSpongeRng bnondet("/dev/urandom",32,SpongeRng::RANDOM,GOLDILOCKS_SPONGERNG_BUFFER_BYTES,1<<20,60);
+            for (Benchmark b("SpongeRng 57B buffered", 30); b.iter(); ) { bdet.read(out); }
+            for (Benchmark b("SpongeRng 57B nondet buffered", 30); b.iter(); ) { bnondet.read(out); }
+            CounterRng ctr(Block("bench_rng"));
+            for (Benchmark b("CounterRng 57B", 30); b.iter(); ) { ctr.read(out); }
+            for (Benchmark b("CounterRng seek and 57B", 30); b.iter(); ) { ctr.seek(ctr.tell()*7); ctr.read(out); }
+            ThreadRng trng;
+            for (Benchmark b("ThreadRng 57B", 30); b.iter(); ) { trng.read(out); }
+            for (Benchmark b("SpongeRng from /dev/urandom", 10); b.iter(); ) { SpongeRng r; r.read(out); }
+        }
+
+        for (Benchmark b("SecureBuffer 64B", 100); b.iter(); ) { SecureBuffer buf(64); }
+        for (Benchmark b("SecureBuffer 4kiB", 30); b.iter(); ) { SecureBuffer buf(4096); }
+        for (Benchmark b("SecureBuffer x20k, 8 threads", 0.1); b.iter(); ) {
+            pthread_t threads[8];
+            for (int i=0; i<8; i++) pthread_create(&threads[i],NULL,secure_buffer_churn,NULL);
+            for (int i=0; i<8; i++) pthread_join(threads[i],NULL);
+        }
+
         run_for_all_curves<Micro>();
     }
 
@@ -0,0 +1,71 @@
+/**
+ * @cond internal
+ * @file bench_lookup.c
+ * @copyright
+ *   Copyright (c) 2018 the libgoldilocks contributors.  \n
+ *   Released under the MIT License.  See LICENSE.txt for license information.
+ * @brief Benchmark the constant-time table lookup kernels in isolation.
+ *
+ * Built against the internal headers, since the lookups are inline.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "word.h"
+#include "constant_time.h"
+#include "lookup_kernels.h"
+
+#define NITER 2000
+#define NSAMPLES 50
+#define MAX_TABLE (32*256)
+
+static unsigned char table[MAX_TABLE] __attribute__((aligned(64)));
+static unsigned char out[256] __attribute__((aligned(64)));
+
+static inline uint64_t rdtsc(void) {
+#if defined(__x86_64__)
+    uint32_t lobits, hibits;
+    __asm__ __volatile__ ("rdtsc" : "=a"(lobits), "=d"(hibits));
+    return (lobits | ((uint64_t)(hibits) << 32));
+#else
+    return 0;
+#endif
+}
+
+/* Keep the lookups from being hoisted or thrown away. */
+#define BENCH(name, elem_bytes, n_table, lookup) do { \
+    uint64_t best = ~(uint64_t)0; \
+    int i, s; \
+    for (s=0; s<NSAMPLES; s++) { \
+        uint64_t start = rdtsc(); \
+        for (i=0; i<NITER; i++) { \
+            lookup(out, table, elem_bytes, n_table, i % n_table); \
+            __asm__ __volatile__ ("" : : "r"(out) : "memory"); \
+        } \
+        start = rdtsc() - start; \
+        if (start < best) best = start; \
+    } \
+    printf("%-30s %3d x %3d B: %8.1f cy\n", name, (int)n_table, (int)elem_bytes, \
+        (double)best / NITER); \
+} while(0)
+
+int main(void) {
+    unsigned i;
+    for (i=0; i<sizeof(table); i++) table[i] = (unsigned char)(i*73 + (i>>8));
+
+#ifdef CT_LOOKUP_VECTOR_BYTES
+    printf("Vector lookup kernel: %d-byte vectors\n", CT_LOOKUP_VECTOR_BYTES);
+#else
+    printf("No vector lookup kernel for this target\n");
+#endif
+    if (check_lookup_kernels()) return 1;
+
+    /* niels: combs of 5 teeth; pniels: the 5-bit signed window */
+    BENCH("constant_time_lookup_generic", 192, 16, constant_time_lookup_generic);
+    BENCH("constant_time_lookup",         192, 16, constant_time_lookup);
+    BENCH("constant_time_lookup_generic", 256, 16, constant_time_lookup_generic);
+    BENCH("constant_time_lookup",         256, 16, constant_time_lookup);
+    BENCH("constant_time_lookup_generic", 192, 32, constant_time_lookup_generic);
+    BENCH("constant_time_lookup",         192, 32, constant_time_lookup);
+    return 0;
+}
@@ -0,0 +1,53 @@
+/**
+ * @cond internal
+ * @file lookup_kernels.c
+ * @copyright
+ *   Copyright (c) 2018 the libgoldilocks contributors.  \n
+ *   Released under the MIT License.  See LICENSE.txt for license information.
+ * @brief Check the constant-time table lookup kernels against each other.
+ *
+ * Built against the internal headers, since the lookups are inline.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "word.h"
+#include "constant_time.h"
+#include "lookup_kernels.h"
+
+#define MAX_TABLE (64*256)
+
+static int check(const unsigned char *table, word_t elem_bytes, word_t n_table) {
+    unsigned char out[256] __attribute__((aligned(64)));
+    unsigned char expect[256] __attribute__((aligned(64)));
+    word_t idx;
+    int bad = 0;
+    for (idx=0; idx<n_table; idx++) {
+        constant_time_lookup(out, table, elem_bytes, n_table, idx);
+        constant_time_lookup_generic(expect, table, elem_bytes, n_table, idx);
+        if (memcmp(out, expect, elem_bytes) || memcmp(out, &table[idx*elem_bytes], elem_bytes)) {
+            printf("Lookup mismatch at %d x %d B, index %d\n",
+                (int)n_table, (int)elem_bytes, (int)idx);
+            bad++;
+        }
+    }
+    return bad;
+}
+
+int check_lookup_kernels(void) {
+    static unsigned char table[MAX_TABLE] __attribute__((aligned(64)));
+    unsigned i;
+    int bad = 0;
+    for (i=0; i<sizeof(table); i++) table[i] = (unsigned char)(i*73 + (i>>8));
+
+    /* niels: combs of 5 teeth; pniels: the 5-bit signed window */
+    bad += check(table, 192, 16);
+    bad += check(table, 256, 16);
+    bad += check(table, 192, 32);
+    /* Wider combs, and sizes which only the generic kernel handles */
+    bad += check(table, 192, 64);
+    bad += check(table, 64, 8);
+    bad += check(table, 56, 8);
+    bad += check(table, 120, 3);
+    return bad;
+}
@@ -0,0 +1,30 @@
+/**
+ * @cond internal
+ * @file lookup_kernels.h
+ * @copyright
+ *   Copyright (c) 2018 the libgoldilocks contributors.  \n
+ *   Released under the MIT License.  See LICENSE.txt for license information.
+ * @brief Check the constant-time table lookup kernels against each other.
+ */
+
+#ifndef __LOOKUP_KERNELS_H__
+#define __LOOKUP_KERNELS_H__ 1
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Check that constant_time_lookup, constant_time_lookup_generic and a plain
+ * copy agree, for every index of tables of the sizes the library uses and
+ * of some which the vector kernel doesn't handle.  Each mismatch is printed.
+ *
+ * @return The number of mismatches.
+ */
+int check_lookup_kernels(void);
+
+#ifdef __cplusplus
+} /* extern "C" */
+#endif
+
+#endif /* __LOOKUP_KERNELS_H__ */
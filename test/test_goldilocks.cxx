@@ -14,6 +14,11 @@
 #include <goldilocks/eddsa.hxx>
 #include <goldilocks/shake.hxx>
 #include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <sys/wait.h>
+#include <pthread.h>
+#include "lookup_kernels.h"
 
 using namespace goldilocks;
 
@@ -59,6 +64,7 @@ typedef typename Group::Scalar Scalar;
 typedef typename Group::Point Point;
 typedef typename Group::DhLadder DhLadder;
 typedef typename Group::Precomputed Precomputed;
+typedef typename Group::Point::Prepared Prepared;
 
 static void print(const char *name, const Scalar &x) {
     unsigned char buffer[Scalar::SER_BYTES];
@@ -302,6 +308,61 @@ static void test_elligator() {
             point_check(test,t,t,t,0,0,t,u,"elligator twiddle high bits");
         }
     }
+
+    /* All hints at once, against one at a time */
+    for (unsigned int i=0; i<NTESTS/10 && test.passing_now; i++) {
+        Point t = (i==0) ? Point::identity() : Point(rng);
+        for (unsigned int j=0; j<(i&3); j++) t = t.debugging_torque();
+        unsigned char all[NHINTS][Point::HASH_BYTES], one[2*Point::HASH_BYTES];
+        FixedArrayBuffer<Point::HASH_BYTES> second(rng);
+
+        uint32_t found = goldilocks_448_invert_elligator_nonuniform_all(all,t.p);
+        for (int j=0; j<NHINTS; j++) {
+            bool succ = goldilocks_successful(goldilocks_448_invert_elligator_nonuniform(one,t.p,j));
+            if (succ != bool(found>>j & 1) || (succ && memcmp(one,all[j],Point::HASH_BYTES))) {
+                test.fail();
+                printf("   All-hints Elligator inversion disagrees: i=%d, hint=%d\n",i,j);
+            }
+        }
+
+        found = goldilocks_448_invert_elligator_uniform_all(all,t.p,second.data());
+        for (int j=0; j<NHINTS; j++) {
+            memcpy(&one[Point::HASH_BYTES],second.data(),Point::HASH_BYTES);
+            bool succ = goldilocks_successful(goldilocks_448_invert_elligator_uniform(one,t.p,j));
+            if (succ != bool(found>>j & 1) || (succ && memcmp(one,all[j],Point::HASH_BYTES))) {
+                test.fail();
+                printf("   All-hints uniform Elligator inversion disagrees: i=%d, hint=%d\n",i,j);
+            }
+        }
+    }
+
+    /* Batches, across the internal chunk boundary, with and without affine outputs */
+    {
+        const size_t n = 37;
+        SecureBuffer hashes(n*2*Point::HASH_BYTES);
+        rng.read(hashes);
+        memset(&hashes[0],0,2*Point::HASH_BYTES); /* the identity */
+        std::vector<goldilocks_448_point_s, SanitizingAllocator<goldilocks_448_point_s, 32> > pts(n);
+        std::vector<goldilocks_448_affine_point_s> affine(n), affine2(n);
+        goldilocks_448_point_from_hash_uniform_batch(&pts[0],&affine2[0],hashes.data(),n);
+        goldilocks_448_point_from_hash_uniform_batch(NULL,&affine[0],hashes.data(),n);
+        for (size_t i=0; i<n && test.passing_now; i++) {
+            Point expect = Point::from_hash(Block(&hashes[i*2*Point::HASH_BYTES],2*Point::HASH_BYTES));
+            Point q((NOINIT()));
+            if (goldilocks_448_point_from_affine(q.p,&affine[i]) != GOLDILOCKS_SUCCESS) {
+                test.fail();
+                printf("    Batch hash affine output %d invalid\n", (int)i);
+            }
+            Point r((NOINIT()));
+            r.p[0] = pts[i];
+            point_check(test,expect,expect,expect,0,0,expect,r,"batch hash");
+            if (memcmp(&affine[i],&affine2[i],sizeof(affine[i]))) {
+                test.fail();
+                printf("    Batch hash affine outputs %d differ with and without points\n", (int)i);
+            }
+            point_check(test,expect,expect,expect,0,0,expect,q,"batch hash affine");
+        }
+    }
 }
 
 static void test_ec() {
@@ -399,7 +460,68 @@ static void test_ec() {
         point_check(test,p,q,r,x,y,y*p,d2,"dual mul 2");
 
         point_check(test,base,q,r,x,y,x*base+y*q,q.non_secret_combo_with_base(y,x),"ds vt mul");
+        point_check(test,base,q,r,x,y,y*q-base,q.non_secret_combo_with_base(y,-Scalar(1)),"ds vt mul -1");
+        if (!q.non_secret_combo_with_base_eq(y,x,x*base+y*q)
+            || q.non_secret_combo_with_base_eq(y,x,r)
+            || !q.non_secret_combo_with_base_eq(0,x,x*base)
+            || !q.non_secret_combo_with_base_eq(y,0,y*q)
+            || !q.non_secret_combo_with_base_eq(-Scalar(1),y,y*base-q)
+        ) {
+            test.fail();
+            printf("    Half-size ds vt check failed\n");
+        }
+        point_check(test,p,q,r,x,0,p*x,p.mul_vartime(x),"vt mul");
+        point_check(test,p,q,r,0,0,id,p.mul_vartime(Scalar(0)),"vt mul 0");
+
+        {
+            std::vector<Point> pts;
+            std::vector<Scalar> scs;
+            pts.push_back(p); scs.push_back(x);
+            pts.push_back(q); scs.push_back(y);
+            pts.push_back(r); scs.push_back(x*y);
+            point_check(test,p,q,r,x,y,x*p+y*q+(x*y)*r,Point::multiscalarmul(pts,scs),"multi mul");
+
+            /* More points than fit in one batch */
+            if (i%100 == 0) {
+                Point expected = Point::multiscalarmul(pts,scs);
+                for (int j=0; j<17; j++) {
+                    pts.push_back(Point(rng)); scs.push_back(Scalar(rng));
+                    expected += pts.back() * scs.back();
+                }
+                point_check(test,p,q,r,x,y,expected,Point::multiscalarmul(pts,scs),"multi mul 20");
+            }
+        }
         point_check(test,p,q,r,x,0,Precomputed(p)*x,p*x,"precomp mul");
+        point_check(test,p,q,r,x,y,x*p+y*q,
+            Precomputed::double_scalarmul(Precomputed(p),x,Precomputed(q),y),"precomp double mul");
+        point_check(test,p,q,r,x,y,x*base+y*q,
+            Precomputed::double_scalarmul(x,Precomputed::base(),y,Precomputed(q)),"precomp double mul base");
+        {
+            /* A comb geometry other than the built-in one */
+            const goldilocks_448_comb_geometry_s geometry = {6,5,15};
+            std::vector<unsigned char, SanitizingAllocator<unsigned char,64> >
+                table(goldilocks_448_sizeof_precomputed_combs(&geometry));
+            goldilocks_448_precomputed_s *pre = (goldilocks_448_precomputed_s *)&table[0];
+            Point out;
+            if (goldilocks_448_precompute_combs(pre,&geometry,p.p) != GOLDILOCKS_SUCCESS) {
+                test.fail();
+                printf("    Comb geometry rejected\n");
+            }
+            if (goldilocks_448_precomputed_combs_scalarmul(out.p,pre,&geometry,x.s) != GOLDILOCKS_SUCCESS) {
+                test.fail();
+                printf("    Comb geometry rejected by scalarmul\n");
+            }
+            point_check(test,p,q,r,x,0,out,p*x,"precomp combs");
+
+            const goldilocks_448_comb_geometry_s bad = {6,1,15};
+            if (goldilocks_448_sizeof_precomputed_combs(&bad) != 0
+                || goldilocks_448_precompute_combs(pre,&bad,p.p) != GOLDILOCKS_FAILURE
+                || goldilocks_448_precomputed_combs_scalarmul(out.p,pre,&bad,x.s) != GOLDILOCKS_FAILURE
+            ) {
+                test.fail();
+                printf("    Bad comb geometry accepted\n");
+            }
+        }
         point_check(test,p,q,r,0,0,r,
             Point::from_hash(Buffer(buffer).slice(0,Point::HASH_BYTES))
             + Point::from_hash(Buffer(buffer).slice(Point::HASH_BYTES,Point::HASH_BYTES)),
@@ -579,6 +701,33 @@ static void test_eddsa() {
             printf("    Signature validation failed on sig %d\n", i);
         }
 
+        /* The allocation-free and moving variants */
+        if (i < 100) {
+            typename EdDSA<Group>::Signature sig2 = priv.sign_fixed(message,context);
+            typename EdDSA<Group>::PrivateKey moved(static_cast<typename EdDSA<Group>::PrivateKey&&>(priv));
+            typename EdDSA<Group>::Signature sig3((NOINIT()));
+            moved.sign_into(sig3,message,context);
+            Point p(rng), q((NOINIT()));
+            q = static_cast<Point&&>(p);
+            if (!sig2.contents_equal(sig) || !sig3.contents_equal(sig)
+                || !priv.serialize_fixed().contents_equal(FixedArrayBuffer<EdDSA<Group>::PrivateKey::SER_BYTES>())
+                || !moved.pub().serialize_fixed().contents_equal(pub.serialize())
+                || p != Point::identity()
+                || !q.serialize_fixed().contents_equal(q.serialize())) {
+                test.fail();
+                printf("    Allocation-free or moved signing failed on sig %d\n", i);
+            }
+            priv = static_cast<typename EdDSA<Group>::PrivateKey&&>(moved);
+        }
+
+        /* A modified signature must not verify */
+        sig[i % sig.size()] ^= 1<<(i%8);
+        try {
+            pub.verify(sig,message,context);
+            test.fail();
+            printf("    Modified signature validated on sig %d\n", i);
+        } catch(CryptoException&) {}
+
         /* Test encode_like and torque */
         Point p(rng);
         SecureBuffer p1 = p.mul_by_ratio_and_encode_like_eddsa();
@@ -637,6 +786,125 @@ static void test_convert_eddsa_to_x() {
     }
 }
 
+static const Block h2c_dst_ro[], h2c_dst_nu[], h2c_msg[], h2c_ro_x[], h2c_ro_y[], h2c_nu_x[], h2c_nu_y[];
+
+static void test_hash_to_curve() {
+    Test test("Hash to curve");
+    SpongeRng rng(Block("test_hash_to_curve"),SpongeRng::DETERMINISTIC);
+
+    /* Vectors, one at a time and as a batch of one */
+    for (unsigned int t=0; h2c_ro_y[t].size(); t++) {
+        for (int ro=1; ro>=0; ro--) {
+            const Block &dst = ro ? h2c_dst_ro[t] : h2c_dst_nu[t];
+            const Block &x = ro ? h2c_ro_x[t] : h2c_nu_x[t], &y = ro ? h2c_ro_y[t] : h2c_nu_y[t];
+            const uint8_t *msg = h2c_msg[t].data();
+            size_t msg_len = h2c_msg[t].size();
+
+            /* The EdDSA encoding of (x,y): y little-endian, and the sign of x */
+            FixedArrayBuffer<GOLDILOCKS_EDDSA_448_PUBLIC_BYTES> expect;
+            for (unsigned i=0; i<y.size(); i++) expect[i] = y[y.size()-1-i];
+            expect[expect.size()-1] = (x[x.size()-1] & 1) << 7;
+
+            Point p((NOINIT()));
+            if (ro) {
+                goldilocks_ed448_hash_to_curve(p.p,msg,msg_len,dst.data(),dst.size());
+            } else {
+                goldilocks_ed448_encode_to_curve(p.p,msg,msg_len,dst.data(),dst.size());
+            }
+            SecureBuffer enc = p.mul_by_ratio_and_encode_like_eddsa();
+            FixedArrayBuffer<GOLDILOCKS_EDDSA_448_PUBLIC_BYTES> enc2;
+            goldilocks_ed448_hash_to_curve_batch(enc2.data(),NULL,&msg,&msg_len,1,dst.data(),dst.size(),ro);
+            if (!memeq(SecureBuffer(expect),enc) || !memeq(SecureBuffer(expect),SecureBuffer(enc2))) {
+                test.fail();
+                printf("    %s vector #%d disagrees.", ro ? "Hash to curve" : "Encode to curve", t);
+                printf("\n    Correct:   ");
+                for (unsigned i=0; i<expect.size(); i++) printf("%02x", expect[i]);
+                printf("\n    Incorrect: ");
+                for (unsigned i=0; i<enc.size(); i++) printf("%02x", enc[i]);
+                printf("\n");
+            }
+        }
+    }
+
+    /* A domain separation tag over 255 bytes is replaced by its hash */
+    {
+        const uint8_t msg[] = "abc";
+        std::string long_dst(256,'-');
+        SHAKE<256> hash;
+        hash << Block("H2C-OVERSIZE-DST-") << Block(long_dst);
+        SecureBuffer short_dst = hash.output(56);
+        for (int ro=0; ro<=1; ro++) {
+            FixedArrayBuffer<GOLDILOCKS_EDDSA_448_PUBLIC_BYTES> enc1, enc2;
+            const uint8_t *msgs[] = {msg};
+            size_t lens[] = {sizeof(msg)-1};
+            goldilocks_ed448_hash_to_curve_batch(enc1.data(),NULL,msgs,lens,1,
+                (const uint8_t *)long_dst.data(),long_dst.size(),ro);
+            goldilocks_ed448_hash_to_curve_batch(enc2.data(),NULL,msgs,lens,1,
+                short_dst.data(),short_dst.size(),ro);
+            if (!memeq(SecureBuffer(enc1),SecureBuffer(enc2))) {
+                test.fail();
+                printf("    Long domain separation tag isn't hashed (ro=%d)\n", ro);
+            }
+        }
+    }
+
+    /* Batches, across the internal chunk boundary, against one at a time */
+    {
+        const size_t n = 37, len = 40;
+        const uint8_t dst[] = "test_hash_to_curve batch";
+        SecureBuffer msgs(n*len);
+        rng.read(msgs);
+        std::vector<const uint8_t *> ptrs(n);
+        std::vector<size_t> lens(n);
+        for (size_t i=0; i<n; i++) {
+            ptrs[i] = &msgs[i*len];
+            lens[i] = i % (len+1);
+        }
+        for (int ro=0; ro<=1; ro++) {
+            SecureBuffer enc(n*GOLDILOCKS_EDDSA_448_PUBLIC_BYTES);
+            std::vector<goldilocks_448_point_s> pts(n);
+            goldilocks_ed448_hash_to_curve_batch(enc.data(),&pts[0],&ptrs[0],&lens[0],n,dst,sizeof(dst)-1,ro);
+            for (size_t i=0; i<n && test.passing_now; i++) {
+                Point expect((NOINIT())), q((NOINIT()));
+                if (ro) {
+                    goldilocks_ed448_hash_to_curve(expect.p,ptrs[i],lens[i],dst,sizeof(dst)-1);
+                } else {
+                    goldilocks_ed448_encode_to_curve(expect.p,ptrs[i],lens[i],dst,sizeof(dst)-1);
+                }
+                memcpy(q.p,&pts[i],sizeof(pts[i]));
+                point_check(test,expect,expect,expect,0,0,expect,q,"hash to curve batch");
+                SecureBuffer enc1 = expect.mul_by_ratio_and_encode_like_eddsa();
+                if (!memeq(enc1,SecureBuffer(Block(&enc[i*enc1.size()],enc1.size())))) {
+                    test.fail();
+                    printf("    Hash to curve batch encoding %d disagrees (ro=%d)\n", (int)i, ro);
+                }
+            }
+        }
+    }
+
+    /* Batch EdDSA encoding */
+    {
+        const size_t n = 37;
+        std::vector<goldilocks_448_point_s> pts(n);
+        for (size_t i=0; i<n; i++) {
+            Point p = (i==0) ? Point::identity() : Point(rng);
+            for (size_t j=0; j<(i&3); j++) p = p.debugging_torque();
+            memcpy(&pts[i],p.p,sizeof(pts[i]));
+        }
+        SecureBuffer enc(n*GOLDILOCKS_EDDSA_448_PUBLIC_BYTES);
+        goldilocks_448_point_mul_by_ratio_and_encode_like_eddsa_batch(enc.data(),&pts[0],n);
+        for (size_t i=0; i<n; i++) {
+            Point p((NOINIT()));
+            memcpy(p.p,&pts[i],sizeof(pts[i]));
+            SecureBuffer enc1 = p.mul_by_ratio_and_encode_like_eddsa();
+            if (!memeq(enc1,SecureBuffer(Block(&enc[i*enc1.size()],enc1.size())))) {
+                test.fail();
+                printf("    Batch EdDSA encoding %d disagrees\n", (int)i);
+            }
+        }
+    }
+}
+
 static void test_dalek_vectors() {
     Test test("Test vectors from Dalek");
     Point p = Point::base(), q;
@@ -654,15 +922,416 @@ static void test_dalek_vectors() {
     }
 }
 
+static void test_table_files() {
+    Test test("Table files");
+    SpongeRng rng(Block("test_table_files"),SpongeRng::DETERMINISTIC);
+    char path[] = "/tmp/goldilocks_table_XXXXXX";
+    int fd = mkstemp(path);
+    if (fd < 0) {
+        printf("    Can't create a temporary file, skipping\n");
+        return;
+    }
+    close(fd);
+
+    Point p(rng);
+    Scalar x(rng);
+
+    try {
+        Precomputed(p).save(path);
+        Precomputed mapped = Precomputed::map(path);
+        if (mapped * x != p * x) {
+            test.fail();
+            printf("    Mapped comb table gives the wrong product\n");
+        }
+    } catch (CryptoException&) {
+        test.fail();
+        printf("    Comb table save/map failed\n");
+    }
+
+    /* A wNAF file is not a comb file, and vice versa */
+    {
+        const unsigned int bits = 6;
+        std::vector<unsigned char, SanitizingAllocator<unsigned char,64> >
+            table(goldilocks_448_sizeof_precomputed_wnafs(bits));
+        const goldilocks_448_precomputed_wnafs_s *mapped;
+        const goldilocks_448_precomputed_s *combs;
+        goldilocks_448_comb_geometry_s geometry;
+        unsigned int mapped_bits = 0;
+        Point out;
+
+        if (GOLDILOCKS_SUCCESS != goldilocks_448_precompute_wnafs(
+                (goldilocks_448_precomputed_wnafs_s *)&table[0],bits,p.p)
+            || GOLDILOCKS_SUCCESS != goldilocks_448_precomputed_wnafs_save(
+                path,(const goldilocks_448_precomputed_wnafs_s *)&table[0],bits)
+            || GOLDILOCKS_SUCCESS != goldilocks_448_precomputed_wnafs_map(&mapped,&mapped_bits,path)
+        ) {
+            test.fail();
+            printf("    wNAF table save/map failed\n");
+        } else {
+            if (GOLDILOCKS_SUCCESS != goldilocks_448_precomputed_wnafs_scalarmul_non_secret(
+                    out.p,mapped,mapped_bits,x.s)
+                || mapped_bits != bits || out != p * x) {
+                test.fail();
+                printf("    Mapped wNAF table gives the wrong product\n");
+            }
+            const unsigned int bad_bits[] = {0, 9, 31};
+            for (unsigned int i=0; i<sizeof(bad_bits)/sizeof(bad_bits[0]); i++) {
+                Point unchanged = out;
+                if (GOLDILOCKS_FAILURE != goldilocks_448_precomputed_wnafs_scalarmul_non_secret(
+                        out.p,mapped,bad_bits[i],x.s)
+                    || out != unchanged) {
+                    test.fail();
+                    printf("    Mapped wNAF table used with table_bits=%u\n", bad_bits[i]);
+                }
+            }
+            goldilocks_448_precomputed_unmap(mapped);
+        }
+
+        if (GOLDILOCKS_SUCCESS == goldilocks_448_precomputed_map(&combs,&geometry,path)) {
+            test.fail();
+            printf("    wNAF table mapped as a comb table\n");
+            goldilocks_448_precomputed_unmap(combs);
+        }
+    }
+
+    /* Corruption is caught */
+    {
+        FILE *file = fopen(path,"r+b");
+        int c;
+        if (file && fseek(file,-7,SEEK_END) == 0 && (c = fgetc(file)) != EOF
+            && fseek(file,-7,SEEK_END) == 0 && fputc(c^4,file) != EOF && fclose(file) == 0) {
+            const goldilocks_448_precomputed_wnafs_s *mapped;
+            unsigned int mapped_bits;
+            if (GOLDILOCKS_SUCCESS == goldilocks_448_precomputed_wnafs_map(&mapped,&mapped_bits,path)) {
+                test.fail();
+                printf("    Corrupted table was mapped\n");
+                goldilocks_448_precomputed_unmap(mapped);
+            }
+        } else {
+            test.fail();
+            printf("    Can't modify table file\n");
+        }
+    }
+
+    unlink(path);
+}
+
+static void test_workspace() {
+    Test test("Workspaces");
+    SpongeRng rng(Block("test_workspace"),SpongeRng::DETERMINISTIC);
+    std::vector<unsigned char, SanitizingAllocator<unsigned char,64> >
+        workspace(goldilocks_448_sizeof_workspace()),
+        table1(goldilocks_448_sizeof_precomputed_s),
+        table2(goldilocks_448_sizeof_precomputed_s);
+    void *ws = &workspace[0];
+
+    for (int i=0; i<NTESTS/10 && test.passing_now; i++) {
+        Point p(rng), q(rng), d1, d2, e1, e2;
+        Scalar x(rng), y(rng);
+
+        goldilocks_448_point_scalarmul_ws(d1.p,p.p,x.s,ws);
+        point_check(test,p,q,q,x,0,d1,p*x,"mul ws");
+
+        goldilocks_448_point_double_scalarmul_ws(d1.p,p.p,x.s,q.p,y.s,ws);
+        point_check(test,p,q,q,x,y,d1,Point::double_scalarmul(x,p,y,q),"double mul ws");
+
+        goldilocks_448_point_dual_scalarmul_ws(d1.p,d2.p,p.p,x.s,y.s,ws);
+        p.dual_scalarmul(e1,e2,x,y);
+        point_check(test,p,q,q,x,y,d1,e1,"dual mul ws 1");
+        point_check(test,p,q,q,x,y,d2,e2,"dual mul ws 2");
+
+        {
+            /* More points than fit in the workspace at once */
+            std::vector<Point> pts;
+            std::vector<Scalar> scs;
+            std::vector<goldilocks_448_point_s, SanitizingAllocator<goldilocks_448_point_s, 32> > ps;
+            std::vector<goldilocks_448_scalar_s> ss;
+            for (int j=0; j<20; j++) {
+                pts.push_back(Point(rng)); scs.push_back(Scalar(rng));
+                ps.push_back(pts.back().p[0]); ss.push_back(scs.back().s[0]);
+            }
+            goldilocks_448_point_multiscalarmul_ws(d1.p,&ps[0],&ss[0],ps.size(),ws);
+            point_check(test,p,q,q,x,y,d1,Point::multiscalarmul(pts,scs),"multi mul ws");
+        }
+
+        goldilocks_448_precompute((goldilocks_448_precomputed_s *)&table1[0],p.p);
+        goldilocks_448_precompute_ws((goldilocks_448_precomputed_s *)&table2[0],p.p,ws);
+        if (table1 != table2) {
+            test.fail();
+            printf("    Precompute in a workspace gives a different table\n");
+        }
+
+        for (size_t j=0; j<workspace.size(); j++) {
+            if (workspace[j]) {
+                test.fail();
+                printf("    Workspace not erased at byte %d\n", (int)j);
+                break;
+            }
+        }
+    }
+}
+
+static void test_resumable() {
+    Test test("Resumable scalarmul");
+    SpongeRng rng(Block("test_resumable"),SpongeRng::DETERMINISTIC);
+    std::vector<unsigned char, SanitizingAllocator<unsigned char,64> >
+        state_buf(goldilocks_448_sizeof_scalarmul_state);
+    goldilocks_448_scalarmul_state_s *state = (goldilocks_448_scalarmul_state_s *)&state_buf[0];
+
+    for (int i=0; i<NTESTS/100 && test.passing_now; i++) {
+        Point p(rng), q(rng), out;
+        Scalar x(rng);
+        FixedArrayBuffer<DhLadder::PUBLIC_BYTES> base(rng);
+        FixedArrayBuffer<DhLadder::PRIVATE_BYTES> scalar(rng);
+        uint8_t shared[DhLadder::PUBLIC_BYTES], expected[DhLadder::PUBLIC_BYTES];
+        unsigned int left = ~0u, now;
+
+        /* Run in uneven chunks, and leave some steps for finish */
+        goldilocks_448_point_scalarmul_start(state,p.p,x.s);
+        while (left > (unsigned)i%3) {
+            now = goldilocks_448_scalarmul_resume(state,1+i%7);
+            if (now >= left) {
+                test.fail();
+                printf("    Resume made no progress\n");
+                break;
+            }
+            left = now;
+        }
+        goldilocks_448_point_scalarmul_finish(out.p,state);
+        point_check(test,p,q,q,x,0,out,p*x,"resumable mul");
+
+        goldilocks_448_precomputed_scalarmul_start(state,goldilocks_448_precomputed_base,x.s);
+        while (goldilocks_448_scalarmul_resume(state,1+i%4)) {}
+        goldilocks_448_point_scalarmul_finish(out.p,state);
+        point_check(test,p,q,q,x,0,out,Precomputed::base()*x,"resumable precomp mul");
+
+        goldilocks_x448_start(state,base.data(),scalar.data());
+        while (goldilocks_448_scalarmul_resume(state,1+i*13%64)) {}
+        if (goldilocks_x448_finish(shared,state)
+                != goldilocks_x448(expected,base.data(),scalar.data())
+            || memcmp(shared,expected,sizeof(shared))) {
+            test.fail();
+            printf("    Resumable X448 differs\n");
+        }
+    }
+}
+
+static void test_prepared() {
+    Test test("Prepared points");
+    SpongeRng rng(Block("test_prepared"),SpongeRng::DETERMINISTIC);
+
+    for (int i=0; i<NTESTS/10 && test.passing_now; i++) {
+        std::vector<Point> points;
+        size_t n = 1 + i%40; /* crosses a normalization batch */
+        for (size_t j=0; j<n; j++) {
+            if (j%7 == 3) points.push_back(Point::identity());
+            else if (j%7 == 5) points.push_back(points[j-1]);
+            else points.push_back(Point(rng));
+        }
+        std::vector<Prepared> prepared = Prepared::batch(points);
+
+        Point sum, diff, expect_sum, expect_diff;
+        for (size_t j=0; j<n; j++) {
+            Prepared one(points[j]);
+            Point p(rng);
+            point_check(test,p,points[j],points[j],0,0,p+one,p+points[j],"add prepared");
+            point_check(test,p,points[j],points[j],0,0,p-one,p-points[j],"sub prepared");
+            sum += prepared[j];
+            diff -= prepared[j];
+            expect_sum += points[j];
+            expect_diff -= points[j];
+        }
+        point_check(test,sum,sum,sum,0,0,sum,expect_sum,"add batch-prepared");
+        point_check(test,diff,diff,diff,0,0,diff,expect_diff,"sub batch-prepared");
+    }
+}
+
+static void test_sum() {
+    Test test("Point sums");
+    SpongeRng rng(Block("test_sum"),SpongeRng::DETERMINISTIC);
+    /* The last size is split among threads, if the host has the cores. */
+    const size_t sizes[] = {0, 1, 2, 7, 64, 2*512+3};
+    std::vector<Point> points;
+
+    for (size_t i=0; i<sizeof(sizes)/sizeof(sizes[0]) && test.passing_now; i++) {
+        while (points.size() < sizes[i]) points.push_back(Point(rng));
+        Point expect = Point::identity();
+        for (size_t j=0; j<points.size(); j++) expect += points[j];
+        Point sum = Point::sum(points);
+        point_check(test,sum,sum,sum,0,0,sum,expect,"point sum");
+    }
+
+    /* In place */
+    std::vector<goldilocks_448_point_s, SanitizingAllocator<goldilocks_448_point_s, 32> > ps(3);
+    for (size_t j=0; j<ps.size(); j++) ps[j] = points[j].p[0];
+    goldilocks_448_point_sum(&ps[1],&ps[0],ps.size());
+    Point in_place((NOINIT())), expect = points[0]+points[1]+points[2];
+    in_place.p[0] = ps[1];
+    point_check(test,in_place,in_place,in_place,0,0,in_place,expect,"point sum in place");
+}
+
+static void test_expressions() {
+    Test test("Point expressions");
+    SpongeRng rng(Block("test_expressions"),SpongeRng::DETERMINISTIC);
+
+    for (int i=0; i<NTESTS/10 && test.passing_now; i++) {
+        Point p(rng), q(rng), r(rng), t(rng);
+        Scalar a(rng), b(rng), c(rng), d(rng);
+        if (i == 1) b = 0;
+        if (i == 2) q = p;
+        Precomputed pp(p), pq(q);
+        Point base = Point::base();
+
+        point_check(test,p,q,r,a,b,p.scaled_by(a),p*a,"one point");
+        point_check(test,p,q,r,a,b,p.scaled_by(a).non_secret(),p*a,"one point non_secret");
+        point_check(test,p,q,r,a,b,p.scaled_by(a)+q.scaled_by(b),p*a+q*b,"two points");
+        point_check(test,p,q,r,a,b,p.scaled_by(a)-q.scaled_by(b),p*a-q*b,"difference");
+        point_check(test,p,q,r,a,b,-p.scaled_by(a),-(p*a),"negation");
+        point_check(test,p,q,r,a,b,p.scaled_by(a)+q.scaled_by(b)+r.scaled_by(c)+t.scaled_by(d),
+            p*a+q*b+r*c+t*d,"four points");
+        point_check(test,p,q,r,a,b,(p.scaled_by(a)+q.scaled_by(b)+r.scaled_by(c)).non_secret(),
+            p*a+q*b+r*c,"three points non_secret");
+        point_check(test,p,q,r,a,b,pp.scaled_by(a),p*a,"one table");
+        point_check(test,p,q,r,a,b,pp.scaled_by(a)+pq.scaled_by(b),p*a+q*b,"two tables");
+        point_check(test,p,q,r,a,b,pp.scaled_by(a)-pq.scaled_by(b)+Precomputed::base().scaled_by(c),
+            p*a-q*b+base*c,"three tables");
+        point_check(test,p,q,r,a,b,r+p.scaled_by(a),r+p*a,"point plus");
+        point_check(test,p,q,r,a,b,r-(p.scaled_by(a)-pq.scaled_by(b)+t),r-p*a+q*b-t,"point minus");
+        point_check(test,p,q,r,a,b,
+            r.scaled_by(c)+pp.scaled_by(a)-t+t.scaled_by(d)+Precomputed::base().scaled_by(b)-q,
+            r*c+p*a-t+t*d+base*b-q,"mixed");
+
+        Point sum = q;
+        sum += p.scaled_by(a) + pq.scaled_by(b);
+        point_check(test,p,q,r,a,b,sum,q+p*a+q*b,"add in place");
+        if (!(p.scaled_by(a)+q.scaled_by(b) == p*a+q*b) || (p.scaled_by(a) != p*a)) {
+            test.fail();
+            printf("    Expression comparison is wrong\n");
+        }
+
+        /* The operators are eager, and compose as Points */
+        Point pa = p*a;
+        pa *= b;
+        point_check(test,p,q,r,a,b,p*a*b,pa,"chained product");
+        point_check(test,p,q,r,a,b,(p*a).times_two(),p*a+a*p,"product method");
+        point_check(test,p,q,r,a,b,-(a*pp),-(p*a),"negated product");
+    }
+}
+
+static void test_affine() {
+    Test test("Affine points");
+    SpongeRng rng(Block("test_affine"),SpongeRng::DETERMINISTIC);
+
+    /* The identity, and more points than one batch converts at once */
+    std::vector<goldilocks_448_point_s, SanitizingAllocator<goldilocks_448_point_s, 32> > ps;
+    std::vector<goldilocks_448_scalar_s> ss;
+    std::vector<Point> pts;
+    std::vector<Scalar> scs;
+    pts.push_back(Point::identity());
+    for (int j=0; j<40; j++) pts.push_back(Point(rng));
+    for (size_t j=0; j<pts.size(); j++) {
+        scs.push_back(Scalar(rng));
+        ps.push_back(pts[j].p[0]);
+        ss.push_back(scs[j].s[0]);
+    }
+
+    std::vector<goldilocks_448_affine_point_s> affine(ps.size());
+    goldilocks_448_point_to_affine_batch(&affine[0],&ps[0],ps.size());
+    for (size_t j=0; j<affine.size() && test.passing_now; j++) {
+        Point q((NOINIT()));
+        goldilocks_448_affine_point_p one;
+        goldilocks_448_point_to_affine(one,pts[j].p);
+        if (memcmp(one,&affine[j],sizeof(one))
+            || goldilocks_448_point_from_affine(q.p,&affine[j]) != GOLDILOCKS_SUCCESS
+        ) {
+            test.fail();
+            printf("    Affine conversion failed on point %d\n", (int)j);
+        }
+        point_check(test,pts[j],q,q,0,0,pts[j],q,"affine round trip");
+    }
+
+    /* Non-canonical and off-curve coordinates */
+    {
+        Point q((NOINIT()));
+        goldilocks_448_affine_point_p bad;
+        memcpy(bad,&affine[1],sizeof(bad));
+        memset(bad->x,0xff,sizeof(bad->x));
+        if (goldilocks_448_point_from_affine(q.p,bad) != GOLDILOCKS_FAILURE) {
+            test.fail();
+            printf("    Non-canonical affine point accepted\n");
+        }
+        memcpy(bad,&affine[1],sizeof(bad));
+        bad->y[0] ^= 1;
+        if (goldilocks_448_point_from_affine(q.p,bad) != GOLDILOCKS_FAILURE) {
+            test.fail();
+            printf("    Off-curve affine point accepted\n");
+        }
+    }
+
+    {
+        Point combo((NOINIT()));
+        if (goldilocks_448_point_multiscalarmul_affine(combo.p,&affine[0],&ss[0],affine.size()) != GOLDILOCKS_SUCCESS) {
+            test.fail();
+            printf("    Affine multiscalarmul rejected valid points\n");
+        }
+        point_check(test,pts[1],pts[2],pts[3],scs[1],scs[2],
+            Point::multiscalarmul(pts,scs),combo,"multi mul affine");
+
+        std::vector<goldilocks_448_affine_point_s> bad(affine);
+        bad[bad.size()-1].y[0] ^= 1;
+        if (goldilocks_448_point_multiscalarmul_affine(combo.p,&bad[0],&ss[0],bad.size()) != GOLDILOCKS_FAILURE) {
+            test.fail();
+            printf("    Affine multiscalarmul accepted an off-curve point\n");
+        }
+    }
+
+    for (int i=0; i<NTESTS/10 && test.passing_now; i++) {
+        typename EdDSA<Group>::PrivateKey priv(rng);
+        SecureBuffer pub = priv.pub().serialize();
+        SecureBuffer message(i);
+        rng.read(message);
+        SecureBuffer sig = priv.sign(message);
+
+        goldilocks_448_point_p pk;
+        goldilocks_448_affine_point_p pk_affine;
+        if (goldilocks_448_point_decode_like_eddsa_and_mul_by_ratio(pk,pub.data()) != GOLDILOCKS_SUCCESS) {
+            test.fail();
+            printf("    Public key didn't decode\n");
+            break;
+        }
+        goldilocks_448_point_to_affine(pk_affine,pk);
+
+        for (int bad=0; bad<2; bad++) {
+            if (bad) sig[i % sig.size()] ^= 1<<(i%8);
+            goldilocks_error_t expect = goldilocks_ed448_verify(sig.data(),pub.data(),
+                message.data(),message.size(),0,NULL,0);
+            goldilocks_error_t with_point = goldilocks_ed448_verify_with_point(sig.data(),pub.data(),
+                pk_affine,message.data(),message.size(),0,NULL,0);
+            if (with_point != expect || expect != (bad ? GOLDILOCKS_FAILURE : GOLDILOCKS_SUCCESS)) {
+                test.fail();
+                printf("    Verify with point disagrees on sig %d\n", i);
+            }
+        }
+    }
+}
+
 static void run() {
     printf("Testing %s:\n",Group::name());
     test_arithmetic();
     test_elligator();
     test_ec();
+    test_prepared();
+    test_sum();
+    test_expressions();
+    test_affine();
+    test_table_files();
+    test_workspace();
+    test_resumable();
     test_eddsa();
     test_convert_eddsa_to_x();
     test_cfrg_crypto();
     test_cfrg_vectors();
+    test_hash_to_curve();
     test_dalek_vectors();
     printf("\n");
 }
@@ -692,6 +1361,21 @@ static void test_xof() {
     }
 }
 
+/** Part of a stream, generated on its own thread */
+struct CounterJob {
+    uint64_t stream, position;
+    unsigned char *out;
+    size_t len;
+};
+
+static void *counter_job(void *arg) {
+    CounterJob *job = (CounterJob *)arg;
+    CounterRng rng(Block("test_rng"),job->stream);
+    rng.seek(job->position);
+    rng.read(Buffer(job->out,job->len));
+    return NULL;
+}
+
 static void test_rng() {
     Test test("RNG");
     SpongeRng rng_d1(Block("test_rng"),SpongeRng::DETERMINISTIC);
@@ -736,6 +1420,183 @@ static void test_rng() {
         test.fail();
         printf("  Deterministic matched with different data!\n");
     }
+
+    /* Buffered mode hands out the same stream however it's split up */
+    BufferedSpongeRng rng_b1(Block("test_rng"),SpongeRng::DETERMINISTIC,100);
+    BufferedSpongeRng rng_b2(Block("test_rng"),SpongeRng::DETERMINISTIC,100);
+    SpongeRng rng_u(Block("test_rng"),SpongeRng::DETERMINISTIC);
+    s1 = rng_b1.read(1000);
+    s2 = SecureBuffer(1000);
+    for (size_t i=0, n=1; i<s2.size(); i+=n, n=n*3%97+1) {
+        if (n > s2.size()-i) n = s2.size()-i;
+        rng_b2.read(Buffer(&s2[i],n));
+    }
+    if (s1 != s2) {
+        test.fail();
+        printf("  Buffered RNG depends on read sizes!\n");
+    }
+    if (rng_u.read(1000) == s1) {
+        test.fail();
+        printf("  Buffered RNG matched unbuffered!\n");
+    }
+    rng_b1.stir("hello");
+    rng_b2.stir("jello");
+    if (rng_b1.read(16) == rng_b2.read(16)) {
+        test.fail();
+        printf("  Buffered RNG ignored stir!\n");
+    }
+
+    BufferedSpongeRng rng_n3("/dev/urandom",32,SpongeRng::RANDOM,GOLDILOCKS_SPONGERNG_BUFFER_BYTES,64,1);
+    BufferedSpongeRng rng_n4;
+    for (int i=0; i<5; i++) {
+        s1 = rng_n3.read(16<<i);
+        s2 = rng_n4.read(16<<i);
+        if (s1 == s2) {
+            test.fail();
+            printf("  Nondeterministic buffered RNG matched!\n");
+        }
+    }
+
+    /* Counter mode: a known answer, and the same stream split across threads */
+    {
+        static const uint8_t expect[32] = {
+            0xde,0xae,0xd3,0x02,0x85,0xfb,0x8d,0xc8,
+            0xc5,0x94,0xb8,0x0d,0x0a,0x57,0x6f,0xce,
+            0xbe,0x99,0x9f,0x06,0x46,0x14,0x35,0x09,
+            0x33,0xce,0x08,0x8a,0x44,0x96,0x79,0x34
+        };
+        CounterRng ctr(Block("test_rng"),3);
+        ctr.seek(130);
+        if (ctr.read(32) != SecureBuffer(Block(expect,sizeof(expect))) || ctr.tell() != 162) {
+            test.fail();
+            printf("  Counter RNG known answer disagrees!\n");
+        }
+
+        const int nthreads = 4;
+        CounterRng whole(Block("test_rng"),3);
+        s1 = whole.read(1000);
+        s2 = SecureBuffer(1000);
+        pthread_t threads[nthreads];
+        bool started[nthreads];
+        CounterJob jobs[nthreads];
+        for (int i=0; i<nthreads; i++) {
+            size_t start = s2.size()*i/nthreads, end = s2.size()*(i+1)/nthreads;
+            CounterJob job = { 3, start, &s2[start], end-start };
+            jobs[i] = job;
+            started[i] = !pthread_create(&threads[i],NULL,counter_job,&jobs[i]);
+            if (!started[i]) counter_job(&jobs[i]);
+        }
+        for (int i=0; i<nthreads; i++) if (started[i]) pthread_join(threads[i],NULL);
+        if (s1 != s2) {
+            test.fail();
+            printf("  Counter RNG differs when split across threads!\n");
+        }
+
+        CounterRng other(Block("test_rng"),4);
+        if (other.read(1000) == s1) {
+            test.fail();
+            printf("  Counter RNG streams matched!\n");
+        }
+    }
+
+    /* The thread RNG must not repeat itself in a child process */
+    ThreadRng rng_t;
+    s1 = rng_t.read(32);
+    if (s1 == Rng::thread_default().read(32)) {
+        test.fail();
+        printf("  Thread RNG repeated itself!\n");
+    }
+    int fds[2];
+    if (pipe(fds) == 0) {
+        pid_t pid = fork();
+        if (pid == 0) {
+            s1 = rng_t.read(32);
+            ssize_t ret = write(fds[1], s1.data(), s1.size());
+            _exit(ret == (ssize_t)s1.size() ? 0 : 1);
+        }
+        s1 = SecureBuffer(32);
+        s2 = rng_t.read(32);
+        if (pid < 0 || read(fds[0], s1.data(), s1.size()) != (ssize_t)s1.size() || s1 == s2) {
+            test.fail();
+            printf("  Thread RNG repeated itself across fork!\n");
+        }
+        if (pid > 0) waitpid(pid, NULL, 0);
+        close(fds[0]);
+        close(fds[1]);
+    }
+}
+
+static bool all_zero(const void *p, size_t size) {
+    for (size_t i=0; i<size; i++) if (((const unsigned char *)p)[i]) return false;
+    return true;
+}
+
+/* Free blocks which another thread allocated, and allocate new ones */
+static void *secure_alloc_job(void *arg) {
+    std::vector<void *> *ptrs = (std::vector<void *> *)arg;
+    for (size_t i=0; i<ptrs->size(); i++) {
+        goldilocks_secure_free((*ptrs)[i], 100);
+        (*ptrs)[i] = goldilocks_secure_alloc(100, 0);
+        if ((*ptrs)[i]) memset((*ptrs)[i], 0xa5, 100);
+    }
+    return NULL;
+}
+
+static void test_secure_alloc() {
+    Test test("Secure allocation");
+    const size_t sizes[] = {0, 1, 57, 64, 65, 1000, 15360, 32768, 32769, 100000};
+    const size_t alignments[] = {0, 8, 32, 64, 4096, 65536};
+
+    for (size_t i=0; i<sizeof(sizes)/sizeof(sizes[0]); i++) {
+        for (size_t j=0; j<sizeof(alignments)/sizeof(alignments[0]); j++) {
+            size_t size = sizes[i], align = alignments[j];
+            unsigned char *p = (unsigned char *)goldilocks_secure_alloc(size, align);
+            bool pooled = std::max(size, align) <= 32768;
+            if (!p || (align && (uintptr_t)p % align) || !all_zero(p, size)
+                || pooled != !!goldilocks_secure_is_pooled(p)) {
+                test.fail();
+                printf("  Bad secure allocation of %d bytes aligned to %d\n", (int)size, (int)align);
+            }
+            if (p) memset(p, 0xff, size);
+            goldilocks_secure_free(p, size);
+        }
+    }
+
+    /* Released blocks are reused, zeroed */
+    for (int i=0; i<100 && test.passing_now; i++) {
+        void *p = goldilocks_secure_alloc(200, 0);
+        if (!p || !all_zero(p, 200)) {
+            test.fail();
+            printf("  Reused secure allocation wasn't zeroed\n");
+        }
+        if (p) memset(p, 0xff, 200);
+        goldilocks_secure_free(p, 200);
+    }
+
+    /* Blocks can move between threads */
+    std::vector<void *> ptrs(1000);
+    for (size_t i=0; i<ptrs.size(); i++) ptrs[i] = goldilocks_secure_alloc(100, 0);
+    pthread_t thread;
+    if (!pthread_create(&thread,NULL,secure_alloc_job,&ptrs)) pthread_join(thread,NULL);
+    for (size_t i=0; i<ptrs.size(); i++) {
+        if (!ptrs[i] || !goldilocks_secure_is_pooled(ptrs[i])) {
+            test.fail();
+            printf("  Secure allocation from another thread failed\n");
+            break;
+        }
+    }
+    for (size_t i=0; i<ptrs.size(); i++) goldilocks_secure_free(ptrs[i], 100);
+
+    SecureBuffer buf(57);
+    if (!goldilocks_secure_is_pooled(buf.data())) {
+        test.fail();
+        printf("  SecureBuffer isn't in the secure pool\n");
+    }
+}
+
+static void test_lookup_kernels() {
+    Test test("Table lookup kernels");
+    if (check_lookup_kernels()) test.fail();
 }
 
 #include "vectors.inc.cxx"
@@ -743,6 +1604,8 @@ static void test_rng() {
 int main(int argc, char **argv) {
     (void) argc; (void) argv;
     test_rng();
+    test_secure_alloc();
+    test_lookup_kernels();
     test_xof<SHAKE<128> >();
     test_xof<SHAKE<256> >();
     printf("\n");
@@ -749,3 +749,250 @@ template<> const Block Tests<Ed448Goldilocks>::eddsa_sig[] = {
     // RFC 8032 - test vector 9 - 1023 octet
     Block(ed448_eddsa_sig[10],114)
 };
+
+/* RFC 9380 appendix J.5: the edwards448_XOF:SHAKE256_ELL2_RO_ (J.5.1) and
+ * edwards448_XOF:SHAKE256_ELL2_NU_ (J.5.2) vectors.  P.x and P.y are as
+ * printed there, big-endian.
+ */
+
+const uint8_t h2c_ro_448_x[][56] = {{
+    0x73,0x03,0x6d,0x4a,0x88,0x94,0x9c,0x03,
+    0x2f,0x01,0x50,0x70,0x05,0xc1,0x33,0x88,
+    0x4e,0x2f,0x0d,0x81,0xf9,0xa9,0x50,0x82,
+    0x62,0x45,0xdd,0xa9,0xe8,0x44,0xfc,0x78,
+    0x18,0x6c,0x39,0xda,0xaa,0x71,0x47,0xea,
+    0xd3,0xe4,0x62,0xcf,0xf6,0x0e,0x9c,0x63,
+    0x40,0xb5,0x81,0x34,0x48,0x0b,0x4d,0x17
+},{
+    0x4e,0x01,0x58,0xac,0xac,0xff,0xa5,0x45,
+    0xad,0xb8,0x18,0xa6,0xed,0x8e,0x0b,0x87,
+    0x0e,0x6a,0xbc,0x24,0xdf,0xc1,0xdc,0x45,
+    0xcf,0x9a,0x05,0x2e,0x98,0x46,0x92,0x75,
+    0xd9,0xff,0x0c,0x16,0x8d,0x6a,0x5a,0xc7,
+    0xec,0x05,0xb7,0x42,0x41,0x2e,0xe0,0x90,
+    0x58,0x1f,0x12,0xaa,0x39,0x8f,0x9f,0x8c
+},{
+    0x2c,0x25,0xb4,0x50,0x3f,0xad,0xc9,0x4b,
+    0x27,0x39,0x19,0x33,0xb5,0x57,0xab,0xde,
+    0xcc,0x60,0x1c,0x13,0xed,0x51,0xc5,0xde,
+    0x68,0x38,0x94,0x84,0xf9,0x3d,0xbd,0x6c,
+    0x22,0xe5,0xf9,0x62,0xd9,0xba,0xbf,0x7a,
+    0x39,0xf3,0x9f,0x99,0x43,0x12,0xf8,0xca,
+    0x23,0x34,0x48,0x47,0xe1,0xfb,0xf1,0x76
+},{
+    0xa1,0x86,0x1a,0x94,0x64,0xae,0x31,0x24,
+    0x9a,0x0e,0x60,0xbf,0x38,0x79,0x1f,0x36,
+    0x63,0x04,0x9a,0x3f,0x53,0x78,0x99,0x84,
+    0x99,0xa8,0x32,0x92,0xe1,0x59,0xa2,0xfe,
+    0xcf,0xf8,0x38,0xeb,0x9b,0xc6,0x93,0x9e,
+    0x5c,0x6a,0xe7,0x6e,0xb0,0x74,0xad,0x4a,
+    0xae,0x39,0xb5,0x5b,0x72,0xca,0x0b,0x9a
+},{
+    0x98,0x7c,0x5a,0xc1,0x9d,0xd4,0xb4,0x78,
+    0x35,0x46,0x6a,0x50,0xb2,0xd9,0xfe,0xba,
+    0x7c,0x84,0x91,0xb8,0x88,0x5a,0x04,0xed,
+    0xf5,0x77,0xe1,0x5a,0x9f,0x2c,0x98,0xb2,
+    0x03,0xec,0x2c,0xd3,0xe5,0x39,0x0b,0x3d,
+    0x20,0xbb,0xa0,0xfa,0x6f,0xc3,0xee,0xce,
+    0xfb,0x50,0x29,0xa3,0x17,0x23,0x44,0x01
+}};
+
+const uint8_t h2c_ro_448_y[][56] = {{
+    0x94,0xc1,0xd6,0x1b,0x43,0x72,0x8e,0x5d,
+    0x78,0x4e,0xf4,0xfc,0xb1,0xf3,0x8e,0x10,
+    0x75,0xf3,0xae,0xf5,0xe9,0x98,0x66,0x91,
+    0x1d,0xe5,0xa2,0x34,0xf1,0xaa,0xfd,0xc2,
+    0x6b,0x55,0x43,0x44,0x74,0x2e,0x6b,0xa0,
+    0x42,0x0b,0x71,0xb2,0x98,0x67,0x1b,0xbe,
+    0xb2,0xb7,0x73,0x66,0x18,0x63,0x46,0x10
+},{
+    0x89,0x4d,0x3f,0xa4,0x37,0xb2,0xd2,0xe2,
+    0x8c,0xdc,0x3b,0xfa,0xad,0xe0,0x35,0x43,
+    0x0f,0x35,0x0e,0xc5,0x23,0x9b,0x6b,0x40,
+    0x6b,0x55,0x01,0xda,0x6f,0x6d,0x62,0x10,
+    0xff,0x26,0x71,0x9c,0xad,0x83,0xb6,0x3e,
+    0x97,0xab,0x26,0xa1,0x2d,0xf6,0xde,0xc8,
+    0x51,0xd6,0xbf,0x38,0xe2,0x94,0xaf,0x9a
+},{
+    0xd5,0xe6,0xf5,0x35,0x0f,0x43,0x0e,0x53,
+    0xa1,0x10,0xf5,0xac,0x7f,0xcc,0x82,0xa9,
+    0x6c,0xb8,0x65,0xae,0xca,0x98,0x20,0x29,
+    0x52,0x2d,0x32,0x60,0x1e,0x41,0xc0,0x42,
+    0xa9,0xdf,0xbd,0xfb,0xef,0xa2,0xb0,0xbd,
+    0xcd,0xc3,0xbc,0x58,0xcc,0xa8,0xa7,0xcd,
+    0x54,0x68,0x03,0x08,0x3d,0x3a,0x85,0x48
+},{
+    0x58,0x0a,0x27,0x98,0xc5,0xb9,0x04,0xf8,
+    0xad,0xfe,0xc5,0xbd,0x29,0xfb,0x49,0xb4,
+    0x63,0x3c,0xd9,0xf8,0xc2,0x93,0x5e,0xb4,
+    0xa0,0xf1,0x2e,0x5d,0xfa,0x02,0x85,0x68,
+    0x08,0x80,0x29,0x6b,0xb7,0x29,0xc6,0x40,
+    0x53,0x37,0x52,0x5f,0xb5,0xed,0x3d,0xff,
+    0x93,0x0c,0x13,0x73,0x14,0xf6,0x04,0x01
+},{
+    0x5e,0x27,0x3f,0xcf,0xff,0x6b,0x00,0x7b,
+    0xb6,0x77,0x1e,0x90,0x50,0x92,0x75,0xa7,
+    0x1f,0xf1,0x48,0x0c,0x45,0x9d,0xed,0x26,
+    0xfc,0x7b,0x10,0x66,0x4d,0xb0,0xa6,0x8a,
+    0xaa,0x98,0xbc,0x7e,0xcb,0x07,0xe4,0x9c,
+    0xf0,0x5b,0x80,0xae,0x5a,0xc6,0x53,0xfb,
+    0xdd,0x14,0x27,0x6b,0xbd,0x35,0xcc,0xbc
+}};
+
+const uint8_t h2c_nu_448_x[][56] = {{
+    0xeb,0x5a,0x1f,0xc3,0x76,0xfd,0x73,0x23,
+    0x0a,0xf2,0xde,0x0f,0x33,0x74,0x08,0x7c,
+    0xc7,0xf2,0x79,0xf0,0x46,0x01,0x14,0xcf,
+    0x0a,0x6c,0x12,0xd6,0xd0,0x44,0xc1,0x6d,
+    0xe3,0x4e,0xc2,0x35,0x0c,0x34,0xb2,0x6b,
+    0xf1,0x10,0x37,0x76,0x55,0xab,0x77,0x93,
+    0x68,0x69,0xd0,0x85,0x40,0x6a,0xf7,0x1e
+},{
+    0x46,0x23,0xa6,0x4b,0xce,0xab,0xa3,0x20,
+    0x2d,0xf7,0x6c,0xd8,0xb6,0xe3,0xda,0xf7,
+    0x01,0x64,0xf3,0xfc,0xbd,0xa6,0xd6,0xe3,
+    0x40,0xf7,0xfa,0xb5,0xcd,0xf8,0x91,0x40,
+    0xd9,0x55,0xf7,0x22,0x52,0x4f,0x5f,0xe4,
+    0xd9,0x68,0xfe,0xf6,0xba,0x28,0x53,0xff,
+    0x4e,0xa0,0x86,0xc2,0xf6,0x7d,0x81,0x10
+},{
+    0xe9,0xeb,0x56,0x2e,0x76,0xdb,0x09,0x3b,
+    0xaa,0x43,0xa3,0x1b,0x7e,0xdd,0x04,0xec,
+    0x4a,0xad,0xce,0xf3,0x38,0x9a,0x7b,0x9c,
+    0x58,0xa1,0x9c,0xf8,0x7f,0x8a,0xe3,0xd1,
+    0x54,0xe1,0x34,0xb6,0xb3,0xed,0x45,0x84,
+    0x7a,0x74,0x1e,0x33,0xdf,0x51,0x90,0x3d,
+    0xa6,0x81,0x62,0x9a,0x4b,0x8b,0xcc,0x2e
+},{
+    0x12,0x2a,0x32,0x34,0xd3,0x4b,0x26,0xc6,
+    0x97,0x49,0xf2,0x33,0x56,0x45,0x2b,0xf9,
+    0x50,0x1e,0xfa,0x2d,0x94,0x85,0x9d,0x5e,
+    0xf7,0x41,0xfe,0xf0,0x24,0x15,0x6d,0x9d,
+    0x19,0x1a,0x03,0xa2,0xad,0x24,0xc3,0x81,
+    0x86,0xf9,0x3e,0x02,0xd0,0x55,0x72,0x57,
+    0x59,0x68,0xb0,0x83,0xd8,0xa3,0x97,0x38
+},{
+    0x22,0x17,0x04,0x94,0x9b,0x1c,0xe1,0xab,
+    0x8d,0xd1,0x74,0xdc,0x9b,0x8c,0x56,0xfc,
+    0xff,0xa2,0x71,0x79,0x56,0x9c,0xe9,0x21,
+    0x9c,0x0c,0x2f,0xe1,0x83,0xd3,0xd2,0x33,
+    0x43,0xa4,0xc4,0x2a,0x0e,0x2e,0x9d,0x6b,
+    0x9d,0x0f,0xeb,0x1d,0xf3,0x88,0x3e,0xc4,
+    0x89,0xb6,0x67,0x1d,0x1f,0xa6,0x40,0x89
+}};
+
+const uint8_t h2c_nu_448_y[][56] = {{
+    0xdf,0x5d,0xce,0xa6,0xd4,0x2e,0x8f,0x49,
+    0x4b,0x27,0x9a,0x50,0x0d,0x09,0xe8,0x95,
+    0xd2,0x6a,0xc7,0x03,0xd7,0x5c,0xa6,0xd1,
+    0x18,0xe8,0xca,0x58,0xbf,0x6f,0x60,0x8a,
+    0x2a,0x38,0x3f,0x29,0x2f,0xce,0x15,0x63,
+    0xff,0x99,0x5d,0xce,0x75,0xae,0xde,0x1f,
+    0xdc,0x8e,0x7c,0x0c,0x73,0x7a,0xe9,0xad
+},{
+    0xab,0xaa,0xc3,0x21,0xa1,0x69,0x76,0x1a,
+    0x88,0x02,0xab,0x5b,0x5d,0x10,0x06,0x1f,
+    0xec,0x1a,0x83,0xc6,0x70,0xac,0x6b,0xc9,
+    0x59,0x54,0x70,0x03,0x17,0xee,0x5f,0x82,
+    0x87,0x01,0x20,0xe0,0xe2,0xc5,0xa2,0x1b,
+    0x12,0xa0,0xc7,0xad,0x17,0xeb,0xd3,0x43,
+    0x36,0x36,0x04,0xc4,0xbc,0xec,0xaf,0xd1
+},{
+    0x0c,0xf6,0x60,0x69,0x27,0xad,0x7e,0xb1,
+    0x5d,0xbc,0x19,0x39,0x93,0xbc,0x7e,0x4d,
+    0xda,0x74,0x4b,0x31,0x1a,0x8e,0xc4,0x27,
+    0x4c,0x8f,0x73,0x8f,0x74,0xf6,0x05,0x93,
+    0x45,0x82,0x47,0x4c,0x79,0x26,0x0f,0x60,
+    0x28,0x0f,0xe3,0x5b,0xd3,0x7d,0x43,0x47,
+    0xe5,0x91,0x84,0xcb,0xfa,0x12,0xcb,0xc4
+},{
+    0xdd,0xf5,0x5e,0x74,0xeb,0x44,0x14,0xc2,
+    0xc1,0xfa,0x4a,0xa6,0xbc,0x37,0xc4,0xab,
+    0x47,0x0a,0x3f,0xed,0x6b,0xb5,0xaf,0x1e,
+    0x43,0x57,0x03,0x09,0xb1,0x62,0xfb,0x61,
+    0x87,0x9b,0xb1,0x5f,0x9e,0xa4,0x9c,0x71,
+    0x2e,0xfd,0x42,0xd0,0xa7,0x16,0x66,0x43,
+    0x0f,0x9f,0x0d,0x4a,0x20,0x50,0x50,0x50
+},{
+    0xeb,0xde,0xcf,0xdc,0x87,0x14,0x2d,0x1a,
+    0x91,0x90,0x34,0xbf,0x22,0xec,0xfa,0xd9,
+    0x34,0xc9,0xa8,0x5e,0xff,0xff,0x14,0xb5,
+    0x94,0xae,0x2c,0x00,0x94,0x3c,0xa6,0x2a,
+    0x39,0xd6,0xee,0x3b,0xe9,0xdf,0x0b,0xb5,
+    0x04,0xce,0x8a,0x9e,0x16,0x69,0xbc,0x69,
+    0x59,0xc4,0x2a,0xd6,0xa1,0xd3,0xb6,0x86
+}};
+
+template<> const Block Tests<Ed448Goldilocks>::h2c_dst_ro[] = {
+    Block("QUUX-V01-CS02-with-edwards448_XOF:SHAKE256_ELL2_RO_"),
+    Block("QUUX-V01-CS02-with-edwards448_XOF:SHAKE256_ELL2_RO_"),
+    Block("QUUX-V01-CS02-with-edwards448_XOF:SHAKE256_ELL2_RO_"),
+    Block("QUUX-V01-CS02-with-edwards448_XOF:SHAKE256_ELL2_RO_"),
+    Block("QUUX-V01-CS02-with-edwards448_XOF:SHAKE256_ELL2_RO_")
+};
+
+template<> const Block Tests<Ed448Goldilocks>::h2c_dst_nu[] = {
+    Block("QUUX-V01-CS02-with-edwards448_XOF:SHAKE256_ELL2_NU_"),
+    Block("QUUX-V01-CS02-with-edwards448_XOF:SHAKE256_ELL2_NU_"),
+    Block("QUUX-V01-CS02-with-edwards448_XOF:SHAKE256_ELL2_NU_"),
+    Block("QUUX-V01-CS02-with-edwards448_XOF:SHAKE256_ELL2_NU_"),
+    Block("QUUX-V01-CS02-with-edwards448_XOF:SHAKE256_ELL2_NU_")
+};
+
+template<> const Block Tests<Ed448Goldilocks>::h2c_msg[] = {
+    Block(""),
+    Block("abc"),
+    Block("abcdef0123456789"),
+    Block(
+        "q128_qqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqq"
+        "qqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqqq"
+        "qqqqq"
+    ),
+    Block(
+        "a512_aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa"
+        "aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa"
+        "aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa"
+        "aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa"
+        "aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa"
+        "aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa"
+        "aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa"
+        "aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa"
+        "aaaaa"
+    )
+};
+
+template<> const Block Tests<Ed448Goldilocks>::h2c_ro_x[] = {
+    Block(h2c_ro_448_x[0],56),
+    Block(h2c_ro_448_x[1],56),
+    Block(h2c_ro_448_x[2],56),
+    Block(h2c_ro_448_x[3],56),
+    Block(h2c_ro_448_x[4],56),
+    Block(NULL,0)
+};
+
+template<> const Block Tests<Ed448Goldilocks>::h2c_ro_y[] = {
+    Block(h2c_ro_448_y[0],56),
+    Block(h2c_ro_448_y[1],56),
+    Block(h2c_ro_448_y[2],56),
+    Block(h2c_ro_448_y[3],56),
+    Block(h2c_ro_448_y[4],56),
+    Block(NULL,0)
+};
+
+template<> const Block Tests<Ed448Goldilocks>::h2c_nu_x[] = {
+    Block(h2c_nu_448_x[0],56),
+    Block(h2c_nu_448_x[1],56),
+    Block(h2c_nu_448_x[2],56),
+    Block(h2c_nu_448_x[3],56),
+    Block(h2c_nu_448_x[4],56),
+    Block(NULL,0)
+};
+
+template<> const Block Tests<Ed448Goldilocks>::h2c_nu_y[] = {
+    Block(h2c_nu_448_y[0],56),
+    Block(h2c_nu_448_y[1],56),
+    Block(h2c_nu_448_y[2],56),
+    Block(h2c_nu_448_y[3],56),
+    Block(h2c_nu_448_y[4],56),
+    Block(NULL,0)
+};